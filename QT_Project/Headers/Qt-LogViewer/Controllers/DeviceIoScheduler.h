@@ -0,0 +1,129 @@
+#pragma once
+
+#include <QHash>
+#include <QMap>
+#include <QString>
+#include <QVector>
+
+#include "Qt-LogViewer/Services/StorageDevice.h"
+
+/**
+ * @file DeviceIoScheduler.h
+ * @brief This file contains the definition of the DeviceIoScheduler class.
+ */
+
+/**
+ * @class DeviceIoScheduler
+ * @brief Per-device concurrency limits for file loads, tuned from measured throughput.
+ *
+ * Loads are grouped by the device their file lives on (see StorageDevice). Each device has its
+ * own limit of concurrent loads, so files on different devices always load in parallel while
+ * files on one device only do so if that device benefits:
+ * - Sequential devices (spinning disks, network mounts) are limited to one load, since
+ *   interleaved reads make them seek or compete for one link.
+ * - Other devices start at one load. The aggregate throughput is tracked per concurrency level;
+ *   while the highest level measured so far is also the fastest, the limit probes one level
+ *   further, otherwise it settles on the lowest level no higher level clearly beats.
+ *
+ * Loads smaller than get_min_sample_bytes() are too short to measure and do not change limits.
+ */
+class DeviceIoScheduler
+{
+    public:
+        /**
+         * @struct DeviceMetrics
+         * @brief Scheduling state of one device, for the ingest metrics.
+         */
+        struct DeviceMetrics {
+                quint64 key = 0;
+                QString name;
+                bool sequential = false;
+                int limit = 1;
+                int active = 0;
+                int completed = 0;
+                qint64 bytes = 0;
+                double throughput_mb_s = 0.0;
+        };
+
+        /**
+         * @brief Registers a device; known devices are left unchanged.
+         * @param device The device description.
+         */
+        auto register_device(const StorageDevice::Info& device) -> void;
+
+        /**
+         * @brief Checks whether another load may start on a device.
+         * @param key The device key.
+         * @return True if the device is below its limit.
+         */
+        [[nodiscard]] auto can_start(quint64 key) const -> bool;
+
+        /**
+         * @brief Records that a load started on a device.
+         * @param key The device key.
+         * @return The number of loads now running on the device.
+         */
+        auto on_started(quint64 key) -> int;
+
+        /**
+         * @brief Records that a load ended and retunes the device's limit.
+         * @param key The device key.
+         * @param bytes Bytes read by the load.
+         * @param elapsed_ns Duration of the load.
+         * @param concurrency Number of loads running on the device when it started.
+         */
+        auto on_finished(quint64 key, qint64 bytes, qint64 elapsed_ns, int concurrency) -> void;
+
+        /**
+         * @brief Returns the current limit of a device.
+         * @param key The device key.
+         * @return The limit; 1 for unknown devices.
+         */
+        [[nodiscard]] auto get_limit(quint64 key) const -> int;
+
+        /**
+         * @brief Returns the number of running loads on a device.
+         * @param key The device key.
+         * @return The number of loads.
+         */
+        [[nodiscard]] auto get_active(quint64 key) const -> int;
+
+        /**
+         * @brief Returns the state of all known devices.
+         * @return One entry per device.
+         */
+        [[nodiscard]] auto get_metrics() const -> QVector<DeviceMetrics>;
+
+        /**
+         * @brief Returns the highest limit any device can reach.
+         * @return The maximum concurrent loads per device.
+         */
+        [[nodiscard]] static auto get_max_parallel() -> int;
+
+        /**
+         * @brief Returns the size below which a load is not used for tuning.
+         * @return The size in bytes.
+         */
+        [[nodiscard]] static auto get_min_sample_bytes() -> qint64;
+
+    private:
+        /**
+         * @brief Picks a new limit for a parallel device from its measured throughput.
+         * @param metrics The device's metrics (limit is updated).
+         * @param throughput_by_level Aggregate MB/s per measured concurrency level.
+         */
+        static auto retune(DeviceMetrics& metrics, const QMap<int, double>& throughput_by_level)
+            -> void;
+
+    private:
+        /**
+         * @struct Device
+         * @brief A device with its measured throughput per concurrency level.
+         */
+        struct Device {
+                DeviceMetrics metrics;
+                QMap<int, double> throughput_by_level;
+        };
+
+        QHash<quint64, Device> m_devices;
+};
@@ -1,13 +1,19 @@
 #pragma once
 
+#include <QList>
 #include <QObject>
 #include <QString>
+#include <QStringList>
 #include <QVector>
 
+#include "Qt-LogViewer/Models/LogFileInfo.h"
+
 // Forward declarations to reduce header dependencies
+class FolderScanner;
+class LogAppIdentifier;
 class LogIngestController;
 class LogFileTreeModel;
-class LogFileInfo;
+class QTimer;
 
 /**
  * @file FileCatalogController.h
@@ -15,10 +21,14 @@ class LogFileInfo;
  *
  * Responsibilities:
  * - Own a `LogFileTreeModel` used by the UI.
- * - Add files by probing app name via `LogIngestController::read_first_log_entry` or
- *   falling back to `LogLoader::identify_app`.
- * - Add multiple files by looping over `add_file`.
+ * - Add files without blocking: a file with a cached app name goes straight into its app group,
+ *   any other file appears immediately in the model's provisional group and is regrouped once
+ *   `LogAppIdentifier` has identified it on its worker pool. Batches of files are inserted and
+ *   regrouped with one model insertion per app group.
  * - Remove files from the catalog model.
+ * - Serve watch folders: listings requested by the model (fetchMore) are read by
+ *   `FolderScanner`, folder changes are applied as diffs, and size, modification time and app
+ *   name of folder files are read once the tree first displays them.
  */
 class FileCatalogController: public QObject
 {
@@ -27,19 +37,19 @@ class FileCatalogController: public QObject
     public:
         /**
          * @brief Construct a new FileCatalogController.
-         * @param ingest Non-owning pointer to the ingest controller used to peek first entry.
+         * @param ingest Non-owning pointer to the ingest controller providing the format library.
          * @param parent Optional QObject parent.
          */
         explicit FileCatalogController(LogIngestController* ingest, QObject* parent = nullptr);
 
         /**
-         * @brief Add a single log file into the catalog.
+         * @brief Add a single log file into the catalog (all sessions).
          * @param file_path Absolute path to the log file.
          *
          * Logic:
-         * - Try to read the first entry to extract `app_name`.
-         * - If unavailable, fall back to `LogLoader::identify_app(file_path)`.
-         * - Add resulting `LogFileInfo` to the tree model.
+         * - If the app name is cached for the unchanged file, add it to its app group.
+         * - Otherwise add it to the provisional group and request identification; the file is
+         *   regrouped when `LogAppIdentifier::app_identified` arrives.
          */
         auto add_file(const QString& file_path) -> void;
 
@@ -47,7 +57,7 @@ class FileCatalogController: public QObject
          * @brief Add multiple log files into the catalog.
          * @param file_paths Absolute paths to the log files.
          *
-         * Loops over `add_file(file_path)`.
+         * Identification of the files runs in parallel.
          */
         auto add_files(const QVector<QString>& file_paths) -> void;
 
@@ -72,13 +82,93 @@ class FileCatalogController: public QObject
          */
         auto remove_file(const LogFileInfo& file_info) -> void;
 
+        /**
+         * @brief Add a watch folder to a session; it is listed lazily when expanded in the tree.
+         * @param session_id The session identifier.
+         * @param folder_path The folder path.
+         * @return True if added; false if the session already watches the folder.
+         */
+        auto add_watch_folder(const QString& session_id, const QString& folder_path) -> bool;
+
+        /**
+         * @brief Remove a watch folder from a session.
+         * @param session_id The session identifier.
+         * @param folder_path The folder path.
+         * @return True if removed; false if not found.
+         */
+        auto remove_watch_folder(const QString& session_id, const QString& folder_path) -> bool;
+
         /**
          * @brief Get the underlying tree model used by the UI.
          * @return Pointer to `LogFileTreeModel`.
          */
         [[nodiscard]] auto get_model() -> LogFileTreeModel*;
 
+        /**
+         * @brief Check whether files are still waiting for their app name.
+         * @return True if identifications are pending or not yet regrouped in the model.
+         */
+        [[nodiscard]] auto is_identifying() const -> bool;
+
+        /**
+         * @brief Check whether folder listings or file metadata are still being read.
+         * @return True if scans or metadata requests are pending.
+         */
+        [[nodiscard]] auto is_scanning() const -> bool;
+
+    private:
+        /**
+         * @brief Add files to one session (or all sessions if `session_id` is empty).
+         *
+         * Files with a cached app name are added in one batch, all others in one batch to the
+         * provisional group, so the model emits one row insertion per group.
+         *
+         * @param session_id The session identifier, or empty for all sessions.
+         * @param file_paths Absolute paths to the log files.
+         */
+        auto add_files_impl(const QString& session_id, const QVector<QString>& file_paths)
+            -> void;
+
+        /**
+         * @brief Passes the ingest's current format library to the identifier.
+         */
+        auto sync_identifier_formats() -> void;
+
+        /**
+         * @brief Queues an identified file for regrouping.
+         * @param file_path The file path.
+         * @param app_name The identified app name.
+         */
+        auto handle_app_identified(const QString& file_path, const QString& app_name) -> void;
+
+        /**
+         * @brief Moves all queued identified files from the provisional group to their app
+         *        groups and updates the app names of folder files.
+         */
+        auto flush_identified_files() -> void;
+
+        /**
+         * @brief Applies a folder listing to the model and keeps watching the folder while
+         *        shown.
+         * @param folder_path The scanned folder.
+         * @param sub_folders The absolute paths of the sub folders.
+         * @param files The absolute paths of the log files.
+         */
+        auto handle_folder_scanned(const QString& folder_path, const QStringList& sub_folders,
+                                   const QStringList& files) -> void;
+
+        /**
+         * @brief Reads size, modification time and app name of folder files shown for the
+         *        first time.
+         * @param file_paths The file paths.
+         */
+        auto handle_file_metadata_requested(const QVector<QString>& file_paths) -> void;
+
     private:
         LogFileTreeModel* m_model{nullptr};
         LogIngestController* m_ingest{nullptr};  // non-owning
+        LogAppIdentifier* m_identifier{nullptr};
+        QTimer* m_resolve_timer{nullptr};
+        QList<LogFileInfo> m_identified_files;
+        FolderScanner* m_scanner{nullptr};
 };
@@ -11,7 +11,8 @@
 class ViewRegistry;
 class LogSortFilterProxyModel;
 
-// Kept because FilterState is used/returned by value
+// Kept because FilterState and LogFacetCounts are used/returned by value
+#include "Qt-LogViewer/Models/LogFacetCounts.h"
 #include "Qt-LogViewer/Models/SessionTypes.h"
 
 /**
@@ -22,7 +23,7 @@ class LogSortFilterProxyModel;
  * - Delegate application-name, log-level, and search filters to a view's `LogSortFilterProxyModel`.
  * - Coordinate file-level visibility controls (show-only, toggle, hide).
  * - Provide query helpers for current filters and search parameters.
- * - Compute per-view log level counts based on current entries from `ViewRegistry`.
+ * - Provide per-view log level counts and the facet counts of the rows passing the filter.
  * - Expose static available log levels identical across views.
  * - Adjust per-view visibility state when files are removed (show-only reset, hidden set updates).
  *
@@ -90,6 +91,13 @@ class FilterCoordinator: public QObject
          */
         auto hide_file(const QUuid& view_id, const QString& file_path) -> void;
 
+        /**
+         * @brief Show only entries absent from the baseline in the specified view.
+         * @param view_id Target view.
+         * @param novel_only True to hide entries found in the baseline.
+         */
+        auto set_novel_only(const QUuid& view_id, bool novel_only) -> void;
+
         /**
          * @brief Get current application name filter for a view.
          * @param view_id Target view.
@@ -126,12 +134,27 @@ class FilterCoordinator: public QObject
         [[nodiscard]] auto is_search_regex(const QUuid& view_id) const -> bool;
 
         /**
-         * @brief Compute per-view log level counts using entries from `ViewRegistry`.
+         * @brief Get whether a view shows only entries absent from the baseline.
+         * @param view_id Target view.
+         * @return True if the novelty filter is set, false otherwise.
+         */
+        [[nodiscard]] auto is_novel_only(const QUuid& view_id) const -> bool;
+
+        /**
+         * @brief Compute per-view log level counts over all entries of the view.
          * @param view_id Target view.
          * @return Map of level name -> count.
          */
         [[nodiscard]] auto get_log_level_counts(const QUuid& view_id) const -> QMap<QString, int>;
 
+        /**
+         * @brief Returns the per-level, per-app and per-file counts of the rows passing the
+         *        view's filter.
+         * @param view_id Target view.
+         * @return The facet counts (empty if the view is unknown).
+         */
+        [[nodiscard]] auto get_match_counts(const QUuid& view_id) const -> LogFacetCounts;
+
         /**
          * @brief Static list of available log levels (same across all views).
          * @return Vector of log level names.
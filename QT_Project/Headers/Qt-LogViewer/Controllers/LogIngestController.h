@@ -1,5 +1,6 @@
 #pragma once
 
+#include <QHash>
 #include <QObject>
 #include <QString>
 #include <QUuid>
@@ -7,14 +8,24 @@
 
 #include "Qt-LogViewer/Controllers/LogViewLoadQueue.h"
 #include "Qt-LogViewer/Models/LogEntry.h"
+#include "Qt-LogViewer/Models/LogFilter.h"
 #include "Qt-LogViewer/Services/LogLoadingService.h"
 
+class TaskRegistry;
+
 /**
  * @file LogIngestController.h
  * @brief Declares the LogIngestController class that encapsulates synchronous and asynchronous
- *        ingestion (parsing/streaming) of log files. It owns the loading service and queue,
+ *        ingestion (parsing/streaming) of log files. It owns the loading services and queue,
  *        maps low-level loader signals to per-view signals, and provides helpers to enqueue,
  *        start-next and cancel streaming for specific views.
+ *
+ * Each loading service streams one file at a time. Further services ("lanes") are created on
+ * demand, up to DeviceIoScheduler::get_max_parallel(), whenever the queue's per-device limits
+ * allow another file to load in parallel.
+ *
+ * Each view's filter settings (set_view_filter()) are handed to the lanes streaming into it, so
+ * batches arrive with the filter verdicts already computed on the parser threads.
  */
 class LogIngestController: public QObject
 {
@@ -50,6 +61,40 @@ class LogIngestController: public QObject
          */
         [[nodiscard]] auto read_first_log_entry(const QString& file_path) const -> LogEntry;
 
+        /**
+         * @brief Adds user-defined formats used for per-file format detection.
+         * @param formats Format strings (e.g. "{timestamp} [{thread}] {level} {message}").
+         */
+        auto add_log_formats(const QVector<QString>& formats) -> void;
+
+        /**
+         * @brief Returns the formats used for per-file format detection.
+         * @return List of format strings; the configured format comes first.
+         */
+        [[nodiscard]] auto get_log_formats() const -> QVector<QString>;
+
+        /**
+         * @brief Sets the length above which streamed lines are truncated, for all lanes.
+         * @param max_line_bytes The limit in bytes; values <= 0 restore the default.
+         */
+        auto set_max_line_length(qsizetype max_line_bytes) -> void;
+
+        /**
+         * @brief Sets the registry streams are reported to as tasks owned by their view.
+         * @param registry The task registry (not owned), or nullptr.
+         */
+        auto set_task_registry(TaskRegistry* registry) -> void;
+
+        /**
+         * @brief Sets the filter settings batches streamed into a view are evaluated against.
+         *
+         * Lanes already streaming into the view switch to the new settings with their next batch.
+         *
+         * @param view_id Target view id.
+         * @param spec The view's filter settings.
+         */
+        auto set_view_filter(const QUuid& view_id, const LogFilter::Spec& spec) -> void;
+
         /**
          * @brief Enqueues a file to be streamed for a specific view.
          *        Idempotent per `(view_id, file_path)`.
@@ -59,29 +104,45 @@ class LogIngestController: public QObject
         auto enqueue_stream(const QUuid& view_id, const QString& file_path) -> void;
 
         /**
-         * @brief Attempts to start the next asynchronous load if none is active.
+         * @brief Starts pending loads on idle lanes as far as the device limits allow.
          * @param batch_size Number of entries per batch appended to the model.
+         * @return The view ids of the loads started by this call, in start order.
          */
-        auto start_next_if_idle(qsizetype batch_size) -> void;
+        auto start_next_if_idle(qsizetype batch_size) -> QVector<QUuid>;
 
         /**
          * @brief Cancels any ongoing streaming for the specified view and clears its pending queue.
+         *
+         * The view's filter settings are dropped as well; set them again before enqueueing.
+         *
          * @param view_id The view to cancel streaming for.
          */
         auto cancel_for_view(const QUuid& view_id) -> void;
 
         /**
-         * @brief Returns the active view id (empty if none).
-         * @return The currently active view id, or a null QUuid if idle.
+         * @brief Returns the view id of the oldest active load (empty if none).
+         * @return The active view id, or a null QUuid if idle.
          */
         [[nodiscard]] auto get_active_view_id() const -> QUuid;
 
         /**
-         * @brief Returns the active file path (empty if none).
-         * @return The currently active file path, or empty if idle.
+         * @brief Returns the file path of the oldest active load (empty if none).
+         * @return The active file path, or empty if idle.
          */
         [[nodiscard]] auto get_active_file_path() const -> QString;
 
+        /**
+         * @brief Returns the number of files loading right now.
+         * @return The number of active loads.
+         */
+        [[nodiscard]] auto get_active_count() const -> int;
+
+        /**
+         * @brief Returns the per-device concurrency limits and measured throughput.
+         * @return One entry per storage device files were loaded from.
+         */
+        [[nodiscard]] auto get_device_metrics() const -> QVector<DeviceIoScheduler::DeviceMetrics>;
+
         /**
          * @brief Returns the number of pending items in the queue.
          * @return Count of pending `(view_id, file_path)` pairs.
@@ -100,9 +161,11 @@ class LogIngestController: public QObject
          * @param view_id View receiving streamed data.
          * @param file_path File being streamed.
          * @param batch Parsed entries batch.
+         * @param verdicts The batch's filter verdicts and facet counts.
          */
         void entry_batch_parsed(const QUuid& view_id, const QString& file_path,
-                                const QVector<LogEntry>& batch);
+                                const QVector<LogEntry>& batch,
+                                const LogFilter::BatchVerdicts& verdicts);
 
         /**
          * @brief Emitted to report streaming progress for a specific view.
@@ -133,19 +196,38 @@ class LogIngestController: public QObject
          * @brief Emitted when the underlying loader reports idle (safe to start next task).
          *
          * This mirrors `LogLoadingService::streaming_idle` and indicates a definitive
-         * worker-idle state. Controllers can use this to advance the queue.
+         * worker-idle state. Pending loads the freed lane allows are started before.
+         *
+         * @param started_view_ids The view ids of the loads started on this idle, in start order.
          */
-        void idle();
+        void idle(const QVector<QUuid>& started_view_ids);
 
     private:
         /**
-         * @brief Wires internal service signals and maps them to per-view signals using the queue's
-         *        active view id. Keeps logic aligned with previous `LogViewerController` behavior.
+         * @brief Creates a loading service and wires its signals.
+         * @return The new lane (owned by this controller).
+         */
+        auto add_lane() -> LogLoadingService*;
+
+        /**
+         * @brief Returns a lane without an active load, creating one if all are busy.
+         * @return The lane, or nullptr if the maximum number of lanes is busy.
+         */
+        auto get_idle_lane() -> LogLoadingService*;
+
+        /**
+         * @brief Wires a service's signals and maps them to per-view signals using the view the
+         *        queue reports as active on that service.
+         * @param lane The loading service.
          */
-        auto wire_service_signals() -> void;
+        auto wire_service_signals(LogLoadingService* lane) -> void;
 
     private:
-        LogLoadingService m_loader;
+        QString m_log_format;
+        QVector<QString> m_extra_formats;
+        qsizetype m_max_line_length = 0;
+        QVector<LogLoadingService*> m_lanes;
         LogViewLoadQueue m_queue;
+        QHash<QUuid, LogFilter::Spec> m_view_filters;
         bool m_is_shutting_down{false};
 };
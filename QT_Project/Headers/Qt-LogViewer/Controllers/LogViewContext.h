@@ -1,18 +1,27 @@
 #pragma once
 
+#include <QBitArray>
+#include <QHash>
 #include <QList>
 #include <QObject>
 #include <QString>
 #include <QVector>
+#include <memory>
 
 // Value types used in API - need full definitions
+#include "Qt-LogViewer/Models/LogBaseline.h"
+#include "Qt-LogViewer/Models/LogDedupeSet.h"
 #include "Qt-LogViewer/Models/LogEntry.h"
+#include "Qt-LogViewer/Models/LogEntryStore.h"
 #include "Qt-LogViewer/Models/LogFileInfo.h"
+#include "Qt-LogViewer/Models/LogFilter.h"
+#include "Qt-LogViewer/Services/TaskToken.h"
 
 // Forward declarations (pointer members only)
 class LogModel;
 class LogSortFilterProxyModel;
 class PagingProxyModel;
+class QThreadPool;
 
 /**
  * @file LogViewContext.h
@@ -27,6 +36,8 @@ class PagingProxyModel;
  * - Own and wire the per-view model chain: LogModel -> LogSortFilterProxyModel -> PagingProxyModel.
  * - Track the files loaded in this view.
  * - Provide convenience methods to append/remove entries and query file paths.
+ * - Optionally drop appended entries that repeat entries of another file of the view.
+ * - Tag entries absent from the active baseline as novel.
  *
  */
 class LogViewContext final: public QObject
@@ -41,7 +52,7 @@ class LogViewContext final: public QObject
         explicit LogViewContext(QObject* parent = nullptr);
 
         /**
-         * @brief Destroys the context and its owned components.
+         * @brief Cancels a running retag, waits for it and destroys the owned components.
          */
         ~LogViewContext() override;
 
@@ -65,15 +76,36 @@ class LogViewContext final: public QObject
 
         /**
          * @brief Appends log entries to the underlying model.
+         *
+         * With dedupe enabled, entries another file of the view already has are dropped. The
+         * remaining entries are tagged against the baseline, if one is set.
+         *
          * @param entries The batch of entries to append.
          */
         auto append_entries(const QVector<LogEntry>& entries) -> void;
 
+        /**
+         * @brief Appends log entries whose filter verdicts were computed while parsing.
+         *
+         * The sort proxy takes the verdicts instead of evaluating the new rows if they were
+         * computed with its current filter settings. With dedupe enabled, entries another file of
+         * the view already has are dropped together with their verdicts, using the dedupe keys
+         * of the verdicts if the parser computed them. Entries the parser tagged against another
+         * baseline than the view's are tagged again.
+         *
+         * @param entries The batch of entries to append.
+         * @param verdicts The batch's verdicts.
+         * @return True if the verdicts matched the proxy's filter settings.
+         */
+        auto append_entries(const QVector<LogEntry>& entries,
+                            const LogFilter::BatchVerdicts& verdicts) -> bool;
+
         /**
          * @brief Removes all entries belonging to the given file path from the model.
          * @param file_path Absolute file path to remove.
+         * @return The files that dropped entries as duplicates of the removed file.
          */
-        auto remove_entries_by_file_path(const QString& file_path) -> void;
+        auto remove_entries_by_file_path(const QString& file_path) -> QStringList;
 
         /**
          * @brief Returns a copy of all entries currently in the model.
@@ -81,6 +113,12 @@ class LogViewContext final: public QObject
          */
         [[nodiscard]] auto get_entries() const -> QVector<LogEntry>;
 
+        /**
+         * @brief Returns an immutable snapshot of the entries in the model (no copy).
+         * @return The snapshot (empty if there is no model).
+         */
+        [[nodiscard]] auto get_snapshot() const -> LogEntryStore::Snapshot;
+
         /**
          * @brief Sets the list of files considered loaded for this view.
          * @param files The list to set.
@@ -110,10 +148,126 @@ class LogViewContext final: public QObject
          */
         auto clear_loaded_files() -> void;
 
+        /**
+         * @brief Enables or disables dropping entries that repeat entries of another file.
+         *
+         * Enabling records the keys of the entries already shown, without dropping any of them;
+         * later appends skip entries whose key another file of the view produced first.
+         * Disabling forgets the keys and the duplicate counts.
+         *
+         * @param enabled True to drop duplicates across files.
+         */
+        auto set_dedupe_enabled(bool enabled) -> void;
+
+        /**
+         * @brief Checks whether duplicates across files are dropped.
+         * @return True if dedupe is enabled.
+         */
+        [[nodiscard]] auto is_dedupe_enabled() const -> bool;
+
+        /**
+         * @brief Checks whether the dedupe set is still being seeded with the shown entries.
+         * @return True while the seeding task runs.
+         */
+        [[nodiscard]] auto is_dedupe_seeding() const -> bool;
+
+        /**
+         * @brief Returns the number of entries dropped as duplicates, per file.
+         * @return Map of file path to dropped entries (files without duplicates are absent).
+         */
+        [[nodiscard]] auto get_duplicate_counts() const -> QHash<QString, int>;
+
+        /**
+         * @brief Sets the baseline entries are tagged against (see LogEntry::is_novel()).
+         *
+         * Entries appended from now on are tagged against the new baseline. The entries already
+         * shown are tagged again on a worker thread; the tags are then applied without a model
+         * reset (see LogModel::set_novel_tags()), and the sort proxy passes the baseline on to
+         * the parser threads with its filter settings.
+         *
+         * @param baseline The baseline, or nullptr to remove the tags.
+         */
+        auto set_baseline(std::shared_ptr<const LogBaseline> baseline) -> void;
+
+        /**
+         * @brief Returns the baseline entries are tagged against.
+         * @return The baseline, or nullptr.
+         */
+        [[nodiscard]] auto get_baseline() const -> std::shared_ptr<const LogBaseline>;
+
+    private:
+        /**
+         * @brief Removes the entries of a batch that another file of the view already has.
+         * @param entries The batch; duplicates are removed in place.
+         * @param keys One dedupe key per entry, or empty to compute them here.
+         * @param verdicts The batch's verdicts, compacted alongside; nullptr if there are none.
+         */
+        auto drop_duplicates(QVector<LogEntry>& entries, const QVector<quint64>& keys,
+                             LogFilter::BatchVerdicts* verdicts) -> void;
+
+        /**
+         * @brief Sizes the dedupe set for a file about to be loaded into the view.
+         * @param file_path The file path.
+         */
+        auto reserve_dedupe(const QString& file_path) -> void;
+
+        /**
+         * @brief Tags entries against the view's baseline, or removes their tags without one.
+         * @param entries The entries.
+         */
+        auto tag_entries(QVector<LogEntry>& entries) const -> void;
+
+        /**
+         * @brief Tags the model's rows against the baseline on the worker, cancelling a running
+         *        retag.
+         */
+        auto start_retag() -> void;
+
+        /**
+         * @brief Applies the tags of a finished retag if it is still current.
+         *
+         * If rows were replaced or removed meanwhile (new store epoch), the retag starts over.
+         *
+         * @param generation The retag the tags were computed for.
+         * @param epoch The store epoch of the tagged snapshot.
+         * @param tags One bit per tagged row.
+         */
+        auto apply_retag(quint64 generation, quint64 epoch, const QBitArray& tags) -> void;
+
+        /**
+         * @brief Seeds a dedupe set with the model's rows on the worker, cancelling a running
+         *        seeding.
+         */
+        auto start_dedupe_seed() -> void;
+
+        /**
+         * @brief Adopts the set of a finished seeding if it is still current.
+         *
+         * If rows were replaced or removed meanwhile (new store epoch), the seeding starts over.
+         *
+         * @param generation The seeding the set was filled for.
+         * @param epoch The store epoch of the seeded snapshot.
+         * @param seed The keys of the snapshot's rows.
+         */
+        auto apply_dedupe_seed(quint64 generation, quint64 epoch, const LogDedupeSet& seed)
+            -> void;
+
     private:
         LogModel* m_model;
         LogSortFilterProxyModel* m_sort_proxy;
         PagingProxyModel* m_paging_proxy;
 
         QList<LogFileInfo> m_loaded_files;
+        LogDedupeSet m_dedupe;
+        bool m_dedupe_enabled = false;
+        std::shared_ptr<const LogBaseline> m_baseline;
+
+        // Retags the shown rows after a baseline change.
+        QThreadPool* m_pool{nullptr};
+        TaskToken m_retag_token;
+        quint64 m_retag_generation = 0;
+        // Seeds the dedupe set with the shown rows after dedupe is enabled.
+        TaskToken m_dedupe_token;
+        quint64 m_dedupe_generation = 0;
+        bool m_dedupe_seeding = false;
 };
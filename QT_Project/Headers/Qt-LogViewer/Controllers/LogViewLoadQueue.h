@@ -1,20 +1,70 @@
 #pragma once
 
+#include <QElapsedTimer>
+#include <QHash>
 #include <QList>
-#include <QPair>
+#include <QPointer>
 #include <QString>
 #include <QUuid>
+#include <QVector>
+
+#include "Qt-LogViewer/Controllers/DeviceIoScheduler.h"
+#include "Qt-LogViewer/Services/StorageDevice.h"
+#include "Qt-LogViewer/Services/TaskRegistry.h"
+#include "Qt-LogViewer/Services/TaskToken.h"
 
 // Forward declaration (owned/used by pointer in API)
 class LogLoadingService;
 
 /**
- * @file LogViewLoadQueue.h
+ * @class LogViewLoadQueue
+ * @brief Coordinates streaming order across views. Holds a global queue of `(view_id, file_path)`,
+ *        tracks the active stream of every loader, and provides cancel/clear helpers.
+ *
+ * Responsibilities:
+ * - Enqueue streaming requests for specific views.
+ * - Start the next stream on an idle `LogLoadingService` (a "lane"); a loader runs one stream.
+ * - Limit concurrent streams per storage device through a `DeviceIoScheduler`: the oldest
+ *   pending file whose device is below its limit starts next, so files on other devices are
+ *   not held up behind a busy disk.
+ * - Track the active `(view_id, file_path, batch_size)` per loader.
+ * - Cancel the active stream by view and clear pending requests per view.
+ * - Register active streams as tasks (owned by their view) if a `TaskRegistry` is set.
+ *
+ * Usage:
+ * - Call `enqueue(view_id, path)` for each file to stream.
+ * - Call `try_start_next(loader, batch_size)` for idle loaders or on `streaming_idle`.
+ * - On `streaming_idle` of a loader, call `clear_active(loader)`.
+ * - On view removal or cancel, call `cancel_if_active(loader, view_id)` to stop active and purge
+ * pending.
+ */
+file LogViewLoadQueue.h
  * @brief Declares the LogViewLoadQueue which coordinates per-view async log streaming.
  */
 
 /**
  * @class LogViewLoadQueue
+ * @brief Coordinates streaming order across views. Holds a global queue of `(view_id, file_path)`,
+ *        tracks the active stream of every loader, and provides cancel/clear helpers.
+ *
+ * Responsibilities:
+ * - Enqueue streaming requests for specific views.
+ * - Start the next stream on an idle `LogLoadingService` (a "lane"); a loader runs one stream.
+ * - Limit concurrent streams per storage device through a `DeviceIoScheduler`: the oldest
+ *   pending file whose device is below its limit starts next, so files on other devices are
+ *   not held up behind a busy disk.
+ * - Track the active `(view_id, file_path, batch_size)` per loader.
+ * - Cancel the active stream by view and clear pending requests per view.
+ * - Register active streams as tasks (owned by their view) if a `TaskRegistry` is set.
+ *
+ * Usage:
+ * - Call `enqueue(view_id, path)` for each file to stream.
+ * - Call `try_start_next(loader, batch_size)` for idle loaders or on `streaming_idle`.
+ * - On `streaming_idle` of a loader, call `clear_active(loader)`.
+ * - On view removal or cancel, call `cancel_if_active(loader, view_id)` to stop active and purge
+ * pending.
+ */
+class LogViewLoadQueue
  * @brief Coordinates streaming order across views. Holds a global queue of `(view_id, file_path)`,
  *        tracks the single active stream, and provides cancel/clear helpers.
  *
@@ -23,6 +73,7 @@ class LogLoadingService;
  * - Start the next stream when idle using `LogLoadingService`.
  * - Track the currently active `(view_id, file_path, batch_size)`.
  * - Cancel the active stream by view and clear pending requests per view.
+ * - Register the active stream as a task (owned by its view) if a `TaskRegistry` is set.
  *
  * Usage:
  * - Call `enqueue(view_id, path)` for each file to stream.
@@ -34,6 +85,12 @@ class LogLoadingService;
 class LogViewLoadQueue
 {
     public:
+        /**
+         * @brief Sets the registry active streams are registered with (not owned).
+         * @param registry The task registry, or nullptr.
+         */
+        auto set_task_registry(TaskRegistry* registry) -> void;
+
         /**
          * @brief Enqueues a file to be streamed for a specific view.
          *
@@ -46,13 +103,25 @@ class LogViewLoadQueue
         auto enqueue(const QUuid& view_id, const QString& file_path) -> void;
 
         /**
-         * @brief Attempts to start the next async stream if none is active.
+         * @brief Attempts to start the next async stream on a loader without an active stream.
+         *
+         * Starts the oldest pending file whose device is below its concurrency limit.
+         *
          * @param loader Loader service to start the stream.
          * @param batch_size Entries per emitted batch for the next stream.
          * @return True if a new stream started; false otherwise.
          */
         [[nodiscard]] auto try_start_next(LogLoadingService* loader, qsizetype batch_size) -> bool;
 
+        /**
+         * @brief Returns the view of the file try_start_next() would start now.
+         *
+         * Lets the caller configure the loader for that view before the stream starts.
+         *
+         * @return The view id, or a null id if no pending file can start.
+         */
+        [[nodiscard]] auto get_next_view_id() const -> QUuid;
+
         /**
          * @brief Clears all pending items for the specified view.
          * @param view_id Target view id.
@@ -60,7 +129,8 @@ class LogViewLoadQueue
         auto clear_pending_for_view(const QUuid& view_id) -> void;
 
         /**
-         * @brief Cancels the active stream if it belongs to the specified view and clears pendings.
+         * @brief Cancels the loader's active stream if it belongs to the specified view and clears
+         *        pendings.
          * @param loader Loader service used to cancel the active stream if needed.
          * @param view_id Target view id.
          */
@@ -73,25 +143,52 @@ class LogViewLoadQueue
         auto clear_active_if(const QString& file_path) -> void;
 
         /**
-         * @brief Unconditionally clears the active stream state.
+         * @brief Unconditionally clears the active stream state of all loaders.
+         */
+        auto clear_active() -> void;
+
+        /**
+         * @brief Unconditionally clears the active stream state of one loader.
          *
          * Use this when a definitive "idle" signal is received from the loader/service,
          * regardless of file path normalization differences.
+         *
+         * @param loader The loader that became idle.
          */
-        auto clear_active() -> void;
+        auto clear_active(const LogLoadingService* loader) -> void;
 
         /**
-         * @brief Returns the active view id (empty if none).
-         * @return The currently active view id, or a null QUuid if idle.
+         * @brief Returns the view id of the oldest active stream (empty if none).
+         * @return The active view id, or a null QUuid if idle.
          */
         [[nodiscard]] auto get_active_view_id() const -> QUuid;
 
         /**
-         * @brief Returns the active file path (empty if none).
-         * @return The currently active file path, or empty if idle.
+         * @brief Returns the view id of a loader's active stream.
+         * @param loader The loader.
+         * @return The active view id, or a null QUuid if the loader is idle.
+         */
+        [[nodiscard]] auto get_active_view_id(const LogLoadingService* loader) const -> QUuid;
+
+        /**
+         * @brief Returns the file path of the oldest active stream (empty if none).
+         * @return The active file path, or empty if idle.
          */
         [[nodiscard]] auto get_active_file_path() const -> QString;
 
+        /**
+         * @brief Returns the number of active streams.
+         * @return The number of loaders with an active stream.
+         */
+        [[nodiscard]] auto get_active_count() const -> int;
+
+        /**
+         * @brief Checks whether a loader has an active stream.
+         * @param loader The loader.
+         * @return True if the loader is streaming.
+         */
+        [[nodiscard]] auto is_active(const LogLoadingService* loader) const -> bool;
+
         /**
          * @brief Returns the number of pending items in the queue.
          * @return Count of pending (view_id, file_path) pairs.
@@ -104,9 +201,74 @@ class LogViewLoadQueue
          */
         [[nodiscard]] auto get_active_batch_size() const -> qsizetype;
 
+        /**
+         * @brief Returns the per-device scheduling state.
+         * @return One entry per device that files were enqueued from.
+         */
+        [[nodiscard]] auto get_device_metrics() const -> QVector<DeviceIoScheduler::DeviceMetrics>;
+
+    private:
+        /**
+         * @struct PendingItem
+         * @brief A file waiting to be streamed.
+         */
+        struct PendingItem {
+                QUuid view_id;
+                QString file_path;
+                quint64 device_key = 0;
+        };
+
+        /**
+         * @struct ActiveItem
+         * @brief A file being streamed by a loader.
+         */
+        struct ActiveItem {
+                const LogLoadingService* loader = nullptr;
+                QUuid view_id;
+                QString file_path;
+                quint64 device_key = 0;
+                int concurrency = 1;
+                TaskToken token;
+                QElapsedTimer timer;
+        };
+
+        /**
+         * @brief Ends an active stream: reports it to the scheduler and the task registry.
+         * @param index Index into m_active.
+         */
+        auto finish_active(qsizetype index) -> void;
+
+        /**
+         * @brief Returns the index of the oldest pending file whose device can start a stream.
+         * @return The index into m_queue, or -1.
+         */
+        [[nodiscard]] auto find_next_pending() const -> qsizetype;
+
+        /**
+         * @brief Returns the index of a loader's active stream.
+         * @param loader The loader.
+         * @return The index into m_active, or -1.
+         */
+        [[nodiscard]] auto find_active(const LogLoadingService* loader) const -> qsizetype;
+
+        /**
+         * @brief Returns the device of a file, probing it once per directory.
+         *
+         * Probing reads the mount table, stats the path and reads sysfs, which is slow (and may
+         * block on a stale network mount); files of one directory share a device, so later
+         * files of a directory are served from the cache.
+         *
+         * @param file_path The file.
+         * @return The device description.
+         */
+        auto get_device(const QString& file_path) -> StorageDevice::Info;
+
     private:
-        QList<QPair<QUuid, QString>> m_queue;
-        QUuid m_active_view_id;
-        QString m_active_file_path;
+        QList<PendingItem> m_queue;
+        QVector<ActiveItem> m_active;
         qsizetype m_active_batch_size{1000};
+        QPointer<TaskRegistry> m_registry;
+        DeviceIoScheduler m_scheduler;
+        // Device per absolute directory path, see get_device().
+        QHash<QString, StorageDevice::Info> m_devices_by_dir;
 };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <QHash>
 #include <QList>
 #include <QMap>
 #include <QObject>
@@ -7,14 +8,18 @@
 #include <QString>
 #include <QUuid>
 #include <QVector>
+#include <memory>
 
 // Value types used by value in API
 #include "Qt-LogViewer/Models/LogEntry.h"
+#include "Qt-LogViewer/Models/LogFacetCounts.h"
 #include "Qt-LogViewer/Models/LogFileInfo.h"
 #include "Qt-LogViewer/Models/SessionTypes.h"
 
 // Forward declarations (pointers only)
 class FileCatalogController;
+class LogBaseline;
+class LogBaselineBuilder;
 class FilterCoordinator;
 class LogIngestController;
 class LogViewContext;
@@ -23,6 +28,7 @@ class LogModel;
 class LogSortFilterProxyModel;
 class PagingProxyModel;
 class LogFileTreeModel;
+class TaskRegistry;
 
 /**
  * @file LogViewerController.h
@@ -106,6 +112,24 @@ class LogViewerController: public QObject
         auto add_log_files_to_session(const QString& session_id,
                                       const QVector<QString>& file_paths) -> void;
 
+        /**
+         * @brief Adds a watch folder to a session in the LogFileTreeModel.
+         * @param session_id The session identifier.
+         * @param folder_path The folder path.
+         * @return True if added; false if the session already watches the folder.
+         */
+        auto add_watch_folder_to_session(const QString& session_id, const QString& folder_path)
+            -> bool;
+
+        /**
+         * @brief Removes a watch folder from a session in the LogFileTreeModel.
+         * @param session_id The session identifier.
+         * @param folder_path The folder path.
+         * @return True if removed; false if not found.
+         */
+        auto remove_watch_folder_from_session(const QString& session_id,
+                                              const QString& folder_path) -> bool;
+
         /**
          * @brief Loads a single log file and creates a new view (model/proxy) for it.
          * @param file_path The LogFileInfo to load and display.
@@ -166,6 +190,91 @@ class LogViewerController: public QObject
          */
         auto cancel_loading(const QUuid& view_id) -> void;
 
+        /**
+         * @brief Adds user-defined log formats used for per-file format detection.
+         *
+         * Each loaded file is parsed with the best matching format out of the configured
+         * format, the built-in format library and the formats added here.
+         *
+         * @param formats Format strings (e.g. "{timestamp} [{thread}] {level} {message}").
+         */
+        auto add_log_formats(const QVector<QString>& formats) -> void;
+
+        /**
+         * @brief Sets the length above which log lines are truncated while streaming.
+         *
+         * Longer lines keep a prefix of this size; the details pane reads the rest from disk.
+         *
+         * @param max_line_bytes The limit in bytes; values <= 0 restore the default.
+         */
+        auto set_max_line_length(qsizetype max_line_bytes) -> void;
+
+        /**
+         * @brief Enables or disables skipping entries repeated across the files of a view.
+         *
+         * Overlapping copies of a log (rotated backups, the same file from two machines) then
+         * show each entry once. Entries already shown are kept; the setting affects later loads.
+         *
+         * @param enabled True to drop duplicates across files.
+         */
+        auto set_dedupe_enabled(bool enabled) -> void;
+
+        /**
+         * @brief Checks whether entries repeated across the files of a view are skipped.
+         * @return True if dedupe is enabled.
+         */
+        [[nodiscard]] auto is_dedupe_enabled() const -> bool;
+
+        /**
+         * @brief Returns the number of entries skipped as duplicates, per file of a view.
+         * @param view_id The view id.
+         * @return Map of file path to skipped entries (empty if the view does not exist).
+         */
+        [[nodiscard]] auto get_duplicate_counts(const QUuid& view_id) const
+            -> QHash<QString, int>;
+
+        /**
+         * @brief Builds a baseline from reference log files in the background.
+         *
+         * The files are parsed in parallel into message fingerprints. Once done, the entries of
+         * all views are tagged as novel if their message is absent from the baseline, and
+         * baseline_changed() is emitted.
+         *
+         * @param file_paths The reference ("healthy") log files.
+         */
+        auto build_baseline(const QVector<QString>& file_paths) -> void;
+
+        /**
+         * @brief Cancels a running baseline build and removes the baseline from all views.
+         */
+        auto clear_baseline() -> void;
+
+        /**
+         * @brief Returns the baseline entries are tagged against.
+         * @return The baseline, or nullptr.
+         */
+        [[nodiscard]] auto get_baseline() const -> std::shared_ptr<const LogBaseline>;
+
+        /**
+         * @brief Checks whether a baseline is being built.
+         * @return True while reference files are being parsed.
+         */
+        [[nodiscard]] auto is_baseline_building() const -> bool;
+
+        /**
+         * @brief Shows only entries absent from the baseline in the specified view.
+         * @param view_id The QUuid of the view.
+         * @param novel_only True to hide entries found in the baseline.
+         */
+        auto set_novel_only_filter(const QUuid& view_id, bool novel_only) -> void;
+
+        /**
+         * @brief Returns whether the specified view shows only entries absent from the baseline.
+         * @param view_id The QUuid of the view.
+         * @return True if the novelty filter is set.
+         */
+        [[nodiscard]] auto is_novel_only_filter(const QUuid& view_id) const -> bool;
+
         /**
          * @brief Sets the application name filter for the current view.
          * @param app_name The application name to filter by.
@@ -251,6 +360,16 @@ class LogViewerController: public QObject
          */
         [[nodiscard]] auto get_paging_proxy(const QUuid& view_id) -> PagingProxyModel*;
 
+        /**
+         * @brief Returns the registry of long-running operations (loads, index builds).
+         *
+         * Tasks owned by a view are cancelled when the view is removed; all tasks are cancelled
+         * when the controller is destroyed.
+         *
+         * @return Pointer to the TaskRegistry.
+         */
+        [[nodiscard]] auto get_task_registry() const -> TaskRegistry*;
+
         /**
          * @brief Returns the set of unique application names from the loaded logs in the current
          * view.
@@ -306,6 +425,14 @@ class LogViewerController: public QObject
          */
         [[nodiscard]] auto get_log_level_counts() const -> QMap<QString, int>;
 
+        /**
+         * @brief Returns the per-level, per-app and per-file counts of the entries passing the
+         *        filters of the specified view.
+         * @param view_id The QUuid of the view.
+         * @return The facet counts.
+         */
+        [[nodiscard]] auto get_match_counts(const QUuid& view_id) const -> LogFacetCounts;
+
         /**
          * @brief Returns the set of log levels being filtered for the specified view.
          * @param view_id The QUuid of the view.
@@ -472,6 +599,57 @@ class LogViewerController: public QObject
         auto import_view_state_for_session(const QString& session_id,
                                            const SessionViewState& state) -> QUuid;
 
+        /**
+         * @brief Registers a view state for lazy restore without creating models or loading.
+         *
+         * The view's files are added to the session's explorer tree (using the stored app names,
+         * so no file is read). Until materialize_view() is called the view is a lightweight
+         * placeholder: it is reported by get_all_view_ids(), get_view_file_paths() and
+         * export_view_state(), so saving a session keeps it.
+         *
+         * @param session_id The session identifier for the tree model.
+         * @param state The view state to restore later.
+         * @return The id of the deferred view (a new id if the state has none).
+         */
+        auto register_deferred_view(const QString& session_id, const SessionViewState& state)
+            -> QUuid;
+
+        /**
+         * @brief Checks whether a view is a deferred (not yet materialized) view.
+         * @param view_id The view identifier.
+         * @return True if the view is deferred.
+         */
+        [[nodiscard]] auto is_view_deferred(const QUuid& view_id) const -> bool;
+
+        /**
+         * @brief Returns the ids of all deferred views in registration order.
+         * @return Vector of deferred view ids.
+         */
+        [[nodiscard]] auto get_deferred_view_ids() const -> QVector<QUuid>;
+
+        /**
+         * @brief Returns the stored state of a deferred view.
+         * @param view_id The view identifier.
+         * @return The stored state, or a default state if the view is not deferred.
+         */
+        [[nodiscard]] auto get_deferred_view_state(const QUuid& view_id) const
+            -> SessionViewState;
+
+        /**
+         * @brief Creates models for a deferred view, applies its state and queues its files.
+         * @param view_id The deferred view identifier.
+         * @param background True for idle prefetch: loads of this view never switch the
+         *        current view.
+         * @return True if the view was deferred and has been materialized.
+         */
+        auto materialize_view(const QUuid& view_id, bool background = false) -> bool;
+
+        /**
+         * @brief Checks whether no file is loading or queued for loading.
+         * @return True if the ingest pipeline is idle.
+         */
+        [[nodiscard]] auto is_loading_idle() const -> bool;
+
     signals:
         /**
          * @brief Signal emitted when the current view ID changes.
@@ -515,6 +693,18 @@ class LogViewerController: public QObject
          */
         void view_file_paths_changed(const QUuid& view_id, const QVector<QString>& file_paths);
 
+        /**
+         * @brief Emitted after each reference file of a baseline build was parsed.
+         * @param files_done The number of files done.
+         * @param file_count The number of reference files.
+         */
+        void baseline_progress(int files_done, int file_count);
+
+        /**
+         * @brief Emitted when a baseline was built or cleared and the views were tagged.
+         */
+        void baseline_changed();
+
     public slots:
         /**
          * @brief Removes a single log file from all views and from the LogFileTreeModel.
@@ -536,6 +726,9 @@ class LogViewerController: public QObject
     private:
         /**
          * @brief Enqueues an asynchronous load request for a log file.
+         *
+         * The view's current filter settings go along, so the parser threads can evaluate them.
+         *
          * @param view_id The QUuid of the view to load into.
          * @param file_path The path to the log file.
          */
@@ -547,6 +740,14 @@ class LogViewerController: public QObject
          */
         auto try_start_next_async(qsizetype batch_size) -> void;
 
+        /**
+         * @brief Loads files of a view again whose entries were dropped as duplicates of a
+         *        removed file.
+         * @param view_id The view.
+         * @param file_paths The files that dropped entries (see LogDedupeSet::remove_file()).
+         */
+        auto reload_dropping_files(const QUuid& view_id, const QStringList& file_paths) -> void;
+
         /**
          * @brief Clears all pending items for the specified view.
          * @param view_id The QUuid of the view.
@@ -565,10 +766,49 @@ class LogViewerController: public QObject
          */
         [[nodiscard]] auto get_view_context(const QUuid& view_id) const -> LogViewContext*;
 
+        /**
+         * @brief Adds view files to a session's explorer tree.
+         *
+         * Files with a known app name are added directly; only files without one are read to
+         * identify their app.
+         *
+         * @param session_id The session identifier.
+         * @param files The view's files.
+         */
+        auto add_view_files_to_session(const QString& session_id, const QList<LogFileInfo>& files)
+            -> void;
+
+        /**
+         * @brief Returns the index of a deferred view.
+         * @param view_id The view identifier.
+         * @return Index into m_deferred_views, or -1 if the view is not deferred.
+         */
+        [[nodiscard]] auto find_deferred_view(const QUuid& view_id) const -> qsizetype;
+
+        /**
+         * @brief Switches the current view to the first started load not loading in the
+         *        background.
+         * @param started_view_ids The view ids of the loads just started, in start order.
+         */
+        auto follow_started_loads(const QVector<QUuid>& started_view_ids) -> void;
+
     private:
+        /**
+         * @struct DeferredView
+         * @brief A restored view that has not been materialized yet.
+         */
+        struct DeferredView {
+                QString session_id;
+                SessionViewState state;
+        };
+
         bool m_is_shutting_down{false};
+        TaskRegistry* m_tasks{nullptr};
         LogIngestController* m_ingest{nullptr};
         FileCatalogController* m_catalog{nullptr};
         ViewRegistry* m_views{nullptr};
         FilterCoordinator* m_filters{nullptr};
+        LogBaselineBuilder* m_baseline_builder{nullptr};
+        QVector<DeferredView> m_deferred_views;
+        QSet<QUuid> m_background_view_ids;
 };
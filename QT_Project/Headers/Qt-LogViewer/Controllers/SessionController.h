@@ -1,5 +1,6 @@
 #pragma once
 
+#include <QJsonArray>
 #include <QJsonObject>
 #include <QObject>
 #include <QString>
@@ -207,6 +208,14 @@ class SessionController: public QObject
         [[nodiscard]] auto collect_session_files_from_tree(const QString& session_id) const
             -> QList<LogFileInfo>;
 
+        /**
+         * @brief Builds the JSON array of a session's watch folders.
+         * @param session_id The session identifier.
+         * @return Array of folder paths.
+         */
+        [[nodiscard]] auto build_watch_folders_json(const QString& session_id) const
+            -> QJsonArray;
+
         /**
          * @brief Internal implementation of session saving.
          * @param session_id The session identifier.
@@ -6,12 +6,15 @@
 #include <QString>
 #include <QUuid>
 #include <QVector>
+#include <memory>
 
 class FilterCoordinator;
+class LogBaseline;
 class LogViewContext;
 
 // Value types used by value in API
 #include "Qt-LogViewer/Models/LogEntry.h"
+#include "Qt-LogViewer/Models/LogEntryStore.h"
 #include "Qt-LogViewer/Models/LogFileInfo.h"
 #include "Qt-LogViewer/Models/SessionTypes.h"
 
@@ -108,6 +111,13 @@ class ViewRegistry: public QObject
          */
         [[nodiscard]] auto get_entries(const QUuid& view_id) const -> QVector<LogEntry>;
 
+        /**
+         * @brief Return an immutable snapshot of the entries of the given view (no copy).
+         * @param view_id View id to query.
+         * @return LogEntryStore::Snapshot Snapshot (empty if none / view missing).
+         */
+        [[nodiscard]] auto get_snapshot(const QUuid& view_id) const -> LogEntryStore::Snapshot;
+
         /**
          * @brief Return loaded absolute file paths for the given view.
          * @param view_id View id to query.
@@ -134,8 +144,37 @@ class ViewRegistry: public QObject
          *        Also removes the file from the view's loaded-file list and notifies listeners.
          * @param view_id Target view id.
          * @param file_path Absolute file path to remove.
+         * @return The files of the view that dropped entries as duplicates of the removed file.
+         */
+        auto remove_entries_by_file(const QUuid& view_id, const QString& file_path)
+            -> QStringList;
+
+        /**
+         * @brief Enable or disable dropping duplicate entries across the files of each view.
+         *        Applies to existing views and to views created later.
+         * @param enabled True to drop duplicates across files.
+         */
+        auto set_dedupe_enabled(bool enabled) -> void;
+
+        /**
+         * @brief Return whether views drop duplicate entries across their files.
+         * @return True if dedupe is enabled.
+         */
+        [[nodiscard]] auto is_dedupe_enabled() const -> bool;
+
+        /**
+         * @brief Set the baseline the entries of every view are tagged against.
+         *        Applies to existing views (their entries are tagged again) and to views created
+         *        later.
+         * @param baseline The baseline, or nullptr to remove the tags.
+         */
+        auto set_baseline(const std::shared_ptr<const LogBaseline>& baseline) -> void;
+
+        /**
+         * @brief Return the baseline the entries of every view are tagged against.
+         * @return The baseline, or nullptr.
          */
-        auto remove_entries_by_file(const QUuid& view_id, const QString& file_path) -> void;
+        [[nodiscard]] auto get_baseline() const -> std::shared_ptr<const LogBaseline>;
 
         /**
          * @brief Export a view's state including loaded files, filters, paging and sort.
@@ -180,4 +219,6 @@ class ViewRegistry: public QObject
     private:
         QMap<QUuid, LogViewContext*> m_contexts;
         QUuid m_current_view_id;
+        bool m_dedupe_enabled = false;
+        std::shared_ptr<const LogBaseline> m_baseline;
 };
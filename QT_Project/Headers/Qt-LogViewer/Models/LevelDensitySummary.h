@@ -0,0 +1,237 @@
+#pragma once
+
+#include <QModelIndex>
+#include <QObject>
+#include <QPointer>
+#include <QUuid>
+#include <QVector>
+
+#include <array>
+
+#include "Qt-LogViewer/Services/TaskToken.h"
+#include "SimpleCppLogger/LogLevel.h"
+
+class LogModel;
+class LogSortFilterProxyModel;
+class QTimer;
+class TaskRegistry;
+
+/**
+ * @file LevelDensitySummary.h
+ * @brief This file contains the definition of the LevelDensitySummary class.
+ */
+
+/**
+ * @class LevelDensitySummary
+ * @brief Downsampled per-level row counts of a filtered and sorted log view.
+ *
+ * The rows of the view are grouped into consecutive buckets, each holding its row count and the
+ * count per log level. There are never more than
+ * get_max_bucket_count() buckets: when appends exceed that, neighbouring buckets are merged and
+ * the nominal bucket size doubles. A minimap can thus be painted from the buckets alone, in time
+ * independent of the number of rows.
+ *
+ * The summary follows the model incrementally:
+ * - Appended rows are added to the last bucket(s); inserted rows to the bucket they land in.
+ * - Removed rows are subtracted from their buckets (read before they disappear).
+ * - Sorting, resets, moves and changes of many rows (e.g. a new search) trigger a rebuild.
+ *   Rebuilds run in chunks on the event loop so a large view never blocks the UI. With a task
+ *   registry set, each rebuild is a task of the view: it reports its progress and stops at the
+ *   next chunk once cancelled.
+ *
+ * The view shows only rows matching its search, so while a search is set every row is a hit and
+ * a bucket's hit count is its row count (see get_hit_count()); no row is evaluated for it.
+ */
+class LevelDensitySummary: public QObject
+{
+        Q_OBJECT
+
+    public:
+        /**
+         * @brief Level lanes of a bucket, ordered by severity.
+         */
+        enum Level
+        {
+            Trace = 0,
+            Debug,
+            Info,
+            Warning,
+            Error,
+            Fatal,
+            LevelCount
+        };
+
+        /**
+         * @struct Bucket
+         * @brief Counts of a run of consecutive view rows.
+         */
+        struct Bucket {
+                int row_count = 0;
+                std::array<int, LevelCount> level_counts{};
+        };
+
+        /**
+         * @brief Constructs a LevelDensitySummary.
+         * @param parent Optional QObject parent.
+         */
+        explicit LevelDensitySummary(QObject* parent = nullptr);
+
+        /**
+         * @brief Cancels a running rebuild task.
+         *
+         * The registry is not called: it may already be gone. It ends the task once the token
+         * is dropped (see TaskRegistry).
+         */
+        ~LevelDensitySummary() override;
+
+        /**
+         * @brief Sets the registry rebuilds are reported to.
+         * @param registry The task registry (not owned), or nullptr.
+         * @param owner The owner of the rebuild tasks (the view id).
+         */
+        auto set_task_registry(TaskRegistry* registry, const QUuid& owner) -> void;
+
+        /**
+         * @brief Sets the view to summarize and starts a rebuild.
+         * @param model The filtered and sorted view (its source must be a LogModel), or nullptr.
+         */
+        auto set_model(LogSortFilterProxyModel* model) -> void;
+
+        /**
+         * @brief Returns the summarized view.
+         * @return The model, or nullptr.
+         */
+        [[nodiscard]] auto get_model() const -> LogSortFilterProxyModel*;
+
+        /**
+         * @brief Returns the buckets in row order.
+         * @return The buckets; their row counts add up to get_row_count().
+         */
+        [[nodiscard]] auto get_buckets() const -> const QVector<Bucket>&;
+
+        /**
+         * @brief Returns the number of search hits in a bucket.
+         * @param bucket A bucket of get_buckets().
+         * @return The bucket's row count while the view has a search, otherwise 0.
+         */
+        [[nodiscard]] auto get_hit_count(const Bucket& bucket) const -> int;
+
+        /**
+         * @brief Returns the number of summarized rows.
+         * @return The row count.
+         */
+        [[nodiscard]] auto get_row_count() const -> int;
+
+        /**
+         * @brief Returns the nominal number of rows per bucket.
+         * @return The bucket size (a power of two).
+         */
+        [[nodiscard]] auto get_rows_per_bucket() const -> int;
+
+        /**
+         * @brief Returns the upper bound of the bucket count.
+         * @return The maximum number of buckets.
+         */
+        [[nodiscard]] static auto get_max_bucket_count() -> int;
+
+        /**
+         * @brief Checks whether a chunked rebuild is in progress.
+         * @return True while the buckets do not cover the whole view yet.
+         */
+        [[nodiscard]] auto is_rebuilding() const -> bool;
+
+        /**
+         * @brief Maps a log level to its lane.
+         * @param level The log level of a row.
+         * @return The lane index.
+         */
+        [[nodiscard]] static auto to_level(SimpleCppLogger::LogLevel level) -> Level;
+
+    signals:
+        /**
+         * @brief Emitted after the buckets changed.
+         */
+        void summary_changed();
+
+    private:
+        /**
+         * @brief Discards the buckets and schedules a chunked rebuild from the first row.
+         */
+        auto schedule_rebuild() -> void;
+
+        /**
+         * @brief Summarizes the next chunk of rows of a rebuild.
+         */
+        auto rebuild_next_chunk() -> void;
+
+        /**
+         * @brief Adds rows to the summary.
+         * @param parent The parent index (must be invalid).
+         * @param first The first inserted row.
+         * @param last The last inserted row.
+         */
+        auto handle_rows_inserted(const QModelIndex& parent, int first, int last) -> void;
+
+        /**
+         * @brief Subtracts rows that are about to be removed from the summary.
+         * @param parent The parent index (must be invalid).
+         * @param first The first removed row.
+         * @param last The last removed row.
+         */
+        auto handle_rows_about_to_be_removed(const QModelIndex& parent, int first, int last)
+            -> void;
+
+        /**
+         * @brief Repaints the hit lane when the view's search is set or cleared.
+         */
+        auto handle_search_changed() -> void;
+
+        /**
+         * @brief Adds a view row's level to a bucket, or subtracts it.
+         * @param bucket The bucket holding the row.
+         * @param log_model The source model of the view.
+         * @param row The row in the view.
+         * @param delta 1 to add the row, -1 to subtract it.
+         */
+        auto count_row(Bucket& bucket, const LogModel* log_model, int row, int delta) const
+            -> void;
+
+        /**
+         * @brief Appends view rows to the end of the summary.
+         * @param first The first row.
+         * @param last The last row.
+         */
+        auto append_rows(int first, int last) -> void;
+
+        /**
+         * @brief Finds the bucket containing a row.
+         * @param row The view row.
+         * @param bucket_first Output for the first row of the found bucket.
+         * @return The bucket index, or the last bucket if the row is past the end.
+         */
+        [[nodiscard]] auto find_bucket(int row, int& bucket_first) const -> int;
+
+        /**
+         * @brief Halves the bucket count by merging neighbours and doubles the bucket size.
+         */
+        auto merge_buckets() -> void;
+
+        /**
+         * @brief Removes the rebuild task from the registry.
+         */
+        auto end_rebuild_task() -> void;
+
+    private:
+        QPointer<LogSortFilterProxyModel> m_model;
+        QVector<Bucket> m_buckets;
+        int m_row_count = 0;
+        int m_rows_per_bucket = 1;
+        // While rebuilding, the buckets cover the rows [0, m_row_count) of the view.
+        bool m_rebuilding = false;
+        // Whether the view had a search when the hit lane was last reported.
+        bool m_search_active = false;
+        QTimer* m_rebuild_timer{nullptr};
+        QPointer<TaskRegistry> m_registry;
+        QUuid m_owner;
+        TaskToken m_rebuild_token;
+};
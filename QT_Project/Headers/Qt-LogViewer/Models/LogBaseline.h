@@ -0,0 +1,147 @@
+#pragma once
+
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QString>
+#include <QVector>
+
+#include "Qt-LogViewer/Models/LogEntry.h"
+
+/**
+ * @file LogBaseline.h
+ * @brief This file contains the definition of the LogBaseline class.
+ */
+
+/**
+ * @class LogBaseline
+ * @brief A compact set of the message fingerprints of reference ("healthy") log files.
+ *
+ * Messages are normalized before hashing: words containing digits (numbers, ids, hex values,
+ * addresses) and long hex words are masked, so "request 4711 took 12 ms" and "request 815 took
+ * 3 ms" share a fingerprint. Entries whose fingerprint is absent from the baseline are novel.
+ *
+ * The fingerprints are stored in a blocked Bloom filter: each fingerprint selects one 64-bit
+ * word and sets a few bits in it, so a lookup costs a single memory access. A novel entry may be
+ * missed with a probability of about one percent (a false positive of the filter); an entry of
+ * the baseline is never reported as novel.
+ *
+ * A filled baseline is only read, and may be shared between threads.
+ */
+class LogBaseline
+{
+    public:
+        /**
+         * @brief Constructs an empty baseline sized for a number of fingerprints.
+         * @param expected_fingerprints The number of fingerprints expected (sizes the filter).
+         */
+        explicit LogBaseline(qsizetype expected_fingerprints = 0);
+
+        /**
+         * @brief Masks the variable parts of a message.
+         *
+         * Words (runs of letters, digits and underscores) containing a digit, and hex words of at
+         * least eight letters, become "#"; masked words joined by '.', ':' or '-' (addresses,
+         * times, UUIDs) collapse into one "#".
+         *
+         * @param message The UTF-8 message.
+         * @return The normalized message.
+         */
+        [[nodiscard]] static auto normalize_message(QByteArrayView message) -> QByteArray;
+
+        /**
+         * @brief Returns the fingerprint of an entry's normalized message.
+         * @param entry The entry.
+         * @return A 64-bit hash of the normalized message.
+         */
+        [[nodiscard]] static auto get_fingerprint(const LogEntry& entry) -> quint64;
+
+        /**
+         * @brief Estimates the number of fingerprints of a file from its size.
+         * @param file_bytes The file size in bytes.
+         * @return The estimated fingerprint count.
+         */
+        [[nodiscard]] static auto estimate_fingerprints(qint64 file_bytes) -> qsizetype;
+
+        /**
+         * @brief Adds a fingerprint.
+         * @param fingerprint The fingerprint (see get_fingerprint()).
+         */
+        auto add(quint64 fingerprint) -> void;
+
+        /**
+         * @brief Adds the fingerprints of entries.
+         * @param entries The entries.
+         */
+        auto add_entries(const QVector<LogEntry>& entries) -> void;
+
+        /**
+         * @brief Checks whether a fingerprint may be in the baseline.
+         * @param fingerprint The fingerprint.
+         * @return False if it was never added; true if it was (or, rarely, if it collides).
+         */
+        [[nodiscard]] auto contains(quint64 fingerprint) const -> bool;
+
+        /**
+         * @brief Checks whether an entry's message is absent from the baseline.
+         * @param entry The entry.
+         * @return True if the entry is novel.
+         */
+        [[nodiscard]] auto is_novel(const LogEntry& entry) const -> bool;
+
+        /**
+         * @brief Tags each entry as novel or not (see LogEntry::is_novel()).
+         * @param entries The entries; one probe per entry.
+         */
+        auto tag_entries(QVector<LogEntry>& entries) const -> void;
+
+        /**
+         * @brief Removes the novelty tag of each entry.
+         * @param entries The entries.
+         */
+        static auto clear_tags(QVector<LogEntry>& entries) -> void;
+
+        /**
+         * @brief Sets the reference files the baseline was built from.
+         * @param file_paths The file paths.
+         */
+        auto set_file_paths(const QVector<QString>& file_paths) -> void;
+
+        /**
+         * @brief Returns the reference files the baseline was built from.
+         * @return The file paths.
+         */
+        [[nodiscard]] auto get_file_paths() const -> QVector<QString>;
+
+        /**
+         * @brief Returns the number of fingerprints added (repeats included).
+         * @return The count.
+         */
+        [[nodiscard]] auto get_added_count() const -> qsizetype;
+
+        /**
+         * @brief Returns the memory used by the filter.
+         * @return The size in bytes.
+         */
+        [[nodiscard]] auto get_size_bytes() const -> qsizetype;
+
+        /**
+         * @brief Checks whether no fingerprint was added.
+         * @return True if the baseline is empty.
+         */
+        [[nodiscard]] auto is_empty() const -> bool;
+
+    private:
+        /**
+         * @brief Returns the bits a fingerprint sets in its word.
+         * @param fingerprint The fingerprint.
+         * @return The bit mask.
+         */
+        [[nodiscard]] static auto get_probe_bits(quint64 fingerprint) -> quint64;
+
+    private:
+        // Power-of-two number of words; the low bits of a fingerprint select the word.
+        QVector<quint64> m_words;
+        quint64 m_word_mask = 0;
+        qsizetype m_added_count = 0;
+        QVector<QString> m_file_paths;
+};
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <QCache>
+#include <QString>
+
+/**
+ * @file LogDecodeCache.h
+ * @brief This file contains the definition of the LogDecodeCache class.
+ */
+
+/**
+ * @class LogDecodeCache
+ * @brief Bounded cache of decoded message texts, keyed by row id (see LogModel::get_row_id()).
+ *
+ * Entries keep their messages as UTF-8 and are decoded whenever a view asks for the text. The
+ * cache keeps the texts of the rows shown and prefetched last, so repaints and page switches do
+ * not decode them again. Its size is bounded by a byte budget; the least recently used texts are
+ * dropped first.
+ *
+ * The cache is not thread-safe; it belongs to the model's (GUI) thread.
+ */
+class LogDecodeCache
+{
+    public:
+        /**
+         * @brief Constructs an empty cache.
+         * @param budget_bytes The maximum size of the cached texts in bytes.
+         */
+        explicit LogDecodeCache(qsizetype budget_bytes = get_default_budget_bytes());
+
+        /**
+         * @brief Sets the byte budget, dropping texts if the cache exceeds it.
+         * @param budget_bytes The maximum size of the cached texts in bytes.
+         */
+        auto set_budget_bytes(qsizetype budget_bytes) -> void;
+
+        /**
+         * @brief Returns the byte budget.
+         * @return The maximum size of the cached texts in bytes.
+         */
+        [[nodiscard]] auto get_budget_bytes() const -> qsizetype;
+
+        /**
+         * @brief Returns the size of the cached texts.
+         * @return The size in bytes.
+         */
+        [[nodiscard]] auto get_used_bytes() const -> qsizetype;
+
+        /**
+         * @brief Returns the number of cached texts.
+         * @return The count.
+         */
+        [[nodiscard]] auto get_count() const -> qsizetype;
+
+        /**
+         * @brief Checks whether a row's text is cached, without touching its recency.
+         * @param row_id The row id.
+         * @return True if cached.
+         */
+        [[nodiscard]] auto contains(quint64 row_id) const -> bool;
+
+        /**
+         * @brief Looks up a row's text and marks it as recently used.
+         * @param row_id The row id.
+         * @return The cached text, or nullptr if not cached. Valid until the next insert.
+         */
+        [[nodiscard]] auto find(quint64 row_id) const -> const QString*;
+
+        /**
+         * @brief Caches a row's text. Texts larger than the whole budget are not cached.
+         * @param row_id The row id (0 is ignored).
+         * @param message The decoded text.
+         */
+        auto insert(quint64 row_id, const QString& message) -> void;
+
+        /**
+         * @brief Drops all texts.
+         */
+        auto clear() -> void;
+
+        /**
+         * @brief Returns the default byte budget.
+         * @return The budget in bytes.
+         */
+        [[nodiscard]] static auto get_default_budget_bytes() -> qsizetype;
+
+    private:
+        /**
+         * @brief Returns the cost a text is accounted with.
+         * @param message The text.
+         * @return Its size in bytes, including a fixed per-entry overhead.
+         */
+        [[nodiscard]] static auto get_cost(const QString& message) -> qsizetype;
+
+    private:
+        // QCache::object() relinks the entry as most recently used, hence mutable.
+        mutable QCache<quint64, QString> m_cache;
+};
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <QBitArray>
+#include <QHash>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include "Qt-LogViewer/Models/LogEntry.h"
+#include "Qt-LogViewer/Models/LogEntryStore.h"
+
+/**
+ * @file LogDedupeSet.h
+ * @brief This file contains the definition of the LogDedupeSet class.
+ */
+
+/**
+ * @class LogDedupeSet
+ * @brief Detects entries that repeat entries of another file of the same view.
+ *
+ * Support bundles often contain overlapping copies of a log (app.log and app.log.bak, or the
+ * same file collected from two nodes). Each entry is keyed by a 64-bit hash of its timestamp,
+ * level, application and message (get_key(), cheap enough for the parser threads). The set
+ * remembers which file first produced each key; an entry whose key belongs to another file is a
+ * duplicate. Repeated lines within one file are kept, as they are genuine log output.
+ *
+ * Checking an entry costs a single hash probe. Keys are compared by hash only; two different
+ * lines colliding in 64 bits are not told apart.
+ *
+ * The set also remembers which files dropped entries as duplicates of which, so removing a file
+ * names the files whose dropped entries have to be read again (see remove_file()).
+ */
+class LogDedupeSet
+{
+    public:
+        /**
+         * @brief Returns the dedupe key of an entry.
+         * @param entry The entry.
+         * @return A 64-bit hash of timestamp, level, application and message.
+         */
+        [[nodiscard]] static auto get_key(const LogEntry& entry) -> quint64;
+
+        /**
+         * @brief Returns the dedupe keys of a batch of entries.
+         * @param entries The entries.
+         * @return One key per entry.
+         */
+        [[nodiscard]] static auto get_keys(const QVector<LogEntry>& entries) -> QVector<quint64>;
+
+        /**
+         * @brief Estimates the number of entries of a file from its size, to size the set.
+         * @param file_bytes The file size in bytes.
+         * @return The estimated entry count.
+         */
+        [[nodiscard]] static auto estimate_entries(qint64 file_bytes) -> qsizetype;
+
+        /**
+         * @brief Makes room for further keys without rehashing.
+         * @param additional_keys The number of keys expected in addition to the current ones.
+         */
+        auto reserve(qsizetype additional_keys) -> void;
+
+        /**
+         * @brief Records the keys of a batch and marks the entries another file already has.
+         * @param entries The entries.
+         * @param keys One key per entry (see get_keys()).
+         * @return One bit per entry, set for duplicates.
+         */
+        auto mark_duplicates(const QVector<LogEntry>& entries, const QVector<quint64>& keys)
+            -> QBitArray;
+
+        /**
+         * @brief Records the keys of entries that stay shown, without marking duplicates.
+         * @param entries The entries.
+         * @param keys One key per entry (see get_keys()).
+         */
+        auto record_keys(const QVector<LogEntry>& entries, const QVector<quint64>& keys) -> void;
+
+        /**
+         * @brief Records the keys of a range of snapshot rows, without marking duplicates.
+         * @param snapshot The rows.
+         * @param first The first row to record.
+         * @param last The row after the last one to record.
+         */
+        auto record_keys(const LogEntryStore::Snapshot& snapshot, int first, int last) -> void;
+
+        /**
+         * @brief Adds the keys and counts of a set filled after this one.
+         * @param later The other set; this set's owners win for keys both have.
+         */
+        auto merge(const LogDedupeSet& later) -> void;
+
+        /**
+         * @brief Forgets the keys a file produced, so other files may claim them again.
+         * @param file_path The file path.
+         * @return The files that dropped entries as duplicates of the removed file.
+         */
+        auto remove_file(const QString& file_path) -> QStringList;
+
+        /**
+         * @brief Forgets all keys and counts.
+         */
+        auto clear() -> void;
+
+        /**
+         * @brief Returns the number of keys recorded.
+         * @return The key count.
+         */
+        [[nodiscard]] auto get_size() const -> qsizetype;
+
+        /**
+         * @brief Returns the number of duplicates found per file.
+         * @return Map of file path to duplicate count (files without duplicates are absent).
+         */
+        [[nodiscard]] auto get_duplicate_counts() const -> QHash<QString, int>;
+
+    private:
+        /**
+         * @brief Returns the id of a file, assigning the next one on first use.
+         * @param file_path The file path.
+         * @return The file id (from 1).
+         */
+        auto get_file_id(const QString& file_path) -> quint32;
+
+    private:
+        // Key -> id of the file that produced it first.
+        QHash<quint64, quint32> m_owners;
+        // File path -> file id (from 1). Ids are not reused when a file is removed.
+        QHash<QString, quint32> m_file_ids;
+        QHash<QString, int> m_duplicate_counts;
+        // Owner file id -> ids of the files that dropped entries as its duplicates.
+        QHash<quint32, QSet<quint32>> m_dropping_files;
+};
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <QByteArray>
 #include <QDateTime>
+#include <QPair>
 #include <QString>
+#include <QVariant>
+#include <QVector>
 
 #include "Qt-LogViewer/Models/LogFileInfo.h"
 
@@ -15,7 +19,15 @@
  * @brief Represents a single log entry with timestamp, level, message and app name.
  *
  * This class encapsulates the data for a single log line, including timestamp,
- * log level, message and the application name.
+ * log level, message and the application name. Additional format placeholders
+ * (e.g. thread, logger, pid, line) are kept as typed extra fields in format order.
+ *
+ * The message is stored UTF-8 encoded, since it is by far the largest field and log files
+ * are mostly ASCII. It is converted to QString only when requested via get_message().
+ *
+ * Entries parsed from a line longer than the reader's limit only hold a prefix of it; they keep
+ * the offset and length of the full line in their file (see set_source_range()), so the full
+ * content can be read from disk on demand.
  */
 class LogEntry
 {
@@ -49,10 +61,16 @@ class LogEntry
 
         /**
          * @brief Returns the log message.
-         * @return The log message.
+         * @return The log message, decoded from the stored UTF-8 bytes.
          */
         [[nodiscard]] auto get_message() const -> QString;
 
+        /**
+         * @brief Returns the log message as stored, without decoding.
+         * @return The UTF-8 encoded log message.
+         */
+        [[nodiscard]] auto get_message_utf8() const -> QByteArray;
+
         /**
          * @brief Returns the application name.
          * @return The application name.
@@ -83,6 +101,12 @@ class LogEntry
          */
         auto set_message(const QString& message) -> void;
 
+        /**
+         * @brief Sets the log message from UTF-8 encoded bytes.
+         * @param message The new UTF-8 encoded log message.
+         */
+        auto set_message_utf8(const QByteArray& message) -> void;
+
         /**
          * @brief Sets the application name.
          * @param app_name The new application name.
@@ -95,9 +119,90 @@ class LogEntry
          */
         auto set_file_info(const LogFileInfo& file_info) -> void;
 
+        /**
+         * @brief Returns all extra fields in the order they appear in the log format.
+         * @return List of (field name, typed value) pairs.
+         */
+        [[nodiscard]] auto get_extra_fields() const -> QVector<QPair<QString, QVariant>>;
+
+        /**
+         * @brief Returns the value of a single extra field.
+         * @param name The placeholder name (e.g. "thread").
+         * @return The typed value, or an invalid QVariant if the field is not present.
+         */
+        [[nodiscard]] auto get_extra_field(const QString& name) const -> QVariant;
+
+        /**
+         * @brief Sets (or replaces) the value of an extra field.
+         * @param name The placeholder name (e.g. "thread").
+         * @param value The typed value (qlonglong for integers, QString otherwise).
+         */
+        auto set_extra_field(const QString& name, const QVariant& value) -> void;
+
+        /**
+         * @brief Marks the entry as truncated and records where its full line is on disk.
+         * @param offset Byte offset of the line in the entry's file.
+         * @param length Length of the line in bytes, without the line ending.
+         */
+        auto set_source_range(qint64 offset, qint64 length) -> void;
+
+        /**
+         * @brief Checks whether the entry holds only a prefix of its line.
+         * @return True if a source range was set.
+         */
+        [[nodiscard]] auto is_truncated() const -> bool;
+
+        /**
+         * @brief Returns the byte offset of the full line in the entry's file.
+         * @return The offset, or -1 if the entry is not truncated.
+         */
+        [[nodiscard]] auto get_source_offset() const -> qint64;
+
+        /**
+         * @brief Returns the length of the full line in the entry's file.
+         * @return The length in bytes, or 0 if the entry is not truncated.
+         */
+        [[nodiscard]] auto get_source_length() const -> qint64;
+
+        /**
+         * @brief Records the byte offset of the entry's first line in its file.
+         * @param offset The offset, or -1 if unknown.
+         */
+        auto set_line_offset(qint64 offset) -> void;
+
+        /**
+         * @brief Returns the byte offset of the entry's first line in its file.
+         *
+         * Together with the file it identifies the entry stably (see LogModel::get_row_id()).
+         *
+         * @return The offset, or -1 if unknown (entries not read from a file, non-UTF-8 input).
+         */
+        [[nodiscard]] auto get_line_offset() const -> qint64;
+
+        /**
+         * @brief Tags the entry as absent from (or present in) the active baseline.
+         * @param novel True if the entry's message is not in the baseline.
+         */
+        auto set_novel(bool novel) -> void;
+
+        /**
+         * @brief Checks whether the entry was tagged as absent from the active baseline.
+         *
+         * The tag is set while loading (see LogBaseline::tag_entries()); without a baseline no
+         * entry is novel.
+         *
+         * @return True if the entry is novel.
+         */
+        [[nodiscard]] auto is_novel() const -> bool;
+
     private:
         QDateTime m_timestamp;
         QString m_level;
-        QString m_message;
+        QByteArray m_message_utf8;
         LogFileInfo m_file_info;
+        QVector<QPair<QString, QVariant>> m_extra_fields;
+        qint64 m_source_offset = -1;
+        qint64 m_source_length = 0;
+        qint64 m_line_offset = -1;
+        bool m_novel = false;
 };
@@ -0,0 +1,257 @@
+#pragma once
+
+#include <QBitArray>
+#include <QMutex>
+#include <QVector>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "Qt-LogViewer/Models/LogEntry.h"
+
+/**
+ * @file LogEntryStore.h
+ * @brief This file contains the definition of the LogEntryStore class.
+ */
+
+/**
+ * @class LogEntryStore
+ * @brief Append-only, segmented storage of log entries with immutable snapshots.
+ *
+ * Entries live in fixed-size segments that never move or grow once allocated. Appending writes
+ * into free slots of the last segment (allocating new segments as needed) and then publishes the
+ * new row count. A Snapshot captures the published segment list and row count; it only ever
+ * reads rows below its count, which are never written again. Worker threads can therefore read a
+ * snapshot without locks while the owner keeps appending; taking a snapshot only holds a mutex
+ * for the time of copying two values.
+ *
+ * Non-append changes (assign, clear, remove_if) never touch published segments: they build a new
+ * segment list and bump the epoch, so existing snapshots keep seeing the old state until they are
+ * dropped (read-copy-update). Segments are shared between the store and snapshots and freed with
+ * the last owner.
+ *
+ * All mutating calls, size() and at() must come from the owning thread; snapshot() and all
+ * Snapshot methods may be called from any thread.
+ */
+class LogEntryStore
+{
+    private:
+        /**
+         * @struct Segment
+         * @brief A fixed-capacity block of entries.
+         *
+         * The capacity is reserved up front and entries are only appended, so they never move;
+         * only the slots in use hold constructed entries.
+         */
+        struct Segment {
+                std::vector<LogEntry> entries;
+        };
+
+        using SegmentList = QVector<std::shared_ptr<Segment>>;
+
+    public:
+        /**
+         * @class Snapshot
+         * @brief Immutable view of the first rows of a store at one point in time.
+         */
+        class Snapshot
+        {
+            public:
+                /**
+                 * @class const_iterator
+                 * @brief Forward iterator over the rows of a snapshot.
+                 */
+                class const_iterator
+                {
+                    public:
+                        using iterator_category = std::forward_iterator_tag;
+                        using value_type = LogEntry;
+                        using difference_type = std::ptrdiff_t;
+                        using pointer = const LogEntry*;
+                        using reference = const LogEntry&;
+
+                        const_iterator() = default;
+                        const_iterator(const Snapshot* snapshot, int row)
+                            : m_snapshot(snapshot), m_row(row)
+                        {
+                        }
+
+                        auto operator*() const -> reference { return m_snapshot->at(m_row); }
+                        auto operator->() const -> pointer { return &m_snapshot->at(m_row); }
+                        auto operator++() -> const_iterator&
+                        {
+                            ++m_row;
+                            return *this;
+                        }
+                        auto operator++(int) -> const_iterator
+                        {
+                            const_iterator previous = *this;
+                            ++m_row;
+                            return previous;
+                        }
+                        auto operator==(const const_iterator& other) const -> bool
+                        {
+                            return m_row == other.m_row;
+                        }
+
+                    private:
+                        const Snapshot* m_snapshot{nullptr};
+                        int m_row = 0;
+                };
+
+                /**
+                 * @brief Constructs an empty snapshot.
+                 */
+                Snapshot() = default;
+
+                /**
+                 * @brief Returns the number of rows in the snapshot.
+                 * @return The row count.
+                 */
+                [[nodiscard]] auto size() const -> int;
+
+                /**
+                 * @brief Checks whether the snapshot has no rows.
+                 * @return True if empty.
+                 */
+                [[nodiscard]] auto is_empty() const -> bool;
+
+                /**
+                 * @brief Returns the entry of a row.
+                 * @param row The row index (0 <= row < size()).
+                 * @return The entry.
+                 */
+                [[nodiscard]] auto at(int row) const -> const LogEntry&;
+
+                /**
+                 * @brief Returns the epoch of the store when the snapshot was taken.
+                 *
+                 * Snapshots with the same epoch agree on all rows they have in common, apart
+                 * from the rows' novelty tags (see LogEntryStore::set_novel_tags()).
+                 *
+                 * @return The epoch.
+                 */
+                [[nodiscard]] auto get_epoch() const -> quint64;
+
+                /**
+                 * @brief Copies the rows into a vector.
+                 * @return The entries in row order.
+                 */
+                [[nodiscard]] auto to_vector() const -> QVector<LogEntry>;
+
+                /**
+                 * @brief Returns an iterator to the first row.
+                 * @return The iterator.
+                 */
+                [[nodiscard]] auto begin() const -> const_iterator;
+
+                /**
+                 * @brief Returns an iterator past the last row.
+                 * @return The iterator.
+                 */
+                [[nodiscard]] auto end() const -> const_iterator;
+
+            private:
+                friend class LogEntryStore;
+
+                std::shared_ptr<const SegmentList> m_segments;
+                int m_size = 0;
+                quint64 m_epoch = 0;
+        };
+
+        /**
+         * @brief Constructs an empty store.
+         */
+        LogEntryStore();
+
+        /**
+         * @brief Appends entries and publishes them to new snapshots.
+         * @param entries The entries to append.
+         */
+        auto append(const QVector<LogEntry>& entries) -> void;
+
+        /**
+         * @brief Replaces all entries (new epoch).
+         * @param entries The new entries.
+         */
+        auto assign(const QVector<LogEntry>& entries) -> void;
+
+        /**
+         * @brief Removes all entries (new epoch).
+         */
+        auto clear() -> void;
+
+        /**
+         * @brief Removes the entries matching a predicate (new epoch if any was removed).
+         * @param predicate Returns true for entries to remove.
+         * @return The number of removed entries.
+         */
+        auto remove_if(const std::function<bool(const LogEntry&)>& predicate) -> int;
+
+        /**
+         * @brief Sets the novelty tags of the first rows (see LogEntry::is_novel()).
+         *
+         * Segments whose tags change are replaced by tagged copies (read-copy-update), so
+         * existing snapshots keep their tags. The epoch stays: the rows are the same entries.
+         *
+         * @param tags One bit per row, starting at row 0; bits past size() are ignored.
+         * @return The number of rows whose tag changed.
+         */
+        auto set_novel_tags(const QBitArray& tags) -> int;
+
+        /**
+         * @brief Returns the number of entries (owning thread).
+         * @return The row count.
+         */
+        [[nodiscard]] auto size() const -> int;
+
+        /**
+         * @brief Checks whether the store is empty (owning thread).
+         * @return True if there are no entries.
+         */
+        [[nodiscard]] auto is_empty() const -> bool;
+
+        /**
+         * @brief Returns the entry of a row (owning thread).
+         * @param row The row index (0 <= row < size()).
+         * @return The entry.
+         */
+        [[nodiscard]] auto at(int row) const -> const LogEntry&;
+
+        /**
+         * @brief Returns an immutable view of the current rows (any thread).
+         * @return The snapshot.
+         */
+        [[nodiscard]] auto snapshot() const -> Snapshot;
+
+        /**
+         * @brief Returns the number of rows per segment.
+         * @return The segment capacity.
+         */
+        [[nodiscard]] static auto get_segment_size() -> int;
+
+    private:
+        /**
+         * @brief Builds fresh segments holding the given entries.
+         * @param entries The entries.
+         * @return The segment list.
+         */
+        [[nodiscard]] static auto build_segments(const QVector<LogEntry>& entries)
+            -> std::shared_ptr<const SegmentList>;
+
+        /**
+         * @brief Makes the current segments and row count visible to snapshot().
+         */
+        auto publish() -> void;
+
+    private:
+        // Owning thread's state; only this thread reads it without the mutex.
+        std::shared_ptr<const SegmentList> m_segments;
+        int m_size = 0;
+        quint64 m_epoch = 0;
+
+        // Published state, read by snapshot() from any thread.
+        mutable QMutex m_publish_mutex;
+        Snapshot m_published;
+};
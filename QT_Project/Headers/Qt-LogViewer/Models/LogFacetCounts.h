@@ -0,0 +1,87 @@
+#pragma once
+
+#include <QHash>
+#include <QMap>
+#include <QString>
+
+#include "Qt-LogViewer/Models/LogEntry.h"
+
+/**
+ * @file LogFacetCounts.h
+ * @brief This file contains the definition of the LogFacetCounts class.
+ */
+
+/**
+ * @class LogFacetCounts
+ * @brief Entry counts per level, application and file.
+ *
+ * Levels are keyed by the level text as found in the entries (like the level column), apps by
+ * application name and files by absolute file path.
+ */
+class LogFacetCounts
+{
+    public:
+        /**
+         * @brief Adds (or removes) one entry.
+         * @param entry The entry.
+         * @param delta 1 to add the entry, -1 to remove it.
+         */
+        auto add_entry(const LogEntry& entry, int delta = 1) -> void;
+
+        /**
+         * @brief Adds all counts of another instance.
+         * @param other The counts to add.
+         */
+        auto merge(const LogFacetCounts& other) -> void;
+
+        /**
+         * @brief Resets all counts to zero.
+         */
+        auto clear() -> void;
+
+        /**
+         * @brief Returns the number of entries counted.
+         * @return The entry count.
+         */
+        [[nodiscard]] auto get_total() const -> int;
+
+        /**
+         * @brief Returns the counts per level.
+         * @return Map of level text to count.
+         */
+        [[nodiscard]] auto get_level_counts() const -> QMap<QString, int>;
+
+        /**
+         * @brief Returns the counts per application.
+         * @return Map of application name to count.
+         */
+        [[nodiscard]] auto get_app_counts() const -> QMap<QString, int>;
+
+        /**
+         * @brief Returns the counts per file.
+         * @return Map of absolute file path to count.
+         */
+        [[nodiscard]] auto get_file_counts() const -> QMap<QString, int>;
+
+    private:
+        /**
+         * @brief Adds a delta to a key, dropping keys that reach zero.
+         * @param counts The counts.
+         * @param key The key.
+         * @param delta The delta.
+         */
+        static auto add_to(QHash<QString, int>& counts, const QString& key, int delta) -> void;
+
+        /**
+         * @brief Converts counts to a sorted map.
+         * @param counts The counts.
+         * @return The map.
+         */
+        [[nodiscard]] static auto to_map(const QHash<QString, int>& counts) -> QMap<QString, int>;
+
+    private:
+        int m_total = 0;
+        QHash<QString, int> m_levels;
+        QHash<QString, int> m_apps;
+        QHash<QString, int> m_files;
+};
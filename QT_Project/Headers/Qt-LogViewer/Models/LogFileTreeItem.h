@@ -7,19 +7,21 @@
  * @class LogFileTreeItem
  * @brief Represents a single item in the log file tree model.
  *
- * Each item can have multiple columns and child items.
+ * Each item can have multiple columns and child items. Every item caches its row in the parent,
+ * so row() is O(1); removing children renumbers only the siblings after them.
  */
 class LogFileTreeItem
 {
     public:
         /**
-         * @brief The type of the tree item (group or file).
+         * @brief The type of the tree item (session, group, folder or file).
          */
         enum class Type
         {
             Group,   ///< Represents an application group node.
             File,    ///< Represents a log file node.
-            Session  ///< Represents a session node.
+            Session,  ///< Represents a session node.
+            Folder    ///< Represents a (watched) folder node, populated lazily.
         };
 
         /**
@@ -47,6 +49,15 @@ class LogFileTreeItem
          */
         auto remove_child(int row) -> LogFileTreeItem*;
 
+        /**
+         * @brief Removes a contiguous range of children.
+         * @param row The first child row index.
+         * @param count The number of children to remove.
+         * @return The removed child items (ownership passes to the caller); empty if the range
+         *         is out of bounds.
+         */
+        auto take_children(int row, int count) -> QVector<LogFileTreeItem*>;
+
         /**
          * @brief Returns the child at the given row.
          * @param row The child row index.
@@ -93,10 +104,18 @@ class LogFileTreeItem
          */
         [[nodiscard]] auto row() const -> int;
 
+    private:
+        /**
+         * @brief Updates the cached rows of the children starting at the given row.
+         * @param first_row The first child row to renumber.
+         */
+        auto renumber_children(int first_row) -> void;
+
     private:
         QVector<LogFileTreeItem*> m_child_items;
         QVector<QVariant> m_item_data;
         LogFileTreeItem* m_parent_item;
+        int m_row = 0;
 };
 
 Q_DECLARE_METATYPE(LogFileTreeItem::Type)
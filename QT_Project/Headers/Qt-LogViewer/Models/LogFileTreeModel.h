@@ -1,11 +1,15 @@
 #pragma once
 
 #include <QAbstractItemModel>
+#include <QDateTime>
 #include <QHash>
 #include <QMap>
+#include <QStringList>
+#include <QVector>
 
 class LogFileTreeItem;
 class LogFileInfo;
+class QTimer;
 
 /**
  * @class LogFileTreeModel
@@ -18,6 +22,12 @@ class LogFileInfo;
  *       - Log File(s)
  *
  * Supports multiple sessions, each with its own set of application groups and files.
+ *
+ * A session can also hold watch folders. Folder nodes are populated lazily: the view asks for
+ * their children through canFetchMore()/fetchMore(), the model emits folder_fetch_requested()
+ * and the owner answers with apply_folder_listing(), which is also used to apply later changes
+ * of the folder as a diff. Size, modification time and app name of a folder file are requested
+ * through file_metadata_requested() once the file is first displayed.
  */
 class LogFileTreeModel: public QAbstractItemModel
 {
@@ -41,7 +51,8 @@ class LogFileTreeModel: public QAbstractItemModel
             ItemTypeRole = Qt::UserRole + 1,
             SessionIdRole,
             FilePathRole,
-            AppNameRole
+            AppNameRole,
+            FolderPathRole
         };
 
         /**
@@ -124,6 +135,9 @@ class LogFileTreeModel: public QAbstractItemModel
 
         /**
          * @brief Adds multiple log files to a session.
+         *
+         * Files are inserted with one contiguous row insertion per app group.
+         *
          * @param session_id The session identifier.
          * @param log_file_infos The list of LogFileInfo objects to add.
          * @return Number of files successfully added.
@@ -131,8 +145,21 @@ class LogFileTreeModel: public QAbstractItemModel
         auto add_log_files(const QString& session_id,
                            const QList<LogFileInfo>& log_file_infos) -> int;
 
+        /**
+         * @brief Adds files whose app name is not known yet to the provisional group of a
+         *        session.
+         * @param session_id The session identifier.
+         * @param file_paths The file paths.
+         * @return Number of files added (files already in the provisional group are skipped).
+         */
+        auto add_provisional_log_files(const QString& session_id,
+                                       const QVector<QString>& file_paths) -> int;
+
         /**
          * @brief Removes a single log file from a session.
+         *
+         * A file that is still in the provisional group is removed from there.
+         *
          * @param session_id The session identifier.
          * @param log_file_info The LogFileInfo to remove.
          * @return True if removed; false if not found.
@@ -161,12 +188,109 @@ class LogFileTreeModel: public QAbstractItemModel
          */
         auto add_log_file(const LogFileInfo& log_file_info) -> void;
 
+        /**
+         * @brief Adds multiple log files to all existing sessions (one insertion per group).
+         * @param log_file_infos The list of LogFileInfo objects to add.
+         */
+        auto add_log_files(const QList<LogFileInfo>& log_file_infos) -> void;
+
+        /**
+         * @brief Adds files whose app name is not known yet to all existing sessions.
+         * @param file_paths The file paths.
+         */
+        auto add_provisional_log_files(const QVector<QString>& file_paths) -> void;
+
+        /**
+         * @brief Moves provisional files into the groups of their identified apps (in all
+         *        sessions).
+         *
+         * Each session gets one removal per contiguous run of provisional rows and one
+         * insertion per target group.
+         *
+         * @param log_file_infos The files with their identified app names.
+         * @return Number of file items regrouped.
+         */
+        auto resolve_provisional_log_files(const QList<LogFileInfo>& log_file_infos) -> int;
+
+        /**
+         * @brief Returns the display name of the group holding files that are still being
+         *        identified.
+         *
+         * Only shown; the group is keyed by an empty name, which no app group uses.
+         *
+         * @return The translated group name.
+         */
+        [[nodiscard]] static auto get_provisional_group_name() -> QString;
+
         /**
          * @brief Removes a single log file from all sessions where it exists.
          * @param log_file_info The LogFileInfo to remove.
          */
         auto remove_log_file(const LogFileInfo& log_file_info) -> void;
 
+        // -------------------------------------------------------------------------
+        // Watch folders
+        // -------------------------------------------------------------------------
+
+        /**
+         * @brief Adds a watch folder to a session; its content is fetched when first expanded.
+         * @param session_id The session identifier (the session is created if needed).
+         * @param folder_path The folder path.
+         * @return True if added; false if the session already watches the folder.
+         */
+        auto add_watch_folder(const QString& session_id, const QString& folder_path) -> bool;
+
+        /**
+         * @brief Removes a watch folder (and everything listed below it) from a session.
+         * @param session_id The session identifier.
+         * @param folder_path The folder path.
+         * @return True if removed; false if not found.
+         */
+        auto remove_watch_folder(const QString& session_id, const QString& folder_path) -> bool;
+
+        /**
+         * @brief Returns the watch folders of a session.
+         * @param session_id The session identifier.
+         * @return The folder paths in tree order.
+         */
+        [[nodiscard]] auto get_watch_folders(const QString& session_id) const
+            -> QVector<QString>;
+
+        /**
+         * @brief Checks whether any folder node (watch folder or sub folder) shows a folder.
+         * @param folder_path The folder path.
+         * @return True if at least one folder node has this path.
+         */
+        [[nodiscard]] auto has_folder(const QString& folder_path) const -> bool;
+
+        /**
+         * @brief Applies a folder listing to every node showing the folder.
+         *
+         * The first listing populates the node; later listings are applied as a diff: entries
+         * that disappeared are removed (with everything below them), new entries are appended.
+         *
+         * @param folder_path The folder path.
+         * @param sub_folders The absolute paths of the sub folders.
+         * @param files The absolute paths of the log files.
+         */
+        auto apply_folder_listing(const QString& folder_path, const QStringList& sub_folders,
+                                  const QStringList& files) -> void;
+
+        /**
+         * @brief Sets size and modification time of a folder file (all nodes showing it).
+         * @param file_path The file path.
+         * @param size The file size in bytes.
+         * @param last_modified The modification time.
+         */
+        auto set_file_metadata(const QString& file_path, qint64 size,
+                               const QDateTime& last_modified) -> void;
+
+        /**
+         * @brief Sets the app names of folder files (all nodes showing them).
+         * @param log_file_infos The files with their app names.
+         */
+        auto set_file_app_names(const QList<LogFileInfo>& log_file_infos) -> void;
+
         // -------------------------------------------------------------------------
         // QAbstractItemModel overrides
         // -------------------------------------------------------------------------
@@ -240,13 +364,65 @@ class LogFileTreeModel: public QAbstractItemModel
          */
         [[nodiscard]] auto parent(const QModelIndex& index) const -> QModelIndex override;
 
+        /**
+         * @brief Returns whether the given parent has children (unfetched folders always do).
+         * @param parent The parent index.
+         * @return True if the item has or may have children.
+         */
+        [[nodiscard]] auto hasChildren(const QModelIndex& parent = QModelIndex()) const
+            -> bool override;
+
+        /**
+         * @brief Returns whether the content of a folder node has not been requested yet.
+         * @param parent The parent index.
+         * @return True for folder nodes that were never fetched.
+         */
+        [[nodiscard]] auto canFetchMore(const QModelIndex& parent) const -> bool override;
+
+        /**
+         * @brief Requests the content of a folder node via folder_fetch_requested().
+         * @param parent The parent index.
+         */
+        auto fetchMore(const QModelIndex& parent) -> void override;
+
     signals:
         /**
          * @brief Emitted when the last session is removed from the model.
          */
         void all_sessions_removed();
 
+        /**
+         * @brief Emitted when a folder node needs its listing (see apply_folder_listing()).
+         * @param folder_path The folder path.
+         */
+        void folder_fetch_requested(const QString& folder_path);
+
+        /**
+         * @brief Emitted when the last folder node of a path has been removed.
+         * @param folder_path The folder path.
+         */
+        void folder_removed(const QString& folder_path);
+
+        /**
+         * @brief Emitted (batched) for folder files displayed for the first time.
+         *
+         * Answered with set_file_metadata() and set_file_app_names().
+         *
+         * @param file_paths The file paths.
+         */
+        void file_metadata_requested(const QVector<QString>& file_paths);
+
     private:
+        /**
+         * @brief Fetch state of a folder node.
+         */
+        enum class FetchState
+        {
+            NotFetched,
+            Fetching,
+            Fetched
+        };
+
         /**
          * @brief Key for identifying a group within a session.
          */
@@ -268,22 +444,50 @@ class LogFileTreeModel: public QAbstractItemModel
             return qHash(key.session_id, seed) ^ qHash(key.app_name, seed);
         }
 
+        /**
+         * @brief Key for identifying a file item within a group of a session.
+         */
+        struct FileKey {
+                QString session_id;
+                QString group_name;
+                QString file_path;
+
+                auto operator==(const FileKey& other) const -> bool
+                {
+                    return session_id == other.session_id && group_name == other.group_name &&
+                           file_path == other.file_path;
+                }
+        };
+
+        /**
+         * @brief Hash function for FileKey.
+         */
+        friend auto qHash(const FileKey& key, size_t seed = 0) -> size_t
+        {
+            return qHashMulti(seed, key.session_id, key.group_name, key.file_path);
+        }
+
         /**
          * @brief Helper to group files by application name.
          * @param files The list of LogFileInfo objects.
-         * @return A map from app name to list of files.
+         * @return A map from group name to list of files (input order is kept per group).
          */
         [[nodiscard]] static auto group_by_app_name(const QList<LogFileInfo>& files)
             -> QMap<QString, QList<LogFileInfo>>;
 
         /**
-         * @brief Finds the row of a file in a group by file path.
-         * @param group_item The group item.
-         * @param file_path The file path to search for.
-         * @return The row index, or -1 if not found.
+         * @brief Returns the group a file belongs to (its app name, or "Unknown").
+         * @param log_file_info The file.
+         * @return The group name.
          */
-        [[nodiscard]] auto find_file_row(LogFileTreeItem* group_item,
-                                         const QString& file_path) const -> int;
+        [[nodiscard]] static auto get_group_name(const LogFileInfo& log_file_info) -> QString;
+
+        /**
+         * @brief Returns the model index (column 0) of a session or group item.
+         * @param item The tree item.
+         * @return The model index.
+         */
+        [[nodiscard]] auto item_index(LogFileTreeItem* item) const -> QModelIndex;
 
         /**
          * @brief Finds or creates an application group under a session.
@@ -296,11 +500,94 @@ class LogFileTreeModel: public QAbstractItemModel
                                   const QString& app_name) -> LogFileTreeItem*;
 
         /**
-         * @brief Removes empty groups from a session.
-         * @param session_item The session item to clean up.
+         * @brief Appends files to a named group of a session with a single row insertion.
+         *
+         * Creates session and group as needed. Files already in the group (or repeated in the
+         * input) are skipped; the lookup uses the file index, so no group is scanned.
+         *
          * @param session_id The session identifier.
+         * @param group_name The group (app) name.
+         * @param log_file_infos The files to add.
+         * @return Number of files added.
+         */
+        auto insert_files(const QString& session_id, const QString& group_name,
+                          const QList<LogFileInfo>& log_file_infos) -> int;
+
+        /**
+         * @brief Removes files from a named group of a session and drops the group when empty.
+         *
+         * Rows are located through the file index and removed with one removal per contiguous
+         * run.
+         *
+         * @param session_id The session identifier.
+         * @param group_name The group (app) name.
+         * @param file_paths The file paths to remove.
+         * @return Number of files removed.
+         */
+        auto remove_files(const QString& session_id, const QString& group_name,
+                          const QVector<QString>& file_paths) -> int;
+
+        /**
+         * @brief Drops the group and file index entries of a session (items are not deleted).
+         * @param session_id The session identifier.
+         * @param session_item The session item.
+         */
+        auto forget_session_items(const QString& session_id, LogFileTreeItem* session_item)
+            -> void;
+
+        /**
+         * @brief Removes child rows of an item, one removal per contiguous run of rows.
+         *
+         * Folder entries below the removed items are dropped from the folder indexes.
+         *
+         * @param parent_item The parent item.
+         * @param rows The rows to remove (any order, no duplicates).
+         */
+        auto remove_rows(LogFileTreeItem* parent_item, QVector<int> rows) -> void;
+
+        /**
+         * @brief Creates a folder item (not yet attached) and registers it in the folder index.
+         * @param parent_item The parent item.
+         * @param folder_path The folder path.
+         * @return The new folder item.
+         */
+        auto create_folder_item(LogFileTreeItem* parent_item, const QString& folder_path)
+            -> LogFileTreeItem*;
+
+        /**
+         * @brief Creates a folder file item (not yet attached) and registers it in the index.
+         * @param parent_item The parent folder item.
+         * @param file_path The file path.
+         * @return The new file item.
+         */
+        auto create_folder_file_item(LogFileTreeItem* parent_item, const QString& file_path)
+            -> LogFileTreeItem*;
+
+        /**
+         * @brief Applies a listing to one folder node (see apply_folder_listing()).
+         * @param folder_item The folder item.
+         * @param sub_folders The absolute paths of the sub folders.
+         * @param files The absolute paths of the log files.
+         */
+        auto apply_listing_to_folder(LogFileTreeItem* folder_item, const QStringList& sub_folders,
+                                     const QStringList& files) -> void;
+
+        /**
+         * @brief Drops an item and everything below it from the folder indexes.
+         * @param item The item.
+         */
+        auto forget_folder_entries(LogFileTreeItem* item) -> void;
+
+        /**
+         * @brief Queues a metadata request for a folder file (called while painting).
+         * @param item The folder file item.
+         */
+        auto queue_metadata_request(LogFileTreeItem* item) const -> void;
+
+        /**
+         * @brief Emits file_metadata_requested() for all queued files.
          */
-        auto remove_empty_groups(LogFileTreeItem* session_item, const QString& session_id) -> void;
+        auto flush_metadata_requests() -> void;
 
         /**
          * @brief Gets the row index of a session item.
@@ -313,4 +600,9 @@ class LogFileTreeModel: public QAbstractItemModel
         LogFileTreeItem* m_root_item;
         QHash<QString, LogFileTreeItem*> m_session_items;
         QHash<GroupKey, LogFileTreeItem*> m_group_items;
+        QHash<FileKey, LogFileTreeItem*> m_file_items;
+        QHash<QString, QVector<LogFileTreeItem*>> m_folder_items;
+        QHash<QString, QVector<LogFileTreeItem*>> m_folder_file_items;
+        mutable QVector<QString> m_metadata_queue;
+        QTimer* m_metadata_timer{nullptr};
 };
@@ -0,0 +1,219 @@
+#pragma once
+
+#include <QBitArray>
+#include <QRegularExpression>
+#include <QSet>
+#include <QString>
+#include <QVariant>
+#include <QVector>
+#include <memory>
+
+#include "Qt-LogViewer/Models/LogEntry.h"
+#include "Qt-LogViewer/Models/LogFacetCounts.h"
+
+class LogBaseline;
+class LogModel;
+
+/**
+ * @file LogFilter.h
+ * @brief This file contains the definition of the LogFilter class.
+ */
+
+/**
+ * @class LogFilter
+ * @brief A compiled view filter (files, app, levels, search) evaluated on single log entries.
+ *
+ * LogSortFilterProxyModel evaluates its rows with it, and the streaming workers evaluate each
+ * batch with a copy compiled from the same Spec before the batch reaches the GUI thread. Both
+ * therefore share one implementation of the filter rules.
+ *
+ * Extra columns (thread, pid, ...) are typed by the LogModel across all of its entries, which a
+ * worker does not know. Without a model, the few decisions that depend on that typing (an integer
+ * search against an integer value, a search field naming a column the entry lacks) yield
+ * Verdict::Undecided and are left to the proxy.
+ *
+ * The "new since baseline" setting relies on the entries' novelty tags (LogEntry::is_novel()).
+ * The spec carries the baseline so the parser threads tag the entries with it before evaluating
+ * them, and so batches tagged with another baseline are detected as stale.
+ *
+ * A LogFilter is a value type; copies are independent and may be used on different threads.
+ */
+class LogFilter
+{
+    public:
+        /**
+         * @struct Spec
+         * @brief The filter settings of a view, comparable to detect stale batch results.
+         */
+        struct Spec {
+                QString app_name;
+                // Lower-case, trimmed level names.
+                QSet<QString> levels;
+                QString search_text;
+                QString search_field;
+                bool use_regex = false;
+                QString show_only_file_path;
+                QSet<QString> hidden_file_paths;
+                // Baseline the entries are tagged with (compared by identity), or nullptr.
+                std::shared_ptr<const LogBaseline> baseline;
+                // Shows only entries absent from the baseline; ignored without a baseline.
+                bool novel_only = false;
+                // The view drops duplicates across files, so the parser threads compute the
+                // entries' dedupe keys; does not restrict the rows.
+                bool dedupe = false;
+
+                auto operator==(const Spec& other) const -> bool = default;
+
+                /**
+                 * @brief Checks whether any setting restricts the rows.
+                 * @return True if at least one filter is set.
+                 */
+                [[nodiscard]] auto is_active() const -> bool;
+        };
+
+        /**
+         * @brief Result of evaluating an entry.
+         */
+        enum class Verdict : quint8
+        {
+            Rejected,
+            Accepted,
+            Undecided
+        };
+
+        /**
+         * @struct BatchVerdicts
+         * @brief Verdicts for a batch of entries, tagged with the spec they were computed with.
+         *
+         * The facet counts are collected in the same pass: counts covers every entry,
+         * accepted_counts the entries accepted for sure (undecided ones are left to the proxy).
+         * Empty bit arrays mean the batch was not evaluated.
+         *
+         * For specs with dedupe set, the parser threads also fill in the entries' dedupe keys (see
+         * LogDedupeSet::get_key()), so views that drop duplicates across files only probe them.
+         */
+        struct BatchVerdicts {
+                Spec spec;
+                QBitArray accepted;
+                QBitArray undecided;
+                LogFacetCounts counts;
+                LogFacetCounts accepted_counts;
+                // One dedupe key per entry, or empty if not computed.
+                QVector<quint64> entry_keys;
+        };
+
+        /**
+         * @brief Constructs an inactive filter.
+         */
+        LogFilter() = default;
+
+        /**
+         * @brief Compiles a filter from its settings.
+         * @param spec The settings; search settings are ignored while the search text is empty,
+         *        the novelty setting while there is no baseline.
+         */
+        explicit LogFilter(Spec spec);
+
+        /**
+         * @brief Returns the settings the filter was compiled from.
+         * @return The spec.
+         */
+        [[nodiscard]] auto get_spec() const -> const Spec&;
+
+        /**
+         * @brief Checks whether any setting restricts the rows.
+         * @return True if at least one filter is set.
+         */
+        [[nodiscard]] auto is_active() const -> bool;
+
+        /**
+         * @brief Evaluates one entry.
+         * @param entry The entry.
+         * @param model The model the entry is shown in, for extra column typing; nullptr on
+         *        worker threads.
+         * @return The verdict; never Undecided if a model is given.
+         */
+        [[nodiscard]] auto evaluate(const LogEntry& entry, const LogModel* model = nullptr) const
+            -> Verdict;
+
+        /**
+         * @brief Evaluates a batch of entries without a model and counts their facets.
+         * @param entries The entries.
+         * @return One accepted and one undecided bit per entry, plus the facet counts.
+         */
+        [[nodiscard]] auto evaluate_batch(const QVector<LogEntry>& entries) const -> BatchVerdicts;
+
+    private:
+        /**
+         * @brief Outcome of a search that may depend on the model's column typing.
+         */
+        enum class Match : quint8
+        {
+            No,
+            Yes,
+            Unknown
+        };
+
+        /**
+         * @brief Evaluates the search settings.
+         * @param entry The entry.
+         * @param model The model, or nullptr.
+         * @return Whether the entry matches the search.
+         */
+        [[nodiscard]] auto match_search(const LogEntry& entry, const LogModel* model) const
+            -> Match;
+
+        /**
+         * @brief Matches the message, level and app name according to the search field.
+         * @param entry The entry.
+         * @return True if one of the searched fields matches.
+         */
+        [[nodiscard]] auto matches_main_fields(const LogEntry& entry) const -> bool;
+
+        /**
+         * @brief Matches the message, using a byte search for ASCII search text.
+         * @param entry The entry.
+         * @return True if the message matches.
+         */
+        [[nodiscard]] auto matches_message(const LogEntry& entry) const -> bool;
+
+        /**
+         * @brief Matches a text with the search text or regex.
+         * @param text The text.
+         * @return True if the text matches.
+         */
+        [[nodiscard]] auto matches_text(const QString& text) const -> bool;
+
+        /**
+         * @brief Matches an extra field value.
+         *
+         * Integer values of numeric columns compare by value for an integer search text (so "42"
+         * does not match "142"); values of text columns compare as text.
+         *
+         * @param value The value (invalid if the entry lacks the field).
+         * @param numeric_column 1 for a numeric column, 0 for a text column, -1 if unknown.
+         * @return Whether the value matches.
+         */
+        [[nodiscard]] auto match_extra_value(const QVariant& value, int numeric_column) const
+            -> Match;
+
+        /**
+         * @brief Matches all extra fields ("All Fields" search).
+         * @param entry The entry.
+         * @param model The model, or nullptr to use the entry's own fields.
+         * @return Whether any extra field matches.
+         */
+        [[nodiscard]] auto match_extra_fields(const LogEntry& entry, const LogModel* model) const
+            -> Match;
+
+    private:
+        Spec m_spec;
+        bool m_active = false;
+        bool m_all_fields = false;
+        QString m_search_field_lower;
+        // Latin-1 copy of the search text if it is pure ASCII (empty otherwise), for byte search.
+        QByteArray m_search_text_ascii;
+        QRegularExpression m_search_regex;
+        bool m_search_is_number = false;
+        qlonglong m_search_number = 0;
+};
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <QStringView>
+
+#include "SimpleCppLogger/LogLevel.h"
+
+/**
+ * @file LogLevelClassifier.h
+ * @brief This file contains the definition of the LogLevelClassifier class.
+ */
+
+/**
+ * @class LogLevelClassifier
+ * @brief Maps the level token of a log line to a SimpleCppLogger::LogLevel.
+ *
+ * Almost every level token is one of a handful of short words ("INFO", "warn", "Error", ...).
+ * Tokens of up to eight ASCII letters are packed into one 64-bit word, lowercased with a single
+ * OR and compared against precomputed words, so the common case needs neither an allocation nor
+ * a substring search. Anything else goes through the substring rules, which also decide the
+ * result for tokens like "trace_info" or "E_ERROR".
+ */
+class LogLevelClassifier
+{
+    public:
+        /**
+         * @brief Classifies a level token.
+         * @param level The level as it appears in the log.
+         * @return The log level; Info if the token is not recognized.
+         */
+        [[nodiscard]] static auto classify(QStringView level) -> SimpleCppLogger::LogLevel;
+
+        /**
+         * @brief Classifies a level token by substring rules only (reference for tests).
+         * @param level The level as it appears in the log.
+         * @return The log level; Info if the token is not recognized.
+         */
+        [[nodiscard]] static auto classify_by_substring(QStringView level)
+            -> SimpleCppLogger::LogLevel;
+};
@@ -1,9 +1,14 @@
 #pragma once
 
 #include <QAbstractTableModel>
+#include <QBitArray>
+#include <QHash>
+#include <QString>
 #include <QVector>
 
+#include "Qt-LogViewer/Models/LogDecodeCache.h"
 #include "Qt-LogViewer/Models/LogEntry.h"
+#include "Qt-LogViewer/Models/LogEntryStore.h"
 #include "SimpleCppLogger/LogLevel.h"
 
 // LogModel: Model for displaying and managing log entries in a QTableView.
@@ -12,7 +17,9 @@ class LogModel: public QAbstractTableModel
         Q_OBJECT
 
     public:
-        // Column and role enums
+        // Column and role enums. Extra format placeholders (thread, pid, ...) are registered
+        // dynamically as columns between AppName and Spacer; use get_spacer_column() for the
+        // effective spacer index once extra columns exist.
         enum Column
         {
             Timestamp = 0,
@@ -28,7 +35,11 @@ class LogModel: public QAbstractTableModel
             TimestampRole = Qt::UserRole + 1,
             LevelRole,
             MessageRole,
-            AppNameRole
+            AppNameRole,
+            // Stable row identity (quint64, see get_row_id()), served for every column.
+            RowIdRole,
+            // True if the entry is absent from the active baseline (see LogEntry::is_novel()).
+            NovelRole
         };
 
         // Required overrides for QAbstractTableModel
@@ -50,7 +61,10 @@ class LogModel: public QAbstractTableModel
         auto add_entry(const LogEntry& entry) -> void;
         auto clear() -> void;
         [[nodiscard]] auto get_entry(int row) const -> LogEntry;
+        [[nodiscard]] auto get_message_utf8(int row) const -> QByteArray;
+        [[nodiscard]] auto get_log_level(int row) const -> SimpleCppLogger::LogLevel;
         [[nodiscard]] auto get_entries() const -> QVector<LogEntry>;
+        [[nodiscard]] auto get_snapshot() const -> LogEntryStore::Snapshot;
         auto add_entries(const QVector<LogEntry>& entries) -> void;
         auto set_entries(const QVector<LogEntry>& entries) -> void;
 
@@ -60,9 +74,154 @@ class LogModel: public QAbstractTableModel
          */
         auto remove_entries_by_file_path(const QString& file_path) -> void;
 
+        /**
+         * @brief Returns the names of the registered extra columns in column order.
+         * @return List of placeholder names (e.g. "thread", "pid").
+         */
+        [[nodiscard]] auto get_extra_column_names() const -> QVector<QString>;
+
+        /**
+         * @brief Returns the column index of an extra field.
+         * @param field_name The placeholder name (case-insensitive).
+         * @return The column index, or -1 if no such extra column is registered.
+         */
+        [[nodiscard]] auto find_extra_column(const QString& field_name) const -> int;
+
+        /**
+         * @brief Checks whether a column is a registered extra column.
+         * @param column The column index.
+         * @return True if the column holds an extra field.
+         */
+        [[nodiscard]] auto is_extra_column(int column) const -> bool;
+
+        /**
+         * @brief Checks whether an extra column holds integral values only.
+         * @param column The column index.
+         * @return True if every value seen so far in the column is an integer.
+         */
+        [[nodiscard]] auto is_extra_column_numeric(int column) const -> bool;
+
+        /**
+         * @brief Returns the effective index of the trailing spacer column.
+         * @return The spacer column index.
+         */
+        [[nodiscard]] auto get_spacer_column() const -> int;
+
+        /**
+         * @brief Returns the stable identity of a row.
+         *
+         * The id combines a per-model file id (upper 24 bits) with the entry's line offset in its
+         * file (lower 40 bits), or with its ordinal within the file if the offset is unknown. It
+         * does not change while rows are appended, filtered, sorted or paged; 0 is never an id.
+         *
+         * @param row The row index.
+         * @return The row id, or 0 if the row is out of range.
+         */
+        [[nodiscard]] auto get_row_id(int row) const -> quint64;
+
+        /**
+         * @brief Finds the row with a given id in O(log n).
+         * @param row_id An id returned by get_row_id().
+         * @return The row index, or -1 if no row has this id (anymore).
+         */
+        [[nodiscard]] auto find_row(quint64 row_id) const -> int;
+
+        /**
+         * @brief Stores messages decoded ahead of time (e.g. by LogRowPrefetcher).
+         *
+         * data() serves cached messages without decoding them again. Other reads through data()
+         * decode without filling the cache, so they do not evict the prefetched rows; sorting
+         * skips the cache lookup altogether and reads the stored messages (see
+         * get_message_utf8()).
+         *
+         * @param row_ids The row ids (see get_row_id()).
+         * @param messages The decoded messages, one per row id.
+         */
+        auto add_decoded_messages(const QVector<quint64>& row_ids, const QVector<QString>& messages)
+            -> void;
+
+        /**
+         * @brief Checks whether a row's message is in the decode cache.
+         * @param row_id The row id.
+         * @return True if cached.
+         */
+        [[nodiscard]] auto is_message_decoded(quint64 row_id) const -> bool;
+
+        /**
+         * @brief Sets the byte budget of the decode cache.
+         * @param budget_bytes The budget in bytes.
+         */
+        auto set_decode_budget_bytes(qsizetype budget_bytes) -> void;
+
+        /**
+         * @brief Returns the decode cache.
+         * @return The cache (read-only).
+         */
+        [[nodiscard]] auto get_decode_cache() const -> const LogDecodeCache&;
+
+        /**
+         * @brief Sets the rows' novelty tags without resetting the model.
+         *
+         * dataChanged() is emitted once, for NovelRole and Qt::FontRole of the range of rows
+         * whose tag changed.
+         *
+         * @param tags One bit per row, starting at row 0; bits past rowCount() are ignored.
+         */
+        auto set_novel_tags(const QBitArray& tags) -> void;
+
     private:
         static auto map_log_level(const QString& level_str) -> SimpleCppLogger::LogLevel;
 
+        /**
+         * @brief Registers extra columns found in the given entries, emitting column inserts.
+         * @param entries The entries about to be appended.
+         */
+        auto register_extra_columns(const QVector<LogEntry>& entries) -> void;
+
+        /**
+         * @brief Rebuilds the extra column registry from the current entries.
+         *
+         * Must only be called between beginResetModel() and endResetModel().
+         */
+        auto rebuild_extra_columns() -> void;
+
+        /**
+         * @brief Builds a header title from a placeholder name (e.g. "thread_id" -> "Thread Id").
+         * @param field_name The placeholder name.
+         * @return The header title.
+         */
+        static auto to_header_title(const QString& field_name) -> QString;
+
+        /**
+         * @brief Returns the decoded message of a row, from the decode cache if possible.
+         * @param row The row index (must be valid).
+         * @return The message.
+         */
+        [[nodiscard]] auto get_decoded_message(int row) const -> QString;
+
+        /**
+         * @brief Adds rows to the per-file row index behind get_row_id() and find_row().
+         * @param first_row The first row to index; all rows after it are indexed as well.
+         */
+        auto index_rows(int first_row) -> void;
+
+        /**
+         * @brief Returns the key of a row within its file: its line offset, or its ordinal.
+         * @param file_rows The rows of the file in model order.
+         * @param position The position of the row in file_rows.
+         * @return The key (lower 40 bits of the row id).
+         */
+        [[nodiscard]] auto get_row_key(const QVector<int>& file_rows, qsizetype position) const
+            -> quint64;
+
     private:
-        QVector<LogEntry> m_entries;
+        LogEntryStore m_entries;
+        QVector<QString> m_extra_columns;
+        QVector<bool> m_extra_column_numeric;
+        QHash<QString, int> m_extra_column_lookup;
+        // File path -> file id (from 1). Kept when rows are removed, so ids are never reused.
+        QHash<QString, quint32> m_file_ids;
+        // File id -> the file's rows in model order, i.e. in ascending key order.
+        QHash<quint32, QVector<int>> m_file_rows;
+        LogDecodeCache m_decode_cache;
 };
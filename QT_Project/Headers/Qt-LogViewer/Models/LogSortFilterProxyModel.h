@@ -5,22 +5,46 @@
  * @brief This file contains the definition of the LogSortFilterProxyModel class.
  */
 
+#include <QBitArray>
 #include <QCollator>
 #include <QHash>
 #include <QMap>
+#include <QMetaObject>
 #include <QPair>
+#include <QPointer>
 #include <QRegularExpression>
 #include <QSet>
 #include <QSortFilterProxyModel>
 #include <QString>
+#include <QUuid>
 #include <QVector>
 
+#include "Qt-LogViewer/Models/LogFilter.h"
+#include "Qt-LogViewer/Services/TaskToken.h"
+
+class QThreadPool;
+class QTimer;
+class TaskRegistry;
+
 /**
  * @class LogSortFilterProxyModel
  * @brief Proxy model for filtering and sorting log entries in the LogModel.
  *
  * Supports filtering by application name, log level, search string (plain or regex),
- * custom sorting (e.g., log levels, timestamps), and per-file filters (show-only and hide).
+ * custom sorting (e.g., log levels, timestamps, numeric extra columns), per-file filters
+ * (show-only and hide) and entries absent from a baseline (see LogBaseline). The rules are
+ * compiled into a LogFilter; streamed batches may arrive with verdicts that parser threads
+ * computed from the same settings (see set_batch_verdicts()).
+ *
+ * Facet counts (per level, app and file) over all rows and over the rows passing the filter are
+ * kept up to date as source rows are inserted and removed (batches with verdicts bring their own
+ * counts) and recounted from the proxy's mapping after the filter changes.
+ *
+ * Filtering and sorting views of at least get_async_row_threshold() rows runs on a worker thread
+ * over a snapshot of the source rows, as a cancellable task of the view (see set_task_registry()):
+ * the filter pass yields verdicts and the sort pass yields per-row ranks, which are then applied
+ * in one step on the GUI thread. Until then the view keeps its previous rows and order; a newer
+ * filter or sort cancels the running pass.
  *
  * Additionally this proxy computes and exposes match ranges for the active search text so
  * delegates can perform lightweight highlighting without containing any search logic.
@@ -50,6 +74,49 @@ class LogSortFilterProxyModel: public QSortFilterProxyModel
          */
         explicit LogSortFilterProxyModel(QObject* parent = nullptr);
 
+        /**
+         * @brief Cancels running filter and sort passes and waits for them.
+         */
+        ~LogSortFilterProxyModel() override;
+
+        /**
+         * @brief Sets the registry the filter and sort passes are reported to.
+         * @param registry The task registry (may be nullptr).
+         * @param owner The owner the tasks are registered for (the view id).
+         */
+        auto set_task_registry(TaskRegistry* registry, const QUuid& owner) -> void;
+
+        /**
+         * @brief Sets the source row count from which filtering and sorting run on a worker.
+         * @param rows The row threshold.
+         */
+        auto set_async_row_threshold(int rows) -> void;
+
+        /**
+         * @brief Returns the source row count from which filtering and sorting run on a worker.
+         * @return The row threshold.
+         */
+        [[nodiscard]] auto get_async_row_threshold() const noexcept -> int;
+
+        /**
+         * @brief Checks whether a filter pass is running on the worker.
+         * @return True if the current filter is not applied yet.
+         */
+        [[nodiscard]] auto is_filter_pending() const noexcept -> bool;
+
+        /**
+         * @brief Checks whether a sort pass is running on the worker.
+         * @return True if the requested sort is not applied yet.
+         */
+        [[nodiscard]] auto is_sort_pending() const noexcept -> bool;
+
+        /**
+         * @brief Sorts by a column, ranking the rows on the worker for large views.
+         * @param column The source column, or -1 for the source order.
+         * @param order The sort order.
+         */
+        void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) override;
+
         /**
          * @brief Sets the application name filter.
          * @param app_name The application name to filter by (empty for no filter).
@@ -65,7 +132,8 @@ class LogSortFilterProxyModel: public QSortFilterProxyModel
         /**
          * @brief Sets the search string and field.
          * @param search_text The text or regex to search for.
-         * @param field The field to search in ("Message", "Level", "AppName", etc.).
+         * @param field The field to search in ("Message", "Level", "AppName", an extra
+         *        placeholder name such as "thread", etc.).
          * @param use_regex Whether to interpret search_text as a regular expression.
          */
         auto set_search_filter(const QString& search_text, const QString& field,
@@ -107,6 +175,33 @@ class LogSortFilterProxyModel: public QSortFilterProxyModel
          */
         auto clear_hidden_files() -> void;
 
+        /**
+         * @brief Sets the baseline the source entries are tagged with.
+         *
+         * The proxy does not tag entries itself; the baseline becomes part of the filter spec so
+         * parser threads tag streamed entries with it.
+         *
+         * @param baseline The baseline, or nullptr.
+         */
+        auto set_baseline(std::shared_ptr<const LogBaseline> baseline) -> void;
+
+        /**
+         * @brief Shows only entries absent from the baseline (see LogEntry::is_novel()).
+         *        Has no effect while no baseline is set.
+         * @param novel_only True to hide entries found in the baseline.
+         */
+        auto set_novel_only_filter(bool novel_only) -> void;
+
+        /**
+         * @brief Sets whether the view drops duplicates across files (see LogDedupeSet).
+         *
+         * The rows do not change; the setting goes along in the filter spec, so the parser
+         * threads compute the entries' dedupe keys only for views that use them.
+         *
+         * @param enabled True if the view drops duplicates.
+         */
+        auto set_dedupe_enabled(bool enabled) -> void;
+
         /**
          * @brief Returns the current application name filter.
          * @return The application name filter string.
@@ -161,6 +256,24 @@ class LogSortFilterProxyModel: public QSortFilterProxyModel
          */
         [[nodiscard]] auto get_hidden_file_paths() const noexcept -> QSet<QString>;
 
+        /**
+         * @brief Returns the baseline the source entries are tagged with.
+         * @return The baseline, or nullptr.
+         */
+        [[nodiscard]] auto get_baseline() const -> std::shared_ptr<const LogBaseline>;
+
+        /**
+         * @brief Returns whether only entries absent from the baseline are shown.
+         * @return True if the novelty filter is set (even while there is no baseline).
+         */
+        [[nodiscard]] auto is_novel_only_filter() const noexcept -> bool;
+
+        /**
+         * @brief Returns whether the view drops duplicates across files.
+         * @return True if dedupe is enabled.
+         */
+        [[nodiscard]] auto is_dedupe_enabled() const noexcept -> bool;
+
         /**
          * @brief Returns the current sort column.
          * @return Column index, or -1 if unsorted.
@@ -173,6 +286,55 @@ class LogSortFilterProxyModel: public QSortFilterProxyModel
          */
         [[nodiscard]] auto get_sort_order() const noexcept -> Qt::SortOrder;
 
+        /**
+         * @brief Returns the current filter settings, e.g. to evaluate them on parser threads.
+         * @return The filter spec.
+         */
+        [[nodiscard]] auto get_filter_spec() const -> LogFilter::Spec;
+
+        /**
+         * @brief Supplies precomputed verdicts for rows about to be appended to the source model.
+         *
+         * The verdicts are used by filterAcceptsRow() for the rows [first_row, first_row + size)
+         * until clear_batch_verdicts() is called, and the batch's facet counts are added once the
+         * rows are inserted.
+         * Verdicts computed for other filter settings are ignored.
+         *
+         * @param first_row The source row of the first entry of the batch.
+         * @param verdicts The verdicts of the batch.
+         * @return True if the verdicts are used.
+         */
+        auto set_batch_verdicts(int first_row, const LogFilter::BatchVerdicts& verdicts) -> bool;
+
+        /**
+         * @brief Drops the verdicts supplied by set_batch_verdicts().
+         */
+        auto clear_batch_verdicts() -> void;
+
+        /**
+         * @brief Checks whether the rows are filtered by a search.
+         * @return True if a search text is set; every row passing the filter then matches it.
+         */
+        [[nodiscard]] auto is_search_active() const -> bool;
+
+        /**
+         * @brief Returns the entry counts per level, app and file over the rows passing the filter.
+         * @return The facet counts.
+         */
+        [[nodiscard]] auto get_match_counts() const -> LogFacetCounts;
+
+        /**
+         * @brief Returns the entry counts per level, app and file over all rows.
+         * @return The facet counts.
+         */
+        [[nodiscard]] auto get_total_counts() const -> LogFacetCounts;
+
+        /**
+         * @brief Sets the source model and tracks its row changes for the facet counts.
+         * @param source_model The source model (a LogModel).
+         */
+        void setSourceModel(QAbstractItemModel* source_model) override;
+
     protected:
         /**
          * @brief Determines whether the given row should be included in the filtered model.
@@ -204,14 +366,134 @@ class LogSortFilterProxyModel: public QSortFilterProxyModel
 
     private:
         /**
-         * @brief Checks if a specific row passes the current filters.
-         * @param row The row in the source model.
-         * @param parent The parent index in the source model.
+         * @brief Filters all rows again and recounts the rows passing the filter.
+         *
+         * Large views with a filter set are filtered on the worker (see start_filter_task()).
+         */
+        auto refilter() -> void;
+
+        /**
+         * @brief Evaluates the current filter over a snapshot of the source rows on the worker.
+         */
+        auto start_filter_task() -> void;
+
+        /**
+         * @brief Cancels a running filter pass and drops its result.
+         */
+        auto cancel_filter_task() -> void;
+
+        /**
+         * @brief Applies the verdicts of a finished filter pass if it is still current.
+         * @param generation The filter pass the verdicts were computed for.
+         * @param epoch The store epoch of the evaluated snapshot.
+         * @param verdicts One verdict per snapshot row.
+         */
+        auto apply_filter_verdicts(quint64 generation, quint64 epoch,
+                                   const LogFilter::BatchVerdicts& verdicts) -> void;
+
+        /**
+         * @brief Ranks a snapshot of the source rows by a column on the worker.
+         * @param column The source column.
+         * @param order The sort order to apply once ranked.
+         */
+        auto start_sort_task(int column, Qt::SortOrder order) -> void;
+
+        /**
+         * @brief Cancels a running sort pass and drops its result.
+         */
+        auto cancel_sort_task() -> void;
+
+        /**
+         * @brief Sorts by the ranks of a finished sort pass if it is still current.
+         * @param generation The sort pass the ranks were computed for.
+         * @param epoch The store epoch of the ranked snapshot.
+         * @param column The ranked source column.
+         * @param order The sort order.
+         * @param ranks One rank per snapshot row; equal values have equal ranks.
+         */
+        auto apply_sort_ranks(quint64 generation, quint64 epoch, int column, Qt::SortOrder order,
+                              const QVector<int>& ranks) -> void;
+
+        /**
+         * @brief Drops the ranks of the last sort pass, e.g. after the source rows changed.
+         */
+        auto clear_sort_ranks() -> void;
+
+        /**
+         * @brief Registers a task with the registry, if any.
+         * @param name The task name.
+         * @return The task's token.
+         */
+        [[nodiscard]] auto begin_task(const QString& name) const -> TaskToken;
+
+        /**
+         * @brief Ends a task registered with begin_task().
+         * @param token The task's token.
          */
-        [[nodiscard]] auto row_passes_filter(int row, const QModelIndex& parent) const -> bool;
+        auto end_task(const TaskToken& token) const -> void;
 
         /**
-         * @brief Recomputes the internal flag indicating active filters.
+         * @brief Recounts the facet counts over all rows and over the rows passing the filter.
+         */
+        auto recount() -> void;
+
+        /**
+         * @brief Filters all rows again, counting the accepted rows as a by-product of the pass.
+         * @param decided_counts The counts of the rows accepted by batch verdicts.
+         */
+        auto filter_and_count(const LogFacetCounts& decided_counts) -> void;
+
+        /**
+         * @brief Records which rows of a changed range pass the filter, before they are filtered
+         *        again.
+         * @param first The first changed source row.
+         * @param last The last changed source row.
+         */
+        auto record_changed_rows(int first, int last) -> void;
+
+        /**
+         * @brief Updates the match counts for changed rows whose verdict flipped.
+         * @param first The first changed source row.
+         * @param last The last changed source row.
+         * @return True if the counts changed.
+         */
+        auto count_changed_rows(int first, int last) -> bool;
+
+        /**
+         * @brief Adds inserted source rows to the facet counts.
+         * @param first The first inserted source row.
+         * @param last The last inserted source row.
+         */
+        auto count_inserted_rows(int first, int last) -> void;
+
+        /**
+         * @brief Removes source rows about to be removed from the facet counts.
+         * @param first The first removed source row.
+         * @param last The last removed source row.
+         */
+        auto uncount_removed_rows(int first, int last) -> void;
+
+        /**
+         * @brief Checks whether a source row is mapped into the proxy, i.e. passed the filter.
+         * @param source_row The row in the source model.
+         * @return True if the row passed the filter.
+         */
+        [[nodiscard]] auto is_source_row_accepted(int source_row) const -> bool;
+
+        /**
+         * @brief Emits match_counts_changed() once control returns to the event loop.
+         */
+        auto schedule_counts_changed() -> void;
+
+        /**
+         * @brief Checks whether a source column is an extra column covered by the current search.
+         * @param source_column The source column index.
+         * @return True if the search applies to this extra column.
+         */
+        [[nodiscard]] auto is_searched_extra_column(int source_column) const -> bool;
+
+        /**
+         * @brief Recompiles the filter from the current settings and updates the active flag.
          */
         auto recalc_active_filters() -> void;
 
@@ -228,6 +510,13 @@ class LogSortFilterProxyModel: public QSortFilterProxyModel
          */
         void show_only_changed(const QString& file_path);
 
+        /**
+         * @brief Emitted when the facet counts may have changed (filter change or new rows).
+         *
+         * Changes are coalesced: the signal follows once control returns to the event loop.
+         */
+        void match_counts_changed();
+
     private:
         /**
          * @brief Cached collator used in `lessThan` for case-insensitive string comparison.
@@ -243,6 +532,36 @@ class LogSortFilterProxyModel: public QSortFilterProxyModel
         bool m_any_filter_active = false;
         QString m_show_only_file_path;
         QSet<QString> m_hidden_file_paths;
+        std::shared_ptr<const LogBaseline> m_baseline;
+        bool m_novel_only_filter = false;
+        bool m_dedupe_enabled = false;
+        LogFilter m_filter;
+        // Verdicts of the batch being appended, starting at source row m_batch_first_row.
+        int m_batch_first_row = -1;
+        LogFilter::BatchVerdicts m_batch_verdicts;
+        LogFacetCounts m_total_counts;
+        // Also filled by filterAcceptsRow() while m_counting_matches is set (filter_and_count()).
+        mutable LogFacetCounts m_match_counts;
+        bool m_counting_matches = false;
+        // Verdicts of the rows of a dataChanged range before they are filtered again.
+        int m_changed_first_row = -1;
+        QBitArray m_changed_accepted;
+        QTimer* m_counts_timer{nullptr};
+        QVector<QMetaObject::Connection> m_source_connections;
+        // Filter and sort passes of large views; results post back to this object.
+        QThreadPool* m_pool{nullptr};
+        QPointer<TaskRegistry> m_registry;
+        QUuid m_owner;
+        int m_async_row_threshold;
+        TaskToken m_filter_token;
+        quint64 m_filter_generation = 0;
+        bool m_filter_pending = false;
+        TaskToken m_sort_token;
+        quint64 m_sort_generation = 0;
+        bool m_sort_pending = false;
+        // Ranks of the source rows by m_sort_rank_column, used by lessThan() while valid.
+        QVector<int> m_sort_ranks;
+        int m_sort_rank_column = -1;
         // Highlight cache: source_row -> (source_column -> vector of (start,length))
         QHash<int, QMap<int, QVector<QPair<int, int>>>> m_highlight_map;
 };
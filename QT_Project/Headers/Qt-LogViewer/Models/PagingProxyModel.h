@@ -1,12 +1,17 @@
 #pragma once
 
 #include <QAbstractProxyModel>
+#include <QVector>
 
 /**
  * @brief A proxy model that provides paging for any source model.
  *
  * This proxy allows showing only a subset of rows (a "page") from the source model.
  * Paging can be enabled/disabled at runtime.
+ *
+ * If the source (possibly through further proxies) is a LogModel, rows can be located by their
+ * stable id, and the current page can follow anchor rows (e.g. the top visible and the selected
+ * row) while the source is filtered, sorted or grows.
  */
 class PagingProxyModel: public QAbstractProxyModel
 {
@@ -49,6 +54,16 @@ class PagingProxyModel: public QAbstractProxyModel
          */
         auto set_current_page(int page) -> void;
 
+        /**
+         * @brief Requests a page that may not exist yet (e.g. while a restored view is loading).
+         *
+         * The page is shown as soon as enough rows are available for it, without an extra reset
+         * of its own. A later set_current_page() call cancels the request.
+         *
+         * @param page The page number to restore (1-based).
+         */
+        auto set_restore_page(int page) -> void;
+
         /**
          * @brief Returns the current page (1-based).
          * @return The current page number.
@@ -61,6 +76,34 @@ class PagingProxyModel: public QAbstractProxyModel
          */
         [[nodiscard]] auto get_total_pages() const -> int;
 
+        /**
+         * @brief Sets the rows the current page follows when the source changes.
+         *
+         * When source rows are inserted, removed, filtered or re-sorted, or the page size
+         * changes, the proxy switches to the page showing the first of these rows that is still
+         * shown. Explicit page changes (set_current_page(), set_restore_page()) are unaffected.
+         *
+         * @param row_ids Row ids (see LogModel::get_row_id()) in priority order; 0 entries are
+         *        ignored.
+         */
+        auto set_anchor_row_ids(const QVector<quint64>& row_ids) -> void;
+
+        /**
+         * @brief Returns the index of a row on the current page by its id, in O(log n).
+         * @param row_id The row id (see LogModel::get_row_id()).
+         * @param column The column of the index.
+         * @return The index, or an invalid index if the row is not on the current page.
+         */
+        [[nodiscard]] auto index_of_row_id(quint64 row_id, int column = 0) const -> QModelIndex;
+
+        /**
+         * @brief Returns the source row of a row id, across all pages.
+         * @param row_id The row id (see LogModel::get_row_id()).
+         * @return The row in the source model, or -1 if the row is not shown (or the source does
+         *         not end in a LogModel).
+         */
+        [[nodiscard]] auto map_row_id_to_source_row(quint64 row_id) const -> int;
+
         /**
          * @brief Sets the source model for this proxy model.
          * @param source_model The source model to page.
@@ -139,12 +182,20 @@ class PagingProxyModel: public QAbstractProxyModel
         [[nodiscard]] auto get_page_offset() const -> int;
 
         /**
-         * @brief Ensures the current page is within valid bounds.
+         * @brief Ensures the current page is within valid bounds and applies a reachable restore
+         *        page.
          */
         auto validate_current_page() -> void;
 
+        /**
+         * @brief Switches to the page showing the first anchor row that is still shown.
+         */
+        auto follow_anchor_rows() -> void;
+
     private:
         bool m_paging_enabled = true;
         int m_page_size = 25;
         int m_current_page = 1;
+        int m_requested_page = 0;
+        QVector<quint64> m_anchor_row_ids;
 };
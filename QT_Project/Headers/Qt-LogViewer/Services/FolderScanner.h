@@ -0,0 +1,157 @@
+#pragma once
+
+#include <QDateTime>
+#include <QObject>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+class QFileSystemWatcher;
+class QThreadPool;
+
+/**
+ * @file FolderScanner.h
+ * @brief This file contains the definition of the FolderScanner class.
+ */
+
+/**
+ * @class FolderScanner
+ * @brief Lists watch folders one level at a time on a worker pool and watches them for changes.
+ *
+ * A scan enumerates the direct entries of a single folder: sub folders and files matching the
+ * log name filters. Nothing below that level is touched and no file is stat'ed, so the cost of
+ * a scan does not depend on the size of the tree underneath. File metadata (size, modification
+ * time) is read separately and only for the files requested through request_metadata().
+ *
+ * Scanned folders can be put under a QFileSystemWatcher; a change notification triggers a new
+ * scan of that folder, whose listing the receiver applies as a diff. Results are delivered on
+ * the owner's thread. Scan requests for a folder that is already being scanned are merged; a
+ * change notification arriving meanwhile schedules one more scan once the running one reports,
+ * since that scan may have listed the folder before the change. Watches of folders that a scan
+ * finds gone are dropped right away.
+ */
+class FolderScanner: public QObject
+{
+        Q_OBJECT
+
+    public:
+        /**
+         * @struct FolderListing
+         * @brief Direct entries of a folder, each list sorted by name.
+         */
+        struct FolderListing {
+                QStringList sub_folders;
+                QStringList files;
+                bool exists = true;
+        };
+
+        /**
+         * @brief Constructs a FolderScanner.
+         * @param parent Optional QObject parent.
+         */
+        explicit FolderScanner(QObject* parent = nullptr);
+
+        /**
+         * @brief Waits for running scans; queued ones are dropped.
+         */
+        ~FolderScanner() override;
+
+        /**
+         * @brief Returns the name filters files must match to be listed.
+         * @return The name filters (e.g. "*.log").
+         */
+        [[nodiscard]] static auto get_name_filters() -> QStringList;
+
+        /**
+         * @brief Queues a scan of one folder level; folder_scanned() is emitted when done.
+         * @param folder_path The absolute folder path.
+         */
+        auto scan(const QString& folder_path) -> void;
+
+        /**
+         * @brief Queues reading the size and modification time of files.
+         *
+         * metadata_ready() is emitted once per file.
+         *
+         * @param file_paths The file paths.
+         */
+        auto request_metadata(const QVector<QString>& file_paths) -> void;
+
+        /**
+         * @brief Watches a folder; a change triggers a new scan of it.
+         * @param folder_path The absolute folder path.
+         */
+        auto watch(const QString& folder_path) -> void;
+
+        /**
+         * @brief Stops watching a folder.
+         * @param folder_path The absolute folder path.
+         */
+        auto unwatch(const QString& folder_path) -> void;
+
+        /**
+         * @brief Checks whether scans or metadata requests are pending.
+         * @return True if at least one result has not been reported yet.
+         */
+        [[nodiscard]] auto is_busy() const -> bool;
+
+        /**
+         * @brief Returns the watched folders.
+         * @return The absolute paths of the watched folders.
+         */
+        [[nodiscard]] auto get_watched_folders() const -> QStringList;
+
+        /**
+         * @brief Lists the direct entries of a folder synchronously.
+         * @param folder_path The folder path.
+         * @return The sorted sub folders and matching files (absolute paths); exists is false
+         *         if the folder is gone.
+         */
+        [[nodiscard]] static auto list_folder(const QString& folder_path) -> FolderListing;
+
+    signals:
+        /**
+         * @brief Emitted when a folder scan has finished.
+         * @param folder_path The folder path as passed to scan().
+         * @param sub_folders The absolute paths of the sub folders.
+         * @param files The absolute paths of the matching files.
+         */
+        void folder_scanned(const QString& folder_path, const QStringList& sub_folders,
+                            const QStringList& files);
+
+        /**
+         * @brief Emitted when the metadata of a requested file has been read.
+         * @param file_path The file path as passed to request_metadata().
+         * @param size The file size in bytes, or -1 if the file does not exist.
+         * @param last_modified The modification time.
+         */
+        void metadata_ready(const QString& file_path, qint64 size, const QDateTime& last_modified);
+
+    private:
+        /**
+         * @brief Rescans a watched folder, or marks it for a rescan if a scan is running.
+         * @param folder_path The changed folder.
+         */
+        auto handle_directory_changed(const QString& folder_path) -> void;
+
+        /**
+         * @brief Stops watching a folder and every watched folder below it.
+         * @param folder_path The folder path.
+         */
+        auto unwatch_tree(const QString& folder_path) -> void;
+
+        /**
+         * @brief Reports a pool scan result (runs on the owner's thread).
+         * @param folder_path The scanned folder.
+         * @param listing The listing computed by the worker.
+         */
+        auto handle_scan_result(const QString& folder_path, const FolderListing& listing) -> void;
+
+    private:
+        QThreadPool* m_pool{nullptr};
+        QFileSystemWatcher* m_watcher{nullptr};
+        QSet<QString> m_pending_scans;
+        QSet<QString> m_rescan_folders;
+        int m_pending_metadata = 0;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <QString>
+#include <QVector>
+
+/**
+ * @file LineSplitter.h
+ * @brief This file contains the definition of the LineSplitter class.
+ */
+
+/**
+ * @class LineSplitter
+ * @brief Finds line boundaries in a byte buffer, many lines per call.
+ *
+ * The buffer is compared against '\n' 16 or 32 bytes at a time (SSE2 or AVX2 on x86-64, NEON on
+ * ARM64); the resulting bit mask yields all line ends of a block without a per-byte branch. The
+ * widest instruction set available at runtime is chosen once; other platforms use memchr.
+ *
+ * Only '\n' is a line end; a preceding '\r' is left in the span for the caller to strip.
+ */
+class LineSplitter
+{
+    public:
+        /**
+         * @struct LineSpan
+         * @brief A line inside the buffer, without its '\n'.
+         */
+        struct LineSpan {
+                qsizetype offset = 0;
+                qsizetype length = 0;
+        };
+
+        /**
+         * @brief Appends a span for every line terminated by '\n'.
+         *
+         * The first line starts at the beginning of the buffer. Bytes before scan_from are known
+         * to contain no '\n' (e.g. the start of a long line scanned by a previous call).
+         *
+         * @param data The buffer.
+         * @param size The buffer size in bytes.
+         * @param spans Output; spans are appended.
+         * @param scan_from The offset to start looking for '\n'.
+         * @return The number of bytes covered by the appended spans (end of the last '\n').
+         */
+        static auto split_lines(const char* data, qsizetype size, QVector<LineSpan>& spans,
+                                qsizetype scan_from = 0) -> qsizetype;
+
+        /**
+         * @brief Appends spans using the portable memchr loop (reference for tests).
+         * @param data The buffer.
+         * @param size The buffer size in bytes.
+         * @param spans Output; spans are appended.
+         * @param scan_from The offset to start looking for '\n'.
+         * @return The number of bytes covered by the appended spans.
+         */
+        static auto split_lines_scalar(const char* data, qsizetype size,
+                                       QVector<LineSpan>& spans, qsizetype scan_from = 0)
+            -> qsizetype;
+
+        /**
+         * @brief Returns the instruction set used by split_lines().
+         * @return "AVX2", "SSE2", "NEON" or "scalar".
+         */
+        [[nodiscard]] static auto get_instruction_set() -> QString;
+};
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <QDateTime>
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QString>
+#include <QVector>
+#include <memory>
+
+class LogFormatDetector;
+class QThreadPool;
+
+/**
+ * @file LogAppIdentifier.h
+ * @brief This file contains the definition of the LogAppIdentifier class.
+ */
+
+/**
+ * @class LogAppIdentifier
+ * @brief Identifies the application name of log files on a worker pool.
+ *
+ * For each requested file a pool thread detects the file's format and parses lines until one
+ * yields an app name. Reading stops after a fixed number of lines or bytes, so a file that does
+ * not match any format costs a bounded amount of I/O; such files fall back to
+ * LogLoader::identify_app() (the file's base name).
+ *
+ * All files share one LogFormatDetector built from the format library, so its detection cache
+ * carries over between requests. Requests capture the detector they were queued with; changing
+ * the formats builds a new one without disturbing running identifications.
+ *
+ * Results are delivered on the owner's thread via app_identified() and cached per file identity
+ * (path, size, modification time), so re-adding an unchanged file needs no I/O. Requests for a
+ * file that is already being identified are merged.
+ */
+class LogAppIdentifier: public QObject
+{
+        Q_OBJECT
+
+    public:
+        /**
+         * @brief Constructs a LogAppIdentifier.
+         * @param parent Optional QObject parent.
+         */
+        explicit LogAppIdentifier(QObject* parent = nullptr);
+
+        /**
+         * @brief Waits for running identifications; queued ones are dropped.
+         */
+        ~LogAppIdentifier() override;
+
+        /**
+         * @brief Sets the format library used for identification.
+         * @param formats Format strings; the first one is the preferred (primary) format.
+         */
+        auto set_formats(const QVector<QString>& formats) -> void;
+
+        /**
+         * @brief Returns the cached app name of a file if its identity is unchanged.
+         * @param file_path The path to the log file.
+         * @return The cached app name, or an empty string if not cached or outdated.
+         */
+        [[nodiscard]] auto get_cached_app_name(const QString& file_path) const -> QString;
+
+        /**
+         * @brief Queues a file for identification; app_identified() is emitted when done.
+         * @param file_path The path to the log file.
+         */
+        auto request(const QString& file_path) -> void;
+
+        /**
+         * @brief Checks whether identifications are pending.
+         * @return True if at least one requested file has not been reported yet.
+         */
+        [[nodiscard]] auto is_busy() const -> bool;
+
+        /**
+         * @brief Identifies the app name of a file synchronously (capped read).
+         * @param file_path The path to the log file.
+         * @param detector Detects the file's format, or nullptr to skip parsing.
+         * @return The app name of the first parseable entry, or LogLoader::identify_app().
+         */
+        [[nodiscard]] static auto identify(const QString& file_path,
+                                           const LogFormatDetector* detector) -> QString;
+
+    signals:
+        /**
+         * @brief Emitted when the app name of a requested file is known.
+         * @param file_path The file path as passed to request().
+         * @param app_name The identified app name.
+         */
+        void app_identified(const QString& file_path, const QString& app_name);
+
+    private:
+        /**
+         * @struct CachedIdentity
+         * @brief Cached app name together with the file identity it was computed for.
+         */
+        struct CachedIdentity {
+                qint64 size = -1;
+                QDateTime last_modified;
+                QString app_name;
+        };
+
+        /**
+         * @brief Stores a pool result and reports it (runs on the owner's thread).
+         * @param file_path The requested file path.
+         * @param identity The identity and app name computed by the worker.
+         */
+        auto handle_result(const QString& file_path, const CachedIdentity& identity) -> void;
+
+    private:
+        QThreadPool* m_pool{nullptr};
+        QVector<QString> m_formats;
+        std::shared_ptr<const LogFormatDetector> m_detector;
+        QHash<QString, CachedIdentity> m_cache;
+        QSet<QString> m_pending;
+};
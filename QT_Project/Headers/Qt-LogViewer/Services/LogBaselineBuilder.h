@@ -0,0 +1,133 @@
+#pragma once
+
+#include <QObject>
+#include <QString>
+#include <QVector>
+
+#include <functional>
+#include <memory>
+
+#include "Qt-LogViewer/Models/LogBaseline.h"
+#include "Qt-LogViewer/Services/TaskToken.h"
+
+class QThreadPool;
+
+/**
+ * @file LogBaselineBuilder.h
+ * @brief This file contains the definition of the LogBaselineBuilder class.
+ */
+
+/**
+ * @class LogBaselineBuilder
+ * @brief Builds a LogBaseline from reference log files on a worker pool.
+ *
+ * The reference files are parsed in parallel, one pool task per file, with the same format
+ * detection as regular loads. The tasks stream their file and fingerprint it batch by batch;
+ * each batch of fingerprints is posted to the owner's thread and added to the one filter of the
+ * build, sized for the estimated entries of all files. Memory therefore stays bounded by a batch
+ * per task, however large the reference files are. finished() is emitted once every file is
+ * done; a file that cannot be read adds no fingerprints.
+ *
+ * A new build() or cancel() cancels the running build: the tasks stop at their next batch and
+ * their results are dropped, so neither waits for a file to be parsed to its end.
+ */
+class LogBaselineBuilder: public QObject
+{
+        Q_OBJECT
+
+    public:
+        /**
+         * @brief Constructs an idle builder.
+         * @param parent Optional QObject parent.
+         */
+        explicit LogBaselineBuilder(QObject* parent = nullptr);
+
+        /**
+         * @brief Cancels the running build and waits for the pool.
+         */
+        ~LogBaselineBuilder() override;
+
+        /**
+         * @brief Sets the format library used to parse the reference files.
+         * @param formats Format strings; the first one is the preferred (primary) format.
+         */
+        auto set_formats(const QVector<QString>& formats) -> void;
+
+        /**
+         * @brief Starts building a baseline from reference files, replacing a running build.
+         *
+         * Without files, finished() is emitted right away and get_baseline() returns nullptr.
+         *
+         * @param file_paths The reference files.
+         */
+        auto build(const QVector<QString>& file_paths) -> void;
+
+        /**
+         * @brief Cancels the running build; the last finished baseline is kept.
+         */
+        auto cancel() -> void;
+
+        /**
+         * @brief Checks whether a build is running.
+         * @return True while reference files are being parsed.
+         */
+        [[nodiscard]] auto is_busy() const -> bool;
+
+        /**
+         * @brief Returns the baseline of the last finished build.
+         * @return The baseline, or nullptr if none was built.
+         */
+        [[nodiscard]] auto get_baseline() const -> std::shared_ptr<const LogBaseline>;
+
+        /**
+         * @brief Fingerprints one reference file synchronously, batch by batch.
+         * @param file_path The file.
+         * @param formats Format library; the first format is preferred.
+         * @param token Checked between batches; a cancelled token stops the parse.
+         * @param handle_batch Called with the fingerprints of each batch of entries.
+         * @return False if the parse was cancelled.
+         */
+        static auto fingerprint_file(
+            const QString& file_path, const QVector<QString>& formats, const TaskToken& token,
+            const std::function<void(const QVector<quint64>&)>& handle_batch) -> bool;
+
+    signals:
+        /**
+         * @brief Emitted after each reference file was fingerprinted.
+         * @param files_done The number of files done.
+         * @param file_count The number of files of the build.
+         */
+        void progress(int files_done, int file_count);
+
+        /**
+         * @brief Emitted when a build finished; see get_baseline().
+         */
+        void finished();
+
+    private:
+        /**
+         * @brief Adds a batch of fingerprints if it belongs to the running build.
+         * @param generation The build the task was started for.
+         * @param fingerprints The fingerprints.
+         */
+        auto handle_fingerprints(quint64 generation, const QVector<quint64>& fingerprints)
+            -> void;
+
+        /**
+         * @brief Counts a finished file and completes the build after the last one.
+         * @param generation The build the task was started for.
+         */
+        auto handle_file_done(quint64 generation) -> void;
+
+    private:
+        QThreadPool* m_pool{nullptr};
+        QVector<QString> m_formats;
+        // Identifies the running build, so results of cancelled builds are dropped.
+        quint64 m_generation = 0;
+        // Checked by the tasks between batches; cancelled with the build.
+        TaskToken m_token;
+        std::unique_ptr<LogBaseline> m_building;
+        std::shared_ptr<const LogBaseline> m_baseline;
+        int m_file_count = 0;
+        int m_files_done = 0;
+};
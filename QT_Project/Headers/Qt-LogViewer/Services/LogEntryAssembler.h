@@ -0,0 +1,105 @@
+#pragma once
+
+#include <QByteArrayList>
+#include <QByteArrayView>
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+#include "Qt-LogViewer/Models/LogEntry.h"
+
+/**
+ * @file LogEntryAssembler.h
+ * @brief This file contains the definition of the LogEntryAssembler class.
+ */
+
+/**
+ * @class LogEntryAssembler
+ * @brief Assembles multi-line log entries (e.g. stack traces) from consecutive parsed lines.
+ *
+ * Lines that match the log format start a new entry; lines that do not match are treated as
+ * continuation lines of the preceding entry (Java/C++ stack traces, wrapped payloads).
+ * Continuation lines are collected (UTF-8 encoded, like the stored message) and joined once
+ * when the entry completes, instead of growing the message string line by line.
+ *
+ * The assembled message is capped at a configurable number of characters; continuation lines
+ * beyond the cap are dropped and a truncation marker is appended. Continuation lines that
+ * appear before the first entry have nothing to attach to and are dropped. If a continuation
+ * line was truncated by the reader (see LogEntry::set_source_range()), the entry takes over its
+ * source range, unless it already has one.
+ *
+ * String extra fields of the assembled entries are pooled, so repeated values (thread names,
+ * logger names) share one allocation. The pool is bounded and belongs to the assembler, i.e.
+ * to the worker reading the file.
+ *
+ * Usage:
+ * - Call `add_line(parsed, raw_line, completed, raw_line_utf8)` for every line in file order.
+ * - Call `finish(completed)` at the end of the input to flush the last entry.
+ */
+class LogEntryAssembler
+{
+    public:
+        /**
+         * @brief Constructs a LogEntryAssembler.
+         * @param max_entry_chars Upper bound for the assembled message length in characters.
+         */
+        explicit LogEntryAssembler(qsizetype max_entry_chars = k_default_max_entry_chars);
+
+        /**
+         * @brief Feeds one line into the assembler.
+         * @param parsed The line parsed with the file's parser (empty level = no match).
+         * @param raw_line The raw line text, used when the line is a continuation.
+         * @param completed Output list; receives the previous entry once a new one starts.
+         * @param raw_line_utf8 The bytes raw_line was decoded from (see
+         * LogLineReader::get_line_utf8()), or empty to encode raw_line instead.
+         */
+        auto add_line(const LogEntry& parsed, const QString& raw_line,
+                      QVector<LogEntry>& completed,
+                      QByteArrayView raw_line_utf8 = QByteArrayView()) -> void;
+
+        /**
+         * @brief Flushes the pending entry (if any) at the end of the input.
+         * @param completed Output list receiving the pending entry.
+         */
+        auto finish(QVector<LogEntry>& completed) -> void;
+
+        /**
+         * @brief Checks whether an entry is waiting for further continuation lines.
+         * @return True if an entry is pending.
+         */
+        [[nodiscard]] auto has_pending() const -> bool;
+
+        /**
+         * @brief Returns the number of entries whose continuation lines were truncated.
+         * @return Truncated entry count.
+         */
+        [[nodiscard]] auto get_truncated_count() const -> qsizetype;
+
+        /**
+         * @brief Default cap for the assembled message length (64 Ki characters).
+         */
+        static constexpr qsizetype k_default_max_entry_chars = 64 * 1024;
+
+    private:
+        /**
+         * @brief Joins the pending continuation lines into the pending entry and emits it.
+         * @param completed Output list receiving the entry.
+         */
+        auto complete_pending(QVector<LogEntry>& completed) -> void;
+
+        /**
+         * @brief Replaces the string extra fields of an entry with their pooled copies.
+         * @param entry The entry.
+         */
+        auto intern_extra_fields(LogEntry& entry) -> void;
+
+    private:
+        qsizetype m_max_entry_chars;
+        LogEntry m_pending;
+        bool m_has_pending = false;
+        QByteArrayList m_continuation_lines;
+        qsizetype m_pending_chars = 0;
+        bool m_pending_truncated = false;
+        qsizetype m_truncated_count = 0;
+        QHash<QString, QString> m_string_pool;
+};
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <QDateTime>
+#include <QHash>
+#include <QMutex>
+#include <QString>
+#include <QVector>
+
+/**
+ * @file LogFormatDetector.h
+ * @brief This file contains the definition of the LogFormatDetector class.
+ */
+
+/**
+ * @class LogFormatDetector
+ * @brief Picks the best matching log format for a file by scoring a small content sample.
+ *
+ * The detector holds a library of format strings (the configured primary format, the built-in
+ * formats and any user-defined ones). For a file it samples the first and the middle few KB,
+ * parses the sampled lines with every candidate and picks the format with the highest match
+ * rate. Ties are resolved in favor of the more specific format (more placeholders), then the
+ * library order, so the primary format wins when everything else is equal.
+ *
+ * Results are cached per file identity (path, size, modification time). All methods are
+ * thread-safe.
+ */
+class LogFormatDetector
+{
+    public:
+        /**
+         * @brief Constructs a LogFormatDetector.
+         * @param primary_format The configured format, preferred on ties and used as fallback.
+         */
+        explicit LogFormatDetector(const QString& primary_format);
+
+        /**
+         * @brief Returns the built-in format library.
+         * @return List of format strings.
+         */
+        [[nodiscard]] static auto get_builtin_formats() -> QVector<QString>;
+
+        /**
+         * @brief Adds user-defined formats to the library (duplicates are ignored).
+         *
+         * Clears the detection cache, since earlier decisions may no longer be the best match.
+         *
+         * @param formats Format strings (e.g. "{timestamp} [{thread}] {level} {message}").
+         */
+        auto add_formats(const QVector<QString>& formats) -> void;
+
+        /**
+         * @brief Returns the format library in preference order.
+         * @return List of format strings; the primary format comes first.
+         */
+        [[nodiscard]] auto get_formats() const -> QVector<QString>;
+
+        /**
+         * @brief Returns the primary (fallback) format.
+         * @return The primary format string.
+         */
+        [[nodiscard]] auto get_primary_format() const -> QString;
+
+        /**
+         * @brief Detects the best matching format for the given file.
+         * @param file_path The path to the log file.
+         * @return The detected format, or the primary format if nothing matches.
+         */
+        [[nodiscard]] auto detect_format(const QString& file_path) const -> QString;
+
+        /**
+         * @brief Scores every format of the library against the given lines.
+         * @param lines Sample lines (empty lines are ignored).
+         * @return The best matching format, or an empty string if no line matched at all.
+         */
+        [[nodiscard]] auto detect_format_for_lines(const QVector<QString>& lines) const -> QString;
+
+        /**
+         * @brief Drops all cached detection results.
+         */
+        auto clear_cache() -> void;
+
+    private:
+        /**
+         * @struct CachedDetection
+         * @brief Cached detection result together with the file identity it was computed for.
+         */
+        struct CachedDetection {
+                qint64 size = -1;
+                QDateTime last_modified;
+                QString format;
+        };
+
+        /**
+         * @brief Reads the sample lines (head and middle of the file) used for detection.
+         * @param file_path The path to the log file.
+         * @return The sampled lines.
+         */
+        [[nodiscard]] static auto read_sample_lines(const QString& file_path) -> QVector<QString>;
+
+    private:
+        QString m_primary_format;
+        QVector<QString> m_formats;
+        mutable QHash<QString, CachedDetection> m_cache;
+        mutable QMutex m_mutex;
+};
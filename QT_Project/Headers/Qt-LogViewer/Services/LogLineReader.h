@@ -0,0 +1,231 @@
+#pragma once
+
+#include <QByteArrayView>
+#include <QIODevice>
+#include <QString>
+#include <QStringDecoder>
+#include <QTextStream>
+#include <QVector>
+
+#include <memory>
+
+#include "Qt-LogViewer/Services/LineSplitter.h"
+
+/**
+ * @file LogLineReader.h
+ * @brief This file contains the definition of the LogLineReader class.
+ */
+
+/**
+ * @class LogLineReader
+ * @brief Reads a log file line by line from raw bytes, validating the UTF-8 encoding.
+ *
+ * Unlike QTextStream, which decodes its whole read buffer to UTF-16 up front, the reader keeps
+ * the data as UTF-8 bytes and decodes one line at a time. Only the line currently being parsed
+ * exists as a QString; its bytes stay available through get_line_utf8(), so the parser can
+ * store the message without encoding it again.
+ *
+ * The device is read in large blocks and LineSplitter finds all line ends of a block in one
+ * vectorized pass; read_line() then only decodes the next span. A line longer than a block is
+ * completed from the following blocks without rescanning its beginning.
+ *
+ * Lines longer than get_max_line_length() bytes (a minified JSON dump, a binary blob) are not
+ * buffered whole: only a prefix of that size is kept, the rest of the line is skipped block by
+ * block. read_line() returns the prefix and is_line_truncated() reports it, together with the
+ * offset and length of the full line on disk. Memory therefore stays bounded by the limit plus
+ * one block, regardless of the line length.
+ *
+ * Encoding handling:
+ * - A leading UTF-8 BOM is skipped.
+ * - Files starting with a UTF-16 or UTF-32 BOM are decoded through a QTextStream fallback.
+ * - Lines that are not valid UTF-8 are decoded as Latin-1 (so no byte is lost or replaced)
+ *   and counted, see get_invalid_line_count().
+ *
+ * Line endings ("\n" and "\r\n") are stripped. The device must be open for reading and is
+ * not owned by the reader. The line length limit does not apply to the QTextStream fallback.
+ */
+class LogLineReader
+{
+    public:
+        /**
+         * @brief Constructs a LogLineReader on an open device and inspects its BOM.
+         * @param device The device to read from (not owned).
+         */
+        explicit LogLineReader(QIODevice* device);
+
+        /**
+         * @brief Reads the next line.
+         * @param line Output for the decoded line without its line ending.
+         * @return True if a line was read, false at the end of the input.
+         */
+        auto read_line(QString& line) -> bool;
+
+        /**
+         * @brief Checks whether the end of the input has been reached.
+         * @return True if no further line can be read.
+         */
+        [[nodiscard]] auto at_end() const -> bool;
+
+        /**
+         * @brief Returns the device offset behind the last line returned by read_line().
+         *
+         * The device position itself runs up to a block ahead, so progress and byte limits must
+         * use this instead.
+         *
+         * @return The number of bytes consumed.
+         */
+        [[nodiscard]] auto get_position() const -> qint64;
+
+        /**
+         * @brief Sets the length above which lines are truncated.
+         * @param max_line_bytes The limit in bytes; values <= 0 restore the default.
+         */
+        auto set_max_line_length(qsizetype max_line_bytes) -> void;
+
+        /**
+         * @brief Returns the length above which lines are truncated.
+         * @return The limit in bytes.
+         */
+        [[nodiscard]] auto get_max_line_length() const -> qsizetype;
+
+        /**
+         * @brief Limits how far into the device the reader reads.
+         *
+         * The reader then never reads past the offset, even inside an overlong line. A line cut
+         * off by the limit is dropped instead of being returned incomplete. Does not apply to
+         * the QTextStream fallback.
+         *
+         * @param max_offset Device offset to stop at, or a negative value for no limit.
+         */
+        auto set_read_limit(qint64 max_offset) -> void;
+
+        /**
+         * @brief Checks whether the last line returned by read_line() was truncated.
+         * @return True if the line only holds a prefix of the line on disk.
+         */
+        [[nodiscard]] auto is_line_truncated() const -> bool;
+
+        /**
+         * @brief Returns the device offset of the last line returned by read_line().
+         *
+         * Like get_line_length(), only tracked for UTF-8 input.
+         *
+         * @return The offset of the line's first byte, or -1 if not tracked.
+         */
+        [[nodiscard]] auto get_line_offset() const -> qint64;
+
+        /**
+         * @brief Returns the full length of the last line returned by read_line().
+         * @return The length in bytes on disk, without the line ending.
+         */
+        [[nodiscard]] auto get_line_length() const -> qint64;
+
+        /**
+         * @brief Returns the UTF-8 bytes of the last line returned by read_line().
+         *
+         * The view points into the reader's buffer and is only valid until the next call to
+         * read_line().
+         *
+         * @return The bytes the line was decoded from, or an empty view for the QTextStream
+         * fallback and for lines that were not valid UTF-8.
+         */
+        [[nodiscard]] auto get_line_utf8() const -> QByteArrayView;
+
+        /**
+         * @brief Returns the number of lines that were truncated.
+         * @return Count of lines longer than the limit.
+         */
+        [[nodiscard]] auto get_truncated_line_count() const -> qsizetype;
+
+        /**
+         * @brief Returns the number of lines that were not valid UTF-8.
+         * @return Count of lines decoded as Latin-1.
+         */
+        [[nodiscard]] auto get_invalid_line_count() const -> qsizetype;
+
+        /**
+         * @brief Checks whether the input is read as UTF-8 (no UTF-16/UTF-32 BOM found).
+         * @return True for UTF-8 input.
+         */
+        [[nodiscard]] auto is_utf8() const -> bool;
+
+        /**
+         * @brief Default line length limit (1 MiB).
+         */
+        static constexpr qsizetype k_default_max_line_length = 1024 * 1024;
+
+    private:
+        /**
+         * @brief Reads blocks until at least one line span is available or the input ends.
+         */
+        auto fill_spans() -> void;
+
+        /**
+         * @brief Keeps a prefix of the overlong line filling the buffer and skips its rest.
+         *
+         * Afterwards the buffer holds the bytes behind the line, already split into spans.
+         */
+        auto skip_long_line() -> void;
+
+        /**
+         * @brief Reads up to a block from the device, stopping at the read limit.
+         * @param data Output buffer.
+         * @param max_size Maximum number of bytes to read.
+         * @return The number of bytes read; 0 at the end of the input or the limit.
+         */
+        auto read_block(char* data, qint64 max_size) -> qint64;
+
+        /**
+         * @brief Checks whether more input exists but lies behind the read limit.
+         * @return True if the limit stopped reading before the end of the device.
+         */
+        [[nodiscard]] auto is_limit_reached() const -> bool;
+
+        /**
+         * @brief Decodes UTF-8 bytes, falling back to Latin-1 for invalid UTF-8.
+         * @param data The bytes.
+         * @param length The number of bytes.
+         * @return The decoded text.
+         */
+        auto decode(const char* data, qsizetype length) -> QString;
+
+        /**
+         * @brief Decodes a line of the buffer, truncated to the line length limit.
+         * @param span The line inside m_buffer.
+         * @return The decoded line without its line ending.
+         */
+        auto decode_span(const LineSplitter::LineSpan& span) -> QString;
+
+    private:
+        QIODevice* m_device;
+        std::unique_ptr<QTextStream> m_fallback_stream;
+        QStringDecoder m_decoder;
+        qsizetype m_invalid_line_count = 0;
+
+        // Block buffer: m_buffer[0] is at device offset m_buffer_base. Bytes before
+        // m_buffer_end are covered by m_spans; the rest is an incomplete line whose first
+        // m_scan_from bytes are known to contain no '\n'.
+        QByteArray m_buffer;
+        QVector<LineSplitter::LineSpan> m_spans;
+        qsizetype m_next_span = 0;
+        qsizetype m_buffer_end = 0;
+        qsizetype m_scan_from = 0;
+        qint64 m_buffer_base = 0;
+        qint64 m_position = 0;
+        qint64 m_read_limit = -1;
+
+        // Overlong line found by fill_spans(), returned before the spans behind it.
+        qsizetype m_max_line_length = k_default_max_line_length;
+        bool m_has_long_line = false;
+        QByteArray m_long_line_prefix;
+        qint64 m_long_line_offset = 0;
+        qint64 m_long_line_length = 0;
+        qint64 m_long_line_end = 0;
+
+        // The last line returned by read_line().
+        bool m_line_truncated = false;
+        QByteArrayView m_line_utf8;
+        qint64 m_line_offset = 0;
+        qint64 m_line_length = 0;
+        qsizetype m_truncated_line_count = 0;
+};
@@ -6,7 +6,11 @@
 #include <QVector>
 
 #include "Qt-LogViewer/Models/LogEntry.h"
+#include "Qt-LogViewer/Models/LogFilter.h"
+#include "Qt-LogViewer/Services/LogFormatDetector.h"
+#include "Qt-LogViewer/Services/LogLineReader.h"
 #include "Qt-LogViewer/Services/LogParser.h"
+#include "Qt-LogViewer/Services/TaskToken.h"
 
 /**
  * @file LogLoader.h
@@ -22,6 +26,9 @@ class LogStreamWorker;
  * This class is responsible for loading log files from disk, determining the application
  * source for each log, and using LogParser to extract LogEntry objects. It provides both
  * eager (full-file) and streaming (line-by-line) loading modes.
+ *
+ * The parser is chosen per file: LogFormatDetector scores a sample of the file against the
+ * configured format and the known format library, so views can mix files of different formats.
  */
 class LogLoader: public QObject
 {
@@ -36,9 +43,9 @@ class LogLoader: public QObject
         explicit LogLoader(const QString& format_string, QObject* parent = nullptr);
 
         /**
-         * @brief Destroys the LogLoader object.
+         * @brief Destroys the LogLoader object, cancelling and joining a running stream.
          */
-        ~LogLoader() override = default;
+        ~LogLoader() override;
 
         /**
          * @brief Loads and parses a single log file.
@@ -74,8 +81,10 @@ class LogLoader: public QObject
          *        Emits batches of parsed entries and progress until finished or cancelled.
          * @param file_path The path to the log file.
          * @param batch_size The number of entries per emitted batch (default 1000).
+         * @param token Token the worker checks for cancellation and reports progress to.
          */
-        auto load_log_file_async(const QString& file_path, qsizetype batch_size = 1000) -> void;
+        auto load_log_file_async(const QString& file_path, qsizetype batch_size = 1000,
+                                 const TaskToken& token = TaskToken()) -> void;
 
         /**
          * @brief Requests cancellation of the current asynchronous load (if any).
@@ -86,13 +95,61 @@ class LogLoader: public QObject
          */
         auto cancel_async() -> void;
 
+        /**
+         * @brief Sets the length above which streamed lines are truncated.
+         * @param max_line_bytes The limit in bytes; values <= 0 restore the default.
+         */
+        auto set_max_line_length(qsizetype max_line_bytes) -> void;
+
+        /**
+         * @brief Returns the length above which streamed lines are truncated.
+         * @return The limit in bytes.
+         */
+        [[nodiscard]] auto get_max_line_length() const -> qsizetype;
+
+        /**
+         * @brief Sets the filter streamed batches are evaluated against.
+         *
+         * Applies to the running stream from its next batch on, and to later streams.
+         *
+         * @param spec The filter settings of the target view.
+         */
+        auto set_filter(const LogFilter::Spec& spec) -> void;
+
+        /**
+         * @brief Returns the filter streamed batches are evaluated against.
+         * @return The filter settings.
+         */
+        [[nodiscard]] auto get_filter() const -> LogFilter::Spec;
+
+        /**
+         * @brief Adds user-defined formats to the format detection library.
+         * @param formats Format strings (e.g. "{timestamp} [{thread}] {level} {message}").
+         */
+        auto add_log_formats(const QVector<QString>& formats) -> void;
+
+        /**
+         * @brief Returns the format detection library in preference order.
+         * @return List of format strings; the configured format comes first.
+         */
+        [[nodiscard]] auto get_log_formats() const -> QVector<QString>;
+
+        /**
+         * @brief Returns the format used for parsing the given file (detected and cached).
+         * @param file_path The path to the log file.
+         * @return The format string.
+         */
+        [[nodiscard]] auto detect_log_format(const QString& file_path) const -> QString;
+
     signals:
         /**
          * @brief Emitted when a batch of entries has been parsed during streaming.
          * @param file_path The corresponding file path.
          * @param batch The batch of parsed log entries.
+         * @param verdicts The batch's filter verdicts and facet counts.
          */
-        auto entry_batch_parsed(const QString& file_path, const QVector<LogEntry>& batch) -> void;
+        auto entry_batch_parsed(const QString& file_path, const QVector<LogEntry>& batch,
+                                const LogFilter::BatchVerdicts& verdicts) -> void;
 
         /**
          * @brief Emitted to report progress of the current streaming load.
@@ -121,8 +178,19 @@ class LogLoader: public QObject
          */
         auto streaming_idle() -> void;
 
+    private:
+        /**
+         * @brief Returns a parser for the format detected for the given file.
+         * @param file_path The path to the log file.
+         * @return The parser (the configured parser if the primary format was detected).
+         */
+        [[nodiscard]] auto parser_for_file(const QString& file_path) const -> LogParser;
+
     private:
         LogParser m_parser;
+        LogFormatDetector m_format_detector;
         LogStreamWorker* m_worker = nullptr;
         QThread* m_worker_thread = nullptr;
+        qsizetype m_max_line_length = LogLineReader::k_default_max_line_length;
+        LogFilter::Spec m_filter;
 };
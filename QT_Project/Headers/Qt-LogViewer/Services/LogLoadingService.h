@@ -12,7 +12,9 @@
  */
 
 #include "Qt-LogViewer/Models/LogEntry.h"
+#include "Qt-LogViewer/Models/LogFilter.h"
 #include "Qt-LogViewer/Services/LogLoader.h"
+#include "Qt-LogViewer/Services/TaskToken.h"
 
 /**
  * @class LogLoadingService
@@ -47,7 +49,8 @@ class LogLoadingService final: public QObject
         explicit LogLoadingService(const QString& log_format, QObject* parent = nullptr);
 
         /**
-         * @brief Destructor. Ensures any ongoing async operation is cancelled.
+         * @brief Destructor. Ensures any ongoing async operation is cancelled; the loader joins
+         *        its worker thread.
          */
         ~LogLoadingService() override;
 
@@ -72,8 +75,10 @@ class LogLoadingService final: public QObject
          *        Performs pre-flight validation, initializes retry state and instrumentation.
          * @param file_path Absolute file path to the log file.
          * @param batch_size Number of entries per emitted batch.
+         * @param token Token used for cancellation and progress (also by retries).
          */
-        auto load_log_file_async(const QString& file_path, qsizetype batch_size = 1000) -> void;
+        auto load_log_file_async(const QString& file_path, qsizetype batch_size = 1000,
+                                 const TaskToken& token = TaskToken()) -> void;
 
         /**
          * @brief Cancels any ongoing asynchronous streaming operation.
@@ -104,13 +109,57 @@ class LogLoadingService final: public QObject
          */
         [[nodiscard]] auto get_retry_delay_ms() const -> int;
 
+        /**
+         * @brief Sets the length above which streamed lines are truncated.
+         *
+         * Longer lines keep a prefix of this size plus a reference to the full line on disk.
+         *
+         * @param max_line_bytes The limit in bytes; values <= 0 restore the default.
+         */
+        auto set_max_line_length(qsizetype max_line_bytes) -> void;
+
+        /**
+         * @brief Returns the length above which streamed lines are truncated.
+         * @return The limit in bytes.
+         */
+        [[nodiscard]] auto get_max_line_length() const -> qsizetype;
+
+        /**
+         * @brief Sets the filter streamed batches are evaluated against.
+         *
+         * Applies to the running stream from its next batch on, and to later streams.
+         *
+         * @param spec The filter settings of the target view.
+         */
+        auto set_filter(const LogFilter::Spec& spec) -> void;
+
+        /**
+         * @brief Returns the filter streamed batches are evaluated against.
+         * @return The filter settings.
+         */
+        [[nodiscard]] auto get_filter() const -> LogFilter::Spec;
+
+        /**
+         * @brief Adds user-defined formats to the loader's format detection library.
+         * @param formats Format strings (e.g. "{timestamp} [{thread}] {level} {message}").
+         */
+        auto add_log_formats(const QVector<QString>& formats) -> void;
+
+        /**
+         * @brief Returns the loader's format detection library.
+         * @return List of format strings; the configured format comes first.
+         */
+        [[nodiscard]] auto get_log_formats() const -> QVector<QString>;
+
     signals:
         /**
          * @brief Emitted when a batch of entries is parsed during streaming.
          * @param file_path File being streamed.
          * @param batch Parsed entries batch.
+         * @param verdicts The batch's filter verdicts and facet counts.
          */
-        void entry_batch_parsed(const QString& file_path, const QVector<LogEntry>& batch);
+        void entry_batch_parsed(const QString& file_path, const QVector<LogEntry>& batch,
+                                const LogFilter::BatchVerdicts& verdicts);
 
         /**
          * @brief Emitted to report streaming progress.
@@ -169,12 +218,6 @@ class LogLoadingService final: public QObject
          */
         auto reset_retry_state(const QString& file_path) -> void;
 
-        /**
-         * @brief Blocks the caller until the streaming worker is idle or timeout occurs.
-         * @param timeout_ms Maximum time to wait (ms).
-         */
-        auto wait_until_idle(int timeout_ms) -> void;
-
     private:
         LogLoader m_loader;
 
@@ -186,6 +229,7 @@ class LogLoadingService final: public QObject
         QString m_last_stream_file;
         int m_retry_count{0};
         qsizetype m_last_batch_size{1000};
+        TaskToken m_last_token;
 
         // Instrumentation
         QElapsedTimer m_timer;
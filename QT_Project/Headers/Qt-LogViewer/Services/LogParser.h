@@ -1,8 +1,10 @@
 #pragma once
 
+#include <QByteArrayView>
 #include <QPair>
 #include <QRegularExpression>
 #include <QString>
+#include <QVariant>
 #include <QVector>
 
 #include "Qt-LogViewer/Models/LogEntry.h"
@@ -26,6 +28,11 @@ struct LogFieldOrder {
  *
  * This class provides methods to parse log files or log lines and convert them
  * into LogEntry objects for use in the LogModel. The log format is defined by a format string.
+ *
+ * Placeholders other than timestamp, level, message and app_name (e.g. thread, logger, pid,
+ * line) are kept as typed extra fields: integral values become qlonglong, everything else a
+ * QString. Parsing keeps no state, so one parser may be shared by threads; repeated string
+ * values are pooled per file by LogEntryAssembler.
  */
 class LogParser
 {
@@ -43,6 +50,10 @@ class LogParser
 
         /**
          * @brief Parses a log file and returns a list of LogEntry objects.
+         *
+         * Lines that do not match the format (e.g. stack trace lines) are appended to the
+         * message of the preceding entry, see LogEntryAssembler.
+         *
          * @param file_path The path to the log file.
          * @return A QVector of LogEntry objects parsed from the file.
          */
@@ -57,6 +68,21 @@ class LogParser
         [[nodiscard]] auto parse_line(const QString& line,
                                       const QString& file_path) const -> LogEntry;
 
+        /**
+         * @brief Parses a single log line, taking the message from the line's UTF-8 bytes.
+         *
+         * For an ASCII line the UTF-16 offsets of the match are byte offsets, so the message is
+         * copied from the bytes instead of being encoded to UTF-8 again. Other lines fall back
+         * to encoding the captured message.
+         *
+         * @param line The log line to parse.
+         * @param line_utf8 The bytes the line was decoded from (see LogLineReader), or empty.
+         * @param file_path The originating file path for contextual metadata.
+         * @return The parsed LogEntry, or a default LogEntry if parsing fails.
+         */
+        [[nodiscard]] auto parse_line(const QString& line, QByteArrayView line_utf8,
+                                      const QString& file_path) const -> LogEntry;
+
         /**
          * @brief Returns the regular expression pattern used for parsing.
          * @return The QRegularExpression pattern.
@@ -98,6 +124,13 @@ class LogParser
          */
         [[nodiscard]] auto parse_timestamp(const QString& value) const -> QDateTime;
 
+        /**
+         * @brief Converts a captured extra placeholder value into a typed value.
+         * @param value The captured text.
+         * @return qlonglong if the value is integral, otherwise the trimmed QString.
+         */
+        [[nodiscard]] static auto to_extra_value(const QString& value) -> QVariant;
+
     private:
         QRegularExpression m_pattern;
         LogFieldOrder m_field_order;
@@ -1,12 +1,15 @@
 #pragma once
 
+#include <QMutex>
 #include <QObject>
 #include <QString>
 #include <QVector>
-#include <atomic>
 
 #include "Qt-LogViewer/Models/LogEntry.h"
+#include "Qt-LogViewer/Models/LogFilter.h"
+#include "Qt-LogViewer/Services/LogLineReader.h"
 #include "Qt-LogViewer/Services/LogParser.h"
+#include "Qt-LogViewer/Services/TaskToken.h"
 
 /**
  * @file LogStreamWorker.h
@@ -23,7 +26,25 @@
  *  - finished()
  *  - error()
  *
- * Cancellation is cooperative: the current line finishes before exiting.
+ * Lines that do not match the format are appended to the preceding entry (multi-line
+ * entries such as stack traces); an entry is only emitted once the next entry starts or the
+ * input ends, so entries never straddle two batches.
+ *
+ * Cancellation is cooperative through a TaskToken, checked before every line: the current line
+ * finishes before exiting. The bytes read are reported to the token as progress.
+ *
+ * The file is read through a ReadAheadFile, so the next buffers are read from disk while this
+ * thread parses; its stall counters are logged when the file is done.
+ *
+ * Lines longer than the max line length are parsed from their prefix only; the resulting entry
+ * records the full line's offset and length (LogEntry::get_source_offset()) instead.
+ *
+ * Each batch is evaluated against the target view's filter (set_filter(), may change while
+ * streaming) so the GUI thread can take the accept bits instead of filtering the rows itself.
+ * Likewise, the entries' dedupe keys (LogDedupeSet::get_key()) are hashed here, leaving a single
+ * set probe per row to views that drop duplicates across files. If the filter settings carry a
+ * baseline, the entries are tagged as novel or not (LogBaseline::tag_entries()) before they are
+ * evaluated.
  */
 class LogStreamWorker: public QObject
 {
@@ -33,9 +54,26 @@ class LogStreamWorker: public QObject
         /**
          * @brief Constructs a LogStreamWorker.
          * @param parser Parser instance (copied) used for line parsing.
+         * @param token Token to check for cancellation and to report progress to.
          * @param parent Optional QObject parent.
          */
-        explicit LogStreamWorker(LogParser parser, QObject* parent = nullptr);
+        explicit LogStreamWorker(LogParser parser, TaskToken token = TaskToken(),
+                                 QObject* parent = nullptr);
+
+        /**
+         * @brief Sets the length above which lines are truncated; call before start().
+         * @param max_line_bytes The limit in bytes; values <= 0 restore the default.
+         */
+        auto set_max_line_length(qsizetype max_line_bytes) -> void;
+
+        /**
+         * @brief Sets the filter batches are evaluated against, starting with the next batch.
+         *
+         * Thread-safe; may be called while streaming.
+         *
+         * @param spec The filter settings of the target view.
+         */
+        auto set_filter(const LogFilter::Spec& spec) -> void;
 
     public slots:
         /**
@@ -48,7 +86,7 @@ class LogStreamWorker: public QObject
         /**
          * @brief Requests cancellation of the ongoing operation.
          *
-         * Can be called from any thread. Sets an atomic flag that is checked between
+         * Can be called from any thread. Cancels the worker's token, which is checked between
          * line reads. Does not forcefully terminate I/O but stops after the current
          * line/token is processed.
          */
@@ -59,8 +97,10 @@ class LogStreamWorker: public QObject
          * @brief Emitted when a batch of entries has been parsed.
          * @param file_path The corresponding file path.
          * @param batch Parsed entries.
+         * @param verdicts The batch's filter verdicts and facet counts.
          */
-        auto entry_batch_parsed(const QString& file_path, const QVector<LogEntry>& batch) -> void;
+        auto entry_batch_parsed(const QString& file_path, const QVector<LogEntry>& batch,
+                                const LogFilter::BatchVerdicts& verdicts) -> void;
 
         /**
          * @brief Emitted to report progress.
@@ -83,7 +123,22 @@ class LogStreamWorker: public QObject
          */
         auto error(const QString& file_path, const QString& message) -> void;
 
+    private:
+        /**
+         * @brief Tags and evaluates a batch with the current filter, computes its dedupe keys
+         *        and emits it.
+         * @param file_path The file being read.
+         * @param batch The batch; its entries get their novelty tags.
+         * @param filter The worker's compiled filter, recompiled if the spec changed.
+         */
+        auto emit_batch(const QString& file_path, QVector<LogEntry>& batch, LogFilter& filter)
+            -> void;
+
     private:
         LogParser m_parser;
-        std::atomic_bool m_cancelled{false};
+        TaskToken m_token;
+        qsizetype m_max_line_length = LogLineReader::k_default_max_line_length;
+        QMutex m_filter_mutex;
+        LogFilter::Spec m_filter_spec;
+        bool m_filter_changed = false;
 };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QString>
+#include <QStringList>
 
 #include "Qt-LogViewer/Services/Settings.h"
 #include "QtWidgetsCommonLib/Services/Preferences/IUiPreferences.h"
@@ -94,6 +95,42 @@ class LogViewerSettings: public Settings, public QtWidgetsCommonLib::IUiPreferen
          */
         auto set_mainwindow_windowstate(int state) -> void override;
 
+        /**
+         * @brief Returns the user-defined log formats used for format detection.
+         * @return List of format strings (e.g. "{timestamp} [{thread}] {level} {message}").
+         */
+        [[nodiscard]] auto get_custom_log_formats() -> QStringList;
+
+        /**
+         * @brief Sets the user-defined log formats used for format detection.
+         * @param formats List of format strings.
+         */
+        auto set_custom_log_formats(const QStringList& formats) -> void;
+
+        /**
+         * @brief Returns the length above which log lines are truncated while parsing.
+         * @return The limit in bytes, or 0 for the built-in default.
+         */
+        [[nodiscard]] auto get_max_line_length() -> qsizetype;
+
+        /**
+         * @brief Sets the length above which log lines are truncated while parsing.
+         * @param max_line_bytes The limit in bytes, or 0 for the built-in default.
+         */
+        auto set_max_line_length(qsizetype max_line_bytes) -> void;
+
+        /**
+         * @brief Returns whether lines repeated across the files of a view are skipped.
+         * @return True if duplicates across files are dropped while loading.
+         */
+        [[nodiscard]] auto get_dedupe_overlapping_files() -> bool;
+
+        /**
+         * @brief Sets whether lines repeated across the files of a view are skipped.
+         * @param enabled True to drop duplicates across files while loading.
+         */
+        auto set_dedupe_overlapping_files(bool enabled) -> void;
+
     signals:
         /**
          * @brief Emitted when the language is changed.
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <QByteArray>
+#include <QFile>
+#include <QIODevice>
+#include <QMutex>
+#include <QQueue>
+#include <QString>
+#include <QVector>
+#include <QWaitCondition>
+
+class QThread;
+
+/**
+ * @file ReadAheadFile.h
+ * @brief This file contains the definition of the ReadAheadFile class.
+ */
+
+/**
+ * @class ReadAheadFile
+ * @brief Sequential read-only file device whose reads are done ahead by a dedicated thread.
+ *
+ * A reader thread fills a fixed pool of large buffers from the file while the consumer parses
+ * the previous ones, so disk and CPU work overlap instead of alternating. The pool bounds the
+ * memory and provides the backpressure: the reader waits when every buffer is filled, the
+ * consumer waits when none is. Both waits are counted (see get_stats()), which tells whether a
+ * load was limited by storage or by parsing.
+ *
+ * The file is announced as read sequentially to the OS (posix_fadvise on Linux, F_RDAHEAD on
+ * macOS), which enlarges the kernel read-ahead window on HDDs and network file systems.
+ *
+ * The device is sequential: pos() counts the bytes read by the consumer and size() is unknown,
+ * use get_file_size() for progress. read() blocks until data is available or the file ends.
+ */
+class ReadAheadFile: public QIODevice
+{
+        Q_OBJECT
+
+    public:
+        /**
+         * @struct Stats
+         * @brief Stall counters of both pipeline stages.
+         */
+        struct Stats {
+                qint64 bytes_read = 0;
+                qint64 reader_stalls = 0;
+                qint64 reader_stall_ns = 0;
+                qint64 consumer_stalls = 0;
+                qint64 consumer_stall_ns = 0;
+        };
+
+        /**
+         * @brief Constructs a ReadAheadFile.
+         * @param file_path The file to read.
+         * @param buffer_count Number of buffers in the pool (at least 2).
+         * @param buffer_size Size of each buffer in bytes.
+         * @param parent Optional QObject parent.
+         */
+        explicit ReadAheadFile(QString file_path, int buffer_count = 4,
+                               qsizetype buffer_size = 1024 * 1024, QObject* parent = nullptr);
+
+        /**
+         * @brief Stops the reader thread and closes the file.
+         */
+        ~ReadAheadFile() override;
+
+        /**
+         * @brief Opens the file and starts the reader thread.
+         * @param mode Must be QIODevice::ReadOnly (optionally with Unbuffered).
+         * @return True if the file could be opened.
+         */
+        auto open(QIODevice::OpenMode mode) -> bool override;
+
+        /**
+         * @brief Stops the reader thread and closes the file.
+         */
+        auto close() -> void override;
+
+        /**
+         * @brief Returns true: positions are not seekable.
+         * @return Always true.
+         */
+        [[nodiscard]] auto isSequential() const -> bool override;
+
+        /**
+         * @brief Checks whether all bytes of the file have been consumed.
+         *
+         * Unlike bytesAvailable() == 0, this waits for the reader thread if it has not yet
+         * read the next buffer.
+         *
+         * @return True at the end of the file.
+         */
+        [[nodiscard]] auto atEnd() const -> bool override;
+
+        /**
+         * @brief Returns the bytes that can be read without waiting for the reader thread.
+         * @return The number of bytes.
+         */
+        [[nodiscard]] auto bytesAvailable() const -> qint64 override;
+
+        /**
+         * @brief Returns the number of bytes read by the user of the device.
+         * @return The position in the file.
+         */
+        [[nodiscard]] auto pos() const -> qint64 override;
+
+        /**
+         * @brief Returns the size of the file when it was opened.
+         * @return The size in bytes.
+         */
+        [[nodiscard]] auto get_file_size() const -> qint64;
+
+        /**
+         * @brief Returns the stall counters of the reader and the consumer.
+         * @return A consistent copy of the counters.
+         */
+        [[nodiscard]] auto get_stats() const -> Stats;
+
+    protected:
+        /**
+         * @brief Copies data from the filled buffers, waiting for the reader if none is filled.
+         * @param data Destination.
+         * @param max_size Maximum number of bytes to copy.
+         * @return The number of bytes copied, 0 at the end of the file, -1 on a read error.
+         */
+        auto readData(char* data, qint64 max_size) -> qint64 override;
+
+        /**
+         * @brief Rejects writes; the device is read-only.
+         * @return Always -1.
+         */
+        auto writeData(const char* data, qint64 max_size) -> qint64 override;
+
+    private:
+        /**
+         * @brief Reader thread: fills free buffers until the file ends or stop is requested.
+         */
+        auto run_reader() -> void;
+
+        /**
+         * @brief Returns the current buffer to the pool and takes the next filled one.
+         * @return False at the end of the file or on a read error.
+         */
+        auto acquire_next_buffer() -> bool;
+
+        /**
+         * @brief Waits until a filled buffer is queued or the reader is done; m_mutex is held.
+         * @return True if a filled buffer is queued.
+         */
+        auto wait_for_filled_buffer() const -> bool;
+
+        /**
+         * @brief Stops and joins the reader thread.
+         */
+        auto stop_reader() -> void;
+
+    private:
+        /**
+         * @struct FilledBuffer
+         * @brief A pool buffer with the number of valid bytes in it.
+         */
+        struct FilledBuffer {
+                int index = -1;
+                qsizetype size = 0;
+        };
+
+        QFile m_file;
+        int m_buffer_count;
+        qsizetype m_buffer_size;
+        qint64 m_file_size = 0;
+        QVector<QByteArray> m_buffers;
+        QThread* m_reader{nullptr};
+
+        // Shared between the reader thread and the consumer; guarded by m_mutex.
+        mutable QMutex m_mutex;
+        mutable QWaitCondition m_buffer_filled;
+        QWaitCondition m_buffer_freed;
+        QVector<int> m_free_buffers;
+        QQueue<FilledBuffer> m_filled_buffers;
+        bool m_reader_done = false;
+        bool m_read_failed = false;
+        bool m_stop_requested = false;
+        QString m_read_error;
+        mutable Stats m_stats;
+
+        // Consumer state; only touched by the consuming thread.
+        FilledBuffer m_current;
+        qsizetype m_current_pos = 0;
+        qint64 m_bytes_consumed = 0;
+};
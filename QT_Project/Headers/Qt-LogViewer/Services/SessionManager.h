@@ -1,13 +1,19 @@
 #pragma once
 
+#include <QHash>
 #include <QJsonObject>
 #include <QObject>
+#include <QSet>
 #include <QVector>
+#include <memory>
 
 #include "Qt-LogViewer/Models/LogFileInfo.h"
 #include "Qt-LogViewer/Models/SessionTypes.h"
 
 // Forward declarations for types used as pointers/references
+class QThread;
+class QTimer;
+class SessionPersistenceWorker;
 class SessionRepository;
 
 /**
@@ -25,6 +31,18 @@ class SessionRepository;
  * - RecentSessionRecord: { id, name, created_at, last_opened }
  *
  * Persistence is handled via SessionRepository under AppConfigLocation.
+ *
+ * The in-memory state is the source of truth: sessions are cached after the first load, and
+ * changes only mark the root document or a session as dirty. Dirty documents are written
+ * after a short debounce delay by a SessionPersistenceWorker on a background thread, so
+ * bursts of changes (e.g. opening many files) result in a single write and saving never
+ * blocks the UI. Every session change is also appended to the session's journal right away
+ * for crash recovery. Call flush() to force all pending writes to disk (e.g. on shutdown).
+ *
+ * At application start the root document can be read on the writer thread instead
+ * (initialize_from_storage_async()), so the first frame does not wait for the disk. Until it
+ * arrives the recent lists are empty; a change made before that reads the root synchronously
+ * first, so it is applied on top of the stored state.
  */
 class SessionManager: public QObject
 {
@@ -33,10 +51,16 @@ class SessionManager: public QObject
     public:
         /**
          * @brief Constructs a SessionManager with a given repository and optional parent.
-         * @param repository Persistence repository (owned by this manager).
+         * @param repository Persistence repository; must not have a QObject parent.
          * @param parent Optional QObject parent.
          */
-        explicit SessionManager(SessionRepository* repository, QObject* parent = nullptr);
+        explicit SessionManager(std::unique_ptr<SessionRepository> repository,
+                                QObject* parent = nullptr);
+
+        /**
+         * @brief Flushes pending writes and stops the writer thread.
+         */
+        ~SessionManager() override;
 
         /**
          * @brief Loads state from repository into memory (recent files and sessions).
@@ -45,14 +69,32 @@ class SessionManager: public QObject
          */
         auto initialize_from_storage() -> void;
 
+        /**
+         * @brief Loads recent files and sessions on the writer thread.
+         *
+         * The recent_*_changed() signals and storage_loaded() are emitted on the owner's thread
+         * once the root document has been read. The current session id and cached sessions
+         * are kept.
+         */
+        auto initialize_from_storage_async() -> void;
+
+        /**
+         * @brief Checks whether the stored recent lists have been applied.
+         * @return False while an asynchronous load is pending.
+         */
+        [[nodiscard]] auto is_storage_loaded() const -> bool;
+
         /**
          * @brief Returns the list of recent log files.
+         *
+         * Waits for a pending asynchronous load, so the stored items are never missed.
+         *
          * @return Vector of RecentLogFileRecord.
          */
-        [[nodiscard]] auto get_recent_log_files() const -> QVector<RecentLogFileRecord>;
+        [[nodiscard]] auto get_recent_log_files() -> QVector<RecentLogFileRecord>;
 
         /**
-         * @brief Adds/updates a recent log file record and persists the root document.
+         * @brief Adds/updates a recent log file record and schedules a root write.
          * @param file_info LogFileInfo from which file_path and app_name are derived.
          *
          * Behavior:
@@ -63,18 +105,21 @@ class SessionManager: public QObject
         auto add_recent_log_file(const LogFileInfo& file_info) -> void;
 
         /**
-         * @brief Clears the recent log files list and persists the change.
+         * @brief Clears the recent log files list and schedules a root write.
          */
         auto clear_recent_log_files() -> void;
 
         /**
          * @brief Returns the list of recent sessions metadata.
+         *
+         * Waits for a pending asynchronous load, so the stored items are never missed.
+         *
          * @return Vector of RecentSessionRecord.
          */
-        [[nodiscard]] auto get_recent_sessions() const -> QVector<RecentSessionRecord>;
+        [[nodiscard]] auto get_recent_sessions() -> QVector<RecentSessionRecord>;
 
         /**
-         * @brief Saves or updates a session metadata entry and persists the root document.
+         * @brief Saves or updates a session metadata entry and schedules a root write.
          * @param session_id Unique identifier of the session.
          * @param name Human-readable session name.
          * @param is_open_update If true, updates last_opened; if false, ensures created_at exists.
@@ -83,31 +128,71 @@ class SessionManager: public QObject
          * - If the session id exists, update its name and timestamps accordingly.
          * - If not, create a new record with timestamps.
          * - Most recent sessions appear first.
+         * - Nothing is written or emitted if the record does not change.
          */
         auto upsert_session_metadata(const QString& session_id, const QString& name,
                                      bool is_open_update) -> void;
 
         /**
-         * @brief Deletes a session JSON file and removes its metadata entry, then persists root.
+         * @brief Deletes a session JSON file and removes its metadata entry, then schedules a root
+         *        write.
+         *
+         * Waits for queued writes of the session to complete first, so a pending snapshot
+         * cannot recreate the file afterwards.
          * @param session_id The session identifier.
          * @return True if file existed and metadata entry was removed; false otherwise.
          */
         [[nodiscard]] auto delete_session(const QString& session_id) -> bool;
 
         /**
-         * @brief Loads a full session JSON object from repository.
+         * @brief Returns a session JSON object, from memory or (first time) from repository.
          * @param session_id The session identifier.
          * @return QJsonObject representing the session, or empty object if not found.
          */
         [[nodiscard]] auto load_session(const QString& session_id) const -> QJsonObject;
 
         /**
-         * @brief Saves a full session JSON object under its id (atomic write).
+         * @brief Updates a session JSON object in memory and schedules its write.
          * @param session_id The session identifier.
          * @param session_obj The JSON object to persist.
+         *
+         * If the object equals the in-memory state, the session is not marked dirty. Otherwise
+         * the change (the delta to the in-memory state) is journaled immediately and the new
+         * state is written as snapshot after the debounce delay, both on the writer thread.
          */
         auto save_session(const QString& session_id, const QJsonObject& session_obj) -> void;
 
+        /**
+         * @brief Returns the name of a session without touching the file system.
+         * @param session_id The session identifier.
+         * @return The name from the session metadata or the cached session, or empty if unknown.
+         */
+        [[nodiscard]] auto get_session_name(const QString& session_id) const -> QString;
+
+        /**
+         * @brief Checks whether a session has changes that are not written yet.
+         * @param session_id The session identifier.
+         * @return True if the session is dirty.
+         */
+        [[nodiscard]] auto is_session_dirty(const QString& session_id) const -> bool;
+
+        /**
+         * @brief Checks whether any document (root or session) is waiting to be written.
+         * @return True if writes are pending.
+         */
+        [[nodiscard]] auto has_pending_writes() const -> bool;
+
+        /**
+         * @brief Sets the debounce delay for writes.
+         * @param delay_ms Delay in milliseconds after the last change (0 = next event loop turn).
+         */
+        auto set_flush_delay(int delay_ms) -> void;
+
+        /**
+         * @brief Writes all dirty documents and blocks until the writer thread is idle.
+         */
+        auto flush() -> void;
+
         /**
          * @brief Returns the current session id in use (in-memory only).
          *
@@ -136,12 +221,15 @@ class SessionManager: public QObject
 
         /**
          * @brief Returns the last session id stored in the root document (optional).
+         *
+         * Waits for a pending asynchronous load, so the stored id is never missed.
+         *
          * @return Last session id or empty string if not set.
          */
-        [[nodiscard]] auto get_last_session_id() const -> QString;
+        [[nodiscard]] auto get_last_session_id() -> QString;
 
         /**
-         * @brief Sets the last session id in the root document and persists the change.
+         * @brief Sets the last session id in the root document and schedules a root write.
          * @param session_id The session identifier to store.
          */
         auto set_last_session_id(const QString& session_id) -> void;
@@ -159,6 +247,11 @@ class SessionManager: public QObject
          */
         void recent_sessions_changed(const QVector<RecentSessionRecord>& items);
 
+        /**
+         * @brief Emitted when the stored recent lists have been applied.
+         */
+        void storage_loaded();
+
     private:
         /**
          * @brief Converts a RecentLogFileRecord to JSON.
@@ -197,10 +290,19 @@ class SessionManager: public QObject
         [[nodiscard]] auto make_root_from_current() const -> QJsonObject;
 
         /**
-         * @brief Persists the root JSON document using repository (atomic write).
-         * @param root Root object to save.
+         * @brief Marks the root document dirty and (re)starts the debounce timer.
+         */
+        auto mark_root_dirty() -> void;
+
+        /**
+         * @brief Hands all dirty documents to the writer thread without waiting.
+         */
+        auto write_pending() -> void;
+
+        /**
+         * @brief Blocks until the writer thread has processed all queued requests.
          */
-        auto persist_root(const QJsonObject& root) -> void;
+        auto wait_for_writer() const -> void;
 
         /**
          * @brief Loads the root JSON document using repository; ensures defaults.
@@ -208,6 +310,27 @@ class SessionManager: public QObject
          */
         auto load_root() const -> QJsonObject;
 
+        /**
+         * @brief Replaces the recent lists and the last session id with those of a root document.
+         * @param root The root JSON object.
+         */
+        auto apply_root(const QJsonObject& root) -> void;
+
+        /**
+         * @brief Applies a root document read by initialize_from_storage_async().
+         * @param root The root JSON object.
+         * @param generation The load generation the document was requested with.
+         */
+        auto handle_root_loaded(const QJsonObject& root, int generation) -> void;
+
+        /**
+         * @brief Reads the root synchronously if an asynchronous load is still pending.
+         *
+         * Called before every read or change of the root document, so nothing is read from,
+         * applied to (and later overwritten by, or written over) the empty initial state.
+         */
+        auto ensure_storage_loaded() -> void;
+
         /**
          * @brief Sort recent files by last_opened descending, then by file_name ascending as
          * tiebreaker.
@@ -239,9 +362,17 @@ class SessionManager: public QObject
         auto upsert_recent_file(const RecentLogFileRecord& rec) -> void;
 
     private:
-        SessionRepository* m_repository{nullptr};
+        std::unique_ptr<SessionRepository> m_repository;
         QVector<RecentLogFileRecord> m_recent_files;
         QVector<RecentSessionRecord> m_recent_sessions;
         QString m_last_session_id;
         QString m_current_session_id;
+        mutable QHash<QString, QJsonObject> m_session_cache;
+        QSet<QString> m_dirty_session_ids;
+        bool m_root_dirty{false};
+        bool m_storage_loading{false};
+        int m_load_generation = 0;
+        QTimer* m_flush_timer{nullptr};
+        QThread* m_writer_thread{nullptr};
+        SessionPersistenceWorker* m_writer{nullptr};
 };
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <QJsonObject>
+#include <QObject>
+#include <QString>
+
+class SessionRepository;
+
+/**
+ * @file SessionPersistenceWorker.h
+ * @brief Worker object that writes session documents on a background thread.
+ */
+
+/**
+ * @class SessionPersistenceWorker
+ * @brief Serializes and writes root/session documents and journal lines off the GUI thread.
+ *
+ * The worker lives in a QThread owned by SessionManager. Requests are queued to it in call
+ * order, so a journal line is always written before the snapshot that supersedes it. The
+ * repository is only used for its (thread-safe) file operations and is not owned.
+ */
+class SessionPersistenceWorker: public QObject
+{
+        Q_OBJECT
+
+    public:
+        /**
+         * @brief Constructs a SessionPersistenceWorker.
+         * @param repository Repository performing the actual file operations (not owned).
+         * @param parent Optional QObject parent.
+         */
+        explicit SessionPersistenceWorker(const SessionRepository* repository,
+                                          QObject* parent = nullptr);
+
+    public slots:
+        /**
+         * @brief Writes the root document (recent files, recent sessions, last session id).
+         * @param root The root JSON object.
+         */
+        auto write_root(const QJsonObject& root) -> void;
+
+        /**
+         * @brief Writes a session snapshot and drops its journal.
+         * @param session_id The session identifier.
+         * @param session_obj The session JSON object.
+         */
+        auto write_session(const QString& session_id, const QJsonObject& session_obj) -> void;
+
+        /**
+         * @brief Appends a full session state to the session journal.
+         * @param session_id The session identifier.
+         * @param session_obj The session JSON object.
+         */
+        auto append_journal(const QString& session_id, const QJsonObject& session_obj) -> void;
+
+        /**
+         * @brief Appends the change between two session states to the session journal.
+         *
+         * The delta is computed here, so diffing large documents stays off the GUI thread.
+         *
+         * @param session_id The session identifier.
+         * @param previous The previously journaled (or stored) state.
+         * @param current The new state.
+         */
+        auto append_journal_delta(const QString& session_id, const QJsonObject& previous,
+                                  const QJsonObject& current) -> void;
+
+    signals:
+        /**
+         * @brief Emitted after a session snapshot has been written.
+         * @param session_id The session identifier.
+         */
+        void session_written(const QString& session_id);
+
+        /**
+         * @brief Emitted after the root document has been written.
+         */
+        void root_written();
+
+    private:
+        const SessionRepository* m_repository{nullptr};
+};
@@ -13,6 +13,16 @@
  * - Uses QStandardPaths::AppConfigLocation/<app_config_subdir> as base directory.
  * - Root JSON: "<base>/sessions.json"
  * - Per-session JSONs: "<base>/sessions/<session_id>.json"
+ * - Per-session journals: "<base>/sessions/<session_id>.journal"
+ *
+ * Documents are written as compact JSON. The journal is an append-only file with one compact
+ * JSON line per change; it holds the changes that have not been written as a snapshot yet and
+ * is removed once the snapshot is committed. A line either holds a full session state or, in
+ * the common case, only the delta to the previous state (see make_session_delta()), so a small
+ * change does not rewrite the whole document. load_session() replays the complete lines on top
+ * of the snapshot, so a crash between a change and the next snapshot loses nothing.
+ *
+ * All methods only touch the file system and may be called from a background thread.
  *
  * Schema (v1):
  * {
@@ -84,11 +94,18 @@ class SessionRepository: public QObject
          */
         [[nodiscard]] auto get_session_file_path(const QString& session_id) const -> QString;
 
+        /**
+         * @brief Computes the absolute journal file path for a specific session id.
+         * @param session_id The session identifier.
+         * @return Absolute file path: "<base>/sessions/<id>.journal".
+         */
+        [[nodiscard]] auto get_session_journal_path(const QString& session_id) const -> QString;
+
         /**
          * @brief Loads a single session JSON document by id.
          * @param session_id The session identifier.
          * @return Parsed session JSON object, or an empty object if the file does not exist or is
-         * invalid.
+         * invalid. A newer journaled state takes precedence over the snapshot file.
          */
         [[nodiscard]] auto load_session(const QString& session_id) const -> QJsonObject;
 
@@ -97,12 +114,56 @@ class SessionRepository: public QObject
          * @param session_id The session identifier.
          * @param obj The session JSON object to write.
          *
-         * Ensures "schema_version" is written into the file if not provided.
+         * Ensures "schema_version" is written into the file if not provided. Removes the
+         * session journal once the snapshot has been committed.
          */
         auto save_session(const QString& session_id, const QJsonObject& obj) const -> void;
 
         /**
-         * @brief Deletes a stored session JSON file if present.
+         * @brief Appends a full session state to the session's journal (one compact line).
+         *
+         * Replaces everything recorded before it; used when the previous state is unknown.
+         *
+         * @param session_id The session identifier.
+         * @param obj The session JSON object to journal.
+         */
+        auto append_session_journal(const QString& session_id, const QJsonObject& obj) const
+            -> void;
+
+        /**
+         * @brief Appends the change between two session states to the session's journal.
+         * @param session_id The session identifier.
+         * @param previous The state the snapshot and the journal describe so far.
+         * @param current The new state.
+         */
+        auto append_session_journal_delta(const QString& session_id, const QJsonObject& previous,
+                                          const QJsonObject& current) const -> void;
+
+        /**
+         * @brief Computes the delta between two JSON objects.
+         *
+         * The delta holds "set" (new values by key), "unset" (removed keys) and "patch" (nested
+         * deltas by key). Objects, and arrays of unchanged size, are patched member by member
+         * (array members are keyed by their index); any other changed value is set as a whole.
+         *
+         * @param previous The old object.
+         * @param current The new object.
+         * @return The delta; empty if the objects are equal.
+         */
+        [[nodiscard]] static auto make_session_delta(const QJsonObject& previous,
+                                                     const QJsonObject& current) -> QJsonObject;
+
+        /**
+         * @brief Applies a delta computed by make_session_delta().
+         * @param base The object the delta was computed against.
+         * @param delta The delta.
+         * @return The changed object.
+         */
+        [[nodiscard]] static auto apply_session_delta(const QJsonObject& base,
+                                                      const QJsonObject& delta) -> QJsonObject;
+
+        /**
+         * @brief Deletes a stored session JSON file (and its journal) if present.
          * @param session_id The session identifier.
          * @return True if a file existed and was deleted; false otherwise.
          */
@@ -121,6 +182,24 @@ class SessionRepository: public QObject
          */
         [[nodiscard]] auto get_app_config_root() const -> QString;
 
+        /**
+         * @brief Replays the complete lines of a session journal on top of a state.
+         * @param session_id The session identifier.
+         * @param snapshot The state read from the snapshot file.
+         * @return The journaled session state, or the snapshot if there is no journal.
+         */
+        [[nodiscard]] auto load_session_journal(const QString& session_id,
+                                                const QJsonObject& snapshot) const
+            -> QJsonObject;
+
+        /**
+         * @brief Appends one line to a session journal.
+         * @param session_id The session identifier.
+         * @param line The JSON object written as line.
+         */
+        auto append_journal_line(const QString& session_id, const QJsonObject& line) const
+            -> void;
+
     private:
         QString m_app_config_subdir;
 };
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <QElapsedTimer>
+#include <QString>
+#include <QVector>
+
+/**
+ * @file StartupProfiler.h
+ * @brief This file contains the definition of the StartupProfiler class.
+ */
+
+/**
+ * @class StartupProfiler
+ * @brief Records named phases of the application start and the time to interactive.
+ *
+ * The profiler starts its clock on construction. Each call to mark() closes a phase: its
+ * duration is the time since the previous mark. finish_interactive() records the time to
+ * interactive (the point where the first frame is painted and the deferred startup work is
+ * done) once; marks after that are still recorded, e.g. for work that completes in the
+ * background. get_summary() formats all phases for the log.
+ */
+class StartupProfiler
+{
+    public:
+        /**
+         * @struct Phase
+         * @brief A completed startup phase.
+         */
+        struct Phase {
+                QString name;
+                qint64 duration_ns = 0;
+                qint64 end_ns = 0;
+        };
+
+        /**
+         * @brief Constructs a StartupProfiler and starts its clock.
+         */
+        StartupProfiler();
+
+        /**
+         * @brief Returns the time-to-interactive budget the start is measured against.
+         * @return The target in milliseconds.
+         */
+        [[nodiscard]] static auto get_time_to_interactive_target_ms() -> qint64;
+
+        /**
+         * @brief Closes the current phase.
+         * @param phase_name The name of the phase that just finished.
+         */
+        auto mark(const QString& phase_name) -> void;
+
+        /**
+         * @brief Records the time to interactive; only the first call has an effect.
+         */
+        auto finish_interactive() -> void;
+
+        /**
+         * @brief Checks whether the time to interactive has been recorded.
+         * @return True after finish_interactive() was called.
+         */
+        [[nodiscard]] auto is_interactive() const -> bool;
+
+        /**
+         * @brief Returns the recorded time to interactive.
+         * @return The time in milliseconds, or -1 if not recorded yet.
+         */
+        [[nodiscard]] auto get_time_to_interactive_ms() const -> qint64;
+
+        /**
+         * @brief Checks whether the recorded time to interactive is within the target.
+         * @return True if recorded and not above get_time_to_interactive_target_ms().
+         */
+        [[nodiscard]] auto is_within_target() const -> bool;
+
+        /**
+         * @brief Returns the completed phases in the order they were marked.
+         * @return The phases.
+         */
+        [[nodiscard]] auto get_phases() const -> QVector<Phase>;
+
+        /**
+         * @brief Returns the time since the profiler was constructed.
+         * @return The elapsed time in nanoseconds.
+         */
+        [[nodiscard]] auto get_elapsed_ns() const -> qint64;
+
+        /**
+         * @brief Formats the phases and the time to interactive as a single log line.
+         * @return The summary, e.g. "ui 12.3 ms, menu 1.0 ms | interactive after 40.2 ms".
+         */
+        [[nodiscard]] auto get_summary() const -> QString;
+
+    private:
+        QElapsedTimer m_timer;
+        QVector<Phase> m_phases;
+        qint64 m_last_mark_ns = 0;
+        qint64 m_time_to_interactive_ns = -1;
+};
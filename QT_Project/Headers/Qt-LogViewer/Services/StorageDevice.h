@@ -0,0 +1,48 @@
+#pragma once
+
+#include <QString>
+
+/**
+ * @file StorageDevice.h
+ * @brief This file contains the definition of the StorageDevice class.
+ */
+
+/**
+ * @class StorageDevice
+ * @brief Identifies the storage device a file lives on and how it behaves under parallel reads.
+ *
+ * Files with the same key share one device (the st_dev of stat() on Unix, the volume root
+ * elsewhere). A device is sequential if concurrent reads make it seek or queue behind each
+ * other: rotational disks (from /sys/block/.../queue/rotational on Linux) and network file
+ * systems. Everything else (SSDs, RAM disks) is treated as parallel.
+ */
+class StorageDevice
+{
+    public:
+        /**
+         * @struct Info
+         * @brief Description of a storage device.
+         */
+        struct Info {
+                quint64 key = 0;
+                QString name;
+                bool sequential = false;
+        };
+
+        /**
+         * @brief Determines the device of a file.
+         *
+         * A file that does not exist (yet) is attributed to the device of its directory.
+         *
+         * @param file_path The file.
+         * @return The device description.
+         */
+        [[nodiscard]] static auto probe(const QString& file_path) -> Info;
+
+        /**
+         * @brief Checks whether a file system type is a network file system.
+         * @param file_system_type The type as reported by QStorageInfo (e.g. "nfs4", "cifs").
+         * @return True for network file systems.
+         */
+        [[nodiscard]] static auto is_network_file_system(const QString& file_system_type) -> bool;
+};
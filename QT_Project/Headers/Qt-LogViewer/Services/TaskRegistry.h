@@ -0,0 +1,148 @@
+#pragma once
+
+#include <QObject>
+#include <QString>
+#include <QUuid>
+#include <QVector>
+
+#include "Qt-LogViewer/Services/TaskToken.h"
+
+class QTimer;
+
+/**
+ * @file TaskRegistry.h
+ * @brief This file contains the definition of the TaskRegistry class.
+ */
+
+/**
+ * @class TaskRegistry
+ * @brief Central list of running long operations (ingest, index builds, ...) and their progress.
+ *
+ * Subsystems register an operation with begin_task() and pass the returned token to whoever
+ * does the work; end_task() removes it again. Each task has an owner (usually a view id), so
+ * closing a tab cancels all work depending on it with one cancel_owner() call, and shutdown
+ * cancels everything with cancel_all(). Cancelling only sets the token's flag and returns
+ * immediately; workers stop at their next chunk boundary.
+ *
+ * Workers never call into the registry: they only write their token's progress counters, which
+ * the registry polls while tasks are running and reports through task_progress(). A task whose
+ * token is no longer held by anyone but the registry is ended on the next poll, so an owner that
+ * is destroyed mid-task (possibly after the registry) need not call into the registry from its
+ * destructor. The registry itself must be used from the GUI thread.
+ */
+class TaskRegistry: public QObject
+{
+        Q_OBJECT
+
+    public:
+        /**
+         * @struct TaskInfo
+         * @brief Describes a running task.
+         */
+        struct TaskInfo {
+                quint64 id = 0;
+                QString name;
+                QUuid owner;
+                qint64 done = 0;
+                qint64 total = 0;
+                bool cancelled = false;
+        };
+
+        /**
+         * @brief Constructs a TaskRegistry.
+         * @param parent Optional QObject parent.
+         */
+        explicit TaskRegistry(QObject* parent = nullptr);
+
+        /**
+         * @brief Registers a new task.
+         * @param name Human readable description (e.g. "Loading app.log").
+         * @param owner The object the task works for (e.g. a view id); may be null.
+         * @return The token to pass to the worker.
+         */
+        [[nodiscard]] auto begin_task(const QString& name, const QUuid& owner = QUuid())
+            -> TaskToken;
+
+        /**
+         * @brief Removes a finished or cancelled task; unknown tokens are ignored.
+         * @param token The token returned by begin_task().
+         */
+        auto end_task(const TaskToken& token) -> void;
+
+        /**
+         * @brief Cancels all tasks of an owner.
+         * @param owner The owner passed to begin_task().
+         * @return The number of cancelled tasks.
+         */
+        auto cancel_owner(const QUuid& owner) -> int;
+
+        /**
+         * @brief Cancels all tasks (e.g. on shutdown).
+         * @return The number of cancelled tasks.
+         */
+        auto cancel_all() -> int;
+
+        /**
+         * @brief Returns the running tasks in start order.
+         * @return The task descriptions.
+         */
+        [[nodiscard]] auto get_tasks() const -> QVector<TaskInfo>;
+
+        /**
+         * @brief Returns the number of running tasks.
+         * @return The task count.
+         */
+        [[nodiscard]] auto get_task_count() const -> int;
+
+        /**
+         * @brief Returns the interval in which task progress is polled.
+         * @return The interval in milliseconds.
+         */
+        [[nodiscard]] static auto get_poll_interval_ms() -> int;
+
+    signals:
+        /**
+         * @brief Emitted when a task was registered.
+         * @param id The task id.
+         * @param name The task description.
+         */
+        void task_started(quint64 id, const QString& name);
+
+        /**
+         * @brief Emitted when the reported progress of a task changed.
+         * @param id The task id.
+         * @param done Units processed so far.
+         * @param total Total units, or 0 if unknown.
+         */
+        void task_progress(quint64 id, qint64 done, qint64 total);
+
+        /**
+         * @brief Emitted when a task was removed.
+         * @param id The task id.
+         * @param cancelled True if the task had been cancelled.
+         */
+        void task_finished(quint64 id, bool cancelled);
+
+    private:
+        /**
+         * @brief Reports progress changes of all running tasks and ends abandoned ones.
+         */
+        auto poll_progress() -> void;
+
+    private:
+        /**
+         * @struct Task
+         * @brief A running task and its last reported progress.
+         */
+        struct Task {
+                TaskToken token;
+                QString name;
+                QUuid owner;
+                qint64 reported_done = -1;
+                qint64 reported_total = -1;
+        };
+
+        QVector<Task> m_tasks;
+        QTimer* m_poll_timer{nullptr};
+        quint64 m_next_id = 1;
+};
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <QtGlobal>
+
+#include <atomic>
+#include <memory>
+
+/**
+ * @file TaskToken.h
+ * @brief This file contains the definition of the TaskToken class.
+ */
+
+/**
+ * @class TaskToken
+ * @brief Shared cancellation flag and progress counters of one long-running operation.
+ *
+ * A token is a cheap handle: copies refer to the same state, so the owner of an operation can
+ * hand a copy to a worker thread and cancel it later, while the worker reports its progress
+ * through its copy. Workers check is_cancelled() at chunk granularity (per line, per batch) and
+ * stop at the next check; nothing is interrupted forcefully.
+ *
+ * All methods are thread-safe. Tokens registered with TaskRegistry carry a non-zero id.
+ */
+class TaskToken
+{
+    public:
+        /**
+         * @brief Constructs a token with fresh, uncancelled state.
+         */
+        TaskToken();
+
+        /**
+         * @brief Requests cancellation of the operation.
+         */
+        auto cancel() const -> void;
+
+        /**
+         * @brief Checks whether cancellation was requested.
+         * @return True if the operation should stop.
+         */
+        [[nodiscard]] auto is_cancelled() const -> bool;
+
+        /**
+         * @brief Reports the progress of the operation.
+         * @param done Units (bytes, rows) processed so far.
+         * @param total Total units, or 0 if unknown.
+         */
+        auto set_progress(qint64 done, qint64 total) const -> void;
+
+        /**
+         * @brief Returns the processed units.
+         * @return The last reported progress.
+         */
+        [[nodiscard]] auto get_progress_done() const -> qint64;
+
+        /**
+         * @brief Returns the total units.
+         * @return The last reported total, or 0 if unknown.
+         */
+        [[nodiscard]] auto get_progress_total() const -> qint64;
+
+        /**
+         * @brief Returns the registry id of the operation.
+         * @return The id, or 0 if the token is not registered.
+         */
+        [[nodiscard]] auto get_id() const -> quint64;
+
+    private:
+        friend class TaskRegistry;
+
+        /**
+         * @struct State
+         * @brief The state shared by all copies of a token.
+         */
+        struct State {
+                std::atomic_bool cancelled{false};
+                std::atomic<qint64> done{0};
+                std::atomic<qint64> total{0};
+                quint64 id = 0;
+        };
+
+        std::shared_ptr<State> m_state;
+};
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <QFontMetrics>
+#include <QHash>
+#include <QSet>
+#include <QString>
+#include <QVector>
+
+class QAbstractItemModel;
+
+/**
+ * @file ColumnWidthSampler.h
+ * @brief This file contains the definition of the ColumnWidthSampler class.
+ */
+
+/**
+ * @class ColumnWidthSampler
+ * @brief Tracks the content width of table columns from a bounded sample of rows.
+ *
+ * Measuring every cell (as QHeaderView::ResizeToContents does) is linear in the row count. The
+ * sampler instead measures the display text of selected rows only: a stratified sample spread
+ * evenly over a row range (so that rows from every file and period are represented), plus
+ * whatever rows the caller passes explicitly (e.g. the visible ones). Per column it keeps the
+ * widest text seen, so new batches only widen the statistics and never require a full pass.
+ *
+ * Text widths are cached per shown text (first line, bounded length); columns with few distinct
+ * values (level, app name) are measured once. The cache is bounded and dropped when the font
+ * changes. Columns whose width is not content based can be skipped entirely, so that e.g. large
+ * messages are never decoded for sizing.
+ */
+class ColumnWidthSampler
+{
+    public:
+        /**
+         * @brief Constructs an empty ColumnWidthSampler.
+         */
+        ColumnWidthSampler() = default;
+
+        /**
+         * @brief Forgets all statistics (e.g. after a model reset).
+         */
+        auto reset() -> void;
+
+        /**
+         * @brief Sets the font the widths are measured with; clears the width cache if changed.
+         * @param metrics The font metrics of the table.
+         */
+        auto set_font_metrics(const QFontMetrics& metrics) -> void;
+
+        /**
+         * @brief Sets columns that are not measured (e.g. a message column that takes the rest).
+         * @param columns The column indexes to skip.
+         */
+        auto set_skipped_columns(const QSet<int>& columns) -> void;
+
+        /**
+         * @brief Measures a stratified sample of a row range.
+         * @param model The model to read display texts from.
+         * @param first_row The first row of the range.
+         * @param last_row The last row of the range.
+         * @param max_rows The maximum number of rows to measure.
+         */
+        auto sample_range(const QAbstractItemModel& model, int first_row, int last_row,
+                          int max_rows) -> void;
+
+        /**
+         * @brief Measures the given rows.
+         * @param model The model to read display texts from.
+         * @param rows The rows to measure; invalid rows are ignored.
+         */
+        auto sample_rows(const QAbstractItemModel& model, const QVector<int>& rows) -> void;
+
+        /**
+         * @brief Returns the widest sampled text of a column.
+         * @param column The column index.
+         * @return The width in pixels (without cell padding), or 0 if nothing was sampled.
+         */
+        [[nodiscard]] auto get_content_width(int column) const -> int;
+
+        /**
+         * @brief Returns the number of rows measured since the last reset.
+         * @return The sampled row count.
+         */
+        [[nodiscard]] auto get_sampled_row_count() const -> int;
+
+        /**
+         * @brief Selects rows spread evenly over a range, including both ends.
+         * @param first_row The first row of the range.
+         * @param last_row The last row of the range.
+         * @param max_rows The maximum number of rows to select.
+         * @return The selected rows in ascending order.
+         */
+        [[nodiscard]] static auto stratified_rows(int first_row, int last_row, int max_rows)
+            -> QVector<int>;
+
+    private:
+        /**
+         * @brief Returns the width of a text, using the cache.
+         * @param text The display text.
+         * @return The width in pixels.
+         */
+        auto measure(const QString& text) -> int;
+
+    private:
+        QFontMetrics m_metrics{QFont()};
+        QVector<int> m_content_widths;
+        QHash<QString, int> m_width_cache;
+        QSet<int> m_skipped_columns;
+        int m_sampled_row_count = 0;
+};
@@ -19,6 +19,7 @@
  *
  * Intended to be embedded into a QMenu via QWidgetAction. The widget renders:
  *  - Left: elided file name label (tooltip shows full path).
+ *  - Middle: the file's entry counts ("matched / total" while a filter hides some).
  *  - Right: three small icon buttons (Show Only, Hide/Show, Remove).
  *
  * QSS-configurable properties:
@@ -94,6 +95,13 @@ class FilesInViewMenuItemWidget: public QWidget
          */
         auto set_hidden_state(bool hidden) -> void;
 
+        /**
+         * @brief Shows the file's entry counts next to its name.
+         * @param matched Entries of the file passing the view's filter.
+         * @param total All entries of the file in the view; negative hides the counts.
+         */
+        auto set_entry_counts(int matched, int total) -> void;
+
         /**
          * @brief Sets icon resource paths for the inline action buttons and reapplies icons.
          * @param eye Path to "Show Only" icon (eye).
@@ -323,6 +331,7 @@ class FilesInViewMenuItemWidget: public QWidget
         bool m_is_hidden_effective = false;
 
         QLabel* m_label = nullptr;
+        QLabel* m_counts_label = nullptr;
         QToolButton* m_btn_show_only = nullptr;
         QToolButton* m_btn_toggle_visibility = nullptr;
         QToolButton* m_btn_remove = nullptr;
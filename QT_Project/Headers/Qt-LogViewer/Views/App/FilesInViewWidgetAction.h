@@ -103,6 +103,13 @@ class FilesInViewWidgetAction: public QWidgetAction
          */
         [[nodiscard]] auto get_hidden_effective() const -> bool;
 
+        /**
+         * @brief Sets the file's entry counts shown by the embedded widget.
+         * @param matched Entries of the file passing the view's filter.
+         * @param total All entries of the file in the view; negative hides the counts.
+         */
+        auto set_entry_counts(int matched, int total) -> void;
+
     signals:
         /**
          * @brief Forwarded from embedded widget when actions are requested.
@@ -148,4 +155,8 @@ class FilesInViewWidgetAction: public QWidgetAction
          * @brief Effective hidden flag propagated to the embedded widget.
          */
         bool m_hidden_effective = false;
+
+        // Entry counts forwarded to the embedded widget; a negative total hides them.
+        int m_matched_count = -1;
+        int m_total_count = -1;
 };
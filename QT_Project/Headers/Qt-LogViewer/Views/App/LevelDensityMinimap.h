@@ -0,0 +1,117 @@
+#pragma once
+
+#include <QImage>
+#include <QPointer>
+#include <QWidget>
+
+class LevelDensitySummary;
+
+/**
+ * @file LevelDensityMinimap.h
+ * @brief This file contains the definition of the LevelDensityMinimap class.
+ */
+
+/**
+ * @class LevelDensityMinimap
+ * @brief Thin overview strip showing where log levels and search hits cluster in a view.
+ *
+ * Each pixel row stands for an equal share of the rows of the filtered and sorted view. Its
+ * color is the most severe level present there (warnings and above win over the rest), with an
+ * opacity growing with that level's density. A narrow lane on the right marks search hits, and
+ * an outline marks the rows of the current page.
+ *
+ * The strip is rendered from a LevelDensitySummary into a cached image, in time proportional to
+ * the bucket count and the widget height but independent of the number of rows. The image is
+ * only re-rendered after the summary or the size changed; other repaints just blit it.
+ *
+ * Pressing or dragging on the strip emits row_requested() with the corresponding view row.
+ */
+class LevelDensityMinimap: public QWidget
+{
+        Q_OBJECT
+
+    public:
+        /**
+         * @brief Constructs a LevelDensityMinimap.
+         * @param parent The parent widget.
+         */
+        explicit LevelDensityMinimap(QWidget* parent = nullptr);
+
+        /**
+         * @brief Sets the summary the strip is rendered from.
+         * @param summary The summary (not owned), or nullptr.
+         */
+        auto set_summary(LevelDensitySummary* summary) -> void;
+
+        /**
+         * @brief Sets the rows outlined as the currently displayed page.
+         * @param first_row The first view row of the page.
+         * @param row_count The number of rows on the page.
+         */
+        auto set_visible_rows(int first_row, int row_count) -> void;
+
+        /**
+         * @brief Maps a y coordinate to a view row.
+         * @param y The y coordinate in widget pixels.
+         * @return The view row, or -1 if the view is empty.
+         */
+        [[nodiscard]] auto row_at(int y) const -> int;
+
+        /**
+         * @brief Renders the strip for the current summary.
+         * @param size The image size in pixels.
+         * @return The rendered image (transparent where there are no rows).
+         */
+        [[nodiscard]] auto render_image(const QSize& size) const -> QImage;
+
+        /**
+         * @brief Returns the preferred size (a fixed, narrow width).
+         * @return The size hint.
+         */
+        [[nodiscard]] auto sizeHint() const -> QSize override;
+
+    signals:
+        /**
+         * @brief Emitted when the user presses or drags on the strip.
+         * @param row The view row under the cursor.
+         */
+        void row_requested(int row);
+
+    protected:
+        /**
+         * @brief Paints the cached image and the page outline.
+         * @param event The paint event.
+         */
+        auto paintEvent(QPaintEvent* event) -> void override;
+
+        /**
+         * @brief Requests the row under the cursor.
+         * @param event The mouse event.
+         */
+        auto mousePressEvent(QMouseEvent* event) -> void override;
+
+        /**
+         * @brief Requests the row under the cursor while the left button is held.
+         * @param event The mouse event.
+         */
+        auto mouseMoveEvent(QMouseEvent* event) -> void override;
+
+        /**
+         * @brief Invalidates the cached image.
+         * @param event The resize event.
+         */
+        auto resizeEvent(QResizeEvent* event) -> void override;
+
+    private:
+        /**
+         * @brief Invalidates the cached image and schedules a repaint.
+         */
+        auto invalidate_image() -> void;
+
+    private:
+        QPointer<LevelDensitySummary> m_summary;
+        QImage m_image;
+        bool m_image_dirty = true;
+        int m_visible_first_row = 0;
+        int m_visible_row_count = 0;
+};
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <QByteArray>
+#include <QString>
+#include <QWidget>
+
+#include "Qt-LogViewer/Models/LogEntry.h"
+
+class QLabel;
+class QPlainTextEdit;
+class QThreadPool;
+class QToolButton;
+
+/**
+ * @file LogDetailsWidget.h
+ * @brief This file contains the definition of the LogDetailsWidget class.
+ */
+
+/**
+ * @class LogDetailsWidget
+ * @brief Shows the fields and the message of one log entry, bounded in cost per selection.
+ *
+ * The message is kept as the entry's UTF-8 bytes (shared, not copied) and decoded into the text
+ * document in chunks: a selection only decodes and lays out the first chunk, further chunks are
+ * appended when the user scrolls near the end or follows the "Load more" link. Switching rows
+ * therefore costs the same for a one-line message and for a multi-MB payload dump.
+ *
+ * With pretty printing enabled, messages containing a JSON or XML payload are re-indented. Small
+ * payloads are formatted in place; larger ones on a worker thread, while the raw text is shown.
+ * Results for a row that is no longer selected are dropped.
+ *
+ * Entries whose line was truncated while loading (LogEntry::is_truncated()) only hold a prefix.
+ * For them the pane shows the full line instead, read chunk by chunk from the entry's file at
+ * the recorded offset, so even a line of hundreds of MB is never held in memory at once.
+ */
+class LogDetailsWidget: public QWidget
+{
+        Q_OBJECT
+
+    public:
+        /**
+         * @brief Constructs a LogDetailsWidget.
+         * @param parent The parent widget.
+         */
+        explicit LogDetailsWidget(QWidget* parent = nullptr);
+
+        /**
+         * @brief Waits for a running pretty print; queued ones are dropped.
+         */
+        ~LogDetailsWidget() override;
+
+        /**
+         * @brief Shows a log entry.
+         * @param entry The entry to show.
+         */
+        auto set_entry(const LogEntry& entry) -> void;
+
+        /**
+         * @brief Clears the pane.
+         */
+        auto clear() -> void;
+
+        /**
+         * @brief Enables or disables pretty printing of JSON/XML payloads.
+         * @param enabled True to pretty print.
+         */
+        auto set_pretty_print_enabled(bool enabled) -> void;
+
+        /**
+         * @brief Checks whether pretty printing is enabled.
+         * @return True if payloads are pretty printed.
+         */
+        [[nodiscard]] auto is_pretty_print_enabled() const -> bool;
+
+        /**
+         * @brief Checks whether a pretty print of the shown message is still running.
+         * @return True while a worker formats the message.
+         */
+        [[nodiscard]] auto is_pretty_print_pending() const -> bool;
+
+        /**
+         * @brief Returns the size of the shown message text (pretty printed, if applicable).
+         *
+         * For truncated entries this is the size of the full line on disk.
+         *
+         * @return The size in UTF-8 bytes.
+         */
+        [[nodiscard]] auto get_message_size() const -> qsizetype;
+
+        /**
+         * @brief Returns how much of the shown message text is in the document.
+         * @return The loaded size in UTF-8 bytes.
+         */
+        [[nodiscard]] auto get_loaded_message_size() const -> qsizetype;
+
+        /**
+         * @brief Appends the next chunk of the message to the document.
+         * @return True if a chunk was appended, false if the message is fully loaded.
+         */
+        auto load_next_chunk() -> bool;
+
+        /**
+         * @brief Returns the text edit showing the entry.
+         * @return Pointer to the QPlainTextEdit.
+         */
+        [[nodiscard]] auto get_text_edit() const -> QPlainTextEdit*;
+
+        /**
+         * @brief Formats a JSON or XML payload contained in a message.
+         *
+         * The payload starts at the first '{', '[' or '<' that yields a valid document and must
+         * extend to the end of the message; text before it is kept on its own line.
+         *
+         * @param message The UTF-8 message.
+         * @return The formatted message, or an empty array if it has no valid payload.
+         */
+        [[nodiscard]] static auto pretty_print(const QByteArray& message) -> QByteArray;
+
+        /**
+         * @brief Returns the number of message bytes decoded per chunk.
+         * @return The chunk size in bytes.
+         */
+        [[nodiscard]] static auto get_chunk_size() -> qsizetype;
+
+    protected:
+        /**
+         * @brief Handles language change events.
+         * @param event The change event.
+         */
+        auto changeEvent(QEvent* event) -> void override;
+
+    private:
+        /**
+         * @brief Selects the message text (raw or pretty printed) and renders it.
+         */
+        auto apply_message() -> void;
+
+        /**
+         * @brief Replaces the document with the header and the first chunk of the message.
+         */
+        auto render() -> void;
+
+        /**
+         * @brief Returns the next chunk of the shown text, from memory or from the source file.
+         * @return The UTF-8 chunk; empty if nothing could be read.
+         */
+        auto read_next_chunk() -> QByteArray;
+
+        /**
+         * @brief Shows a pretty printed message if it belongs to the shown entry.
+         * @param generation The generation the print was started for.
+         * @param formatted The formatted message, or empty if it had no valid payload.
+         */
+        auto handle_pretty_printed(quint64 generation, const QByteArray& formatted) -> void;
+
+        /**
+         * @brief Loads the next chunk when the user scrolled close to the end.
+         * @param value The scroll bar value.
+         */
+        auto handle_scrolled(int value) -> void;
+
+        /**
+         * @brief Updates the status line (loaded size, pending pretty print).
+         */
+        auto update_status() -> void;
+
+        /**
+         * @brief Sets translatable texts.
+         */
+        auto retranslate() -> void;
+
+    private:
+        QPlainTextEdit* m_text_edit{nullptr};
+        QToolButton* m_pretty_print_button{nullptr};
+        QLabel* m_status_label{nullptr};
+        QThreadPool* m_pool{nullptr};
+
+        bool m_has_entry = false;
+        QString m_header;
+        QByteArray m_raw_message;
+        QByteArray m_message;
+        qsizetype m_loaded_size = 0;
+
+        // Full line on disk of a truncated entry; offset -1 if the message is complete.
+        QString m_source_path;
+        qint64 m_source_offset = -1;
+        qint64 m_source_length = 0;
+        bool m_source_error = false;
+
+        bool m_pretty_print_pending = false;
+        bool m_updating_document = false;
+        quint64 m_generation = 0;
+};
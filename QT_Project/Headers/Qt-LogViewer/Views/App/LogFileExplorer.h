@@ -21,7 +21,8 @@ class LogFileInfo;
  * @brief Widget for displaying and managing sessions and grouped log files in a tree view.
  *
  * This widget shows sessions with log files grouped by application name using LogFileTreeModel.
- * Supports adding and removing sessions, files, and dynamic updates.
+ * Supports adding and removing sessions, files, and dynamic updates. Sessions can also watch
+ * folders, whose content the tree lists lazily as folder nodes are expanded.
  */
 class LogFileExplorer: public QWidget
 {
@@ -147,6 +148,20 @@ class LogFileExplorer: public QWidget
          */
         void remove_file_requested(const LogFileInfo& log_file_info);
 
+        /**
+         * @brief Emitted when the user picked a folder to watch in a session.
+         * @param session_id The session identifier.
+         * @param folder_path The folder path.
+         */
+        void add_watch_folder_requested(const QString& session_id, const QString& folder_path);
+
+        /**
+         * @brief Emitted when the user requests to stop watching a folder.
+         * @param session_id The session identifier.
+         * @param folder_path The folder path.
+         */
+        void remove_watch_folder_requested(const QString& session_id, const QString& folder_path);
+
         /**
          * @brief Emitted when a session is selected.
          * @param session_id The session identifier.
@@ -178,4 +193,7 @@ class LogFileExplorer: public QWidget
         QMenu* m_file_context_menu = nullptr;
         QMenu* m_session_context_menu = nullptr;
         QMenu* m_group_context_menu = nullptr;
+        QMenu* m_folder_context_menu = nullptr;
+        QAction* m_remove_file_action = nullptr;
+        QAction* m_remove_watch_folder_action = nullptr;
 };
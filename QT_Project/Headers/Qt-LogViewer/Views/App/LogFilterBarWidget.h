@@ -77,6 +77,21 @@ class LogFilterBarWidget: public QWidget
          */
         auto set_log_level_counts(const QMap<QString, int>& level_counts) -> void;
 
+        /**
+         * @brief Sets the total and the matching count for each log level in the filter widget.
+         * @param level_counts Map of log level name to count over all entries.
+         * @param matched_counts Map of log level name to count over the entries passing the
+         *        current filters.
+         */
+        auto set_log_level_counts(const QMap<QString, int>& level_counts,
+                                  const QMap<QString, int>& matched_counts) -> void;
+
+        /**
+         * @brief Shows the matching count per application in the application combo box.
+         * @param app_counts Map of application name to matching count.
+         */
+        auto set_app_match_counts(const QMap<QString, int>& app_counts) -> void;
+
         /**
          * @brief Sets the available search fields in the search bar widget.
          *
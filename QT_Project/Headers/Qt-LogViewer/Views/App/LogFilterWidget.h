@@ -95,6 +95,24 @@ class LogFilterWidget: public QWidget
          */
         auto set_log_level_counts(const QMap<QString, int>& level_counts) -> void;
 
+        /**
+         * @brief Sets the total and the matching count for each log level and updates the UI.
+         *
+         * @param level_counts Map of log level name to count over all entries.
+         * @param matched_counts Map of log level name to count over the entries passing the
+         *        current filters.
+         */
+        auto set_log_level_counts(const QMap<QString, int>& level_counts,
+                                  const QMap<QString, int>& matched_counts) -> void;
+
+        /**
+         * @brief Shows the number of entries passing the current filters per application as
+         *        tooltips of the application combo box.
+         *
+         * @param app_counts Map of application name to matching count.
+         */
+        auto set_app_match_counts(const QMap<QString, int>& app_counts) -> void;
+
         /**
          * @brief Returns the currently selected application name.
          *
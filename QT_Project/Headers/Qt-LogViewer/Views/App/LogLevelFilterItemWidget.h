@@ -55,6 +55,14 @@ class LogLevelFilterItemWidget: public QWidget
          */
         auto set_count(int count) -> void;
 
+        /**
+         * @brief Sets the count label to the entries passing the current filters and the total.
+         *        Shows "matched / total" while they differ, otherwise the total alone.
+         * @param matched The number of entries passing the filters.
+         * @param total The number of entries.
+         */
+        auto set_counts(int matched, int total) -> void;
+
         /**
          * @brief Sets the checked state of the checkbox.
          * @param checked True to check, false to uncheck.
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <QElapsedTimer>
+#include <QMetaObject>
+#include <QObject>
+#include <QPointer>
+#include <QString>
+#include <QVector>
+
+#include <atomic>
+
+class LogModel;
+class PagingProxyModel;
+class QAbstractItemModel;
+class QThreadPool;
+
+/**
+ * @file LogRowPrefetcher.h
+ * @brief This file contains the definition of the LogRowPrefetcher class.
+ */
+
+/**
+ * @class LogRowPrefetcher
+ * @brief Decodes the messages of rows about to be shown on a worker thread.
+ *
+ * The prefetcher follows the rows a table view shows (update_viewport()) and the scroll
+ * velocity derived from them. With paging, it warms the current page first (the part in scroll
+ * direction before the rest), then the next and the previous page, in scroll direction order.
+ * Without paging, it warms a window around the viewport that reaches further ahead the faster
+ * the view scrolls. Messages are decoded from a LogEntryStore snapshot and handed to the
+ * LogModel's decode cache, whose byte budget bounds the memory; rows already cached are skipped.
+ *
+ * Each viewport change that moves outside the warmed window cancels the running prefetch: the
+ * worker checks a generation counter per row and stops right away, and its results are
+ * dropped. A reset of the LogModel cancels as well.
+ */
+class LogRowPrefetcher: public QObject
+{
+        Q_OBJECT
+
+    public:
+        /**
+         * @brief Constructs an idle prefetcher.
+         * @param parent The parent QObject, or nullptr.
+         */
+        explicit LogRowPrefetcher(QObject* parent = nullptr);
+
+        /**
+         * @brief Cancels the running prefetch and waits for the worker.
+         */
+        ~LogRowPrefetcher() override;
+
+        /**
+         * @brief Sets the model shown by the view.
+         *
+         * The model may be a PagingProxyModel, further proxies or the LogModel itself; without
+         * a LogModel at the bottom of the proxy chain nothing is prefetched.
+         *
+         * @param model The view's model, or nullptr.
+         */
+        auto set_model(QAbstractItemModel* model) -> void;
+
+        /**
+         * @brief Updates the rows shown and starts a prefetch if they left the warmed window.
+         * @param first_row The first visible row of the view's model.
+         * @param last_row The last visible row of the view's model.
+         */
+        auto update_viewport(int first_row, int last_row) -> void;
+
+        /**
+         * @brief Cancels the running prefetch and forgets the warmed window.
+         */
+        auto cancel() -> void;
+
+        /**
+         * @brief Checks whether a prefetch is running.
+         * @return True while the worker decodes.
+         */
+        [[nodiscard]] auto is_busy() const -> bool;
+
+        /**
+         * @brief Returns the smoothed scroll velocity.
+         * @return Rows per second; negative when scrolling up.
+         */
+        [[nodiscard]] auto get_velocity() const -> double;
+
+    signals:
+        /**
+         * @brief Emitted when decoded messages were added to the model's decode cache.
+         * @param count The number of rows decoded.
+         */
+        void rows_prefetched(int count);
+
+    private:
+        /**
+         * @struct Range
+         * @brief A range of rows of the paged (flat) model.
+         */
+        struct Range {
+                int first = 0;
+                int last = -1;
+        };
+
+        /**
+         * @brief Returns the model the pages are cut from (the paging proxy's source).
+         * @return The flat model, or nullptr.
+         */
+        [[nodiscard]] auto get_flat_model() const -> QAbstractItemModel*;
+
+        /**
+         * @brief Returns the flat row of the first row on the current page.
+         * @return The offset; 0 without paging.
+         */
+        [[nodiscard]] auto get_page_offset() const -> int;
+
+        /**
+         * @brief Returns the ranges to warm for a viewport, in priority order.
+         * @param first_flat The first visible flat row.
+         * @param last_flat The last visible flat row.
+         * @return The ranges (clipped to the model, possibly empty).
+         */
+        [[nodiscard]] auto get_target_ranges(int first_flat, int last_flat) const
+            -> QVector<Range>;
+
+        /**
+         * @brief Returns the smallest range spanning all non-empty ranges.
+         * @param ranges The ranges.
+         * @return The span, or an empty range.
+         */
+        [[nodiscard]] static auto get_span(const QVector<Range>& ranges) -> Range;
+
+        /**
+         * @brief Checks whether the warmed window still serves a viewport.
+         * @param first_flat The first visible flat row.
+         * @param last_flat The last visible flat row.
+         * @param window The window the targets of this viewport span.
+         * @return True if a new prefetch is needed.
+         */
+        [[nodiscard]] auto needs_prefetch(int first_flat, int last_flat, const Range& window) const
+            -> bool;
+
+        /**
+         * @brief Maps a flat row down the proxy chain to a LogModel row.
+         * @param flat_row The flat row.
+         * @return The LogModel row, or -1.
+         */
+        [[nodiscard]] auto map_to_log_row(int flat_row) const -> int;
+
+        /**
+         * @brief Starts decoding the uncached rows of the given ranges on the worker.
+         * @param ranges The ranges in priority order.
+         * @param window The span of the ranges, remembered as the warmed window.
+         */
+        auto start(const QVector<Range>& ranges, const Range& window) -> void;
+
+        /**
+         * @brief Hands the worker's results to the model if they are still current.
+         *
+         * Results are validated per row id (see LogModel::find_row()), so appends to the model
+         * keep them; only messages of rows the model no longer has are dropped.
+         *
+         * @param generation The generation the prefetch was started with.
+         * @param row_ids The row ids.
+         * @param messages The decoded messages.
+         */
+        auto handle_decoded(quint64 generation, const QVector<quint64>& row_ids,
+                            const QVector<QString>& messages) -> void;
+
+    private:
+        QPointer<QAbstractItemModel> m_model;
+        QPointer<PagingProxyModel> m_paging_proxy;
+        QPointer<LogModel> m_log_model;
+        QMetaObject::Connection m_reset_connection;
+        QThreadPool* m_pool{nullptr};
+        // Read by the worker per row; a new value cancels the running prefetch.
+        std::atomic<quint64> m_generation{0};
+        bool m_busy = false;
+        Range m_window;
+        int m_window_page_offset = -1;
+        QElapsedTimer m_scroll_timer;
+        int m_last_first_row = -1;
+        double m_velocity = 0.0;
+        int m_direction = 0;
+};
@@ -12,6 +12,9 @@ class LogViewWidget;
  * @class LogTabWidget
  * @brief Specialized TabWidget for managing LogViewWidget tabs.
  *
+ * Besides LogViewWidget tabs it can hold lightweight placeholder tabs for views that are not
+ * materialized yet (lazy session restore). A placeholder only carries its view id; it is
+ * swapped for the real LogViewWidget via replace_placeholder_tab().
  */
 class LogTabWidget: public TabWidget
 {
@@ -54,6 +57,39 @@ class LogTabWidget: public TabWidget
          */
         [[nodiscard]] auto find_view_index(const QUuid& view_id) const -> int;
 
+        /**
+         * @brief Returns the view id of a tab, for LogViewWidget and placeholder tabs alike.
+         * @param index The tab index.
+         * @return The view id, or a null id if the index is invalid.
+         */
+        [[nodiscard]] auto view_id_at(int index) const -> QUuid;
+
+        /**
+         * @brief Checks whether a tab is a placeholder for a not yet materialized view.
+         * @param index The tab index.
+         * @return True if the tab is a placeholder.
+         */
+        [[nodiscard]] auto is_placeholder_at(int index) const -> bool;
+
+        /**
+         * @brief Adds a placeholder tab for a deferred view without selecting it.
+         * @param view_id The view identifier.
+         * @param tab_title The tab title.
+         * @return New tab index.
+         */
+        auto add_placeholder_tab(const QUuid& view_id, const QString& tab_title) -> int;
+
+        /**
+         * @brief Replaces a placeholder tab by its LogViewWidget, keeping title and selection.
+         *
+         * Emits no currentChanged() signal for the swap itself.
+         *
+         * @param index The placeholder tab index.
+         * @param log_view_widget The view widget to insert.
+         * @return True if the placeholder was replaced; otherwise false.
+         */
+        auto replace_placeholder_tab(int index, LogViewWidget* log_view_widget) -> bool;
+
         /**
          * @brief Sets file paths on a view tab identified by view id.
          * @param view_id The view identifier.
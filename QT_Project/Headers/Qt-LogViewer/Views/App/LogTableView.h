@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Qt-LogViewer/Models/LogModel.h"
+#include "Qt-LogViewer/Views/App/ColumnWidthSampler.h"
+#include "Qt-LogViewer/Views/App/LogRowPrefetcher.h"
 #include "Qt-LogViewer/Views/Shared/HoverRowDelegate.h"
 #include "Qt-LogViewer/Views/Shared/TableView.h"
 
@@ -11,6 +13,14 @@
  * This class extends TableView and provides default configuration and hooks
  * for log-specific features (selection, sorting, mouse tracking, etc.).
  * Use this class wherever a log entry table is required in the application.
+ *
+ * Column widths follow the content: a ColumnWidthSampler measures a stratified sample of every
+ * inserted batch and of all rows after resets, and auto_resize_columns() adds the visible rows.
+ * With a PagingProxyModel the statistics are drawn from its source (the sort proxy), so they
+ * cover every page and survive page changes. No operation touches all rows.
+ *
+ * A LogRowPrefetcher follows the scroll position and decodes the messages of the rows around the
+ * viewport (and of the neighbouring pages) on a worker thread before they are painted.
  */
 class LogTableView: public TableView
 {
@@ -32,16 +42,83 @@ class LogTableView: public TableView
         ~LogTableView() override = default;
 
         /**
-         * @brief Automatically resizes the columns based on the current viewport size.
+         * @brief Automatically resizes the columns to their sampled content.
          *
-         * This method sets the column widths proportionally for the log table.
+         * Every column except the message and the trailing spacer gets the width of its widest
+         * sampled text (capped to a share of the viewport); the message column takes the rest.
+         * Without sampled rows the columns fall back to fixed shares of the viewport.
          * Call this after the model is set or when the parent window is resized.
          */
         auto auto_resize_columns() -> void;
 
+        /**
+         * @brief Returns the column width statistics.
+         * @return The sampler (read-only).
+         */
+        [[nodiscard]] auto get_width_sampler() const -> const ColumnWidthSampler&;
+
+        /**
+         * @brief Returns the prefetcher that decodes the rows around the viewport ahead of time.
+         * @return The prefetcher (owned by the view).
+         */
+        [[nodiscard]] auto get_prefetcher() const -> LogRowPrefetcher*;
+
         /**
          * @brief Sets the model for the table view.
          * @param model The model to set (should be a LogModel or compatible).
          */
         void setModel(QAbstractItemModel* model) override;
+
+    protected:
+        /**
+         * @brief Drops the width statistics when the font changes.
+         * @param event The change event.
+         */
+        void changeEvent(QEvent* event) override;
+
+    private:
+        /**
+         * @brief Applies section resize modes: interactive columns and a stretching last column.
+         *
+         * Re-run whenever the column set changes (e.g. extra format columns get registered).
+         */
+        auto update_section_resize_modes() -> void;
+
+        /**
+         * @brief Measures a stratified sample of all rows (after resets).
+         */
+        auto resample_width_statistics() -> void;
+
+        /**
+         * @brief Measures a stratified sample of an inserted batch.
+         * @param parent The parent index (must be invalid).
+         * @param first The first inserted row.
+         * @param last The last inserted row.
+         */
+        auto handle_rows_inserted(const QModelIndex& parent, int first, int last) -> void;
+
+        /**
+         * @brief Sets the model the width statistics are drawn from.
+         *
+         * This is the source of a PagingProxyModel, otherwise the view's model.
+         *
+         * @param model The view's model, or nullptr.
+         */
+        auto set_sample_model(QAbstractItemModel* model) -> void;
+
+        /**
+         * @brief Returns the rows currently shown in the viewport.
+         * @return The visible rows in ascending order.
+         */
+        [[nodiscard]] auto get_visible_rows() const -> QVector<int>;
+
+        /**
+         * @brief Hands the visible rows to the prefetcher.
+         */
+        auto update_prefetch() -> void;
+
+    private:
+        ColumnWidthSampler m_width_sampler;
+        QAbstractItemModel* m_sample_model = nullptr;
+        LogRowPrefetcher* m_prefetcher = nullptr;
 };
@@ -16,6 +16,7 @@ namespace Ui
 class LogViewWidget;
 }
 
+class LevelDensitySummary;
 class LogFilterWidget;
 class LogTableView;
 
@@ -32,6 +33,10 @@ class LogTableView;
  * - Manage a per-view identifier (QUuid) for controller coordination.
  * - Expose the internal table view for selection/model access.
  * - Provide a "Files in View" menu for per-file actions (show-only, hide, remove).
+ * - Show a level density minimap of the whole filtered view next to the table; clicking it
+ *   jumps to the page and row under the cursor.
+ * - Keep the top visible row and the selected row in place (by their stable row ids) while the
+ *   view is filtered, sorted, re-paged or grows.
  */
 class LogViewWidget: public QWidget
 {
@@ -114,6 +119,20 @@ class LogViewWidget: public QWidget
          */
         auto set_log_level_counts(const QMap<QString, int>& level_counts) -> void;
 
+        /**
+         * @brief Updates the total and the matching per-log-level counts in the filter items.
+         * @param level_counts Map of level name to count over all entries.
+         * @param matched_counts Map of level name to count over the entries passing the filters.
+         */
+        auto set_log_level_counts(const QMap<QString, int>& level_counts,
+                                  const QMap<QString, int>& matched_counts) -> void;
+
+        /**
+         * @brief Shows the matching count per application in the application filter.
+         * @param app_counts Map of application name to matching count.
+         */
+        auto set_app_match_counts(const QMap<QString, int>& app_counts) -> void;
+
         /**
          * @brief Shows or hides the filter widget area.
          *
@@ -162,6 +181,21 @@ class LogViewWidget: public QWidget
          */
         auto set_view_file_paths(const QVector<QString>& file_paths) -> void;
 
+        /**
+         * @brief Returns the level density summary behind the minimap.
+         * @return Pointer to LevelDensitySummary (owned by this widget).
+         */
+        [[nodiscard]] auto get_density_summary() const -> LevelDensitySummary*;
+
+        /**
+         * @brief Shows the page containing a row of the filtered view and selects that row.
+         *
+         * Emits `page_changed` if the current page changes.
+         *
+         * @param row The row in the filtered and sorted view (across all pages).
+         */
+        auto jump_to_row(int row) -> void;
+
     signals:
         /**
          * @brief Emitted when the application filter selection changes.
@@ -206,6 +240,12 @@ class LogViewWidget: public QWidget
          */
         void remove_file_requested(const QString& file_path);
 
+        /**
+         * @brief Emitted when the widget itself switched the page (e.g. from the minimap).
+         * @param page The new current page (1-based).
+         */
+        void page_changed(int page);
+
     protected:
         /**
          * @brief Handles language change and other UI change events.
@@ -235,9 +275,50 @@ class LogViewWidget: public QWidget
          */
         auto refresh_files_menu_states() -> void;
 
+        /**
+         * @brief Outlines the rows of the current page on the minimap.
+         */
+        auto update_density_viewport() -> void;
+
+        /**
+         * @brief Shows the sort proxy's current facet counts in the filter widget and the
+         *        per-file counts in the "Files in View" menu.
+         */
+        auto update_facet_counts() -> void;
+
+        /**
+         * @brief Records the top visible row as scroll anchor and hands the anchors to the
+         *        paging proxy.
+         */
+        auto record_top_row() -> void;
+
+        /**
+         * @brief Records the current row as selection anchor.
+         * @param current The current index of the paging proxy.
+         */
+        auto record_current_row(const QModelIndex& current) -> void;
+
+        /**
+         * @brief Stops recording anchors while the paging proxy resets.
+         */
+        auto begin_anchor_restore() -> void;
+
+        /**
+         * @brief Restores the selection and scroll position from the anchors after a reset.
+         *
+         * Emits `page_changed` if the paging proxy followed an anchor to another page.
+         */
+        auto restore_anchor_rows() -> void;
+
     private:
         Ui::LogViewWidget* ui;
         QUuid m_view_id;
         QMenu* m_files_menu = nullptr;
         QVector<QString> m_view_file_paths;
+        LevelDensitySummary* m_density_summary = nullptr;
+        // Row ids (LogModel::RowIdRole) of the top visible and the selected row; 0 if none.
+        quint64 m_top_row_id = 0;
+        quint64 m_current_row_id = 0;
+        bool m_restoring_anchor = false;
+        int m_page_before_reset = 1;
 };
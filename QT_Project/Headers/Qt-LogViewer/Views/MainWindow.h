@@ -10,18 +10,19 @@
 #include <QUuid>
 #include <QVector>
 
+#include "Qt-LogViewer/Services/StartupProfiler.h"
 #include "QtWidgetsCommonLib/Widgets/AppMainWindow.h"
 
 // Forward declarations for Qt types used as pointers/references
 class QAction;
 class QDockWidget;
-class QPlainTextEdit;
 class QMenu;
 class QResizeEvent;
 class QDragEnterEvent;
 class QDropEvent;
 class QCloseEvent;
 class QEvent;
+class QTimer;
 
 // Forward declarations for project types used as pointers/references
 namespace Ui
@@ -35,6 +36,7 @@ class SessionController;
 class LogFileInfo;
 class RecentItemsModel;
 class SessionManager;
+class LogDetailsWidget;
 class LogFileExplorer;
 class LogLevelPieChartWidget;
 class LogViewWidget;
@@ -79,9 +81,35 @@ class MainWindow: public QtWidgetsCommonLib::AppMainWindow
 
         /**
          * @brief Sets up the log level pie chart dock widget.
+         *
+         * The chart itself is created when the dock is first shown.
          */
         auto setup_log_level_pie_chart() -> void;
 
+        /**
+         * @brief Creates the log level pie chart widget if it does not exist yet.
+         */
+        auto ensure_log_level_pie_chart_widget() -> void;
+
+        /**
+         * @brief Sets the log level counts shown by the pie chart.
+         *
+         * The counts are kept while the chart has not been created yet.
+         *
+         * @param level_counts Map of log level to count.
+         */
+        auto set_log_level_pie_chart_counts(const QMap<QString, int>& level_counts) -> void;
+
+        /**
+         * @brief Shows a view's total and matching counts in the filter bar if it is current.
+         *
+         * Called whenever the view's proxy reports changed counts (appended batches, filter
+         * changes).
+         *
+         * @param view_id The view.
+         */
+        auto update_filter_bar_counts(const QUuid& view_id) -> void;
+
         /**
          * @brief Sets up pagination widget.
          */
@@ -111,12 +139,25 @@ class MainWindow: public QtWidgetsCommonLib::AppMainWindow
         auto initialize_menu() -> void;
 
         /**
-         * @brief Rebuilds the Recent Files and Recent Sessions submenus from models.
+         * @brief Marks the Recent Files and Recent Sessions submenus for a rebuild.
          *
-         * Idempotent; clears and repopulates actions on each call.
+         * The submenus are repopulated from the models the next time one of them is shown.
          */
         auto rebuild_recent_menus() -> void;
 
+        /**
+         * @brief Repopulates the Recent Files and Recent Sessions submenus from the models.
+         *
+         * Idempotent; clears and repopulates actions on each call.
+         */
+        auto populate_recent_menus() -> void;
+
+        /**
+         * @brief Runs the startup work deferred until after the first paint and records the
+         *        time to interactive.
+         */
+        auto complete_deferred_startup() -> void;
+
         /**
          * @brief Shows the start page if there is no current session.
          *
@@ -138,6 +179,11 @@ class MainWindow: public QtWidgetsCommonLib::AppMainWindow
          */
         auto update_pagination_widget() -> void;
 
+        /**
+         * @brief Enables the baseline actions according to the baseline state.
+         */
+        auto update_baseline_actions() -> void;
+
         /**
          * @brief Handles drag enter events to allow dropping log files.
          * @param event The drag enter event.
@@ -170,6 +216,26 @@ class MainWindow: public QtWidgetsCommonLib::AppMainWindow
          */
         auto restore_view_from_json(const QString& session_id, const QJsonObject& view_obj) -> void;
 
+        /**
+         * @brief Registers a view from JSON for lazy restore and adds a placeholder tab for it.
+         * @param session_id The session identifier.
+         * @param view_obj The view JSON object.
+         */
+        auto defer_view_from_json(const QString& session_id, const QJsonObject& view_obj) -> void;
+
+        /**
+         * @brief Materializes the view of a placeholder tab and swaps in its LogViewWidget.
+         * @param index The placeholder tab index.
+         * @param background True for idle prefetch (the load does not switch the current view).
+         * @return The created LogViewWidget, or nullptr if the tab is no placeholder.
+         */
+        auto materialize_placeholder_tab(int index, bool background) -> LogViewWidget*;
+
+        /**
+         * @brief Arms the idle prefetch timer if placeholder tabs are left.
+         */
+        auto schedule_view_prefetch() -> void;
+
         /**
          * @brief Parses a SessionViewState from a JSON object.
          * @param view_obj The view JSON object.
@@ -203,7 +269,7 @@ class MainWindow: public QtWidgetsCommonLib::AppMainWindow
          * @brief Handles the show event to apply the current theme.
          *
          * This method is called when the main window is shown. It applies the current theme if it
-         * has not been applied yet.
+         * has not been applied yet. The first show also schedules complete_deferred_startup().
          *
          * @param event The show event.
          */
@@ -280,6 +346,22 @@ class MainWindow: public QtWidgetsCommonLib::AppMainWindow
          */
         auto handle_loading_finished(const QUuid& view_id, const QString& file_path) -> void;
 
+        /**
+         * @brief Updates the baseline actions and reports the new baseline in the status bar.
+         */
+        auto handle_baseline_changed() -> void;
+
+        /**
+         * @brief Handles tab switches: materializes placeholder tabs and syncs the current view.
+         * @param index The new current tab index.
+         */
+        auto handle_current_tab_changed(int index) -> void;
+
+        /**
+         * @brief Materializes the next placeholder tab in the background while loading is idle.
+         */
+        auto handle_view_prefetch_timeout() -> void;
+
         /**
          * @brief Handles streaming errors.
          * @param view_id The target view.
@@ -359,6 +441,10 @@ class MainWindow: public QtWidgetsCommonLib::AppMainWindow
         auto handle_close_session(const QString& session_id) -> void;
 
     private:
+        // Declared first so the startup clock starts before any other member is constructed.
+        StartupProfiler m_startup_profiler;
+        bool m_deferred_startup_scheduled = false;
+
         Ui::MainWindow* ui;
         LogViewerSettings* m_log_viewer_settings = nullptr;
         LogViewerController* m_controller = nullptr;
@@ -369,6 +455,10 @@ class MainWindow: public QtWidgetsCommonLib::AppMainWindow
         QAction* m_action_show_log_details = nullptr;
         QAction* m_action_show_log_level_pie_chart = nullptr;
         QAction* m_action_settings = nullptr;
+        QAction* m_action_dedupe_files = nullptr;
+        QAction* m_action_set_baseline = nullptr;
+        QAction* m_action_clear_baseline = nullptr;
+        QAction* m_action_show_novel_only = nullptr;
 
         // Session-related
         SessionManager* m_session_manager = nullptr;
@@ -383,6 +473,7 @@ class MainWindow: public QtWidgetsCommonLib::AppMainWindow
         QMenu* m_file_menu = nullptr;
         QMenu* m_recent_files_menu = nullptr;
         QMenu* m_recent_sessions_menu = nullptr;
+        bool m_recent_menus_dirty = true;
         QAction* m_action_save_session = nullptr;
         QAction* m_action_open_session = nullptr;
         QAction* m_action_reopen_last_session = nullptr;
@@ -393,13 +484,17 @@ class MainWindow: public QtWidgetsCommonLib::AppMainWindow
         DockWidget* m_log_level_pie_chart_dock_widget = nullptr;
 
         // Views
-        QPlainTextEdit* m_log_details_text_edit = nullptr;
+        LogDetailsWidget* m_log_details_widget = nullptr;
         LogFileExplorer* m_log_file_explorer = nullptr;
         LogLevelPieChartWidget* m_log_level_pie_chart_widget = nullptr;
+        QMap<QString, int> m_log_level_counts;
 
         // Start page (tab area filler)
         StartPageWidget* m_start_page_widget = nullptr;
 
         // Stores the last known dock layout/state while a session is active.
         QByteArray m_last_session_dock_state;
+
+        // Materializes deferred (placeholder) tabs of a restored session while loading is idle.
+        QTimer* m_view_prefetch_timer = nullptr;
 };
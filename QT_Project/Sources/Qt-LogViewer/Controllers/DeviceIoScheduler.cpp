@@ -0,0 +1,182 @@
+/**
+ * @file DeviceIoScheduler.cpp
+ * @brief This file contains the implementation of the DeviceIoScheduler class.
+ */
+
+#include "Qt-LogViewer/Controllers/DeviceIoScheduler.h"
+
+namespace
+{
+// Each load occupies a reader and a parser thread; more than this per device only adds
+// contention even on fast NVMe drives.
+constexpr int k_max_parallel_loads = 4;
+
+// Shorter loads are dominated by open/setup costs and say nothing about the device.
+constexpr qint64 k_min_sample_bytes = 8 * 1024 * 1024;
+
+// A higher concurrency level must beat a lower one by this factor to be preferred.
+constexpr double k_min_gain = 1.1;
+
+// Weight of a new sample in the per-level moving average.
+constexpr double k_sample_weight = 0.5;
+}  // namespace
+
+/**
+ * @brief Registers a device; known devices are left unchanged.
+ * @param device The device description.
+ */
+auto DeviceIoScheduler::register_device(const StorageDevice::Info& device) -> void
+{
+    if (!m_devices.contains(device.key))
+    {
+        Device entry;
+        entry.metrics.key = device.key;
+        entry.metrics.name = device.name;
+        entry.metrics.sequential = device.sequential;
+        m_devices.insert(device.key, entry);
+    }
+}
+
+/**
+ * @brief Checks whether another load may start on a device.
+ * @param key The device key.
+ * @return True if the device is below its limit.
+ */
+auto DeviceIoScheduler::can_start(quint64 key) const -> bool
+{
+    return get_active(key) < get_limit(key);
+}
+
+/**
+ * @brief Records that a load started on a device.
+ * @param key The device key.
+ * @return The number of loads now running on the device.
+ */
+auto DeviceIoScheduler::on_started(quint64 key) -> int
+{
+    auto& metrics = m_devices[key].metrics;
+    metrics.key = key;
+    ++metrics.active;
+    return metrics.active;
+}
+
+/**
+ * @brief Records that a load ended and retunes the device's limit.
+ * @param key The device key.
+ * @param bytes Bytes read by the load.
+ * @param elapsed_ns Duration of the load.
+ * @param concurrency Number of loads running on the device when it started.
+ */
+auto DeviceIoScheduler::on_finished(quint64 key, qint64 bytes, qint64 elapsed_ns,
+                                    int concurrency) -> void
+{
+    auto it = m_devices.find(key);
+
+    if (it != m_devices.end())
+    {
+        auto& device = it.value();
+        device.metrics.active = qMax(0, device.metrics.active - 1);
+        device.metrics.bytes += qMax<qint64>(bytes, 0);
+        ++device.metrics.completed;
+
+        if (bytes >= k_min_sample_bytes && elapsed_ns > 0 && concurrency > 0)
+        {
+            // The other loads ran at about the same speed, so this one's rate times the
+            // concurrency approximates what the device delivered in total.
+            const double seconds = static_cast<double>(elapsed_ns) / 1e9;
+            const double sample =
+                static_cast<double>(bytes) / seconds / 1e6 * static_cast<double>(concurrency);
+            const double previous = device.throughput_by_level.value(concurrency, sample);
+            const double average = previous + k_sample_weight * (sample - previous);
+
+            device.throughput_by_level.insert(concurrency, average);
+            device.metrics.throughput_mb_s = average;
+
+            if (!device.metrics.sequential)
+            {
+                retune(device.metrics, device.throughput_by_level);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Returns the current limit of a device.
+ * @param key The device key.
+ * @return The limit; 1 for unknown devices.
+ */
+auto DeviceIoScheduler::get_limit(quint64 key) const -> int
+{
+    const auto it = m_devices.constFind(key);
+    return (it != m_devices.cend()) ? it.value().metrics.limit : 1;
+}
+
+/**
+ * @brief Returns the number of running loads on a device.
+ * @param key The device key.
+ * @return The number of loads.
+ */
+auto DeviceIoScheduler::get_active(quint64 key) const -> int
+{
+    const auto it = m_devices.constFind(key);
+    return (it != m_devices.cend()) ? it.value().metrics.active : 0;
+}
+
+/**
+ * @brief Returns the state of all known devices.
+ * @return One entry per device.
+ */
+auto DeviceIoScheduler::get_metrics() const -> QVector<DeviceMetrics>
+{
+    QVector<DeviceMetrics> metrics;
+    metrics.reserve(m_devices.size());
+
+    for (const auto& device: m_devices)
+    {
+        metrics.append(device.metrics);
+    }
+
+    return metrics;
+}
+
+/**
+ * @brief Returns the highest limit any device can reach.
+ * @return The maximum concurrent loads per device.
+ */
+auto DeviceIoScheduler::get_max_parallel() -> int
+{
+    return k_max_parallel_loads;
+}
+
+/**
+ * @brief Returns the size below which a load is not used for tuning.
+ * @return The size in bytes.
+ */
+auto DeviceIoScheduler::get_min_sample_bytes() -> qint64
+{
+    return k_min_sample_bytes;
+}
+
+/**
+ * @brief Picks a new limit for a parallel device from its measured throughput.
+ * @param metrics The device's metrics (limit is updated).
+ * @param throughput_by_level Aggregate MB/s per measured concurrency level.
+ */
+auto DeviceIoScheduler::retune(DeviceMetrics& metrics, const QMap<int, double>& throughput_by_level)
+    -> void
+{
+    int best_level = throughput_by_level.firstKey();
+
+    for (auto it = throughput_by_level.cbegin(); it != throughput_by_level.cend(); ++it)
+    {
+        if (it.value() > throughput_by_level.value(best_level) * k_min_gain)
+        {
+            best_level = it.key();
+        }
+    }
+
+    // Probe one level further while the best level is the highest one measured so far.
+    const bool can_probe = best_level == throughput_by_level.lastKey() &&
+                           best_level < k_max_parallel_loads;
+    metrics.limit = can_probe ? best_level + 1 : best_level;
+}
@@ -5,45 +5,55 @@
 
 #include "Qt-LogViewer/Controllers/FileCatalogController.h"
 
+#include <QTimer>
+#include <utility>
+
 #include "Qt-LogViewer/Controllers/LogIngestController.h"
-#include "Qt-LogViewer/Models/LogEntry.h"
 #include "Qt-LogViewer/Models/LogFileInfo.h"
 #include "Qt-LogViewer/Models/LogFileTreeModel.h"
-#include "Qt-LogViewer/Services/LogLoader.h"
+#include "Qt-LogViewer/Services/FolderScanner.h"
+#include "Qt-LogViewer/Services/LogAppIdentifier.h"
 
 /**
  * @brief Construct a new FileCatalogController.
- * @param ingest Non-owning pointer to the ingest controller used to peek first entry.
+ * @param ingest Non-owning pointer to the ingest controller providing the format library.
  * @param parent Optional QObject parent.
  */
 FileCatalogController::FileCatalogController(LogIngestController* ingest, QObject* parent)
-    : QObject(parent), m_model(new LogFileTreeModel(this)), m_ingest(ingest)
-{}
+    : QObject(parent),
+      m_model(new LogFileTreeModel(this)),
+      m_ingest(ingest),
+      m_identifier(new LogAppIdentifier(this)),
+      m_resolve_timer(new QTimer(this)),
+      m_scanner(new FolderScanner(this))
+{
+    // Identifications finishing in the same event loop pass are regrouped in one batch.
+    m_resolve_timer->setSingleShot(true);
+    m_resolve_timer->setInterval(0);
+
+    connect(m_identifier, &LogAppIdentifier::app_identified, this,
+            &FileCatalogController::handle_app_identified);
+    connect(m_resolve_timer, &QTimer::timeout, this,
+            &FileCatalogController::flush_identified_files);
+
+    connect(m_model, &LogFileTreeModel::folder_fetch_requested, m_scanner, &FolderScanner::scan);
+    connect(m_model, &LogFileTreeModel::folder_removed, m_scanner, &FolderScanner::unwatch);
+    connect(m_scanner, &FolderScanner::folder_scanned, this,
+            &FileCatalogController::handle_folder_scanned);
+    connect(m_model, &LogFileTreeModel::file_metadata_requested, this,
+            &FileCatalogController::handle_file_metadata_requested);
+    connect(m_scanner, &FolderScanner::metadata_ready, m_model,
+            &LogFileTreeModel::set_file_metadata);
+}
 
 /**
- * @brief Add a single log file into the catalog.
+ * @brief Add a single log file into the catalog (all sessions).
  * @param file_path Absolute path to the log file.
  */
 auto FileCatalogController::add_file(const QString& file_path) -> void
 {
-    LogEntry entry;
-    if (m_ingest != nullptr)
-    {
-        entry = m_ingest->read_first_log_entry(file_path);
-    }
-
-    LogFileInfo info;
-    if (!entry.get_app_name().isEmpty())
-    {
-        info = entry.get_file_info();
-    }
-    else
-    {
-        const QString app_name = LogLoader::identify_app(file_path);
-        info = LogFileInfo(file_path, app_name);
-    }
-
-    m_model->add_log_file(info);
+    sync_identifier_formats();
+    add_files_impl(QString(), {file_path});
 }
 
 /**
@@ -52,10 +62,8 @@ auto FileCatalogController::add_file(const QString& file_path) -> void
  */
 auto FileCatalogController::add_files(const QVector<QString>& file_paths) -> void
 {
-    for (const auto& file_path: file_paths)
-    {
-        add_file(file_path);
-    }
+    sync_identifier_formats();
+    add_files_impl(QString(), file_paths);
 }
 
 /**
@@ -66,24 +74,11 @@ auto FileCatalogController::add_files(const QVector<QString>& file_paths) -> voi
 auto FileCatalogController::add_file_to_session(const QString& session_id,
                                                 const QString& file_path) -> void
 {
-    LogEntry entry;
-    if (m_ingest != nullptr)
-    {
-        entry = m_ingest->read_first_log_entry(file_path);
-    }
-
-    LogFileInfo info;
-    if (!entry.get_app_name().isEmpty())
-    {
-        info = entry.get_file_info();
-    }
-    else
+    if (!session_id.isEmpty())
     {
-        const QString app_name = LogLoader::identify_app(file_path);
-        info = LogFileInfo(file_path, app_name);
+        sync_identifier_formats();
+        add_files_impl(session_id, {file_path});
     }
-
-    m_model->add_log_file(session_id, info);
 }
 
 /**
@@ -94,9 +89,10 @@ auto FileCatalogController::add_file_to_session(const QString& session_id,
 auto FileCatalogController::add_files_to_session(const QString& session_id,
                                                  const QVector<QString>& file_paths) -> void
 {
-    for (const auto& file_path: file_paths)
+    if (!session_id.isEmpty())
     {
-        add_file_to_session(session_id, file_path);
+        sync_identifier_formats();
+        add_files_impl(session_id, file_paths);
     }
 }
 
@@ -109,6 +105,31 @@ auto FileCatalogController::remove_file(const LogFileInfo& file_info) -> void
     m_model->remove_log_file(file_info);
 }
 
+/**
+ * @brief Add a watch folder to a session; it is listed lazily when expanded in the tree.
+ * @param session_id The session identifier.
+ * @param folder_path The folder path.
+ * @return True if added; false if the session already watches the folder.
+ */
+auto FileCatalogController::add_watch_folder(const QString& session_id,
+                                             const QString& folder_path) -> bool
+{
+    return m_model->add_watch_folder(session_id, folder_path);
+}
+
+/**
+ * @brief Remove a watch folder from a session.
+ * @param session_id The session identifier.
+ * @param folder_path The folder path.
+ * @return True if removed; false if not found.
+ */
+auto FileCatalogController::remove_watch_folder(const QString& session_id,
+                                                const QString& folder_path) -> bool
+{
+    // Watches of folders no longer shown are dropped on their next change notification.
+    return m_model->remove_watch_folder(session_id, folder_path);
+}
+
 /**
  * @brief Get the underlying tree model used by the UI.
  * @return Pointer to `LogFileTreeModel`.
@@ -118,3 +139,151 @@ auto FileCatalogController::get_model() -> LogFileTreeModel*
     LogFileTreeModel* model = m_model;
     return model;
 }
+
+/**
+ * @brief Check whether files are still waiting for their app name.
+ * @return True if identifications are pending or not yet regrouped in the model.
+ */
+auto FileCatalogController::is_identifying() const -> bool
+{
+    return m_identifier->is_busy() || !m_identified_files.isEmpty();
+}
+
+/**
+ * @brief Check whether folder listings or file metadata are still being read.
+ * @return True if scans or metadata requests are pending.
+ */
+auto FileCatalogController::is_scanning() const -> bool
+{
+    return m_scanner->is_busy();
+}
+
+/**
+ * @brief Add files to one session (or all sessions if `session_id` is empty).
+ *
+ * Files with a cached app name are added in one batch, all others in one batch to the
+ * provisional group, so the model emits one row insertion per group.
+ *
+ * @param session_id The session identifier, or empty for all sessions.
+ * @param file_paths Absolute paths to the log files.
+ */
+auto FileCatalogController::add_files_impl(const QString& session_id,
+                                           const QVector<QString>& file_paths) -> void
+{
+    QList<LogFileInfo> known_files;
+    QVector<QString> unknown_paths;
+
+    for (const auto& file_path: file_paths)
+    {
+        const QString app_name = m_identifier->get_cached_app_name(file_path);
+
+        if (!app_name.isEmpty())
+        {
+            known_files.append(LogFileInfo(file_path, app_name));
+        }
+        else
+        {
+            unknown_paths.append(file_path);
+        }
+    }
+
+    if (session_id.isEmpty())
+    {
+        m_model->add_log_files(known_files);
+        m_model->add_provisional_log_files(unknown_paths);
+    }
+    else
+    {
+        m_model->add_log_files(session_id, known_files);
+        m_model->add_provisional_log_files(session_id, unknown_paths);
+    }
+
+    for (const auto& file_path: unknown_paths)
+    {
+        m_identifier->request(file_path);
+    }
+}
+
+/**
+ * @brief Passes the ingest's current format library to the identifier.
+ */
+auto FileCatalogController::sync_identifier_formats() -> void
+{
+    if (m_ingest != nullptr)
+    {
+        m_identifier->set_formats(m_ingest->get_log_formats());
+    }
+}
+
+/**
+ * @brief Queues an identified file for regrouping.
+ * @param file_path The file path.
+ * @param app_name The identified app name.
+ */
+auto FileCatalogController::handle_app_identified(const QString& file_path,
+                                                  const QString& app_name) -> void
+{
+    m_identified_files.append(LogFileInfo(file_path, app_name));
+    m_resolve_timer->start();
+}
+
+/**
+ * @brief Moves all queued identified files from the provisional group to their app groups and
+ *        updates the app names of folder files.
+ */
+auto FileCatalogController::flush_identified_files() -> void
+{
+    const QList<LogFileInfo> identified_files = std::exchange(m_identified_files, {});
+    m_model->resolve_provisional_log_files(identified_files);
+    m_model->set_file_app_names(identified_files);
+}
+
+/**
+ * @brief Applies a folder listing to the model and keeps watching the folder while shown.
+ * @param folder_path The scanned folder.
+ * @param sub_folders The absolute paths of the sub folders.
+ * @param files The absolute paths of the log files.
+ */
+auto FileCatalogController::handle_folder_scanned(const QString& folder_path,
+                                                  const QStringList& sub_folders,
+                                                  const QStringList& files) -> void
+{
+    if (m_model->has_folder(folder_path))
+    {
+        m_model->apply_folder_listing(folder_path, sub_folders, files);
+        m_scanner->watch(folder_path);
+    }
+    else
+    {
+        m_scanner->unwatch(folder_path);
+    }
+}
+
+/**
+ * @brief Reads size, modification time and app name of folder files shown for the first time.
+ * @param file_paths The file paths.
+ */
+auto FileCatalogController::handle_file_metadata_requested(const QVector<QString>& file_paths)
+    -> void
+{
+    sync_identifier_formats();
+    m_scanner->request_metadata(file_paths);
+
+    QList<LogFileInfo> cached_files;
+
+    for (const auto& file_path: file_paths)
+    {
+        const QString app_name = m_identifier->get_cached_app_name(file_path);
+
+        if (!app_name.isEmpty())
+        {
+            cached_files.append(LogFileInfo(file_path, app_name));
+        }
+        else
+        {
+            m_identifier->request(file_path);
+        }
+    }
+
+    m_model->set_file_app_names(cached_files);
+}
@@ -196,6 +196,20 @@ auto FilterCoordinator::hide_file(const QUuid& view_id, const QString& file_path
     }
 }
 
+/**
+ * @brief Show only entries absent from the baseline in the specified view.
+ * @param view_id Target view id.
+ * @param novel_only True to hide entries found in the baseline.
+ */
+auto FilterCoordinator::set_novel_only(const QUuid& view_id, bool novel_only) -> void
+{
+    auto* proxy = get_sort_filter_proxy(view_id);
+    if (proxy != nullptr)
+    {
+        proxy->set_novel_only_filter(novel_only);
+    }
+}
+
 /**
  * @brief Get current application name filter for a view.
  * @param view_id Target view id.
@@ -257,23 +271,64 @@ auto FilterCoordinator::is_search_regex(const QUuid& view_id) const -> bool
 }
 
 /**
- * @brief Compute per-view log level counts using entries from `ViewRegistry`.
+ * @brief Get whether a view shows only entries absent from the baseline.
+ * @param view_id Target view id.
+ * @return True if the novelty filter is set, false otherwise.
+ */
+auto FilterCoordinator::is_novel_only(const QUuid& view_id) const -> bool
+{
+    auto* proxy = get_sort_filter_proxy(view_id);
+    bool novel_only = (proxy != nullptr) ? proxy->is_novel_only_filter() : false;
+    return novel_only;
+}
+
+/**
+ * @brief Compute per-view log level counts over all entries of the view.
  * @param view_id Target view id.
  * @return Map of level name -> count.
  */
 auto FilterCoordinator::get_log_level_counts(const QUuid& view_id) const -> QMap<QString, int>
 {
-    QVector<LogEntry> entries = m_views->get_entries(view_id);
     QMap<QString, int> level_counts;
+    const auto* proxy = get_sort_filter_proxy(view_id);
 
-    for (const auto& entry: entries)
+    if (proxy != nullptr)
+    {
+        // The proxy counts the rows while filtering them.
+        level_counts = proxy->get_total_counts().get_level_counts();
+    }
+    else
     {
-        level_counts[entry.get_level()]++;
+        const LogEntryStore::Snapshot entries = m_views->get_snapshot(view_id);
+
+        for (const auto& entry: entries)
+        {
+            level_counts[entry.get_level()]++;
+        }
     }
 
     return level_counts;
 }
 
+/**
+ * @brief Returns the per-level, per-app and per-file counts of the rows passing the view's
+ *        filter.
+ * @param view_id Target view.
+ * @return The facet counts (empty if the view is unknown).
+ */
+auto FilterCoordinator::get_match_counts(const QUuid& view_id) const -> LogFacetCounts
+{
+    LogFacetCounts counts;
+    const auto* proxy = get_sort_filter_proxy(view_id);
+
+    if (proxy != nullptr)
+    {
+        counts = proxy->get_match_counts();
+    }
+
+    return counts;
+}
+
 /**
  * @brief Static list of available log levels (same across all views).
  * @return Vector of log level names.
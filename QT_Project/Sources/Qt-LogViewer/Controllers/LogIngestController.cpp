@@ -16,9 +16,9 @@
  * @param parent Optional QObject parent for ownership.
  */
 LogIngestController::LogIngestController(const QString& log_format, QObject* parent)
-    : QObject(parent), m_loader(log_format, this), m_queue(), m_is_shutting_down(false)
+    : QObject(parent), m_log_format(log_format), m_queue(), m_is_shutting_down(false)
 {
-    wire_service_signals();
+    add_lane();
 }
 
 /**
@@ -28,8 +28,12 @@ LogIngestController::LogIngestController(const QString& log_format, QObject* par
 LogIngestController::~LogIngestController()
 {
     m_is_shutting_down = true;
-    QObject::disconnect(&m_loader, nullptr, this, nullptr);
-    m_loader.cancel_async();
+
+    for (auto* lane: m_lanes)
+    {
+        QObject::disconnect(lane, nullptr, this, nullptr);
+        lane->cancel_async();
+    }
 }
 
 /**
@@ -40,7 +44,7 @@ LogIngestController::~LogIngestController()
  */
 auto LogIngestController::load_file_sync(const QString& file_path) -> QVector<LogEntry>
 {
-    QVector<LogEntry> entries = m_loader.load_log_file(file_path);
+    QVector<LogEntry> entries = m_lanes.first()->load_log_file(file_path);
     return entries;
 }
 
@@ -52,10 +56,75 @@ auto LogIngestController::load_file_sync(const QString& file_path) -> QVector<Lo
  */
 auto LogIngestController::read_first_log_entry(const QString& file_path) const -> LogEntry
 {
-    LogEntry entry = m_loader.read_first_log_entry(file_path);
+    LogEntry entry = m_lanes.first()->read_first_log_entry(file_path);
     return entry;
 }
 
+/**
+ * @brief Adds user-defined formats used for per-file format detection.
+ * @param formats Format strings (e.g. "{timestamp} [{thread}] {level} {message}").
+ */
+auto LogIngestController::add_log_formats(const QVector<QString>& formats) -> void
+{
+    m_extra_formats.append(formats);
+
+    for (auto* lane: m_lanes)
+    {
+        lane->add_log_formats(formats);
+    }
+}
+
+/**
+ * @brief Sets the length above which streamed lines are truncated, for all lanes.
+ * @param max_line_bytes The limit in bytes; values <= 0 restore the default.
+ */
+auto LogIngestController::set_max_line_length(qsizetype max_line_bytes) -> void
+{
+    m_max_line_length = max_line_bytes;
+
+    for (auto* lane: m_lanes)
+    {
+        lane->set_max_line_length(max_line_bytes);
+    }
+}
+
+/**
+ * @brief Returns the formats used for per-file format detection.
+ * @return List of format strings; the configured format comes first.
+ */
+auto LogIngestController::get_log_formats() const -> QVector<QString>
+{
+    return m_lanes.first()->get_log_formats();
+}
+
+/**
+ * @brief Sets the registry streams are reported to as tasks owned by their view.
+ * @param registry The task registry (not owned), or nullptr.
+ */
+auto LogIngestController::set_task_registry(TaskRegistry* registry) -> void
+{
+    m_queue.set_task_registry(registry);
+}
+
+/**
+ * @brief Sets the filter settings batches streamed into a view are evaluated against.
+ * @param view_id Target view id.
+ * @param spec The view's filter settings.
+ */
+auto LogIngestController::set_view_filter(const QUuid& view_id, const LogFilter::Spec& spec)
+    -> void
+{
+    m_view_filters.insert(view_id, spec);
+
+    for (auto* lane: m_lanes)
+    {
+        if (m_queue.get_active_view_id(lane) == view_id)
+        {
+            lane->set_filter(spec);
+        }
+    }
+}
+
 /**
  * @brief Enqueues a file to be streamed for a specific view.
  *        Idempotent per `(view_id, file_path)`.
@@ -68,32 +137,63 @@ auto LogIngestController::enqueue_stream(const QUuid& view_id, const QString& fi
 }
 
 /**
- * @brief Attempts to start the next asynchronous load if none is active.
+ * @brief Starts pending loads on idle lanes as far as the device limits allow.
  * @param batch_size Number of entries per batch appended to the model.
+ * @return The view ids of the loads started by this call, in start order.
  */
-auto LogIngestController::start_next_if_idle(qsizetype batch_size) -> void
+auto LogIngestController::start_next_if_idle(qsizetype batch_size) -> QVector<QUuid>
 {
-    const bool started = m_queue.try_start_next(&m_loader, batch_size);
-    if (started)
+    QVector<QUuid> started_view_ids;
+    bool started = true;
+
+    while (started)
     {
-        qDebug().nospace() << "[Ingest] started next view="
-                           << m_queue.get_active_view_id().toString() << " file=\""
-                           << m_queue.get_active_file_path() << '"';
+        auto* lane = get_idle_lane();
+        const QUuid next_view_id = m_queue.get_next_view_id();
+
+        // The worker evaluates its first batches right away, so the lane must carry the view's
+        // settings before the stream starts.
+        if (lane != nullptr && !next_view_id.isNull())
+        {
+            lane->set_filter(m_view_filters.value(next_view_id));
+        }
+
+        started = m_queue.try_start_next(lane, batch_size);
+
+        if (started)
+        {
+            const QUuid view_id = m_queue.get_active_view_id(lane);
+            started_view_ids.append(view_id);
+
+            qDebug().nospace() << "[Ingest] started next view=" << view_id.toString()
+                               << " active=" << m_queue.get_active_count()
+                               << " lanes=" << m_lanes.size();
+        }
     }
+
+    return started_view_ids;
 }
 
 /**
  * @brief Cancels any ongoing streaming for the specified view and clears its pending queue.
+ *
+ * The view's filter settings are dropped as well; set them again before enqueueing.
+ *
  * @param view_id The view to cancel streaming for.
  */
 auto LogIngestController::cancel_for_view(const QUuid& view_id) -> void
 {
-    m_queue.cancel_if_active(&m_loader, view_id);
+    for (auto* lane: m_lanes)
+    {
+        m_queue.cancel_if_active(lane, view_id);
+    }
+
+    m_view_filters.remove(view_id);
 }
 
 /**
- * @brief Returns the active view id (empty if none).
- * @return The currently active view id, or a null QUuid if idle.
+ * @brief Returns the view id of the oldest active load (empty if none).
+ * @return The active view id, or a null QUuid if idle.
  */
 auto LogIngestController::get_active_view_id() const -> QUuid
 {
@@ -102,8 +202,8 @@ auto LogIngestController::get_active_view_id() const -> QUuid
 }
 
 /**
- * @brief Returns the active file path (empty if none).
- * @return The currently active file path, or empty if idle.
+ * @brief Returns the file path of the oldest active load (empty if none).
+ * @return The active file path, or empty if idle.
  */
 auto LogIngestController::get_active_file_path() const -> QString
 {
@@ -132,31 +232,95 @@ auto LogIngestController::get_active_batch_size() const -> qsizetype
 }
 
 /**
- * @brief Wires internal service signals and maps them to per-view signals using the queue's
- *        active view id. Keeps logic aligned with previous `LogViewerController` behavior.
+ * @brief Returns the number of files loading right now.
+ * @return The number of active loads.
+ */
+auto LogIngestController::get_active_count() const -> int
+{
+    return m_queue.get_active_count();
+}
+
+/**
+ * @brief Returns the per-device concurrency limits and measured throughput.
+ * @return One entry per storage device files were loaded from.
+ */
+auto LogIngestController::get_device_metrics() const -> QVector<DeviceIoScheduler::DeviceMetrics>
+{
+    return m_queue.get_device_metrics();
+}
+
+/**
+ * @brief Creates a loading service and wires its signals.
+ * @return The new lane (owned by this controller).
+ */
+auto LogIngestController::add_lane() -> LogLoadingService*
+{
+    auto* lane = new LogLoadingService(m_log_format, this);
+    lane->set_max_line_length(m_max_line_length);
+
+    if (!m_extra_formats.isEmpty())
+    {
+        lane->add_log_formats(m_extra_formats);
+    }
+
+    m_lanes.append(lane);
+    wire_service_signals(lane);
+
+    return lane;
+}
+
+/**
+ * @brief Returns a lane without an active load, creating one if all are busy.
+ * @return The lane, or nullptr if the maximum number of lanes is busy.
  */
-auto LogIngestController::wire_service_signals() -> void
+auto LogIngestController::get_idle_lane() -> LogLoadingService*
 {
-    connect(&m_loader, &LogLoadingService::entry_batch_parsed, this,
-            [this](const QString& file_path, const QVector<LogEntry>& batch) {
+    LogLoadingService* idle_lane = nullptr;
+
+    for (auto* lane: m_lanes)
+    {
+        if (idle_lane == nullptr && !m_queue.is_active(lane))
+        {
+            idle_lane = lane;
+        }
+    }
+
+    if (idle_lane == nullptr && m_lanes.size() < DeviceIoScheduler::get_max_parallel())
+    {
+        idle_lane = add_lane();
+    }
+
+    return idle_lane;
+}
+
+/**
+ * @brief Wires a service's signals and maps them to per-view signals using the view the
+ *        queue reports as active on that service.
+ * @param lane The loading service.
+ */
+auto LogIngestController::wire_service_signals(LogLoadingService* lane) -> void
+{
+    connect(lane, &LogLoadingService::entry_batch_parsed, this,
+            [this, lane](const QString& file_path, const QVector<LogEntry>& batch,
+                         const LogFilter::BatchVerdicts& verdicts) {
                 if (!m_is_shutting_down)
                 {
-                    const QUuid view_id = m_queue.get_active_view_id();
+                    const QUuid view_id = m_queue.get_active_view_id(lane);
                     qDebug().nospace() << "[Ingest] batch for view=" << view_id.toString()
                                        << " file=\"" << file_path << "\" count=" << batch.size();
 
                     if (!view_id.isNull())
                     {
-                        emit entry_batch_parsed(view_id, file_path, batch);
+                        emit entry_batch_parsed(view_id, file_path, batch, verdicts);
                     }
                 }
             });
 
-    connect(&m_loader, &LogLoadingService::progress, this,
-            [this](const QString& file_path, qint64 bytes_read, qint64 total_bytes) {
+    connect(lane, &LogLoadingService::progress, this,
+            [this, lane](const QString& file_path, qint64 bytes_read, qint64 total_bytes) {
                 if (!m_is_shutting_down)
                 {
-                    const QUuid view_id = m_queue.get_active_view_id();
+                    const QUuid view_id = m_queue.get_active_view_id(lane);
                     qDebug().nospace()
                         << "[Ingest] progress view=" << view_id.toString() << " file=\""
                         << file_path << "\" " << bytes_read << '/' << total_bytes;
@@ -168,11 +332,11 @@ auto LogIngestController::wire_service_signals() -> void
                 }
             });
 
-    connect(&m_loader, &LogLoadingService::error, this,
-            [this](const QString& file_path, const QString& message) {
+    connect(lane, &LogLoadingService::error, this,
+            [this, lane](const QString& file_path, const QString& message) {
                 if (!m_is_shutting_down)
                 {
-                    const QUuid view_id = m_queue.get_active_view_id();
+                    const QUuid view_id = m_queue.get_active_view_id(lane);
                     qWarning().nospace()
                         << "[Ingest] error view=" << view_id.toString() << " file=\"" << file_path
                         << "\" msg=\"" << message << '"';
@@ -186,10 +350,10 @@ auto LogIngestController::wire_service_signals() -> void
                 }
             });
 
-    connect(&m_loader, &LogLoadingService::finished, this, [this](const QString& file_path) {
+    connect(lane, &LogLoadingService::finished, this, [this, lane](const QString& file_path) {
         if (!m_is_shutting_down)
         {
-            const QUuid view_id = m_queue.get_active_view_id();
+            const QUuid view_id = m_queue.get_active_view_id(lane);
             qDebug().nospace() << "[Ingest] finished view=" << view_id.toString() << " file=\""
                                << file_path << '"';
 
@@ -203,29 +367,24 @@ auto LogIngestController::wire_service_signals() -> void
     });
 
     // Advance queue only after thread cleanup (safe to start next).
-    connect(&m_loader, &LogLoadingService::streaming_idle, this, [this]() {
+    connect(lane, &LogLoadingService::streaming_idle, this, [this, lane]() {
         if (!m_is_shutting_down)
         {
             qDebug().nospace() << "[Ingest] streaming_idle: force idle then try start next. "
                                << "pending=" << m_queue.get_pending_count();
 
-            // Clear active only when the loader reports true idle.
-            m_queue.clear_active();
+            // Clear this lane only when its loader reports true idle; other lanes keep running.
+            m_queue.clear_active(lane);
 
-            // Start next first, then read new active view id (fix ordering).
-            const bool started = m_queue.try_start_next(&m_loader, m_queue.get_active_batch_size());
-            if (started)
-            {
-                const QUuid new_active = m_queue.get_active_view_id();
-                qDebug().nospace() << "[Ingest] started next view=" << new_active.toString()
-                                   << " file=\"" << m_queue.get_active_file_path() << '"';
-            }
-            else
+            const QVector<QUuid> started_view_ids =
+                start_next_if_idle(m_queue.get_active_batch_size());
+
+            if (m_queue.get_active_count() == 0)
             {
                 qDebug().nospace() << "[Ingest] no next item started (idle or empty queue).";
             }
 
-            emit idle();
+            emit idle(started_view_ids);
         }
     });
 }
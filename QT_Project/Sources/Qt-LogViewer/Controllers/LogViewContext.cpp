@@ -10,11 +10,21 @@
 
 #include "Qt-LogViewer/Controllers/LogViewContext.h"
 
+#include <QFileInfo>
+#include <QThreadPool>
+#include <utility>
+
 // Concrete includes for forward-declared types
 #include "Qt-LogViewer/Models/LogModel.h"
 #include "Qt-LogViewer/Models/LogSortFilterProxyModel.h"
 #include "Qt-LogViewer/Models/PagingProxyModel.h"
 
+namespace
+{
+// Rows recorded between cancellation checks while seeding the dedupe set.
+constexpr int k_dedupe_seed_chunk_rows = 65536;
+}  // namespace
+
 /**
  * @brief Constructs a LogViewContext and wires the model/proxy chain.
  *
@@ -30,18 +40,27 @@ LogViewContext::LogViewContext(QObject* parent)
       m_model(new LogModel(this)),
       m_sort_proxy(new LogSortFilterProxyModel(this)),
       m_paging_proxy(new PagingProxyModel(this)),
-      m_loaded_files()
+      m_loaded_files(),
+      m_pool(new QThreadPool(this))
 {
     m_sort_proxy->setSourceModel(m_model);
     m_paging_proxy->setSourceModel(m_sort_proxy);
+    m_pool->setMaxThreadCount(1);
 }
 
 /**
- * @brief Default destructor.
+ * @brief Cancels a running retag and waits for it.
  *
  * Components are parented to this QObject and will be deleted automatically.
  */
-LogViewContext::~LogViewContext() = default;
+LogViewContext::~LogViewContext()
+{
+    // The retag and seeding tasks post back to this object, so they may not outlive it.
+    m_retag_token.cancel();
+    m_dedupe_token.cancel();
+    m_pool->clear();
+    m_pool->waitForDone();
+}
 
 /**
  * @brief Returns the underlying LogModel instance.
@@ -75,26 +94,93 @@ auto LogViewContext::get_paging_proxy() const -> PagingProxyModel*
 
 /**
  * @brief Appends a batch of log entries to the underlying model.
+ *
+ * With dedupe enabled, entries another file of the view already has are dropped first; the
+ * rest are tagged against the baseline, if one is set.
+ *
  * @param entries The batch of `LogEntry` objects to append.
  */
 auto LogViewContext::append_entries(const QVector<LogEntry>& entries) -> void
 {
     if (m_model != nullptr)
     {
-        m_model->add_entries(entries);
+        // Shares the data with entries unless duplicates are dropped.
+        QVector<LogEntry> batch = entries;
+
+        if (m_dedupe_enabled)
+        {
+            drop_duplicates(batch, {}, nullptr);
+        }
+
+        if (m_baseline != nullptr)
+        {
+            m_baseline->tag_entries(batch);
+        }
+
+        m_model->add_entries(batch);
     }
 }
 
+/**
+ * @brief Appends log entries whose filter verdicts were computed while parsing.
+ *
+ * With dedupe enabled, duplicates are dropped before the verdicts are handed to the proxy, so
+ * the verdict bits and facet counts are compacted along with the entries. The parser tags the
+ * entries with the baseline of the filter settings it got; if that is not the view's baseline
+ * (it changed while streaming), the entries are tagged here, and the verdicts no longer match.
+ *
+ * @param entries The batch of `LogEntry` objects to append.
+ * @param verdicts The batch's verdicts.
+ * @return True if the verdicts matched the proxy's filter settings.
+ */
+auto LogViewContext::append_entries(const QVector<LogEntry>& entries,
+                                    const LogFilter::BatchVerdicts& verdicts) -> bool
+{
+    bool used = false;
+    QVector<LogEntry> batch = entries;
+    LogFilter::BatchVerdicts batch_verdicts = verdicts;
+
+    if (m_dedupe_enabled)
+    {
+        drop_duplicates(batch, verdicts.entry_keys, &batch_verdicts);
+    }
+
+    if (verdicts.spec.baseline != m_baseline)
+    {
+        tag_entries(batch);
+    }
+
+    if (m_model != nullptr && m_sort_proxy != nullptr)
+    {
+        used = m_sort_proxy->set_batch_verdicts(m_model->rowCount(), batch_verdicts);
+        m_model->add_entries(batch);
+        m_sort_proxy->clear_batch_verdicts();
+    }
+    else if (m_model != nullptr)
+    {
+        m_model->add_entries(batch);
+    }
+
+    return used;
+}
+
 /**
  * @brief Removes all entries that belong to the given file path from the model.
+ *
+ * With dedupe enabled, other files may have dropped entries as duplicates of the removed
+ * file's; those entries are missing until the returned files are loaded again.
+ *
  * @param file_path Absolute file path whose entries should be removed.
+ * @return The files that dropped entries as duplicates of the removed file.
  */
-auto LogViewContext::remove_entries_by_file_path(const QString& file_path) -> void
+auto LogViewContext::remove_entries_by_file_path(const QString& file_path) -> QStringList
 {
     if (m_model != nullptr)
     {
         m_model->remove_entries_by_file_path(file_path);
     }
+
+    return m_dedupe.remove_file(file_path);
 }
 
 /**
@@ -113,16 +199,42 @@ auto LogViewContext::get_entries() const -> QVector<LogEntry>
     return result;
 }
 
+/**
+ * @brief Returns an immutable snapshot of the entries in the model (no copy).
+ * @return The snapshot (empty if there is no model).
+ */
+auto LogViewContext::get_snapshot() const -> LogEntryStore::Snapshot
+{
+    LogEntryStore::Snapshot result;
+
+    if (m_model != nullptr)
+    {
+        result = m_model->get_snapshot();
+    }
+
+    return result;
+}
+
 /**
  * @brief Sets the loaded-files list for this view.
  *
- * The provided list replaces any existing content.
+ * The provided list replaces any existing content. With dedupe enabled, the dedupe set is
+ * sized for the files new to the view.
  *
  * @param files List of `LogFileInfo` objects to set as loaded for this view.
  */
 auto LogViewContext::set_loaded_files(const QList<LogFileInfo>& files) -> void
 {
+    const QVector<QString> previous_paths = get_file_paths();
     m_loaded_files = files;
+
+    for (const auto& file_info: files)
+    {
+        if (!previous_paths.contains(file_info.get_file_path()))
+        {
+            reserve_dedupe(file_info.get_file_path());
+        }
+    }
 }
 
 /**
@@ -144,6 +256,7 @@ auto LogViewContext::add_loaded_file(const LogFileInfo& file_info) -> void
     if (!exists)
     {
         m_loaded_files.append(file_info);
+        reserve_dedupe(file_info.get_file_path());
     }
 }
 
@@ -180,3 +293,334 @@ auto LogViewContext::clear_loaded_files() -> void
 {
     m_loaded_files.clear();
 }
+
+/**
+ * @brief Enables or disables dropping entries that repeat entries of another file.
+ *
+ * Enabling seeds the dedupe set with the entries already shown (duplicates among them stay) on
+ * the worker (see start_dedupe_seed()). Disabling forgets the keys and the duplicate counts.
+ *
+ * @param enabled True to drop duplicates across files.
+ */
+auto LogViewContext::set_dedupe_enabled(bool enabled) -> void
+{
+    if (enabled != m_dedupe_enabled)
+    {
+        m_dedupe_enabled = enabled;
+        m_dedupe.clear();
+
+        if (m_sort_proxy != nullptr)
+        {
+            m_sort_proxy->set_dedupe_enabled(enabled);
+        }
+
+        start_dedupe_seed();
+    }
+}
+
+/**
+ * @brief Checks whether duplicates across files are dropped.
+ * @return True if dedupe is enabled.
+ */
+auto LogViewContext::is_dedupe_enabled() const -> bool
+{
+    return m_dedupe_enabled;
+}
+
+/**
+ * @brief Checks whether the dedupe set is still being seeded with the shown entries.
+ * @return True while the seeding task runs.
+ */
+auto LogViewContext::is_dedupe_seeding() const -> bool
+{
+    return m_dedupe_seeding;
+}
+
+/**
+ * @brief Returns the number of entries dropped as duplicates, per file.
+ * @return Map of file path to dropped entries (files without duplicates are absent).
+ */
+auto LogViewContext::get_duplicate_counts() const -> QHash<QString, int>
+{
+    return m_dedupe.get_duplicate_counts();
+}
+
+/**
+ * @brief Removes the entries of a batch that another file of the view already has.
+ *
+ * Uses the given keys if there is one per entry, and computes them otherwise. Without
+ * duplicates, the batch and its verdicts are left untouched; otherwise the kept entries, their
+ * verdict bits and keys are compacted, and the dropped entries are taken out of the facet
+ * counts.
+ *
+ * @param entries The batch; duplicates are removed in place.
+ * @param keys One dedupe key per entry, or empty to compute them here.
+ * @param verdicts The batch's verdicts, compacted alongside; nullptr if there are none.
+ */
+auto LogViewContext::drop_duplicates(QVector<LogEntry>& entries, const QVector<quint64>& keys,
+                                     LogFilter::BatchVerdicts* verdicts) -> void
+{
+    const QVector<quint64> batch_keys =
+        keys.size() == entries.size() ? keys : LogDedupeSet::get_keys(entries);
+    const QBitArray duplicates = m_dedupe.mark_duplicates(entries, batch_keys);
+    const qsizetype dropped = duplicates.count(true);
+
+    if (dropped > 0)
+    {
+        const qsizetype kept_size = entries.size() - dropped;
+        const bool has_bits = verdicts != nullptr && verdicts->accepted.size() == entries.size() &&
+                              verdicts->undecided.size() == entries.size();
+        QVector<LogEntry> kept;
+        QVector<quint64> kept_keys;
+        QBitArray accepted(has_bits ? kept_size : 0);
+        QBitArray undecided(has_bits ? kept_size : 0);
+        kept.reserve(kept_size);
+        kept_keys.reserve(kept_size);
+
+        for (qsizetype i = 0; i < entries.size(); ++i)
+        {
+            const LogEntry& entry = entries.at(i);
+
+            if (!duplicates.testBit(i))
+            {
+                if (has_bits)
+                {
+                    accepted.setBit(kept.size(), verdicts->accepted.testBit(i));
+                    undecided.setBit(kept.size(), verdicts->undecided.testBit(i));
+                }
+
+                kept.append(entry);
+                kept_keys.append(batch_keys.at(i));
+            }
+            else if (has_bits)
+            {
+                verdicts->counts.add_entry(entry, -1);
+
+                if (verdicts->accepted.testBit(i))
+                {
+                    verdicts->accepted_counts.add_entry(entry, -1);
+                }
+            }
+        }
+
+        entries = kept;
+
+        if (verdicts != nullptr)
+        {
+            verdicts->accepted = accepted;
+            verdicts->undecided = undecided;
+            verdicts->entry_keys = kept_keys;
+        }
+    }
+}
+
+/**
+ * @brief Sizes the dedupe set for a file about to be loaded into the view.
+ * @param file_path The file path.
+ */
+auto LogViewContext::reserve_dedupe(const QString& file_path) -> void
+{
+    if (m_dedupe_enabled)
+    {
+        m_dedupe.reserve(LogDedupeSet::estimate_entries(QFileInfo(file_path).size()));
+    }
+}
+
+/**
+ * @brief Sets the baseline entries are tagged against.
+ * @param baseline The baseline, or nullptr to remove the tags.
+ */
+auto LogViewContext::set_baseline(std::shared_ptr<const LogBaseline> baseline) -> void
+{
+    if (baseline != m_baseline)
+    {
+        m_baseline = std::move(baseline);
+        start_retag();
+    }
+}
+
+/**
+ * @brief Returns the baseline entries are tagged against.
+ * @return The baseline, or nullptr.
+ */
+auto LogViewContext::get_baseline() const -> std::shared_ptr<const LogBaseline>
+{
+    return m_baseline;
+}
+
+/**
+ * @brief Tags entries against the view's baseline, or removes their tags without one.
+ * @param entries The entries.
+ */
+auto LogViewContext::tag_entries(QVector<LogEntry>& entries) const -> void
+{
+    if (m_baseline != nullptr)
+    {
+        m_baseline->tag_entries(entries);
+    }
+    else
+    {
+        LogBaseline::clear_tags(entries);
+    }
+}
+
+/**
+ * @brief Tags the model's rows against the baseline on the worker, cancelling a running retag.
+ *
+ * Without rows there is nothing to tag, and the proxy gets the baseline right away.
+ */
+auto LogViewContext::start_retag() -> void
+{
+    m_retag_token.cancel();
+    m_retag_token = TaskToken();
+    ++m_retag_generation;
+
+    if (m_model != nullptr && m_model->rowCount() > 0)
+    {
+        const LogEntryStore::Snapshot snapshot = m_model->get_snapshot();
+        const std::shared_ptr<const LogBaseline> baseline = m_baseline;
+        const TaskToken token = m_retag_token;
+        const quint64 generation = m_retag_generation;
+
+        m_pool->start([this, snapshot, baseline, token, generation]() {
+            QBitArray tags(snapshot.size());
+
+            for (int row = 0; row < snapshot.size() && !token.is_cancelled(); ++row)
+            {
+                if (baseline != nullptr && baseline->is_novel(snapshot.at(row)))
+                {
+                    tags.setBit(row);
+                }
+            }
+
+            if (!token.is_cancelled())
+            {
+                const quint64 epoch = snapshot.get_epoch();
+                QMetaObject::invokeMethod(
+                    this,
+                    [this, generation, epoch, tags]() { apply_retag(generation, epoch, tags); },
+                    Qt::QueuedConnection);
+            }
+        });
+    }
+    else if (m_sort_proxy != nullptr)
+    {
+        m_sort_proxy->set_baseline(m_baseline);
+    }
+}
+
+/**
+ * @brief Applies the tags of a finished retag if it is still current.
+ *
+ * Rows appended since the snapshot were tagged against the new baseline when appended, so only
+ * the snapshot's rows are updated.
+ *
+ * @param generation The retag the tags were computed for.
+ * @param epoch The store epoch of the tagged snapshot.
+ * @param tags One bit per tagged row.
+ */
+auto LogViewContext::apply_retag(quint64 generation, quint64 epoch, const QBitArray& tags) -> void
+{
+    if (generation == m_retag_generation && m_model != nullptr)
+    {
+        if (m_model->get_snapshot().get_epoch() == epoch)
+        {
+            m_model->set_novel_tags(tags);
+
+            if (m_sort_proxy != nullptr)
+            {
+                m_sort_proxy->set_baseline(m_baseline);
+            }
+        }
+        else
+        {
+            start_retag();
+        }
+    }
+}
+
+/**
+ * @brief Seeds a dedupe set with the model's rows on the worker, cancelling a running seeding.
+ *
+ * The set is sized for the loaded files, which may still be streaming. Batches appended
+ * meanwhile are checked against the keys recorded so far; they are merged into the seeded set
+ * once it is adopted. Without dedupe or rows there is nothing to seed.
+ */
+auto LogViewContext::start_dedupe_seed() -> void
+{
+    m_dedupe_token.cancel();
+    m_dedupe_token = TaskToken();
+    m_dedupe_seeding = false;
+    ++m_dedupe_generation;
+
+    if (m_dedupe_enabled && m_model != nullptr && m_model->rowCount() > 0)
+    {
+        const LogEntryStore::Snapshot snapshot = m_model->get_snapshot();
+        const TaskToken token = m_dedupe_token;
+        const quint64 generation = m_dedupe_generation;
+        qsizetype expected = 0;
+
+        for (const auto& file_info: m_loaded_files)
+        {
+            expected +=
+                LogDedupeSet::estimate_entries(QFileInfo(file_info.get_file_path()).size());
+        }
+
+        m_dedupe_seeding = true;
+
+        m_pool->start([this, snapshot, token, generation, expected]() {
+            LogDedupeSet seed;
+            // Files may still be streaming; size for whichever is larger.
+            seed.reserve(qMax<qsizetype>(expected, snapshot.size()));
+
+            for (int first = 0; first < snapshot.size() && !token.is_cancelled();
+                 first += k_dedupe_seed_chunk_rows)
+            {
+                const int last = qMin(snapshot.size(), first + k_dedupe_seed_chunk_rows);
+                seed.record_keys(snapshot, first, last);
+                token.set_progress(last, snapshot.size());
+            }
+
+            if (!token.is_cancelled())
+            {
+                const quint64 epoch = snapshot.get_epoch();
+                QMetaObject::invokeMethod(
+                    this,
+                    [this, generation, epoch, seed]() {
+                        apply_dedupe_seed(generation, epoch, seed);
+                    },
+                    Qt::QueuedConnection);
+            }
+        });
+    }
+}
+
+/**
+ * @brief Adopts the set of a finished seeding if it is still current.
+ *
+ * The keys recorded since the seeding started (batches appended meanwhile) are merged in; the
+ * seeded rows came first, so they keep their owners. If rows were replaced or removed
+ * meanwhile, the seeding starts over.
+ *
+ * @param generation The seeding the set was filled for.
+ * @param epoch The store epoch of the seeded snapshot.
+ * @param seed The keys of the snapshot's rows.
+ */
+auto LogViewContext::apply_dedupe_seed(quint64 generation, quint64 epoch,
+                                       const LogDedupeSet& seed) -> void
+{
+    if (generation == m_dedupe_generation && m_model != nullptr)
+    {
+        if (m_model->get_snapshot().get_epoch() == epoch)
+        {
+            const LogDedupeSet appended = m_dedupe;
+            m_dedupe = seed;
+            m_dedupe.merge(appended);
+            m_dedupe_seeding = false;
+        }
+        else
+        {
+            start_dedupe_seed();
+        }
+    }
+}
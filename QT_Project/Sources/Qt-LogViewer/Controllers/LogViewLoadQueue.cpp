@@ -2,17 +2,34 @@
  * @file LogViewLoadQueue.cpp
  * @brief Implements the LogViewLoadQueue which coordinates per-view async log streaming.
  *
- * The queue stores (view_id, file_path) pairs and ensures only one stream is active at a time.
+ * The queue stores pending (view_id, file_path) items and runs at most one stream per loader,
+ * with per-device concurrency limits deciding which pending item may start.
  */
 
 #include "Qt-LogViewer/Controllers/LogViewLoadQueue.h"
 
 #include <QDebug>
+#include <QFileInfo>
 #include <QList>
 
 // Concrete include for forward-declared type
 #include "Qt-LogViewer/Services/LogLoadingService.h"
 
+namespace
+{
+// Batch size reported while no stream is active.
+constexpr qsizetype k_default_batch_size = 1000;
+}  // namespace
+
+/**
+ * @brief Sets the registry active streams are registered with (not owned).
+ * @param registry The task registry, or nullptr.
+ */
+auto LogViewLoadQueue::set_task_registry(TaskRegistry* registry) -> void
+{
+    m_registry = registry;
+}
+
 /**
  * @brief Enqueues a file to be streamed for a specific view.
  * @param view_id Target view id.
@@ -20,15 +37,21 @@
  */
 auto LogViewLoadQueue::enqueue(const QUuid& view_id, const QString& file_path) -> void
 {
+    bool already_active = false;
     bool already_pending = false;
-    const bool already_active = (m_active_view_id == view_id) && (m_active_file_path == file_path);
+
+    for (const auto& active: m_active)
+    {
+        already_active = already_active ||
+                         ((active.view_id == view_id) && (active.file_path == file_path));
+    }
 
     if (!already_active)
     {
         for (const auto& item: m_queue)
         {
-            const bool same_view = (item.first == view_id);
-            const bool same_path = (item.second == file_path);
+            const bool same_view = (item.view_id == view_id);
+            const bool same_path = (item.file_path == file_path);
             if (same_view && same_path)
             {
                 already_pending = true;
@@ -40,9 +63,12 @@ auto LogViewLoadQueue::enqueue(const QUuid& view_id, const QString& file_path) -
 
     if (should_enqueue)
     {
-        m_queue.append(qMakePair(view_id, file_path));
+        const StorageDevice::Info device = get_device(file_path);
+        m_scheduler.register_device(device);
+        m_queue.append(PendingItem{view_id, file_path, device.key});
         qDebug().nospace() << "[Queue] enqueue view=" << view_id.toString() << " file=\""
-                           << file_path << "\" size=" << m_queue.size();
+                           << file_path << "\" device=" << device.name
+                           << " sequential=" << device.sequential << " size=" << m_queue.size();
     }
     else
     {
@@ -53,7 +79,7 @@ auto LogViewLoadQueue::enqueue(const QUuid& view_id, const QString& file_path) -
 }
 
 /**
- * @brief Attempts to start the next async stream if none is active.
+ * @brief Attempts to start the next async stream on a loader without an active stream.
  * @param loader Loader service to start the stream.
  * @param batch_size Entries per emitted batch for the next stream.
  * @return True if a new stream started; false otherwise.
@@ -63,55 +89,82 @@ auto LogViewLoadQueue::try_start_next(LogLoadingService* loader, qsizetype batch
     bool started = false;
 
     const bool has_loader = (loader != nullptr);
-    const bool is_idle = m_active_file_path.isEmpty();
+    const bool is_idle = has_loader && !is_active(loader);
     const bool has_pending = !m_queue.isEmpty();
+    const qsizetype next_index = find_next_pending();
 
-    if (has_loader && is_idle && has_pending)
+    if (has_loader && is_idle && next_index >= 0)
     {
-        const QPair<QUuid, QString> next_item = m_queue.front();
-        m_queue.pop_front();
+        const PendingItem next_item = m_queue.takeAt(next_index);
 
-        m_active_view_id = next_item.first;
-        m_active_file_path = next_item.second;
+        ActiveItem active;
+        active.loader = loader;
+        active.view_id = next_item.view_id;
+        active.file_path = next_item.file_path;
+        active.device_key = next_item.device_key;
+        active.concurrency = m_scheduler.on_started(next_item.device_key);
+        active.timer.start();
         m_active_batch_size = batch_size;
 
-        qDebug().nospace() << "[Queue] start_next view=" << m_active_view_id.toString()
-                           << " file=\"" << m_active_file_path << "\" batch=" << m_active_batch_size
+        qDebug().nospace() << "[Queue] start_next view=" << active.view_id.toString()
+                           << " file=\"" << active.file_path << "\" batch=" << m_active_batch_size
+                           << " device_load=" << active.concurrency << '/'
+                           << m_scheduler.get_limit(active.device_key)
                            << " pending_left=" << m_queue.size();
 
-        loader->load_log_file_async(m_active_file_path, m_active_batch_size);
+        if (m_registry != nullptr)
+        {
+            const QString name =
+                QStringLiteral("Loading %1").arg(QFileInfo(active.file_path).fileName());
+            active.token = m_registry->begin_task(name, active.view_id);
+        }
+
+        m_active.append(active);
+        loader->load_log_file_async(active.file_path, m_active_batch_size, active.token);
         started = true;
     }
     else
     {
         qDebug().nospace() << "[Queue] start_next skipped has_loader=" << has_loader
                            << " is_idle=" << is_idle << " has_pending=" << has_pending
-                           << " pending=" << m_queue.size()
-                           << " active_view=" << m_active_view_id.toString() << " active_file=\""
-                           << m_active_file_path << "\"";
+                           << " device_ready=" << (next_index >= 0)
+                           << " pending=" << m_queue.size() << " active=" << m_active.size();
     }
 
     return started;
 }
 
+/**
+ * @brief Returns the view of the file try_start_next() would start now.
+ *
+ * Lets the caller configure the loader for that view before the stream starts.
+ *
+ * @return The view id, or a null id if no pending file can start.
+ */
+auto LogViewLoadQueue::get_next_view_id() const -> QUuid
+{
+    const qsizetype next_index = find_next_pending();
+    return (next_index >= 0) ? m_queue.at(next_index).view_id : QUuid();
+}
+
 /**
  * @brief Clears all pending items for the specified view.
  * @param view_id Target view id.
  */
 auto LogViewLoadQueue::clear_pending_for_view(const QUuid& view_id) -> void
 {
-    QList<QPair<QUuid, QString>> kept;
+    QList<PendingItem> kept;
 
     for (const auto& item: m_queue)
     {
-        const bool keep_item = (item.first != view_id);
+        const bool keep_item = (item.view_id != view_id);
         if (keep_item)
         {
             kept.append(item);
         }
     }
 
-    const int removed = m_queue.size() - kept.size();
+    const auto removed = m_queue.size() - kept.size();
     m_queue = kept;
 
     qDebug().nospace() << "[Queue] clear_pending_for_view view=" << view_id.toString()
@@ -119,23 +172,24 @@ auto LogViewLoadQueue::clear_pending_for_view(const QUuid& view_id) -> void
 }
 
 /**
- * @brief Cancels the active stream if it belongs to the specified view and clears pendings.
+ * @brief Cancels the loader's active stream if it belongs to the specified view and clears
+ *        pendings.
  * @param loader Loader service used to cancel the active stream if needed.
  * @param view_id Target view id.
  */
 auto LogViewLoadQueue::cancel_if_active(LogLoadingService* loader, const QUuid& view_id) -> void
 {
-    const bool same_view = (m_active_view_id == view_id);
-    const bool can_cancel = same_view && (loader != nullptr);
+    const qsizetype index = find_active(loader);
+    const bool can_cancel =
+        (loader != nullptr) && (index >= 0) && (m_active.at(index).view_id == view_id);
 
     if (can_cancel)
     {
         qDebug().nospace() << "[Queue] cancel active view=" << view_id.toString() << " file=\""
-                           << m_active_file_path << "\"";
+                           << m_active.at(index).file_path << "\"";
+        m_active.at(index).token.cancel();
         loader->cancel_async();
-        m_active_view_id = QUuid();
-        m_active_file_path = QString();
-        m_active_batch_size = 1000;
+        finish_active(index);
     }
 
     clear_pending_for_view(view_id);
@@ -147,52 +201,105 @@ auto LogViewLoadQueue::cancel_if_active(LogLoadingService* loader, const QUuid&
  */
 auto LogViewLoadQueue::clear_active_if(const QString& file_path) -> void
 {
-    const bool is_match = (file_path == m_active_file_path);
+    qsizetype index = -1;
 
-    if (is_match)
+    for (qsizetype i = 0; i < m_active.size() && index < 0; ++i)
+    {
+        if (m_active.at(i).file_path == file_path)
+        {
+            index = i;
+        }
+    }
+
+    if (index >= 0)
     {
         qDebug().nospace() << "[Queue] clear_active_if match file=\"" << file_path << "\"";
-        m_active_view_id = QUuid();
-        m_active_file_path = QString();
-        m_active_batch_size = 1000;
+        finish_active(index);
     }
     else
     {
         qDebug().nospace() << "[Queue] clear_active_if no-match file=\"" << file_path
-                           << "\" active_file=\"" << m_active_file_path << "\"";
+                           << "\" active_file=\"" << get_active_file_path() << "\"";
     }
 }
 
 /**
- * @brief Unconditionally clears the active stream state.
+ * @brief Unconditionally clears the active stream state of all loaders.
  */
 auto LogViewLoadQueue::clear_active() -> void
 {
-    qDebug().nospace() << "[Queue] clear_active force idle (was view="
-                       << m_active_view_id.toString() << " file=\"" << m_active_file_path << "\")";
-    m_active_view_id = QUuid();
-    m_active_file_path = QString();
-    m_active_batch_size = 1000;
+    qDebug().nospace() << "[Queue] clear_active force idle (was active=" << m_active.size()
+                       << " view=" << get_active_view_id().toString() << ")";
+
+    while (!m_active.isEmpty())
+    {
+        finish_active(m_active.size() - 1);
+    }
 }
 
 /**
- * @brief Returns the active view id (empty if none).
- * @return The currently active view id, or a null QUuid if idle.
+ * @brief Unconditionally clears the active stream state of one loader.
+ * @param loader The loader that became idle.
+ */
+auto LogViewLoadQueue::clear_active(const LogLoadingService* loader) -> void
+{
+    const qsizetype index = find_active(loader);
+
+    if (index >= 0)
+    {
+        qDebug().nospace() << "[Queue] clear_active force idle (was view="
+                           << m_active.at(index).view_id.toString() << " file=\""
+                           << m_active.at(index).file_path << "\")";
+        finish_active(index);
+    }
+}
+
+/**
+ * @brief Returns the view id of the oldest active stream (empty if none).
+ * @return The active view id, or a null QUuid if idle.
  */
 auto LogViewLoadQueue::get_active_view_id() const -> QUuid
 {
-    auto result = m_active_view_id;
-    return result;
+    return m_active.isEmpty() ? QUuid() : m_active.first().view_id;
 }
 
 /**
- * @brief Returns the active file path (empty if none).
- * @return The currently active file path, or empty if idle.
+ * @brief Returns the view id of a loader's active stream.
+ * @param loader The loader.
+ * @return The active view id, or a null QUuid if the loader is idle.
+ */
+auto LogViewLoadQueue::get_active_view_id(const LogLoadingService* loader) const -> QUuid
+{
+    const qsizetype index = find_active(loader);
+    return (index >= 0) ? m_active.at(index).view_id : QUuid();
+}
+
+/**
+ * @brief Returns the file path of the oldest active stream (empty if none).
+ * @return The active file path, or empty if idle.
  */
 auto LogViewLoadQueue::get_active_file_path() const -> QString
 {
-    auto result = m_active_file_path;
-    return result;
+    return m_active.isEmpty() ? QString() : m_active.first().file_path;
+}
+
+/**
+ * @brief Returns the number of active streams.
+ * @return The number of loaders with an active stream.
+ */
+auto LogViewLoadQueue::get_active_count() const -> int
+{
+    return static_cast<int>(m_active.size());
+}
+
+/**
+ * @brief Checks whether a loader has an active stream.
+ * @param loader The loader.
+ * @return True if the loader is streaming.
+ */
+auto LogViewLoadQueue::is_active(const LogLoadingService* loader) const -> bool
+{
+    return find_active(loader) >= 0;
 }
 
 /**
@@ -201,8 +308,7 @@ auto LogViewLoadQueue::get_active_file_path() const -> QString
  */
 auto LogViewLoadQueue::get_pending_count() const -> int
 {
-    auto result = m_queue.size();
-    return result;
+    return static_cast<int>(m_queue.size());
 }
 
 /**
@@ -214,3 +320,93 @@ auto LogViewLoadQueue::get_active_batch_size() const -> qsizetype
     auto result = m_active_batch_size;
     return result;
 }
+
+/**
+ * @brief Returns the per-device scheduling state.
+ * @return One entry per device that files were enqueued from.
+ */
+auto LogViewLoadQueue::get_device_metrics() const -> QVector<DeviceIoScheduler::DeviceMetrics>
+{
+    return m_scheduler.get_metrics();
+}
+
+/**
+ * @brief Ends an active stream: reports it to the scheduler and the task registry.
+ * @param index Index into m_active.
+ */
+auto LogViewLoadQueue::finish_active(qsizetype index) -> void
+{
+    const ActiveItem active = m_active.takeAt(index);
+
+    // The worker reports the bytes it parsed to the token, also for cancelled loads.
+    m_scheduler.on_finished(active.device_key, active.token.get_progress_done(),
+                            active.timer.nsecsElapsed(), active.concurrency);
+
+    if (m_registry != nullptr)
+    {
+        m_registry->end_task(active.token);
+    }
+
+    if (m_active.isEmpty())
+    {
+        m_active_batch_size = k_default_batch_size;
+    }
+}
+
+/**
+ * @brief Returns the index of the oldest pending file whose device can start a stream.
+ * @return The index into m_queue, or -1.
+ */
+auto LogViewLoadQueue::find_next_pending() const -> qsizetype
+{
+    qsizetype index = -1;
+
+    for (qsizetype i = 0; i < m_queue.size() && index < 0; ++i)
+    {
+        if (m_scheduler.can_start(m_queue.at(i).device_key))
+        {
+            index = i;
+        }
+    }
+
+    return index;
+}
+
+/**
+ * @brief Returns the index of a loader's active stream.
+ * @param loader The loader.
+ * @return The index into m_active, or -1.
+ */
+auto LogViewLoadQueue::find_active(const LogLoadingService* loader) const -> qsizetype
+{
+    qsizetype index = -1;
+
+    for (qsizetype i = 0; i < m_active.size() && index < 0; ++i)
+    {
+        if (m_active.at(i).loader == loader)
+        {
+            index = i;
+        }
+    }
+
+    return index;
+}
+
+/**
+ * @brief Returns the device of a file, probing it once per directory.
+ * @param file_path The file.
+ * @return The device description.
+ */
+auto LogViewLoadQueue::get_device(const QString& file_path) -> StorageDevice::Info
+{
+    // absolutePath() only resolves the string; it does not touch the file system.
+    const QString dir_path = QFileInfo(file_path).absolutePath();
+    auto it = m_devices_by_dir.constFind(dir_path);
+
+    if (it == m_devices_by_dir.cend())
+    {
+        it = m_devices_by_dir.insert(dir_path, StorageDevice::probe(file_path));
+    }
+
+    return it.value();
+}
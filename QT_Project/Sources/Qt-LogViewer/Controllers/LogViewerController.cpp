@@ -19,8 +19,16 @@
 #include "Qt-LogViewer/Models/LogModel.h"
 #include "Qt-LogViewer/Models/LogSortFilterProxyModel.h"
 #include "Qt-LogViewer/Models/PagingProxyModel.h"
+#include "Qt-LogViewer/Services/LogBaselineBuilder.h"
 #include "Qt-LogViewer/Services/LogLoader.h"
 #include "Qt-LogViewer/Services/LogLoadingService.h"
+#include "Qt-LogViewer/Services/TaskRegistry.h"
+
+namespace
+{
+// Entries per batch when files are streamed again after a removal.
+constexpr qsizetype k_reload_batch_size = 1000;
+}  // namespace
 
 /**
  * @brief Constructs a LogViewerController.
@@ -30,11 +38,15 @@
 LogViewerController::LogViewerController(const QString& log_format, QObject* parent)
     : QObject(parent),
       m_is_shutting_down(false),
+      m_tasks(new TaskRegistry(this)),
       m_ingest(new LogIngestController(log_format, this)),
       m_catalog(new FileCatalogController(m_ingest, this)),
       m_views(new ViewRegistry(this)),
-      m_filters(new FilterCoordinator(m_views, this))
+      m_filters(new FilterCoordinator(m_views, this)),
+      m_baseline_builder(new LogBaselineBuilder(this))
 {
+    m_ingest->set_task_registry(m_tasks);
+
     connect(m_views, &ViewRegistry::current_view_id_changed, this,
             [this](const QUuid& view_id) { emit current_view_id_changed(view_id); });
     connect(m_views, &ViewRegistry::view_removed, this,
@@ -44,9 +56,21 @@ LogViewerController::LogViewerController(const QString& log_format, QObject* par
                 emit view_file_paths_changed(view_id, paths);
             });
 
-    // Batch parsed: append to the active view context.
+    // Baseline built: tag the entries of all views against it.
+    connect(m_baseline_builder, &LogBaselineBuilder::progress, this,
+            &LogViewerController::baseline_progress);
+    connect(m_baseline_builder, &LogBaselineBuilder::finished, this, [this]() {
+        if (!m_is_shutting_down)
+        {
+            m_views->set_baseline(m_baseline_builder->get_baseline());
+            emit baseline_changed();
+        }
+    });
+
+    // Batch parsed: append to the active view context, reusing the workers' filter verdicts.
     connect(m_ingest, &LogIngestController::entry_batch_parsed, this,
-            [this](const QUuid& view_id, const QString& file_path, const QVector<LogEntry>& batch) {
+            [this](const QUuid& view_id, const QString& file_path, const QVector<LogEntry>& batch,
+                   const LogFilter::BatchVerdicts& verdicts) {
                 if (!m_is_shutting_down)
                 {
                     qDebug().nospace() << "[Controller] batch for view=" << view_id.toString()
@@ -55,9 +79,15 @@ LogViewerController::LogViewerController(const QString& log_format, QObject* par
                     if (!view_id.isNull())
                     {
                         auto* ctx = m_views->get_context(view_id);
-                        if (ctx != nullptr)
+                        if (ctx != nullptr && !ctx->append_entries(batch, verdicts))
                         {
-                            ctx->append_entries(batch);
+                            // The filter changed since the workers got it (or they never did):
+                            // hand them the view's current settings for the following batches.
+                            const LogFilter::Spec spec = ctx->get_sort_proxy()->get_filter_spec();
+                            if (spec != verdicts.spec)
+                            {
+                                m_ingest->set_view_filter(view_id, spec);
+                            }
                         }
                     }
                 }
@@ -116,33 +146,19 @@ LogViewerController::LogViewerController(const QString& log_format, QObject* par
             });
 
     // Advance queue only after thread cleanup (safe to start next).
-    connect(m_ingest, &LogIngestController::idle, this, [this]() {
-        if (!m_is_shutting_down)
-        {
-            qDebug().nospace() << "[Controller] streaming_idle: force idle then try start next. "
-                               << "pending=" << m_ingest->get_pending_count();
-
-            // Start next first, then read new active view id (fix ordering).
-            const bool started = (m_ingest->start_next_if_idle(m_ingest->get_active_batch_size()),
-                                  !m_ingest->get_active_view_id().isNull());
-
-            if (started)
-            {
-                const QUuid new_active = m_ingest->get_active_view_id();
-                qDebug().nospace() << "[Controller] started next view=" << new_active.toString()
-                                   << " file=\"" << m_ingest->get_active_file_path() << '"';
-
-                if (!new_active.isNull() && (m_views->get_current_view() != new_active))
+    connect(m_ingest, &LogIngestController::idle, this,
+            [this](const QVector<QUuid>& started_view_ids) {
+                if (!m_is_shutting_down)
                 {
-                    m_views->set_current_view(new_active);
+                    qDebug().nospace() << "[Controller] streaming_idle: started="
+                                       << started_view_ids.size()
+                                       << " pending=" << m_ingest->get_pending_count();
+
+                    // Only loads started right now are followed; other lanes may still be busy
+                    // with loads the user has already seen start.
+                    follow_started_loads(started_view_ids);
                 }
-            }
-            else
-            {
-                qDebug().nospace() << "[Controller] no next item started (idle or empty queue).";
-            }
-        }
-    });
+            });
 }
 
 /**
@@ -152,6 +168,9 @@ LogViewerController::LogViewerController(const QString& log_format, QObject* par
 LogViewerController::~LogViewerController()
 {
     m_is_shutting_down = true;
+
+    // Flags only; workers stop at their next chunk and are joined by their owners.
+    m_tasks->cancel_all();
 }
 
 /**
@@ -162,6 +181,10 @@ LogViewerController::~LogViewerController()
 auto LogViewerController::set_current_view(const QUuid& view_id) -> bool
 {
     bool success = m_views->set_current_view(view_id);
+
+    // A view the user switched to is no longer a background prefetch.
+    m_background_view_ids.remove(view_id);
+
     return success;
 }
 
@@ -177,7 +200,7 @@ auto LogViewerController::get_current_view() const -> QUuid
 
 /**
  * @brief Returns all registered view ids.
- * @return Vector of QUuid representing all views currently tracked.
+ * @return Vector of QUuid representing all views currently tracked (deferred views last).
  */
 auto LogViewerController::get_all_view_ids() const -> QVector<QUuid>
 {
@@ -188,6 +211,11 @@ auto LogViewerController::get_all_view_ids() const -> QVector<QUuid>
         ids = m_views->get_all_view_ids();
     }
 
+    for (const auto& deferred: m_deferred_views)
+    {
+        ids.append(deferred.state.id);
+    }
+
     return ids;
 }
 
@@ -203,8 +231,20 @@ auto LogViewerController::remove_view(const QUuid& view_id) -> bool
     if (removed)
     {
         cancel_loading(view_id);
+        m_tasks->cancel_owner(view_id);
+    }
+    else
+    {
+        const qsizetype deferred_index = find_deferred_view(view_id);
+        if (deferred_index >= 0)
+        {
+            m_deferred_views.removeAt(deferred_index);
+            removed = true;
+        }
     }
 
+    m_background_view_ids.remove(view_id);
+
     return removed;
 }
 
@@ -223,6 +263,7 @@ auto LogViewerController::clear_all_views() -> void
         for (const QUuid& view_id: ids)
         {
             m_ingest->cancel_for_view(view_id);
+            m_tasks->cancel_owner(view_id);
         }
     }
 
@@ -236,6 +277,16 @@ auto LogViewerController::clear_all_views() -> void
             emit view_removed(view_id);
         }
     }
+
+    // Deferred views have tabs (placeholders) as well
+    const QVector<QUuid> deferred_ids = get_deferred_view_ids();
+    m_deferred_views.clear();
+    m_background_view_ids.clear();
+
+    for (const QUuid& view_id: deferred_ids)
+    {
+        emit view_removed(view_id);
+    }
 }
 
 /**
@@ -290,6 +341,44 @@ auto LogViewerController::add_log_files_to_session(const QString& session_id,
     }
 }
 
+/**
+ * @brief Adds a watch folder to a session in the LogFileTreeModel.
+ * @param session_id The session identifier.
+ * @param folder_path The folder path.
+ * @return True if added; false if the session already watches the folder.
+ */
+auto LogViewerController::add_watch_folder_to_session(const QString& session_id,
+                                                      const QString& folder_path) -> bool
+{
+    bool added = false;
+
+    if (m_catalog != nullptr)
+    {
+        added = m_catalog->add_watch_folder(session_id, folder_path);
+    }
+
+    return added;
+}
+
+/**
+ * @brief Removes a watch folder from a session in the LogFileTreeModel.
+ * @param session_id The session identifier.
+ * @param folder_path The folder path.
+ * @return True if removed; false if not found.
+ */
+auto LogViewerController::remove_watch_folder_from_session(const QString& session_id,
+                                                           const QString& folder_path) -> bool
+{
+    bool removed = false;
+
+    if (m_catalog != nullptr)
+    {
+        removed = m_catalog->remove_watch_folder(session_id, folder_path);
+    }
+
+    return removed;
+}
+
 /**
  * @brief Loads a single log file and creates a new view (model/proxy) for it.
  * @param file_path The LogFileInfo to load and display.
@@ -475,6 +564,122 @@ auto LogViewerController::cancel_loading(const QUuid& view_id) -> void
     m_ingest->cancel_for_view(view_id);
 }
 
+/**
+ * @brief Adds user-defined log formats used for per-file format detection.
+ * @param formats Format strings (e.g. "{timestamp} [{thread}] {level} {message}").
+ */
+auto LogViewerController::add_log_formats(const QVector<QString>& formats) -> void
+{
+    m_ingest->add_log_formats(formats);
+}
+
+/**
+ * @brief Sets the length above which log lines are truncated while streaming.
+ * @param max_line_bytes The limit in bytes; values <= 0 restore the default.
+ */
+auto LogViewerController::set_max_line_length(qsizetype max_line_bytes) -> void
+{
+    m_ingest->set_max_line_length(max_line_bytes);
+}
+
+/**
+ * @brief Enables or disables skipping entries repeated across the files of a view.
+ * @param enabled True to drop duplicates across files.
+ */
+auto LogViewerController::set_dedupe_enabled(bool enabled) -> void
+{
+    m_views->set_dedupe_enabled(enabled);
+}
+
+/**
+ * @brief Checks whether entries repeated across the files of a view are skipped.
+ * @return True if dedupe is enabled.
+ */
+auto LogViewerController::is_dedupe_enabled() const -> bool
+{
+    return m_views->is_dedupe_enabled();
+}
+
+/**
+ * @brief Returns the number of entries skipped as duplicates, per file of a view.
+ * @param view_id The view id.
+ * @return Map of file path to skipped entries (empty if the view does not exist).
+ */
+auto LogViewerController::get_duplicate_counts(const QUuid& view_id) const
+    -> QHash<QString, int>
+{
+    QHash<QString, int> result;
+    auto* ctx = m_views->get_context(view_id);
+
+    if (ctx != nullptr)
+    {
+        result = ctx->get_duplicate_counts();
+    }
+
+    return result;
+}
+
+/**
+ * @brief Builds a baseline from reference log files in the background.
+ *
+ * The reference files are parsed with the same formats as regular loads.
+ *
+ * @param file_paths The reference ("healthy") log files.
+ */
+auto LogViewerController::build_baseline(const QVector<QString>& file_paths) -> void
+{
+    m_baseline_builder->set_formats(m_ingest->get_log_formats());
+    m_baseline_builder->build(file_paths);
+}
+
+/**
+ * @brief Cancels a running baseline build and removes the baseline from all views.
+ */
+auto LogViewerController::clear_baseline() -> void
+{
+    m_baseline_builder->cancel();
+    m_views->set_baseline(nullptr);
+    emit baseline_changed();
+}
+
+/**
+ * @brief Returns the baseline entries are tagged against.
+ * @return The baseline, or nullptr.
+ */
+auto LogViewerController::get_baseline() const -> std::shared_ptr<const LogBaseline>
+{
+    return m_views->get_baseline();
+}
+
+/**
+ * @brief Checks whether a baseline is being built.
+ * @return True while reference files are being parsed.
+ */
+auto LogViewerController::is_baseline_building() const -> bool
+{
+    return m_baseline_builder->is_busy();
+}
+
+/**
+ * @brief Shows only entries absent from the baseline in the specified view.
+ * @param view_id The QUuid of the view.
+ * @param novel_only True to hide entries found in the baseline.
+ */
+auto LogViewerController::set_novel_only_filter(const QUuid& view_id, bool novel_only) -> void
+{
+    m_filters->set_novel_only(view_id, novel_only);
+}
+
+/**
+ * @brief Returns whether the specified view shows only entries absent from the baseline.
+ * @param view_id The QUuid of the view.
+ * @return True if the novelty filter is set.
+ */
+auto LogViewerController::is_novel_only_filter(const QUuid& view_id) const -> bool
+{
+    return m_filters->is_novel_only(view_id);
+}
+
 /**
  * @brief Sets the application name filter for the current view.
  * @param app_name The application name to filter by.
@@ -603,6 +808,15 @@ auto LogViewerController::get_paging_proxy(const QUuid& view_id) -> PagingProxyM
     return paging;
 }
 
+/**
+ * @brief Returns the registry of long-running operations (loads, index builds).
+ * @return Pointer to the TaskRegistry.
+ */
+auto LogViewerController::get_task_registry() const -> TaskRegistry*
+{
+    return m_tasks;
+}
+
 /**
  * @brief Returns the set of unique application names from the loaded logs in the current view.
  * @return A set of application names.
@@ -624,7 +838,9 @@ auto LogViewerController::get_app_names(const QUuid& view_id) const -> QSet<QStr
     auto* ctx = m_views->get_context(view_id);
     if (ctx != nullptr)
     {
-        for (const LogEntry& entry: ctx->get_entries())
+        const LogEntryStore::Snapshot entries = ctx->get_snapshot();
+
+        for (const LogEntry& entry: entries)
         {
             app_names.insert(entry.get_app_name());
         }
@@ -695,6 +911,18 @@ auto LogViewerController::get_log_level_counts() const -> QMap<QString, int>
     return counts;
 }
 
+/**
+ * @brief Returns the per-level, per-app and per-file counts of the entries passing the filters
+ *        of the specified view.
+ * @param view_id The QUuid of the view.
+ * @return The facet counts.
+ */
+auto LogViewerController::get_match_counts(const QUuid& view_id) const -> LogFacetCounts
+{
+    LogFacetCounts counts = m_filters->get_match_counts(view_id);
+    return counts;
+}
+
 /**
  * @brief Returns the set of log levels being filtered for the specified view.
  * @param view_id The QUuid of the view.
@@ -818,7 +1046,7 @@ auto LogViewerController::get_entries_for_file(const QUuid& view_id,
                                                const LogFileInfo& file_info) -> QVector<LogEntry>
 {
     QVector<LogEntry> result;
-    QVector<LogEntry> entries = m_views->get_entries(view_id);
+    const LogEntryStore::Snapshot entries = m_views->get_snapshot(view_id);
 
     for (const auto& entry: entries)
     {
@@ -915,7 +1143,21 @@ auto LogViewerController::hide_file(const QUuid& view_id, const QString& file_pa
  */
 auto LogViewerController::get_view_file_paths(const QUuid& view_id) const -> QVector<QString>
 {
-    QVector<QString> result = m_views->get_file_paths(view_id);
+    QVector<QString> result;
+    const qsizetype deferred_index = find_deferred_view(view_id);
+
+    if (deferred_index >= 0)
+    {
+        for (const auto& lf: m_deferred_views.at(deferred_index).state.loaded_files)
+        {
+            result.append(lf.get_file_path());
+        }
+    }
+    else
+    {
+        result = m_views->get_file_paths(view_id);
+    }
+
     return result;
 }
 
@@ -927,8 +1169,13 @@ auto LogViewerController::get_view_file_paths(const QUuid& view_id) const -> QVe
 auto LogViewerController::export_view_state(const QUuid& view_id) const -> SessionViewState
 {
     SessionViewState state;
+    const qsizetype deferred_index = find_deferred_view(view_id);
 
-    if (!view_id.isNull())
+    if (deferred_index >= 0)
+    {
+        state = m_deferred_views.at(deferred_index).state;
+    }
+    else if (!view_id.isNull())
     {
         state = m_views->export_view_state(view_id, *m_filters);
     }
@@ -1004,24 +1251,7 @@ auto LogViewerController::import_view_state_for_session(const QString& session_i
         result = m_views->import_view_state(state, *m_filters);
 
         // Update explorer tree with session context
-        if (m_catalog != nullptr && !state.loaded_files.isEmpty() && !session_id.isEmpty())
-        {
-            QVector<QString> paths;
-            paths.reserve(state.loaded_files.size());
-            for (const auto& lf: state.loaded_files)
-            {
-                const QString p = lf.get_file_path();
-                if (!p.isEmpty())
-                {
-                    paths.append(p);
-                }
-            }
-
-            if (!paths.isEmpty())
-            {
-                add_log_files_to_session(session_id, paths);
-            }
-        }
+        add_view_files_to_session(session_id, state.loaded_files);
 
         if (!result.isNull())
         {
@@ -1041,6 +1271,113 @@ auto LogViewerController::import_view_state_for_session(const QString& session_i
     return result;
 }
 
+/**
+ * @brief Registers a view state for lazy restore without creating models or loading.
+ * @param session_id The session identifier for the tree model.
+ * @param state The view state to restore later.
+ * @return The id of the deferred view (a new id if the state has none).
+ */
+auto LogViewerController::register_deferred_view(const QString& session_id,
+                                                 const SessionViewState& state) -> QUuid
+{
+    SessionViewState deferred_state = state;
+
+    if (deferred_state.id.isNull())
+    {
+        deferred_state.id = QUuid::createUuid();
+    }
+
+    add_view_files_to_session(session_id, deferred_state.loaded_files);
+    m_deferred_views.append(DeferredView{session_id, deferred_state});
+
+    return deferred_state.id;
+}
+
+/**
+ * @brief Checks whether a view is a deferred (not yet materialized) view.
+ * @param view_id The view identifier.
+ * @return True if the view is deferred.
+ */
+auto LogViewerController::is_view_deferred(const QUuid& view_id) const -> bool
+{
+    return find_deferred_view(view_id) >= 0;
+}
+
+/**
+ * @brief Returns the ids of all deferred views in registration order.
+ * @return Vector of deferred view ids.
+ */
+auto LogViewerController::get_deferred_view_ids() const -> QVector<QUuid>
+{
+    QVector<QUuid> ids;
+    ids.reserve(m_deferred_views.size());
+
+    for (const auto& deferred: m_deferred_views)
+    {
+        ids.append(deferred.state.id);
+    }
+
+    return ids;
+}
+
+/**
+ * @brief Returns the stored state of a deferred view.
+ * @param view_id The view identifier.
+ * @return The stored state, or a default state if the view is not deferred.
+ */
+auto LogViewerController::get_deferred_view_state(const QUuid& view_id) const -> SessionViewState
+{
+    SessionViewState state;
+    const qsizetype deferred_index = find_deferred_view(view_id);
+
+    if (deferred_index >= 0)
+    {
+        state = m_deferred_views.at(deferred_index).state;
+    }
+
+    return state;
+}
+
+/**
+ * @brief Creates models for a deferred view, applies its state and queues its files.
+ * @param view_id The deferred view identifier.
+ * @param background True for idle prefetch: loads of this view never switch the current view.
+ * @return True if the view was deferred and has been materialized.
+ */
+auto LogViewerController::materialize_view(const QUuid& view_id, bool background) -> bool
+{
+    bool materialized = false;
+    const qsizetype deferred_index = find_deferred_view(view_id);
+
+    if (deferred_index >= 0)
+    {
+        const DeferredView deferred = m_deferred_views.takeAt(deferred_index);
+
+        if (background)
+        {
+            m_background_view_ids.insert(view_id);
+        }
+        else
+        {
+            m_background_view_ids.remove(view_id);
+        }
+
+        // The tree already lists the files; import without touching it again.
+        materialized = !import_view_state_for_session(QString(), deferred.state).isNull();
+    }
+
+    return materialized;
+}
+
+/**
+ * @brief Checks whether no file is loading or queued for loading.
+ * @return True if the ingest pipeline is idle.
+ */
+auto LogViewerController::is_loading_idle() const -> bool
+{
+    return m_ingest->get_active_view_id().isNull() && m_ingest->get_pending_count() == 0;
+}
+
 /**
  * @brief Removes a single log file from all views and from the LogFileTreeModel.
  *        If a view becomes empty, it is deleted and view_removed() is emitted.
@@ -1065,9 +1402,12 @@ auto LogViewerController::remove_log_file(const LogFileInfo& file) -> void
                         files.end());
             ctx->set_loaded_files(files);
 
-            ctx->remove_entries_by_file_path(file.get_file_path());
+            const QStringList dropping_paths =
+                ctx->remove_entries_by_file_path(file.get_file_path());
+            reload_dropping_files(view_id, dropping_paths);
 
-            if (ctx->get_entries().isEmpty())
+            // A view whose files are being reloaded is not empty for long.
+            if (ctx->get_snapshot().is_empty() && dropping_paths.isEmpty())
             {
                 views_to_remove.append(view_id);
             }
@@ -1106,11 +1446,12 @@ auto LogViewerController::remove_log_file(const QUuid& view_id, const QString& f
 
     if (has_valid_args)
     {
-        m_views->remove_entries_by_file(view_id, file_path);
+        const QStringList dropping_paths = m_views->remove_entries_by_file(view_id, file_path);
+        reload_dropping_files(view_id, dropping_paths);
         m_filters->adjust_visibility_on_file_removed(view_id, file_path);
 
-        QVector<LogEntry> entries = m_views->get_entries(view_id);
-        view_became_empty = entries.isEmpty();
+        view_became_empty =
+            m_views->get_snapshot(view_id).is_empty() && dropping_paths.isEmpty();
 
         emit view_file_paths_changed(view_id, get_view_file_paths(view_id));
     }
@@ -1124,29 +1465,74 @@ auto LogViewerController::remove_log_file(const QUuid& view_id, const QString& f
 
 /**
  * @brief Enqueues an asynchronous load request for a log file.
+ *
+ * The view's current filter settings go along, so the parser threads can evaluate them.
+ *
  * @param view_id The QUuid of the view to load into.
  * @param file_path The path to the log file.
  */
 auto LogViewerController::enqueue_async(const QUuid& view_id, const QString& file_path) -> void
 {
+    const auto* proxy = get_sort_filter_proxy(view_id);
+    if (proxy != nullptr)
+    {
+        m_ingest->set_view_filter(view_id, proxy->get_filter_spec());
+    }
+
     m_ingest->enqueue_stream(view_id, file_path);
 }
 
 /**
- * @brief Attempts to start the next asynchronous load if none is active.
- * @param batch_size Number of entries per batch.
+ * @brief Loads files of a view again whose entries were dropped as duplicates of a removed file.
+ *
+ * With the removed file's keys gone, the files' dropped entries are no longer duplicates. Each
+ * file's remaining entries are removed and the file is streamed again; removing them may in
+ * turn name files that dropped entries as their duplicates, which are reloaded as well.
+ *
+ * @param view_id The view.
+ * @param file_paths The files that dropped entries (see LogDedupeSet::remove_file()).
  */
-auto LogViewerController::try_start_next_async(qsizetype batch_size) -> void
+auto LogViewerController::reload_dropping_files(const QUuid& view_id,
+                                                const QStringList& file_paths) -> void
 {
-    m_ingest->start_next_if_idle(batch_size);
+    auto* ctx = m_views->get_context(view_id);
+    QStringList pending = file_paths;
+    QStringList reloaded;
+
+    while (ctx != nullptr && !pending.isEmpty())
+    {
+        const QString file_path = pending.takeFirst();
+
+        if (!reloaded.contains(file_path) && ctx->get_file_paths().contains(file_path))
+        {
+            reloaded.append(file_path);
+            pending.append(ctx->remove_entries_by_file_path(file_path));
+        }
+    }
+
+    for (const QString& file_path: reloaded)
+    {
+        qInfo().nospace() << "[Controller] reloading \"" << file_path
+                          << "\" to restore entries dropped as duplicates, view="
+                          << view_id.toString();
+        enqueue_async(view_id, file_path);
+    }
 
-    const QUuid active_view_id = m_ingest->get_active_view_id();
-    if (!active_view_id.isNull() && (m_views->get_current_view() != active_view_id))
+    if (!reloaded.isEmpty())
     {
-        m_views->set_current_view(active_view_id);
+        try_start_next_async(k_reload_batch_size);
     }
 }
 
+/**
+ * @brief Attempts to start the next asynchronous load if none is active.
+ * @param batch_size Number of entries per batch.
+ */
+auto LogViewerController::try_start_next_async(qsizetype batch_size) -> void
+{
+    follow_started_loads(m_ingest->start_next_if_idle(batch_size));
+}
+
 /**
  * @brief Clears pending async requests for a specific view.
  * @param view_id The QUuid of the view.
@@ -1175,3 +1561,86 @@ auto LogViewerController::get_view_context(const QUuid& view_id) const -> LogVie
     LogViewContext* ctx = m_views->get_context(view_id);
     return ctx;
 }
+
+/**
+ * @brief Adds view files to a session's explorer tree.
+ *
+ * Files with a known app name are added directly; only files without one are read to identify
+ * their app.
+ *
+ * @param session_id The session identifier.
+ * @param files The view's files.
+ */
+auto LogViewerController::add_view_files_to_session(const QString& session_id,
+                                                    const QList<LogFileInfo>& files) -> void
+{
+    if (m_catalog != nullptr && !session_id.isEmpty())
+    {
+        QVector<QString> unidentified_paths;
+        QList<LogFileInfo> identified_files;
+
+        for (const auto& lf: files)
+        {
+            const QString path = lf.get_file_path();
+
+            if (!path.isEmpty() && lf.get_app_name().isEmpty())
+            {
+                unidentified_paths.append(path);
+            }
+            else if (!path.isEmpty())
+            {
+                identified_files.append(lf);
+            }
+        }
+
+        m_catalog->get_model()->add_log_files(session_id, identified_files);
+
+        if (!unidentified_paths.isEmpty())
+        {
+            add_log_files_to_session(session_id, unidentified_paths);
+        }
+    }
+}
+
+/**
+ * @brief Returns the index of a deferred view.
+ * @param view_id The view identifier.
+ * @return Index into m_deferred_views, or -1 if the view is not deferred.
+ */
+auto LogViewerController::find_deferred_view(const QUuid& view_id) const -> qsizetype
+{
+    qsizetype result = -1;
+
+    for (qsizetype i = 0; i < m_deferred_views.size() && result < 0; ++i)
+    {
+        if (m_deferred_views.at(i).state.id == view_id)
+        {
+            result = i;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Switches the current view to the first started load not loading in the background.
+ * @param started_view_ids The view ids of the loads just started, in start order.
+ */
+auto LogViewerController::follow_started_loads(const QVector<QUuid>& started_view_ids) -> void
+{
+    QUuid follow_view_id;
+
+    for (const auto& view_id: started_view_ids)
+    {
+        if (follow_view_id.isNull() && !view_id.isNull() &&
+            !m_background_view_ids.contains(view_id))
+        {
+            follow_view_id = view_id;
+        }
+    }
+
+    if (!follow_view_id.isNull() && m_views->get_current_view() != follow_view_id)
+    {
+        m_views->set_current_view(follow_view_id);
+    }
+}
@@ -10,6 +10,7 @@
 
 // Concrete includes for forward-declared types and value usage
 #include "Qt-LogViewer/Controllers/LogViewerController.h"
+#include "Qt-LogViewer/Models/LogFileTreeItem.h"
 #include "Qt-LogViewer/Models/LogFileTreeModel.h"
 #include "Qt-LogViewer/Models/SessionTypes.h"
 #include "Qt-LogViewer/Services/SessionManager.h"
@@ -400,6 +401,8 @@ auto SessionController::export_session_to_json() const -> QJsonObject
         }
 
         session_obj.insert(QStringLiteral("views"), views_array);
+        session_obj.insert(QStringLiteral("active_view_id"),
+                           m_controller->get_current_view().toString(QUuid::WithoutBraces));
     }
 
     // Also include files from tree model
@@ -416,6 +419,7 @@ auto SessionController::export_session_to_json() const -> QJsonObject
             explorer_files_array.append(file_obj);
         }
         session_obj.insert(QStringLiteral("explorer_files"), explorer_files_array);
+        session_obj.insert(QStringLiteral("watch_folders"), build_watch_folders_json(session_id));
     }
 
     return session_obj;
@@ -522,12 +526,15 @@ auto SessionController::collect_session_files_from_tree(const QString& session_i
         return files;
     }
 
-    // Iterate through all groups in the session
+    // Iterate through all groups in the session (watch folders are persisted by path)
     const int group_count = m_tree_model->rowCount(session_index);
     for (int g = 0; g < group_count; ++g)
     {
         const QModelIndex group_index = m_tree_model->index(g, 0, session_index);
-        const int file_count = m_tree_model->rowCount(group_index);
+        const bool is_group =
+            group_index.data(LogFileTreeModel::ItemTypeRole).value<LogFileTreeItem::Type>() ==
+            LogFileTreeItem::Type::Group;
+        const int file_count = is_group ? m_tree_model->rowCount(group_index) : 0;
 
         for (int f = 0; f < file_count; ++f)
         {
@@ -545,6 +552,27 @@ auto SessionController::collect_session_files_from_tree(const QString& session_i
     return files;
 }
 
+/**
+ * @brief Builds the JSON array of a session's watch folders.
+ * @param session_id The session identifier.
+ * @return Array of folder paths.
+ */
+auto SessionController::build_watch_folders_json(const QString& session_id) const -> QJsonArray
+{
+    QJsonArray folders_array;
+
+    if (m_tree_model != nullptr)
+    {
+        const QVector<QString> folders = m_tree_model->get_watch_folders(session_id);
+        for (const auto& folder: folders)
+        {
+            folders_array.append(folder);
+        }
+    }
+
+    return folders_array;
+}
+
 /**
  * @brief Internal implementation of session saving.
  * @param session_id The session identifier.
@@ -562,9 +590,8 @@ auto SessionController::save_session_impl(const QString& session_id,
 
     QString session_name = QStringLiteral("Session");
 
-    // Try to get existing session name
-    const QJsonObject existing_obj = m_session_manager->load_session(session_id);
-    const QString existing_name = existing_obj.value(QStringLiteral("name")).toString();
+    // Existing session name from the in-memory metadata (no file access)
+    const QString existing_name = m_session_manager->get_session_name(session_id);
     if (!existing_name.isEmpty())
     {
         session_name = existing_name;
@@ -602,7 +629,10 @@ auto SessionController::save_session_impl(const QString& session_id,
     session_obj.insert(QStringLiteral("id"), session_id);
     session_obj.insert(QStringLiteral("name"), session_name);
     session_obj.insert(QStringLiteral("views"), views_array);
+    session_obj.insert(QStringLiteral("active_view_id"),
+                       m_controller->get_current_view().toString(QUuid::WithoutBraces));
     session_obj.insert(QStringLiteral("explorer_files"), explorer_files_array);
+    session_obj.insert(QStringLiteral("watch_folders"), build_watch_folders_json(session_id));
 
     m_session_manager->save_session(session_id, session_obj);
     m_session_manager->upsert_session_metadata(session_id, session_name, false);
@@ -39,6 +39,8 @@ auto ViewRegistry::create_view() -> QUuid
 {
     QUuid view_id = QUuid::createUuid();
     auto* ctx = new LogViewContext(this);
+    ctx->set_dedupe_enabled(m_dedupe_enabled);
+    ctx->set_baseline(m_baseline);
     m_contexts[view_id] = ctx;
     return view_id;
 }
@@ -55,6 +57,8 @@ auto ViewRegistry::create_view(const QUuid& view_id) -> bool
     if (!view_id.isNull() && !m_contexts.contains(view_id))
     {
         auto* ctx = new LogViewContext(this);
+        ctx->set_dedupe_enabled(m_dedupe_enabled);
+        ctx->set_baseline(m_baseline);
         m_contexts.insert(view_id, ctx);
         created = true;
     }
@@ -178,6 +182,24 @@ auto ViewRegistry::get_entries(const QUuid& view_id) const -> QVector<LogEntry>
     return result;
 }
 
+/**
+ * @brief Return an immutable snapshot of the entries of the given view (no copy).
+ * @param view_id View id to query.
+ * @return LogEntryStore::Snapshot Snapshot (empty if none / view missing).
+ */
+auto ViewRegistry::get_snapshot(const QUuid& view_id) const -> LogEntryStore::Snapshot
+{
+    LogEntryStore::Snapshot result;
+    auto* ctx = get_context(view_id);
+
+    if (ctx != nullptr)
+    {
+        result = ctx->get_snapshot();
+    }
+
+    return result;
+}
+
 /**
  * @brief Return loaded absolute file paths for the given view.
  * @param view_id View id to query.
@@ -233,9 +255,12 @@ auto ViewRegistry::add_loaded_file(const QUuid& view_id, const LogFileInfo& file
  *        Also removes the file from the view's loaded-file list and notifies listeners.
  * @param view_id Target view id.
  * @param file_path Absolute file path to remove.
+ * @return The files of the view that dropped entries as duplicates of the removed file.
  */
-auto ViewRegistry::remove_entries_by_file(const QUuid& view_id, const QString& file_path) -> void
+auto ViewRegistry::remove_entries_by_file(const QUuid& view_id, const QString& file_path)
+    -> QStringList
 {
+    QStringList dropping_paths;
     auto* ctx = get_context(view_id);
 
     if (ctx != nullptr)
@@ -248,9 +273,57 @@ auto ViewRegistry::remove_entries_by_file(const QUuid& view_id, const QString& f
                     files.end());
 
         ctx->set_loaded_files(files);
-        ctx->remove_entries_by_file_path(file_path);
+        dropping_paths = ctx->remove_entries_by_file_path(file_path);
         emit view_file_paths_changed(view_id, ctx->get_file_paths());
     }
+
+    return dropping_paths;
+}
+
+/**
+ * @brief Enable or disable dropping duplicate entries across the files of each view.
+ * @param enabled True to drop duplicates across files.
+ */
+auto ViewRegistry::set_dedupe_enabled(bool enabled) -> void
+{
+    m_dedupe_enabled = enabled;
+
+    for (auto* ctx: std::as_const(m_contexts))
+    {
+        ctx->set_dedupe_enabled(enabled);
+    }
+}
+
+/**
+ * @brief Return whether views drop duplicate entries across their files.
+ * @return True if dedupe is enabled.
+ */
+auto ViewRegistry::is_dedupe_enabled() const -> bool
+{
+    return m_dedupe_enabled;
+}
+
+/**
+ * @brief Set the baseline the entries of every view are tagged against.
+ * @param baseline The baseline, or nullptr to remove the tags.
+ */
+auto ViewRegistry::set_baseline(const std::shared_ptr<const LogBaseline>& baseline) -> void
+{
+    m_baseline = baseline;
+
+    for (auto* ctx: std::as_const(m_contexts))
+    {
+        ctx->set_baseline(baseline);
+    }
+}
+
+/**
+ * @brief Return the baseline the entries of every view are tagged against.
+ * @return The baseline, or nullptr.
+ */
+auto ViewRegistry::get_baseline() const -> std::shared_ptr<const LogBaseline>
+{
+    return m_baseline;
 }
 
 /**
@@ -344,7 +417,8 @@ auto ViewRegistry::import_view_state(const SessionViewState& state,
             }
             if (state.current_page > 0)
             {
-                paging->set_current_page(state.current_page);
+                // The view is still empty here; the page applies once loading reaches it.
+                paging->set_restore_page(state.current_page);
             }
         }
 
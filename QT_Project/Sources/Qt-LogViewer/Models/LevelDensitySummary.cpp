@@ -0,0 +1,485 @@
+/**
+ * @file LevelDensitySummary.cpp
+ * @brief This file contains the implementation of the LevelDensitySummary class.
+ */
+
+#include "Qt-LogViewer/Models/LevelDensitySummary.h"
+
+#include <QTimer>
+
+#include "Qt-LogViewer/Models/LogModel.h"
+#include "Qt-LogViewer/Models/LogSortFilterProxyModel.h"
+#include "Qt-LogViewer/Services/TaskRegistry.h"
+
+namespace
+{
+// More buckets than any minimap has pixel rows, few enough to paint in microseconds.
+constexpr int k_max_bucket_count = 2048;
+
+// Rows summarized per event loop turn during a rebuild.
+constexpr int k_rebuild_chunk_rows = 50000;
+
+// A bucket grown this many times its nominal size by insertions triggers a rebuild.
+constexpr int k_max_bucket_growth = 4;
+}  // namespace
+
+/**
+ * @brief Constructs a LevelDensitySummary.
+ * @param parent Optional QObject parent.
+ */
+LevelDensitySummary::LevelDensitySummary(QObject* parent)
+    : QObject(parent), m_rebuild_timer(new QTimer(this))
+{
+    m_rebuild_timer->setSingleShot(true);
+    m_rebuild_timer->setInterval(0);
+    connect(m_rebuild_timer, &QTimer::timeout, this, &LevelDensitySummary::rebuild_next_chunk);
+}
+
+/**
+ * @brief Cancels a running rebuild task.
+ *
+ * The registry is not called: it may already be gone. It ends the task once the token is
+ * dropped (see TaskRegistry).
+ */
+LevelDensitySummary::~LevelDensitySummary()
+{
+    m_rebuild_token.cancel();
+}
+
+/**
+ * @brief Sets the registry rebuilds are reported to.
+ * @param registry The task registry (not owned), or nullptr.
+ * @param owner The owner of the rebuild tasks (the view id).
+ */
+auto LevelDensitySummary::set_task_registry(TaskRegistry* registry, const QUuid& owner) -> void
+{
+    end_rebuild_task();
+    m_registry = registry;
+    m_owner = owner;
+
+    if (m_rebuilding && m_registry != nullptr)
+    {
+        m_rebuild_token = m_registry->begin_task(QStringLiteral("Indexing level density"), m_owner);
+    }
+}
+
+/**
+ * @brief Sets the view to summarize and starts a rebuild.
+ * @param model The filtered and sorted view (its source must be a LogModel), or nullptr.
+ */
+auto LevelDensitySummary::set_model(LogSortFilterProxyModel* model) -> void
+{
+    if (m_model != nullptr)
+    {
+        disconnect(m_model, nullptr, this, nullptr);
+    }
+
+    m_model = model;
+    m_search_active = (m_model != nullptr) && m_model->is_search_active();
+
+    if (m_model != nullptr)
+    {
+        connect(m_model, &QAbstractItemModel::rowsInserted, this,
+                &LevelDensitySummary::handle_rows_inserted);
+        connect(m_model, &QAbstractItemModel::rowsAboutToBeRemoved, this,
+                &LevelDensitySummary::handle_rows_about_to_be_removed);
+
+        // Filter changes end with new match counts; the search may have been set or cleared.
+        connect(m_model, &LogSortFilterProxyModel::match_counts_changed, this,
+                &LevelDensitySummary::handle_search_changed);
+
+        // Changes that move rows around are not tracked per row.
+        connect(m_model, &QAbstractItemModel::modelReset, this,
+                &LevelDensitySummary::schedule_rebuild);
+        connect(m_model, &QAbstractItemModel::layoutChanged, this,
+                &LevelDensitySummary::schedule_rebuild);
+        connect(m_model, &QAbstractItemModel::rowsMoved, this,
+                &LevelDensitySummary::schedule_rebuild);
+    }
+
+    schedule_rebuild();
+}
+
+/**
+ * @brief Returns the summarized view.
+ * @return The model, or nullptr.
+ */
+auto LevelDensitySummary::get_model() const -> LogSortFilterProxyModel*
+{
+    return m_model;
+}
+
+/**
+ * @brief Returns the buckets in row order.
+ * @return The buckets; their row counts add up to get_row_count().
+ */
+auto LevelDensitySummary::get_buckets() const -> const QVector<Bucket>&
+{
+    return m_buckets;
+}
+
+/**
+ * @brief Returns the number of search hits in a bucket.
+ *
+ * The view keeps only rows matching its search, so every row of a bucket is a hit.
+ *
+ * @param bucket A bucket of get_buckets().
+ * @return The bucket's row count while the view has a search, otherwise 0.
+ */
+auto LevelDensitySummary::get_hit_count(const Bucket& bucket) const -> int
+{
+    return (m_model != nullptr && m_model->is_search_active()) ? bucket.row_count : 0;
+}
+
+/**
+ * @brief Returns the number of summarized rows.
+ * @return The row count.
+ */
+auto LevelDensitySummary::get_row_count() const -> int
+{
+    return m_row_count;
+}
+
+/**
+ * @brief Returns the nominal number of rows per bucket.
+ * @return The bucket size (a power of two).
+ */
+auto LevelDensitySummary::get_rows_per_bucket() const -> int
+{
+    return m_rows_per_bucket;
+}
+
+/**
+ * @brief Returns the upper bound of the bucket count.
+ * @return The maximum number of buckets.
+ */
+auto LevelDensitySummary::get_max_bucket_count() -> int
+{
+    return k_max_bucket_count;
+}
+
+/**
+ * @brief Checks whether a chunked rebuild is in progress.
+ * @return True while the buckets do not cover the whole view yet.
+ */
+auto LevelDensitySummary::is_rebuilding() const -> bool
+{
+    return m_rebuilding;
+}
+
+/**
+ * @brief Maps a log level to its lane.
+ * @param level The log level of a row.
+ * @return The lane index.
+ */
+auto LevelDensitySummary::to_level(SimpleCppLogger::LogLevel level) -> Level
+{
+    Level lane = Info;
+
+    switch (level)
+    {
+    case SimpleCppLogger::LogLevel::Trace: {
+        lane = Trace;
+        break;
+    }
+    case SimpleCppLogger::LogLevel::Debug: {
+        lane = Debug;
+        break;
+    }
+    case SimpleCppLogger::LogLevel::Warning: {
+        lane = Warning;
+        break;
+    }
+    case SimpleCppLogger::LogLevel::Error: {
+        lane = Error;
+        break;
+    }
+    case SimpleCppLogger::LogLevel::Fatal: {
+        lane = Fatal;
+        break;
+    }
+    default: {
+        break;
+    }
+    }
+
+    return lane;
+}
+
+/**
+ * @brief Discards the buckets and schedules a chunked rebuild from the first row.
+ */
+auto LevelDensitySummary::schedule_rebuild() -> void
+{
+    m_buckets.clear();
+    m_row_count = 0;
+    m_rows_per_bucket = 1;
+    m_rebuilding = (m_model != nullptr);
+
+    // A restarted rebuild supersedes the running one.
+    end_rebuild_task();
+
+    if (m_rebuilding)
+    {
+        if (m_registry != nullptr)
+        {
+            m_rebuild_token =
+                m_registry->begin_task(QStringLiteral("Indexing level density"), m_owner);
+        }
+
+        m_rebuild_timer->start();
+    }
+    else
+    {
+        m_rebuild_timer->stop();
+    }
+
+    emit summary_changed();
+}
+
+/**
+ * @brief Summarizes the next chunk of rows of a rebuild.
+ */
+auto LevelDensitySummary::rebuild_next_chunk() -> void
+{
+    const int total_rows = (m_model != nullptr) ? m_model->rowCount() : 0;
+    const int end_row = qMin(total_rows, m_row_count + k_rebuild_chunk_rows);
+    const bool cancelled = m_rebuild_token.is_cancelled();
+
+    if (end_row > m_row_count && !cancelled)
+    {
+        append_rows(m_row_count, end_row - 1);
+    }
+
+    // A cancelled rebuild keeps the rows summarized so far.
+    m_rebuilding = (m_row_count < total_rows) && !cancelled;
+    m_rebuild_token.set_progress(m_row_count, total_rows);
+
+    if (m_rebuilding)
+    {
+        m_rebuild_timer->start();
+    }
+    else
+    {
+        end_rebuild_task();
+    }
+
+    emit summary_changed();
+}
+
+/**
+ * @brief Adds rows to the summary.
+ * @param parent The parent index (must be invalid).
+ * @param first The first inserted row.
+ * @param last The last inserted row.
+ */
+auto LevelDensitySummary::handle_rows_inserted(const QModelIndex& parent, int first, int last)
+    -> void
+{
+    const auto* log_model =
+        (m_model != nullptr) ? qobject_cast<const LogModel*>(m_model->sourceModel()) : nullptr;
+
+    // Rows at or past the rebuild cursor are picked up by the next chunk.
+    const bool covered = m_rebuilding ? (first < m_row_count) : (first <= m_row_count);
+
+    if (!parent.isValid() && log_model != nullptr && covered)
+    {
+        if (first == m_row_count || m_buckets.isEmpty())
+        {
+            append_rows(first, last);
+        }
+        else
+        {
+            int bucket_first = 0;
+            Bucket& bucket = m_buckets[find_bucket(first, bucket_first)];
+
+            for (int row = first; row <= last; ++row)
+            {
+                count_row(bucket, log_model, row, 1);
+            }
+
+            const int inserted = last - first + 1;
+            bucket.row_count += inserted;
+            m_row_count += inserted;
+
+            if (bucket.row_count > k_max_bucket_growth * m_rows_per_bucket && !m_rebuilding)
+            {
+                schedule_rebuild();
+            }
+        }
+
+        emit summary_changed();
+    }
+}
+
+/**
+ * @brief Subtracts rows that are about to be removed from the summary.
+ * @param parent The parent index (must be invalid).
+ * @param first The first removed row.
+ * @param last The last removed row.
+ */
+auto LevelDensitySummary::handle_rows_about_to_be_removed(const QModelIndex& parent, int first,
+                                                          int last) -> void
+{
+    const auto* log_model =
+        (m_model != nullptr) ? qobject_cast<const LogModel*>(m_model->sourceModel()) : nullptr;
+    const int last_covered = qMin(last, m_row_count - 1);
+
+    if (!parent.isValid() && log_model != nullptr && first <= last_covered)
+    {
+        int bucket_first = 0;
+        int bucket_index = find_bucket(first, bucket_first);
+        int row = first;
+
+        while (row <= last_covered && bucket_index < m_buckets.size())
+        {
+            Bucket& bucket = m_buckets[bucket_index];
+            const int bucket_last = bucket_first + bucket.row_count - 1;
+            const int range_last = qMin(bucket_last, last_covered);
+            const int removed = range_last - row + 1;
+
+            for (int r = row; r <= range_last; ++r)
+            {
+                count_row(bucket, log_model, r, -1);
+            }
+
+            bucket.row_count -= removed;
+
+            row = range_last + 1;
+            bucket_first = bucket_last + 1;
+            ++bucket_index;
+        }
+
+        m_buckets.removeIf([](const Bucket& bucket) { return bucket.row_count <= 0; });
+        m_row_count -= (last_covered - first + 1);
+
+        emit summary_changed();
+    }
+}
+
+/**
+ * @brief Repaints the hit lane when the view's search is set or cleared.
+ *
+ * A search matching every row changes no rows, so the row signals alone would miss it.
+ */
+auto LevelDensitySummary::handle_search_changed() -> void
+{
+    const bool search_active = (m_model != nullptr) && m_model->is_search_active();
+
+    if (search_active != m_search_active)
+    {
+        m_search_active = search_active;
+        emit summary_changed();
+    }
+}
+
+/**
+ * @brief Adds a view row's level to a bucket, or subtracts it.
+ * @param bucket The bucket holding the row.
+ * @param log_model The source model of the view.
+ * @param row The row in the view.
+ * @param delta 1 to add the row, -1 to subtract it.
+ */
+auto LevelDensitySummary::count_row(Bucket& bucket, const LogModel* log_model, int row,
+                                    int delta) const -> void
+{
+    const int source_row = m_model->mapToSource(m_model->index(row, 0)).row();
+    int& level_count = bucket.level_counts[to_level(log_model->get_log_level(source_row))];
+    level_count = qMax(0, level_count + delta);
+}
+
+/**
+ * @brief Appends view rows to the end of the summary.
+ * @param first The first row.
+ * @param last The last row.
+ */
+auto LevelDensitySummary::append_rows(int first, int last) -> void
+{
+    const auto* log_model =
+        (m_model != nullptr) ? qobject_cast<const LogModel*>(m_model->sourceModel()) : nullptr;
+
+    for (int row = first; log_model != nullptr && row <= last; ++row)
+    {
+        if (m_buckets.isEmpty() || m_buckets.last().row_count >= m_rows_per_bucket)
+        {
+            if (m_buckets.size() >= k_max_bucket_count)
+            {
+                merge_buckets();
+            }
+
+            // Merging leaves the last bucket half full when the count was odd.
+            if (m_buckets.isEmpty() || m_buckets.last().row_count >= m_rows_per_bucket)
+            {
+                m_buckets.append(Bucket{});
+            }
+        }
+
+        Bucket& bucket = m_buckets.last();
+        ++bucket.row_count;
+        count_row(bucket, log_model, row, 1);
+        ++m_row_count;
+    }
+}
+
+/**
+ * @brief Finds the bucket containing a row.
+ * @param row The view row.
+ * @param bucket_first Output for the first row of the found bucket.
+ * @return The bucket index, or the last bucket if the row is past the end.
+ */
+auto LevelDensitySummary::find_bucket(int row, int& bucket_first) const -> int
+{
+    int index = 0;
+    bucket_first = 0;
+
+    while (index < m_buckets.size() - 1 && row >= bucket_first + m_buckets.at(index).row_count)
+    {
+        bucket_first += m_buckets.at(index).row_count;
+        ++index;
+    }
+
+    return index;
+}
+
+/**
+ * @brief Halves the bucket count by merging neighbours and doubles the bucket size.
+ */
+auto LevelDensitySummary::merge_buckets() -> void
+{
+    QVector<Bucket> merged;
+    merged.reserve((m_buckets.size() + 1) / 2);
+
+    for (int i = 0; i < m_buckets.size(); i += 2)
+    {
+        Bucket bucket = m_buckets.at(i);
+
+        if (i + 1 < m_buckets.size())
+        {
+            const Bucket& next = m_buckets.at(i + 1);
+            bucket.row_count += next.row_count;
+
+            for (int level = 0; level < LevelCount; ++level)
+            {
+                bucket.level_counts[level] += next.level_counts[level];
+            }
+        }
+
+        merged.append(bucket);
+    }
+
+    m_buckets = std::move(merged);
+    m_rows_per_bucket *= 2;
+}
+
+/**
+ * @brief Removes the rebuild task from the registry.
+ */
+auto LevelDensitySummary::end_rebuild_task() -> void
+{
+    if (m_registry != nullptr)
+    {
+        m_registry->end_task(m_rebuild_token);
+    }
+
+    m_rebuild_token = TaskToken();
+}
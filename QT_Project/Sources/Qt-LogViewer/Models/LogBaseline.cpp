@@ -0,0 +1,342 @@
+/**
+ * @file LogBaseline.cpp
+ * @brief This file contains the implementation of the LogBaseline class.
+ */
+
+#include "Qt-LogViewer/Models/LogBaseline.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace
+{
+// Fixed seed, so fingerprints are comparable between threads and baselines.
+constexpr quint64 k_fingerprint_seed = 0x5bd1e9955bd1e995ULL;
+
+// Filter size per expected fingerprint; with six bits per word about 1 % false positives.
+constexpr qsizetype k_bits_per_fingerprint = 16;
+constexpr int k_probe_bit_count = 6;
+constexpr qsizetype k_min_word_count = 64;
+
+// The word index uses the low bits; the probe bits are taken from above them.
+constexpr int k_probe_bits_shift = 28;
+
+// Rough average size of a log line, used to size the filter from file sizes.
+constexpr qint64 k_estimated_line_bytes = 128;
+
+// Letter-only hex words of this length are masked too (e.g. "deadbeefcafe").
+constexpr qsizetype k_min_hex_word_length = 8;
+
+/**
+ * @brief Checks whether a byte belongs to a word (ASCII letters, digits, '_' and non-ASCII).
+ * @param byte The byte.
+ * @return True for word bytes.
+ */
+auto is_word_byte(char byte) -> bool
+{
+    const auto value = static_cast<unsigned char>(byte);
+    return value >= 0x80 || value == '_' || (value >= '0' && value <= '9') ||
+           (value >= 'a' && value <= 'z') || (value >= 'A' && value <= 'Z');
+}
+
+/**
+ * @brief Checks whether a byte is a hex letter.
+ * @param byte The byte.
+ * @return True for 'a'-'f' and 'A'-'F'.
+ */
+auto is_hex_letter(char byte) -> bool
+{
+    return (byte >= 'a' && byte <= 'f') || (byte >= 'A' && byte <= 'F');
+}
+
+/**
+ * @brief Mixes the bits of a 64-bit value (the MurmurHash3 finalizer).
+ * @param value The value.
+ * @return The mixed value; every input bit affects every output bit.
+ */
+auto mix64(quint64 value) -> quint64
+{
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+/**
+ * @brief Hashes bytes to 64 bits, 8 bytes per step.
+ *
+ * qHash() returns size_t, which has only 32 bits on 32-bit builds; the filter needs all 64 (the
+ * word index and the probe bits are taken from different bits).
+ *
+ * @param bytes The bytes.
+ * @param seed The seed.
+ * @return The hash.
+ */
+auto hash_bytes(QByteArrayView bytes, quint64 seed) -> quint64
+{
+    quint64 hash = seed ^ static_cast<quint64>(bytes.size());
+    qsizetype pos = 0;
+
+    while (pos + 8 <= bytes.size())
+    {
+        quint64 word = 0;
+        std::memcpy(&word, bytes.data() + pos, sizeof(word));
+        hash = mix64(hash ^ word);
+        pos += 8;
+    }
+
+    if (pos < bytes.size())
+    {
+        quint64 word = 0;
+        std::memcpy(&word, bytes.data() + pos, static_cast<size_t>(bytes.size() - pos));
+        hash = mix64(hash ^ word);
+    }
+
+    return mix64(hash);
+}
+
+/**
+ * @brief Appends the mask of a word, joining it with a mask right before a separator.
+ * @param normalized The normalized message so far.
+ */
+auto append_mask(QByteArray& normalized) -> void
+{
+    const qsizetype size = normalized.size();
+    const bool joins = size >= 2 && normalized.at(size - 2) == '#' &&
+                       (normalized.at(size - 1) == '.' || normalized.at(size - 1) == ':' ||
+                        normalized.at(size - 1) == '-');
+
+    if (joins)
+    {
+        normalized.chop(1);
+    }
+    else
+    {
+        normalized.append('#');
+    }
+}
+}  // namespace
+
+/**
+ * @brief Constructs an empty baseline sized for a number of fingerprints.
+ *
+ * The word count is rounded up to a power of two, so a word is selected by masking.
+ *
+ * @param expected_fingerprints The number of fingerprints expected (sizes the filter).
+ */
+LogBaseline::LogBaseline(qsizetype expected_fingerprints)
+{
+    const qsizetype wanted_words =
+        std::max(k_min_word_count, qMax<qsizetype>(expected_fingerprints, 0) *
+                                       k_bits_per_fingerprint / 64);
+    const auto word_count = std::bit_ceil(static_cast<quint64>(wanted_words));
+
+    m_words.fill(0, static_cast<qsizetype>(word_count));
+    m_word_mask = word_count - 1;
+}
+
+/**
+ * @brief Masks the variable parts of a message.
+ * @param message The UTF-8 message.
+ * @return The normalized message.
+ */
+auto LogBaseline::normalize_message(QByteArrayView message) -> QByteArray
+{
+    QByteArray normalized;
+    normalized.reserve(message.size());
+    qsizetype pos = 0;
+
+    while (pos < message.size())
+    {
+        if (is_word_byte(message.at(pos)))
+        {
+            qsizetype end = pos;
+            bool has_digit = false;
+            bool all_hex = true;
+
+            while (end < message.size() && is_word_byte(message.at(end)))
+            {
+                const char byte = message.at(end);
+                const bool is_digit = byte >= '0' && byte <= '9';
+                has_digit = has_digit || is_digit;
+                all_hex = all_hex && (is_digit || is_hex_letter(byte));
+                ++end;
+            }
+
+            if (has_digit || (all_hex && end - pos >= k_min_hex_word_length))
+            {
+                append_mask(normalized);
+            }
+            else
+            {
+                normalized.append(message.sliced(pos, end - pos));
+            }
+
+            pos = end;
+        }
+        else
+        {
+            normalized.append(message.at(pos));
+            ++pos;
+        }
+    }
+
+    return normalized;
+}
+
+/**
+ * @brief Returns the fingerprint of an entry's normalized message.
+ * @param entry The entry.
+ * @return A 64-bit hash of the normalized message.
+ */
+auto LogBaseline::get_fingerprint(const LogEntry& entry) -> quint64
+{
+    return hash_bytes(normalize_message(entry.get_message_utf8()), k_fingerprint_seed);
+}
+
+/**
+ * @brief Estimates the number of fingerprints of a file from its size.
+ * @param file_bytes The file size in bytes.
+ * @return The estimated fingerprint count.
+ */
+auto LogBaseline::estimate_fingerprints(qint64 file_bytes) -> qsizetype
+{
+    return static_cast<qsizetype>(qMax<qint64>(file_bytes, 0) / k_estimated_line_bytes);
+}
+
+/**
+ * @brief Adds a fingerprint.
+ * @param fingerprint The fingerprint (see get_fingerprint()).
+ */
+auto LogBaseline::add(quint64 fingerprint) -> void
+{
+    m_words[static_cast<qsizetype>(fingerprint & m_word_mask)] |= get_probe_bits(fingerprint);
+    ++m_added_count;
+}
+
+/**
+ * @brief Adds the fingerprints of entries.
+ * @param entries The entries.
+ */
+auto LogBaseline::add_entries(const QVector<LogEntry>& entries) -> void
+{
+    for (const auto& entry: entries)
+    {
+        add(get_fingerprint(entry));
+    }
+}
+
+/**
+ * @brief Checks whether a fingerprint may be in the baseline.
+ * @param fingerprint The fingerprint.
+ * @return False if it was never added; true if it was (or, rarely, if it collides).
+ */
+auto LogBaseline::contains(quint64 fingerprint) const -> bool
+{
+    const quint64 bits = get_probe_bits(fingerprint);
+    return (m_words.at(static_cast<qsizetype>(fingerprint & m_word_mask)) & bits) == bits;
+}
+
+/**
+ * @brief Checks whether an entry's message is absent from the baseline.
+ * @param entry The entry.
+ * @return True if the entry is novel.
+ */
+auto LogBaseline::is_novel(const LogEntry& entry) const -> bool
+{
+    return !contains(get_fingerprint(entry));
+}
+
+/**
+ * @brief Tags each entry as novel or not (see LogEntry::is_novel()).
+ * @param entries The entries; one probe per entry.
+ */
+auto LogBaseline::tag_entries(QVector<LogEntry>& entries) const -> void
+{
+    for (auto& entry: entries)
+    {
+        entry.set_novel(is_novel(entry));
+    }
+}
+
+/**
+ * @brief Removes the novelty tag of each entry.
+ * @param entries The entries.
+ */
+auto LogBaseline::clear_tags(QVector<LogEntry>& entries) -> void
+{
+    for (auto& entry: entries)
+    {
+        entry.set_novel(false);
+    }
+}
+
+/**
+ * @brief Sets the reference files the baseline was built from.
+ * @param file_paths The file paths.
+ */
+auto LogBaseline::set_file_paths(const QVector<QString>& file_paths) -> void
+{
+    m_file_paths = file_paths;
+}
+
+/**
+ * @brief Returns the reference files the baseline was built from.
+ * @return The file paths.
+ */
+auto LogBaseline::get_file_paths() const -> QVector<QString>
+{
+    return m_file_paths;
+}
+
+/**
+ * @brief Returns the number of fingerprints added (repeats included).
+ * @return The count.
+ */
+auto LogBaseline::get_added_count() const -> qsizetype
+{
+    return m_added_count;
+}
+
+/**
+ * @brief Returns the memory used by the filter.
+ * @return The size in bytes.
+ */
+auto LogBaseline::get_size_bytes() const -> qsizetype
+{
+    return m_words.size() * static_cast<qsizetype>(sizeof(quint64));
+}
+
+/**
+ * @brief Checks whether no fingerprint was added.
+ * @return True if the baseline is empty.
+ */
+auto LogBaseline::is_empty() const -> bool
+{
+    return m_added_count == 0;
+}
+
+/**
+ * @brief Returns the bits a fingerprint sets in its word.
+ *
+ * Six 6-bit groups above the word index pick the bits; groups may coincide.
+ *
+ * @param fingerprint The fingerprint.
+ * @return The bit mask.
+ */
+auto LogBaseline::get_probe_bits(quint64 fingerprint) -> quint64
+{
+    quint64 bits = 0;
+    quint64 source = fingerprint >> k_probe_bits_shift;
+
+    for (int i = 0; i < k_probe_bit_count; ++i)
+    {
+        bits |= quint64{1} << (source & 63U);
+        source >>= 6;
+    }
+
+    return bits;
+}
@@ -0,0 +1,122 @@
+/**
+ * @file LogDecodeCache.cpp
+ * @brief This file contains the implementation of the LogDecodeCache class.
+ */
+
+#include "Qt-LogViewer/Models/LogDecodeCache.h"
+
+namespace
+{
+// Default budget; enough for the decoded texts of many pages of long messages.
+constexpr qsizetype k_default_budget_bytes = qsizetype(32) * 1024 * 1024;
+
+// Hash node, key and QString header per cached text.
+constexpr qsizetype k_entry_overhead_bytes = 64;
+}  // namespace
+
+/**
+ * @brief Constructs an empty cache.
+ * @param budget_bytes The maximum size of the cached texts in bytes.
+ */
+LogDecodeCache::LogDecodeCache(qsizetype budget_bytes): m_cache(qMax<qsizetype>(budget_bytes, 0))
+{
+}
+
+/**
+ * @brief Sets the byte budget, dropping texts if the cache exceeds it.
+ * @param budget_bytes The maximum size of the cached texts in bytes.
+ */
+auto LogDecodeCache::set_budget_bytes(qsizetype budget_bytes) -> void
+{
+    m_cache.setMaxCost(qMax<qsizetype>(budget_bytes, 0));
+}
+
+/**
+ * @brief Returns the byte budget.
+ * @return The maximum size of the cached texts in bytes.
+ */
+auto LogDecodeCache::get_budget_bytes() const -> qsizetype
+{
+    return m_cache.maxCost();
+}
+
+/**
+ * @brief Returns the size of the cached texts.
+ * @return The size in bytes.
+ */
+auto LogDecodeCache::get_used_bytes() const -> qsizetype
+{
+    return m_cache.totalCost();
+}
+
+/**
+ * @brief Returns the number of cached texts.
+ * @return The count.
+ */
+auto LogDecodeCache::get_count() const -> qsizetype
+{
+    return m_cache.count();
+}
+
+/**
+ * @brief Checks whether a row's text is cached, without touching its recency.
+ * @param row_id The row id.
+ * @return True if cached.
+ */
+auto LogDecodeCache::contains(quint64 row_id) const -> bool
+{
+    return m_cache.contains(row_id);
+}
+
+/**
+ * @brief Looks up a row's text and marks it as recently used.
+ * @param row_id The row id.
+ * @return The cached text, or nullptr if not cached. Valid until the next insert.
+ */
+auto LogDecodeCache::find(quint64 row_id) const -> const QString*
+{
+    return m_cache.object(row_id);
+}
+
+/**
+ * @brief Caches a row's text. Texts larger than the whole budget are not cached.
+ * @param row_id The row id (0 is ignored).
+ * @param message The decoded text.
+ */
+auto LogDecodeCache::insert(quint64 row_id, const QString& message) -> void
+{
+    const qsizetype cost = get_cost(message);
+
+    if (row_id != 0 && cost <= m_cache.maxCost())
+    {
+        // Takes ownership and evicts the least recently used texts beyond the budget.
+        m_cache.insert(row_id, new QString(message), cost);
+    }
+}
+
+/**
+ * @brief Drops all texts.
+ */
+auto LogDecodeCache::clear() -> void
+{
+    m_cache.clear();
+}
+
+/**
+ * @brief Returns the default byte budget.
+ * @return The budget in bytes.
+ */
+auto LogDecodeCache::get_default_budget_bytes() -> qsizetype
+{
+    return k_default_budget_bytes;
+}
+
+/**
+ * @brief Returns the cost a text is accounted with.
+ * @param message The text.
+ * @return Its size in bytes, including a fixed per-entry overhead.
+ */
+auto LogDecodeCache::get_cost(const QString& message) -> qsizetype
+{
+    return (message.size() * qsizetype(sizeof(QChar))) + k_entry_overhead_bytes;
+}
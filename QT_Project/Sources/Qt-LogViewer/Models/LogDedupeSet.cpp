@@ -0,0 +1,348 @@
+/**
+ * @file LogDedupeSet.cpp
+ * @brief This file contains the implementation of the LogDedupeSet class.
+ */
+
+#include "Qt-LogViewer/Models/LogDedupeSet.h"
+
+#include <QDateTime>
+#include <limits>
+
+namespace
+{
+// Fixed seeds, so keys are comparable between the parser threads and the GUI thread.
+constexpr size_t k_key_seed = 0x9e3779b9U;
+// Seeds the upper half of the key where size_t (and so qHashMulti()) has 32 bits.
+constexpr size_t k_key_high_seed = 0x85ebca6bU;
+
+// Rough average size of a log line, used to size the set from file sizes.
+constexpr qint64 k_estimated_entry_bytes = 128;
+}  // namespace
+
+/**
+ * @brief Returns the dedupe key of an entry.
+ *
+ * qHashMulti() yields size_t; on 32-bit platforms a second hash fills the upper half.
+ *
+ * @param entry The entry.
+ * @return A 64-bit hash of timestamp, level, application and message.
+ */
+auto LogDedupeSet::get_key(const LogEntry& entry) -> quint64
+{
+    const QDateTime timestamp = entry.get_timestamp();
+    const qint64 msecs = timestamp.isValid() ? timestamp.toMSecsSinceEpoch()
+                                             : std::numeric_limits<qint64>::min();
+
+    const QString level = entry.get_level();
+    const QString app_name = entry.get_app_name();
+    const QByteArray message = entry.get_message_utf8();
+    quint64 key = qHashMulti(k_key_seed, msecs, level, app_name, message);
+
+    if constexpr (sizeof(size_t) < sizeof(quint64))
+    {
+        const quint64 high = qHashMulti(k_key_high_seed, msecs, level, app_name, message);
+        key |= high << 32;
+    }
+
+    return key;
+}
+
+/**
+ * @brief Returns the dedupe keys of a batch of entries.
+ * @param entries The entries.
+ * @return One key per entry.
+ */
+auto LogDedupeSet::get_keys(const QVector<LogEntry>& entries) -> QVector<quint64>
+{
+    QVector<quint64> keys;
+    keys.reserve(entries.size());
+
+    for (const auto& entry: entries)
+    {
+        keys.append(get_key(entry));
+    }
+
+    return keys;
+}
+
+/**
+ * @brief Estimates the number of entries of a file from its size, to size the set.
+ * @param file_bytes The file size in bytes.
+ * @return The estimated entry count.
+ */
+auto LogDedupeSet::estimate_entries(qint64 file_bytes) -> qsizetype
+{
+    return static_cast<qsizetype>(qMax<qint64>(file_bytes, 0) / k_estimated_entry_bytes);
+}
+
+/**
+ * @brief Makes room for further keys without rehashing.
+ * @param additional_keys The number of keys expected in addition to the current ones.
+ */
+auto LogDedupeSet::reserve(qsizetype additional_keys) -> void
+{
+    if (additional_keys > 0)
+    {
+        m_owners.reserve(m_owners.size() + additional_keys);
+    }
+}
+
+/**
+ * @brief Records the keys of a batch and marks the entries another file already has.
+ *
+ * Batches usually come from a single file, so the file id is only looked up when the path
+ * changes; each entry then costs one probe of the key set.
+ *
+ * @param entries The entries.
+ * @param keys One key per entry (see get_keys()).
+ * @return One bit per entry, set for duplicates.
+ */
+auto LogDedupeSet::mark_duplicates(const QVector<LogEntry>& entries, const QVector<quint64>& keys)
+    -> QBitArray
+{
+    const qsizetype count = qMin(entries.size(), keys.size());
+    QBitArray duplicates(entries.size());
+    QString file_path;
+    quint32 file_id = 0;
+    int file_duplicates = 0;
+
+    for (qsizetype i = 0; i < count; ++i)
+    {
+        const QString entry_path = entries.at(i).get_file_info().get_file_path();
+
+        if (file_id == 0 || entry_path != file_path)
+        {
+            if (file_duplicates > 0)
+            {
+                m_duplicate_counts[file_path] += file_duplicates;
+            }
+
+            file_path = entry_path;
+            file_id = get_file_id(file_path);
+            file_duplicates = 0;
+        }
+
+        // One probe: inserts the key with owner 0 if it is new.
+        quint32& owner = m_owners[keys.at(i)];
+
+        if (owner == 0)
+        {
+            owner = file_id;
+        }
+        else if (owner != file_id)
+        {
+            duplicates.setBit(i);
+            ++file_duplicates;
+            m_dropping_files[owner].insert(file_id);
+        }
+    }
+
+    if (file_duplicates > 0)
+    {
+        m_duplicate_counts[file_path] += file_duplicates;
+    }
+
+    return duplicates;
+}
+
+/**
+ * @brief Records the keys of entries that stay shown, without marking or counting duplicates.
+ *
+ * Used to seed the set with the entries a view already shows; each key keeps the first file
+ * that produced it.
+ *
+ * @param entries The entries.
+ * @param keys One key per entry (see get_keys()).
+ */
+auto LogDedupeSet::record_keys(const QVector<LogEntry>& entries, const QVector<quint64>& keys)
+    -> void
+{
+    const qsizetype count = qMin(entries.size(), keys.size());
+    QString file_path;
+    quint32 file_id = 0;
+
+    for (qsizetype i = 0; i < count; ++i)
+    {
+        const QString entry_path = entries.at(i).get_file_info().get_file_path();
+
+        if (file_id == 0 || entry_path != file_path)
+        {
+            file_path = entry_path;
+            file_id = get_file_id(file_path);
+        }
+
+        quint32& owner = m_owners[keys.at(i)];
+
+        if (owner == 0)
+        {
+            owner = file_id;
+        }
+    }
+}
+
+/**
+ * @brief Records the keys of a range of snapshot rows, without marking duplicates.
+ *
+ * Computes the keys itself, so the rows need not be copied into a batch first; used to seed a
+ * set from the rows a view already shows, off the GUI thread.
+ *
+ * @param snapshot The rows.
+ * @param first The first row to record.
+ * @param last The row after the last one to record.
+ */
+auto LogDedupeSet::record_keys(const LogEntryStore::Snapshot& snapshot, int first, int last)
+    -> void
+{
+    QString file_path;
+    quint32 file_id = 0;
+
+    for (int row = first; row < last; ++row)
+    {
+        const LogEntry& entry = snapshot.at(row);
+        const QString entry_path = entry.get_file_info().get_file_path();
+
+        if (file_id == 0 || entry_path != file_path)
+        {
+            file_path = entry_path;
+            file_id = get_file_id(file_path);
+        }
+
+        quint32& owner = m_owners[get_key(entry)];
+
+        if (owner == 0)
+        {
+            owner = file_id;
+        }
+    }
+}
+
+/**
+ * @brief Adds the keys and counts of a set filled after this one.
+ *
+ * The file ids of the other set are mapped to this set's. A key both sets have keeps this
+ * set's owner, as its entries came first.
+ *
+ * @param later The other set; this set's owners win for keys both have.
+ */
+auto LogDedupeSet::merge(const LogDedupeSet& later) -> void
+{
+    QHash<quint32, quint32> file_ids;
+
+    for (auto it = later.m_file_ids.cbegin(); it != later.m_file_ids.cend(); ++it)
+    {
+        file_ids.insert(it.value(), get_file_id(it.key()));
+    }
+
+    m_owners.reserve(m_owners.size() + later.m_owners.size());
+
+    for (auto it = later.m_owners.cbegin(); it != later.m_owners.cend(); ++it)
+    {
+        quint32& owner = m_owners[it.key()];
+
+        if (owner == 0)
+        {
+            owner = file_ids.value(it.value());
+        }
+    }
+
+    for (auto it = later.m_duplicate_counts.cbegin(); it != later.m_duplicate_counts.cend(); ++it)
+    {
+        m_duplicate_counts[it.key()] += it.value();
+    }
+
+    for (auto it = later.m_dropping_files.cbegin(); it != later.m_dropping_files.cend(); ++it)
+    {
+        QSet<quint32>& dropping = m_dropping_files[file_ids.value(it.key())];
+
+        for (const quint32 dropping_id: it.value())
+        {
+            dropping.insert(file_ids.value(dropping_id));
+        }
+    }
+}
+
+/**
+ * @brief Forgets the keys a file produced, so other files may claim them again.
+ *
+ * Entries of other files that were dropped as duplicates of this file are not restored here;
+ * the returned files have to be loaded again to show them.
+ *
+ * @param file_path The file path.
+ * @return The files that dropped entries as duplicates of the removed file.
+ */
+auto LogDedupeSet::remove_file(const QString& file_path) -> QStringList
+{
+    QStringList dropping_paths;
+    const quint32 file_id = m_file_ids.value(file_path, 0);
+
+    if (file_id != 0)
+    {
+        m_owners.removeIf([file_id](QHash<quint64, quint32>::iterator it)
+                          { return it.value() == file_id; });
+
+        const QSet<quint32> dropping_ids = m_dropping_files.take(file_id);
+
+        for (auto it = m_file_ids.cbegin(); it != m_file_ids.cend(); ++it)
+        {
+            if (dropping_ids.contains(it.value()))
+            {
+                dropping_paths.append(it.key());
+            }
+        }
+
+        // The removed file's own drops go with it.
+        for (auto& dropping: m_dropping_files)
+        {
+            dropping.remove(file_id);
+        }
+    }
+
+    m_duplicate_counts.remove(file_path);
+
+    return dropping_paths;
+}
+
+/**
+ * @brief Forgets all keys and counts.
+ */
+auto LogDedupeSet::clear() -> void
+{
+    m_owners.clear();
+    m_duplicate_counts.clear();
+    m_dropping_files.clear();
+}
+
+/**
+ * @brief Returns the number of keys recorded.
+ * @return The key count.
+ */
+auto LogDedupeSet::get_size() const -> qsizetype
+{
+    return m_owners.size();
+}
+
+/**
+ * @brief Returns the number of duplicates found per file.
+ * @return Map of file path to duplicate count (files without duplicates are absent).
+ */
+auto LogDedupeSet::get_duplicate_counts() const -> QHash<QString, int>
+{
+    return m_duplicate_counts;
+}
+
+/**
+ * @brief Returns the id of a file, assigning the next one on first use.
+ * @param file_path The file path.
+ * @return The file id (from 1).
+ */
+auto LogDedupeSet::get_file_id(const QString& file_path) -> quint32
+{
+    auto it = m_file_ids.find(file_path);
+
+    if (it == m_file_ids.end())
+    {
+        it = m_file_ids.insert(file_path, static_cast<quint32>(m_file_ids.size()) + 1);
+    }
+
+    return it.value();
+}
@@ -15,7 +15,7 @@
 LogEntry::LogEntry(QDateTime timestamp, QString level, QString message, LogFileInfo file_info)
     : m_timestamp{std::move(timestamp)},
       m_level{std::move(level)},
-      m_message{std::move(message)},
+      m_message_utf8{message.toUtf8()},
       m_file_info{std::move(file_info)}
 {}
 
@@ -39,11 +39,20 @@ auto LogEntry::get_level() const -> QString
 
 /**
  * @brief Returns the log message.
- * @return The log message.
+ * @return The log message, decoded from the stored UTF-8 bytes.
  */
 auto LogEntry::get_message() const -> QString
 {
-    return m_message;
+    return QString::fromUtf8(m_message_utf8);
+}
+
+/**
+ * @brief Returns the log message as stored, without decoding.
+ * @return The UTF-8 encoded log message.
+ */
+auto LogEntry::get_message_utf8() const -> QByteArray
+{
+    return m_message_utf8;
 }
 
 /**
@@ -88,7 +97,16 @@ auto LogEntry::set_level(const QString& level) -> void
  */
 auto LogEntry::set_message(const QString& message) -> void
 {
-    m_message = message;
+    m_message_utf8 = message.toUtf8();
+}
+
+/**
+ * @brief Sets the log message from UTF-8 encoded bytes.
+ * @param message The new UTF-8 encoded log message.
+ */
+auto LogEntry::set_message_utf8(const QByteArray& message) -> void
+{
+    m_message_utf8 = message;
 }
 
 /**
@@ -108,3 +126,135 @@ auto LogEntry::set_file_info(const LogFileInfo& file_info) -> void
 {
     m_file_info = file_info;
 }
+
+/**
+ * @brief Returns all extra fields in the order they appear in the log format.
+ * @return List of (field name, typed value) pairs.
+ */
+auto LogEntry::get_extra_fields() const -> QVector<QPair<QString, QVariant>>
+{
+    return m_extra_fields;
+}
+
+/**
+ * @brief Returns the value of a single extra field.
+ * @param name The placeholder name (e.g. "thread").
+ * @return The typed value, or an invalid QVariant if the field is not present.
+ */
+auto LogEntry::get_extra_field(const QString& name) const -> QVariant
+{
+    QVariant value;
+    bool found = false;
+
+    for (qsizetype i = 0; i < m_extra_fields.size() && !found; ++i)
+    {
+        if (m_extra_fields.at(i).first == name)
+        {
+            value = m_extra_fields.at(i).second;
+            found = true;
+        }
+    }
+
+    return value;
+}
+
+/**
+ * @brief Sets (or replaces) the value of an extra field.
+ * @param name The placeholder name (e.g. "thread").
+ * @param value The typed value (qlonglong for integers, QString otherwise).
+ */
+auto LogEntry::set_extra_field(const QString& name, const QVariant& value) -> void
+{
+    bool replaced = false;
+
+    for (qsizetype i = 0; i < m_extra_fields.size() && !replaced; ++i)
+    {
+        if (m_extra_fields.at(i).first == name)
+        {
+            m_extra_fields[i].second = value;
+            replaced = true;
+        }
+    }
+
+    if (!replaced)
+    {
+        m_extra_fields.append(qMakePair(name, value));
+    }
+}
+
+/**
+ * @brief Marks the entry as truncated and records where its full line is on disk.
+ * @param offset Byte offset of the line in the entry's file.
+ * @param length Length of the line in bytes, without the line ending.
+ */
+auto LogEntry::set_source_range(qint64 offset, qint64 length) -> void
+{
+    m_source_offset = offset;
+    m_source_length = length;
+}
+
+/**
+ * @brief Checks whether the entry holds only a prefix of its line.
+ * @return True if a source range was set.
+ */
+auto LogEntry::is_truncated() const -> bool
+{
+    return m_source_offset >= 0;
+}
+
+/**
+ * @brief Returns the byte offset of the full line in the entry's file.
+ * @return The offset, or -1 if the entry is not truncated.
+ */
+auto LogEntry::get_source_offset() const -> qint64
+{
+    return m_source_offset;
+}
+
+/**
+ * @brief Returns the length of the full line in the entry's file.
+ * @return The length in bytes, or 0 if the entry is not truncated.
+ */
+auto LogEntry::get_source_length() const -> qint64
+{
+    return m_source_length;
+}
+
+/**
+ * @brief Records the byte offset of the entry's first line in its file.
+ * @param offset The offset, or -1 if unknown.
+ */
+auto LogEntry::set_line_offset(qint64 offset) -> void
+{
+    m_line_offset = offset;
+}
+
+/**
+ * @brief Returns the byte offset of the entry's first line in its file.
+ *
+ * Together with the file it identifies the entry stably (see LogModel::get_row_id()).
+ *
+ * @return The offset, or -1 if unknown (entries not read from a file, non-UTF-8 input).
+ */
+auto LogEntry::get_line_offset() const -> qint64
+{
+    return m_line_offset;
+}
+
+/**
+ * @brief Tags the entry as absent from (or present in) the active baseline.
+ * @param novel True if the entry's message is not in the baseline.
+ */
+auto LogEntry::set_novel(bool novel) -> void
+{
+    m_novel = novel;
+}
+
+/**
+ * @brief Checks whether the entry was tagged as absent from the active baseline.
+ * @return True if the entry is novel.
+ */
+auto LogEntry::is_novel() const -> bool
+{
+    return m_novel;
+}
@@ -0,0 +1,335 @@
+/**
+ * @file LogEntryStore.cpp
+ * @brief This file contains the implementation of the LogEntryStore class.
+ */
+
+#include "Qt-LogViewer/Models/LogEntryStore.h"
+
+#include <QMutexLocker>
+
+namespace
+{
+// Rows per segment (a power of two, so row lookups are a shift and a mask). Large enough that
+// the segment list stays short for millions of rows, small enough that a tiny view does not
+// allocate much.
+constexpr int k_segment_shift = 12;
+constexpr int k_segment_size = 1 << k_segment_shift;
+constexpr int k_segment_mask = k_segment_size - 1;
+}  // namespace
+
+/**
+ * @brief Returns the number of rows in the snapshot.
+ * @return The row count.
+ */
+auto LogEntryStore::Snapshot::size() const -> int
+{
+    return m_size;
+}
+
+/**
+ * @brief Checks whether the snapshot has no rows.
+ * @return True if empty.
+ */
+auto LogEntryStore::Snapshot::is_empty() const -> bool
+{
+    return m_size == 0;
+}
+
+/**
+ * @brief Returns the entry of a row.
+ * @param row The row index (0 <= row < size()).
+ * @return The entry.
+ */
+auto LogEntryStore::Snapshot::at(int row) const -> const LogEntry&
+{
+    Q_ASSERT(row >= 0 && row < m_size);
+    return m_segments->at(row >> k_segment_shift)->entries[row & k_segment_mask];
+}
+
+/**
+ * @brief Returns the epoch of the store when the snapshot was taken.
+ *
+ * Snapshots with the same epoch agree on all rows they have in common, apart from the rows'
+ * novelty tags.
+ *
+ * @return The epoch.
+ */
+auto LogEntryStore::Snapshot::get_epoch() const -> quint64
+{
+    return m_epoch;
+}
+
+/**
+ * @brief Copies the rows into a vector.
+ * @return The entries in row order.
+ */
+auto LogEntryStore::Snapshot::to_vector() const -> QVector<LogEntry>
+{
+    QVector<LogEntry> entries;
+    entries.reserve(m_size);
+
+    for (const auto& entry: *this)
+    {
+        entries.append(entry);
+    }
+
+    return entries;
+}
+
+/**
+ * @brief Returns an iterator to the first row.
+ * @return The iterator.
+ */
+auto LogEntryStore::Snapshot::begin() const -> const_iterator
+{
+    return const_iterator(this, 0);
+}
+
+/**
+ * @brief Returns an iterator past the last row.
+ * @return The iterator.
+ */
+auto LogEntryStore::Snapshot::end() const -> const_iterator
+{
+    return const_iterator(this, m_size);
+}
+
+/**
+ * @brief Constructs an empty store.
+ */
+LogEntryStore::LogEntryStore(): m_segments(std::make_shared<const SegmentList>())
+{
+    publish();
+}
+
+/**
+ * @brief Appends entries and publishes them to new snapshots.
+ * @param entries The entries to append.
+ */
+auto LogEntryStore::append(const QVector<LogEntry>& entries) -> void
+{
+    if (!entries.isEmpty())
+    {
+        const int new_size = m_size + static_cast<int>(entries.size());
+        const int needed_segments = (new_size + k_segment_size - 1) >> k_segment_shift;
+
+        if (needed_segments > m_segments->size())
+        {
+            // Published snapshots keep the old list; the segments themselves are shared.
+            auto segments = std::make_shared<SegmentList>(*m_segments);
+            segments->reserve(needed_segments);
+
+            while (segments->size() < needed_segments)
+            {
+                auto segment = std::make_shared<Segment>();
+                segment->entries.reserve(k_segment_size);
+                segments->append(std::move(segment));
+            }
+
+            m_segments = std::move(segments);
+        }
+
+        // Entries are constructed in reserved slots at or past the published row count; the
+        // segments never reallocate and no snapshot reads those slots.
+        int row = m_size;
+        for (const auto& entry: entries)
+        {
+            m_segments->at(row >> k_segment_shift)->entries.push_back(entry);
+            ++row;
+        }
+
+        m_size = new_size;
+        publish();
+    }
+}
+
+/**
+ * @brief Replaces all entries (new epoch).
+ * @param entries The new entries.
+ */
+auto LogEntryStore::assign(const QVector<LogEntry>& entries) -> void
+{
+    m_segments = build_segments(entries);
+    m_size = static_cast<int>(entries.size());
+    ++m_epoch;
+    publish();
+}
+
+/**
+ * @brief Removes all entries (new epoch).
+ */
+auto LogEntryStore::clear() -> void
+{
+    m_segments = std::make_shared<const SegmentList>();
+    m_size = 0;
+    ++m_epoch;
+    publish();
+}
+
+/**
+ * @brief Removes the entries matching a predicate (new epoch if any was removed).
+ * @param predicate Returns true for entries to remove.
+ * @return The number of removed entries.
+ */
+auto LogEntryStore::remove_if(const std::function<bool(const LogEntry&)>& predicate) -> int
+{
+    QVector<LogEntry> kept;
+    kept.reserve(m_size);
+
+    for (int row = 0; row < m_size; ++row)
+    {
+        const LogEntry& entry = at(row);
+        if (!predicate(entry))
+        {
+            kept.append(entry);
+        }
+    }
+
+    const int removed = m_size - static_cast<int>(kept.size());
+
+    if (removed > 0)
+    {
+        assign(kept);
+    }
+
+    return removed;
+}
+
+/**
+ * @brief Sets the novelty tags of the first rows (see LogEntry::is_novel()).
+ * @param tags One bit per row, starting at row 0; bits past size() are ignored.
+ * @return The number of rows whose tag changed.
+ */
+auto LogEntryStore::set_novel_tags(const QBitArray& tags) -> int
+{
+    const int count = qMin(m_size, static_cast<int>(tags.size()));
+    auto segments = std::make_shared<SegmentList>(*m_segments);
+    int changed = 0;
+
+    for (int first = 0; first < count; first += k_segment_size)
+    {
+        const qsizetype index = first >> k_segment_shift;
+        const Segment& segment = *segments->at(index);
+        const int last = qMin(count, first + k_segment_size);
+        int segment_changed = 0;
+
+        for (int row = first; row < last; ++row)
+        {
+            if (segment.entries[row & k_segment_mask].is_novel() != tags.testBit(row))
+            {
+                ++segment_changed;
+            }
+        }
+
+        if (segment_changed > 0)
+        {
+            // Snapshots may read the old segment; the copy keeps its capacity, so appends to
+            // it never reallocate.
+            auto tagged = std::make_shared<Segment>();
+            tagged->entries.reserve(k_segment_size);
+            tagged->entries.assign(segment.entries.cbegin(), segment.entries.cend());
+
+            for (int row = first; row < last; ++row)
+            {
+                tagged->entries[row & k_segment_mask].set_novel(tags.testBit(row));
+            }
+
+            (*segments)[index] = std::move(tagged);
+            changed += segment_changed;
+        }
+    }
+
+    if (changed > 0)
+    {
+        m_segments = std::move(segments);
+        publish();
+    }
+
+    return changed;
+}
+
+/**
+ * @brief Returns the number of entries (owning thread).
+ * @return The row count.
+ */
+auto LogEntryStore::size() const -> int
+{
+    return m_size;
+}
+
+/**
+ * @brief Checks whether the store is empty (owning thread).
+ * @return True if there are no entries.
+ */
+auto LogEntryStore::is_empty() const -> bool
+{
+    return m_size == 0;
+}
+
+/**
+ * @brief Returns the entry of a row (owning thread).
+ * @param row The row index (0 <= row < size()).
+ * @return The entry.
+ */
+auto LogEntryStore::at(int row) const -> const LogEntry&
+{
+    Q_ASSERT(row >= 0 && row < m_size);
+    return m_segments->at(row >> k_segment_shift)->entries[row & k_segment_mask];
+}
+
+/**
+ * @brief Returns an immutable view of the current rows (any thread).
+ * @return The snapshot.
+ */
+auto LogEntryStore::snapshot() const -> Snapshot
+{
+    QMutexLocker locker(&m_publish_mutex);
+    return m_published;
+}
+
+/**
+ * @brief Returns the number of rows per segment.
+ * @return The segment capacity.
+ */
+auto LogEntryStore::get_segment_size() -> int
+{
+    return k_segment_size;
+}
+
+/**
+ * @brief Builds fresh segments holding the given entries.
+ * @param entries The entries.
+ * @return The segment list.
+ */
+auto LogEntryStore::build_segments(const QVector<LogEntry>& entries)
+    -> std::shared_ptr<const SegmentList>
+{
+    auto segments = std::make_shared<SegmentList>();
+    const qsizetype count = entries.size();
+    segments->reserve((count + k_segment_size - 1) >> k_segment_shift);
+
+    for (qsizetype first = 0; first < count; first += k_segment_size)
+    {
+        auto segment = std::make_shared<Segment>();
+        segment->entries.reserve(k_segment_size);
+        const qsizetype last = qMin(count, first + k_segment_size);
+        segment->entries.insert(segment->entries.end(), entries.cbegin() + first,
+                                entries.cbegin() + last);
+
+        segments->append(std::move(segment));
+    }
+
+    return segments;
+}
+
+/**
+ * @brief Makes the current segments and row count visible to snapshot().
+ */
+auto LogEntryStore::publish() -> void
+{
+    // The mutex orders the slot writes before any reader that sees the new count.
+    QMutexLocker locker(&m_publish_mutex);
+    m_published.m_segments = m_segments;
+    m_published.m_size = m_size;
+    m_published.m_epoch = m_epoch;
+}
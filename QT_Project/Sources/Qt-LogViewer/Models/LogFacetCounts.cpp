@@ -0,0 +1,129 @@
+/**
+ * @file LogFacetCounts.cpp
+ * @brief This file contains the implementation of the LogFacetCounts class.
+ */
+
+#include "Qt-LogViewer/Models/LogFacetCounts.h"
+
+/**
+ * @brief Adds (or removes) one entry.
+ * @param entry The entry.
+ * @param delta 1 to add the entry, -1 to remove it.
+ */
+auto LogFacetCounts::add_entry(const LogEntry& entry, int delta) -> void
+{
+    m_total += delta;
+    add_to(m_levels, entry.get_level(), delta);
+    add_to(m_apps, entry.get_app_name(), delta);
+    add_to(m_files, entry.get_file_info().get_file_path(), delta);
+}
+
+/**
+ * @brief Adds all counts of another instance.
+ * @param other The counts to add.
+ */
+auto LogFacetCounts::merge(const LogFacetCounts& other) -> void
+{
+    m_total += other.m_total;
+
+    for (auto it = other.m_levels.cbegin(); it != other.m_levels.cend(); ++it)
+    {
+        add_to(m_levels, it.key(), it.value());
+    }
+    for (auto it = other.m_apps.cbegin(); it != other.m_apps.cend(); ++it)
+    {
+        add_to(m_apps, it.key(), it.value());
+    }
+    for (auto it = other.m_files.cbegin(); it != other.m_files.cend(); ++it)
+    {
+        add_to(m_files, it.key(), it.value());
+    }
+}
+
+/**
+ * @brief Resets all counts to zero.
+ */
+auto LogFacetCounts::clear() -> void
+{
+    m_total = 0;
+    m_levels.clear();
+    m_apps.clear();
+    m_files.clear();
+}
+
+/**
+ * @brief Returns the number of entries counted.
+ * @return The entry count.
+ */
+auto LogFacetCounts::get_total() const -> int
+{
+    return m_total;
+}
+
+/**
+ * @brief Returns the counts per level.
+ * @return Map of level text to count.
+ */
+auto LogFacetCounts::get_level_counts() const -> QMap<QString, int>
+{
+    return to_map(m_levels);
+}
+
+/**
+ * @brief Returns the counts per application.
+ * @return Map of application name to count.
+ */
+auto LogFacetCounts::get_app_counts() const -> QMap<QString, int>
+{
+    return to_map(m_apps);
+}
+
+/**
+ * @brief Returns the counts per file.
+ * @return Map of absolute file path to count.
+ */
+auto LogFacetCounts::get_file_counts() const -> QMap<QString, int>
+{
+    return to_map(m_files);
+}
+
+/**
+ * @brief Adds a delta to a key, dropping keys that reach zero.
+ * @param counts The counts.
+ * @param key The key.
+ * @param delta The delta.
+ */
+auto LogFacetCounts::add_to(QHash<QString, int>& counts, const QString& key, int delta) -> void
+{
+    auto it = counts.find(key);
+
+    if (it == counts.end())
+    {
+        counts.insert(key, delta);
+    }
+    else if (it.value() + delta == 0)
+    {
+        counts.erase(it);
+    }
+    else
+    {
+        it.value() += delta;
+    }
+}
+
+/**
+ * @brief Converts counts to a sorted map.
+ * @param counts The counts.
+ * @return The map.
+ */
+auto LogFacetCounts::to_map(const QHash<QString, int>& counts) -> QMap<QString, int>
+{
+    QMap<QString, int> map;
+
+    for (auto it = counts.cbegin(); it != counts.cend(); ++it)
+    {
+        map.insert(it.key(), it.value());
+    }
+
+    return map;
+}
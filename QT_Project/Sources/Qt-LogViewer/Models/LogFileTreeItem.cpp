@@ -26,6 +26,7 @@ LogFileTreeItem::~LogFileTreeItem()
  */
 auto LogFileTreeItem::append_child(LogFileTreeItem* child) -> void
 {
+    child->m_row = static_cast<int>(m_child_items.size());
     m_child_items.append(child);
 }
 
@@ -42,6 +43,28 @@ auto LogFileTreeItem::remove_child(int row) -> LogFileTreeItem*
     {
         removed = m_child_items.at(row);
         m_child_items.removeAt(row);
+        renumber_children(row);
+    }
+
+    return removed;
+}
+
+/**
+ * @brief Removes a contiguous range of children.
+ * @param row The first child row index.
+ * @param count The number of children to remove.
+ * @return The removed child items (ownership passes to the caller); empty if the range is out
+ *         of bounds.
+ */
+auto LogFileTreeItem::take_children(int row, int count) -> QVector<LogFileTreeItem*>
+{
+    QVector<LogFileTreeItem*> removed;
+
+    if (row >= 0 && count > 0 && row + count <= m_child_items.size())
+    {
+        removed = m_child_items.mid(row, count);
+        m_child_items.remove(row, count);
+        renumber_children(row);
     }
 
     return removed;
@@ -133,14 +156,17 @@ auto LogFileTreeItem::parent_item() const -> LogFileTreeItem*
  */
 auto LogFileTreeItem::row() const -> int
 {
-    int result = 0;
+    return m_parent_item != nullptr ? m_row : 0;
+}
 
-    if (m_parent_item)
+/**
+ * @brief Updates the cached rows of the children starting at the given row.
+ * @param first_row The first child row to renumber.
+ */
+auto LogFileTreeItem::renumber_children(int first_row) -> void
+{
+    for (int i = first_row; i < m_child_items.size(); ++i)
     {
-        result = m_parent_item->child_count() > 0
-                     ? m_parent_item->m_child_items.indexOf(const_cast<LogFileTreeItem*>(this))
-                     : 0;
+        m_child_items.at(i)->m_row = i;
     }
-
-    return result;
 }
@@ -1,6 +1,14 @@
 #include "Qt-LogViewer/Models/LogFileTreeModel.h"
 
+#include <QDir>
+#include <QFileInfo>
 #include <QIcon>
+#include <QLocale>
+#include <QSet>
+#include <QTimer>
+#include <algorithm>
+#include <functional>
+#include <utility>
 
 #include "Qt-LogViewer/Models/LogFileInfo.h"
 #include "Qt-LogViewer/Models/LogFileTreeItem.h"
@@ -8,15 +16,72 @@
 
 using QtWidgetsCommonLib::UiUtils;
 
+namespace
+{
+// Item data columns of folder nodes: (Type, folder path, display name, fetch state).
+constexpr int k_folder_path_column = 1;
+constexpr int k_folder_name_column = 2;
+constexpr int k_folder_state_column = 3;
+
+// Item data columns of folder files: (Type, LogFileInfo, size, last modified, requested).
+constexpr int k_file_info_column = 1;
+constexpr int k_file_size_column = 2;
+constexpr int k_file_modified_column = 3;
+constexpr int k_file_requested_column = 4;
+
+/**
+ * @brief Returns the group key of files that are still being identified.
+ *
+ * App groups never have an empty key (see LogFileTreeModel::get_group_name()), so no app name,
+ * translated or not, can collide with it. data() shows the group as
+ * LogFileTreeModel::get_provisional_group_name().
+ *
+ * @return The empty group key.
+ */
+auto get_provisional_group_key() -> QString
+{
+    return QString();
+}
+
+/**
+ * @brief Returns the type of a tree item.
+ * @param item The item, or nullptr.
+ * @return The item type (Group for nullptr).
+ */
+auto item_type(const LogFileTreeItem* item) -> LogFileTreeItem::Type
+{
+    return item != nullptr ? item->data(0).value<LogFileTreeItem::Type>()
+                           : LogFileTreeItem::Type::Group;
+}
+
+/**
+ * @brief Checks whether a file item is listed below a folder node.
+ * @param item The file item.
+ * @return True for folder files.
+ */
+auto is_folder_file(const LogFileTreeItem* item) -> bool
+{
+    return item_type(item) == LogFileTreeItem::Type::File &&
+           item_type(item->parent_item()) == LogFileTreeItem::Type::Folder;
+}
+}  // namespace
+
 /**
  * @brief Constructs a LogFileTreeModel object.
  * @param parent The parent QObject, or nullptr.
  */
-LogFileTreeModel::LogFileTreeModel(QObject* parent): QAbstractItemModel(parent)
+LogFileTreeModel::LogFileTreeModel(QObject* parent)
+    : QAbstractItemModel(parent), m_metadata_timer(new QTimer(this))
 {
     QVector<QVariant> root_data;
     root_data << QVariant::fromValue(LogFileTreeItem::Type::Group) << tr("Sessions");
     m_root_item = new LogFileTreeItem(root_data);
+
+    // Requests of one paint pass are sent together once the view is done painting.
+    m_metadata_timer->setSingleShot(true);
+    m_metadata_timer->setInterval(0);
+    connect(m_metadata_timer, &QTimer::timeout, this,
+            &LogFileTreeModel::flush_metadata_requests);
 }
 
 /**
@@ -78,18 +143,7 @@ auto LogFileTreeModel::remove_session(const QString& session_id) -> bool
         {
             beginRemoveRows(QModelIndex(), row, row);
 
-            QList<GroupKey> keys_to_remove;
-            for (auto it = m_group_items.constBegin(); it != m_group_items.constEnd(); ++it)
-            {
-                if (it.key().session_id == session_id)
-                {
-                    keys_to_remove.append(it.key());
-                }
-            }
-            for (const auto& key: keys_to_remove)
-            {
-                m_group_items.remove(key);
-            }
+            forget_session_items(session_id, session_item);
 
             LogFileTreeItem* removed_item = m_root_item->remove_child(row);
             m_session_items.remove(session_id);
@@ -184,211 +238,300 @@ auto LogFileTreeModel::get_session_index(const QString& session_id) const -> QMo
 auto LogFileTreeModel::set_log_files(const QString& session_id,
                                      const QList<LogFileInfo>& log_file_infos) -> void
 {
-    LogFileTreeItem* session_item = m_session_items.value(session_id, nullptr);
-
-    if (session_item == nullptr)
+    if (!m_session_items.contains(session_id))
     {
         add_session(session_id, session_id);
-        session_item = m_session_items.value(session_id);
     }
 
-    const int session_row = get_session_row(session_item);
-    const QModelIndex session_index = index(session_row, 0, QModelIndex());
+    clear_session_files(session_id);
+    add_log_files(session_id, log_file_infos);
+}
 
-    if (session_item->child_count() > 0)
+/**
+ * @brief Adds a single log file to a session.
+ * @param session_id The session identifier.
+ * @param log_file_info The LogFileInfo to add.
+ * @return True if added; false if session not found or file already exists.
+ */
+auto LogFileTreeModel::add_log_file(const QString& session_id,
+                                    const LogFileInfo& log_file_info) -> bool
+{
+    const bool added =
+        insert_files(session_id, get_group_name(log_file_info), {log_file_info}) > 0;
+    return added;
+}
+
+/**
+ * @brief Adds multiple log files to a session.
+ *
+ * Files are inserted with one contiguous row insertion per app group.
+ *
+ * @param session_id The session identifier.
+ * @param log_file_infos The list of LogFileInfo objects to add.
+ * @return Number of files successfully added.
+ */
+auto LogFileTreeModel::add_log_files(const QString& session_id,
+                                     const QList<LogFileInfo>& log_file_infos) -> int
+{
+    int count = 0;
+    const auto grouped = group_by_app_name(log_file_infos);
+
+    for (auto it = grouped.constBegin(); it != grouped.constEnd(); ++it)
     {
-        beginRemoveRows(session_index, 0, session_item->child_count() - 1);
+        count += insert_files(session_id, it.key(), it.value());
+    }
 
-        QList<GroupKey> keys_to_remove;
-        for (auto it = m_group_items.constBegin(); it != m_group_items.constEnd(); ++it)
-        {
-            if (it.key().session_id == session_id)
-            {
-                keys_to_remove.append(it.key());
-            }
-        }
-        for (const auto& key: keys_to_remove)
-        {
-            m_group_items.remove(key);
-        }
+    return count;
+}
 
-        while (session_item->child_count() > 0)
-        {
-            LogFileTreeItem* child = session_item->remove_child(0);
-            delete child;
-        }
+/**
+ * @brief Adds files whose app name is not known yet to the provisional group of a session.
+ * @param session_id The session identifier.
+ * @param file_paths The file paths.
+ * @return Number of files added (files already in the provisional group are skipped).
+ */
+auto LogFileTreeModel::add_provisional_log_files(const QString& session_id,
+                                                 const QVector<QString>& file_paths) -> int
+{
+    QList<LogFileInfo> infos;
+    infos.reserve(file_paths.size());
 
-        endRemoveRows();
+    for (const auto& file_path: file_paths)
+    {
+        infos.append(LogFileInfo(file_path));
     }
 
-    const auto grouped = group_by_app_name(log_file_infos);
+    const int count = insert_files(session_id, get_provisional_group_key(), infos);
+    return count;
+}
 
-    for (auto it = grouped.constBegin(); it != grouped.constEnd(); ++it)
+/**
+ * @brief Returns the display name of the group holding files that are still being identified.
+ *
+ * Only shown; the group is keyed by an empty name, which no app group uses.
+ *
+ * @return The translated group name.
+ */
+auto LogFileTreeModel::get_provisional_group_name() -> QString
+{
+    return tr("Identifying...");
+}
+
+/**
+ * @brief Removes a single log file from a session.
+ *
+ * A file that is still in the provisional group is removed from there.
+ *
+ * @param session_id The session identifier.
+ * @param log_file_info The LogFileInfo to remove.
+ * @return True if removed; false if not found.
+ */
+auto LogFileTreeModel::remove_log_file(const QString& session_id,
+                                       const LogFileInfo& log_file_info) -> bool
+{
+    const QVector<QString> file_paths{log_file_info.get_file_path()};
+    bool removed = remove_files(session_id, get_group_name(log_file_info), file_paths) > 0;
+
+    if (!removed)
     {
-        const int group_row = session_item->child_count();
-        beginInsertRows(session_index, group_row, group_row);
+        removed = remove_files(session_id, get_provisional_group_key(), file_paths) > 0;
+    }
 
-        QVector<QVariant> group_data;
-        group_data << QVariant::fromValue(LogFileTreeItem::Type::Group) << it.key();
-        auto* group_item = new LogFileTreeItem(group_data, session_item);
-        session_item->append_child(group_item);
-        m_group_items[{session_id, it.key()}] = group_item;
+    return removed;
+}
 
-        endInsertRows();
+/**
+ * @brief Clears all log files from a session (keeps the session node).
+ * @param session_id The session identifier.
+ */
+auto LogFileTreeModel::clear_session_files(const QString& session_id) -> void
+{
+    LogFileTreeItem* session_item = m_session_items.value(session_id, nullptr);
 
-        const QModelIndex group_index = index(group_row, 0, session_index);
+    if (session_item != nullptr && session_item->child_count() > 0)
+    {
+        beginRemoveRows(item_index(session_item), 0, session_item->child_count() - 1);
 
-        beginInsertRows(group_index, 0, it.value().size() - 1);
-        for (const auto& file_info: it.value())
-        {
-            QVector<QVariant> file_data;
-            file_data << QVariant::fromValue(LogFileTreeItem::Type::File)
-                      << QVariant::fromValue(file_info);
-            auto* file_item = new LogFileTreeItem(file_data, group_item);
-            group_item->append_child(file_item);
-        }
-        endInsertRows();
+        forget_session_items(session_id, session_item);
+        const QVector<LogFileTreeItem*> children =
+            session_item->take_children(0, session_item->child_count());
+        qDeleteAll(children);
+
+        endRemoveRows();
     }
 }
 
+// -----------------------------------------------------------------------------
+// Log file management (all sessions)
+// -----------------------------------------------------------------------------
+
 /**
- * @brief Adds a single log file to a session.
- * @param session_id The session identifier.
+ * @brief Sets the log files for all existing sessions (replaces existing files).
+ * @param log_file_infos The list of LogFileInfo objects.
+ */
+auto LogFileTreeModel::set_log_files(const QList<LogFileInfo>& log_file_infos) -> void
+{
+    const QList<QString> session_ids = m_session_items.keys();
+    for (const QString& session_id: session_ids)
+    {
+        set_log_files(session_id, log_file_infos);
+    }
+}
+
+/**
+ * @brief Adds a single log file to all existing sessions.
  * @param log_file_info The LogFileInfo to add.
- * @return True if added; false if session not found or file already exists.
  */
-auto LogFileTreeModel::add_log_file(const QString& session_id,
-                                    const LogFileInfo& log_file_info) -> bool
+auto LogFileTreeModel::add_log_file(const LogFileInfo& log_file_info) -> void
 {
-    bool added = false;
-    LogFileTreeItem* session_item = m_session_items.value(session_id, nullptr);
+    const QList<QString> session_ids = m_session_items.keys();
+    for (const QString& session_id: session_ids)
+    {
+        add_log_file(session_id, log_file_info);
+    }
+}
 
-    if (session_item == nullptr)
+/**
+ * @brief Adds multiple log files to all existing sessions (one insertion per group).
+ * @param log_file_infos The list of LogFileInfo objects to add.
+ */
+auto LogFileTreeModel::add_log_files(const QList<LogFileInfo>& log_file_infos) -> void
+{
+    const QList<QString> session_ids = m_session_items.keys();
+    for (const QString& session_id: session_ids)
     {
-        add_session(session_id, session_id);
-        session_item = m_session_items.value(session_id);
+        add_log_files(session_id, log_file_infos);
     }
+}
 
-    QString app_name = log_file_info.get_app_name();
-    if (app_name.isEmpty())
+/**
+ * @brief Adds files whose app name is not known yet to all existing sessions.
+ * @param file_paths The file paths.
+ */
+auto LogFileTreeModel::add_provisional_log_files(const QVector<QString>& file_paths) -> void
+{
+    const QList<QString> session_ids = m_session_items.keys();
+    for (const QString& session_id: session_ids)
     {
-        app_name = tr("Unknown");
+        add_provisional_log_files(session_id, file_paths);
     }
+}
 
-    LogFileTreeItem* group_item = find_or_create_group(session_item, session_id, app_name);
+/**
+ * @brief Moves provisional files into the groups of their identified apps (in all sessions).
+ *
+ * Each session gets one removal per contiguous run of provisional rows and one insertion per
+ * target group.
+ *
+ * @param log_file_infos The files with their identified app names.
+ * @return Number of file items regrouped.
+ */
+auto LogFileTreeModel::resolve_provisional_log_files(const QList<LogFileInfo>& log_file_infos)
+    -> int
+{
+    int count = 0;
+    const QString provisional_group = get_provisional_group_key();
+    const QList<QString> session_ids = m_session_items.keys();
 
-    const int existing_row = find_file_row(group_item, log_file_info.get_file_path());
-    if (existing_row < 0)
+    for (const QString& session_id: session_ids)
     {
-        const int session_row = get_session_row(session_item);
-        const QModelIndex session_index = index(session_row, 0, QModelIndex());
+        QList<LogFileInfo> resolved;
+        QVector<QString> resolved_paths;
 
-        int group_row = -1;
-        for (int i = 0; i < session_item->child_count(); ++i)
+        for (const auto& info: log_file_infos)
         {
-            if (session_item->child(i) == group_item)
+            if (m_file_items.contains({session_id, provisional_group, info.get_file_path()}))
             {
-                group_row = i;
+                resolved.append(info);
+                resolved_paths.append(info.get_file_path());
             }
         }
 
-        const QModelIndex group_index = index(group_row, 0, session_index);
-        const int file_row = group_item->child_count();
-
-        beginInsertRows(group_index, file_row, file_row);
+        if (!resolved.isEmpty())
+        {
+            remove_files(session_id, provisional_group, resolved_paths);
+            add_log_files(session_id, resolved);
+            count += resolved.size();
+        }
+    }
 
-        QVector<QVariant> file_data;
-        file_data << QVariant::fromValue(LogFileTreeItem::Type::File)
-                  << QVariant::fromValue(log_file_info);
-        auto* file_item = new LogFileTreeItem(file_data, group_item);
-        group_item->append_child(file_item);
+    return count;
+}
 
-        endInsertRows();
-        added = true;
+/**
+ * @brief Removes a single log file from all sessions where it exists.
+ * @param log_file_info The LogFileInfo to remove.
+ */
+auto LogFileTreeModel::remove_log_file(const LogFileInfo& log_file_info) -> void
+{
+    const QList<QString> session_ids = m_session_items.keys();
+    for (const QString& session_id: session_ids)
+    {
+        remove_log_file(session_id, log_file_info);
     }
-
-    return added;
 }
 
+// -----------------------------------------------------------------------------
+// Watch folders
+// -----------------------------------------------------------------------------
+
 /**
- * @brief Adds multiple log files to a session.
- * @param session_id The session identifier.
- * @param log_file_infos The list of LogFileInfo objects to add.
- * @return Number of files successfully added.
+ * @brief Adds a watch folder to a session; its content is fetched when first expanded.
+ * @param session_id The session identifier (the session is created if needed).
+ * @param folder_path The folder path.
+ * @return True if added; false if the session already watches the folder.
  */
-auto LogFileTreeModel::add_log_files(const QString& session_id,
-                                     const QList<LogFileInfo>& log_file_infos) -> int
+auto LogFileTreeModel::add_watch_folder(const QString& session_id, const QString& folder_path)
+    -> bool
 {
-    int count = 0;
+    bool added = false;
+    const QString path = QDir::cleanPath(QFileInfo(folder_path).absoluteFilePath());
 
-    for (const auto& file_info: log_file_infos)
+    if (!session_id.isEmpty() && !folder_path.isEmpty() &&
+        !get_watch_folders(session_id).contains(path))
     {
-        if (add_log_file(session_id, file_info))
+        if (!m_session_items.contains(session_id))
         {
-            ++count;
+            add_session(session_id, session_id);
         }
+
+        LogFileTreeItem* session_item = m_session_items.value(session_id);
+        const int row = session_item->child_count();
+
+        beginInsertRows(item_index(session_item), row, row);
+        session_item->append_child(create_folder_item(session_item, path));
+        endInsertRows();
+
+        added = true;
     }
 
-    return count;
+    return added;
 }
 
 /**
- * @brief Removes a single log file from a session.
+ * @brief Removes a watch folder (and everything listed below it) from a session.
  * @param session_id The session identifier.
- * @param log_file_info The LogFileInfo to remove.
+ * @param folder_path The folder path.
  * @return True if removed; false if not found.
  */
-auto LogFileTreeModel::remove_log_file(const QString& session_id,
-                                       const LogFileInfo& log_file_info) -> bool
+auto LogFileTreeModel::remove_watch_folder(const QString& session_id,
+                                           const QString& folder_path) -> bool
 {
     bool removed = false;
     LogFileTreeItem* session_item = m_session_items.value(session_id, nullptr);
+    const QString path = QDir::cleanPath(QFileInfo(folder_path).absoluteFilePath());
 
     if (session_item != nullptr)
     {
-        QString app_name = log_file_info.get_app_name();
-        if (app_name.isEmpty())
+        for (int row = 0; row < session_item->child_count() && !removed; ++row)
         {
-            app_name = tr("Unknown");
-        }
-
-        LogFileTreeItem* group_item = m_group_items.value({session_id, app_name}, nullptr);
+            const LogFileTreeItem* child = session_item->child(row);
 
-        if (group_item != nullptr)
-        {
-            const int file_row = find_file_row(group_item, log_file_info.get_file_path());
-
-            if (file_row >= 0)
+            if (item_type(child) == LogFileTreeItem::Type::Folder &&
+                child->data(k_folder_path_column).toString() == path)
             {
-                const int session_row = get_session_row(session_item);
-                const QModelIndex session_index = index(session_row, 0, QModelIndex());
-
-                int group_row = -1;
-                for (int i = 0; i < session_item->child_count(); ++i)
-                {
-                    if (session_item->child(i) == group_item)
-                    {
-                        group_row = i;
-                    }
-                }
-
-                const QModelIndex group_index = index(group_row, 0, session_index);
-
-                beginRemoveRows(group_index, file_row, file_row);
-                LogFileTreeItem* file_item = group_item->remove_child(file_row);
-                delete file_item;
-                endRemoveRows();
-
+                remove_rows(session_item, {row});
                 removed = true;
-
-                if (group_item->child_count() == 0)
-                {
-                    beginRemoveRows(session_index, group_row, group_row);
-                    LogFileTreeItem* removed_group = session_item->remove_child(group_row);
-                    m_group_items.remove({session_id, app_name});
-                    delete removed_group;
-                    endRemoveRows();
-                }
             }
         }
     }
@@ -397,83 +540,108 @@ auto LogFileTreeModel::remove_log_file(const QString& session_id,
 }
 
 /**
- * @brief Clears all log files from a session (keeps the session node).
+ * @brief Returns the watch folders of a session.
  * @param session_id The session identifier.
+ * @return The folder paths in tree order.
  */
-auto LogFileTreeModel::clear_session_files(const QString& session_id) -> void
+auto LogFileTreeModel::get_watch_folders(const QString& session_id) const -> QVector<QString>
 {
-    LogFileTreeItem* session_item = m_session_items.value(session_id, nullptr);
+    QVector<QString> folders;
+    const LogFileTreeItem* session_item = m_session_items.value(session_id, nullptr);
 
-    if (session_item != nullptr && session_item->child_count() > 0)
+    if (session_item != nullptr)
     {
-        const int session_row = get_session_row(session_item);
-        const QModelIndex session_index = index(session_row, 0, QModelIndex());
-
-        beginRemoveRows(session_index, 0, session_item->child_count() - 1);
-
-        QList<GroupKey> keys_to_remove;
-        for (auto it = m_group_items.constBegin(); it != m_group_items.constEnd(); ++it)
+        for (int row = 0; row < session_item->child_count(); ++row)
         {
-            if (it.key().session_id == session_id)
+            const LogFileTreeItem* child = session_item->child(row);
+
+            if (item_type(child) == LogFileTreeItem::Type::Folder)
             {
-                keys_to_remove.append(it.key());
+                folders.append(child->data(k_folder_path_column).toString());
             }
         }
-        for (const auto& key: keys_to_remove)
-        {
-            m_group_items.remove(key);
-        }
-
-        while (session_item->child_count() > 0)
-        {
-            LogFileTreeItem* child = session_item->remove_child(0);
-            delete child;
-        }
-
-        endRemoveRows();
     }
+
+    return folders;
 }
 
-// -----------------------------------------------------------------------------
-// Log file management (all sessions)
-// -----------------------------------------------------------------------------
+/**
+ * @brief Checks whether any folder node (watch folder or sub folder) shows a folder.
+ * @param folder_path The folder path.
+ * @return True if at least one folder node has this path.
+ */
+auto LogFileTreeModel::has_folder(const QString& folder_path) const -> bool
+{
+    return m_folder_items.contains(folder_path);
+}
 
 /**
- * @brief Sets the log files for all existing sessions (replaces existing files).
- * @param log_file_infos The list of LogFileInfo objects.
+ * @brief Applies a folder listing to every node showing the folder.
+ *
+ * The first listing populates the node; later listings are applied as a diff: entries that
+ * disappeared are removed (with everything below them), new entries are appended.
+ *
+ * @param folder_path The folder path.
+ * @param sub_folders The absolute paths of the sub folders.
+ * @param files The absolute paths of the log files.
  */
-auto LogFileTreeModel::set_log_files(const QList<LogFileInfo>& log_file_infos) -> void
+auto LogFileTreeModel::apply_folder_listing(const QString& folder_path,
+                                            const QStringList& sub_folders,
+                                            const QStringList& files) -> void
 {
-    const QList<QString> session_ids = m_session_items.keys();
-    for (const QString& session_id: session_ids)
+    // A copy: applying a listing can drop nested nodes of the same path from the index.
+    const QVector<LogFileTreeItem*> folder_items = m_folder_items.value(folder_path);
+
+    for (auto* folder_item: folder_items)
     {
-        set_log_files(session_id, log_file_infos);
+        if (m_folder_items.value(folder_path).contains(folder_item))
+        {
+            apply_listing_to_folder(folder_item, sub_folders, files);
+        }
     }
 }
 
 /**
- * @brief Adds a single log file to all existing sessions.
- * @param log_file_info The LogFileInfo to add.
+ * @brief Sets size and modification time of a folder file (all nodes showing it).
+ * @param file_path The file path.
+ * @param size The file size in bytes.
+ * @param last_modified The modification time.
  */
-auto LogFileTreeModel::add_log_file(const LogFileInfo& log_file_info) -> void
+auto LogFileTreeModel::set_file_metadata(const QString& file_path, qint64 size,
+                                         const QDateTime& last_modified) -> void
 {
-    const QList<QString> session_ids = m_session_items.keys();
-    for (const QString& session_id: session_ids)
+    const QVector<LogFileTreeItem*> file_items = m_folder_file_items.value(file_path);
+
+    for (auto* file_item: file_items)
     {
-        add_log_file(session_id, log_file_info);
+        file_item->set_data(k_file_size_column, size);
+        file_item->set_data(k_file_modified_column, last_modified);
+
+        const QModelIndex idx = item_index(file_item);
+        emit dataChanged(idx, idx, {Qt::ToolTipRole});
     }
 }
 
 /**
- * @brief Removes a single log file from all sessions where it exists.
- * @param log_file_info The LogFileInfo to remove.
+ * @brief Sets the app names of folder files (all nodes showing them).
+ * @param log_file_infos The files with their app names.
  */
-auto LogFileTreeModel::remove_log_file(const LogFileInfo& log_file_info) -> void
+auto LogFileTreeModel::set_file_app_names(const QList<LogFileInfo>& log_file_infos) -> void
 {
-    const QList<QString> session_ids = m_session_items.keys();
-    for (const QString& session_id: session_ids)
+    for (const auto& info: log_file_infos)
     {
-        remove_log_file(session_id, log_file_info);
+        const QVector<LogFileTreeItem*> file_items =
+            m_folder_file_items.value(info.get_file_path());
+
+        for (auto* file_item: file_items)
+        {
+            auto file_info = file_item->data(k_file_info_column).value<LogFileInfo>();
+            file_info.set_app_name(info.get_app_name());
+            file_item->set_data(k_file_info_column, QVariant::fromValue(file_info));
+
+            const QModelIndex idx = item_index(file_item);
+            emit dataChanged(idx, idx, {AppNameRole, Qt::ToolTipRole});
+        }
     }
 }
 
@@ -532,12 +700,23 @@ auto LogFileTreeModel::data(const QModelIndex& index, int role) const -> QVarian
             }
             else if (type == LogFileTreeItem::Type::Group)
             {
-                value = item->data(1);  // app_name
+                const QString app_name = item->data(1).toString();
+                value = app_name.isEmpty() ? get_provisional_group_name() : app_name;
+            }
+            else if (type == LogFileTreeItem::Type::Folder)
+            {
+                value = item->data(k_folder_name_column);
             }
             else if (type == LogFileTreeItem::Type::File)
             {
                 const auto log_file_info = item->data(1).value<LogFileInfo>();
                 value = log_file_info.get_file_name();
+
+                // Folder files are only stat'ed and identified once they are displayed.
+                if (is_folder_file(item) && !item->data(k_file_requested_column).toBool())
+                {
+                    queue_metadata_request(item);
+                }
             }
         }
         else if (role == Qt::DecorationRole && index.column() == 0)
@@ -552,12 +731,49 @@ auto LogFileTreeModel::data(const QModelIndex& index, int role) const -> QVarian
                 value = QIcon(
                     UiUtils::colored_svg_icon(":/Resources/Icons/folder.svg", QColor("#66bb6a")));
             }
+            else if (type == LogFileTreeItem::Type::Folder)
+            {
+                value = QIcon(
+                    UiUtils::colored_svg_icon(":/Resources/Icons/folder.svg", QColor("#90a4ae")));
+            }
             else if (type == LogFileTreeItem::Type::File)
             {
                 value = QIcon(
                     UiUtils::colored_svg_icon(":/Resources/Icons/file.svg", QColor("#42a5f5")));
             }
         }
+        else if (role == Qt::ToolTipRole && type == LogFileTreeItem::Type::Folder)
+        {
+            value = QDir::toNativeSeparators(item->data(k_folder_path_column).toString());
+        }
+        else if (role == Qt::ToolTipRole && is_folder_file(item))
+        {
+            const auto log_file_info = item->data(k_file_info_column).value<LogFileInfo>();
+            const QVariant size = item->data(k_file_size_column);
+            const QVariant last_modified = item->data(k_file_modified_column);
+            QStringList lines{QDir::toNativeSeparators(log_file_info.get_file_path())};
+
+            if (!log_file_info.get_app_name().isEmpty())
+            {
+                lines.append(tr("App: %1").arg(log_file_info.get_app_name()));
+            }
+            if (size.isValid() && size.toLongLong() >= 0)
+            {
+                lines.append(tr("Size: %1").arg(QLocale().formattedDataSize(size.toLongLong())));
+            }
+            if (last_modified.isValid())
+            {
+                lines.append(tr("Modified: %1")
+                                 .arg(QLocale().toString(last_modified.toDateTime(),
+                                                         QLocale::ShortFormat)));
+            }
+
+            value = lines.join(QLatin1Char('\n'));
+        }
+        else if (role == FolderPathRole && type == LogFileTreeItem::Type::Folder)
+        {
+            value = item->data(k_folder_path_column);
+        }
         else if (role == ItemTypeRole)
         {
             value = QVariant::fromValue(type);
@@ -730,6 +946,61 @@ auto LogFileTreeModel::parent(const QModelIndex& index) const -> QModelIndex
     return parent_idx;
 }
 
+/**
+ * @brief Returns whether the given parent has children (unfetched folders always do).
+ * @param parent The parent index.
+ * @return True if the item has or may have children.
+ */
+auto LogFileTreeModel::hasChildren(const QModelIndex& parent) const -> bool
+{
+    bool has_children = rowCount(parent) > 0;
+
+    if (!has_children && parent.isValid())
+    {
+        const auto* item = static_cast<LogFileTreeItem*>(parent.internalPointer());
+        has_children = item_type(item) == LogFileTreeItem::Type::Folder &&
+                       item->data(k_folder_state_column).toInt() !=
+                           static_cast<int>(FetchState::Fetched);
+    }
+
+    return has_children;
+}
+
+/**
+ * @brief Returns whether the content of a folder node has not been requested yet.
+ * @param parent The parent index.
+ * @return True for folder nodes that were never fetched.
+ */
+auto LogFileTreeModel::canFetchMore(const QModelIndex& parent) const -> bool
+{
+    bool can_fetch = false;
+
+    if (parent.isValid())
+    {
+        const auto* item = static_cast<LogFileTreeItem*>(parent.internalPointer());
+        can_fetch = item_type(item) == LogFileTreeItem::Type::Folder &&
+                    item->data(k_folder_state_column).toInt() ==
+                        static_cast<int>(FetchState::NotFetched);
+    }
+
+    return can_fetch;
+}
+
+/**
+ * @brief Requests the content of a folder node via folder_fetch_requested().
+ * @param parent The parent index.
+ */
+auto LogFileTreeModel::fetchMore(const QModelIndex& parent) -> void
+{
+    if (canFetchMore(parent))
+    {
+        auto* item = static_cast<LogFileTreeItem*>(parent.internalPointer());
+        item->set_data(k_folder_state_column, static_cast<int>(FetchState::Fetching));
+
+        emit folder_fetch_requested(item->data(k_folder_path_column).toString());
+    }
+}
+
 // -----------------------------------------------------------------------------
 // Private helpers
 // -----------------------------------------------------------------------------
@@ -737,7 +1008,7 @@ auto LogFileTreeModel::parent(const QModelIndex& index) const -> QModelIndex
 /**
  * @brief Helper to group files by application name.
  * @param files The list of LogFileInfo objects.
- * @return A map from app name to list of files.
+ * @return A map from group name to list of files (input order is kept per group).
  */
 auto LogFileTreeModel::group_by_app_name(const QList<LogFileInfo>& files)
     -> QMap<QString, QList<LogFileInfo>>
@@ -746,44 +1017,35 @@ auto LogFileTreeModel::group_by_app_name(const QList<LogFileInfo>& files)
 
     for (const auto& file: files)
     {
-        QString app_name = file.get_app_name();
-        if (app_name.isEmpty())
-        {
-            app_name = tr("Unknown");
-        }
-        groups[app_name].append(file);
+        groups[get_group_name(file)].append(file);
     }
 
     return groups;
 }
 
 /**
- * @brief Finds the row of a file in a group by file path.
- * @param group_item The group item.
- * @param file_path The file path to search for.
- * @return The row index, or -1 if not found.
+ * @brief Returns the group a file belongs to (its app name, or "Unknown").
+ * @param log_file_info The file.
+ * @return The group name.
  */
-auto LogFileTreeModel::find_file_row(LogFileTreeItem* group_item,
-                                     const QString& file_path) const -> int
+auto LogFileTreeModel::get_group_name(const LogFileInfo& log_file_info) -> QString
 {
-    int found_row = -1;
-
-    for (int i = 0; i < group_item->child_count() && found_row < 0; ++i)
+    QString app_name = log_file_info.get_app_name();
+    if (app_name.isEmpty())
     {
-        auto* child = group_item->child(i);
-        const auto type = child->data(0).value<LogFileTreeItem::Type>();
-
-        if (type == LogFileTreeItem::Type::File)
-        {
-            const auto info = child->data(1).value<LogFileInfo>();
-            if (info.get_file_path() == file_path)
-            {
-                found_row = i;
-            }
-        }
+        app_name = tr("Unknown");
     }
+    return app_name;
+}
 
-    return found_row;
+/**
+ * @brief Returns the model index (column 0) of a session or group item.
+ * @param item The tree item.
+ * @return The model index.
+ */
+auto LogFileTreeModel::item_index(LogFileTreeItem* item) const -> QModelIndex
+{
+    return createIndex(item->row(), 0, item);
 }
 
 /**
@@ -801,11 +1063,9 @@ auto LogFileTreeModel::find_or_create_group(LogFileTreeItem* session_item,
 
     if (group_item == nullptr)
     {
-        const int session_row = get_session_row(session_item);
-        const QModelIndex session_index = index(session_row, 0, QModelIndex());
         const int group_row = session_item->child_count();
 
-        beginInsertRows(session_index, group_row, group_row);
+        beginInsertRows(item_index(session_item), group_row, group_row);
 
         QVector<QVariant> group_data;
         group_data << QVariant::fromValue(LogFileTreeItem::Type::Group) << app_name;
@@ -820,49 +1080,390 @@ auto LogFileTreeModel::find_or_create_group(LogFileTreeItem* session_item,
 }
 
 /**
- * @brief Removes empty groups from a session.
- * @param session_item The session item to clean up.
+ * @brief Appends files to a named group of a session with a single row insertion.
+ *
+ * Creates session and group as needed. Files already in the group (or repeated in the input)
+ * are skipped; the lookup uses the file index, so no group is scanned.
+ *
  * @param session_id The session identifier.
+ * @param group_name The group (app) name.
+ * @param log_file_infos The files to add.
+ * @return Number of files added.
  */
-auto LogFileTreeModel::remove_empty_groups(LogFileTreeItem* session_item,
-                                           const QString& session_id) -> void
+auto LogFileTreeModel::insert_files(const QString& session_id, const QString& group_name,
+                                    const QList<LogFileInfo>& log_file_infos) -> int
 {
-    const int session_row = get_session_row(session_item);
-    const QModelIndex session_index = index(session_row, 0, QModelIndex());
+    QList<LogFileInfo> new_files;
+    QSet<QString> seen_paths;
+    new_files.reserve(log_file_infos.size());
 
-    for (int i = session_item->child_count() - 1; i >= 0; --i)
+    for (const auto& info: log_file_infos)
     {
-        LogFileTreeItem* group_item = session_item->child(i);
+        const QString& file_path = info.get_file_path();
+
+        if (!seen_paths.contains(file_path) &&
+            !m_file_items.contains({session_id, group_name, file_path}))
+        {
+            seen_paths.insert(file_path);
+            new_files.append(info);
+        }
+    }
+
+    if (!new_files.isEmpty())
+    {
+        LogFileTreeItem* session_item = m_session_items.value(session_id, nullptr);
+
+        if (session_item == nullptr)
+        {
+            add_session(session_id, session_id);
+            session_item = m_session_items.value(session_id);
+        }
+
+        LogFileTreeItem* group_item = find_or_create_group(session_item, session_id, group_name);
+        const int first_row = group_item->child_count();
+
+        beginInsertRows(item_index(group_item), first_row,
+                        first_row + static_cast<int>(new_files.size()) - 1);
+
+        for (const auto& info: new_files)
+        {
+            QVector<QVariant> file_data;
+            file_data << QVariant::fromValue(LogFileTreeItem::Type::File)
+                      << QVariant::fromValue(info);
+            auto* file_item = new LogFileTreeItem(file_data, group_item);
+            group_item->append_child(file_item);
+            m_file_items.insert({session_id, group_name, info.get_file_path()}, file_item);
+        }
+
+        endInsertRows();
+    }
+
+    return static_cast<int>(new_files.size());
+}
+
+/**
+ * @brief Removes files from a named group of a session and drops the group when empty.
+ *
+ * Rows are located through the file index and removed with one removal per contiguous run.
+ *
+ * @param session_id The session identifier.
+ * @param group_name The group (app) name.
+ * @param file_paths The file paths to remove.
+ * @return Number of files removed.
+ */
+auto LogFileTreeModel::remove_files(const QString& session_id, const QString& group_name,
+                                    const QVector<QString>& file_paths) -> int
+{
+    int removed = 0;
+    LogFileTreeItem* session_item = m_session_items.value(session_id, nullptr);
+    LogFileTreeItem* group_item = m_group_items.value({session_id, group_name}, nullptr);
+
+    if (session_item != nullptr && group_item != nullptr)
+    {
+        QVector<int> rows;
+        rows.reserve(file_paths.size());
+
+        for (const auto& file_path: file_paths)
+        {
+            LogFileTreeItem* file_item =
+                m_file_items.take({session_id, group_name, file_path});
+
+            if (file_item != nullptr)
+            {
+                rows.append(file_item->row());
+            }
+        }
+
+        removed = static_cast<int>(rows.size());
+        remove_rows(group_item, rows);
 
         if (group_item->child_count() == 0)
         {
-            const QString app_name = group_item->data(1).toString();
+            const int group_row = group_item->row();
 
-            beginRemoveRows(session_index, i, i);
-            LogFileTreeItem* removed = session_item->remove_child(i);
-            m_group_items.remove({session_id, app_name});
-            delete removed;
+            beginRemoveRows(item_index(session_item), group_row, group_row);
+            LogFileTreeItem* removed_group = session_item->remove_child(group_row);
+            m_group_items.remove({session_id, group_name});
+            delete removed_group;
             endRemoveRows();
         }
     }
+
+    return removed;
 }
 
 /**
- * @brief Gets the row index of a session item.
+ * @brief Drops the group and file index entries of a session (items are not deleted).
+ * @param session_id The session identifier.
  * @param session_item The session item.
- * @return The row index.
  */
-auto LogFileTreeModel::get_session_row(LogFileTreeItem* session_item) const -> int
+auto LogFileTreeModel::forget_session_items(const QString& session_id,
+                                            LogFileTreeItem* session_item) -> void
+{
+    for (int g = 0; g < session_item->child_count(); ++g)
+    {
+        LogFileTreeItem* group_item = session_item->child(g);
+
+        if (item_type(group_item) == LogFileTreeItem::Type::Folder)
+        {
+            forget_folder_entries(group_item);
+        }
+        else
+        {
+            const QString group_name = group_item->data(1).toString();
+
+            for (int f = 0; f < group_item->child_count(); ++f)
+            {
+                const auto info = group_item->child(f)->data(1).value<LogFileInfo>();
+                m_file_items.remove({session_id, group_name, info.get_file_path()});
+            }
+
+            m_group_items.remove({session_id, group_name});
+        }
+    }
+}
+
+/**
+ * @brief Removes child rows of an item, one removal per contiguous run of rows.
+ *
+ * Folder entries below the removed items are dropped from the folder indexes.
+ *
+ * @param parent_item The parent item.
+ * @param rows The rows to remove (any order, no duplicates).
+ */
+auto LogFileTreeModel::remove_rows(LogFileTreeItem* parent_item, QVector<int> rows) -> void
 {
-    int row = -1;
+    // Remove from the bottom up so the rows of earlier runs stay valid.
+    std::sort(rows.begin(), rows.end(), std::greater<>());
+    const QModelIndex parent_index = item_index(parent_item);
+    qsizetype run_start = 0;
 
-    for (int i = 0; i < m_root_item->child_count() && row < 0; ++i)
+    while (run_start < rows.size())
     {
-        if (m_root_item->child(i) == session_item)
+        qsizetype run_end = run_start;
+        while (run_end + 1 < rows.size() && rows.at(run_end + 1) == rows.at(run_end) - 1)
+        {
+            ++run_end;
+        }
+
+        const int first_row = rows.at(run_end);
+        const int last_row = rows.at(run_start);
+
+        beginRemoveRows(parent_index, first_row, last_row);
+        const QVector<LogFileTreeItem*> removed_items =
+            parent_item->take_children(first_row, last_row - first_row + 1);
+        for (auto* removed_item: removed_items)
         {
-            row = i;
+            forget_folder_entries(removed_item);
         }
+        qDeleteAll(removed_items);
+        endRemoveRows();
+
+        run_start = run_end + 1;
     }
+}
+
+/**
+ * @brief Creates a folder item (not yet attached) and registers it in the folder index.
+ * @param parent_item The parent item.
+ * @param folder_path The folder path.
+ * @return The new folder item.
+ */
+auto LogFileTreeModel::create_folder_item(LogFileTreeItem* parent_item,
+                                          const QString& folder_path) -> LogFileTreeItem*
+{
+    // Watch folders show their full path, sub folders only their name.
+    const QString display_name = item_type(parent_item) == LogFileTreeItem::Type::Session
+                                     ? QDir::toNativeSeparators(folder_path)
+                                     : QFileInfo(folder_path).fileName();
+
+    QVector<QVariant> folder_data;
+    folder_data << QVariant::fromValue(LogFileTreeItem::Type::Folder) << folder_path
+                << display_name << static_cast<int>(FetchState::NotFetched);
+    auto* folder_item = new LogFileTreeItem(folder_data, parent_item);
+    m_folder_items[folder_path].append(folder_item);
+
+    return folder_item;
+}
+
+/**
+ * @brief Creates a folder file item (not yet attached) and registers it in the index.
+ * @param parent_item The parent folder item.
+ * @param file_path The file path.
+ * @return The new file item.
+ */
+auto LogFileTreeModel::create_folder_file_item(LogFileTreeItem* parent_item,
+                                               const QString& file_path) -> LogFileTreeItem*
+{
+    QVector<QVariant> file_data;
+    file_data << QVariant::fromValue(LogFileTreeItem::Type::File)
+              << QVariant::fromValue(LogFileInfo(file_path)) << QVariant() << QVariant()
+              << false;
+    auto* file_item = new LogFileTreeItem(file_data, parent_item);
+    m_folder_file_items[file_path].append(file_item);
+
+    return file_item;
+}
+
+/**
+ * @brief Applies a listing to one folder node (see apply_folder_listing()).
+ * @param folder_item The folder item.
+ * @param sub_folders The absolute paths of the sub folders.
+ * @param files The absolute paths of the log files.
+ */
+auto LogFileTreeModel::apply_listing_to_folder(LogFileTreeItem* folder_item,
+                                               const QStringList& sub_folders,
+                                               const QStringList& files) -> void
+{
+    const QSet<QString> listed_folders(sub_folders.cbegin(), sub_folders.cend());
+    const QSet<QString> listed_files(files.cbegin(), files.cend());
+    QSet<QString> present_folders;
+    QSet<QString> present_files;
+    QVector<int> stale_rows;
 
-    return row;
+    for (int row = 0; row < folder_item->child_count(); ++row)
+    {
+        const LogFileTreeItem* child = folder_item->child(row);
+
+        if (item_type(child) == LogFileTreeItem::Type::Folder)
+        {
+            const QString path = child->data(k_folder_path_column).toString();
+            present_folders.insert(path);
+            if (!listed_folders.contains(path))
+            {
+                stale_rows.append(row);
+            }
+        }
+        else
+        {
+            const QString path =
+                child->data(k_file_info_column).value<LogFileInfo>().get_file_path();
+            present_files.insert(path);
+            if (!listed_files.contains(path))
+            {
+                stale_rows.append(row);
+            }
+        }
+    }
+
+    remove_rows(folder_item, stale_rows);
+
+    QStringList new_folders;
+    QStringList new_files;
+    for (const auto& path: sub_folders)
+    {
+        if (!present_folders.contains(path))
+        {
+            new_folders.append(path);
+        }
+    }
+    for (const auto& path: files)
+    {
+        if (!present_files.contains(path))
+        {
+            new_files.append(path);
+        }
+    }
+
+    if (!new_folders.isEmpty() || !new_files.isEmpty())
+    {
+        const int first_row = folder_item->child_count();
+        const int count = static_cast<int>(new_folders.size() + new_files.size());
+
+        beginInsertRows(item_index(folder_item), first_row, first_row + count - 1);
+        for (const auto& path: new_folders)
+        {
+            folder_item->append_child(create_folder_item(folder_item, path));
+        }
+        for (const auto& path: new_files)
+        {
+            folder_item->append_child(create_folder_file_item(folder_item, path));
+        }
+        endInsertRows();
+    }
+
+    folder_item->set_data(k_folder_state_column, static_cast<int>(FetchState::Fetched));
+}
+
+/**
+ * @brief Drops an item and everything below it from the folder indexes.
+ *
+ * folder_removed() is emitted for folder paths no longer shown anywhere.
+ *
+ * @param item The item.
+ */
+auto LogFileTreeModel::forget_folder_entries(LogFileTreeItem* item) -> void
+{
+    if (item_type(item) == LogFileTreeItem::Type::Folder)
+    {
+        const QString path = item->data(k_folder_path_column).toString();
+        auto it = m_folder_items.find(path);
+        if (it != m_folder_items.end())
+        {
+            it->removeOne(item);
+            if (it->isEmpty())
+            {
+                m_folder_items.erase(it);
+                emit folder_removed(path);
+            }
+        }
+
+        for (int row = 0; row < item->child_count(); ++row)
+        {
+            forget_folder_entries(item->child(row));
+        }
+    }
+    else if (is_folder_file(item))
+    {
+        const QString path = item->data(k_file_info_column).value<LogFileInfo>().get_file_path();
+        auto it = m_folder_file_items.find(path);
+        if (it != m_folder_file_items.end())
+        {
+            it->removeOne(item);
+            if (it->isEmpty())
+            {
+                m_folder_file_items.erase(it);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Queues a metadata request for a folder file (called while painting).
+ * @param item The folder file item.
+ */
+auto LogFileTreeModel::queue_metadata_request(LogFileTreeItem* item) const -> void
+{
+    item->set_data(k_file_requested_column, true);
+
+    if (m_metadata_queue.isEmpty())
+    {
+        m_metadata_timer->start();
+    }
+
+    m_metadata_queue.append(
+        item->data(k_file_info_column).value<LogFileInfo>().get_file_path());
+}
+
+/**
+ * @brief Emits file_metadata_requested() for all queued files.
+ */
+auto LogFileTreeModel::flush_metadata_requests() -> void
+{
+    const QVector<QString> file_paths = std::exchange(m_metadata_queue, {});
+
+    if (!file_paths.isEmpty())
+    {
+        emit file_metadata_requested(file_paths);
+    }
+}
+
+/**
+ * @brief Gets the row index of a session item.
+ * @param session_item The session item.
+ * @return The row index.
+ */
+auto LogFileTreeModel::get_session_row(LogFileTreeItem* session_item) const -> int
+{
+    return session_item->row();
 }
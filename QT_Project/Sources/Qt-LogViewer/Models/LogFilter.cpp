@@ -0,0 +1,415 @@
+/**
+ * @file LogFilter.cpp
+ * @brief This file contains the implementation of the LogFilter class.
+ */
+
+#include "Qt-LogViewer/Models/LogFilter.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "Qt-LogViewer/Models/LogModel.h"
+
+namespace
+{
+/**
+ * @brief Checks whether a search field names one of the main fields (or all of them).
+ * @param field The lower-case search field.
+ * @return True for "", "all fields", "message", "level" and "appname".
+ */
+auto is_main_field(const QString& field) -> bool
+{
+    return field.isEmpty() || field == QStringLiteral("all fields") ||
+           field == QStringLiteral("message") || field == QStringLiteral("level") ||
+           field == QStringLiteral("appname");
+}
+}  // namespace
+
+/**
+ * @brief Checks whether any setting restricts the rows.
+ * @return True if at least one filter is set.
+ */
+auto LogFilter::Spec::is_active() const -> bool
+{
+    return !app_name.isEmpty() || !levels.isEmpty() || !search_text.isEmpty() ||
+           !show_only_file_path.isEmpty() || !hidden_file_paths.isEmpty() ||
+           (novel_only && baseline != nullptr);
+}
+
+/**
+ * @brief Compiles a filter from its settings.
+ * @param spec The settings; search settings are ignored while the search text is empty, the
+ *        novelty setting while there is no baseline.
+ */
+LogFilter::LogFilter(Spec spec): m_spec(std::move(spec))
+{
+    if (m_spec.search_text.isEmpty())
+    {
+        // Keep equal specs for equal behavior, so stale batch verdicts are detected reliably.
+        m_spec.search_field.clear();
+        m_spec.use_regex = false;
+    }
+
+    if (m_spec.baseline == nullptr)
+    {
+        m_spec.novel_only = false;
+    }
+
+    m_active = m_spec.is_active();
+    m_search_field_lower = m_spec.search_field.trimmed().toLower();
+    m_all_fields = (m_search_field_lower == QStringLiteral("all fields"));
+
+    const bool is_ascii = std::all_of(m_spec.search_text.cbegin(), m_spec.search_text.cend(),
+                                      [](QChar c) { return c.unicode() < 0x80; });
+    m_search_text_ascii =
+        (!m_spec.use_regex && is_ascii) ? m_spec.search_text.toLatin1() : QByteArray();
+
+    if (m_spec.use_regex)
+    {
+        m_search_regex =
+            QRegularExpression(m_spec.search_text, QRegularExpression::CaseInsensitiveOption);
+    }
+
+    m_search_number = m_spec.search_text.trimmed().toLongLong(&m_search_is_number);
+}
+
+/**
+ * @brief Returns the settings the filter was compiled from.
+ * @return The spec.
+ */
+auto LogFilter::get_spec() const -> const Spec&
+{
+    return m_spec;
+}
+
+/**
+ * @brief Checks whether any setting restricts the rows.
+ * @return True if at least one filter is set.
+ */
+auto LogFilter::is_active() const -> bool
+{
+    return m_active;
+}
+
+/**
+ * @brief Evaluates one entry.
+ * @param entry The entry.
+ * @param model The model the entry is shown in, for extra column typing; nullptr on worker
+ *        threads.
+ * @return The verdict; never Undecided if a model is given.
+ */
+auto LogFilter::evaluate(const LogEntry& entry, const LogModel* model) const -> Verdict
+{
+    Verdict verdict = Verdict::Accepted;
+
+    if (m_active)
+    {
+        const QString file_path = entry.get_file_info().get_file_path();
+
+        if (!m_spec.show_only_file_path.isEmpty() && file_path != m_spec.show_only_file_path)
+        {
+            verdict = Verdict::Rejected;
+        }
+        else if (m_spec.hidden_file_paths.contains(file_path))
+        {
+            verdict = Verdict::Rejected;
+        }
+        else if (!m_spec.app_name.isEmpty() && entry.get_app_name() != m_spec.app_name)
+        {
+            verdict = Verdict::Rejected;
+        }
+        else if (!m_spec.levels.isEmpty() &&
+                 !m_spec.levels.contains(entry.get_level().trimmed().toLower()))
+        {
+            verdict = Verdict::Rejected;
+        }
+        else if (m_spec.novel_only && !entry.is_novel())
+        {
+            verdict = Verdict::Rejected;
+        }
+        else if (!m_spec.search_text.isEmpty())
+        {
+            switch (match_search(entry, model))
+            {
+            case Match::No:
+                verdict = Verdict::Rejected;
+                break;
+            case Match::Unknown:
+                verdict = Verdict::Undecided;
+                break;
+            case Match::Yes:
+                break;
+            }
+        }
+    }
+
+    return verdict;
+}
+
+/**
+ * @brief Evaluates a batch of entries without a model and counts their facets.
+ * @param entries The entries.
+ * @return One accepted and one undecided bit per entry, plus the facet counts.
+ */
+auto LogFilter::evaluate_batch(const QVector<LogEntry>& entries) const -> BatchVerdicts
+{
+    BatchVerdicts verdicts;
+    verdicts.spec = m_spec;
+
+    const auto size = static_cast<qsizetype>(entries.size());
+    verdicts.accepted.resize(size);
+    verdicts.undecided.resize(size);
+
+    for (qsizetype i = 0; i < size; ++i)
+    {
+        const LogEntry& entry = entries.at(i);
+        const Verdict verdict = evaluate(entry);
+        verdicts.accepted.setBit(i, verdict == Verdict::Accepted);
+        verdicts.undecided.setBit(i, verdict == Verdict::Undecided);
+        verdicts.counts.add_entry(entry);
+
+        if (verdict == Verdict::Accepted)
+        {
+            verdicts.accepted_counts.add_entry(entry);
+        }
+    }
+
+    return verdicts;
+}
+
+/**
+ * @brief Evaluates the search settings.
+ *
+ * A search field naming an extra column searches that column only. Without a model, the
+ * entry's own fields stand in for the model's columns: every field of the entry is a column
+ * once the entry is added. A field the entry lacks may still be a column of the model (the
+ * search then fails) or not (the search falls back to the main fields), which only the model
+ * can tell.
+ *
+ * @param entry The entry.
+ * @param model The model, or nullptr.
+ * @return Whether the entry matches the search.
+ */
+auto LogFilter::match_search(const LogEntry& entry, const LogModel* model) const -> Match
+{
+    Match match = Match::No;
+    int extra_column = -1;
+    QVariant extra_value;
+    bool has_extra_value = false;
+
+    if (model != nullptr)
+    {
+        extra_column = model->find_extra_column(m_spec.search_field);
+
+        if (extra_column >= 0)
+        {
+            const int extra_index = extra_column - (LogModel::AppName + 1);
+            extra_value = entry.get_extra_field(model->get_extra_column_names().at(extra_index));
+            has_extra_value = true;
+        }
+    }
+    else
+    {
+        const auto fields = entry.get_extra_fields();
+
+        for (const auto& field: fields)
+        {
+            if (!has_extra_value && field.first.toLower() == m_search_field_lower)
+            {
+                extra_value = field.second;
+                has_extra_value = true;
+            }
+        }
+    }
+
+    if (has_extra_value)
+    {
+        const int numeric =
+            (model != nullptr) ? static_cast<int>(model->is_extra_column_numeric(extra_column))
+                               : -1;
+        match = match_extra_value(extra_value, numeric);
+    }
+    else if (model == nullptr && !is_main_field(m_search_field_lower))
+    {
+        match = matches_main_fields(entry) ? Match::Unknown : Match::No;
+    }
+    else if (matches_main_fields(entry))
+    {
+        match = Match::Yes;
+    }
+    else if (m_all_fields)
+    {
+        match = match_extra_fields(entry, model);
+    }
+
+    return match;
+}
+
+/**
+ * @brief Matches the message, level and app name according to the search field.
+ * @param entry The entry.
+ * @return True if one of the searched fields matches.
+ */
+auto LogFilter::matches_main_fields(const LogEntry& entry) const -> bool
+{
+    bool matches = false;
+
+    if (m_spec.use_regex && !m_search_regex.isValid())
+    {
+        matches = false;
+    }
+    else if (m_search_field_lower == QStringLiteral("message"))
+    {
+        matches = matches_message(entry);
+    }
+    else if (m_search_field_lower == QStringLiteral("level"))
+    {
+        matches = matches_text(entry.get_level());
+    }
+    else if (m_search_field_lower == QStringLiteral("appname"))
+    {
+        matches = matches_text(entry.get_app_name());
+    }
+    else
+    {
+        matches = matches_message(entry) || matches_text(entry.get_level()) ||
+                  matches_text(entry.get_app_name());
+    }
+
+    return matches;
+}
+
+/**
+ * @brief Matches the message, using a byte search for ASCII search text.
+ * @param entry The entry.
+ * @return True if the message matches.
+ */
+auto LogFilter::matches_message(const LogEntry& entry) const -> bool
+{
+    bool matches = false;
+
+    if (!m_search_text_ascii.isEmpty())
+    {
+        // Multi-byte UTF-8 sequences consist of bytes >= 0x80 only, which never case-fold onto
+        // ASCII, so a Latin-1 case-insensitive search over the raw bytes is exact here.
+        const QByteArray message = entry.get_message_utf8();
+        matches = QLatin1String(message).contains(QLatin1String(m_search_text_ascii),
+                                                  Qt::CaseInsensitive);
+    }
+    else
+    {
+        matches = matches_text(entry.get_message());
+    }
+
+    return matches;
+}
+
+/**
+ * @brief Matches a text with the search text or regex.
+ * @param text The text.
+ * @return True if the text matches.
+ */
+auto LogFilter::matches_text(const QString& text) const -> bool
+{
+    bool matches = false;
+
+    if (m_spec.use_regex)
+    {
+        matches = m_search_regex.isValid() && m_search_regex.match(text).hasMatch();
+    }
+    else
+    {
+        matches = text.contains(m_spec.search_text, Qt::CaseInsensitive);
+    }
+
+    return matches;
+}
+
+/**
+ * @brief Matches an extra field value.
+ *
+ * Integer values of numeric columns compare by value for an integer search text (so "42" does
+ * not match "142"); values of text columns compare as text.
+ *
+ * @param value The value (invalid if the entry lacks the field).
+ * @param numeric_column 1 for a numeric column, 0 for a text column, -1 if unknown.
+ * @return Whether the value matches.
+ */
+auto LogFilter::match_extra_value(const QVariant& value, int numeric_column) const -> Match
+{
+    Match match = Match::No;
+    const bool compares_number = value.isValid() && !m_spec.use_regex && m_search_is_number &&
+                                 value.typeId() == QMetaType::LongLong;
+
+    if (!value.isValid())
+    {
+        match = Match::No;
+    }
+    else if (compares_number)
+    {
+        const bool equal = (value.toLongLong() == m_search_number);
+        const bool contains = matches_text(value.toString());
+
+        if (numeric_column == 1)
+        {
+            match = equal ? Match::Yes : Match::No;
+        }
+        else if (numeric_column == 0)
+        {
+            match = contains ? Match::Yes : Match::No;
+        }
+        else if (equal == contains)
+        {
+            match = equal ? Match::Yes : Match::No;
+        }
+        else
+        {
+            match = Match::Unknown;
+        }
+    }
+    else
+    {
+        match = matches_text(value.toString()) ? Match::Yes : Match::No;
+    }
+
+    return match;
+}
+
+/**
+ * @brief Matches all extra fields ("All Fields" search).
+ * @param entry The entry.
+ * @param model The model, or nullptr to use the entry's own fields.
+ * @return Whether any extra field matches.
+ */
+auto LogFilter::match_extra_fields(const LogEntry& entry, const LogModel* model) const -> Match
+{
+    Match match = Match::No;
+
+    if (model != nullptr)
+    {
+        const QVector<QString> extra_names = model->get_extra_column_names();
+
+        for (qsizetype i = 0; i < extra_names.size() && match != Match::Yes; ++i)
+        {
+            const int column = LogModel::AppName + 1 + static_cast<int>(i);
+            match = match_extra_value(entry.get_extra_field(extra_names.at(i)),
+                                      static_cast<int>(model->is_extra_column_numeric(column)));
+        }
+    }
+    else
+    {
+        const auto fields = entry.get_extra_fields();
+
+        for (qsizetype i = 0; i < fields.size() && match != Match::Yes; ++i)
+        {
+            const Match field_match = match_extra_value(fields.at(i).second, -1);
+
+            if (field_match != Match::No)
+            {
+                match = field_match;
+            }
+        }
+    }
+
+    return match;
+}
@@ -0,0 +1,151 @@
+/**
+ * @file LogLevelClassifier.cpp
+ * @brief This file contains the implementation of the LogLevelClassifier class.
+ */
+
+#include "Qt-LogViewer/Models/LogLevelClassifier.h"
+
+#include <QString>
+
+#include <string_view>
+
+namespace
+{
+// Longest token that fits into one packed word.
+constexpr qsizetype k_max_packed_length = 8;
+
+/**
+ * @brief Packs a lowercase ASCII word into a 64-bit value, first character in the lowest byte.
+ * @param word The word (at most eight characters).
+ * @return The packed word.
+ */
+constexpr auto pack(std::string_view word) -> quint64
+{
+    quint64 packed = 0;
+
+    for (size_t i = 0; i < word.size(); ++i)
+    {
+        packed |= static_cast<quint64>(static_cast<unsigned char>(word[i])) << (8 * i);
+    }
+
+    return packed;
+}
+
+/**
+ * @brief Packs a level token and lowercases it in one step.
+ *
+ * ORing 0x20 maps 'A'-'Z' to 'a'-'z' and keeps 'a'-'z'; every other byte ends up outside the
+ * letters the result is compared with, so no separate letter check is needed.
+ *
+ * @param token The trimmed token.
+ * @param packed Output for the packed, lowercased token.
+ * @return False if the token is empty, too long or not ASCII.
+ */
+auto pack_lowercase(QStringView token, quint64& packed) -> bool
+{
+    bool ok = !token.isEmpty() && token.size() <= k_max_packed_length;
+    packed = 0;
+
+    for (qsizetype i = 0; ok && i < token.size(); ++i)
+    {
+        const char16_t ch = token.at(i).unicode();
+        ok = ch < 0x80;
+        packed |= static_cast<quint64>(ch & 0x7F) << (8 * i);
+    }
+
+    if (ok)
+    {
+        packed |= 0x2020202020202020ULL >> (8 * (k_max_packed_length - token.size()));
+    }
+
+    return ok;
+}
+}  // namespace
+
+/**
+ * @brief Classifies a level token.
+ * @param level The level as it appears in the log.
+ * @return The log level; Info if the token is not recognized.
+ */
+auto LogLevelClassifier::classify(QStringView level) -> SimpleCppLogger::LogLevel
+{
+    const QStringView token = level.trimmed();
+    quint64 packed = 0;
+    bool known = pack_lowercase(token, packed);
+    auto result = SimpleCppLogger::LogLevel::Info;
+
+    if (known)
+    {
+        // Every result here is the one the substring rules give for the same word.
+        switch (packed)
+        {
+            case pack("trace"):
+                result = SimpleCppLogger::LogLevel::Trace;
+                break;
+            case pack("debug"):
+                result = SimpleCppLogger::LogLevel::Debug;
+                break;
+            case pack("info"):
+                result = SimpleCppLogger::LogLevel::Info;
+                break;
+            case pack("warn"):
+            case pack("warning"):
+                result = SimpleCppLogger::LogLevel::Warning;
+                break;
+            case pack("err"):
+            case pack("error"):
+            case pack("critical"):
+                result = SimpleCppLogger::LogLevel::Error;
+                break;
+            case pack("fatal"):
+                result = SimpleCppLogger::LogLevel::Fatal;
+                break;
+            default:
+                known = false;
+                break;
+        }
+    }
+
+    if (!known)
+    {
+        result = classify_by_substring(token);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Classifies a level token by substring rules only (reference for tests).
+ *        Handles various spellings, cases, and substrings (e.g. "critical", "trace_info").
+ * @param level The level as it appears in the log.
+ * @return The log level; Info if the token is not recognized.
+ */
+auto LogLevelClassifier::classify_by_substring(QStringView level) -> SimpleCppLogger::LogLevel
+{
+    const QString lvl = level.trimmed().toString().toLower();
+    auto result = SimpleCppLogger::LogLevel::Info;
+
+    if (lvl.contains(QLatin1String("fatal")))
+    {
+        result = SimpleCppLogger::LogLevel::Fatal;
+    }
+    else if (lvl.contains(QLatin1String("critical")) || lvl.contains(QLatin1String("err")))
+    {
+        // "err" also covers "error".
+        result = SimpleCppLogger::LogLevel::Error;
+    }
+    else if (lvl.contains(QLatin1String("warn")))
+    {
+        result = SimpleCppLogger::LogLevel::Warning;
+    }
+    else if (lvl.contains(QLatin1String("debug")))
+    {
+        result = SimpleCppLogger::LogLevel::Debug;
+    }
+    else if (lvl.contains(QLatin1String("trace")))
+    {
+        result = SimpleCppLogger::LogLevel::Trace;
+    }
+
+    return result;
+}
@@ -7,6 +7,18 @@
 
 #include <QBrush>
 #include <QColor>
+#include <QFont>
+#include <QStringList>
+#include <algorithm>
+
+#include "Qt-LogViewer/Models/LogLevelClassifier.h"
+
+namespace
+{
+// Row ids: file id in the upper bits, the row's key within its file in the lower 40 bits.
+constexpr int k_row_key_bits = 40;
+constexpr quint64 k_row_key_mask = (quint64(1) << k_row_key_bits) - 1;
+}  // namespace
 
 /**
  * @brief Constructs a LogModel object.
@@ -41,7 +53,8 @@ auto LogModel::rowCount(const QModelIndex& parent) const -> int
  * @brief Returns the number of columns in the model.
  *
  * This method returns the number of columns, which corresponds to the number of
- * fields in a log entry (timestamp, level, message, app name).
+ * fields in a log entry (timestamp, level, message, app name), any registered extra
+ * columns and the trailing spacer.
  *
  * @param parent The parent index (unused).
  * @return The number of columns in the model.
@@ -49,7 +62,7 @@ auto LogModel::rowCount(const QModelIndex& parent) const -> int
 auto LogModel::columnCount(const QModelIndex& parent) const -> int
 {
     Q_UNUSED(parent);
-    return ColumnCount;
+    return ColumnCount + static_cast<int>(m_extra_columns.size());
 }
 
 /**
@@ -70,8 +83,26 @@ auto LogModel::data(const QModelIndex& index, int role) const -> QVariant
         return {};
     }
 
+    if (role == RowIdRole)
+    {
+        return QVariant::fromValue(get_row_id(index.row()));
+    }
+
     const LogEntry& entry = m_entries.at(index.row());
 
+    if (role == NovelRole)
+    {
+        return entry.is_novel();
+    }
+
+    // Entries absent from the baseline stand out in every column.
+    if (role == Qt::FontRole && entry.is_novel())
+    {
+        QFont font;
+        font.setBold(true);
+        return font;
+    }
+
     if (role == Qt::ForegroundRole && index.column() == Level)
     {
         switch (map_log_level(entry.get_level()))
@@ -100,6 +131,34 @@ auto LogModel::data(const QModelIndex& index, int role) const -> QVariant
         }
     }
 
+    if (is_extra_column(index.column()))
+    {
+        QVariant extra_value;
+
+        if (role == Qt::DisplayRole || role == Qt::EditRole)
+        {
+            const int extra_index = index.column() - (AppName + 1);
+            extra_value = entry.get_extra_field(m_extra_columns.at(extra_index));
+
+            // Mixed columns are compared as text, so keep their values uniformly typed.
+            if (extra_value.isValid() && !m_extra_column_numeric.at(extra_index))
+            {
+                extra_value = extra_value.toString();
+            }
+        }
+        else if (role == Qt::TextAlignmentRole && is_extra_column_numeric(index.column()))
+        {
+            extra_value = QVariant::fromValue(Qt::Alignment(Qt::AlignRight | Qt::AlignVCenter));
+        }
+
+        return extra_value;
+    }
+
+    if (index.column() == get_spacer_column())
+    {
+        return {};
+    }
+
     if (role == Qt::DisplayRole || role == Qt::EditRole)
     {
         switch (index.column())
@@ -109,11 +168,9 @@ auto LogModel::data(const QModelIndex& index, int role) const -> QVariant
         case Level:
             return entry.get_level();
         case Message:
-            return entry.get_message();
+            return get_decoded_message(index.row());
         case AppName:
             return entry.get_app_name();
-        case Spacer:
-            return {};
         default:
             return {};
         }
@@ -126,7 +183,7 @@ auto LogModel::data(const QModelIndex& index, int role) const -> QVariant
     case LevelRole:
         return entry.get_level();
     case MessageRole:
-        return entry.get_message();
+        return get_decoded_message(index.row());
     case AppNameRole:
         return entry.get_app_name();
     default:
@@ -151,6 +208,16 @@ auto LogModel::headerData(int section, Qt::Orientation orientation, int role) co
         return {};
     }
 
+    if (is_extra_column(section))
+    {
+        return to_header_title(m_extra_columns.at(section - (AppName + 1)));
+    }
+
+    if (section == get_spacer_column())
+    {
+        return {};
+    }
+
     switch (section)
     {
     case Timestamp:
@@ -161,8 +228,6 @@ auto LogModel::headerData(int section, Qt::Orientation orientation, int role) co
         return QStringLiteral("Message");
     case AppName:
         return QStringLiteral("App Name");
-    case Spacer:
-        return {};
     default:
         return {};
     }
@@ -203,6 +268,8 @@ auto LogModel::roleNames() const -> QHash<int, QByteArray>
     roles[LevelRole] = "level";
     roles[MessageRole] = "message";
     roles[AppNameRole] = "app_name";
+    roles[RowIdRole] = "row_id";
+    roles[NovelRole] = "novel";
     return roles;
 }
 
@@ -215,8 +282,12 @@ auto LogModel::roleNames() const -> QHash<int, QByteArray>
  */
 auto LogModel::add_entry(const LogEntry& entry) -> void
 {
-    beginInsertRows(QModelIndex(), m_entries.size(), m_entries.size());
-    m_entries.append(entry);
+    register_extra_columns(QVector<LogEntry>{entry});
+
+    const int first_row = m_entries.size();
+    beginInsertRows(QModelIndex(), first_row, first_row);
+    m_entries.append(QVector<LogEntry>{entry});
+    index_rows(first_row);
     endInsertRows();
 }
 
@@ -229,6 +300,9 @@ auto LogModel::clear() -> void
 {
     beginResetModel();
     m_entries.clear();
+    rebuild_extra_columns();
+    m_file_rows.clear();
+    m_decode_cache.clear();
     endResetModel();
 }
 
@@ -251,16 +325,71 @@ auto LogModel::get_entry(int row) const -> LogEntry
     return m_entries.at(row);
 }
 
+/**
+ * @brief Returns the stored UTF-8 message of the given row without decoding it.
+ *
+ * Used by search kernels that operate on the UTF-8 bytes directly; the conversion to
+ * QString only happens in data() for cells that are actually displayed.
+ *
+ * @param row The row index.
+ * @return The UTF-8 encoded message, or an empty byte array if out of range.
+ */
+auto LogModel::get_message_utf8(int row) const -> QByteArray
+{
+    QByteArray message;
+
+    if (row >= 0 && row < m_entries.size())
+    {
+        message = m_entries.at(row).get_message_utf8();
+    }
+
+    return message;
+}
+
+/**
+ * @brief Returns the normalized log level of the given row.
+ *
+ * Used by summaries that bucket rows by level without building a display QVariant.
+ *
+ * @param row The row index.
+ * @return The mapped log level, or Info if the row is out of range.
+ */
+auto LogModel::get_log_level(int row) const -> SimpleCppLogger::LogLevel
+{
+    SimpleCppLogger::LogLevel level = SimpleCppLogger::LogLevel::Info;
+
+    if (row >= 0 && row < m_entries.size())
+    {
+        level = map_log_level(m_entries.at(row).get_level());
+    }
+
+    return level;
+}
+
 /**
  * @brief Returns all log entries.
  *
- * Provides a copy of the internal list of all LogEntry objects in the model.
+ * Provides a copy of the internal list of all LogEntry objects in the model. Callers that only
+ * iterate should prefer get_snapshot(), which does not copy.
  *
  * @return A QVector containing all log entries.
  */
 auto LogModel::get_entries() const -> QVector<LogEntry>
 {
-    return m_entries;
+    return m_entries.snapshot().to_vector();
+}
+
+/**
+ * @brief Returns an immutable snapshot of the current log entries.
+ *
+ * The snapshot is cheap to take, does not copy entries and stays valid (and unchanged) while
+ * entries are appended or removed; it may be read from any thread.
+ *
+ * @return The snapshot.
+ */
+auto LogModel::get_snapshot() const -> LogEntryStore::Snapshot
+{
+    return m_entries.snapshot();
 }
 
 /**
@@ -275,8 +404,12 @@ auto LogModel::add_entries(const QVector<LogEntry>& entries) -> void
 {
     if (!entries.isEmpty())
     {
-        beginInsertRows(QModelIndex(), m_entries.size(), m_entries.size() + entries.size() - 1);
-        m_entries += entries;
+        register_extra_columns(entries);
+
+        const int first_row = m_entries.size();
+        beginInsertRows(QModelIndex(), first_row, first_row + entries.size() - 1);
+        m_entries.append(entries);
+        index_rows(first_row);
         endInsertRows();
     }
 }
@@ -291,7 +424,11 @@ auto LogModel::add_entries(const QVector<LogEntry>& entries) -> void
 auto LogModel::set_entries(const QVector<LogEntry>& entries) -> void
 {
     beginResetModel();
-    m_entries = entries;
+    m_entries.assign(entries);
+    rebuild_extra_columns();
+    m_file_rows.clear();
+    m_decode_cache.clear();
+    index_rows(0);
     endResetModel();
 }
 
@@ -302,11 +439,13 @@ auto LogModel::set_entries(const QVector<LogEntry>& entries) -> void
 auto LogModel::remove_entries_by_file_path(const QString& file_path) -> void
 {
     beginResetModel();
-    m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(),
-                                   [&file_path](const LogEntry& entry) {
-                                       return entry.get_file_info().get_file_path() == file_path;
-                                   }),
-                    m_entries.end());
+    m_entries.remove_if([&file_path](const LogEntry& entry) {
+        return entry.get_file_info().get_file_path() == file_path;
+    });
+    rebuild_extra_columns();
+    m_file_rows.clear();
+    m_decode_cache.clear();
+    index_rows(0);
     endResetModel();
 }
 
@@ -318,36 +457,420 @@ auto LogModel::remove_entries_by_file_path(const QString& file_path) -> void
  */
 auto LogModel::map_log_level(const QString& level_str) -> SimpleCppLogger::LogLevel
 {
-    QString lvl = level_str.trimmed().toLower();
+    return LogLevelClassifier::classify(level_str);
+}
+
+/**
+ * @brief Returns the names of the registered extra columns in column order.
+ * @return List of placeholder names (e.g. "thread", "pid").
+ */
+auto LogModel::get_extra_column_names() const -> QVector<QString>
+{
+    return m_extra_columns;
+}
+
+/**
+ * @brief Returns the column index of an extra field.
+ * @param field_name The placeholder name (case-insensitive).
+ * @return The column index, or -1 if no such extra column is registered.
+ */
+auto LogModel::find_extra_column(const QString& field_name) const -> int
+{
+    int column = -1;
+    const auto it = m_extra_column_lookup.constFind(field_name.trimmed().toLower());
+
+    if (it != m_extra_column_lookup.constEnd())
+    {
+        column = AppName + 1 + it.value();
+    }
+
+    return column;
+}
+
+/**
+ * @brief Checks whether a column is a registered extra column.
+ * @param column The column index.
+ * @return True if the column holds an extra field.
+ */
+auto LogModel::is_extra_column(int column) const -> bool
+{
+    const int extra_index = column - (AppName + 1);
+    return extra_index >= 0 && extra_index < m_extra_columns.size();
+}
+
+/**
+ * @brief Checks whether an extra column holds integral values only.
+ * @param column The column index.
+ * @return True if every value seen so far in the column is an integer.
+ */
+auto LogModel::is_extra_column_numeric(int column) const -> bool
+{
+    bool numeric = false;
+
+    if (is_extra_column(column))
+    {
+        numeric = m_extra_column_numeric.at(column - (AppName + 1));
+    }
+
+    return numeric;
+}
+
+/**
+ * @brief Returns the effective index of the trailing spacer column.
+ * @return The spacer column index.
+ */
+auto LogModel::get_spacer_column() const -> int
+{
+    return Spacer + static_cast<int>(m_extra_columns.size());
+}
+
+/**
+ * @brief Returns the stable identity of a row.
+ *
+ * The id combines a per-model file id (upper 24 bits) with the entry's line offset in its file
+ * (lower 40 bits), or with its ordinal within the file if the offset is unknown. It does not
+ * change while rows are appended, filtered, sorted or paged; 0 is never an id.
+ *
+ * @param row The row index.
+ * @return The row id, or 0 if the row is out of range.
+ */
+auto LogModel::get_row_id(int row) const -> quint64
+{
+    quint64 row_id = 0;
+
+    if (row >= 0 && row < m_entries.size())
+    {
+        const quint32 file_id =
+            m_file_ids.value(m_entries.at(row).get_file_info().get_file_path(), 0);
+        const auto rows_it = m_file_rows.constFind(file_id);
+
+        if (rows_it != m_file_rows.cend())
+        {
+            const QVector<int>& file_rows = rows_it.value();
+            const auto it = std::lower_bound(file_rows.cbegin(), file_rows.cend(), row);
+
+            if (it != file_rows.cend() && *it == row)
+            {
+                row_id = (quint64(file_id) << k_row_key_bits) |
+                         get_row_key(file_rows, it - file_rows.cbegin());
+            }
+        }
+    }
+
+    return row_id;
+}
+
+/**
+ * @brief Finds the row with a given id in O(log n).
+ * @param row_id An id returned by get_row_id().
+ * @return The row index, or -1 if no row has this id (anymore).
+ */
+auto LogModel::find_row(quint64 row_id) const -> int
+{
+    int row = -1;
+    const auto rows_it = m_file_rows.constFind(static_cast<quint32>(row_id >> k_row_key_bits));
+
+    if (row_id != 0 && rows_it != m_file_rows.cend())
+    {
+        const QVector<int>& file_rows = rows_it.value();
+        const quint64 key = row_id & k_row_key_mask;
+        qsizetype low = 0;
+        qsizetype high = file_rows.size();
+
+        while (low < high)
+        {
+            const qsizetype middle = low + ((high - low) / 2);
+
+            if (get_row_key(file_rows, middle) < key)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+
+        if (low < file_rows.size() && get_row_key(file_rows, low) == key)
+        {
+            row = file_rows.at(low);
+        }
+    }
+
+    return row;
+}
+
+/**
+ * @brief Stores messages decoded ahead of time (e.g. by LogRowPrefetcher).
+ *
+ * data() serves cached messages without decoding them again. Other reads through data() decode
+ * without filling the cache, so they do not evict the prefetched rows; sorting skips the cache
+ * lookup altogether and reads the stored messages (see get_message_utf8()).
+ *
+ * @param row_ids The row ids (see get_row_id()).
+ * @param messages The decoded messages, one per row id.
+ */
+auto LogModel::add_decoded_messages(const QVector<quint64>& row_ids,
+                                    const QVector<QString>& messages) -> void
+{
+    const qsizetype count = qMin(row_ids.size(), messages.size());
+
+    for (qsizetype i = 0; i < count; ++i)
+    {
+        m_decode_cache.insert(row_ids.at(i), messages.at(i));
+    }
+}
+
+/**
+ * @brief Checks whether a row's message is in the decode cache.
+ * @param row_id The row id.
+ * @return True if cached.
+ */
+auto LogModel::is_message_decoded(quint64 row_id) const -> bool
+{
+    return m_decode_cache.contains(row_id);
+}
+
+/**
+ * @brief Sets the byte budget of the decode cache.
+ * @param budget_bytes The budget in bytes.
+ */
+auto LogModel::set_decode_budget_bytes(qsizetype budget_bytes) -> void
+{
+    m_decode_cache.set_budget_bytes(budget_bytes);
+}
+
+/**
+ * @brief Returns the decode cache.
+ * @return The cache (read-only).
+ */
+auto LogModel::get_decode_cache() const -> const LogDecodeCache&
+{
+    return m_decode_cache;
+}
+
+/**
+ * @brief Returns the decoded message of a row, from the decode cache if possible.
+ * @param row The row index (must be valid).
+ * @return The message.
+ */
+auto LogModel::get_decoded_message(int row) const -> QString
+{
+    QString message;
+    // Skip the row id lookup while nothing was prefetched.
+    const QString* cached =
+        (m_decode_cache.get_count() > 0) ? m_decode_cache.find(get_row_id(row)) : nullptr;
+
+    if (cached != nullptr)
+    {
+        message = *cached;
+    }
+    else
+    {
+        message = m_entries.at(row).get_message();
+    }
+
+    return message;
+}
+
+/**
+ * @brief Registers extra columns found in the given entries, emitting column inserts.
+ *
+ * New fields are appended after the existing extra columns (before the spacer) in the
+ * order they are first seen. A column stays numeric as long as every value is an integer;
+ * if a text value shows up later the column is demoted and its cells are refreshed.
+ *
+ * @param entries The entries about to be appended.
+ */
+auto LogModel::register_extra_columns(const QVector<LogEntry>& entries) -> void
+{
+    QVector<QString> new_columns;
+    QVector<bool> new_numeric;
+    QVector<int> demoted_columns;
 
-    if (lvl.contains("fatal"))
+    for (const auto& entry: entries)
     {
-        return SimpleCppLogger::LogLevel::Fatal;
+        const auto extra_fields = entry.get_extra_fields();
+
+        for (const auto& field: extra_fields)
+        {
+            const QString key = field.first.toLower();
+            const bool is_number = (field.second.typeId() == QMetaType::LongLong);
+            const auto it = m_extra_column_lookup.constFind(key);
+
+            if (it != m_extra_column_lookup.constEnd())
+            {
+                const int extra_index = it.value();
+
+                if (extra_index < m_extra_column_numeric.size())
+                {
+                    if (!is_number && m_extra_column_numeric.at(extra_index))
+                    {
+                        m_extra_column_numeric[extra_index] = false;
+                        demoted_columns.append(AppName + 1 + extra_index);
+                    }
+                }
+                else
+                {
+                    const int pending_index =
+                        extra_index - static_cast<int>(m_extra_column_numeric.size());
+                    new_numeric[pending_index] = new_numeric.at(pending_index) && is_number;
+                }
+            }
+            else
+            {
+                m_extra_column_lookup.insert(
+                    key, static_cast<int>(m_extra_columns.size() + new_columns.size()));
+                new_columns.append(field.first);
+                new_numeric.append(is_number);
+            }
+        }
     }
-    if (lvl.contains("critical"))
+
+    if (!new_columns.isEmpty())
     {
-        return SimpleCppLogger::LogLevel::Error;
+        const int first = get_spacer_column();
+        const int last = first + static_cast<int>(new_columns.size()) - 1;
+
+        beginInsertColumns(QModelIndex(), first, last);
+        m_extra_columns += new_columns;
+        m_extra_column_numeric += new_numeric;
+        endInsertColumns();
     }
-    if (lvl.contains("error") || lvl.contains("err"))
+
+    if (!m_entries.is_empty())
     {
-        return SimpleCppLogger::LogLevel::Error;
+        for (const int column: demoted_columns)
+        {
+            emit dataChanged(index(0, column), index(m_entries.size() - 1, column));
+        }
     }
-    if (lvl.contains("warn"))
+}
+
+/**
+ * @brief Rebuilds the extra column registry from the current entries.
+ *
+ * Must only be called between beginResetModel() and endResetModel().
+ */
+auto LogModel::rebuild_extra_columns() -> void
+{
+    m_extra_columns.clear();
+    m_extra_column_numeric.clear();
+    m_extra_column_lookup.clear();
+
+    const LogEntryStore::Snapshot snapshot = m_entries.snapshot();
+
+    for (const auto& entry: snapshot)
     {
-        return SimpleCppLogger::LogLevel::Warning;
+        const auto extra_fields = entry.get_extra_fields();
+
+        for (const auto& field: extra_fields)
+        {
+            const QString key = field.first.toLower();
+            const bool is_number = (field.second.typeId() == QMetaType::LongLong);
+            const auto it = m_extra_column_lookup.constFind(key);
+
+            if (it != m_extra_column_lookup.constEnd())
+            {
+                m_extra_column_numeric[it.value()] =
+                    m_extra_column_numeric.at(it.value()) && is_number;
+            }
+            else
+            {
+                m_extra_column_lookup.insert(key, static_cast<int>(m_extra_columns.size()));
+                m_extra_columns.append(field.first);
+                m_extra_column_numeric.append(is_number);
+            }
+        }
     }
-    if (lvl.contains("debug"))
+}
+
+/**
+ * @brief Builds a header title from a placeholder name (e.g. "thread_id" -> "Thread Id").
+ * @param field_name The placeholder name.
+ * @return The header title.
+ */
+auto LogModel::to_header_title(const QString& field_name) -> QString
+{
+    QStringList words = field_name.split(QLatin1Char('_'), Qt::SkipEmptyParts);
+
+    for (auto& word: words)
     {
-        return SimpleCppLogger::LogLevel::Debug;
+        word[0] = word.at(0).toUpper();
     }
-    if (lvl.contains("trace"))
+
+    return words.join(QLatin1Char(' '));
+}
+
+/**
+ * @brief Adds rows to the per-file row index behind get_row_id() and find_row().
+ * @param first_row The first row to index; all rows after it are indexed as well.
+ */
+auto LogModel::index_rows(int first_row) -> void
+{
+    QString file_path;
+    QVector<int>* file_rows = nullptr;
+
+    for (int row = first_row; row < m_entries.size(); ++row)
     {
-        return SimpleCppLogger::LogLevel::Trace;
+        const QString row_file_path = m_entries.at(row).get_file_info().get_file_path();
+
+        // Batches come from one file; look the file up only when it changes.
+        if (file_rows == nullptr || row_file_path != file_path)
+        {
+            auto id_it = m_file_ids.constFind(row_file_path);
+
+            if (id_it == m_file_ids.cend())
+            {
+                id_it = m_file_ids.insert(row_file_path,
+                                          static_cast<quint32>(m_file_ids.size() + 1));
+            }
+
+            file_path = row_file_path;
+            file_rows = &m_file_rows[id_it.value()];
+        }
+
+        file_rows->append(row);
     }
-    if (lvl.contains("info"))
+}
+
+/**
+ * @brief Returns the key of a row within its file: its line offset, or its ordinal.
+ * @param file_rows The rows of the file in model order.
+ * @param position The position of the row in file_rows.
+ * @return The key (lower 40 bits of the row id).
+ */
+auto LogModel::get_row_key(const QVector<int>& file_rows, qsizetype position) const -> quint64
+{
+    const qint64 offset = m_entries.at(file_rows.at(position)).get_line_offset();
+    const quint64 key = (offset >= 0) ? static_cast<quint64>(offset)
+                                      : static_cast<quint64>(position);
+    return key & k_row_key_mask;
+}
+
+/**
+ * @brief Sets the rows' novelty tags without resetting the model.
+ * @param tags One bit per row, starting at row 0; bits past rowCount() are ignored.
+ */
+auto LogModel::set_novel_tags(const QBitArray& tags) -> void
+{
+    const int count = qMin(m_entries.size(), static_cast<int>(tags.size()));
+    int first_changed = -1;
+    int last_changed = -1;
+
+    for (int row = 0; row < count; ++row)
     {
-        return SimpleCppLogger::LogLevel::Info;
+        if (m_entries.at(row).is_novel() != tags.testBit(row))
+        {
+            first_changed = (first_changed < 0) ? row : first_changed;
+            last_changed = row;
+        }
     }
 
-    return SimpleCppLogger::LogLevel::Info;
+    if (first_changed >= 0)
+    {
+        m_entries.set_novel_tags(tags);
+        emit dataChanged(index(first_changed, 0), index(last_changed, columnCount() - 1),
+                         {NovelRole, Qt::FontRole});
+    }
 }
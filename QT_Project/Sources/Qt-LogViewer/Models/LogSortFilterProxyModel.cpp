@@ -6,21 +6,309 @@
 #include "Qt-LogViewer/Models/LogSortFilterProxyModel.h"
 
 #include <QAbstractProxyModel>
+#include <QAnyStringView>
 #include <QCollator>
+#include <QDateTime>
+#include <QThreadPool>
+#include <QTimer>
+#include <QUtf8StringView>
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <utility>
 
 #include "Qt-LogViewer/Models/LogEntry.h"
+#include "Qt-LogViewer/Models/LogEntryStore.h"
 #include "Qt-LogViewer/Models/LogModel.h"
+#include "Qt-LogViewer/Services/TaskRegistry.h"
+
+namespace
+{
+// Views with fewer source rows are filtered and sorted inline; the pass is shorter than a frame.
+constexpr int k_default_async_row_threshold = 100000;
+
+/**
+ * @struct SortKey
+ * @brief The value of one row in the sorted column, prepared for repeated comparisons.
+ */
+struct SortKey {
+        QDateTime time;
+        qint64 number = 0;
+        bool is_number = false;
+        std::optional<QCollatorSortKey> text;
+        QByteArray message_utf8;
+        bool is_message = false;
+};
+
+/**
+ * @brief Compares two stored messages without decoding them.
+ *
+ * Messages order case-insensitively by code point rather than by the locale's collation: a sort
+ * compares every message many times, and decoding each pair would dominate it.
+ *
+ * @param left The left UTF-8 message.
+ * @param right The right UTF-8 message.
+ * @return Negative, zero or positive like QAnyStringView::compare().
+ */
+auto compare_messages(const QByteArray& left, const QByteArray& right) -> int
+{
+    return QAnyStringView::compare(QUtf8StringView(left), QUtf8StringView(right),
+                                   Qt::CaseInsensitive);
+}
+
+/**
+ * @brief Returns an entry's display value in a column, as LogModel::data() does.
+ *
+ * The Message column is compared on the stored bytes instead (see compare_messages()).
+ *
+ * @param entry The entry.
+ * @param column The source column.
+ * @param extra_field The extra field shown in the column, or empty for the main columns.
+ * @param extra_numeric True if the extra column holds integers only.
+ * @return The value.
+ */
+auto get_sort_value(const LogEntry& entry, int column, const QString& extra_field,
+                    bool extra_numeric) -> QVariant
+{
+    QVariant value;
+
+    if (!extra_field.isEmpty())
+    {
+        value = entry.get_extra_field(extra_field);
+
+        if (value.isValid() && !extra_numeric)
+        {
+            value = value.toString();
+        }
+    }
+    else if (column == LogModel::Timestamp)
+    {
+        value = entry.get_timestamp();
+    }
+    else if (column == LogModel::Level)
+    {
+        value = entry.get_level();
+    }
+    else if (column == LogModel::AppName)
+    {
+        value = entry.get_app_name();
+    }
+
+    return value;
+}
+
+/**
+ * @brief Compares two sort keys the way LogSortFilterProxyModel::lessThan() compares values.
+ * @param left The left key.
+ * @param right The right key.
+ * @return True if the left key sorts before the right one.
+ */
+auto is_key_less(const SortKey& left, const SortKey& right) -> bool
+{
+    bool is_less = false;
+
+    if (left.is_message && right.is_message)
+    {
+        is_less = compare_messages(left.message_utf8, right.message_utf8) < 0;
+    }
+    else if (left.time.isValid() && right.time.isValid())
+    {
+        is_less = left.time < right.time;
+    }
+    else if (left.is_number && right.is_number)
+    {
+        is_less = left.number < right.number;
+    }
+    else
+    {
+        is_less = left.text->compare(*right.text) < 0;
+    }
+
+    return is_less;
+}
+
+/**
+ * @brief Ranks the rows of a snapshot by a column; equal values get equal ranks.
+ * @param snapshot The rows.
+ * @param column The source column.
+ * @param extra_field The extra field shown in the column, or empty for the main columns.
+ * @param extra_numeric True if the extra column holds integers only.
+ * @param locale The locale of the proxy's collator.
+ * @param token Cancels the pass; reports its progress.
+ * @return One rank per row, or an empty vector if cancelled.
+ */
+auto rank_rows(const LogEntryStore::Snapshot& snapshot, int column, const QString& extra_field,
+               bool extra_numeric, const QLocale& locale, const TaskToken& token) -> QVector<int>
+{
+    QVector<int> ranks;
+    QCollator collator(locale);
+    collator.setCaseSensitivity(Qt::CaseInsensitive);
+
+    const int rows = snapshot.size();
+    const bool is_message = extra_field.isEmpty() && column == LogModel::Message;
+    QVector<SortKey> keys(rows);
+
+    for (int row = 0; row < rows && !token.is_cancelled(); ++row)
+    {
+        SortKey& key = keys[row];
+
+        if (is_message)
+        {
+            key.message_utf8 = snapshot.at(row).get_message_utf8();
+            key.is_message = true;
+        }
+        else
+        {
+            const QVariant value =
+                get_sort_value(snapshot.at(row), column, extra_field, extra_numeric);
+
+            if (column == LogModel::Timestamp)
+            {
+                key.time = value.toDateTime();
+            }
+            key.is_number = value.typeId() == QMetaType::LongLong;
+            key.number = key.is_number ? value.toLongLong() : 0;
+            key.text = collator.sortKey(value.toString());
+        }
+        token.set_progress(row + 1, rows);
+    }
+
+    if (!token.is_cancelled())
+    {
+        QVector<int> order(rows);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&keys](int left, int right) {
+            return is_key_less(keys.at(left), keys.at(right));
+        });
+
+        ranks.resize(rows);
+        int rank = 0;
+        for (int index = 0; index < rows; ++index)
+        {
+            if (index > 0 && is_key_less(keys.at(order.at(index - 1)), keys.at(order.at(index))))
+            {
+                ++rank;
+            }
+            ranks[order.at(index)] = rank;
+        }
+    }
+
+    return ranks;
+}
+}  // namespace
 
 /**
  * @brief Constructs a LogSortFilterProxyModel object.
  * @param parent The parent QObject.
  */
-LogSortFilterProxyModel::LogSortFilterProxyModel(QObject* parent): QSortFilterProxyModel(parent)
+LogSortFilterProxyModel::LogSortFilterProxyModel(QObject* parent)
+    : QSortFilterProxyModel(parent),
+      m_counts_timer(new QTimer(this)),
+      m_pool(new QThreadPool(this)),
+      m_async_row_threshold(k_default_async_row_threshold)
 {
     setSortRole(Qt::DisplayRole);
     setDynamicSortFilter(true);
 
     m_collator.setCaseSensitivity(Qt::CaseInsensitive);
+
+    // Streaming appends many batches per event loop pass; report their counts once.
+    m_counts_timer->setSingleShot(true);
+    m_counts_timer->setInterval(0);
+    connect(m_counts_timer, &QTimer::timeout, this,
+            &LogSortFilterProxyModel::match_counts_changed);
+
+    m_pool->setMaxThreadCount(1);
+}
+
+/**
+ * @brief Cancels running filter and sort passes and waits for them.
+ *
+ * The passes post back to this object, so they may not outlive it. The registry is not called:
+ * it may already be gone. It ends the tasks once their tokens are released.
+ */
+LogSortFilterProxyModel::~LogSortFilterProxyModel()
+{
+    m_filter_token.cancel();
+    m_sort_token.cancel();
+    m_pool->clear();
+    m_pool->waitForDone();
+}
+
+/**
+ * @brief Sets the registry the filter and sort passes are reported to.
+ * @param registry The task registry (may be nullptr).
+ * @param owner The owner the tasks are registered for (the view id).
+ */
+auto LogSortFilterProxyModel::set_task_registry(TaskRegistry* registry, const QUuid& owner)
+    -> void
+{
+    m_registry = registry;
+    m_owner = owner;
+}
+
+/**
+ * @brief Sets the source row count from which filtering and sorting run on a worker.
+ * @param rows The row threshold.
+ */
+auto LogSortFilterProxyModel::set_async_row_threshold(int rows) -> void
+{
+    m_async_row_threshold = rows;
+}
+
+/**
+ * @brief Returns the source row count from which filtering and sorting run on a worker.
+ * @return The row threshold.
+ */
+auto LogSortFilterProxyModel::get_async_row_threshold() const noexcept -> int
+{
+    return m_async_row_threshold;
+}
+
+/**
+ * @brief Checks whether a filter pass is running on the worker.
+ * @return True if the current filter is not applied yet.
+ */
+auto LogSortFilterProxyModel::is_filter_pending() const noexcept -> bool
+{
+    return m_filter_pending;
+}
+
+/**
+ * @brief Checks whether a sort pass is running on the worker.
+ * @return True if the requested sort is not applied yet.
+ */
+auto LogSortFilterProxyModel::is_sort_pending() const noexcept -> bool
+{
+    return m_sort_pending;
+}
+
+/**
+ * @brief Sorts by a column, ranking the rows on the worker for large views.
+ *
+ * Ranks already computed for the column (e.g. when only the order flips) are reused. Smaller
+ * views, the source order and the spacer column are sorted right away.
+ *
+ * @param column The source column, or -1 for the source order.
+ * @param order The sort order.
+ */
+void LogSortFilterProxyModel::sort(int column, Qt::SortOrder order)
+{
+    const auto* log_model = qobject_cast<const LogModel*>(sourceModel());
+    const bool rank_on_worker = log_model != nullptr && column >= 0 &&
+                                column < log_model->get_spacer_column() &&
+                                column != m_sort_rank_column &&
+                                log_model->rowCount() >= m_async_row_threshold;
+
+    if (rank_on_worker)
+    {
+        start_sort_task(column, order);
+    }
+    else
+    {
+        cancel_sort_task();
+        QSortFilterProxyModel::sort(column, order);
+    }
 }
 
 /**
@@ -33,7 +321,7 @@ auto LogSortFilterProxyModel::set_app_name_filter(const QString& app_name) -> vo
     {
         m_app_name_filter = app_name;
         recalc_active_filters();
-        invalidateFilter();
+        refilter();
     }
 }
 
@@ -53,7 +341,7 @@ auto LogSortFilterProxyModel::set_log_level_filters(const QSet<QString>& levels)
     {
         m_log_level_filters = normalized_filters;
         recalc_active_filters();
-        invalidateFilter();
+        refilter();
     }
 }
 
@@ -86,7 +374,7 @@ auto LogSortFilterProxyModel::set_search_filter(const QString& search_text, cons
         }
 
         recalc_active_filters();
-        invalidateFilter();
+        refilter();
 
         // Force repaint of all cells for updated highlight ranges.
         // Emit dataChanged for HighlightRangesRole across the entire proxy range.
@@ -112,7 +400,7 @@ auto LogSortFilterProxyModel::set_show_only_file_path(const QString& file_path)
     {
         m_show_only_file_path = normalized;
         recalc_active_filters();
-        invalidateFilter();
+        refilter();
         emit show_only_changed(file_path);
     }
 }
@@ -129,7 +417,7 @@ auto LogSortFilterProxyModel::hide_file(const QString& file_path) -> void
         {
             m_hidden_file_paths.insert(file_path);
             recalc_active_filters();
-            invalidateFilter();
+            refilter();
             emit file_visibility_changed(file_path);
         }
     }
@@ -145,7 +433,7 @@ auto LogSortFilterProxyModel::unhide_file(const QString& file_path) -> void
     {
         m_hidden_file_paths.remove(file_path);
         recalc_active_filters();
-        invalidateFilter();
+        refilter();
         emit file_visibility_changed(file_path);
     }
 }
@@ -166,7 +454,7 @@ auto LogSortFilterProxyModel::set_hidden_file_paths(const QSet<QString>& file_pa
     {
         m_hidden_file_paths = file_paths;
         recalc_active_filters();
-        invalidateFilter();
+        refilter();
         emit file_visibility_changed(QString());
     }
 }
@@ -180,11 +468,63 @@ auto LogSortFilterProxyModel::clear_hidden_files() -> void
     {
         m_hidden_file_paths.clear();
         recalc_active_filters();
-        invalidateFilter();
+        refilter();
         emit file_visibility_changed(QString());
     }
 }
 
+/**
+ * @brief Sets the baseline the source entries are tagged with.
+ *
+ * The rows only need filtering again if the novelty filter is set.
+ *
+ * @param baseline The baseline, or nullptr.
+ */
+auto LogSortFilterProxyModel::set_baseline(std::shared_ptr<const LogBaseline> baseline) -> void
+{
+    if (m_baseline != baseline)
+    {
+        m_baseline = std::move(baseline);
+        recalc_active_filters();
+
+        if (m_novel_only_filter)
+        {
+            refilter();
+        }
+    }
+}
+
+/**
+ * @brief Shows only entries absent from the baseline.
+ * @param novel_only True to hide entries found in the baseline.
+ */
+auto LogSortFilterProxyModel::set_novel_only_filter(bool novel_only) -> void
+{
+    if (m_novel_only_filter != novel_only)
+    {
+        m_novel_only_filter = novel_only;
+        recalc_active_filters();
+        refilter();
+    }
+}
+
+/**
+ * @brief Sets whether the view drops duplicates across files (see LogDedupeSet).
+ *
+ * The rows do not change; the setting goes along in the filter spec, so the parser threads
+ * compute the entries' dedupe keys only for views that use them.
+ *
+ * @param enabled True if the view drops duplicates.
+ */
+auto LogSortFilterProxyModel::set_dedupe_enabled(bool enabled) -> void
+{
+    if (m_dedupe_enabled != enabled)
+    {
+        m_dedupe_enabled = enabled;
+        recalc_active_filters();
+    }
+}
+
 /**
  * @brief Returns the current application name filter.
  * @return The application name filter string.
@@ -274,6 +614,33 @@ auto LogSortFilterProxyModel::get_hidden_file_paths() const noexcept -> QSet<QSt
     return value;
 }
 
+/**
+ * @brief Returns the baseline the source entries are tagged with.
+ * @return The baseline, or nullptr.
+ */
+auto LogSortFilterProxyModel::get_baseline() const -> std::shared_ptr<const LogBaseline>
+{
+    return m_baseline;
+}
+
+/**
+ * @brief Returns whether only entries absent from the baseline are shown.
+ * @return True if the novelty filter is set (even while there is no baseline).
+ */
+auto LogSortFilterProxyModel::is_novel_only_filter() const noexcept -> bool
+{
+    return m_novel_only_filter;
+}
+
+/**
+ * @brief Returns whether the view drops duplicates across files.
+ * @return True if dedupe is enabled.
+ */
+auto LogSortFilterProxyModel::is_dedupe_enabled() const noexcept -> bool
+{
+    return m_dedupe_enabled;
+}
+
 /**
  * @brief Returns the current sort column.
  * @return Column index, or -1 if unsorted.
@@ -294,6 +661,159 @@ auto LogSortFilterProxyModel::get_sort_order() const noexcept -> Qt::SortOrder
     return order;
 }
 
+/**
+ * @brief Returns the current filter settings, e.g. to evaluate them on parser threads.
+ * @return The filter spec.
+ */
+auto LogSortFilterProxyModel::get_filter_spec() const -> LogFilter::Spec
+{
+    return m_filter.get_spec();
+}
+
+/**
+ * @brief Supplies precomputed verdicts for rows about to be appended to the source model.
+ *
+ * The verdicts are used by filterAcceptsRow() for the rows [first_row, first_row + size) until
+ * clear_batch_verdicts() is called, and the batch's facet counts are added once the rows are
+ * inserted. Verdicts computed for other filter settings are ignored.
+ *
+ * @param first_row The source row of the first entry of the batch.
+ * @param verdicts The verdicts of the batch.
+ * @return True if the verdicts are used.
+ */
+auto LogSortFilterProxyModel::set_batch_verdicts(int first_row,
+                                                 const LogFilter::BatchVerdicts& verdicts) -> bool
+{
+    const bool usable = !verdicts.accepted.isEmpty() && verdicts.spec == m_filter.get_spec();
+
+    if (usable)
+    {
+        m_batch_first_row = first_row;
+        m_batch_verdicts = verdicts;
+    }
+    else
+    {
+        clear_batch_verdicts();
+    }
+
+    return usable;
+}
+
+/**
+ * @brief Drops the verdicts supplied by set_batch_verdicts().
+ */
+auto LogSortFilterProxyModel::clear_batch_verdicts() -> void
+{
+    m_batch_first_row = -1;
+    m_batch_verdicts = LogFilter::BatchVerdicts();
+}
+
+/**
+ * @brief Checks whether the rows are filtered by a search.
+ * @return True if a search text is set; every row passing the filter then matches it.
+ */
+auto LogSortFilterProxyModel::is_search_active() const -> bool
+{
+    return !m_filter.get_spec().search_text.isEmpty();
+}
+
+/**
+ * @brief Returns the entry counts per level, app and file over the rows passing the filter.
+ * @return The facet counts.
+ */
+auto LogSortFilterProxyModel::get_match_counts() const -> LogFacetCounts
+{
+    return m_match_counts;
+}
+
+/**
+ * @brief Returns the entry counts per level, app and file over all rows.
+ * @return The facet counts.
+ */
+auto LogSortFilterProxyModel::get_total_counts() const -> LogFacetCounts
+{
+    return m_total_counts;
+}
+
+/**
+ * @brief Sets the source model and tracks its row changes for the facet counts.
+ *
+ * The handlers are connected after the base class's, so inserted rows are already filtered and
+ * rows about to be removed are still mapped when they run. Sort ranks of changed values are
+ * dropped before the base class sorts them again.
+ *
+ * @param source_model The source model (a LogModel).
+ */
+void LogSortFilterProxyModel::setSourceModel(QAbstractItemModel* source_model)
+{
+    for (const auto& connection: m_source_connections)
+    {
+        disconnect(connection);
+    }
+    m_source_connections.clear();
+    cancel_filter_task();
+    cancel_sort_task();
+    clear_sort_ranks();
+
+    // Changed values are sorted again by the base class; their ranks must be gone by then, and
+    // the rows' verdicts are recorded before it filters them again.
+    if (source_model != nullptr)
+    {
+        m_source_connections.append(connect(
+            source_model, &QAbstractItemModel::dataChanged, this,
+            [this](const QModelIndex& top_left, const QModelIndex& bottom_right) {
+                if (m_sort_rank_column >= top_left.column() &&
+                    m_sort_rank_column <= bottom_right.column())
+                {
+                    clear_sort_ranks();
+                }
+                record_changed_rows(top_left.row(), bottom_right.row());
+            }));
+    }
+
+    QSortFilterProxyModel::setSourceModel(source_model);
+    recount();
+
+    if (source_model != nullptr)
+    {
+        m_source_connections.append(connect(source_model, &QAbstractItemModel::modelReset, this,
+                                            [this]() {
+                                                clear_sort_ranks();
+                                                recount();
+                                                schedule_counts_changed();
+                                            }));
+        m_source_connections.append(connect(
+            source_model, &QAbstractItemModel::rowsInserted, this,
+            [this](const QModelIndex& /*parent*/, int first, int last) {
+                count_inserted_rows(first, last);
+                schedule_counts_changed();
+            }));
+        m_source_connections.append(connect(
+            source_model, &QAbstractItemModel::rowsAboutToBeRemoved, this,
+            [this](const QModelIndex& /*parent*/, int first, int last) {
+                clear_sort_ranks();
+                uncount_removed_rows(first, last);
+            }));
+        m_source_connections.append(connect(source_model, &QAbstractItemModel::rowsRemoved,
+                                            this,
+                                            &LogSortFilterProxyModel::schedule_counts_changed));
+
+        // Inserted extra columns shift the columns after them.
+        m_source_connections.append(connect(source_model, &QAbstractItemModel::columnsInserted,
+                                            this, &LogSortFilterProxyModel::clear_sort_ranks));
+
+        // Changed rows are filtered again (e.g. retagged against a baseline).
+        m_source_connections.append(connect(
+            source_model, &QAbstractItemModel::dataChanged, this,
+            [this](const QModelIndex& top_left, const QModelIndex& bottom_right) {
+                if (count_changed_rows(top_left.row(), bottom_right.row()))
+                {
+                    schedule_counts_changed();
+                }
+            }));
+    }
+}
+
 /**
  * @brief Intercept data() calls to provide highlight ranges via the custom role.
  *
@@ -325,7 +845,8 @@ auto LogSortFilterProxyModel::data(const QModelIndex& index, int role) const ->
                 ((m_search_field.compare("Level", Qt::CaseInsensitive) == 0) &&
                  (source_column == LogModel::Level)) ||
                 ((m_search_field.compare("AppName", Qt::CaseInsensitive) == 0) &&
-                 (source_column == LogModel::AppName));
+                 (source_column == LogModel::AppName)) ||
+                is_searched_extra_column(source_column);
 
             if (should_check)
             {
@@ -400,7 +921,30 @@ auto LogSortFilterProxyModel::data(const QModelIndex& index, int role) const ->
 auto LogSortFilterProxyModel::filterAcceptsRow(int source_row,
                                                const QModelIndex& source_parent) const -> bool
 {
-    bool accepted = row_passes_filter(source_row, source_parent);
+    Q_UNUSED(source_parent);
+    bool accepted = true;
+    const auto* log_model = qobject_cast<const LogModel*>(sourceModel());
+    const qsizetype batch_index = source_row - m_batch_first_row;
+    const bool in_batch = m_batch_first_row >= 0 && batch_index >= 0 &&
+                          batch_index < m_batch_verdicts.accepted.size();
+
+    if (in_batch && !m_batch_verdicts.undecided.testBit(batch_index))
+    {
+        accepted = m_batch_verdicts.accepted.testBit(batch_index);
+    }
+    else if (m_filter.is_active() && log_model != nullptr && source_row >= 0 &&
+             source_row < log_model->rowCount())
+    {
+        const LogEntry entry = log_model->get_entry(source_row);
+        accepted = m_filter.evaluate(entry, log_model) == LogFilter::Verdict::Accepted;
+
+        // Rows decided by batch verdicts are counted with the batch's accepted_counts.
+        if (accepted && m_counting_matches)
+        {
+            m_match_counts.add_entry(entry);
+        }
+    }
+
     return accepted;
 }
 
@@ -414,10 +958,29 @@ auto LogSortFilterProxyModel::lessThan(const QModelIndex& source_left,
                                        const QModelIndex& source_right) const -> bool
 {
     bool is_less = false;
+    const auto* log_model = qobject_cast<const LogModel*>(sourceModel());
     const bool both_timestamp_columns = (source_left.column() == LogModel::Timestamp) &&
                                         (source_right.column() == LogModel::Timestamp);
+    const bool both_message_columns = log_model != nullptr &&
+                                      (source_left.column() == LogModel::Message) &&
+                                      (source_right.column() == LogModel::Message);
+    const bool both_ranked = source_left.column() == m_sort_rank_column &&
+                             source_right.column() == m_sort_rank_column &&
+                             source_left.row() < m_sort_ranks.size() &&
+                             source_right.row() < m_sort_ranks.size();
 
-    if (both_timestamp_columns)
+    if (both_ranked)
+    {
+        is_less = m_sort_ranks.at(source_left.row()) < m_sort_ranks.at(source_right.row());
+    }
+    else if (both_message_columns)
+    {
+        // Compare the stored bytes: data() would look each row up in the decode cache, which
+        // costs more than decoding and rarely hits for rows outside the viewport.
+        is_less = compare_messages(log_model->get_message_utf8(source_left.row()),
+                                   log_model->get_message_utf8(source_right.row())) < 0;
+    }
+    else if (both_timestamp_columns)
     {
         const QVariant left_value_variant = sourceModel()->data(source_left, Qt::DisplayRole);
         const QVariant right_value_variant = sourceModel()->data(source_right, Qt::DisplayRole);
@@ -441,195 +1004,516 @@ auto LogSortFilterProxyModel::lessThan(const QModelIndex& source_left,
     }
     else
     {
-        const QString left_string = sourceModel()->data(source_left, Qt::DisplayRole).toString();
-        const QString right_string = sourceModel()->data(source_right, Qt::DisplayRole).toString();
+        const QVariant left_value = sourceModel()->data(source_left, Qt::DisplayRole);
+        const QVariant right_value = sourceModel()->data(source_right, Qt::DisplayRole);
+        const bool both_numeric = (left_value.typeId() == QMetaType::LongLong) &&
+                                  (right_value.typeId() == QMetaType::LongLong);
 
-        is_less = (m_collator.compare(left_string, right_string) < 0);
+        if (both_numeric)
+        {
+            is_less = (left_value.toLongLong() < right_value.toLongLong());
+        }
+        else
+        {
+            is_less = (m_collator.compare(left_value.toString(), right_value.toString()) < 0);
+        }
     }
 
     return is_less;
 }
 
 /**
- * @brief Checks if a specific row passes the current filters, including file filters.
+ * @brief Filters all rows again and recounts the rows passing the filter.
+ *
+ * Large views with a filter set are filtered on the worker (see start_filter_task()).
  */
-auto LogSortFilterProxyModel::row_passes_filter(int row, const QModelIndex& parent) const -> bool
+auto LogSortFilterProxyModel::refilter() -> void
 {
-    bool accepted = true;
-
-    // Per-file filter (needs file path from the source model entry)
-    QString file_path;
     const auto* log_model = qobject_cast<const LogModel*>(sourceModel());
-    if (log_model != nullptr)
+    const bool filter_on_worker = m_filter.is_active() && log_model != nullptr &&
+                                  log_model->rowCount() >= m_async_row_threshold;
+
+    if (filter_on_worker)
     {
-        if (row >= 0 && row < log_model->rowCount())
+        start_filter_task();
+    }
+    else
+    {
+        cancel_filter_task();
+        filter_and_count(LogFacetCounts());
+        schedule_counts_changed();
+    }
+}
+
+/**
+ * @brief Evaluates the current filter over a snapshot of the source rows on the worker.
+ *
+ * The rows keep their current mapping until the verdicts are applied; rows appended meanwhile
+ * are filtered as they arrive. A running filter pass is cancelled.
+ */
+auto LogSortFilterProxyModel::start_filter_task() -> void
+{
+    cancel_filter_task();
+
+    const auto* log_model = qobject_cast<const LogModel*>(sourceModel());
+    const LogEntryStore::Snapshot snapshot = log_model->get_snapshot();
+    const LogFilter::Spec spec = m_filter.get_spec();
+    const quint64 generation = m_filter_generation;
+    m_filter_token = begin_task(QStringLiteral("Filtering view"));
+    m_filter_pending = true;
+    const TaskToken token = m_filter_token;
+
+    m_pool->start([this, snapshot, spec, token, generation]() {
+        const LogFilter filter(spec);
+        const int rows = snapshot.size();
+        LogFilter::BatchVerdicts verdicts;
+        verdicts.spec = spec;
+        verdicts.accepted.resize(rows);
+        verdicts.undecided.resize(rows);
+
+        for (int row = 0; row < rows && !token.is_cancelled(); ++row)
         {
-            const LogEntry entry = log_model->get_entry(row);
-            file_path = entry.get_file_info().get_file_path();
+            const LogEntry& entry = snapshot.at(row);
+            const LogFilter::Verdict verdict = filter.evaluate(entry);
+            verdicts.accepted.setBit(row, verdict == LogFilter::Verdict::Accepted);
+            verdicts.undecided.setBit(row, verdict == LogFilter::Verdict::Undecided);
+
+            if (verdict == LogFilter::Verdict::Accepted)
+            {
+                verdicts.accepted_counts.add_entry(entry);
+            }
+            token.set_progress(row + 1, rows);
+        }
+
+        if (!token.is_cancelled())
+        {
+            const quint64 epoch = snapshot.get_epoch();
+            QMetaObject::invokeMethod(
+                this,
+                [this, generation, epoch, verdicts]() {
+                    apply_filter_verdicts(generation, epoch, verdicts);
+                },
+                Qt::QueuedConnection);
         }
+    });
+}
+
+/**
+ * @brief Cancels a running filter pass and drops its result.
+ */
+auto LogSortFilterProxyModel::cancel_filter_task() -> void
+{
+    if (m_filter_pending)
+    {
+        m_filter_token.cancel();
+        end_task(m_filter_token);
+        m_filter_token = TaskToken();
+        m_filter_pending = false;
     }
+    ++m_filter_generation;
+}
+
+/**
+ * @brief Applies the verdicts of a finished filter pass if it is still current.
+ *
+ * The verdicts stand in for filterAcceptsRow()'s own evaluation of the snapshot's rows (see
+ * set_batch_verdicts()), so the filter is applied without evaluating them again; the match
+ * counts start from the worker's accepted_counts. If rows were removed or replaced meanwhile,
+ * the pass starts over.
+ *
+ * @param generation The filter pass the verdicts were computed for.
+ * @param epoch The store epoch of the evaluated snapshot.
+ * @param verdicts One verdict per snapshot row.
+ */
+auto LogSortFilterProxyModel::apply_filter_verdicts(quint64 generation, quint64 epoch,
+                                                    const LogFilter::BatchVerdicts& verdicts)
+    -> void
+{
+    const auto* log_model = qobject_cast<const LogModel*>(sourceModel());
 
-    if (!m_show_only_file_path.isEmpty())
+    if (generation == m_filter_generation && log_model != nullptr)
     {
-        if (file_path != m_show_only_file_path)
+        end_task(m_filter_token);
+        m_filter_token = TaskToken();
+        m_filter_pending = false;
+
+        if (log_model->get_snapshot().get_epoch() == epoch)
         {
-            accepted = false;
+            set_batch_verdicts(0, verdicts);
+            filter_and_count(verdicts.accepted_counts);
+            clear_batch_verdicts();
+            schedule_counts_changed();
+        }
+        else
+        {
+            refilter();
         }
     }
-    if (accepted && !m_hidden_file_paths.isEmpty())
-    {
-        if (m_hidden_file_paths.contains(file_path))
+}
+
+/**
+ * @brief Ranks a snapshot of the source rows by a column on the worker.
+ *
+ * The rows keep their current order until the ranks are applied. A running sort pass is
+ * cancelled.
+ *
+ * @param column The source column.
+ * @param order The sort order to apply once ranked.
+ */
+auto LogSortFilterProxyModel::start_sort_task(int column, Qt::SortOrder order) -> void
+{
+    cancel_sort_task();
+
+    const auto* log_model = qobject_cast<const LogModel*>(sourceModel());
+    const LogEntryStore::Snapshot snapshot = log_model->get_snapshot();
+    const bool is_extra = log_model->is_extra_column(column);
+    const QString extra_field =
+        is_extra ? log_model->get_extra_column_names().at(column - (LogModel::AppName + 1))
+                 : QString();
+    const bool extra_numeric = is_extra && log_model->is_extra_column_numeric(column);
+    const QLocale locale = m_collator.locale();
+    const quint64 generation = m_sort_generation;
+    m_sort_token = begin_task(QStringLiteral("Sorting view"));
+    m_sort_pending = true;
+    const TaskToken token = m_sort_token;
+
+    m_pool->start([this, snapshot, column, order, extra_field, extra_numeric, locale, token,
+                   generation]() {
+        const QVector<int> ranks =
+            rank_rows(snapshot, column, extra_field, extra_numeric, locale, token);
+
+        if (!token.is_cancelled())
         {
-            accepted = false;
+            const quint64 epoch = snapshot.get_epoch();
+            QMetaObject::invokeMethod(
+                this,
+                [this, generation, epoch, column, order, ranks]() {
+                    apply_sort_ranks(generation, epoch, column, order, ranks);
+                },
+                Qt::QueuedConnection);
         }
+    });
+}
+
+/**
+ * @brief Cancels a running sort pass and drops its result.
+ */
+auto LogSortFilterProxyModel::cancel_sort_task() -> void
+{
+    if (m_sort_pending)
+    {
+        m_sort_token.cancel();
+        end_task(m_sort_token);
+        m_sort_token = TaskToken();
+        m_sort_pending = false;
     }
+    ++m_sort_generation;
+}
+
+/**
+ * @brief Sorts by the ranks of a finished sort pass if it is still current.
+ *
+ * lessThan() compares the ranks instead of the values; rows appended after the snapshot fall
+ * back to comparing values, which orders them consistently with the ranks. If rows were removed
+ * or replaced meanwhile, the pass starts over.
+ *
+ * @param generation The sort pass the ranks were computed for.
+ * @param epoch The store epoch of the ranked snapshot.
+ * @param column The ranked source column.
+ * @param order The sort order.
+ * @param ranks One rank per snapshot row; equal values have equal ranks.
+ */
+auto LogSortFilterProxyModel::apply_sort_ranks(quint64 generation, quint64 epoch, int column,
+                                               Qt::SortOrder order, const QVector<int>& ranks)
+    -> void
+{
+    const auto* log_model = qobject_cast<const LogModel*>(sourceModel());
 
-    if (accepted)
+    if (generation == m_sort_generation && log_model != nullptr)
     {
-        if (!m_any_filter_active)
+        end_task(m_sort_token);
+        m_sort_token = TaskToken();
+        m_sort_pending = false;
+
+        if (log_model->get_snapshot().get_epoch() == epoch)
         {
-            accepted = true;
+            m_sort_ranks = ranks;
+            m_sort_rank_column = column;
+            QSortFilterProxyModel::sort(column, order);
         }
         else
         {
-            QModelIndex index_app = sourceModel()->index(row, LogModel::AppName, parent);
-            QModelIndex index_level = sourceModel()->index(row, LogModel::Level, parent);
-            QModelIndex index_message = sourceModel()->index(row, LogModel::Message, parent);
+            sort(column, order);
+        }
+    }
+}
+
+/**
+ * @brief Drops the ranks of the last sort pass, e.g. after the source rows changed.
+ */
+auto LogSortFilterProxyModel::clear_sort_ranks() -> void
+{
+    m_sort_ranks.clear();
+    m_sort_rank_column = -1;
+}
+
+/**
+ * @brief Registers a task with the registry, if any.
+ * @param name The task name.
+ * @return The task's token.
+ */
+auto LogSortFilterProxyModel::begin_task(const QString& name) const -> TaskToken
+{
+    TaskToken token;
+
+    if (m_registry != nullptr)
+    {
+        token = m_registry->begin_task(name, m_owner);
+    }
+
+    return token;
+}
 
-            // App name filter
-            if (!m_app_name_filter.isEmpty())
+/**
+ * @brief Ends a task registered with begin_task().
+ * @param token The task's token.
+ */
+auto LogSortFilterProxyModel::end_task(const TaskToken& token) const -> void
+{
+    if (m_registry != nullptr)
+    {
+        m_registry->end_task(token);
+    }
+}
+
+/**
+ * @brief Recounts the facet counts over all rows and over the rows passing the filter.
+ *
+ * The rows passing the filter are counted in the same loop from the proxy's mapping; they are
+ * not evaluated again.
+ */
+auto LogSortFilterProxyModel::recount() -> void
+{
+    m_total_counts.clear();
+    m_match_counts.clear();
+    const auto* log_model = qobject_cast<const LogModel*>(sourceModel());
+    const bool is_filtered = m_filter.is_active();
+
+    if (log_model != nullptr)
+    {
+        const int rows = log_model->rowCount();
+        for (int row = 0; row < rows; ++row)
+        {
+            const LogEntry entry = log_model->get_entry(row);
+            m_total_counts.add_entry(entry);
+
+            if (is_filtered && is_source_row_accepted(row))
             {
-                const QString app_name = sourceModel()->data(index_app, Qt::DisplayRole).toString();
-                if (app_name != m_app_name_filter)
-                {
-                    accepted = false;
-                }
+                m_match_counts.add_entry(entry);
             }
+        }
+    }
+
+    if (!is_filtered)
+    {
+        m_match_counts = m_total_counts;
+    }
+}
+
+/**
+ * @brief Filters all rows again, counting the accepted rows as a by-product of the pass.
+ *
+ * Rows decided by batch verdicts are not looked at; their counts come in as decided_counts.
+ * filterAcceptsRow() adds every row it evaluates and accepts. Without a filter set the totals
+ * are copied.
+ *
+ * @param decided_counts The counts of the rows accepted by batch verdicts.
+ */
+auto LogSortFilterProxyModel::filter_and_count(const LogFacetCounts& decided_counts) -> void
+{
+    const bool is_filtered = m_filter.is_active();
+    m_match_counts = is_filtered ? decided_counts : m_total_counts;
+    m_counting_matches = is_filtered;
+
+    invalidateFilter();
+    // Builds the mapping if the base class had none to filter again (it does so lazily).
+    static_cast<void>(rowCount());
+
+    m_counting_matches = false;
+}
 
-            // Level filter
-            if (accepted && !m_log_level_filters.isEmpty())
+/**
+ * @brief Records which rows of a changed range pass the filter, before they are filtered again.
+ * @param first The first changed source row.
+ * @param last The last changed source row.
+ */
+auto LogSortFilterProxyModel::record_changed_rows(int first, int last) -> void
+{
+    m_changed_first_row = -1;
+    m_changed_accepted.clear();
+
+    if (m_filter.is_active() && sourceModel() != nullptr && first >= 0 && last >= first)
+    {
+        m_changed_first_row = first;
+        m_changed_accepted.resize(last - first + 1);
+
+        for (int row = first; row <= last; ++row)
+        {
+            m_changed_accepted.setBit(row - first, is_source_row_accepted(row));
+        }
+    }
+}
+
+/**
+ * @brief Updates the match counts for changed rows whose verdict flipped.
+ *
+ * Only rows that entered or left the proxy are looked up; the facets of a changed row (level,
+ * app, file) stay the same.
+ *
+ * @param first The first changed source row.
+ * @param last The last changed source row.
+ * @return True if the counts changed.
+ */
+auto LogSortFilterProxyModel::count_changed_rows(int first, int last) -> bool
+{
+    bool changed = false;
+    const auto* log_model = qobject_cast<const LogModel*>(sourceModel());
+    const bool recorded = log_model != nullptr && m_changed_first_row == first &&
+                          m_changed_accepted.size() == qsizetype(last - first) + 1;
+
+    for (int row = first; recorded && row <= last; ++row)
+    {
+        const bool accepted = is_source_row_accepted(row);
+
+        if (accepted != m_changed_accepted.testBit(row - first))
+        {
+            m_match_counts.add_entry(log_model->get_entry(row), accepted ? 1 : -1);
+            changed = true;
+        }
+    }
+
+    m_changed_first_row = -1;
+    m_changed_accepted.clear();
+
+    return changed;
+}
+
+/**
+ * @brief Adds inserted source rows to the facet counts.
+ *
+ * A batch with verdicts adds its precomputed counts; only its undecided rows are looked up.
+ *
+ * @param first The first inserted source row.
+ * @param last The last inserted source row.
+ */
+auto LogSortFilterProxyModel::count_inserted_rows(int first, int last) -> void
+{
+    const auto* log_model = qobject_cast<const LogModel*>(sourceModel());
+    const bool whole_batch = m_batch_first_row == first &&
+                             m_batch_verdicts.accepted.size() == qsizetype(last - first) + 1;
+
+    if (whole_batch)
+    {
+        m_total_counts.merge(m_batch_verdicts.counts);
+        m_match_counts.merge(m_batch_verdicts.accepted_counts);
+    }
+
+    for (int row = first; log_model != nullptr && row <= last; ++row)
+    {
+        const bool counted = whole_batch && !m_batch_verdicts.undecided.testBit(row - first);
+
+        if (!counted)
+        {
+            const LogEntry entry = log_model->get_entry(row);
+
+            if (!whole_batch)
             {
-                const QString level = sourceModel()->data(index_level, Qt::DisplayRole).toString();
-                const QString normalized_level = level.trimmed().toLower();
-                if (!m_log_level_filters.contains(normalized_level))
-                {
-                    accepted = false;
-                }
+                m_total_counts.add_entry(entry);
             }
 
-            // Search filter
-            if (accepted && !m_search_text.isEmpty())
+            if (is_source_row_accepted(row))
             {
-                const bool all_fields =
-                    (m_search_field.compare("All Fields", Qt::CaseInsensitive) == 0);
-                const QString message_value =
-                    sourceModel()->data(index_message, Qt::DisplayRole).toString();
-                const QString level_value =
-                    sourceModel()->data(index_level, Qt::DisplayRole).toString();
-                const QString app_value =
-                    sourceModel()->data(index_app, Qt::DisplayRole).toString();
-
-                if (m_use_regex)
-                {
-                    if (!m_search_regex.isValid())
-                    {
-                        accepted = false;
-                    }
-                    else if (all_fields)
-                    {
-                        if (!m_search_regex.match(message_value).hasMatch() &&
-                            !m_search_regex.match(level_value).hasMatch() &&
-                            !m_search_regex.match(app_value).hasMatch())
-                        {
-                            accepted = false;
-                        }
-                    }
-                    else if (m_search_field.compare("Message", Qt::CaseInsensitive) == 0)
-                    {
-                        if (!m_search_regex.match(message_value).hasMatch())
-                        {
-                            accepted = false;
-                        }
-                    }
-                    else if (m_search_field.compare("Level", Qt::CaseInsensitive) == 0)
-                    {
-                        if (!m_search_regex.match(level_value).hasMatch())
-                        {
-                            accepted = false;
-                        }
-                    }
-                    else if (m_search_field.compare("AppName", Qt::CaseInsensitive) == 0)
-                    {
-                        if (!m_search_regex.match(app_value).hasMatch())
-                        {
-                            accepted = false;
-                        }
-                    }
-                    else
-                    {
-                        if (!m_search_regex.match(message_value).hasMatch() &&
-                            !m_search_regex.match(level_value).hasMatch() &&
-                            !m_search_regex.match(app_value).hasMatch())
-                        {
-                            accepted = false;
-                        }
-                    }
-                }
-                else
-                {
-                    if (all_fields)
-                    {
-                        if (!message_value.contains(m_search_text, Qt::CaseInsensitive) &&
-                            !level_value.contains(m_search_text, Qt::CaseInsensitive) &&
-                            !app_value.contains(m_search_text, Qt::CaseInsensitive))
-                        {
-                            accepted = false;
-                        }
-                    }
-                    else if (m_search_field.compare("Message", Qt::CaseInsensitive) == 0)
-                    {
-                        if (!message_value.contains(m_search_text, Qt::CaseInsensitive))
-                        {
-                            accepted = false;
-                        }
-                    }
-                    else if (m_search_field.compare("Level", Qt::CaseInsensitive) == 0)
-                    {
-                        if (!level_value.contains(m_search_text, Qt::CaseInsensitive))
-                        {
-                            accepted = false;
-                        }
-                    }
-                    else if (m_search_field.compare("AppName", Qt::CaseInsensitive) == 0)
-                    {
-                        if (!app_value.contains(m_search_text, Qt::CaseInsensitive))
-                        {
-                            accepted = false;
-                        }
-                    }
-                    else
-                    {
-                        if (!message_value.contains(m_search_text, Qt::CaseInsensitive) &&
-                            !level_value.contains(m_search_text, Qt::CaseInsensitive) &&
-                            !app_value.contains(m_search_text, Qt::CaseInsensitive))
-                        {
-                            accepted = false;
-                        }
-                    }
-                }
+                m_match_counts.add_entry(entry);
             }
         }
     }
+}
 
-    return accepted;
+/**
+ * @brief Removes source rows about to be removed from the facet counts.
+ * @param first The first removed source row.
+ * @param last The last removed source row.
+ */
+auto LogSortFilterProxyModel::uncount_removed_rows(int first, int last) -> void
+{
+    const auto* log_model = qobject_cast<const LogModel*>(sourceModel());
+
+    for (int row = first; log_model != nullptr && row <= last; ++row)
+    {
+        const LogEntry entry = log_model->get_entry(row);
+        m_total_counts.add_entry(entry, -1);
+
+        if (is_source_row_accepted(row))
+        {
+            m_match_counts.add_entry(entry, -1);
+        }
+    }
+}
+
+/**
+ * @brief Emits match_counts_changed() once control returns to the event loop.
+ */
+auto LogSortFilterProxyModel::schedule_counts_changed() -> void
+{
+    m_counts_timer->start();
 }
 
 /**
- * @brief Recomputes the internal flag indicating active filters.
+ * @brief Checks whether a source row is mapped into the proxy, i.e. passed the filter.
+ * @param source_row The row in the source model.
+ * @return True if the row passed the filter.
+ */
+auto LogSortFilterProxyModel::is_source_row_accepted(int source_row) const -> bool
+{
+    return mapFromSource(sourceModel()->index(source_row, 0)).isValid();
+}
+
+/**
+ * @brief Checks whether a source column is an extra column covered by the current search.
+ * @param source_column The source column index.
+ * @return True if the search applies to this extra column.
+ */
+auto LogSortFilterProxyModel::is_searched_extra_column(int source_column) const -> bool
+{
+    bool searched = false;
+    const auto* log_model = qobject_cast<const LogModel*>(sourceModel());
+
+    if (log_model != nullptr && log_model->is_extra_column(source_column))
+    {
+        searched = (m_search_field.compare("All Fields", Qt::CaseInsensitive) == 0) ||
+                   (log_model->find_extra_column(m_search_field) == source_column);
+    }
+
+    return searched;
+}
+
+/**
+ * @brief Recompiles the filter from the current settings and updates the active flag.
  */
 auto LogSortFilterProxyModel::recalc_active_filters() -> void
 {
-    m_any_filter_active = !m_app_name_filter.isEmpty() || !m_log_level_filters.isEmpty() ||
-                          !m_search_text.isEmpty() || !m_show_only_file_path.isEmpty() ||
-                          !m_hidden_file_paths.isEmpty();
+    LogFilter::Spec spec;
+    spec.app_name = m_app_name_filter;
+    spec.levels = m_log_level_filters;
+    spec.search_text = m_search_text;
+    spec.search_field = m_search_field;
+    spec.use_regex = m_use_regex;
+    spec.show_only_file_path = m_show_only_file_path;
+    spec.hidden_file_paths = m_hidden_file_paths;
+    spec.baseline = m_baseline;
+    spec.novel_only = m_novel_only_filter;
+    spec.dedupe = m_dedupe_enabled;
+
+    m_filter = LogFilter(spec);
+    m_any_filter_active = m_filter.is_active();
 }
@@ -8,6 +8,8 @@
 #include <QSortFilterProxyModel>
 #include <algorithm>
 
+#include "Qt-LogViewer/Models/LogModel.h"
+
 /**
  * @brief Constructs a PagingProxyModel.
  * @param parent The parent QObject.
@@ -24,6 +26,7 @@ auto PagingProxyModel::set_paging_enabled(bool enabled) -> void
     {
         m_paging_enabled = enabled;
         validate_current_page();
+        follow_anchor_rows();
         beginResetModel();
         endResetModel();
     }
@@ -50,6 +53,7 @@ auto PagingProxyModel::set_page_size(int size) -> void
         {
             m_page_size = size;
             validate_current_page();
+            follow_anchor_rows();
             beginResetModel();
             endResetModel();
         }
@@ -78,6 +82,8 @@ auto PagingProxyModel::set_current_page(int page) -> void
         new_page = 1;
     }
 
+    m_requested_page = 0;
+
     if (m_current_page != new_page)
     {
         m_current_page = new_page;
@@ -87,6 +93,23 @@ auto PagingProxyModel::set_current_page(int page) -> void
     }
 }
 
+/**
+ * @brief Requests a page that may not exist yet (e.g. while a restored view is loading).
+ * @param page The page number to restore (1-based).
+ */
+auto PagingProxyModel::set_restore_page(int page) -> void
+{
+    const int old_page = m_current_page;
+    m_requested_page = std::max(page, 1);
+    validate_current_page();
+
+    if (m_current_page != old_page)
+    {
+        beginResetModel();
+        endResetModel();
+    }
+}
+
 /**
  * @brief Returns the current page (1-based).
  * @return The current page number.
@@ -118,6 +141,80 @@ auto PagingProxyModel::get_total_pages() const -> int
     return result;
 }
 
+/**
+ * @brief Sets the rows the current page follows when the source changes.
+ *
+ * When source rows are inserted, removed, filtered or re-sorted, or the page size changes, the
+ * proxy switches to the page showing the first of these rows that is still shown. Explicit page
+ * changes (set_current_page(), set_restore_page()) are unaffected.
+ *
+ * @param row_ids Row ids (see LogModel::get_row_id()) in priority order; 0 entries are ignored.
+ */
+auto PagingProxyModel::set_anchor_row_ids(const QVector<quint64>& row_ids) -> void
+{
+    m_anchor_row_ids = row_ids;
+}
+
+/**
+ * @brief Returns the index of a row on the current page by its id, in O(log n).
+ * @param row_id The row id (see LogModel::get_row_id()).
+ * @param column The column of the index.
+ * @return The index, or an invalid index if the row is not on the current page.
+ */
+auto PagingProxyModel::index_of_row_id(quint64 row_id, int column) const -> QModelIndex
+{
+    QModelIndex result;
+    const int source_row = map_row_id_to_source_row(row_id);
+
+    if (source_row >= 0)
+    {
+        result = mapFromSource(sourceModel()->index(source_row, column));
+    }
+
+    return result;
+}
+
+/**
+ * @brief Returns the source row of a row id, across all pages.
+ *
+ * Looks the id up in the LogModel at the bottom of the source chain and maps the row up through
+ * the proxies in between (e.g. the sort/filter proxy).
+ *
+ * @param row_id The row id (see LogModel::get_row_id()).
+ * @return The row in the source model, or -1 if the row is not shown (or the source does not
+ *         end in a LogModel).
+ */
+auto PagingProxyModel::map_row_id_to_source_row(quint64 row_id) const -> int
+{
+    int result = -1;
+    QVector<const QAbstractProxyModel*> proxies;
+    const QAbstractItemModel* model = sourceModel();
+    const auto* proxy = qobject_cast<const QAbstractProxyModel*>(model);
+
+    while (proxy != nullptr)
+    {
+        proxies.prepend(proxy);
+        model = proxy->sourceModel();
+        proxy = qobject_cast<const QAbstractProxyModel*>(model);
+    }
+
+    const auto* log_model = qobject_cast<const LogModel*>(model);
+
+    if (log_model != nullptr && row_id != 0)
+    {
+        QModelIndex index = log_model->index(log_model->find_row(row_id), 0);
+
+        for (const auto* source_proxy: proxies)
+        {
+            index = source_proxy->mapFromSource(index);
+        }
+
+        result = index.isValid() ? index.row() : -1;
+    }
+
+    return result;
+}
+
 /**
  * @brief Sets the source model for this proxy model.
  * @param source_model The source model to page.
@@ -134,6 +231,7 @@ void PagingProxyModel::setSourceModel(QAbstractItemModel* source_model)
     {
         connect(source_model, &QAbstractItemModel::modelReset, this, [this]() {
             validate_current_page();
+            follow_anchor_rows();
             beginResetModel();
             endResetModel();
         });
@@ -144,16 +242,27 @@ void PagingProxyModel::setSourceModel(QAbstractItemModel* source_model)
         });
         connect(source_model, &QAbstractItemModel::layoutChanged, this, [this]() {
             validate_current_page();
+            follow_anchor_rows();
             beginResetModel();
             endResetModel();
         });
         connect(source_model, &QAbstractItemModel::rowsInserted, this, [this]() {
             validate_current_page();
+            follow_anchor_rows();
             beginResetModel();
             endResetModel();
         });
         connect(source_model, &QAbstractItemModel::rowsRemoved, this, [this]() {
             validate_current_page();
+            follow_anchor_rows();
+            beginResetModel();
+            endResetModel();
+        });
+        connect(source_model, &QAbstractItemModel::columnsInserted, this, [this]() {
+            beginResetModel();
+            endResetModel();
+        });
+        connect(source_model, &QAbstractItemModel::columnsRemoved, this, [this]() {
             beginResetModel();
             endResetModel();
         });
@@ -348,12 +457,19 @@ auto PagingProxyModel::get_page_offset() const -> int
 }
 
 /**
- * @brief Ensures the current page is within valid bounds.
+ * @brief Ensures the current page is within valid bounds and applies a reachable restore page.
  */
 auto PagingProxyModel::validate_current_page() -> void
 {
     int total_pages = get_total_pages();
 
+    // Apply a pending restore page once the data reaches it.
+    if (m_requested_page > 0 && m_requested_page <= total_pages)
+    {
+        m_current_page = m_requested_page;
+        m_requested_page = 0;
+    }
+
     if (m_current_page < 1)
     {
         m_current_page = 1;
@@ -364,3 +480,28 @@ auto PagingProxyModel::validate_current_page() -> void
         m_current_page = total_pages;
     }
 }
+
+/**
+ * @brief Switches to the page showing the first anchor row that is still shown.
+ */
+auto PagingProxyModel::follow_anchor_rows() -> void
+{
+    // A pending restore page takes precedence until it is reached.
+    if (m_paging_enabled && m_requested_page == 0)
+    {
+        int source_row = -1;
+
+        for (const quint64 row_id: m_anchor_row_ids)
+        {
+            if (source_row < 0)
+            {
+                source_row = map_row_id_to_source_row(row_id);
+            }
+        }
+
+        if (source_row >= 0)
+        {
+            m_current_page = (source_row / m_page_size) + 1;
+        }
+    }
+}
@@ -0,0 +1,277 @@
+/**
+ * @file FolderScanner.cpp
+ * @brief This file contains the implementation of the FolderScanner class.
+ */
+
+#include "Qt-LogViewer/Services/FolderScanner.h"
+
+#include <QDir>
+#include <QDirIterator>
+#include <QFileInfo>
+#include <QFileSystemWatcher>
+#include <QThreadPool>
+#include <algorithm>
+
+namespace
+{
+// Folder listings are cheap metadata reads; two threads keep one slow share from blocking all.
+constexpr int k_max_scan_threads = 2;
+
+/**
+ * @brief Sorts paths by name, case-insensitively.
+ * @param paths The paths to sort.
+ */
+auto sort_by_name(QStringList& paths) -> void
+{
+    std::sort(paths.begin(), paths.end(), [](const QString& lhs, const QString& rhs) {
+        return QString::compare(lhs, rhs, Qt::CaseInsensitive) < 0;
+    });
+}
+}  // namespace
+
+/**
+ * @brief Constructs a FolderScanner.
+ * @param parent Optional QObject parent.
+ */
+FolderScanner::FolderScanner(QObject* parent)
+    : QObject(parent), m_pool(new QThreadPool(this)), m_watcher(new QFileSystemWatcher(this))
+{
+    m_pool->setMaxThreadCount(k_max_scan_threads);
+
+    connect(m_watcher, &QFileSystemWatcher::directoryChanged, this,
+            &FolderScanner::handle_directory_changed);
+}
+
+/**
+ * @brief Waits for running scans; queued ones are dropped.
+ */
+FolderScanner::~FolderScanner()
+{
+    // Tasks reference this object, so none may outlive it.
+    m_pool->clear();
+    m_pool->waitForDone();
+}
+
+/**
+ * @brief Returns the name filters files must match to be listed.
+ * @return The name filters (e.g. "*.log").
+ */
+auto FolderScanner::get_name_filters() -> QStringList
+{
+    return QStringList{QStringLiteral("*.log"), QStringLiteral("*.txt")};
+}
+
+/**
+ * @brief Queues a scan of one folder level; folder_scanned() is emitted when done.
+ * @param folder_path The absolute folder path.
+ */
+auto FolderScanner::scan(const QString& folder_path) -> void
+{
+    if (!folder_path.isEmpty() && !m_pending_scans.contains(folder_path))
+    {
+        m_pending_scans.insert(folder_path);
+
+        m_pool->start([this, folder_path]() {
+            const FolderListing listing = list_folder(folder_path);
+
+            QMetaObject::invokeMethod(
+                this, [this, folder_path, listing]() { handle_scan_result(folder_path, listing); },
+                Qt::QueuedConnection);
+        });
+    }
+}
+
+/**
+ * @brief Queues reading the size and modification time of files.
+ *
+ * metadata_ready() is emitted once per file.
+ *
+ * @param file_paths The file paths.
+ */
+auto FolderScanner::request_metadata(const QVector<QString>& file_paths) -> void
+{
+    if (!file_paths.isEmpty())
+    {
+        ++m_pending_metadata;
+
+        m_pool->start([this, file_paths]() {
+            for (const auto& file_path: file_paths)
+            {
+                const QFileInfo info(file_path);
+                const qint64 size = info.exists() ? info.size() : -1;
+                const QDateTime last_modified = info.lastModified();
+
+                QMetaObject::invokeMethod(
+                    this,
+                    [this, file_path, size, last_modified]() {
+                        emit metadata_ready(file_path, size, last_modified);
+                    },
+                    Qt::QueuedConnection);
+            }
+
+            QMetaObject::invokeMethod(
+                this, [this]() { --m_pending_metadata; }, Qt::QueuedConnection);
+        });
+    }
+}
+
+/**
+ * @brief Watches a folder; a change triggers a new scan of it.
+ * @param folder_path The absolute folder path.
+ */
+auto FolderScanner::watch(const QString& folder_path) -> void
+{
+    if (!m_watcher->directories().contains(folder_path) && QFileInfo(folder_path).isDir())
+    {
+        m_watcher->addPath(folder_path);
+    }
+}
+
+/**
+ * @brief Stops watching a folder.
+ * @param folder_path The absolute folder path.
+ */
+auto FolderScanner::unwatch(const QString& folder_path) -> void
+{
+    if (m_watcher->directories().contains(folder_path))
+    {
+        m_watcher->removePath(folder_path);
+    }
+}
+
+/**
+ * @brief Checks whether scans or metadata requests are pending.
+ * @return True if at least one result has not been reported yet.
+ */
+auto FolderScanner::is_busy() const -> bool
+{
+    return !m_pending_scans.isEmpty() || m_pending_metadata > 0;
+}
+
+/**
+ * @brief Returns the watched folders.
+ * @return The absolute paths of the watched folders.
+ */
+auto FolderScanner::get_watched_folders() const -> QStringList
+{
+    return m_watcher->directories();
+}
+
+/**
+ * @brief Lists the direct entries of a folder synchronously.
+ * @param folder_path The folder path.
+ * @return The sorted sub folders and matching files (absolute paths); exists is false if the
+ *         folder is gone.
+ */
+auto FolderScanner::list_folder(const QString& folder_path) -> FolderListing
+{
+    FolderListing listing;
+    listing.exists = QFileInfo(folder_path).isDir();
+
+    // AllDirs lists every sub folder regardless of the name filters; the entry type comes
+    // from the directory read itself, so no entry is stat'ed here.
+    QDirIterator it(folder_path, get_name_filters(),
+                    QDir::AllDirs | QDir::Files | QDir::NoDotAndDotDot | QDir::Readable);
+
+    while (it.hasNext())
+    {
+        const QString path = QDir::cleanPath(it.next());
+
+        if (it.fileInfo().isDir())
+        {
+            listing.sub_folders.append(path);
+        }
+        else
+        {
+            listing.files.append(path);
+        }
+    }
+
+    sort_by_name(listing.sub_folders);
+    sort_by_name(listing.files);
+
+    return listing;
+}
+
+/**
+ * @brief Rescans a watched folder, or marks it for a rescan if a scan is running.
+ * @param folder_path The changed folder.
+ */
+auto FolderScanner::handle_directory_changed(const QString& folder_path) -> void
+{
+    // The running scan may have read the folder before the change; merging would lose it.
+    if (m_pending_scans.contains(folder_path))
+    {
+        m_rescan_folders.insert(folder_path);
+    }
+    else
+    {
+        scan(folder_path);
+    }
+}
+
+/**
+ * @brief Stops watching a folder and every watched folder below it.
+ * @param folder_path The folder path.
+ */
+auto FolderScanner::unwatch_tree(const QString& folder_path) -> void
+{
+    const QString prefix = folder_path + QLatin1Char('/');
+    QStringList stale_folders;
+
+    for (const auto& watched: m_watcher->directories())
+    {
+        if (watched == folder_path || watched.startsWith(prefix))
+        {
+            stale_folders.append(watched);
+        }
+    }
+
+    if (!stale_folders.isEmpty())
+    {
+        m_watcher->removePaths(stale_folders);
+    }
+}
+
+/**
+ * @brief Reports a pool scan result (runs on the owner's thread).
+ *
+ * Watches of the folder (if it is gone) or of sub folders missing from the listing are dropped
+ * before the result is emitted; a rescan requested meanwhile is started afterwards.
+ *
+ * @param folder_path The scanned folder.
+ * @param listing The listing computed by the worker.
+ */
+auto FolderScanner::handle_scan_result(const QString& folder_path, const FolderListing& listing)
+    -> void
+{
+    m_pending_scans.remove(folder_path);
+
+    if (!listing.exists)
+    {
+        unwatch_tree(folder_path);
+    }
+    else
+    {
+        const QString prefix = folder_path + QLatin1Char('/');
+        const QSet<QString> sub_folders(listing.sub_folders.cbegin(), listing.sub_folders.cend());
+
+        for (const auto& watched: m_watcher->directories())
+        {
+            // Only direct children are checked; unwatch_tree() takes their descendants along.
+            const bool is_child = watched.startsWith(prefix) &&
+                                  !watched.mid(prefix.size()).contains(QLatin1Char('/'));
+            if (is_child && !sub_folders.contains(watched))
+            {
+                unwatch_tree(watched);
+            }
+        }
+    }
+
+    emit folder_scanned(folder_path, listing.sub_folders, listing.files);
+
+    if (m_rescan_folders.remove(folder_path))
+    {
+        scan(folder_path);
+    }
+}
@@ -0,0 +1,277 @@
+/**
+ * @file LineSplitter.cpp
+ * @brief This file contains the implementation of the LineSplitter class.
+ */
+
+#include "Qt-LogViewer/Services/LineSplitter.h"
+
+#include <bit>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define LINE_SPLITTER_X86 1
+#if defined(__GNUC__) || defined(__clang__)
+#define LINE_SPLITTER_AVX2_TARGET __attribute__((target("avx2")))
+#define LINE_SPLITTER_AVX2 1
+#elif defined(__AVX2__)
+#define LINE_SPLITTER_AVX2_TARGET
+#define LINE_SPLITTER_AVX2 1
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define LINE_SPLITTER_NEON 1
+#endif
+
+namespace
+{
+using LineSpan = LineSplitter::LineSpan;
+using SplitFunction = qsizetype (*)(const char*, qsizetype, QVector<LineSpan>&, qsizetype);
+
+/**
+ * @struct Kernel
+ * @brief A split implementation and the name of its instruction set.
+ */
+struct Kernel {
+        SplitFunction split = nullptr;
+        const char* name = "";
+};
+
+/**
+ * @brief Scans the bytes after the last full vector one by one.
+ * @param data The buffer.
+ * @param size The buffer size.
+ * @param spans Output spans.
+ * @param line_start Start of the current line.
+ * @param pos First byte to scan.
+ * @return The end of the last appended line.
+ */
+inline auto finish_bytewise(const char* data, qsizetype size, QVector<LineSpan>& spans,
+                            qsizetype line_start, qsizetype pos) -> qsizetype
+{
+    for (qsizetype i = pos; i < size; ++i)
+    {
+        if (data[i] == '\n')
+        {
+            spans.append(LineSpan{line_start, i - line_start});
+            line_start = i + 1;
+        }
+    }
+
+    return line_start;
+}
+
+/**
+ * @brief Portable implementation on top of memchr.
+ */
+auto split_scalar(const char* data, qsizetype size, QVector<LineSpan>& spans, qsizetype scan_from)
+    -> qsizetype
+{
+    qsizetype line_start = 0;
+    const auto find_from = [data, size](qsizetype from) -> const char* {
+        return (from < size) ? static_cast<const char*>(
+                                   std::memchr(data + from, '\n', static_cast<size_t>(size - from)))
+                             : nullptr;
+    };
+
+    const char* found = find_from(scan_from);
+
+    while (found != nullptr)
+    {
+        const qsizetype end = found - data;
+        spans.append(LineSpan{line_start, end - line_start});
+        line_start = end + 1;
+        found = find_from(line_start);
+    }
+
+    return line_start;
+}
+
+#if defined(LINE_SPLITTER_X86)
+/**
+ * @brief SSE2 implementation (always available on x86-64).
+ */
+auto split_sse2(const char* data, qsizetype size, QVector<LineSpan>& spans, qsizetype scan_from)
+    -> qsizetype
+{
+    constexpr qsizetype k_width = 16;
+    const __m128i newline = _mm_set1_epi8('\n');
+    qsizetype line_start = 0;
+    qsizetype pos = scan_from;
+
+    while (pos + k_width <= size)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, newline)));
+
+        while (mask != 0U)
+        {
+            const qsizetype end = pos + std::countr_zero(mask);
+            spans.append(LineSpan{line_start, end - line_start});
+            line_start = end + 1;
+            mask &= mask - 1U;
+        }
+
+        pos += k_width;
+    }
+
+    return finish_bytewise(data, size, spans, line_start, pos);
+}
+#endif
+
+#if defined(LINE_SPLITTER_AVX2)
+/**
+ * @brief AVX2 implementation (selected at runtime).
+ */
+LINE_SPLITTER_AVX2_TARGET auto split_avx2(const char* data, qsizetype size,
+                                          QVector<LineSpan>& spans, qsizetype scan_from)
+    -> qsizetype
+{
+    constexpr qsizetype k_width = 32;
+    const __m256i newline = _mm256_set1_epi8('\n');
+    qsizetype line_start = 0;
+    qsizetype pos = scan_from;
+
+    while (pos + k_width <= size)
+    {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+        auto mask =
+            static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, newline)));
+
+        while (mask != 0U)
+        {
+            const qsizetype end = pos + std::countr_zero(mask);
+            spans.append(LineSpan{line_start, end - line_start});
+            line_start = end + 1;
+            mask &= mask - 1U;
+        }
+
+        pos += k_width;
+    }
+
+    return finish_bytewise(data, size, spans, line_start, pos);
+}
+
+/**
+ * @brief Checks whether the CPU supports AVX2.
+ * @return True if split_avx2() may be called.
+ */
+auto cpu_has_avx2() -> bool
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_cpu_supports("avx2") != 0;
+#else
+    // Only compiled in when the whole build targets AVX2.
+    return true;
+#endif
+}
+#endif
+
+#if defined(LINE_SPLITTER_NEON)
+/**
+ * @brief NEON implementation (always available on ARM64).
+ */
+auto split_neon(const char* data, qsizetype size, QVector<LineSpan>& spans, qsizetype scan_from)
+    -> qsizetype
+{
+    constexpr qsizetype k_width = 16;
+    const uint8x16_t newline = vdupq_n_u8('\n');
+    qsizetype line_start = 0;
+    qsizetype pos = scan_from;
+
+    while (pos + k_width <= size)
+    {
+        const uint8x16_t block = vld1q_u8(reinterpret_cast<const uint8_t*>(data + pos));
+        const uint8x16_t equal = vceqq_u8(block, newline);
+
+        // NEON has no movemask: narrow every byte to a nibble, so byte i maps to bits 4i..4i+3.
+        quint64 mask = vget_lane_u64(
+            vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(equal), 4)), 0);
+
+        while (mask != 0U)
+        {
+            const int bit = std::countr_zero(mask);
+            const qsizetype end = pos + bit / 4;
+            spans.append(LineSpan{line_start, end - line_start});
+            line_start = end + 1;
+            mask &= ~(quint64{0xF} << bit);
+        }
+
+        pos += k_width;
+    }
+
+    return finish_bytewise(data, size, spans, line_start, pos);
+}
+#endif
+
+/**
+ * @brief Picks the widest implementation the CPU supports.
+ * @return The kernel.
+ */
+auto select_kernel() -> Kernel
+{
+    Kernel kernel{&split_scalar, "scalar"};
+
+#if defined(LINE_SPLITTER_X86)
+    kernel = Kernel{&split_sse2, "SSE2"};
+#endif
+#if defined(LINE_SPLITTER_AVX2)
+    if (cpu_has_avx2())
+    {
+        kernel = Kernel{&split_avx2, "AVX2"};
+    }
+#endif
+#if defined(LINE_SPLITTER_NEON)
+    kernel = Kernel{&split_neon, "NEON"};
+#endif
+
+    return kernel;
+}
+
+/**
+ * @brief Returns the kernel selected for this CPU.
+ * @return The kernel (selected on first use).
+ */
+auto get_kernel() -> const Kernel&
+{
+    static const Kernel kernel = select_kernel();
+    return kernel;
+}
+}  // namespace
+
+/**
+ * @brief Appends a span for every line terminated by '\n'.
+ * @param data The buffer.
+ * @param size The buffer size in bytes.
+ * @param spans Output; spans are appended.
+ * @param scan_from The offset to start looking for '\n'.
+ * @return The number of bytes covered by the appended spans (end of the last '\n').
+ */
+auto LineSplitter::split_lines(const char* data, qsizetype size, QVector<LineSpan>& spans,
+                               qsizetype scan_from) -> qsizetype
+{
+    return get_kernel().split(data, size, spans, qBound<qsizetype>(0, scan_from, size));
+}
+
+/**
+ * @brief Appends spans using the portable memchr loop (reference for tests).
+ * @param data The buffer.
+ * @param size The buffer size in bytes.
+ * @param spans Output; spans are appended.
+ * @param scan_from The offset to start looking for '\n'.
+ * @return The number of bytes covered by the appended spans.
+ */
+auto LineSplitter::split_lines_scalar(const char* data, qsizetype size, QVector<LineSpan>& spans,
+                                      qsizetype scan_from) -> qsizetype
+{
+    return split_scalar(data, size, spans, qBound<qsizetype>(0, scan_from, size));
+}
+
+/**
+ * @brief Returns the instruction set used by split_lines().
+ * @return "AVX2", "SSE2", "NEON" or "scalar".
+ */
+auto LineSplitter::get_instruction_set() -> QString
+{
+    return QString::fromLatin1(get_kernel().name);
+}
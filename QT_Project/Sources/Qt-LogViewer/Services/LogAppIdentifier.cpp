@@ -0,0 +1,179 @@
+/**
+ * @file LogAppIdentifier.cpp
+ * @brief This file contains the implementation of the LogAppIdentifier class.
+ */
+
+#include "Qt-LogViewer/Services/LogAppIdentifier.h"
+
+#include <QFile>
+#include <QFileInfo>
+#include <QThread>
+#include <QThreadPool>
+#include <algorithm>
+
+#include "Qt-LogViewer/Services/LogFormatDetector.h"
+#include "Qt-LogViewer/Services/LogLineReader.h"
+#include "Qt-LogViewer/Services/LogLoader.h"
+#include "Qt-LogViewer/Services/LogParser.h"
+
+namespace
+{
+// Identification is I/O bound; more threads only add seeks on spinning disks.
+constexpr int k_max_identify_threads = 4;
+
+// Read caps per file: a file without a matching line in this range is named after the file.
+constexpr qsizetype k_max_identify_lines = 200;
+constexpr qint64 k_max_identify_bytes = 64 * 1024;
+}  // namespace
+
+/**
+ * @brief Constructs a LogAppIdentifier.
+ * @param parent Optional QObject parent.
+ */
+LogAppIdentifier::LogAppIdentifier(QObject* parent)
+    : QObject(parent), m_pool(new QThreadPool(this))
+{
+    m_pool->setMaxThreadCount(std::clamp(QThread::idealThreadCount(), 1, k_max_identify_threads));
+}
+
+/**
+ * @brief Waits for running identifications; queued ones are dropped.
+ */
+LogAppIdentifier::~LogAppIdentifier()
+{
+    // Tasks reference this object, so none may outlive it.
+    m_pool->clear();
+    m_pool->waitForDone();
+}
+
+/**
+ * @brief Sets the format library used for identification.
+ * @param formats Format strings; the first one is the preferred (primary) format.
+ */
+auto LogAppIdentifier::set_formats(const QVector<QString>& formats) -> void
+{
+    if (m_formats != formats)
+    {
+        m_formats = formats;
+        m_cache.clear();
+        m_detector.reset();
+
+        if (!formats.isEmpty())
+        {
+            auto detector = std::make_shared<LogFormatDetector>(formats.first());
+            detector->add_formats(formats.mid(1));
+            m_detector = std::move(detector);
+        }
+    }
+}
+
+/**
+ * @brief Returns the cached app name of a file if its identity is unchanged.
+ * @param file_path The path to the log file.
+ * @return The cached app name, or an empty string if not cached or outdated.
+ */
+auto LogAppIdentifier::get_cached_app_name(const QString& file_path) const -> QString
+{
+    QString app_name;
+    const QFileInfo info(file_path);
+    const auto it = m_cache.constFind(info.absoluteFilePath());
+
+    if (it != m_cache.constEnd() && it->size == info.size() &&
+        it->last_modified == info.lastModified())
+    {
+        app_name = it->app_name;
+    }
+
+    return app_name;
+}
+
+/**
+ * @brief Queues a file for identification; app_identified() is emitted when done.
+ * @param file_path The path to the log file.
+ */
+auto LogAppIdentifier::request(const QString& file_path) -> void
+{
+    if (!file_path.isEmpty() && !m_pending.contains(file_path))
+    {
+        m_pending.insert(file_path);
+        const std::shared_ptr<const LogFormatDetector> detector = m_detector;
+
+        m_pool->start([this, file_path, detector]() {
+            const QFileInfo info(file_path);
+            const CachedIdentity identity{info.size(), info.lastModified(),
+                                          identify(file_path, detector.get())};
+
+            QMetaObject::invokeMethod(
+                this, [this, file_path, identity]() { handle_result(file_path, identity); },
+                Qt::QueuedConnection);
+        });
+    }
+}
+
+/**
+ * @brief Checks whether identifications are pending.
+ * @return True if at least one requested file has not been reported yet.
+ */
+auto LogAppIdentifier::is_busy() const -> bool
+{
+    return !m_pending.isEmpty();
+}
+
+/**
+ * @brief Identifies the app name of a file synchronously (capped read).
+ * @param file_path The path to the log file.
+ * @param detector Detects the file's format, or nullptr to skip parsing.
+ * @return The app name of the first parseable entry, or LogLoader::identify_app().
+ */
+auto LogAppIdentifier::identify(const QString& file_path, const LogFormatDetector* detector)
+    -> QString
+{
+    QString app_name;
+    QFile file(file_path);
+
+    if (detector != nullptr && file.open(QIODevice::ReadOnly))
+    {
+        const LogParser parser(detector->detect_format(file_path));
+
+        LogLineReader reader(&file);
+        QString raw_line;
+        qsizetype line_count = 0;
+
+        // The reader enforces the byte cap, so one endless line cannot be read past it either.
+        reader.set_read_limit(k_max_identify_bytes);
+
+        while (app_name.isEmpty() && line_count < k_max_identify_lines &&
+               reader.read_line(raw_line))
+        {
+            const QString line = raw_line.trimmed();
+
+            if (!line.isEmpty())
+            {
+                app_name = parser.parse_line(line, file_path).get_app_name();
+            }
+
+            ++line_count;
+        }
+    }
+
+    if (app_name.isEmpty())
+    {
+        app_name = LogLoader::identify_app(file_path);
+    }
+
+    return app_name;
+}
+
+/**
+ * @brief Stores a pool result and reports it (runs on the owner's thread).
+ * @param file_path The requested file path.
+ * @param identity The identity and app name computed by the worker.
+ */
+auto LogAppIdentifier::handle_result(const QString& file_path, const CachedIdentity& identity)
+    -> void
+{
+    m_pending.remove(file_path);
+    m_cache.insert(QFileInfo(file_path).absoluteFilePath(), identity);
+
+    emit app_identified(file_path, identity.app_name);
+}
@@ -0,0 +1,244 @@
+/**
+ * @file LogBaselineBuilder.cpp
+ * @brief This file contains the implementation of the LogBaselineBuilder class.
+ */
+
+#include "Qt-LogViewer/Services/LogBaselineBuilder.h"
+
+#include <QFile>
+#include <QFileInfo>
+#include <QThread>
+#include <QThreadPool>
+#include <algorithm>
+
+#include "Qt-LogViewer/Services/LogEntryAssembler.h"
+#include "Qt-LogViewer/Services/LogFormatDetector.h"
+#include "Qt-LogViewer/Services/LogLineReader.h"
+#include "Qt-LogViewer/Services/LogParser.h"
+
+namespace
+{
+// Entries fingerprinted per batch; bounds the memory of a task and the cancellation latency.
+constexpr qsizetype k_batch_size = 4096;
+}  // namespace
+
+/**
+ * @brief Constructs an idle builder.
+ * @param parent Optional QObject parent.
+ */
+LogBaselineBuilder::LogBaselineBuilder(QObject* parent)
+    : QObject(parent), m_pool(new QThreadPool(this))
+{
+    m_pool->setMaxThreadCount(std::max(QThread::idealThreadCount(), 1));
+}
+
+/**
+ * @brief Cancels the running build and waits for the pool.
+ */
+LogBaselineBuilder::~LogBaselineBuilder()
+{
+    // Tasks reference this object, so none may outlive it; cancelled, they stop within a batch.
+    cancel();
+    m_pool->clear();
+    m_pool->waitForDone();
+}
+
+/**
+ * @brief Sets the format library used to parse the reference files.
+ * @param formats Format strings; the first one is the preferred (primary) format.
+ */
+auto LogBaselineBuilder::set_formats(const QVector<QString>& formats) -> void
+{
+    m_formats = formats;
+}
+
+/**
+ * @brief Starts building a baseline from reference files, replacing a running build.
+ *
+ * The filter is sized for the estimated entries of all files; the tasks only post fingerprints
+ * to it.
+ *
+ * @param file_paths The reference files.
+ */
+auto LogBaselineBuilder::build(const QVector<QString>& file_paths) -> void
+{
+    cancel();
+
+    if (file_paths.isEmpty())
+    {
+        m_baseline.reset();
+        emit finished();
+    }
+    else
+    {
+        qsizetype expected = 0;
+        for (const auto& file_path: file_paths)
+        {
+            expected += LogBaseline::estimate_fingerprints(QFileInfo(file_path).size());
+        }
+
+        const quint64 generation = m_generation;
+        const TaskToken token = m_token;
+        const QVector<QString> formats = m_formats;
+        m_building = std::make_unique<LogBaseline>(expected);
+        m_building->set_file_paths(file_paths);
+        m_file_count = static_cast<int>(file_paths.size());
+        m_files_done = 0;
+
+        for (const auto& file_path: file_paths)
+        {
+            m_pool->start([this, generation, token, file_path, formats]() {
+                auto post_batch = [this, generation](const QVector<quint64>& fingerprints) {
+                    QMetaObject::invokeMethod(
+                        this,
+                        [this, generation, fingerprints]() {
+                            handle_fingerprints(generation, fingerprints);
+                        },
+                        Qt::QueuedConnection);
+                };
+
+                if (fingerprint_file(file_path, formats, token, post_batch))
+                {
+                    QMetaObject::invokeMethod(
+                        this, [this, generation]() { handle_file_done(generation); },
+                        Qt::QueuedConnection);
+                }
+            });
+        }
+    }
+}
+
+/**
+ * @brief Cancels the running build; the last finished baseline is kept.
+ */
+auto LogBaselineBuilder::cancel() -> void
+{
+    m_token.cancel();
+    m_token = TaskToken();
+    ++m_generation;
+    m_building.reset();
+    m_file_count = 0;
+    m_files_done = 0;
+}
+
+/**
+ * @brief Checks whether a build is running.
+ * @return True while reference files are being parsed.
+ */
+auto LogBaselineBuilder::is_busy() const -> bool
+{
+    return m_building != nullptr;
+}
+
+/**
+ * @brief Returns the baseline of the last finished build.
+ * @return The baseline, or nullptr if none was built.
+ */
+auto LogBaselineBuilder::get_baseline() const -> std::shared_ptr<const LogBaseline>
+{
+    return m_baseline;
+}
+
+/**
+ * @brief Fingerprints one reference file synchronously, batch by batch.
+ *
+ * The file is parsed like a regular load (format detection, multi-line entries), so its
+ * fingerprints match those of the entries shown in views. Only one batch of entries exists at
+ * a time.
+ *
+ * @param file_path The file.
+ * @param formats Format library; the first format is preferred.
+ * @param token Checked between batches; a cancelled token stops the parse.
+ * @param handle_batch Called with the fingerprints of each batch of entries.
+ * @return False if the parse was cancelled.
+ */
+auto LogBaselineBuilder::fingerprint_file(
+    const QString& file_path, const QVector<QString>& formats, const TaskToken& token,
+    const std::function<void(const QVector<quint64>&)>& handle_batch) -> bool
+{
+    QFile file(file_path);
+
+    if (!formats.isEmpty() && !token.is_cancelled() && file.open(QIODevice::ReadOnly))
+    {
+        LogFormatDetector detector(formats.first());
+        detector.add_formats(formats.mid(1));
+        const LogParser parser(detector.detect_format(file_path));
+
+        LogLineReader reader(&file);
+        LogEntryAssembler assembler;
+        QString line;
+        QVector<LogEntry> entries;
+        QVector<quint64> fingerprints;
+        bool reading = true;
+        entries.reserve(k_batch_size + 1);
+        fingerprints.reserve(k_batch_size + 1);
+
+        while (reading && !token.is_cancelled())
+        {
+            reading = reader.read_line(line);
+
+            if (reading)
+            {
+                const QByteArrayView line_utf8 = reader.get_line_utf8();
+                assembler.add_line(parser.parse_line(line, line_utf8, file_path), line, entries,
+                                   line_utf8);
+            }
+            else
+            {
+                assembler.finish(entries);
+            }
+
+            if (entries.size() >= k_batch_size || (!reading && !entries.isEmpty()))
+            {
+                for (const auto& entry: entries)
+                {
+                    fingerprints.append(LogBaseline::get_fingerprint(entry));
+                }
+
+                handle_batch(fingerprints);
+                entries.clear();
+                fingerprints.clear();
+            }
+        }
+    }
+
+    return !token.is_cancelled();
+}
+
+/**
+ * @brief Adds a batch of fingerprints if it belongs to the running build.
+ * @param generation The build the task was started for.
+ * @param fingerprints The fingerprints.
+ */
+auto LogBaselineBuilder::handle_fingerprints(quint64 generation,
+                                             const QVector<quint64>& fingerprints) -> void
+{
+    if (generation == m_generation && m_building != nullptr)
+    {
+        for (const quint64 fingerprint: fingerprints)
+        {
+            m_building->add(fingerprint);
+        }
+    }
+}
+
+/**
+ * @brief Counts a finished file and completes the build after the last one.
+ * @param generation The build the task was started for.
+ */
+auto LogBaselineBuilder::handle_file_done(quint64 generation) -> void
+{
+    if (generation == m_generation && m_building != nullptr)
+    {
+        ++m_files_done;
+        emit progress(m_files_done, m_file_count);
+
+        if (m_files_done == m_file_count)
+        {
+            m_baseline = std::shared_ptr<const LogBaseline>(std::move(m_building));
+            m_file_count = 0;
+            m_files_done = 0;
+            emit finished();
+        }
+    }
+}
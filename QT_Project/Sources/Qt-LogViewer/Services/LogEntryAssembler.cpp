@@ -0,0 +1,187 @@
+/**
+ * @file LogEntryAssembler.cpp
+ * @brief This file contains the implementation of the LogEntryAssembler class.
+ */
+
+#include "Qt-LogViewer/Services/LogEntryAssembler.h"
+
+namespace
+{
+// Appended (on its own line) to messages whose continuation lines were cut off.
+constexpr auto k_truncation_marker = "[...]";
+
+// Upper bound for pooled extra field strings; high-cardinality fields stop being pooled.
+constexpr qsizetype k_max_interned_strings = 4096;
+
+/**
+ * @brief Returns the length of UTF-8 text in UTF-16 code units, without decoding it.
+ * @param utf8 Valid UTF-8 bytes.
+ * @return The number of QChars the text decodes to.
+ */
+auto get_utf16_length(QByteArrayView utf8) -> qsizetype
+{
+    qsizetype length = 0;
+
+    for (const char byte: utf8)
+    {
+        const auto value = static_cast<unsigned char>(byte);
+
+        // Continuation bytes add nothing; 4-byte sequences decode to a surrogate pair.
+        length += ((value & 0xC0) != 0x80 ? 1 : 0) + (value >= 0xF0 ? 1 : 0);
+    }
+
+    return length;
+}
+}  // namespace
+
+/**
+ * @brief Constructs a LogEntryAssembler.
+ * @param max_entry_chars Upper bound for the assembled message length in characters.
+ */
+LogEntryAssembler::LogEntryAssembler(qsizetype max_entry_chars)
+    : m_max_entry_chars(max_entry_chars > 0 ? max_entry_chars : k_default_max_entry_chars)
+{}
+
+/**
+ * @brief Feeds one line into the assembler.
+ * @param parsed The line parsed with the file's parser (empty level = no match).
+ * @param raw_line The raw line text, used when the line is a continuation.
+ * @param completed Output list; receives the previous entry once a new one starts.
+ * @param raw_line_utf8 The bytes raw_line was decoded from (see LogLineReader::get_line_utf8()),
+ * or empty to encode raw_line instead.
+ */
+auto LogEntryAssembler::add_line(const LogEntry& parsed, const QString& raw_line,
+                                 QVector<LogEntry>& completed, QByteArrayView raw_line_utf8)
+    -> void
+{
+    const bool starts_entry = !parsed.get_level().isEmpty();
+
+    if (starts_entry)
+    {
+        complete_pending(completed);
+
+        m_pending = parsed;
+        m_has_pending = true;
+        intern_extra_fields(m_pending);
+        m_pending_chars = get_utf16_length(parsed.get_message_utf8());
+    }
+    else if (m_has_pending && !raw_line.trimmed().isEmpty() && !m_pending_truncated)
+    {
+        // +1 for the line break inserted when joining.
+        const qsizetype line_chars = raw_line.size() + 1;
+
+        if (m_pending_chars + line_chars <= m_max_entry_chars)
+        {
+            // An empty view for a non-empty line means the reader had to decode it as Latin-1.
+            m_continuation_lines.append(raw_line_utf8.isEmpty() ? raw_line.toUtf8()
+                                                                : raw_line_utf8.toByteArray());
+            m_pending_chars += line_chars;
+        }
+        else
+        {
+            m_continuation_lines.append(QByteArray(k_truncation_marker));
+            m_pending_truncated = true;
+            ++m_truncated_count;
+        }
+    }
+
+    // An overlong continuation line keeps its reference on the entry it belongs to.
+    if (!starts_entry && m_has_pending && parsed.is_truncated() && !m_pending.is_truncated())
+    {
+        m_pending.set_source_range(parsed.get_source_offset(), parsed.get_source_length());
+    }
+}
+
+/**
+ * @brief Flushes the pending entry (if any) at the end of the input.
+ * @param completed Output list receiving the pending entry.
+ */
+auto LogEntryAssembler::finish(QVector<LogEntry>& completed) -> void
+{
+    complete_pending(completed);
+}
+
+/**
+ * @brief Checks whether an entry is waiting for further continuation lines.
+ * @return True if an entry is pending.
+ */
+auto LogEntryAssembler::has_pending() const -> bool
+{
+    return m_has_pending;
+}
+
+/**
+ * @brief Returns the number of entries whose continuation lines were truncated.
+ * @return Truncated entry count.
+ */
+auto LogEntryAssembler::get_truncated_count() const -> qsizetype
+{
+    return m_truncated_count;
+}
+
+/**
+ * @brief Joins the pending continuation lines into the pending entry and emits it.
+ * @param completed Output list receiving the entry.
+ */
+auto LogEntryAssembler::complete_pending(QVector<LogEntry>& completed) -> void
+{
+    if (m_has_pending)
+    {
+        if (!m_continuation_lines.isEmpty())
+        {
+            // Joined in UTF-8, the encoding the entry stores its message in.
+            QByteArray message = m_pending.get_message_utf8();
+            qsizetype total_bytes = message.size();
+
+            for (const auto& line: m_continuation_lines)
+            {
+                total_bytes += line.size() + 1;
+            }
+
+            message.reserve(total_bytes);
+
+            for (const auto& line: m_continuation_lines)
+            {
+                message += '\n';
+                message += line;
+            }
+
+            m_pending.set_message_utf8(message);
+        }
+
+        completed.append(m_pending);
+
+        m_pending = LogEntry();
+        m_has_pending = false;
+        m_continuation_lines.clear();
+        m_pending_chars = 0;
+        m_pending_truncated = false;
+    }
+}
+
+/**
+ * @brief Replaces the string extra fields of an entry with their pooled copies.
+ * @param entry The entry.
+ */
+auto LogEntryAssembler::intern_extra_fields(LogEntry& entry) -> void
+{
+    const auto extra_fields = entry.get_extra_fields();
+
+    for (const auto& field: extra_fields)
+    {
+        if (field.second.typeId() == QMetaType::QString)
+        {
+            const QString text = field.second.toString();
+            auto it = m_string_pool.constFind(text);
+
+            if (it != m_string_pool.constEnd())
+            {
+                entry.set_extra_field(field.first, it.value());
+            }
+            else if (m_string_pool.size() < k_max_interned_strings)
+            {
+                m_string_pool.insert(text, text);
+            }
+        }
+    }
+}
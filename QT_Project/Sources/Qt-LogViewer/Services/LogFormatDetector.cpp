@@ -0,0 +1,259 @@
+/**
+ * @file LogFormatDetector.cpp
+ * @brief This file contains the implementation of the LogFormatDetector class.
+ */
+
+#include "Qt-LogViewer/Services/LogFormatDetector.h"
+
+#include <QFile>
+#include <QFileInfo>
+#include <QMutexLocker>
+
+#include "Qt-LogViewer/Services/LogParser.h"
+
+namespace
+{
+// Bytes read from the head and from the middle of a file.
+constexpr qint64 k_sample_bytes = 8 * 1024;
+
+// Upper bound of lines scored per sample region.
+constexpr qsizetype k_max_lines_per_sample = 64;
+
+/**
+ * @brief Splits a raw sample into lines, dropping empty ones and an optional partial first line.
+ * @param bytes The raw sample bytes.
+ * @param skip_first_line Whether the first (likely partial) line should be dropped.
+ * @param lines Output list the lines are appended to.
+ */
+auto append_sample_lines(const QByteArray& bytes, bool skip_first_line, QVector<QString>& lines)
+    -> void
+{
+    const QList<QByteArray> raw_lines = bytes.split('\n');
+    // The last line of a sample is cut off at the sample boundary unless the file ends there.
+    const qsizetype usable = raw_lines.size() > 1 ? raw_lines.size() - 1 : raw_lines.size();
+    qsizetype appended = 0;
+
+    for (qsizetype i = skip_first_line ? 1 : 0; i < usable && appended < k_max_lines_per_sample;
+         ++i)
+    {
+        const QString line = QString::fromUtf8(raw_lines.at(i)).trimmed();
+
+        if (!line.isEmpty())
+        {
+            lines.append(line);
+            ++appended;
+        }
+    }
+}
+}  // namespace
+
+/**
+ * @brief Constructs a LogFormatDetector.
+ * @param primary_format The configured format, preferred on ties and used as fallback.
+ */
+LogFormatDetector::LogFormatDetector(const QString& primary_format)
+    : m_primary_format(primary_format)
+{
+    m_formats.append(primary_format);
+
+    const QVector<QString> builtin_formats = get_builtin_formats();
+    for (const auto& format: builtin_formats)
+    {
+        if (!m_formats.contains(format))
+        {
+            m_formats.append(format);
+        }
+    }
+}
+
+/**
+ * @brief Returns the built-in format library.
+ * @return List of format strings.
+ */
+auto LogFormatDetector::get_builtin_formats() -> QVector<QString>
+{
+    return QVector<QString>{
+        QStringLiteral("{timestamp} {level} {message} {app_name} [{file}:{line} ({function})]"),
+        QStringLiteral("{timestamp} {level} {message} {app_name}"),
+        QStringLiteral("{timestamp} [{level}] {message}"),
+        QStringLiteral("[{timestamp}] [{level}] {message}"),
+        QStringLiteral("{timestamp} [{thread}] {level} {logger} - {message}"),
+        QStringLiteral("{timestamp} {level} [{thread}] {logger} - {message}")};
+}
+
+/**
+ * @brief Adds user-defined formats to the library (duplicates are ignored).
+ *
+ * Clears the detection cache, since earlier decisions may no longer be the best match.
+ *
+ * @param formats Format strings (e.g. "{timestamp} [{thread}] {level} {message}").
+ */
+auto LogFormatDetector::add_formats(const QVector<QString>& formats) -> void
+{
+    QMutexLocker locker(&m_mutex);
+
+    for (const auto& format: formats)
+    {
+        const QString trimmed = format.trimmed();
+
+        if (!trimmed.isEmpty() && !m_formats.contains(trimmed))
+        {
+            m_formats.append(trimmed);
+        }
+    }
+
+    m_cache.clear();
+}
+
+/**
+ * @brief Returns the format library in preference order.
+ * @return List of format strings; the primary format comes first.
+ */
+auto LogFormatDetector::get_formats() const -> QVector<QString>
+{
+    QMutexLocker locker(&m_mutex);
+    return m_formats;
+}
+
+/**
+ * @brief Returns the primary (fallback) format.
+ * @return The primary format string.
+ */
+auto LogFormatDetector::get_primary_format() const -> QString
+{
+    return m_primary_format;
+}
+
+/**
+ * @brief Detects the best matching format for the given file.
+ * @param file_path The path to the log file.
+ * @return The detected format, or the primary format if nothing matches.
+ */
+auto LogFormatDetector::detect_format(const QString& file_path) const -> QString
+{
+    QString format = m_primary_format;
+    const QFileInfo info(file_path);
+
+    if (info.exists() && info.isFile())
+    {
+        const QString key = info.absoluteFilePath();
+        const qint64 size = info.size();
+        const QDateTime last_modified = info.lastModified();
+        bool cached = false;
+
+        {
+            QMutexLocker locker(&m_mutex);
+            const auto it = m_cache.constFind(key);
+
+            if (it != m_cache.constEnd() && it->size == size && it->last_modified == last_modified)
+            {
+                format = it->format;
+                cached = true;
+            }
+        }
+
+        if (!cached)
+        {
+            const QString detected = detect_format_for_lines(read_sample_lines(file_path));
+
+            if (!detected.isEmpty())
+            {
+                format = detected;
+            }
+
+            QMutexLocker locker(&m_mutex);
+            m_cache.insert(key, CachedDetection{size, last_modified, format});
+        }
+    }
+
+    return format;
+}
+
+/**
+ * @brief Scores every format of the library against the given lines.
+ * @param lines Sample lines (empty lines are ignored).
+ * @return The best matching format, or an empty string if no line matched at all.
+ */
+auto LogFormatDetector::detect_format_for_lines(const QVector<QString>& lines) const -> QString
+{
+    QString best_format;
+    int best_matches = 0;
+    qsizetype best_field_count = 0;
+    const QVector<QString> formats = get_formats();
+
+    for (const auto& format: formats)
+    {
+        const LogParser parser(format);
+        const qsizetype field_count = parser.get_field_order().fields.size();
+        int matches = 0;
+
+        for (const auto& line: lines)
+        {
+            if (!line.isEmpty() && !parser.parse_line(line, QString()).get_level().isEmpty())
+            {
+                ++matches;
+            }
+        }
+
+        // All candidates see the same lines, so comparing match counts compares match rates.
+        const bool better =
+            (matches > best_matches) || (matches > 0 && matches == best_matches &&
+                                         field_count > best_field_count);
+
+        if (better)
+        {
+            best_format = format;
+            best_matches = matches;
+            best_field_count = field_count;
+        }
+    }
+
+    return best_format;
+}
+
+/**
+ * @brief Drops all cached detection results.
+ */
+auto LogFormatDetector::clear_cache() -> void
+{
+    QMutexLocker locker(&m_mutex);
+    m_cache.clear();
+}
+
+/**
+ * @brief Reads the sample lines (head and middle of the file) used for detection.
+ * @param file_path The path to the log file.
+ * @return The sampled lines.
+ */
+auto LogFormatDetector::read_sample_lines(const QString& file_path) -> QVector<QString>
+{
+    QVector<QString> lines;
+    QFile file(file_path);
+
+    if (file.open(QIODevice::ReadOnly))
+    {
+        const qint64 size = file.size();
+        QByteArray head = file.read(k_sample_bytes);
+
+        // Strip a UTF-8 BOM so the first line can match anchored patterns.
+        if (head.startsWith("\xEF\xBB\xBF"))
+        {
+            head.remove(0, 3);
+        }
+
+        // A head that covers the whole file has no partial last line.
+        if (size <= k_sample_bytes)
+        {
+            head.append('\n');
+        }
+        append_sample_lines(head, false, lines);
+
+        // Sample the middle as well, so files with a differing preamble still detect correctly.
+        if (size > 2 * k_sample_bytes && file.seek(size / 2))
+        {
+            append_sample_lines(file.read(k_sample_bytes), true, lines);
+        }
+    }
+
+    return lines;
+}
@@ -0,0 +1,452 @@
+/**
+ * @file LogLineReader.cpp
+ * @brief This file contains the implementation of the LogLineReader class.
+ */
+
+#include "Qt-LogViewer/Services/LogLineReader.h"
+
+#include <cstring>
+
+namespace
+{
+// Enough bytes to recognize any BOM (UTF-32 has the longest one).
+constexpr qint64 k_bom_peek_bytes = 4;
+
+// Size of the UTF-8 BOM (EF BB BF).
+constexpr qint64 k_utf8_bom_size = 3;
+
+// Bytes read from the device at once; large enough that splitting dominates the per-read cost.
+constexpr qsizetype k_block_size = 256 * 1024;
+
+/**
+ * @brief Returns the length of a prefix that does not split a UTF-8 sequence.
+ * @param data The UTF-8 bytes.
+ * @param length The number of bytes.
+ * @param max_length The maximum prefix length.
+ * @return The prefix length.
+ */
+auto utf8_prefix_length(const char* data, qsizetype length, qsizetype max_length) -> qsizetype
+{
+    qsizetype end = qMin(length, max_length);
+
+    // Continuation bytes (10xxxxxx) belong to the sequence started before them.
+    while (end < length && end > 0 && (static_cast<unsigned char>(data[end]) & 0xC0) == 0x80)
+    {
+        --end;
+    }
+
+    return end;
+}
+}  // namespace
+
+/**
+ * @brief Constructs a LogLineReader on an open device and inspects its BOM.
+ * @param device The device to read from (not owned).
+ */
+LogLineReader::LogLineReader(QIODevice* device)
+    : m_device(device), m_decoder(QStringDecoder::Utf8, QStringDecoder::Flag::Stateless)
+{
+    if (m_device != nullptr)
+    {
+        const QByteArray head = m_device->peek(k_bom_peek_bytes);
+        const auto encoding = QStringConverter::encodingForData(head);
+
+        if (encoding.has_value() && encoding.value() != QStringConverter::Utf8)
+        {
+            // UTF-16/UTF-32 cannot be split on '\n' bytes; let QTextStream decode it.
+            m_fallback_stream = std::make_unique<QTextStream>(m_device);
+            m_fallback_stream->setAutoDetectUnicode(true);
+        }
+        else if (head.startsWith("\xEF\xBB\xBF"))
+        {
+            m_device->skip(k_utf8_bom_size);
+        }
+
+        m_buffer_base = m_device->pos();
+        m_position = m_buffer_base;
+    }
+}
+
+/**
+ * @brief Reads the next line.
+ * @param line Output for the decoded line without its line ending.
+ * @return True if a line was read, false at the end of the input.
+ */
+auto LogLineReader::read_line(QString& line) -> bool
+{
+    bool read = false;
+    m_line_truncated = false;
+    m_line_utf8 = QByteArrayView();
+
+    if (!m_has_long_line)
+    {
+        // Backed the view of the previous line if that one was overlong.
+        m_long_line_prefix.clear();
+    }
+
+    if (!at_end())
+    {
+        if (m_fallback_stream)
+        {
+            line = m_fallback_stream->readLine();
+            read = true;
+        }
+        else
+        {
+            if (m_next_span >= m_spans.size())
+            {
+                fill_spans();
+            }
+
+            if (m_has_long_line)
+            {
+                // The long line precedes the spans found behind it.
+                line = decode(m_long_line_prefix.constData(), m_long_line_prefix.size());
+                m_line_offset = m_long_line_offset;
+                m_line_length = m_long_line_length;
+                m_line_truncated = true;
+                ++m_truncated_line_count;
+                m_position = m_long_line_end;
+                m_has_long_line = false;
+                read = true;
+            }
+            else if (m_next_span < m_spans.size())
+            {
+                const auto& span = m_spans.at(m_next_span++);
+                line = decode_span(span);
+                m_position = m_buffer_base
+                             + qMin(span.offset + span.length + 1, m_buffer.size());
+                read = true;
+            }
+        }
+    }
+
+    return read;
+}
+
+/**
+ * @brief Checks whether the end of the input has been reached.
+ * @return True if no further line can be read.
+ */
+auto LogLineReader::at_end() const -> bool
+{
+    bool end = true;
+
+    if (m_fallback_stream)
+    {
+        end = m_fallback_stream->atEnd();
+    }
+    else if (m_device != nullptr)
+    {
+        end = m_next_span >= m_spans.size() && m_buffer_end >= m_buffer.size()
+              && (m_device->atEnd() || is_limit_reached());
+    }
+
+    return end;
+}
+
+/**
+ * @brief Returns the device offset behind the last line returned by read_line().
+ * @return The number of bytes consumed.
+ */
+auto LogLineReader::get_position() const -> qint64
+{
+    qint64 position = m_position;
+
+    if (m_fallback_stream && m_device != nullptr)
+    {
+        position = m_device->pos();
+    }
+
+    return position;
+}
+
+/**
+ * @brief Sets the length above which lines are truncated.
+ * @param max_line_bytes The limit in bytes; values <= 0 restore the default.
+ */
+auto LogLineReader::set_max_line_length(qsizetype max_line_bytes) -> void
+{
+    m_max_line_length = max_line_bytes > 0 ? max_line_bytes : k_default_max_line_length;
+}
+
+/**
+ * @brief Returns the length above which lines are truncated.
+ * @return The limit in bytes.
+ */
+auto LogLineReader::get_max_line_length() const -> qsizetype
+{
+    return m_max_line_length;
+}
+
+/**
+ * @brief Limits how far into the device the reader reads.
+ *
+ * The reader then never reads past the offset, even inside an overlong line. A line cut off by
+ * the limit is dropped instead of being returned incomplete. Does not apply to the QTextStream
+ * fallback.
+ *
+ * @param max_offset Device offset to stop at, or a negative value for no limit.
+ */
+auto LogLineReader::set_read_limit(qint64 max_offset) -> void
+{
+    m_read_limit = max_offset;
+}
+
+/**
+ * @brief Checks whether the last line returned by read_line() was truncated.
+ * @return True if the line only holds a prefix of the line on disk.
+ */
+auto LogLineReader::is_line_truncated() const -> bool
+{
+    return m_line_truncated;
+}
+
+/**
+ * @brief Returns the device offset of the last line returned by read_line().
+ *
+ * Like get_line_length(), only tracked for UTF-8 input.
+ *
+ * @return The offset of the line's first byte, or -1 if not tracked.
+ */
+auto LogLineReader::get_line_offset() const -> qint64
+{
+    return m_fallback_stream ? -1 : m_line_offset;
+}
+
+/**
+ * @brief Returns the full length of the last line returned by read_line().
+ * @return The length in bytes on disk, without the line ending.
+ */
+auto LogLineReader::get_line_length() const -> qint64
+{
+    return m_line_length;
+}
+
+/**
+ * @brief Returns the UTF-8 bytes of the last line returned by read_line().
+ *
+ * The view points into the reader's buffer and is only valid until the next call to
+ * read_line().
+ *
+ * @return The bytes the line was decoded from, or an empty view for the QTextStream fallback
+ * and for lines that were not valid UTF-8.
+ */
+auto LogLineReader::get_line_utf8() const -> QByteArrayView
+{
+    return m_line_utf8;
+}
+
+/**
+ * @brief Returns the number of lines that were truncated.
+ * @return Count of lines longer than the limit.
+ */
+auto LogLineReader::get_truncated_line_count() const -> qsizetype
+{
+    return m_truncated_line_count;
+}
+
+/**
+ * @brief Returns the number of lines that were not valid UTF-8.
+ * @return Count of lines decoded as Latin-1.
+ */
+auto LogLineReader::get_invalid_line_count() const -> qsizetype
+{
+    return m_invalid_line_count;
+}
+
+/**
+ * @brief Checks whether the input is read as UTF-8 (no UTF-16/UTF-32 BOM found).
+ * @return True for UTF-8 input.
+ */
+auto LogLineReader::is_utf8() const -> bool
+{
+    return !m_fallback_stream;
+}
+
+/**
+ * @brief Reads blocks until at least one line span is available or the input ends.
+ */
+auto LogLineReader::fill_spans() -> void
+{
+    // All spans were consumed; keep only the incomplete line at the end of the buffer.
+    m_spans.clear();
+    m_next_span = 0;
+    m_buffer.remove(0, m_buffer_end);
+    m_buffer_base += m_buffer_end;
+    m_buffer_end = 0;
+
+    bool exhausted = false;
+
+    while (m_spans.isEmpty() && !m_has_long_line && !exhausted)
+    {
+        const qsizetype old_size = m_buffer.size();
+        m_buffer.resize(old_size + k_block_size);
+        const qint64 bytes_read = read_block(m_buffer.data() + old_size, k_block_size);
+        m_buffer.resize(old_size + qMax<qint64>(bytes_read, 0));
+
+        if (bytes_read <= 0)
+        {
+            // A last line without '\n' is still a line, unless the read limit cut it off.
+            if (!m_buffer.isEmpty() && !is_limit_reached())
+            {
+                m_spans.append(LineSplitter::LineSpan{0, m_buffer.size()});
+            }
+            m_buffer_end = m_buffer.size();
+            m_scan_from = 0;
+            exhausted = true;
+        }
+        else
+        {
+            m_buffer_end = LineSplitter::split_lines(m_buffer.constData(), m_buffer.size(),
+                                                     m_spans, m_scan_from);
+            m_scan_from = m_buffer.size() - m_buffer_end;
+
+            // Without spans the buffer holds one incomplete line; stop growing it.
+            if (m_spans.isEmpty() && m_buffer.size() > m_max_line_length)
+            {
+                skip_long_line();
+            }
+        }
+    }
+}
+
+/**
+ * @brief Keeps a prefix of the overlong line filling the buffer and skips its rest.
+ *
+ * Afterwards the buffer holds the bytes behind the line, already split into spans.
+ */
+auto LogLineReader::skip_long_line() -> void
+{
+    const qsizetype prefix_length =
+        utf8_prefix_length(m_buffer.constData(), m_buffer.size(), m_max_line_length);
+
+    m_long_line_prefix = m_buffer.left(prefix_length);
+    m_long_line_offset = m_buffer_base;
+    qint64 length = m_buffer.size();
+    char last_byte = m_buffer.back();
+
+    m_buffer_base += m_buffer.size();
+    m_buffer.clear();
+
+    bool found_end = false;
+    bool exhausted = false;
+
+    while (!found_end && !exhausted)
+    {
+        m_buffer.resize(k_block_size);
+        const qint64 bytes_read = read_block(m_buffer.data(), k_block_size);
+        m_buffer.resize(qMax<qint64>(bytes_read, 0));
+
+        if (bytes_read <= 0)
+        {
+            exhausted = true;
+        }
+        else
+        {
+            const auto* newline = static_cast<const char*>(
+                std::memchr(m_buffer.constData(), '\n', static_cast<size_t>(m_buffer.size())));
+            const qsizetype line_part =
+                (newline != nullptr) ? newline - m_buffer.constData() : m_buffer.size();
+
+            length += line_part;
+            last_byte = (line_part > 0) ? m_buffer.at(line_part - 1) : last_byte;
+            found_end = (newline != nullptr);
+
+            // Keep only what follows the line ending.
+            const qsizetype consumed = found_end ? line_part + 1 : line_part;
+            m_buffer.remove(0, consumed);
+            m_buffer_base += consumed;
+        }
+    }
+
+    m_long_line_length = (last_byte == '\r') ? length - 1 : length;
+    m_long_line_end = m_buffer_base;
+    m_has_long_line = found_end || !is_limit_reached();
+
+    m_spans.clear();
+    m_next_span = 0;
+    m_buffer_end =
+        LineSplitter::split_lines(m_buffer.constData(), m_buffer.size(), m_spans, 0);
+    m_scan_from = m_buffer.size() - m_buffer_end;
+}
+
+/**
+ * @brief Reads up to a block from the device, stopping at the read limit.
+ * @param data Output buffer.
+ * @param max_size Maximum number of bytes to read.
+ * @return The number of bytes read; 0 at the end of the input or the limit.
+ */
+auto LogLineReader::read_block(char* data, qint64 max_size) -> qint64
+{
+    qint64 size = max_size;
+
+    if (m_read_limit >= 0)
+    {
+        size = qMin(size, qMax<qint64>(m_read_limit - m_device->pos(), 0));
+    }
+
+    return size > 0 ? m_device->read(data, size) : 0;
+}
+
+/**
+ * @brief Checks whether more input exists but lies behind the read limit.
+ * @return True if the limit stopped reading before the end of the device.
+ */
+auto LogLineReader::is_limit_reached() const -> bool
+{
+    return m_read_limit >= 0 && m_device->pos() >= m_read_limit && !m_device->atEnd();
+}
+
+/**
+ * @brief Decodes a line of the buffer, truncated to the line length limit.
+ * @param span The line inside m_buffer.
+ * @return The decoded line without its line ending.
+ */
+auto LogLineReader::decode_span(const LineSplitter::LineSpan& span) -> QString
+{
+    const char* data = m_buffer.constData() + span.offset;
+    qsizetype length = span.length;
+
+    if (length > 0 && data[length - 1] == '\r')
+    {
+        --length;
+    }
+
+    m_line_offset = m_buffer_base + span.offset;
+    m_line_length = length;
+    m_line_truncated = length > m_max_line_length;
+
+    if (m_line_truncated)
+    {
+        length = utf8_prefix_length(data, length, m_max_line_length);
+        ++m_truncated_line_count;
+    }
+
+    return decode(data, length);
+}
+
+/**
+ * @brief Decodes UTF-8 bytes, falling back to Latin-1 for invalid UTF-8.
+ * @param data The bytes.
+ * @param length The number of bytes.
+ * @return The decoded text.
+ */
+auto LogLineReader::decode(const char* data, qsizetype length) -> QString
+{
+    QString line = m_decoder.decode(QByteArrayView(data, length));
+
+    if (m_decoder.hasError())
+    {
+        // Keep every byte instead of inserting replacement characters.
+        line = QString::fromLatin1(data, length);
+        ++m_invalid_line_count;
+        m_decoder.resetState();
+    }
+    else
+    {
+        m_line_utf8 = QByteArrayView(data, length);
+    }
+
+    return line;
+}
@@ -7,9 +7,9 @@
 
 #include <QFile>
 #include <QFileInfo>
-#include <QTextStream>
 #include <QThread>
 
+#include "Qt-LogViewer/Services/LogLineReader.h"
 #include "Qt-LogViewer/Services/LogStreamWorker.h"
 
 /**
@@ -17,9 +17,34 @@
  * @param format_string The log format string for parsing.
  */
 LogLoader::LogLoader(const QString& format_string, QObject* parent)
-    : QObject(parent), m_parser(format_string), m_worker(nullptr), m_worker_thread(nullptr)
+    : QObject(parent),
+      m_parser(format_string),
+      m_format_detector(format_string),
+      m_worker(nullptr),
+      m_worker_thread(nullptr)
 {}
 
+/**
+ * @brief Destroys the LogLoader object, cancelling and joining a running stream.
+ *
+ * The thread is joined directly instead of waiting for streaming_idle() in a nested event
+ * loop: once cancelled, the worker returns at its next token check (before every line) and
+ * quit() ends the thread's event loop right after that (or before it starts, if the worker did
+ * not run yet).
+ */
+LogLoader::~LogLoader()
+{
+    if (m_worker_thread != nullptr)
+    {
+        cancel_async();
+        m_worker_thread->quit();
+        m_worker_thread->wait();
+
+        delete m_worker;
+        m_worker = nullptr;
+    }
+}
+
 /**
  * @brief Loads and parses a single log file.
  * @param file_path The path to the log file.
@@ -28,7 +53,7 @@ LogLoader::LogLoader(const QString& format_string, QObject* parent)
 auto LogLoader::load_log_file(const QString& file_path) const -> QVector<LogEntry>
 {
     QVector<LogEntry> result;
-    result = m_parser.parse_file(file_path);
+    result = parser_for_file(file_path).parse_file(file_path);
     return result;
 }
 
@@ -73,19 +98,21 @@ auto LogLoader::load_logs_by_app(const QVector<QString>& file_paths) const
 auto LogLoader::read_first_log_entry(const QString& file_path) const -> LogEntry
 {
     LogEntry first_entry;
+    const LogParser parser = parser_for_file(file_path);
     QFile file(file_path);
 
-    if (file.open(QIODevice::ReadOnly | QIODevice::Text))
+    if (file.open(QIODevice::ReadOnly))
     {
-        QTextStream in(&file);
+        LogLineReader reader(&file);
+        QString raw_line;
 
-        while (!in.atEnd() && first_entry.get_app_name().isEmpty())
+        while (first_entry.get_app_name().isEmpty() && reader.read_line(raw_line))
         {
-            const QString line = in.readLine().trimmed();
+            const QString line = raw_line.trimmed();
 
             if (!line.isEmpty())
             {
-                const LogEntry entry = m_parser.parse_line(line, file_path);
+                const LogEntry entry = parser.parse_line(line, file_path);
 
                 if (!entry.get_app_name().isEmpty())
                 {
@@ -115,16 +142,20 @@ auto LogLoader::identify_app(const QString& file_path) -> QString
  * @brief Starts asynchronous, streaming load of a single log file.
  * @param file_path The path to the log file.
  * @param batch_size The number of entries per emitted batch.
+ * @param token Token the worker checks for cancellation and reports progress to.
  *
  * Only one streaming operation runs at a time. The next queued file should start
  * on the streaming_idle() signal.
  */
-auto LogLoader::load_log_file_async(const QString& file_path, qsizetype batch_size) -> void
+auto LogLoader::load_log_file_async(const QString& file_path, qsizetype batch_size,
+                                    const TaskToken& token) -> void
 {
     if (m_worker_thread == nullptr)
     {
         m_worker_thread = new QThread(this);
-        m_worker = new LogStreamWorker(m_parser);
+        m_worker = new LogStreamWorker(parser_for_file(file_path), token);
+        m_worker->set_max_line_length(m_max_line_length);
+        m_worker->set_filter(m_filter);
         m_worker->moveToThread(m_worker_thread);
 
         // Forward worker signals.
@@ -176,3 +207,92 @@ auto LogLoader::cancel_async() -> void
         m_worker->cancel();
     }
 }
+
+/**
+ * @brief Sets the length above which streamed lines are truncated.
+ * @param max_line_bytes The limit in bytes; values <= 0 restore the default.
+ */
+auto LogLoader::set_max_line_length(qsizetype max_line_bytes) -> void
+{
+    m_max_line_length =
+        max_line_bytes > 0 ? max_line_bytes : LogLineReader::k_default_max_line_length;
+}
+
+/**
+ * @brief Returns the length above which streamed lines are truncated.
+ * @return The limit in bytes.
+ */
+auto LogLoader::get_max_line_length() const -> qsizetype
+{
+    return m_max_line_length;
+}
+
+/**
+ * @brief Sets the filter streamed batches are evaluated against.
+ * @param spec The filter settings of the target view.
+ */
+auto LogLoader::set_filter(const LogFilter::Spec& spec) -> void
+{
+    m_filter = spec;
+
+    if (m_worker != nullptr)
+    {
+        m_worker->set_filter(spec);
+    }
+}
+
+/**
+ * @brief Returns the filter streamed batches are evaluated against.
+ * @return The filter settings.
+ */
+auto LogLoader::get_filter() const -> LogFilter::Spec
+{
+    return m_filter;
+}
+
+/**
+ * @brief Adds user-defined formats to the format detection library.
+ * @param formats Format strings (e.g. "{timestamp} [{thread}] {level} {message}").
+ */
+auto LogLoader::add_log_formats(const QVector<QString>& formats) -> void
+{
+    m_format_detector.add_formats(formats);
+}
+
+/**
+ * @brief Returns the format detection library in preference order.
+ * @return List of format strings; the configured format comes first.
+ */
+auto LogLoader::get_log_formats() const -> QVector<QString>
+{
+    return m_format_detector.get_formats();
+}
+
+/**
+ * @brief Returns the format used for parsing the given file (detected and cached).
+ * @param file_path The path to the log file.
+ * @return The format string.
+ */
+auto LogLoader::detect_log_format(const QString& file_path) const -> QString
+{
+    return m_format_detector.detect_format(file_path);
+}
+
+/**
+ * @brief Returns a parser for the format detected for the given file.
+ * @param file_path The path to the log file.
+ * @return The parser (the configured parser if the primary format was detected).
+ */
+auto LogLoader::parser_for_file(const QString& file_path) const -> LogParser
+{
+    const QString format = m_format_detector.detect_format(file_path);
+    LogParser parser = m_parser;
+
+    if (format != m_format_detector.get_primary_format())
+    {
+        parser = LogParser(format);
+        parser.set_timestamp_formats(m_parser.get_timestamp_formats());
+    }
+
+    return parser;
+}
@@ -7,7 +7,6 @@
 #include "Qt-LogViewer/Services/LogLoadingService.h"
 
 #include <QDebug>
-#include <QEventLoop>
 #include <QFile>
 #include <QIODevice>
 #include <QList>
@@ -32,12 +31,12 @@ LogLoadingService::LogLoadingService(const QString& log_format, QObject* parent)
 }
 
 /**
- * @brief Destructor: cancel and wait for the worker to become idle to avoid QThread crash.
+ * @brief Destructor: cancels streaming; the loader member then joins its worker thread.
  */
 LogLoadingService::~LogLoadingService()
 {
+    m_last_token.cancel();
     m_loader.cancel_async();
-    wait_until_idle(5000);
 }
 
 /**
@@ -47,10 +46,11 @@ LogLoadingService::~LogLoadingService()
 auto LogLoadingService::wire_loader_signals() -> void
 {
     connect(&m_loader, &LogLoader::entry_batch_parsed, this,
-            [this](const QString& file_path, const QVector<LogEntry>& batch) {
+            [this](const QString& file_path, const QVector<LogEntry>& batch,
+                   const LogFilter::BatchVerdicts& verdicts) {
                 qDebug().nospace()
                     << "[Service] batch file=\"" << file_path << "\" count=" << batch.size();
-                emit entry_batch_parsed(file_path, batch);
+                emit entry_batch_parsed(file_path, batch, verdicts);
             });
 
     connect(&m_loader, &LogLoader::progress, this,
@@ -158,19 +158,22 @@ auto LogLoadingService::read_first_log_entry(const QString& file_path) const ->
  *        Emits an error and `streaming_idle` if validation fails.
  * @param file_path Absolute file path to the log file.
  * @param batch_size Number of entries per emitted batch.
+ * @param token Token used for cancellation and progress (also by retries).
  */
-auto LogLoadingService::load_log_file_async(const QString& file_path, qsizetype batch_size) -> void
+auto LogLoadingService::load_log_file_async(const QString& file_path, qsizetype batch_size,
+                                            const TaskToken& token) -> void
 {
     if (validate_file(file_path))
     {
         m_last_stream_file = file_path;
         m_retry_count = 0;
         m_last_batch_size = batch_size;
+        m_last_token = token;
         m_timer.start();
 
         qDebug().nospace() << "Streaming started: " << file_path << " (batch=" << batch_size << ")";
 
-        m_loader.load_log_file_async(file_path, batch_size);
+        m_loader.load_log_file_async(file_path, batch_size, token);
     }
     else
     {
@@ -190,6 +193,60 @@ auto LogLoadingService::cancel_async() -> void
     m_loader.cancel_async();
 }
 
+/**
+ * @brief Sets the length above which streamed lines are truncated.
+ * @param max_line_bytes The limit in bytes; values <= 0 restore the default.
+ */
+auto LogLoadingService::set_max_line_length(qsizetype max_line_bytes) -> void
+{
+    m_loader.set_max_line_length(max_line_bytes);
+}
+
+/**
+ * @brief Returns the length above which streamed lines are truncated.
+ * @return The limit in bytes.
+ */
+auto LogLoadingService::get_max_line_length() const -> qsizetype
+{
+    return m_loader.get_max_line_length();
+}
+
+/**
+ * @brief Sets the filter streamed batches are evaluated against.
+ * @param spec The filter settings of the target view.
+ */
+auto LogLoadingService::set_filter(const LogFilter::Spec& spec) -> void
+{
+    m_loader.set_filter(spec);
+}
+
+/**
+ * @brief Returns the filter streamed batches are evaluated against.
+ * @return The filter settings.
+ */
+auto LogLoadingService::get_filter() const -> LogFilter::Spec
+{
+    return m_loader.get_filter();
+}
+
+/**
+ * @brief Adds user-defined formats to the loader's format detection library.
+ * @param formats Format strings (e.g. "{timestamp} [{thread}] {level} {message}").
+ */
+auto LogLoadingService::add_log_formats(const QVector<QString>& formats) -> void
+{
+    m_loader.add_log_formats(formats);
+}
+
+/**
+ * @brief Returns the loader's format detection library.
+ * @return List of format strings; the configured format comes first.
+ */
+auto LogLoadingService::get_log_formats() const -> QVector<QString>
+{
+    return m_loader.get_log_formats();
+}
+
 /**
  * @brief Sets the maximum number of retries on streaming errors for the same file.
  * @param max_retries Number of retry attempts (0 disables retry).
@@ -237,7 +294,8 @@ auto LogLoadingService::handle_error_and_maybe_retry(const QString& file_path,
                                                      const QString& message) -> void
 {
     const bool same_file = (file_path == m_last_stream_file);
-    const bool can_retry = same_file && (m_retry_count < m_max_retries);
+    const bool can_retry =
+        same_file && (m_retry_count < m_max_retries) && !m_last_token.is_cancelled();
 
     qCritical().nospace() << "Streaming error: " << file_path << " (" << message
                           << ") retry_count=" << m_retry_count << " max_retries=" << m_max_retries;
@@ -249,7 +307,7 @@ auto LogLoadingService::handle_error_and_maybe_retry(const QString& file_path,
         QTimer::singleShot(m_retry_delay_ms, this, [this, file_path]() {
             qDebug().nospace() << "[Service] retry " << m_retry_count << " file=\"" << file_path
                                << "\" (batch=" << m_last_batch_size << ")";
-            m_loader.load_log_file_async(file_path, m_last_batch_size);
+            m_loader.load_log_file_async(file_path, m_last_batch_size, m_last_token);
         });
     }
     else
@@ -272,30 +330,7 @@ auto LogLoadingService::reset_retry_state(const QString& file_path) -> void
         m_last_stream_file.clear();
         m_retry_count = 0;
         m_last_batch_size = 1000;
+        m_last_token = TaskToken();
         qDebug().nospace() << "[Service] reset_retry_state for \"" << file_path << '"';
     }
 }
-
-/**
- * @brief Waits until the loader reports idle or timeout. Used at shutdown to avoid QThread crash.
- * @param timeout_ms Maximum time to wait in milliseconds.
- */
-auto LogLoadingService::wait_until_idle(int timeout_ms) -> void
-{
-    const bool has_pending_stream = !m_last_stream_file.isEmpty();
-    if (has_pending_stream)
-    {
-        QEventLoop loop;
-        QTimer timer;
-        timer.setSingleShot(true);
-
-        auto c1 = connect(this, &LogLoadingService::streaming_idle, &loop, &QEventLoop::quit);
-        auto c2 = connect(&timer, &QTimer::timeout, &loop, &QEventLoop::quit);
-
-        timer.start(timeout_ms);
-        loop.exec();
-
-        disconnect(c1);
-        disconnect(c2);
-    }
-}
@@ -7,9 +7,10 @@
 
 #include <QDateTime>
 #include <QFile>
-#include <QTextStream>
 
 #include "Qt-LogViewer/Models/LogFileInfo.h"
+#include "Qt-LogViewer/Services/LogEntryAssembler.h"
+#include "Qt-LogViewer/Services/LogLineReader.h"
 
 /**
  * @brief Constructs a LogParser object from a format string.
@@ -40,22 +41,28 @@ auto LogParser::parse_file(const QString& file_path) const -> QVector<LogEntry>
     QVector<LogEntry> entries;
 
     QFile file(file_path);
-    bool file_opened = file.open(QIODevice::ReadOnly | QIODevice::Text);
+    bool file_opened = file.open(QIODevice::ReadOnly);
 
     if (file_opened)
     {
-        QTextStream in(&file);
+        LogLineReader reader(&file);
         QString line;
+        LogEntryAssembler assembler;
 
-        while (in.readLineInto(&line))
+        while (reader.read_line(line))
         {
-            LogEntry entry = parse_line(line, file_path);
+            LogEntry parsed = parse_line(line, reader.get_line_utf8(), file_path);
+            parsed.set_line_offset(reader.get_line_offset());
 
-            if (!entry.get_level().isEmpty())
+            if (reader.is_line_truncated())
             {
-                entries.append(entry);
+                parsed.set_source_range(reader.get_line_offset(), reader.get_line_length());
             }
+
+            assembler.add_line(parsed, line, entries, reader.get_line_utf8());
         }
+
+        assembler.finish(entries);
     }
 
     return entries;
@@ -68,8 +75,28 @@ auto LogParser::parse_file(const QString& file_path) const -> QVector<LogEntry>
  * @return The parsed LogEntry, or a default LogEntry if parsing fails.
  */
 auto LogParser::parse_line(const QString& line, const QString& file_path) const -> LogEntry
+{
+    return parse_line(line, QByteArrayView(), file_path);
+}
+
+/**
+ * @brief Parses a single log line, taking the message from the line's UTF-8 bytes.
+ *
+ * For an ASCII line the UTF-16 offsets of the match are byte offsets, so the message is copied
+ * from the bytes instead of being encoded to UTF-8 again. Other lines fall back to encoding the
+ * captured message.
+ *
+ * @param line The log line to parse.
+ * @param line_utf8 The bytes the line was decoded from (see LogLineReader), or empty.
+ * @param file_path The originating file path for contextual metadata.
+ * @return The parsed LogEntry, or a default LogEntry if parsing fails.
+ */
+auto LogParser::parse_line(const QString& line, QByteArrayView line_utf8,
+                           const QString& file_path) const -> LogEntry
 {
     LogEntry result;
+    // One byte per character means every character is ASCII.
+    const bool is_ascii = !line.isEmpty() && line_utf8.size() == line.size();
     QRegularExpressionMatch match = m_pattern.match(line);
 
     if (match.hasMatch())
@@ -77,7 +104,9 @@ auto LogParser::parse_line(const QString& line, const QString& file_path) const
         QString timestamp_value;
         QString level;
         QString message;
+        QByteArray message_utf8;
         QString app_name;
+        QVector<QPair<QString, QVariant>> extra_fields;
         bool has_timestamp = false;
         bool has_message = false;
 
@@ -97,13 +126,27 @@ auto LogParser::parse_line(const QString& line, const QString& file_path) const
             }
             else if (field_name == "message")
             {
-                message = captured_value;
+                const qsizetype start = match.capturedStart(i + 1);
+
+                if (is_ascii && start >= 0)
+                {
+                    message_utf8 =
+                        line_utf8.sliced(start, captured_value.size()).trimmed().toByteArray();
+                }
+                else
+                {
+                    message = captured_value.trimmed();
+                }
                 has_message = true;
             }
             else if (field_name == "app_name")
             {
                 app_name = captured_value;
             }
+            else
+            {
+                extra_fields.append(qMakePair(field_name, to_extra_value(captured_value)));
+            }
         }
 
         QDateTime timestamp;
@@ -113,13 +156,18 @@ auto LogParser::parse_line(const QString& line, const QString& file_path) const
             timestamp = parse_timestamp(timestamp_value);
         }
 
-        if (has_message)
+        LogFileInfo file_info(file_path, app_name);
+        result = LogEntry(timestamp, level, message, file_info);
+
+        if (has_message && is_ascii)
         {
-            message = message.trimmed();
+            result.set_message_utf8(message_utf8);
         }
 
-        LogFileInfo file_info(file_path, app_name);
-        result = LogEntry(timestamp, level, message, file_info);
+        for (const auto& extra_field: extra_fields)
+        {
+            result.set_extra_field(extra_field.first, extra_field.second);
+        }
     }
 
     return result;
@@ -260,3 +308,27 @@ auto LogParser::parse_timestamp(const QString& value) const -> QDateTime
 
     return parsed;
 }
+
+/**
+ * @brief Converts a captured extra placeholder value into a typed value.
+ * @param value The captured text.
+ * @return qlonglong if the value is integral, otherwise the trimmed QString.
+ */
+auto LogParser::to_extra_value(const QString& value) -> QVariant
+{
+    QVariant result;
+    const QString trimmed = value.trimmed();
+    bool is_integer = false;
+    const qlonglong number = trimmed.isEmpty() ? 0 : trimmed.toLongLong(&is_integer);
+
+    if (is_integer)
+    {
+        result = QVariant::fromValue(number);
+    }
+    else
+    {
+        result = trimmed;
+    }
+
+    return result;
+}
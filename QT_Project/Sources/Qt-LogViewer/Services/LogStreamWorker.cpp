@@ -5,18 +5,43 @@
 
 #include "Qt-LogViewer/Services/LogStreamWorker.h"
 
-#include <QFile>
-#include <QTextStream>
+#include <QDebug>
+#include <QMutexLocker>
+
+#include "Qt-LogViewer/Models/LogBaseline.h"
+#include "Qt-LogViewer/Models/LogDedupeSet.h"
+#include "Qt-LogViewer/Services/LogEntryAssembler.h"
+#include "Qt-LogViewer/Services/ReadAheadFile.h"
 
 /**
  * @brief Constructs a LogStreamWorker.
  * @param parser Parser instance (copied) used for line parsing.
+ * @param token Token to check for cancellation and to report progress to.
  * @param parent Optional QObject parent.
  */
-LogStreamWorker::LogStreamWorker(LogParser parser, QObject* parent)
-    : QObject(parent), m_parser(std::move(parser))
+LogStreamWorker::LogStreamWorker(LogParser parser, TaskToken token, QObject* parent)
+    : QObject(parent), m_parser(std::move(parser)), m_token(std::move(token))
+{}
+
+/**
+ * @brief Sets the length above which lines are truncated; call before start().
+ * @param max_line_bytes The limit in bytes; values <= 0 restore the default.
+ */
+auto LogStreamWorker::set_max_line_length(qsizetype max_line_bytes) -> void
+{
+    m_max_line_length =
+        max_line_bytes > 0 ? max_line_bytes : LogLineReader::k_default_max_line_length;
+}
+
+/**
+ * @brief Sets the filter batches are evaluated against, starting with the next batch.
+ * @param spec The filter settings of the target view.
+ */
+auto LogStreamWorker::set_filter(const LogFilter::Spec& spec) -> void
 {
-    m_cancelled.store(false);
+    QMutexLocker locker(&m_filter_mutex);
+    m_filter_spec = spec;
+    m_filter_changed = true;
 }
 
 /**
@@ -27,53 +52,74 @@ LogStreamWorker::LogStreamWorker(LogParser parser, QObject* parent)
 auto LogStreamWorker::start(const QString& file_path, qsizetype batch_size) -> void
 {
     QVector<LogEntry> batch;
-    QFile file(file_path);
+    ReadAheadFile file(file_path);
     qint64 last_progress = 0;
     qint64 total = 0;
 
-    if (file.exists())
-    {
-        total = file.size();
-    }
-
-    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+    if (!file.open(QIODevice::ReadOnly))
     {
         emit error(file_path, QStringLiteral("Failed to open file for reading."));
         emit finished(file_path);
     }
     else
     {
+        total = file.get_file_size();
         emit progress(file_path, 0, total);
+        m_token.set_progress(0, total);
+
+        LogLineReader reader(&file);
+        LogEntryAssembler assembler;
+        LogFilter filter;
+        QString line;
 
-        QTextStream in(&file);
+        reader.set_max_line_length(m_max_line_length);
 
-        while (!in.atEnd() && !m_cancelled.load())
+        while (!m_token.is_cancelled() && reader.read_line(line))
         {
-            const QString line = in.readLine();
-            const LogEntry entry = m_parser.parse_line(line, file_path);
+            LogEntry parsed = m_parser.parse_line(line, reader.get_line_utf8(), file_path);
+            parsed.set_line_offset(reader.get_line_offset());
 
-            if (!entry.get_level().isEmpty())
+            if (reader.is_line_truncated())
             {
-                batch.append(entry);
+                parsed.set_source_range(reader.get_line_offset(), reader.get_line_length());
             }
 
+            assembler.add_line(parsed, line, batch, reader.get_line_utf8());
+
             if (batch.size() >= batch_size)
             {
-                emit entry_batch_parsed(file_path, batch);
+                emit_batch(file_path, batch, filter);
                 batch.clear();
             }
 
-            const qint64 pos = file.pos();
-            if (pos - last_progress >= 1024 * 1024 || (in.atEnd() && pos != last_progress))
+            const qint64 pos = reader.get_position();
+            if (pos - last_progress >= 1024 * 1024 || (reader.at_end() && pos != last_progress))
             {
                 emit progress(file_path, pos, total);
+                m_token.set_progress(pos, total);
                 last_progress = pos;
             }
         }
 
+        // The last entry may still collect continuation lines until the end of input.
+        assembler.finish(batch);
+
         if (!batch.isEmpty())
         {
-            emit entry_batch_parsed(file_path, batch);
+            emit_batch(file_path, batch, filter);
+        }
+
+        if (reader.get_truncated_line_count() > 0)
+        {
+            qWarning().nospace() << "Truncated " << reader.get_truncated_line_count()
+                                 << " line(s) longer than " << m_max_line_length
+                                 << " bytes: " << file_path;
+        }
+
+        if (reader.get_invalid_line_count() > 0)
+        {
+            qWarning().nospace() << "Invalid UTF-8 in " << reader.get_invalid_line_count()
+                                 << " line(s), read as Latin-1: " << file_path;
         }
 
         emit finished(file_path);
@@ -85,5 +131,42 @@ auto LogStreamWorker::start(const QString& file_path, qsizetype batch_size) -> v
  */
 auto LogStreamWorker::cancel() -> void
 {
-    m_cancelled.store(true);
+    m_token.cancel();
+}
+
+/**
+ * @brief Tags and evaluates a batch with the current filter, computes its dedupe keys if the
+ *        view drops duplicates, and emits it.
+ *
+ * Tagging costs one baseline probe per entry; the filter then only reads the tags.
+ *
+ * @param file_path The file being read.
+ * @param batch The batch; its entries get their novelty tags.
+ * @param filter The worker's compiled filter, recompiled if the spec changed.
+ */
+auto LogStreamWorker::emit_batch(const QString& file_path, QVector<LogEntry>& batch,
+                                 LogFilter& filter) -> void
+{
+    {
+        QMutexLocker locker(&m_filter_mutex);
+        if (m_filter_changed)
+        {
+            filter = LogFilter(m_filter_spec);
+            m_filter_changed = false;
+        }
+    }
+
+    if (filter.get_spec().baseline != nullptr)
+    {
+        filter.get_spec().baseline->tag_entries(batch);
+    }
+
+    LogFilter::BatchVerdicts verdicts = filter.evaluate_batch(batch);
+
+    if (filter.get_spec().dedupe)
+    {
+        verdicts.entry_keys = LogDedupeSet::get_keys(batch);
+    }
+
+    emit entry_batch_parsed(file_path, batch, verdicts);
 }
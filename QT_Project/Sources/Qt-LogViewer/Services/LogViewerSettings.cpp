@@ -111,3 +111,57 @@ auto LogViewerSettings::set_mainwindow_windowstate(int state) -> void
 {
     set_value("MainWindow", "windowState", state);
 }
+
+/**
+ * @brief Returns the user-defined log formats used for format detection.
+ * @return List of format strings (e.g. "{timestamp} [{thread}] {level} {message}").
+ */
+auto LogViewerSettings::get_custom_log_formats() -> QStringList
+{
+    return get_value("Parsing", "custom_log_formats", QStringList()).toStringList();
+}
+
+/**
+ * @brief Sets the user-defined log formats used for format detection.
+ * @param formats List of format strings.
+ */
+auto LogViewerSettings::set_custom_log_formats(const QStringList& formats) -> void
+{
+    set_value("Parsing", "custom_log_formats", formats);
+}
+
+/**
+ * @brief Returns the length above which log lines are truncated while parsing.
+ * @return The limit in bytes, or 0 for the built-in default.
+ */
+auto LogViewerSettings::get_max_line_length() -> qsizetype
+{
+    return get_value("Parsing", "max_line_length", 0).toLongLong();
+}
+
+/**
+ * @brief Sets the length above which log lines are truncated while parsing.
+ * @param max_line_bytes The limit in bytes, or 0 for the built-in default.
+ */
+auto LogViewerSettings::set_max_line_length(qsizetype max_line_bytes) -> void
+{
+    set_value("Parsing", "max_line_length", static_cast<qlonglong>(max_line_bytes));
+}
+
+/**
+ * @brief Returns whether lines repeated across the files of a view are skipped.
+ * @return True if duplicates across files are dropped while loading.
+ */
+auto LogViewerSettings::get_dedupe_overlapping_files() -> bool
+{
+    return get_value("Parsing", "dedupe_overlapping_files", false).toBool();
+}
+
+/**
+ * @brief Sets whether lines repeated across the files of a view are skipped.
+ * @param enabled True to drop duplicates across files while loading.
+ */
+auto LogViewerSettings::set_dedupe_overlapping_files(bool enabled) -> void
+{
+    set_value("Parsing", "dedupe_overlapping_files", enabled);
+}
@@ -0,0 +1,405 @@
+/**
+ * @file ReadAheadFile.cpp
+ * @brief This file contains the implementation of the ReadAheadFile class.
+ */
+
+#include "Qt-LogViewer/Services/ReadAheadFile.h"
+
+#include <QElapsedTimer>
+#include <QMutexLocker>
+#include <QThread>
+
+#include <cstring>
+
+#if defined(Q_OS_LINUX) || defined(Q_OS_MACOS)
+#include <fcntl.h>
+#endif
+
+namespace
+{
+// Fewer buffers than this cannot overlap reading one with consuming another.
+constexpr int k_min_buffer_count = 2;
+
+/**
+ * @brief Tells the OS that the file will be read sequentially once.
+ * @param handle The native file descriptor.
+ */
+auto advise_sequential(int handle) -> void
+{
+#if defined(Q_OS_LINUX)
+    if (handle >= 0)
+    {
+        // Doubles the kernel read-ahead window; a hint only, failures are harmless.
+        static_cast<void>(::posix_fadvise(handle, 0, 0, POSIX_FADV_SEQUENTIAL));
+    }
+#elif defined(Q_OS_MACOS)
+    if (handle >= 0)
+    {
+        static_cast<void>(::fcntl(handle, F_RDAHEAD, 1));
+    }
+#else
+    // Windows picks sequential read-ahead from the access pattern.
+    Q_UNUSED(handle);
+#endif
+}
+}  // namespace
+
+/**
+ * @brief Constructs a ReadAheadFile.
+ * @param file_path The file to read.
+ * @param buffer_count Number of buffers in the pool (at least 2).
+ * @param buffer_size Size of each buffer in bytes.
+ * @param parent Optional QObject parent.
+ */
+ReadAheadFile::ReadAheadFile(QString file_path, int buffer_count, qsizetype buffer_size,
+                             QObject* parent)
+    : QIODevice(parent),
+      m_file(std::move(file_path)),
+      m_buffer_count(qMax(buffer_count, k_min_buffer_count)),
+      m_buffer_size(qMax<qsizetype>(buffer_size, 1))
+{}
+
+/**
+ * @brief Stops the reader thread and closes the file.
+ */
+ReadAheadFile::~ReadAheadFile()
+{
+    if (isOpen())
+    {
+        ReadAheadFile::close();
+    }
+}
+
+/**
+ * @brief Opens the file and starts the reader thread.
+ * @param mode Must be QIODevice::ReadOnly (optionally with Unbuffered).
+ * @return True if the file could be opened.
+ */
+auto ReadAheadFile::open(QIODevice::OpenMode mode) -> bool
+{
+    bool opened = false;
+
+    if (isOpen() || mode.testFlag(QIODevice::WriteOnly))
+    {
+        setErrorString(QStringLiteral("ReadAheadFile only supports reading once."));
+    }
+    else if (!m_file.open(QIODevice::ReadOnly | QIODevice::Unbuffered))
+    {
+        setErrorString(m_file.errorString());
+    }
+    else
+    {
+        m_file_size = m_file.size();
+        advise_sequential(m_file.handle());
+
+        m_buffers.clear();
+        m_free_buffers.clear();
+        for (int i = 0; i < m_buffer_count; ++i)
+        {
+            m_buffers.append(QByteArray(m_buffer_size, Qt::Uninitialized));
+            m_free_buffers.append(i);
+        }
+        m_filled_buffers.clear();
+        m_reader_done = false;
+        m_read_failed = false;
+        m_stop_requested = false;
+        m_read_error.clear();
+        m_stats = Stats();
+        m_current = FilledBuffer();
+        m_current_pos = 0;
+        m_bytes_consumed = 0;
+
+        opened = QIODevice::open(mode);
+
+        if (opened)
+        {
+            m_reader = QThread::create([this]() { run_reader(); });
+            m_reader->start();
+        }
+        else
+        {
+            m_file.close();
+        }
+    }
+
+    return opened;
+}
+
+/**
+ * @brief Stops the reader thread and closes the file.
+ */
+auto ReadAheadFile::close() -> void
+{
+    stop_reader();
+    m_file.close();
+    QIODevice::close();
+
+    // Release the pool; a closed device must not keep megabytes alive.
+    m_buffers.clear();
+    m_free_buffers.clear();
+    m_filled_buffers.clear();
+    m_current = FilledBuffer();
+    m_current_pos = 0;
+}
+
+/**
+ * @brief Returns true: positions are not seekable.
+ * @return Always true.
+ */
+auto ReadAheadFile::isSequential() const -> bool
+{
+    return true;
+}
+
+/**
+ * @brief Checks whether all bytes of the file have been consumed.
+ * @return True at the end of the file.
+ */
+auto ReadAheadFile::atEnd() const -> bool
+{
+    bool end = !isOpen();
+
+    if (!end && QIODevice::bytesAvailable() == 0 && m_current_pos >= m_current.size)
+    {
+        QMutexLocker locker(&m_mutex);
+        end = !wait_for_filled_buffer();
+    }
+
+    return end;
+}
+
+/**
+ * @brief Returns the bytes that can be read without waiting for the reader thread.
+ * @return The number of bytes.
+ */
+auto ReadAheadFile::bytesAvailable() const -> qint64
+{
+    qint64 available = QIODevice::bytesAvailable() + (m_current.size - m_current_pos);
+
+    QMutexLocker locker(&m_mutex);
+    for (const auto& filled: m_filled_buffers)
+    {
+        available += filled.size;
+    }
+
+    return available;
+}
+
+/**
+ * @brief Returns the number of bytes read by the user of the device.
+ * @return The position in the file.
+ */
+auto ReadAheadFile::pos() const -> qint64
+{
+    // Bytes peeked or buffered by QIODevice have been copied out but not read yet.
+    return m_bytes_consumed - QIODevice::bytesAvailable();
+}
+
+/**
+ * @brief Returns the size of the file when it was opened.
+ * @return The size in bytes.
+ */
+auto ReadAheadFile::get_file_size() const -> qint64
+{
+    return m_file_size;
+}
+
+/**
+ * @brief Returns the stall counters of the reader and the consumer.
+ * @return A consistent copy of the counters.
+ */
+auto ReadAheadFile::get_stats() const -> Stats
+{
+    QMutexLocker locker(&m_mutex);
+    return m_stats;
+}
+
+/**
+ * @brief Copies data from the filled buffers, waiting for the reader if none is filled.
+ * @param data Destination.
+ * @param max_size Maximum number of bytes to copy.
+ * @return The number of bytes copied, 0 at the end of the file, -1 on a read error.
+ */
+auto ReadAheadFile::readData(char* data, qint64 max_size) -> qint64
+{
+    qint64 copied = 0;
+    bool finished = false;
+
+    while (copied < max_size && !finished)
+    {
+        if (m_current_pos < m_current.size)
+        {
+            const qint64 count = qMin<qint64>(max_size - copied, m_current.size - m_current_pos);
+            std::memcpy(data + copied, m_buffers.at(m_current.index).constData() + m_current_pos,
+                        static_cast<size_t>(count));
+            copied += count;
+            m_current_pos += count;
+            m_bytes_consumed += count;
+        }
+        else
+        {
+            // Only wait for the reader if nothing was copied yet; otherwise return what we have.
+            finished = copied > 0 || !acquire_next_buffer();
+        }
+    }
+
+    if (copied == 0)
+    {
+        QMutexLocker locker(&m_mutex);
+        if (m_read_failed)
+        {
+            setErrorString(m_read_error);
+            copied = -1;
+        }
+    }
+
+    return copied;
+}
+
+/**
+ * @brief Rejects writes; the device is read-only.
+ * @return Always -1.
+ */
+auto ReadAheadFile::writeData(const char* /*data*/, qint64 /*max_size*/) -> qint64
+{
+    return -1;
+}
+
+/**
+ * @brief Reader thread: fills free buffers until the file ends or stop is requested.
+ */
+auto ReadAheadFile::run_reader() -> void
+{
+    bool running = true;
+
+    while (running)
+    {
+        int index = -1;
+
+        {
+            QMutexLocker locker(&m_mutex);
+
+            if (m_free_buffers.isEmpty() && !m_stop_requested)
+            {
+                // Backpressure: all buffers are filled, the consumer is the bottleneck.
+                QElapsedTimer timer;
+                timer.start();
+                ++m_stats.reader_stalls;
+
+                while (m_free_buffers.isEmpty() && !m_stop_requested)
+                {
+                    m_buffer_freed.wait(&m_mutex);
+                }
+
+                m_stats.reader_stall_ns += timer.nsecsElapsed();
+            }
+
+            if (!m_stop_requested)
+            {
+                index = m_free_buffers.takeFirst();
+            }
+        }
+
+        if (index < 0)
+        {
+            running = false;
+        }
+        else
+        {
+            // The pool itself is never resized while the reader runs, so no lock is needed here.
+            const qint64 bytes_read = m_file.read(m_buffers[index].data(), m_buffer_size);
+
+            QMutexLocker locker(&m_mutex);
+
+            if (bytes_read > 0)
+            {
+                m_filled_buffers.enqueue(FilledBuffer{index, bytes_read});
+                m_stats.bytes_read += bytes_read;
+            }
+            else
+            {
+                m_free_buffers.append(index);
+                m_read_failed = bytes_read < 0;
+                m_read_error = m_read_failed ? m_file.errorString() : QString();
+                running = false;
+            }
+
+            m_buffer_filled.wakeAll();
+        }
+    }
+
+    QMutexLocker locker(&m_mutex);
+    m_reader_done = true;
+    m_buffer_filled.wakeAll();
+}
+
+/**
+ * @brief Returns the current buffer to the pool and takes the next filled one.
+ * @return False at the end of the file or on a read error.
+ */
+auto ReadAheadFile::acquire_next_buffer() -> bool
+{
+    QMutexLocker locker(&m_mutex);
+
+    if (m_current.index >= 0)
+    {
+        m_free_buffers.append(m_current.index);
+        m_buffer_freed.wakeOne();
+    }
+
+    m_current = FilledBuffer();
+    m_current_pos = 0;
+
+    const bool acquired = wait_for_filled_buffer();
+
+    if (acquired)
+    {
+        m_current = m_filled_buffers.dequeue();
+    }
+
+    return acquired;
+}
+
+/**
+ * @brief Waits until a filled buffer is queued or the reader is done; m_mutex is held.
+ * @return True if a filled buffer is queued.
+ */
+auto ReadAheadFile::wait_for_filled_buffer() const -> bool
+{
+    if (m_filled_buffers.isEmpty() && !m_reader_done)
+    {
+        // Starvation: the reader has not caught up, storage is the bottleneck.
+        QElapsedTimer timer;
+        timer.start();
+        ++m_stats.consumer_stalls;
+
+        while (m_filled_buffers.isEmpty() && !m_reader_done)
+        {
+            m_buffer_filled.wait(&m_mutex);
+        }
+
+        m_stats.consumer_stall_ns += timer.nsecsElapsed();
+    }
+
+    return !m_filled_buffers.isEmpty();
+}
+
+/**
+ * @brief Stops and joins the reader thread.
+ */
+auto ReadAheadFile::stop_reader() -> void
+{
+    if (m_reader != nullptr)
+    {
+        {
+            QMutexLocker locker(&m_mutex);
+            m_stop_requested = true;
+            m_buffer_freed.wakeAll();
+        }
+
+        // At most one read() is in flight, so this returns after one buffer at worst.
+        m_reader->wait();
+        delete m_reader;
+        m_reader = nullptr;
+    }
+}
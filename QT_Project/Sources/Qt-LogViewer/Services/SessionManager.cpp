@@ -3,8 +3,11 @@
 #include <QDateTime>
 #include <QFileInfo>
 #include <QJsonArray>
+#include <QThread>
+#include <QTimer>
 
-// Concrete include for forward-declared repository type
+// Concrete includes for forward-declared types
+#include "Qt-LogViewer/Services/SessionPersistenceWorker.h"
 #include "Qt-LogViewer/Services/SessionRepository.h"
 
 namespace
@@ -26,6 +29,12 @@ constexpr auto k_session_name_key = "name";
 constexpr auto k_created_at_key = "created_at";
 constexpr auto k_session_last_opened_key = "last_opened";
 
+// Session document fields.
+constexpr auto k_session_doc_name_key = "name";
+
+// Debounce delay between the last change and the background write.
+constexpr int k_default_flush_delay_ms = 750;
+
 /**
  * @brief Parses an ISO datetime string to QDateTime (UTC if 'Z' present).
  * @param s String in ISO 8601 format.
@@ -55,17 +64,44 @@ auto to_iso_datetime(const QDateTime& dt) -> QString
 
 /**
  * @brief Constructs a SessionManager with a given repository and optional parent.
- * @param repository Persistence repository (owned by this manager).
+ * @param repository Persistence repository; must not have a QObject parent.
  * @param parent Optional QObject parent.
  */
-SessionManager::SessionManager(SessionRepository* repository, QObject* parent)
+SessionManager::SessionManager(std::unique_ptr<SessionRepository> repository, QObject* parent)
     : QObject(parent),
-      m_repository(repository),
+      m_repository(std::move(repository)),
       m_recent_files(),
       m_recent_sessions(),
       m_last_session_id(),
-      m_current_session_id()
-{}
+      m_current_session_id(),
+      m_flush_timer(new QTimer(this)),
+      m_writer_thread(new QThread(this))
+{
+    // The repository outlives the writer: it is destroyed after the destructor's final flush.
+    Q_ASSERT(m_repository == nullptr || m_repository->parent() == nullptr);
+
+    m_flush_timer->setSingleShot(true);
+    m_flush_timer->setInterval(k_default_flush_delay_ms);
+    connect(m_flush_timer, &QTimer::timeout, this, &SessionManager::write_pending);
+
+    m_writer = new SessionPersistenceWorker(m_repository.get());
+    m_writer->moveToThread(m_writer_thread);
+    m_writer_thread->start();
+}
+
+/**
+ * @brief Flushes pending writes and stops the writer thread.
+ */
+SessionManager::~SessionManager()
+{
+    flush();
+
+    m_writer_thread->quit();
+    m_writer_thread->wait();
+
+    delete m_writer;
+    m_writer = nullptr;
+}
 
 /**
  * @brief Loads state from repository into memory (recent files and sessions).
@@ -74,57 +110,72 @@ SessionManager::SessionManager(SessionRepository* repository, QObject* parent)
  */
 auto SessionManager::initialize_from_storage() -> void
 {
-    const QJsonObject root = load_root();
+    // Pending changes would otherwise be overwritten by (or overwrite) the stored state.
+    flush();
 
-    m_recent_files.clear();
-    m_recent_sessions.clear();
-    m_last_session_id.clear();
     m_current_session_id.clear();
+    m_session_cache.clear();
 
-    if (root.contains(QString::fromLatin1(k_recent_files_key)))
-    {
-        const QJsonArray arr = root.value(QString::fromLatin1(k_recent_files_key)).toArray();
-        for (const auto& v: arr)
-        {
-            const QJsonObject obj = v.toObject();
-            m_recent_files.append(from_json_recent_file(obj));
-        }
-    }
-
-    if (root.contains(QString::fromLatin1(k_recent_sessions_key)))
-    {
-        const QJsonArray arr = root.value(QString::fromLatin1(k_recent_sessions_key)).toArray();
-        for (const auto& v: arr)
-        {
-            const QJsonObject obj = v.toObject();
-            m_recent_sessions.append(from_json_recent_session(obj));
-        }
-    }
+    // Supersedes a pending asynchronous load.
+    ++m_load_generation;
 
-    if (root.contains(QString::fromLatin1(k_last_session_id_key)))
-    {
-        m_last_session_id = root.value(QString::fromLatin1(k_last_session_id_key)).toString();
-    }
+    apply_root(load_root());
+}
 
-    sort_recent_files_mru();
-    sort_recent_sessions_mru();
+/**
+ * @brief Loads recent files and sessions on the writer thread.
+ *
+ * The recent_*_changed() signals and storage_loaded() are emitted on the owner's thread once
+ * the root document has been read. The current session id and cached sessions are kept.
+ */
+auto SessionManager::initialize_from_storage_async() -> void
+{
+    // The writer processes requests in order, so queued writes land before the read.
+    m_flush_timer->stop();
+    write_pending();
+
+    m_storage_loading = true;
+    const int generation = ++m_load_generation;
+
+    QMetaObject::invokeMethod(
+        m_writer,
+        [this, repository = m_repository.get(), generation]() {
+            const QJsonObject root =
+                (repository != nullptr) ? repository->load_all() : QJsonObject();
+
+            QMetaObject::invokeMethod(
+                this, [this, root, generation]() { handle_root_loaded(root, generation); },
+                Qt::QueuedConnection);
+        },
+        Qt::QueuedConnection);
+}
 
-    emit recent_log_files_changed(m_recent_files);
-    emit recent_sessions_changed(m_recent_sessions);
+/**
+ * @brief Checks whether the stored recent lists have been applied.
+ * @return False while an asynchronous load is pending.
+ */
+auto SessionManager::is_storage_loaded() const -> bool
+{
+    return !m_storage_loading;
 }
 
 /**
  * @brief Returns the list of recent log files.
+ *
+ * Waits for a pending asynchronous load, so the stored items are never missed.
+ *
  * @return Vector of RecentLogFileRecord.
  */
-auto SessionManager::get_recent_log_files() const -> QVector<RecentLogFileRecord>
+auto SessionManager::get_recent_log_files() -> QVector<RecentLogFileRecord>
 {
+    ensure_storage_loaded();
+
     QVector<RecentLogFileRecord> items = m_recent_files;
     return items;
 }
 
 /**
- * @brief Adds/updates a recent log file record and persists the root document.
+ * @brief Adds/updates a recent log file record and schedules a root write.
  * @param file_info LogFileInfo from which file_path and app_name are derived.
  *
  * Behavior:
@@ -134,42 +185,49 @@ auto SessionManager::get_recent_log_files() const -> QVector<RecentLogFileRecord
  */
 auto SessionManager::add_recent_log_file(const LogFileInfo& file_info) -> void
 {
+    ensure_storage_loaded();
+
     RecentLogFileRecord rec{file_info.get_file_path(), file_info.get_app_name(),
                             QDateTime::currentDateTime()};
     upsert_recent_file(rec);
     sort_recent_files_mru();
 
-    const QJsonObject root = make_root_from_current();
-    persist_root(root);
+    mark_root_dirty();
 
     emit recent_log_files_changed(m_recent_files);
 }
 
 /**
- * @brief Clears the recent log files list and persists the change.
+ * @brief Clears the recent log files list and schedules a root write.
  */
 auto SessionManager::clear_recent_log_files() -> void
 {
+    ensure_storage_loaded();
+
     m_recent_files.clear();
 
-    const QJsonObject root = make_root_from_current();
-    persist_root(root);
+    mark_root_dirty();
 
     emit recent_log_files_changed(m_recent_files);
 }
 
 /**
  * @brief Returns the list of recent sessions metadata.
+ *
+ * Waits for a pending asynchronous load, so the stored items are never missed.
+ *
  * @return Vector of RecentSessionRecord.
  */
-auto SessionManager::get_recent_sessions() const -> QVector<RecentSessionRecord>
+auto SessionManager::get_recent_sessions() -> QVector<RecentSessionRecord>
 {
+    ensure_storage_loaded();
+
     QVector<RecentSessionRecord> items = m_recent_sessions;
     return items;
 }
 
 /**
- * @brief Saves or updates a session metadata entry and persists the root document.
+ * @brief Saves or updates a session metadata entry and schedules a root write.
  * @param session_id Unique identifier of the session.
  * @param name Human-readable session name.
  * @param is_open_update If true, updates last_opened; if false, ensures created_at exists.
@@ -178,17 +236,23 @@ auto SessionManager::get_recent_sessions() const -> QVector<RecentSessionRecord>
  * - If the session id exists, update its name and timestamps accordingly.
  * - If not, create a new record with timestamps.
  * - Most recent sessions appear first.
+ * - Nothing is written or emitted if the record does not change.
  */
 auto SessionManager::upsert_session_metadata(const QString& session_id, const QString& name,
                                              bool is_open_update) -> void
 {
+    ensure_storage_loaded();
+
     const QDateTime now = QDateTime::currentDateTime();
     bool found = false;
+    bool changed = false;
 
     for (auto& s: m_recent_sessions)
     {
         if (s.id == session_id)
         {
+            changed = changed || (s.name != name) || is_open_update || !s.created_at.isValid();
+
             s.name = name;
             if (is_open_update)
             {
@@ -206,30 +270,45 @@ auto SessionManager::upsert_session_metadata(const QString& session_id, const QS
     {
         RecentSessionRecord rec{session_id, name, now, is_open_update ? now : QDateTime()};
         upsert_recent_session(rec);
+        changed = true;
     }
 
-    sort_recent_sessions_mru();
+    if (changed)
+    {
+        sort_recent_sessions_mru();
 
-    const QJsonObject root = make_root_from_current();
-    persist_root(root);
+        mark_root_dirty();
 
-    emit recent_sessions_changed(m_recent_sessions);
+        emit recent_sessions_changed(m_recent_sessions);
+    }
 }
 
 /**
- * @brief Deletes a session JSON file and removes its metadata entry, then persists root.
+ * @brief Deletes a session JSON file and removes its metadata entry, then schedules a root write.
+ *
+ * Waits for queued writes of the session to complete first, so a pending snapshot cannot
+ * recreate the file afterwards.
+ *
  * @param session_id The session identifier.
  * @return True if file existed and metadata entry was removed; false otherwise.
  */
 auto SessionManager::delete_session(const QString& session_id) -> bool
 {
+    ensure_storage_loaded();
+
     const bool removed_meta = remove_recent_session_by_id(session_id);
-    const bool removed_file = m_repository != nullptr && m_repository->delete_session(session_id);
+    const bool removed_pending = m_dirty_session_ids.remove(session_id);
+    m_session_cache.remove(session_id);
+
+    // Journal lines of this session may still be queued on the writer thread.
+    wait_for_writer();
+
+    const bool removed_file =
+        (m_repository != nullptr && m_repository->delete_session(session_id)) || removed_pending;
 
     if (removed_meta)
     {
-        const QJsonObject root = make_root_from_current();
-        persist_root(root);
+        mark_root_dirty();
         emit recent_sessions_changed(m_recent_sessions);
     }
 
@@ -238,35 +317,139 @@ auto SessionManager::delete_session(const QString& session_id) -> bool
 }
 
 /**
- * @brief Loads a full session JSON object from repository.
+ * @brief Returns a session JSON object, from memory or (first time) from repository.
  * @param session_id The session identifier.
  * @return QJsonObject representing the session, or empty object if not found.
  */
 auto SessionManager::load_session(const QString& session_id) const -> QJsonObject
 {
     QJsonObject obj;
+    const auto it = m_session_cache.constFind(session_id);
 
-    if (m_repository != nullptr)
+    if (it != m_session_cache.constEnd())
+    {
+        obj = it.value();
+    }
+    else if (m_repository != nullptr)
     {
         obj = m_repository->load_session(session_id);
+
+        if (!obj.isEmpty())
+        {
+            m_session_cache.insert(session_id, obj);
+        }
     }
 
     return obj;
 }
 
 /**
- * @brief Saves a full session JSON object under its id (atomic write).
+ * @brief Updates a session JSON object in memory and schedules its write.
  * @param session_id The session identifier.
  * @param session_obj The JSON object to persist.
+ *
+ * If the object equals the in-memory state, the session is not marked dirty. Otherwise the
+ * change (the delta to the in-memory state) is journaled immediately and the new state is
+ * written as snapshot after the debounce delay, both on the writer thread.
  */
 auto SessionManager::save_session(const QString& session_id, const QJsonObject& session_obj) -> void
 {
-    if (m_repository != nullptr)
+    const auto it = m_session_cache.constFind(session_id);
+    const bool changed = (it == m_session_cache.constEnd()) || (it.value() != session_obj);
+
+    if (changed && !session_id.isEmpty())
     {
-        m_repository->save_session(session_id, session_obj);
+        // The cached state is what the snapshot and the journal hold so far; without one the
+        // journal has to record the whole document.
+        const bool has_previous = (it != m_session_cache.constEnd());
+        const QJsonObject previous = has_previous ? it.value() : QJsonObject();
+
+        m_session_cache.insert(session_id, session_obj);
+        m_dirty_session_ids.insert(session_id);
+
+        QMetaObject::invokeMethod(
+            m_writer,
+            [writer = m_writer, session_id, has_previous, previous, session_obj]() {
+                if (has_previous)
+                {
+                    writer->append_journal_delta(session_id, previous, session_obj);
+                }
+                else
+                {
+                    writer->append_journal(session_id, session_obj);
+                }
+            },
+            Qt::QueuedConnection);
+
+        m_flush_timer->start();
     }
 }
 
+/**
+ * @brief Returns the name of a session without touching the file system.
+ * @param session_id The session identifier.
+ * @return The name from the session metadata or the cached session, or empty if unknown.
+ */
+auto SessionManager::get_session_name(const QString& session_id) const -> QString
+{
+    QString name;
+
+    for (const auto& s: m_recent_sessions)
+    {
+        if (s.id == session_id)
+        {
+            name = s.name;
+        }
+    }
+
+    if (name.isEmpty())
+    {
+        name = m_session_cache.value(session_id)
+                   .value(QString::fromLatin1(k_session_doc_name_key))
+                   .toString();
+    }
+
+    return name;
+}
+
+/**
+ * @brief Checks whether a session has changes that are not written yet.
+ * @param session_id The session identifier.
+ * @return True if the session is dirty.
+ */
+auto SessionManager::is_session_dirty(const QString& session_id) const -> bool
+{
+    return m_dirty_session_ids.contains(session_id);
+}
+
+/**
+ * @brief Checks whether any document (root or session) is waiting to be written.
+ * @return True if writes are pending.
+ */
+auto SessionManager::has_pending_writes() const -> bool
+{
+    return m_root_dirty || !m_dirty_session_ids.isEmpty();
+}
+
+/**
+ * @brief Sets the debounce delay for writes.
+ * @param delay_ms Delay in milliseconds after the last change (0 = next event loop turn).
+ */
+auto SessionManager::set_flush_delay(int delay_ms) -> void
+{
+    m_flush_timer->setInterval(qMax(0, delay_ms));
+}
+
+/**
+ * @brief Writes all dirty documents and blocks until the writer thread is idle.
+ */
+auto SessionManager::flush() -> void
+{
+    m_flush_timer->stop();
+    write_pending();
+    wait_for_writer();
+}
+
 /**
  * @brief Returns the current session id in use (in-memory only).
  * @return Current session id or empty string if not set.
@@ -296,24 +479,33 @@ auto SessionManager::has_current_session() const -> bool
 
 /**
  * @brief Returns the last session id stored in the root document (optional).
+ *
+ * Waits for a pending asynchronous load, so the stored id is never missed.
+ *
  * @return Last session id or empty string if not set.
  */
-auto SessionManager::get_last_session_id() const -> QString
+auto SessionManager::get_last_session_id() -> QString
 {
+    ensure_storage_loaded();
+
     QString id = m_last_session_id;
     return id;
 }
 
 /**
- * @brief Sets the last session id in the root document and persists the change.
+ * @brief Sets the last session id in the root document and schedules a root write.
  * @param session_id The session identifier to store.
  */
 auto SessionManager::set_last_session_id(const QString& session_id) -> void
 {
-    m_last_session_id = session_id;
+    ensure_storage_loaded();
+
+    if (m_last_session_id != session_id)
+    {
+        m_last_session_id = session_id;
 
-    const QJsonObject root = make_root_from_current();
-    persist_root(root);
+        mark_root_dirty();
+    }
 }
 
 /**
@@ -417,14 +609,53 @@ auto SessionManager::make_root_from_current() const -> QJsonObject
 }
 
 /**
- * @brief Persists the root JSON document using repository (atomic write).
- * @param root Root object to save.
+ * @brief Marks the root document dirty and (re)starts the debounce timer.
  */
-auto SessionManager::persist_root(const QJsonObject& root) -> void
+auto SessionManager::mark_root_dirty() -> void
 {
-    if (m_repository != nullptr)
+    m_root_dirty = true;
+    m_flush_timer->start();
+}
+
+/**
+ * @brief Hands all dirty documents to the writer thread without waiting.
+ */
+auto SessionManager::write_pending() -> void
+{
+    for (const auto& session_id: std::as_const(m_dirty_session_ids))
     {
-        m_repository->save_all(root);
+        const QJsonObject session_obj = m_session_cache.value(session_id);
+
+        QMetaObject::invokeMethod(
+            m_writer,
+            [writer = m_writer, session_id, session_obj]() {
+                writer->write_session(session_id, session_obj);
+            },
+            Qt::QueuedConnection);
+    }
+    m_dirty_session_ids.clear();
+
+    if (m_root_dirty)
+    {
+        const QJsonObject root = make_root_from_current();
+
+        QMetaObject::invokeMethod(
+            m_writer, [writer = m_writer, root]() { writer->write_root(root); },
+            Qt::QueuedConnection);
+
+        m_root_dirty = false;
+    }
+}
+
+/**
+ * @brief Blocks until the writer thread has processed all queued requests.
+ */
+auto SessionManager::wait_for_writer() const -> void
+{
+    if (m_writer_thread->isRunning() && QThread::currentThread() != m_writer_thread)
+    {
+        // Requests are processed in order, so an empty request marks the end of the queue.
+        QMetaObject::invokeMethod(m_writer, []() {}, Qt::BlockingQueuedConnection);
     }
 }
 
@@ -444,6 +675,81 @@ auto SessionManager::load_root() const -> QJsonObject
     return root;
 }
 
+/**
+ * @brief Replaces the recent lists and the last session id with those of a root document.
+ * @param root The root JSON object.
+ */
+auto SessionManager::apply_root(const QJsonObject& root) -> void
+{
+    m_recent_files.clear();
+    m_recent_sessions.clear();
+    m_last_session_id.clear();
+
+    if (root.contains(QString::fromLatin1(k_recent_files_key)))
+    {
+        const QJsonArray arr = root.value(QString::fromLatin1(k_recent_files_key)).toArray();
+        for (const auto& v: arr)
+        {
+            const QJsonObject obj = v.toObject();
+            m_recent_files.append(from_json_recent_file(obj));
+        }
+    }
+
+    if (root.contains(QString::fromLatin1(k_recent_sessions_key)))
+    {
+        const QJsonArray arr = root.value(QString::fromLatin1(k_recent_sessions_key)).toArray();
+        for (const auto& v: arr)
+        {
+            const QJsonObject obj = v.toObject();
+            m_recent_sessions.append(from_json_recent_session(obj));
+        }
+    }
+
+    if (root.contains(QString::fromLatin1(k_last_session_id_key)))
+    {
+        m_last_session_id = root.value(QString::fromLatin1(k_last_session_id_key)).toString();
+    }
+
+    sort_recent_files_mru();
+    sort_recent_sessions_mru();
+
+    m_storage_loading = false;
+
+    emit recent_log_files_changed(m_recent_files);
+    emit recent_sessions_changed(m_recent_sessions);
+    emit storage_loaded();
+}
+
+/**
+ * @brief Applies a root document read by initialize_from_storage_async().
+ * @param root The root JSON object.
+ * @param generation The load generation the document was requested with.
+ */
+auto SessionManager::handle_root_loaded(const QJsonObject& root, int generation) -> void
+{
+    // A synchronous load in between already applied a newer state.
+    if (m_storage_loading && generation == m_load_generation)
+    {
+        apply_root(root);
+    }
+}
+
+/**
+ * @brief Reads the root synchronously if an asynchronous load is still pending.
+ *
+ * Called before every read or change of the root document, so nothing is read from, applied to
+ * (and later overwritten by, or written over) the empty initial state.
+ */
+auto SessionManager::ensure_storage_loaded() -> void
+{
+    if (m_storage_loading)
+    {
+        // The queued result is dropped by handle_root_loaded() once the flag is reset.
+        wait_for_writer();
+        apply_root(load_root());
+    }
+}
+
 /**
  * @brief Sort recent files by last_opened descending, then by file_name ascending as tiebreaker.
  */
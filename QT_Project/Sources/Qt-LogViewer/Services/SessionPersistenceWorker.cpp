@@ -0,0 +1,79 @@
+/**
+ * @file SessionPersistenceWorker.cpp
+ * @brief Implementation of SessionPersistenceWorker.
+ */
+
+#include "Qt-LogViewer/Services/SessionPersistenceWorker.h"
+
+#include "Qt-LogViewer/Services/SessionRepository.h"
+
+/**
+ * @brief Constructs a SessionPersistenceWorker.
+ * @param repository Repository performing the actual file operations (not owned).
+ * @param parent Optional QObject parent.
+ */
+SessionPersistenceWorker::SessionPersistenceWorker(const SessionRepository* repository,
+                                                   QObject* parent)
+    : QObject(parent), m_repository(repository)
+{}
+
+/**
+ * @brief Writes the root document (recent files, recent sessions, last session id).
+ * @param root The root JSON object.
+ */
+auto SessionPersistenceWorker::write_root(const QJsonObject& root) -> void
+{
+    if (m_repository != nullptr)
+    {
+        m_repository->save_all(root);
+        emit root_written();
+    }
+}
+
+/**
+ * @brief Writes a session snapshot and drops its journal.
+ * @param session_id The session identifier.
+ * @param session_obj The session JSON object.
+ */
+auto SessionPersistenceWorker::write_session(const QString& session_id,
+                                             const QJsonObject& session_obj) -> void
+{
+    if (m_repository != nullptr)
+    {
+        m_repository->save_session(session_id, session_obj);
+        emit session_written(session_id);
+    }
+}
+
+/**
+ * @brief Appends a full session state to the session journal.
+ * @param session_id The session identifier.
+ * @param session_obj The session JSON object.
+ */
+auto SessionPersistenceWorker::append_journal(const QString& session_id,
+                                              const QJsonObject& session_obj) -> void
+{
+    if (m_repository != nullptr)
+    {
+        m_repository->append_session_journal(session_id, session_obj);
+    }
+}
+
+/**
+ * @brief Appends the change between two session states to the session journal.
+ *
+ * The delta is computed here, so diffing large documents stays off the GUI thread.
+ *
+ * @param session_id The session identifier.
+ * @param previous The previously journaled (or stored) state.
+ * @param current The new state.
+ */
+auto SessionPersistenceWorker::append_journal_delta(const QString& session_id,
+                                                    const QJsonObject& previous,
+                                                    const QJsonObject& current) -> void
+{
+    if (m_repository != nullptr)
+    {
+        m_repository->append_session_journal_delta(session_id, previous, current);
+    }
+}
@@ -6,6 +6,7 @@
 #include <QJsonDocument>
 #include <QSaveFile>
 #include <QStandardPaths>
+#include <QStringList>
 
 namespace
 {
@@ -15,12 +16,204 @@ constexpr int k_schema_version_value = 1;
 // File and directory names.
 constexpr auto k_root_filename = "sessions.json";
 constexpr auto k_sessions_dirname = "sessions";
+constexpr auto k_journal_suffix = ".journal";
 
 // JSON keys (stable, not localized).
 constexpr auto k_schema_version_key = "schema_version";
 constexpr auto k_recent_files_key = "recent_files";
 constexpr auto k_recent_sessions_key = "recent_sessions";
 
+// Journal delta keys (see SessionRepository::make_session_delta()).
+constexpr auto k_journal_delta_key = "delta";
+constexpr auto k_delta_set_key = "set";
+constexpr auto k_delta_unset_key = "unset";
+constexpr auto k_delta_patch_key = "patch";
+
+/**
+ * @brief Lists the member keys of an object or array (indexes for arrays).
+ * @param container The object or array.
+ * @return The keys; empty for other values.
+ */
+auto get_member_keys(const QJsonValue& container) -> QStringList
+{
+    QStringList keys;
+
+    if (container.isObject())
+    {
+        keys = container.toObject().keys();
+    }
+    else if (container.isArray())
+    {
+        const qsizetype size = container.toArray().size();
+        keys.reserve(size);
+        for (qsizetype i = 0; i < size; ++i)
+        {
+            keys.append(QString::number(i));
+        }
+    }
+
+    return keys;
+}
+
+/**
+ * @brief Returns a member of an object or array by key (index for arrays).
+ * @param container The object or array.
+ * @param key The key.
+ * @return The member, or an undefined value if it does not exist.
+ */
+auto get_member(const QJsonValue& container, const QString& key) -> QJsonValue
+{
+    QJsonValue member(QJsonValue::Undefined);
+
+    if (container.isObject())
+    {
+        member = container.toObject().value(key);
+    }
+    else if (container.isArray())
+    {
+        const QJsonArray array = container.toArray();
+        const qsizetype index = key.toLongLong();
+        member = (index >= 0 && index < array.size()) ? array.at(index)
+                                                      : QJsonValue(QJsonValue::Undefined);
+    }
+
+    return member;
+}
+
+/**
+ * @brief Checks whether a changed value is recorded as nested delta instead of as a whole.
+ * @param previous The old value.
+ * @param current The new value.
+ * @return True for two objects or two arrays of the same size.
+ */
+auto is_patchable(const QJsonValue& previous, const QJsonValue& current) -> bool
+{
+    return (previous.isObject() && current.isObject()) ||
+           (previous.isArray() && current.isArray() &&
+            previous.toArray().size() == current.toArray().size());
+}
+
+/**
+ * @brief Computes the delta between two objects or two arrays of the same size.
+ * @param previous The old value.
+ * @param current The new value.
+ * @return The delta; empty if the values are equal.
+ */
+auto make_delta(const QJsonValue& previous, const QJsonValue& current) -> QJsonObject
+{
+    QJsonObject set;
+    QJsonArray unset;
+    QJsonObject patch;
+
+    const QStringList keys = get_member_keys(current);
+    for (const auto& key: keys)
+    {
+        const QJsonValue previous_value = get_member(previous, key);
+        const QJsonValue current_value = get_member(current, key);
+
+        if (previous_value != current_value)
+        {
+            if (is_patchable(previous_value, current_value))
+            {
+                patch.insert(key, make_delta(previous_value, current_value));
+            }
+            else
+            {
+                set.insert(key, current_value);
+            }
+        }
+    }
+
+    if (previous.isObject())
+    {
+        const QJsonObject current_object = current.toObject();
+        const QStringList previous_keys = previous.toObject().keys();
+
+        for (const auto& key: previous_keys)
+        {
+            if (!current_object.contains(key))
+            {
+                unset.append(key);
+            }
+        }
+    }
+
+    QJsonObject delta;
+    if (!set.isEmpty())
+    {
+        delta.insert(QString::fromLatin1(k_delta_set_key), set);
+    }
+    if (!unset.isEmpty())
+    {
+        delta.insert(QString::fromLatin1(k_delta_unset_key), unset);
+    }
+    if (!patch.isEmpty())
+    {
+        delta.insert(QString::fromLatin1(k_delta_patch_key), patch);
+    }
+
+    return delta;
+}
+
+/**
+ * @brief Applies a delta computed by make_delta() to an object or array.
+ * @param base The value the delta was computed against.
+ * @param delta The delta.
+ * @return The changed value.
+ */
+auto apply_delta(const QJsonValue& base, const QJsonObject& delta) -> QJsonValue
+{
+    const QJsonObject set = delta.value(QString::fromLatin1(k_delta_set_key)).toObject();
+    const QJsonArray unset = delta.value(QString::fromLatin1(k_delta_unset_key)).toArray();
+    const QJsonObject patch = delta.value(QString::fromLatin1(k_delta_patch_key)).toObject();
+    QJsonValue result;
+
+    if (base.isArray())
+    {
+        QJsonArray array = base.toArray();
+
+        for (auto it = set.constBegin(); it != set.constEnd(); ++it)
+        {
+            const qsizetype index = it.key().toLongLong();
+            if (index >= 0 && index < array.size())
+            {
+                array.replace(index, it.value());
+            }
+        }
+        for (auto it = patch.constBegin(); it != patch.constEnd(); ++it)
+        {
+            const qsizetype index = it.key().toLongLong();
+            if (index >= 0 && index < array.size())
+            {
+                array.replace(index, apply_delta(array.at(index), it.value().toObject()));
+            }
+        }
+
+        result = array;
+    }
+    else
+    {
+        QJsonObject object = base.toObject();
+
+        for (const auto& key: unset)
+        {
+            object.remove(key.toString());
+        }
+        for (auto it = set.constBegin(); it != set.constEnd(); ++it)
+        {
+            object.insert(it.key(), it.value());
+        }
+        for (auto it = patch.constBegin(); it != patch.constEnd(); ++it)
+        {
+            object.insert(it.key(), apply_delta(object.value(it.key()), it.value().toObject()));
+        }
+
+        result = object;
+    }
+
+    return result;
+}
+
 /**
  * @brief Ensures a directory exists, creating it if necessary.
  * @param dir_path The directory path to ensure.
@@ -161,7 +354,7 @@ auto SessionRepository::save_all(const QJsonObject& root) const -> void
         }
 
         const QJsonDocument doc(obj);
-        const QByteArray bytes = doc.toJson(QJsonDocument::Indented);
+        const QByteArray bytes = doc.toJson(QJsonDocument::Compact);
 
         save_file.write(bytes);
         save_file.commit();
@@ -194,10 +387,25 @@ auto SessionRepository::get_session_file_path(const QString& session_id) const -
     return path;
 }
 
+/**
+ * @brief Computes the absolute journal file path for a specific session id.
+ * @param session_id The session identifier.
+ * @return Absolute file path within the sessions directory.
+ */
+auto SessionRepository::get_session_journal_path(const QString& session_id) const -> QString
+{
+    const QString dir_path = get_sessions_dir_path();
+    QDir dir(dir_path);
+    const QString filename = session_id + QString::fromLatin1(k_journal_suffix);
+    const QString path = dir.filePath(filename);
+    return path;
+}
+
 /**
  * @brief Loads a single session JSON document by id.
  * @param session_id The session identifier.
  * @return Parsed session JSON object, or an empty object if the file does not exist or is invalid.
+ *         A newer journaled state takes precedence over the snapshot file.
  */
 auto SessionRepository::load_session(const QString& session_id) const -> QJsonObject
 {
@@ -217,6 +425,9 @@ auto SessionRepository::load_session(const QString& session_id) const -> QJsonOb
         }
     }
 
+    // A journal only exists while its changes are newer than the snapshot.
+    result = load_session_journal(session_id, result);
+
     return result;
 }
 
@@ -246,13 +457,86 @@ auto SessionRepository::save_session(const QString& session_id,
         }
 
         const QJsonDocument doc(session_obj);
-        const QByteArray bytes = doc.toJson(QJsonDocument::Indented);
+        const QByteArray bytes = doc.toJson(QJsonDocument::Compact);
 
         save_file.write(bytes);
-        save_file.commit();
+
+        // The snapshot now contains everything the journal recorded.
+        if (save_file.commit())
+        {
+            QFile::remove(get_session_journal_path(session_id));
+        }
     }
 }
 
+/**
+ * @brief Appends a full session state to the session's journal (one compact line).
+ *
+ * Replaces everything recorded before it; used when the previous state is unknown.
+ *
+ * @param session_id The session identifier.
+ * @param obj The session JSON object to journal.
+ */
+auto SessionRepository::append_session_journal(const QString& session_id,
+                                               const QJsonObject& obj) const -> void
+{
+    QJsonObject session_obj = obj;
+    if (!session_obj.contains(QString::fromLatin1(k_schema_version_key)))
+    {
+        session_obj.insert(QString::fromLatin1(k_schema_version_key), get_schema_version());
+    }
+
+    append_journal_line(session_id, session_obj);
+}
+
+/**
+ * @brief Appends the change between two session states to the session's journal.
+ * @param session_id The session identifier.
+ * @param previous The state the snapshot and the journal describe so far.
+ * @param current The new state.
+ */
+auto SessionRepository::append_session_journal_delta(const QString& session_id,
+                                                     const QJsonObject& previous,
+                                                     const QJsonObject& current) const -> void
+{
+    const QJsonObject delta = make_session_delta(previous, current);
+
+    if (!delta.isEmpty())
+    {
+        append_journal_line(session_id,
+                            QJsonObject{{QString::fromLatin1(k_journal_delta_key), delta}});
+    }
+}
+
+/**
+ * @brief Computes the delta between two JSON objects.
+ *
+ * The delta holds "set" (new values by key), "unset" (removed keys) and "patch" (nested deltas
+ * by key). Objects, and arrays of unchanged size, are patched member by member (array members
+ * are keyed by their index); any other changed value is set as a whole.
+ *
+ * @param previous The old object.
+ * @param current The new object.
+ * @return The delta; empty if the objects are equal.
+ */
+auto SessionRepository::make_session_delta(const QJsonObject& previous,
+                                           const QJsonObject& current) -> QJsonObject
+{
+    return make_delta(previous, current);
+}
+
+/**
+ * @brief Applies a delta computed by make_session_delta().
+ * @param base The object the delta was computed against.
+ * @param delta The delta.
+ * @return The changed object.
+ */
+auto SessionRepository::apply_session_delta(const QJsonObject& base, const QJsonObject& delta)
+    -> QJsonObject
+{
+    return apply_delta(base, delta).toObject();
+}
+
 /**
  * @brief Deletes a stored session JSON file if present.
  * @param session_id The session identifier.
@@ -269,5 +553,69 @@ auto SessionRepository::delete_session(const QString& session_id) const -> bool
         deleted = file.remove();
     }
 
+    QFile::remove(get_session_journal_path(session_id));
+
     return deleted;
 }
+
+/**
+ * @brief Replays the complete lines of a session journal on top of a state.
+ * @param session_id The session identifier.
+ * @param snapshot The state read from the snapshot file.
+ * @return The journaled session state, or the snapshot if there is no journal.
+ */
+auto SessionRepository::load_session_journal(const QString& session_id,
+                                             const QJsonObject& snapshot) const -> QJsonObject
+{
+    QJsonObject result = snapshot;
+    QFile journal(get_session_journal_path(session_id));
+
+    if (journal.exists() && journal.open(QIODevice::ReadOnly))
+    {
+        const QList<QByteArray> lines = journal.readAll().split('\n');
+        bool complete = true;
+
+        // A crash can only leave a partial last line; replay up to the first invalid one.
+        for (qsizetype i = 0; i < lines.size() && complete; ++i)
+        {
+            const QJsonDocument doc = QJsonDocument::fromJson(lines.at(i));
+            const QJsonObject line = doc.object();
+            const QJsonValue delta = line.value(QString::fromLatin1(k_journal_delta_key));
+
+            complete = doc.isObject();
+            if (complete && delta.isObject())
+            {
+                result = apply_session_delta(result, delta.toObject());
+            }
+            else if (complete)
+            {
+                result = line;
+            }
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Appends one line to a session journal.
+ * @param session_id The session identifier.
+ * @param line The JSON object written as line.
+ */
+auto SessionRepository::append_journal_line(const QString& session_id,
+                                            const QJsonObject& line) const -> void
+{
+    const QString dir_path = get_sessions_dir_path();
+    ensure_dir(dir_path);
+
+    QFile journal(get_session_journal_path(session_id));
+
+    if (journal.open(QIODevice::WriteOnly | QIODevice::Append))
+    {
+        QByteArray bytes = QJsonDocument(line).toJson(QJsonDocument::Compact);
+        bytes.append('\n');
+
+        journal.write(bytes);
+        journal.flush();
+    }
+}
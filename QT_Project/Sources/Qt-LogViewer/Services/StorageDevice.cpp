@@ -0,0 +1,103 @@
+/**
+ * @file StorageDevice.cpp
+ * @brief This file contains the implementation of the StorageDevice class.
+ */
+
+#include "Qt-LogViewer/Services/StorageDevice.h"
+
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QStorageInfo>
+#include <QStringList>
+
+#if defined(Q_OS_UNIX)
+#include <sys/stat.h>
+#endif
+#if defined(Q_OS_LINUX)
+#include <sys/sysmacros.h>
+#endif
+
+namespace
+{
+/**
+ * @brief Returns the path that exists and best represents the file's location.
+ * @param file_path The file.
+ * @return The file itself, or its directory if the file does not exist.
+ */
+auto existing_path(const QString& file_path) -> QString
+{
+    const QFileInfo info(file_path);
+    return info.exists() ? info.absoluteFilePath() : info.absolutePath();
+}
+
+#if defined(Q_OS_LINUX)
+/**
+ * @brief Reads the rotational flag of a block device from sysfs.
+ * @param device The st_dev of a file on the device.
+ * @return True for spinning disks; false for SSDs and unknown devices.
+ */
+auto is_rotational(dev_t device) -> bool
+{
+    const QString base =
+        QStringLiteral("/sys/dev/block/%1:%2").arg(major(device)).arg(minor(device));
+
+    // Partitions have no queue directory of their own; the disk is their parent.
+    QFile flag(base + QStringLiteral("/queue/rotational"));
+    if (!flag.exists())
+    {
+        flag.setFileName(base + QStringLiteral("/../queue/rotational"));
+    }
+
+    return flag.open(QIODevice::ReadOnly) && flag.read(1) == "1";
+}
+#endif
+}  // namespace
+
+/**
+ * @brief Determines the device of a file.
+ * @param file_path The file.
+ * @return The device description.
+ */
+auto StorageDevice::probe(const QString& file_path) -> Info
+{
+    const QString path = existing_path(file_path);
+    const QStorageInfo storage(path);
+    Info info;
+
+    info.name = storage.isValid() ? QString::fromLocal8Bit(storage.device()) : path;
+    info.sequential = is_network_file_system(QString::fromLatin1(storage.fileSystemType()));
+
+#if defined(Q_OS_UNIX)
+    struct stat file_stat{};
+    if (::stat(QFile::encodeName(path).constData(), &file_stat) == 0)
+    {
+        info.key = static_cast<quint64>(file_stat.st_dev);
+#if defined(Q_OS_LINUX)
+        info.sequential = info.sequential || is_rotational(file_stat.st_dev);
+#endif
+    }
+#else
+    // UNC paths are network shares; local volumes are identified by their root.
+    info.key = qHash(storage.rootPath());
+    info.sequential = info.sequential || path.startsWith(QStringLiteral("//"));
+#endif
+
+    return info;
+}
+
+/**
+ * @brief Checks whether a file system type is a network file system.
+ * @param file_system_type The type as reported by QStorageInfo (e.g. "nfs4", "cifs").
+ * @return True for network file systems.
+ */
+auto StorageDevice::is_network_file_system(const QString& file_system_type) -> bool
+{
+    static const QStringList k_network_types = {
+        QStringLiteral("nfs"),   QStringLiteral("nfs4"),   QStringLiteral("cifs"),
+        QStringLiteral("smb3"),  QStringLiteral("smbfs"),  QStringLiteral("afpfs"),
+        QStringLiteral("webdav"), QStringLiteral("9p"),    QStringLiteral("fuse.sshfs"),
+    };
+
+    return k_network_types.contains(file_system_type.toLower());
+}
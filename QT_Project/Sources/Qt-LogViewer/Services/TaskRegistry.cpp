@@ -0,0 +1,211 @@
+/**
+ * @file TaskRegistry.cpp
+ * @brief This file contains the implementation of the TaskRegistry class.
+ */
+
+#include "Qt-LogViewer/Services/TaskRegistry.h"
+
+#include <QTimer>
+
+#include <algorithm>
+
+namespace
+{
+// Progress is polled rather than signalled by workers, so a fast worker never floods the event
+// loop; this is frequent enough for a progress bar.
+constexpr int k_poll_interval_ms = 100;
+}  // namespace
+
+/**
+ * @brief Constructs a TaskRegistry.
+ * @param parent Optional QObject parent.
+ */
+TaskRegistry::TaskRegistry(QObject* parent): QObject(parent), m_poll_timer(new QTimer(this))
+{
+    m_poll_timer->setInterval(k_poll_interval_ms);
+    connect(m_poll_timer, &QTimer::timeout, this, &TaskRegistry::poll_progress);
+}
+
+/**
+ * @brief Registers a new task.
+ * @param name Human readable description (e.g. "Loading app.log").
+ * @param owner The object the task works for (e.g. a view id); may be null.
+ * @return The token to pass to the worker.
+ */
+auto TaskRegistry::begin_task(const QString& name, const QUuid& owner) -> TaskToken
+{
+    TaskToken token;
+    token.m_state->id = m_next_id++;
+
+    Task task;
+    task.token = token;
+    task.name = name;
+    task.owner = owner;
+    m_tasks.append(task);
+
+    if (!m_poll_timer->isActive())
+    {
+        m_poll_timer->start();
+    }
+
+    emit task_started(token.get_id(), name);
+
+    return token;
+}
+
+/**
+ * @brief Removes a finished or cancelled task; unknown tokens are ignored.
+ * @param token The token returned by begin_task().
+ */
+auto TaskRegistry::end_task(const TaskToken& token) -> void
+{
+    qsizetype index = -1;
+
+    for (qsizetype i = 0; i < m_tasks.size() && index < 0; ++i)
+    {
+        if (m_tasks.at(i).token.get_id() == token.get_id())
+        {
+            index = i;
+        }
+    }
+
+    if (index >= 0 && token.get_id() != 0)
+    {
+        m_tasks.removeAt(index);
+
+        if (m_tasks.isEmpty())
+        {
+            m_poll_timer->stop();
+        }
+
+        emit task_finished(token.get_id(), token.is_cancelled());
+    }
+}
+
+/**
+ * @brief Cancels all tasks of an owner.
+ * @param owner The owner passed to begin_task().
+ * @return The number of cancelled tasks.
+ */
+auto TaskRegistry::cancel_owner(const QUuid& owner) -> int
+{
+    int cancelled = 0;
+
+    for (const auto& task: m_tasks)
+    {
+        if (task.owner == owner && !task.token.is_cancelled())
+        {
+            task.token.cancel();
+            ++cancelled;
+        }
+    }
+
+    return cancelled;
+}
+
+/**
+ * @brief Cancels all tasks (e.g. on shutdown).
+ * @return The number of cancelled tasks.
+ */
+auto TaskRegistry::cancel_all() -> int
+{
+    int cancelled = 0;
+
+    for (const auto& task: m_tasks)
+    {
+        if (!task.token.is_cancelled())
+        {
+            task.token.cancel();
+            ++cancelled;
+        }
+    }
+
+    return cancelled;
+}
+
+/**
+ * @brief Returns the running tasks in start order.
+ * @return The task descriptions.
+ */
+auto TaskRegistry::get_tasks() const -> QVector<TaskInfo>
+{
+    QVector<TaskInfo> tasks;
+    tasks.reserve(m_tasks.size());
+
+    for (const auto& task: m_tasks)
+    {
+        TaskInfo info;
+        info.id = task.token.get_id();
+        info.name = task.name;
+        info.owner = task.owner;
+        info.done = task.token.get_progress_done();
+        info.total = task.token.get_progress_total();
+        info.cancelled = task.token.is_cancelled();
+        tasks.append(info);
+    }
+
+    return tasks;
+}
+
+/**
+ * @brief Returns the number of running tasks.
+ * @return The task count.
+ */
+auto TaskRegistry::get_task_count() const -> int
+{
+    return static_cast<int>(m_tasks.size());
+}
+
+/**
+ * @brief Returns the interval in which task progress is polled.
+ * @return The interval in milliseconds.
+ */
+auto TaskRegistry::get_poll_interval_ms() -> int
+{
+    return k_poll_interval_ms;
+}
+
+/**
+ * @brief Reports progress changes of all running tasks and ends abandoned ones.
+ */
+auto TaskRegistry::poll_progress() -> void
+{
+    // Copy the ids first: a slot connected to task_progress may end tasks.
+    QVector<quint64> changed_ids;
+    QVector<TaskToken> abandoned;
+
+    for (auto& task: m_tasks)
+    {
+        // Only the registry's copy is left: nobody works on the task or will end it.
+        if (task.token.m_state.use_count() == 1)
+        {
+            abandoned.append(task.token);
+        }
+
+        const qint64 done = task.token.get_progress_done();
+        const qint64 total = task.token.get_progress_total();
+
+        if (done != task.reported_done || total != task.reported_total)
+        {
+            task.reported_done = done;
+            task.reported_total = total;
+            changed_ids.append(task.token.get_id());
+        }
+    }
+
+    for (const quint64 id: changed_ids)
+    {
+        const auto it = std::find_if(m_tasks.cbegin(), m_tasks.cend(),
+                                     [id](const Task& task) { return task.token.get_id() == id; });
+
+        if (it != m_tasks.cend())
+        {
+            emit task_progress(id, it->reported_done, it->reported_total);
+        }
+    }
+
+    for (const auto& token: abandoned)
+    {
+        end_task(token);
+    }
+}
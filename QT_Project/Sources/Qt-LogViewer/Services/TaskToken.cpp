@@ -0,0 +1,66 @@
+/**
+ * @file TaskToken.cpp
+ * @brief This file contains the implementation of the TaskToken class.
+ */
+
+#include "Qt-LogViewer/Services/TaskToken.h"
+
+/**
+ * @brief Constructs a token with fresh, uncancelled state.
+ */
+TaskToken::TaskToken(): m_state(std::make_shared<State>()) {}
+
+/**
+ * @brief Requests cancellation of the operation.
+ */
+auto TaskToken::cancel() const -> void
+{
+    m_state->cancelled.store(true, std::memory_order_release);
+}
+
+/**
+ * @brief Checks whether cancellation was requested.
+ * @return True if the operation should stop.
+ */
+auto TaskToken::is_cancelled() const -> bool
+{
+    return m_state->cancelled.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Reports the progress of the operation.
+ * @param done Units (bytes, rows) processed so far.
+ * @param total Total units, or 0 if unknown.
+ */
+auto TaskToken::set_progress(qint64 done, qint64 total) const -> void
+{
+    m_state->total.store(total, std::memory_order_relaxed);
+    m_state->done.store(done, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the processed units.
+ * @return The last reported progress.
+ */
+auto TaskToken::get_progress_done() const -> qint64
+{
+    return m_state->done.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the total units.
+ * @return The last reported total, or 0 if unknown.
+ */
+auto TaskToken::get_progress_total() const -> qint64
+{
+    return m_state->total.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the registry id of the operation.
+ * @return The id, or 0 if the token is not registered.
+ */
+auto TaskToken::get_id() const -> quint64
+{
+    return m_state->id;
+}
@@ -0,0 +1,176 @@
+/**
+ * @file ColumnWidthSampler.cpp
+ * @brief This file contains the implementation of the ColumnWidthSampler class.
+ */
+
+#include "Qt-LogViewer/Views/App/ColumnWidthSampler.h"
+
+#include <QAbstractItemModel>
+
+namespace
+{
+// Distinct texts whose width is cached; timestamps are mostly unique, so the cache is dropped
+// rather than grown without bound.
+constexpr int k_max_cached_widths = 4096;
+
+// Longer texts are measured by their prefix; no column is sized wider than this anyway.
+constexpr int k_max_measured_chars = 512;
+}  // namespace
+
+/**
+ * @brief Forgets all statistics (e.g. after a model reset).
+ */
+auto ColumnWidthSampler::reset() -> void
+{
+    m_content_widths.clear();
+    m_sampled_row_count = 0;
+}
+
+/**
+ * @brief Sets the font the widths are measured with; clears the width cache if changed.
+ * @param metrics The font metrics of the table.
+ */
+auto ColumnWidthSampler::set_font_metrics(const QFontMetrics& metrics) -> void
+{
+    if (metrics != m_metrics)
+    {
+        m_metrics = metrics;
+        m_width_cache.clear();
+        reset();
+    }
+}
+
+/**
+ * @brief Sets columns that are not measured (e.g. a message column that takes the rest).
+ * @param columns The column indexes to skip.
+ */
+auto ColumnWidthSampler::set_skipped_columns(const QSet<int>& columns) -> void
+{
+    m_skipped_columns = columns;
+}
+
+/**
+ * @brief Measures a stratified sample of a row range.
+ * @param model The model to read display texts from.
+ * @param first_row The first row of the range.
+ * @param last_row The last row of the range.
+ * @param max_rows The maximum number of rows to measure.
+ */
+auto ColumnWidthSampler::sample_range(const QAbstractItemModel& model, int first_row,
+                                      int last_row, int max_rows) -> void
+{
+    sample_rows(model, stratified_rows(first_row, last_row, max_rows));
+}
+
+/**
+ * @brief Measures the given rows.
+ * @param model The model to read display texts from.
+ * @param rows The rows to measure; invalid rows are ignored.
+ */
+auto ColumnWidthSampler::sample_rows(const QAbstractItemModel& model, const QVector<int>& rows)
+    -> void
+{
+    const int row_count = model.rowCount();
+    const int column_count = model.columnCount();
+
+    if (m_content_widths.size() < column_count)
+    {
+        m_content_widths.resize(column_count, 0);
+    }
+
+    for (const int row: rows)
+    {
+        if (row >= 0 && row < row_count)
+        {
+            for (int column = 0; column < column_count; ++column)
+            {
+                if (!m_skipped_columns.contains(column))
+                {
+                    const QString text =
+                        model.index(row, column).data(Qt::DisplayRole).toString();
+                    m_content_widths[column] = qMax(m_content_widths.at(column), measure(text));
+                }
+            }
+
+            ++m_sampled_row_count;
+        }
+    }
+}
+
+/**
+ * @brief Returns the widest sampled text of a column.
+ * @param column The column index.
+ * @return The width in pixels (without cell padding), or 0 if nothing was sampled.
+ */
+auto ColumnWidthSampler::get_content_width(int column) const -> int
+{
+    return (column >= 0 && column < m_content_widths.size()) ? m_content_widths.at(column) : 0;
+}
+
+/**
+ * @brief Returns the number of rows measured since the last reset.
+ * @return The sampled row count.
+ */
+auto ColumnWidthSampler::get_sampled_row_count() const -> int
+{
+    return m_sampled_row_count;
+}
+
+/**
+ * @brief Selects rows spread evenly over a range, including both ends.
+ * @param first_row The first row of the range.
+ * @param last_row The last row of the range.
+ * @param max_rows The maximum number of rows to select.
+ * @return The selected rows in ascending order.
+ */
+auto ColumnWidthSampler::stratified_rows(int first_row, int last_row, int max_rows)
+    -> QVector<int>
+{
+    QVector<int> rows;
+    const qint64 range = static_cast<qint64>(last_row) - first_row + 1;
+
+    if (range > 0 && max_rows > 0)
+    {
+        const qint64 count = qMin<qint64>(range, max_rows);
+        rows.reserve(static_cast<int>(count));
+
+        for (qint64 i = 0; i < count; ++i)
+        {
+            // One row per stratum; the last stratum ends at last_row.
+            const qint64 offset = (count > 1) ? (i * (range - 1)) / (count - 1) : 0;
+            rows.append(static_cast<int>(first_row + offset));
+        }
+    }
+
+    return rows;
+}
+
+/**
+ * @brief Returns the width of a text, using the cache.
+ * @param text The display text.
+ * @return The width in pixels.
+ */
+auto ColumnWidthSampler::measure(const QString& text) -> int
+{
+    // Only the first line is shown in a cell.
+    const QString shown = text.left(k_max_measured_chars).section(QLatin1Char('\n'), 0, 0);
+    int width = 0;
+    const auto it = m_width_cache.constFind(shown);
+
+    if (it != m_width_cache.constEnd())
+    {
+        width = it.value();
+    }
+    else if (!shown.isEmpty())
+    {
+        if (m_width_cache.size() >= k_max_cached_widths)
+        {
+            m_width_cache.clear();
+        }
+
+        width = m_metrics.horizontalAdvance(shown);
+        m_width_cache.insert(shown, width);
+    }
+
+    return width;
+}
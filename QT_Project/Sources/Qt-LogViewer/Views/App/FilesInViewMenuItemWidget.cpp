@@ -3,6 +3,7 @@
 #include <QEvent>
 #include <QFileInfo>
 #include <QFontMetrics>
+#include <QLocale>
 #include <QStyle>
 
 #include "QtWidgetsCommonLib/Utils/UiUtils.h"
@@ -31,6 +32,7 @@ FilesInViewMenuItemWidget::FilesInViewMenuItemWidget(QWidget* parent)
       m_icon_eye_off(QStringLiteral(":/Resources/Icons/eye-off.svg")),
       m_icon_trash(QStringLiteral(":/Resources/Icons/trash.svg")),
       m_label(nullptr),
+      m_counts_label(nullptr),
       m_btn_show_only(nullptr),
       m_btn_toggle_visibility(nullptr),
       m_btn_remove(nullptr),
@@ -54,6 +56,11 @@ auto FilesInViewMenuItemWidget::setup_ui() -> void
     m_label->setTextInteractionFlags(Qt::NoTextInteraction);
     m_label->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Preferred);
 
+    m_counts_label = new QLabel(this);
+    m_counts_label->setTextInteractionFlags(Qt::NoTextInteraction);
+    m_counts_label->setAlignment(Qt::AlignRight | Qt::AlignVCenter);
+    m_counts_label->setVisible(false);
+
     m_btn_show_only = new QToolButton(this);
     m_btn_show_only->setProperty("variant", "inline-menu");
     m_btn_show_only->setAutoRaise(true);
@@ -79,6 +86,7 @@ auto FilesInViewMenuItemWidget::setup_ui() -> void
     m_btn_remove->installEventFilter(this);
 
     m_layout->addWidget(m_label, 1);
+    m_layout->addWidget(m_counts_label, 0);
     m_layout->addWidget(m_btn_show_only, 0);
     m_layout->addWidget(m_btn_toggle_visibility, 0);
     m_layout->addWidget(m_btn_remove, 0);
@@ -130,6 +138,29 @@ auto FilesInViewMenuItemWidget::set_hidden_state(bool hidden) -> void
     apply_icons();
 }
 
+/**
+ * @brief Shows the file's entry counts next to its name.
+ * @param matched Entries of the file passing the view's filter.
+ * @param total All entries of the file in the view; negative hides the counts.
+ */
+auto FilesInViewMenuItemWidget::set_entry_counts(int matched, int total) -> void
+{
+    QString text;
+
+    if (total >= 0 && matched != total)
+    {
+        text = tr("%1 / %2").arg(QLocale().toString(matched), QLocale().toString(total));
+    }
+    else if (total >= 0)
+    {
+        text = QLocale().toString(total);
+    }
+
+    m_counts_label->setText(text);
+    m_counts_label->setVisible(total >= 0);
+    update_label_elided();
+}
+
 /**
  * @brief Sets icon resource paths for the inline action buttons and reapplies icons.
  * @param eye Path to "Show Only" icon (eye).
@@ -544,7 +575,11 @@ auto FilesInViewMenuItemWidget::update_label_elided() -> void
         display_text = info.fileName();
     }
 
-    const int reserved = qMax(0, m_label_reserved_px);
+    int reserved = qMax(0, m_label_reserved_px);
+    if (m_counts_label->isVisible())
+    {
+        reserved += m_counts_label->sizeHint().width() + m_layout->spacing();
+    }
     const int max_px = qMax(60, width() - reserved);
 
     QFontMetrics metrics(font());
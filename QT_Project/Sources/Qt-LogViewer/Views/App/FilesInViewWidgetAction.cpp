@@ -22,7 +22,9 @@ FilesInViewWidgetAction::FilesInViewWidgetAction(QObject* parent)
       m_icon_color(QColor("#666666")),
       m_icon_color_hover(QColor("#42a5f5")),
       m_icon_px(14),
-      m_hidden_effective(false)
+      m_hidden_effective(false),
+      m_matched_count(-1),
+      m_total_count(-1)
 {}
 
 /**
@@ -149,6 +151,27 @@ auto FilesInViewWidgetAction::get_hidden_effective() const -> bool
     return result;
 }
 
+/**
+ * @brief Sets the file's entry counts shown by the embedded widget.
+ * @param matched Entries of the file passing the view's filter.
+ * @param total All entries of the file in the view; negative hides the counts.
+ */
+auto FilesInViewWidgetAction::set_entry_counts(int matched, int total) -> void
+{
+    m_matched_count = matched;
+    m_total_count = total;
+
+    const QList<QWidget*> widgets = createdWidgets();
+    for (QWidget* w: widgets)
+    {
+        auto* row = qobject_cast<FilesInViewMenuItemWidget*>(w);
+        if (row != nullptr)
+        {
+            row->set_entry_counts(m_matched_count, m_total_count);
+        }
+    }
+}
+
 /**
  * @brief Creates the embedded widget instance and wires its signals to this action.
  * @param parent Menu or parent widget.
@@ -176,6 +199,7 @@ QWidget* FilesInViewWidgetAction::createWidget(QWidget* parent)
 
     // Forward effective hidden state to toggle Hide/Show presentation
     item_widget->set_hidden_state(m_hidden_effective);
+    item_widget->set_entry_counts(m_matched_count, m_total_count);
 
     // Forward signals
     connect(item_widget, &FilesInViewMenuItemWidget::show_only_requested, this,
@@ -0,0 +1,325 @@
+/**
+ * @file LevelDensityMinimap.cpp
+ * @brief This file contains the implementation of the LevelDensityMinimap class.
+ */
+
+#include "Qt-LogViewer/Views/App/LevelDensityMinimap.h"
+
+#include <QMouseEvent>
+#include <QPainter>
+
+#include <array>
+#include <cmath>
+
+#include "Qt-LogViewer/Models/LevelDensitySummary.h"
+
+namespace
+{
+constexpr int k_minimap_width = 14;
+constexpr int k_hit_lane_width = 3;
+
+// Opacity of a pixel row whose rows all have the shown level, and of a single row among many.
+constexpr double k_max_alpha = 255.0;
+constexpr double k_min_alpha = 110.0;
+
+// Density at which the full opacity is reached; sparse errors should still stand out.
+constexpr double k_full_density = 0.25;
+
+// Level colors, matching the level column of the log table.
+constexpr std::array<QRgb, LevelDensitySummary::LevelCount> k_level_colors = {
+    0xffb0bec5,  // Trace
+    0xff66bb6a,  // Debug
+    0xff42a5f5,  // Info
+    0xffffb300,  // Warning
+    0xffef5350,  // Error
+    0xffff1744   // Fatal
+};
+constexpr QRgb k_hit_color = 0xffffd54f;
+constexpr QRgb k_page_outline_color = 0xc0ffffff;
+
+// Per pixel row: counts per level, search hits and rows.
+constexpr int k_hits_slot = LevelDensitySummary::LevelCount;
+constexpr int k_rows_slot = LevelDensitySummary::LevelCount + 1;
+using PixelCounts = std::array<double, LevelDensitySummary::LevelCount + 2>;
+
+/**
+ * @brief Returns a color with an opacity in premultiplied form.
+ * @param color The opaque color.
+ * @param alpha The opacity (0-255).
+ * @return The premultiplied color.
+ */
+auto with_alpha(QRgb color, double alpha) -> QRgb
+{
+    return qPremultiply(qRgba(qRed(color), qGreen(color), qBlue(color), qRound(alpha)));
+}
+
+/**
+ * @brief Returns the opacity for a density.
+ * @param density The fraction of rows (0-1).
+ * @return The opacity (0-255).
+ */
+auto alpha_for_density(double density) -> double
+{
+    const double scaled = qMin(1.0, density / k_full_density);
+    return k_min_alpha + (k_max_alpha - k_min_alpha) * scaled;
+}
+}  // namespace
+
+/**
+ * @brief Constructs a LevelDensityMinimap.
+ * @param parent The parent widget.
+ */
+LevelDensityMinimap::LevelDensityMinimap(QWidget* parent): QWidget(parent)
+{
+    setAttribute(Qt::WA_StyledBackground, true);
+    setAttribute(Qt::WA_OpaquePaintEvent, false);
+    setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Expanding);
+    setCursor(Qt::PointingHandCursor);
+    setToolTip(tr("Level density of the whole view. Click to jump."));
+}
+
+/**
+ * @brief Sets the summary the strip is rendered from.
+ * @param summary The summary (not owned), or nullptr.
+ */
+auto LevelDensityMinimap::set_summary(LevelDensitySummary* summary) -> void
+{
+    if (m_summary != nullptr)
+    {
+        disconnect(m_summary, nullptr, this, nullptr);
+    }
+
+    m_summary = summary;
+
+    if (m_summary != nullptr)
+    {
+        connect(m_summary, &LevelDensitySummary::summary_changed, this,
+                &LevelDensityMinimap::invalidate_image);
+    }
+
+    invalidate_image();
+}
+
+/**
+ * @brief Sets the rows outlined as the currently displayed page.
+ * @param first_row The first view row of the page.
+ * @param row_count The number of rows on the page.
+ */
+auto LevelDensityMinimap::set_visible_rows(int first_row, int row_count) -> void
+{
+    if (first_row != m_visible_first_row || row_count != m_visible_row_count)
+    {
+        m_visible_first_row = first_row;
+        m_visible_row_count = row_count;
+
+        // The outline is painted over the cached image; no re-render needed.
+        update();
+    }
+}
+
+/**
+ * @brief Maps a y coordinate to a view row.
+ * @param y The y coordinate in widget pixels.
+ * @return The view row, or -1 if the view is empty.
+ */
+auto LevelDensityMinimap::row_at(int y) const -> int
+{
+    const int row_count = (m_summary != nullptr) ? m_summary->get_row_count() : 0;
+    int row = -1;
+
+    if (row_count > 0 && height() > 0)
+    {
+        const double fraction = (static_cast<double>(y) + 0.5) / height();
+        row = qBound(0, static_cast<int>(fraction * row_count), row_count - 1);
+    }
+
+    return row;
+}
+
+/**
+ * @brief Renders the strip for the current summary.
+ * @param size The image size in pixels.
+ * @return The rendered image (transparent where there are no rows).
+ */
+auto LevelDensityMinimap::render_image(const QSize& size) const -> QImage
+{
+    QImage image(size, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+
+    const int row_count = (m_summary != nullptr) ? m_summary->get_row_count() : 0;
+    const int pixel_rows = size.height();
+
+    if (row_count > 0 && pixel_rows > 0 && size.width() > 0)
+    {
+        // Spread every bucket over the pixel rows it overlaps: O(buckets + pixel rows).
+        QVector<PixelCounts> pixels(pixel_rows, PixelCounts{});
+        const double rows_per_pixel = static_cast<double>(row_count) / pixel_rows;
+        double bucket_start = 0.0;
+
+        for (const auto& bucket: m_summary->get_buckets())
+        {
+            const double bucket_end = bucket_start + bucket.row_count;
+            const int first_pixel = qBound(0, static_cast<int>(bucket_start / rows_per_pixel),
+                                           pixel_rows - 1);
+            const int last_pixel =
+                qBound(0, static_cast<int>(std::ceil(bucket_end / rows_per_pixel)) - 1,
+                       pixel_rows - 1);
+
+            for (int pixel = first_pixel; pixel <= last_pixel && bucket.row_count > 0; ++pixel)
+            {
+                const double overlap =
+                    qMin(bucket_end, (pixel + 1) * rows_per_pixel) -
+                    qMax(bucket_start, pixel * rows_per_pixel);
+                const double share = qMax(0.0, overlap) / bucket.row_count;
+                PixelCounts& counts = pixels[pixel];
+
+                for (int level = 0; level < LevelDensitySummary::LevelCount; ++level)
+                {
+                    counts[level] += bucket.level_counts[level] * share;
+                }
+                counts[k_hits_slot] += m_summary->get_hit_count(bucket) * share;
+                counts[k_rows_slot] += bucket.row_count * share;
+            }
+
+            bucket_start = bucket_end;
+        }
+
+        const int level_lane_width = qMax(1, size.width() - k_hit_lane_width);
+
+        for (int y = 0; y < pixel_rows; ++y)
+        {
+            const PixelCounts& counts = pixels.at(y);
+            const double rows = counts[k_rows_slot];
+            auto* line = reinterpret_cast<QRgb*>(image.scanLine(y));
+
+            if (rows > 0.0)
+            {
+                // Most severe level at or above Warning, otherwise the most frequent one.
+                int shown_level = -1;
+                for (int level = LevelDensitySummary::Warning;
+                     level < LevelDensitySummary::LevelCount; ++level)
+                {
+                    shown_level = (counts[level] > 0.0) ? level : shown_level;
+                }
+                const bool has_severe = shown_level >= 0;
+                for (int level = 0; !has_severe && level < LevelDensitySummary::Warning; ++level)
+                {
+                    const bool more_frequent =
+                        counts[level] > 0.0 &&
+                        (shown_level < 0 || counts[level] > counts[shown_level]);
+                    shown_level = more_frequent ? level : shown_level;
+                }
+
+                if (shown_level >= 0)
+                {
+                    const QRgb color = with_alpha(k_level_colors.at(shown_level),
+                                                  alpha_for_density(counts[shown_level] / rows));
+                    std::fill(line, line + level_lane_width, color);
+                }
+
+                if (counts[k_hits_slot] > 0.0 && size.width() > level_lane_width)
+                {
+                    const QRgb color =
+                        with_alpha(k_hit_color, alpha_for_density(counts[k_hits_slot] / rows));
+                    std::fill(line + level_lane_width, line + size.width(), color);
+                }
+            }
+        }
+    }
+
+    return image;
+}
+
+/**
+ * @brief Returns the preferred size (a fixed, narrow width).
+ * @return The size hint.
+ */
+auto LevelDensityMinimap::sizeHint() const -> QSize
+{
+    return QSize(k_minimap_width, QWidget::sizeHint().height());
+}
+
+/**
+ * @brief Paints the cached image and the page outline.
+ * @param event The paint event.
+ */
+auto LevelDensityMinimap::paintEvent(QPaintEvent* event) -> void
+{
+    QWidget::paintEvent(event);
+
+    if (m_image_dirty || m_image.size() != size())
+    {
+        m_image = render_image(size());
+        m_image_dirty = false;
+    }
+
+    QPainter painter(this);
+    painter.drawImage(0, 0, m_image);
+
+    const int row_count = (m_summary != nullptr) ? m_summary->get_row_count() : 0;
+
+    if (row_count > 0 && m_visible_row_count > 0)
+    {
+        const double pixels_per_row = static_cast<double>(height()) / row_count;
+        const int top = static_cast<int>(m_visible_first_row * pixels_per_row);
+        const int outline_height = qMax(2, qRound(m_visible_row_count * pixels_per_row));
+
+        painter.setPen(QColor::fromRgba(k_page_outline_color));
+        painter.setBrush(Qt::NoBrush);
+        painter.drawRect(0, top, width() - 1, qMin(outline_height, height() - top) - 1);
+    }
+}
+
+/**
+ * @brief Requests the row under the cursor.
+ * @param event The mouse event.
+ */
+auto LevelDensityMinimap::mousePressEvent(QMouseEvent* event) -> void
+{
+    const int row = (event->button() == Qt::LeftButton) ? row_at(event->position().toPoint().y())
+                                                          : -1;
+
+    if (row >= 0)
+    {
+        emit row_requested(row);
+    }
+
+    QWidget::mousePressEvent(event);
+}
+
+/**
+ * @brief Requests the row under the cursor while the left button is held.
+ * @param event The mouse event.
+ */
+auto LevelDensityMinimap::mouseMoveEvent(QMouseEvent* event) -> void
+{
+    const int row = (event->buttons() & Qt::LeftButton) != 0
+                        ? row_at(event->position().toPoint().y())
+                        : -1;
+
+    if (row >= 0)
+    {
+        emit row_requested(row);
+    }
+
+    QWidget::mouseMoveEvent(event);
+}
+
+/**
+ * @brief Invalidates the cached image.
+ * @param event The resize event.
+ */
+auto LevelDensityMinimap::resizeEvent(QResizeEvent* event) -> void
+{
+    QWidget::resizeEvent(event);
+    invalidate_image();
+}
+
+/**
+ * @brief Invalidates the cached image and schedules a repaint.
+ */
+auto LevelDensityMinimap::invalidate_image() -> void
+{
+    m_image_dirty = true;
+    update();
+}
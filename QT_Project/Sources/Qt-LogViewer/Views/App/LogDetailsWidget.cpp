@@ -0,0 +1,538 @@
+/**
+ * @file LogDetailsWidget.cpp
+ * @brief This file contains the implementation of the LogDetailsWidget class.
+ */
+
+#include "Qt-LogViewer/Views/App/LogDetailsWidget.h"
+
+#include <QDebug>
+#include <QEvent>
+#include <QFile>
+#include <QHBoxLayout>
+#include <QJsonDocument>
+#include <QJsonParseError>
+#include <QLabel>
+#include <QLocale>
+#include <QPlainTextEdit>
+#include <QScrollBar>
+#include <QTextCursor>
+#include <QThreadPool>
+#include <QToolButton>
+#include <QVBoxLayout>
+#include <QVector>
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
+
+#include <algorithm>
+
+namespace
+{
+// Bytes decoded and laid out per chunk; a few screens of text even for long lines.
+constexpr qsizetype k_chunk_size = 64 * 1024;
+
+// Payloads up to this size are formatted in place; larger ones on the worker.
+constexpr qsizetype k_sync_pretty_print_size = 16 * 1024;
+
+// Larger payloads are shown raw; formatting them would take seconds and double the memory.
+constexpr qsizetype k_max_pretty_print_size = 16 * 1024 * 1024;
+
+// Distance from the end of the document (in scroll bar pages) that loads the next chunk.
+constexpr int k_load_ahead_pages = 2;
+
+// Longest UTF-8 sequence minus one; read past a chunk to find the sequence boundary.
+constexpr qsizetype k_utf8_lookahead = 3;
+
+/**
+ * @brief Returns the end of a chunk that does not split a UTF-8 sequence.
+ * @param text The UTF-8 text.
+ * @param start The chunk start.
+ * @param max_size The maximum chunk size in bytes.
+ * @return The exclusive chunk end.
+ */
+auto utf8_chunk_end(const QByteArray& text, qsizetype start, qsizetype max_size) -> qsizetype
+{
+    qsizetype end = qMin(text.size(), start + max_size);
+
+    // Continuation bytes (10xxxxxx) belong to the sequence started before them.
+    while (end < text.size() && end > start &&
+           (static_cast<unsigned char>(text.at(end)) & 0xC0) == 0x80)
+    {
+        --end;
+    }
+
+    return end;
+}
+
+/**
+ * @brief Re-indents an XML document.
+ * @param payload The XML text.
+ * @return The formatted XML, or an empty array if it is not well-formed.
+ */
+auto pretty_print_xml(const QByteArray& payload) -> QByteArray
+{
+    QByteArray formatted;
+    QXmlStreamReader reader(payload);
+    QXmlStreamWriter writer(&formatted);
+    writer.setAutoFormatting(true);
+    writer.setAutoFormattingIndent(2);
+
+    while (!reader.atEnd() && !reader.hasError())
+    {
+        reader.readNext();
+
+        // Whitespace between elements is replaced by the writer's own indentation; a missing
+        // XML declaration is not added.
+        const bool skip = reader.tokenType() == QXmlStreamReader::Invalid ||
+                          (reader.isCharacters() && reader.isWhitespace()) ||
+                          (reader.isStartDocument() && reader.documentVersion().isEmpty());
+        if (!skip)
+        {
+            writer.writeCurrentToken(reader);
+        }
+    }
+
+    return reader.hasError() ? QByteArray() : formatted.trimmed();
+}
+}  // namespace
+
+/**
+ * @brief Constructs a LogDetailsWidget.
+ * @param parent The parent widget.
+ */
+LogDetailsWidget::LogDetailsWidget(QWidget* parent)
+    : QWidget(parent),
+      m_text_edit(new QPlainTextEdit(this)),
+      m_pretty_print_button(new QToolButton(this)),
+      m_status_label(new QLabel(this)),
+      m_pool(new QThreadPool(this))
+{
+    // One formatting job at a time; a newer selection supersedes queued ones anyway.
+    m_pool->setMaxThreadCount(1);
+
+    m_text_edit->setObjectName("logDetailsTextEdit");
+    m_text_edit->setReadOnly(true);
+    m_text_edit->setUndoRedoEnabled(false);
+
+    m_pretty_print_button->setObjectName("logDetailsPrettyPrintButton");
+    m_pretty_print_button->setCheckable(true);
+    m_pretty_print_button->setAutoRaise(true);
+    m_status_label->setObjectName("logDetailsStatusLabel");
+    m_status_label->setTextFormat(Qt::RichText);
+
+    auto* status_layout = new QHBoxLayout();
+    status_layout->setContentsMargins(4, 0, 4, 0);
+    status_layout->addWidget(m_status_label, 1);
+    status_layout->addWidget(m_pretty_print_button);
+
+    auto* layout = new QVBoxLayout(this);
+    layout->setContentsMargins(0, 0, 0, 0);
+    layout->setSpacing(0);
+    layout->addWidget(m_text_edit, 1);
+    layout->addLayout(status_layout);
+
+    connect(m_pretty_print_button, &QToolButton::toggled, this,
+            &LogDetailsWidget::set_pretty_print_enabled);
+    connect(m_text_edit->verticalScrollBar(), &QScrollBar::valueChanged, this,
+            &LogDetailsWidget::handle_scrolled);
+    connect(m_status_label, &QLabel::linkActivated, this, [this](const QString&) {
+        load_next_chunk();
+    });
+
+    retranslate();
+    update_status();
+}
+
+/**
+ * @brief Waits for a running pretty print; queued ones are dropped.
+ */
+LogDetailsWidget::~LogDetailsWidget()
+{
+    // Tasks reference this object, so none may outlive it.
+    m_pool->clear();
+    m_pool->waitForDone();
+}
+
+/**
+ * @brief Shows a log entry.
+ * @param entry The entry to show.
+ */
+auto LogDetailsWidget::set_entry(const LogEntry& entry) -> void
+{
+    m_has_entry = true;
+    m_header = QString("Timestamp: %1\nLevel: %2\nApp: %3\n%4: ")
+                   .arg(entry.get_timestamp().toString("yyyy-MM-dd HH:mm:ss"))
+                   .arg(entry.get_level())
+                   .arg(entry.get_app_name())
+                   .arg(entry.is_truncated() ? "Line" : "Message");
+    m_raw_message = entry.get_message_utf8();
+    m_source_path = entry.get_file_info().get_file_path();
+    m_source_offset = entry.get_source_offset();
+    m_source_length = entry.get_source_length();
+
+    apply_message();
+}
+
+/**
+ * @brief Clears the pane.
+ */
+auto LogDetailsWidget::clear() -> void
+{
+    m_has_entry = false;
+    m_header.clear();
+    m_raw_message.clear();
+    m_source_path.clear();
+    m_source_offset = -1;
+    m_source_length = 0;
+
+    apply_message();
+}
+
+/**
+ * @brief Enables or disables pretty printing of JSON/XML payloads.
+ * @param enabled True to pretty print.
+ */
+auto LogDetailsWidget::set_pretty_print_enabled(bool enabled) -> void
+{
+    if (m_pretty_print_button->isChecked() != enabled)
+    {
+        // Re-enters through toggled().
+        m_pretty_print_button->setChecked(enabled);
+    }
+    else
+    {
+        apply_message();
+    }
+}
+
+/**
+ * @brief Checks whether pretty printing is enabled.
+ * @return True if payloads are pretty printed.
+ */
+auto LogDetailsWidget::is_pretty_print_enabled() const -> bool
+{
+    return m_pretty_print_button->isChecked();
+}
+
+/**
+ * @brief Checks whether a pretty print of the shown message is still running.
+ * @return True while a worker formats the message.
+ */
+auto LogDetailsWidget::is_pretty_print_pending() const -> bool
+{
+    return m_pretty_print_pending;
+}
+
+/**
+ * @brief Returns the size of the shown message text (pretty printed, if applicable).
+ * @return The size in UTF-8 bytes.
+ */
+auto LogDetailsWidget::get_message_size() const -> qsizetype
+{
+    return (m_source_offset >= 0) ? m_source_length : m_message.size();
+}
+
+/**
+ * @brief Returns how much of the shown message text is in the document.
+ * @return The loaded size in UTF-8 bytes.
+ */
+auto LogDetailsWidget::get_loaded_message_size() const -> qsizetype
+{
+    return m_loaded_size;
+}
+
+/**
+ * @brief Appends the next chunk of the message to the document.
+ * @return True if a chunk was appended, false if the message is fully loaded.
+ */
+auto LogDetailsWidget::load_next_chunk() -> bool
+{
+    const bool has_more = m_loaded_size < get_message_size();
+
+    if (has_more)
+    {
+        const QByteArray chunk = read_next_chunk();
+        m_updating_document = true;
+
+        // Insert through a separate cursor so the user's selection and scroll position stay.
+        QTextCursor cursor(m_text_edit->document());
+        cursor.movePosition(QTextCursor::End);
+        cursor.insertText(QString::fromUtf8(chunk));
+
+        m_loaded_size += chunk.size();
+        m_updating_document = false;
+        update_status();
+    }
+
+    return has_more;
+}
+
+/**
+ * @brief Returns the text edit showing the entry.
+ * @return Pointer to the QPlainTextEdit.
+ */
+auto LogDetailsWidget::get_text_edit() const -> QPlainTextEdit*
+{
+    return m_text_edit;
+}
+
+/**
+ * @brief Formats a JSON or XML payload contained in a message.
+ *
+ * The payload starts at the first '{', '[' or '<' that yields a valid document and must
+ * extend to the end of the message; text before it is kept on its own line.
+ *
+ * @param message The UTF-8 message.
+ * @return The formatted message, or an empty array if it has no valid payload.
+ */
+auto LogDetailsWidget::pretty_print(const QByteArray& message) -> QByteArray
+{
+    QByteArray result;
+
+    // Try the first occurrence of each opening character, earliest first, so that a prefix
+    // like "[main] " does not hide a JSON object following it.
+    QVector<qsizetype> starts;
+    for (const char opening: {'{', '[', '<'})
+    {
+        const qsizetype index = message.indexOf(opening);
+        if (index >= 0)
+        {
+            starts.append(index);
+        }
+    }
+    std::sort(starts.begin(), starts.end());
+
+    for (qsizetype i = 0; result.isEmpty() && i < starts.size(); ++i)
+    {
+        const qsizetype start = starts.at(i);
+        const QByteArray payload = message.mid(start).trimmed();
+        QByteArray formatted;
+
+        if (payload.startsWith('<'))
+        {
+            formatted = pretty_print_xml(payload);
+        }
+        else
+        {
+            QJsonParseError error;
+            const QJsonDocument document = QJsonDocument::fromJson(payload, &error);
+
+            if (error.error == QJsonParseError::NoError)
+            {
+                formatted = document.toJson(QJsonDocument::Indented).trimmed();
+            }
+        }
+
+        if (!formatted.isEmpty())
+        {
+            const QByteArray prefix = message.left(start).trimmed();
+            result = prefix.isEmpty() ? formatted : prefix + '\n' + formatted;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Returns the number of message bytes decoded per chunk.
+ * @return The chunk size in bytes.
+ */
+auto LogDetailsWidget::get_chunk_size() -> qsizetype
+{
+    return k_chunk_size;
+}
+
+/**
+ * @brief Handles language change events.
+ * @param event The change event.
+ */
+auto LogDetailsWidget::changeEvent(QEvent* event) -> void
+{
+    if (event != nullptr && event->type() == QEvent::LanguageChange)
+    {
+        retranslate();
+        update_status();
+    }
+
+    QWidget::changeEvent(event);
+}
+
+/**
+ * @brief Selects the message text (raw or pretty printed) and renders it.
+ */
+auto LogDetailsWidget::apply_message() -> void
+{
+    // Drop formatting jobs of previous selections; a running one is ignored on arrival.
+    ++m_generation;
+    m_pool->clear();
+    m_pretty_print_pending = false;
+    m_source_error = false;
+    m_message = m_raw_message;
+
+    // A truncated payload is never a valid document.
+    const bool wants_pretty_print = m_has_entry && is_pretty_print_enabled() &&
+                                    m_source_offset < 0 &&
+                                    !m_raw_message.isEmpty() &&
+                                    m_raw_message.size() <= k_max_pretty_print_size;
+
+    if (wants_pretty_print && m_raw_message.size() <= k_sync_pretty_print_size)
+    {
+        const QByteArray formatted = pretty_print(m_raw_message);
+        m_message = formatted.isEmpty() ? m_raw_message : formatted;
+    }
+    else if (wants_pretty_print)
+    {
+        m_pretty_print_pending = true;
+        const quint64 generation = m_generation;
+        const QByteArray message = m_raw_message;
+
+        m_pool->start([this, generation, message]() {
+            const QByteArray formatted = pretty_print(message);
+
+            QMetaObject::invokeMethod(
+                this, [this, generation, formatted]() {
+                    handle_pretty_printed(generation, formatted);
+                },
+                Qt::QueuedConnection);
+        });
+    }
+
+    render();
+}
+
+/**
+ * @brief Replaces the document with the header and the first chunk of the message.
+ */
+auto LogDetailsWidget::render() -> void
+{
+    m_loaded_size = 0;
+    m_updating_document = true;
+    m_text_edit->setPlainText(m_header);
+    m_updating_document = false;
+
+    load_next_chunk();
+
+    m_updating_document = true;
+    m_text_edit->moveCursor(QTextCursor::Start);
+    m_updating_document = false;
+    update_status();
+}
+
+/**
+ * @brief Returns the next chunk of the shown text, from memory or from the source file.
+ * @return The UTF-8 chunk; empty if nothing could be read.
+ */
+auto LogDetailsWidget::read_next_chunk() -> QByteArray
+{
+    QByteArray chunk;
+
+    if (m_source_offset < 0)
+    {
+        const qsizetype end = utf8_chunk_end(m_message, m_loaded_size, k_chunk_size);
+        chunk = m_message.mid(m_loaded_size, end - m_loaded_size);
+    }
+    else
+    {
+        QFile file(m_source_path);
+        const qint64 remaining = m_source_length - m_loaded_size;
+        const bool readable = file.open(QIODevice::ReadOnly) &&
+                              file.size() >= m_source_offset + m_source_length &&
+                              file.seek(m_source_offset + m_loaded_size);
+
+        if (readable)
+        {
+            const QByteArray bytes =
+                file.read(qMin<qint64>(remaining, k_chunk_size + k_utf8_lookahead));
+            const qsizetype end = utf8_chunk_end(bytes, 0, k_chunk_size);
+            chunk = bytes.left(end > 0 ? end : bytes.size());
+        }
+
+        if (chunk.isEmpty())
+        {
+            // The file was removed or rewritten; stop at what is shown.
+            qWarning().nospace() << "[Details] cannot read line at offset " << m_source_offset
+                                 << " of " << m_source_path;
+            m_source_length = m_loaded_size;
+            m_source_error = true;
+        }
+    }
+
+    return chunk;
+}
+
+/**
+ * @brief Shows a pretty printed message if it belongs to the shown entry.
+ * @param generation The generation the print was started for.
+ * @param formatted The formatted message, or empty if it had no valid payload.
+ */
+auto LogDetailsWidget::handle_pretty_printed(quint64 generation, const QByteArray& formatted)
+    -> void
+{
+    if (generation == m_generation)
+    {
+        m_pretty_print_pending = false;
+
+        if (!formatted.isEmpty())
+        {
+            m_message = formatted;
+            render();
+        }
+        else
+        {
+            update_status();
+        }
+    }
+}
+
+/**
+ * @brief Loads the next chunk when the user scrolled close to the end.
+ * @param value The scroll bar value.
+ */
+auto LogDetailsWidget::handle_scrolled(int value) -> void
+{
+    const QScrollBar* scroll_bar = m_text_edit->verticalScrollBar();
+
+    // Range changes caused by inserting a chunk must not load the next one.
+    if (!m_updating_document &&
+        value >= scroll_bar->maximum() - k_load_ahead_pages * scroll_bar->pageStep())
+    {
+        load_next_chunk();
+    }
+}
+
+/**
+ * @brief Updates the status line (loaded size, pending pretty print).
+ */
+auto LogDetailsWidget::update_status() -> void
+{
+    QString status;
+    const QLocale locale;
+
+    if (m_loaded_size < get_message_size())
+    {
+        status = tr("Showing %1 of %2. <a href=\"more\">Load more</a>")
+                     .arg(locale.formattedDataSize(m_loaded_size),
+                          locale.formattedDataSize(get_message_size()));
+    }
+
+    if (m_source_error)
+    {
+        status = tr("The full line could not be read from the file.");
+    }
+
+    if (m_pretty_print_pending)
+    {
+        status = status.isEmpty() ? tr("Formatting...")
+                                  : tr("%1 (formatting...)").arg(status);
+    }
+
+    m_status_label->setText(status);
+}
+
+/**
+ * @brief Sets translatable texts.
+ */
+auto LogDetailsWidget::retranslate() -> void
+{
+    m_pretty_print_button->setText(tr("Pretty Print"));
+    m_pretty_print_button->setToolTip(tr("Format JSON and XML payloads of the message"));
+}
@@ -1,6 +1,7 @@
 #include "Qt-LogViewer/Views/App/LogFileExplorer.h"
 
 #include <QCursor>
+#include <QFileDialog>
 #include <QFileInfo>
 #include <QInputDialog>
 #include <QMessageBox>
@@ -191,9 +192,9 @@ auto LogFileExplorer::init_context_menu() -> void
             [this](const LogFileInfo& info) { emit add_to_current_view_requested(info); });
     });
 
-    auto* remove_file_action = new QAction(tr("Remove"), m_file_context_menu);
-    m_file_context_menu->addAction(remove_file_action);
-    connect(remove_file_action, &QAction::triggered, this, [this]() {
+    m_remove_file_action = new QAction(tr("Remove"), m_file_context_menu);
+    m_file_context_menu->addAction(m_remove_file_action);
+    connect(m_remove_file_action, &QAction::triggered, this, [this]() {
         [[maybe_unused]] const bool dispatched = dispatch_current_if_type(
             LogFileTreeItem::Type::File,
             [this](const LogFileInfo& info) { emit remove_file_requested(info); });
@@ -240,6 +241,23 @@ auto LogFileExplorer::init_context_menu() -> void
         }
     });
 
+    auto* add_watch_folder_action = new QAction(tr("Add Watch Folder..."), m_session_context_menu);
+    m_session_context_menu->addAction(add_watch_folder_action);
+    connect(add_watch_folder_action, &QAction::triggered, this, [this]() {
+        const QModelIndex index = ui->treeView->currentIndex();
+        if (index.isValid() && get_item_type(index) == LogFileTreeItem::Type::Session)
+        {
+            const QString session_id = index.data(LogFileTreeModel::SessionIdRole).toString();
+            const QString folder_path =
+                QFileDialog::getExistingDirectory(this, tr("Add Watch Folder"));
+
+            if (!folder_path.isEmpty())
+            {
+                emit add_watch_folder_requested(session_id, folder_path);
+            }
+        }
+    });
+
     m_session_context_menu->addSeparator();
 
     auto* close_session_action = new QAction(tr("Close Session"), m_session_context_menu);
@@ -278,6 +296,38 @@ auto LogFileExplorer::init_context_menu() -> void
 
     // Group context menu (empty for now, can be extended later)
     m_group_context_menu = new QMenu(this);
+
+    // Folder context menu
+    m_folder_context_menu = new QMenu(this);
+
+    auto* open_watch_folder_action = new QAction(tr("Open Folder"), m_folder_context_menu);
+    m_folder_context_menu->addAction(open_watch_folder_action);
+    connect(open_watch_folder_action, &QAction::triggered, this, [this]() {
+        const QModelIndex index = ui->treeView->currentIndex();
+        if (index.isValid() && get_item_type(index) == LogFileTreeItem::Type::Folder)
+        {
+            const QString folder_path = index.data(LogFileTreeModel::FolderPathRole).toString();
+            const bool opened = DesktopServices::open_folder(folder_path);
+
+            if (!opened)
+            {
+                QMessageBox::warning(this, tr("Open Folder"),
+                                     tr("Could not open folder:\n%1").arg(folder_path));
+            }
+        }
+    });
+
+    m_remove_watch_folder_action = new QAction(tr("Stop Watching"), m_folder_context_menu);
+    m_folder_context_menu->addAction(m_remove_watch_folder_action);
+    connect(m_remove_watch_folder_action, &QAction::triggered, this, [this]() {
+        const QModelIndex index = ui->treeView->currentIndex();
+        if (index.isValid() && get_item_type(index) == LogFileTreeItem::Type::Folder)
+        {
+            const QString session_id = index.data(LogFileTreeModel::SessionIdRole).toString();
+            const QString folder_path = index.data(LogFileTreeModel::FolderPathRole).toString();
+            emit remove_watch_folder_requested(session_id, folder_path);
+        }
+    });
 }
 
 /**
@@ -295,8 +345,18 @@ auto LogFileExplorer::show_context_menu(const QPoint& pos) -> void
 
         if (type == LogFileTreeItem::Type::File)
         {
+            // Files listed from a watch folder follow the folder and cannot be removed singly
+            m_remove_file_action->setEnabled(get_item_type(index.parent()) ==
+                                             LogFileTreeItem::Type::Group);
             m_file_context_menu->exec(global_pos);
         }
+        else if (type == LogFileTreeItem::Type::Folder)
+        {
+            // Only watch folders themselves (direct children of a session) can be removed
+            m_remove_watch_folder_action->setEnabled(get_item_type(index.parent()) ==
+                                                     LogFileTreeItem::Type::Session);
+            m_folder_context_menu->exec(global_pos);
+        }
         else if (type == LogFileTreeItem::Type::Session)
         {
             m_session_context_menu->exec(global_pos);
@@ -98,6 +98,27 @@ auto LogFilterBarWidget::set_log_level_counts(const QMap<QString, int>& level_co
     ui->logFilterWidget->set_log_level_counts(level_counts);
 }
 
+/**
+ * @brief Sets the total and the matching count for each log level in the filter widget.
+ * @param level_counts Map of log level name to count over all entries.
+ * @param matched_counts Map of log level name to count over the entries passing the current
+ *        filters.
+ */
+auto LogFilterBarWidget::set_log_level_counts(const QMap<QString, int>& level_counts,
+                                              const QMap<QString, int>& matched_counts) -> void
+{
+    ui->logFilterWidget->set_log_level_counts(level_counts, matched_counts);
+}
+
+/**
+ * @brief Shows the matching count per application in the application combo box.
+ * @param app_counts Map of application name to matching count.
+ */
+auto LogFilterBarWidget::set_app_match_counts(const QMap<QString, int>& app_counts) -> void
+{
+    ui->logFilterWidget->set_app_match_counts(app_counts);
+}
+
 /**
  * @brief Sets the available search fields in the search bar widget.
  *
@@ -196,18 +196,55 @@ auto LogFilterWidget::set_log_levels(const QSet<QString>& levels) -> void
  * @param level_counts Map of log level name to count.
  */
 auto LogFilterWidget::set_log_level_counts(const QMap<QString, int>& level_counts) -> void
+{
+    set_log_level_counts(level_counts, level_counts);
+}
+
+/**
+ * @brief Sets the total and the matching count for each log level and updates the UI.
+ *        Log level names are normalized for matching.
+ *
+ * @param level_counts Map of log level name to count over all entries.
+ * @param matched_counts Map of log level name to count over the entries passing the current
+ *        filters.
+ */
+auto LogFilterWidget::set_log_level_counts(const QMap<QString, int>& level_counts,
+                                           const QMap<QString, int>& matched_counts) -> void
 {
     QMap<QString, int> normalized_counts;
+    QMap<QString, int> normalized_matched;
 
     for (auto it = level_counts.begin(); it != level_counts.end(); ++it)
     {
-        normalized_counts[it.key().trimmed().toLower()] = it.value();
+        normalized_counts[it.key().trimmed().toLower()] += it.value();
+    }
+
+    for (auto it = matched_counts.begin(); it != matched_counts.end(); ++it)
+    {
+        normalized_matched[it.key().trimmed().toLower()] += it.value();
     }
 
     for (auto it = m_log_level_items.begin(); it != m_log_level_items.end(); ++it)
     {
-        int count = normalized_counts.value(it.key(), 0);
-        it.value()->set_count(count);
+        it.value()->set_counts(normalized_matched.value(it.key(), 0),
+                               normalized_counts.value(it.key(), 0));
+    }
+}
+
+/**
+ * @brief Shows the number of entries passing the current filters per application as tooltips of
+ *        the application combo box.
+ *
+ * @param app_counts Map of application name to matching count.
+ */
+auto LogFilterWidget::set_app_match_counts(const QMap<QString, int>& app_counts) -> void
+{
+    // Index 0 is the "show all" entry, which keeps its own tooltip.
+    for (int i = 1; i < ui->comboBoxApp->count(); ++i)
+    {
+        const int count = app_counts.value(ui->comboBoxApp->itemText(i), 0);
+        ui->comboBoxApp->setItemData(i, tr("%n matching entries", nullptr, count),
+                                     Qt::ToolTipRole);
     }
 }
 
@@ -59,6 +59,29 @@ auto LogLevelFilterItemWidget::set_count_text(const QString& count_text) -> void
 auto LogLevelFilterItemWidget::set_count(int count) -> void
 {
     ui->labelCount->setText(NumberFormatUtils::format_number_abbreviated(count));
+    ui->labelCount->setToolTip(QString());
+}
+
+/**
+ * @brief Sets the count label to the entries passing the current filters and the total.
+ *        Shows "matched / total" while they differ, otherwise the total alone.
+ * @param matched The number of entries passing the filters.
+ * @param total The number of entries.
+ */
+auto LogLevelFilterItemWidget::set_counts(int matched, int total) -> void
+{
+    if (matched == total)
+    {
+        set_count(total);
+    }
+    else
+    {
+        ui->labelCount->setText(NumberFormatUtils::format_number_abbreviated(matched) +
+                                QStringLiteral(" / ") +
+                                NumberFormatUtils::format_number_abbreviated(total));
+        ui->labelCount->setToolTip(tr("%1 of %2 entries match the current filters")
+                                       .arg(QString::number(matched), QString::number(total)));
+    }
 }
 
 /**
@@ -94,6 +117,7 @@ auto LogLevelFilterItemWidget::get_log_level_name() const -> QString
 auto LogLevelFilterItemWidget::clear() -> void
 {
     ui->labelCount->setText("0");
+    ui->labelCount->setToolTip(QString());
     ui->checkBox->setChecked(false);
 }
 
@@ -0,0 +1,436 @@
+/**
+ * @file LogRowPrefetcher.cpp
+ * @brief This file contains the implementation of the LogRowPrefetcher class.
+ */
+
+#include "Qt-LogViewer/Views/App/LogRowPrefetcher.h"
+
+#include <QAbstractProxyModel>
+#include <QThreadPool>
+#include <cmath>
+
+#include "Qt-LogViewer/Models/LogEntryStore.h"
+#include "Qt-LogViewer/Models/LogModel.h"
+#include "Qt-LogViewer/Models/PagingProxyModel.h"
+
+namespace
+{
+// Rows decoded per prefetch at most; a few pages of a large page size.
+constexpr int k_max_prefetch_rows = 2048;
+
+// Without paging, the window reaches as far ahead as the view scrolls in this time.
+constexpr double k_lookahead_seconds = 0.5;
+
+// A pause longer than this restarts the velocity estimate instead of smoothing it.
+constexpr qint64 k_velocity_reset_ms = 1000;
+}  // namespace
+
+/**
+ * @brief Constructs an idle prefetcher.
+ * @param parent The parent QObject, or nullptr.
+ */
+LogRowPrefetcher::LogRowPrefetcher(QObject* parent)
+    : QObject(parent), m_pool(new QThreadPool(this))
+{
+    // One prefetch at a time; a newer viewport supersedes the running one anyway.
+    m_pool->setMaxThreadCount(1);
+}
+
+/**
+ * @brief Cancels the running prefetch and waits for the worker.
+ */
+LogRowPrefetcher::~LogRowPrefetcher()
+{
+    // Tasks reference this object, so none may outlive it.
+    cancel();
+    m_pool->waitForDone();
+}
+
+/**
+ * @brief Sets the model shown by the view.
+ *
+ * The model may be a PagingProxyModel, further proxies or the LogModel itself; without a
+ * LogModel at the bottom of the proxy chain nothing is prefetched.
+ *
+ * @param model The view's model, or nullptr.
+ */
+auto LogRowPrefetcher::set_model(QAbstractItemModel* model) -> void
+{
+    cancel();
+    disconnect(m_reset_connection);
+
+    m_model = model;
+    m_paging_proxy = qobject_cast<PagingProxyModel*>(model);
+
+    QAbstractItemModel* bottom = model;
+    auto* proxy = qobject_cast<QAbstractProxyModel*>(bottom);
+
+    while (proxy != nullptr)
+    {
+        bottom = proxy->sourceModel();
+        proxy = qobject_cast<QAbstractProxyModel*>(bottom);
+    }
+
+    m_log_model = qobject_cast<LogModel*>(bottom);
+
+    if (m_log_model != nullptr)
+    {
+        // Rows decoded from the old entries must not reach the cache of the new ones.
+        m_reset_connection = connect(m_log_model, &QAbstractItemModel::modelAboutToBeReset, this,
+                                     &LogRowPrefetcher::cancel);
+    }
+
+    m_last_first_row = -1;
+    m_velocity = 0.0;
+    m_direction = 0;
+}
+
+/**
+ * @brief Updates the rows shown and starts a prefetch if they left the warmed window.
+ * @param first_row The first visible row of the view's model.
+ * @param last_row The last visible row of the view's model.
+ */
+auto LogRowPrefetcher::update_viewport(int first_row, int last_row) -> void
+{
+    if (m_log_model != nullptr && first_row >= 0 && last_row >= first_row)
+    {
+        const int page_offset = get_page_offset();
+        const int first_flat = page_offset + first_row;
+        const int last_flat = page_offset + last_row;
+        const qint64 elapsed_ms = m_scroll_timer.isValid() ? m_scroll_timer.restart() : -1;
+
+        if (!m_scroll_timer.isValid())
+        {
+            m_scroll_timer.start();
+        }
+
+        if (m_last_first_row >= 0 && elapsed_ms > 0)
+        {
+            const double velocity =
+                static_cast<double>(first_flat - m_last_first_row) * 1000.0 /
+                static_cast<double>(elapsed_ms);
+            m_velocity = (elapsed_ms > k_velocity_reset_ms) ? velocity
+                                                            : (m_velocity + velocity) / 2.0;
+        }
+
+        if (m_last_first_row >= 0 && first_flat != m_last_first_row)
+        {
+            m_direction = (first_flat > m_last_first_row) ? 1 : -1;
+        }
+
+        m_last_first_row = first_flat;
+
+        const QVector<Range> ranges = get_target_ranges(first_flat, last_flat);
+        const Range window = get_span(ranges);
+
+        if (needs_prefetch(first_flat, last_flat, window))
+        {
+            start(ranges, window);
+        }
+    }
+}
+
+/**
+ * @brief Cancels the running prefetch and forgets the warmed window.
+ */
+auto LogRowPrefetcher::cancel() -> void
+{
+    ++m_generation;
+    m_pool->clear();
+    m_busy = false;
+    m_window = Range{};
+    m_window_page_offset = -1;
+}
+
+/**
+ * @brief Checks whether a prefetch is running.
+ * @return True while the worker decodes.
+ */
+auto LogRowPrefetcher::is_busy() const -> bool
+{
+    return m_busy;
+}
+
+/**
+ * @brief Returns the smoothed scroll velocity.
+ * @return Rows per second; negative when scrolling up.
+ */
+auto LogRowPrefetcher::get_velocity() const -> double
+{
+    return m_velocity;
+}
+
+/**
+ * @brief Returns the model the pages are cut from (the paging proxy's source).
+ * @return The flat model, or nullptr.
+ */
+auto LogRowPrefetcher::get_flat_model() const -> QAbstractItemModel*
+{
+    QAbstractItemModel* model = m_model.data();
+
+    if (m_paging_proxy != nullptr)
+    {
+        model = m_paging_proxy->sourceModel();
+    }
+
+    return model;
+}
+
+/**
+ * @brief Returns the flat row of the first row on the current page.
+ * @return The offset; 0 without paging.
+ */
+auto LogRowPrefetcher::get_page_offset() const -> int
+{
+    int offset = 0;
+
+    if (m_paging_proxy != nullptr && m_paging_proxy->is_paging_enabled())
+    {
+        offset = (m_paging_proxy->get_current_page() - 1) * m_paging_proxy->get_page_size();
+    }
+
+    return offset;
+}
+
+/**
+ * @brief Returns the ranges to warm for a viewport, in priority order.
+ *
+ * The viewport itself comes first, so that repaints hit the cache as well. With paging, the rest
+ * of the current page and the neighbouring pages follow; without paging, a window reaching ahead
+ * by the scroll velocity (and one viewport back).
+ *
+ * @param first_flat The first visible flat row.
+ * @param last_flat The last visible flat row.
+ * @return The ranges (clipped to the model, possibly empty).
+ */
+auto LogRowPrefetcher::get_target_ranges(int first_flat, int last_flat) const -> QVector<Range>
+{
+    QVector<Range> ranges;
+    const QAbstractItemModel* flat_model = get_flat_model();
+
+    if (flat_model != nullptr)
+    {
+        const int row_count = flat_model->rowCount();
+        const int visible = last_flat - first_flat + 1;
+        const bool down = (m_direction >= 0);
+
+        ranges.append(Range{first_flat, last_flat});
+
+        if (m_paging_proxy != nullptr && m_paging_proxy->is_paging_enabled())
+        {
+            const int page_size = m_paging_proxy->get_page_size();
+            const int page_first = get_page_offset();
+            const int page_last = page_first + page_size - 1;
+            const Range below{last_flat + 1, page_last};
+            const Range above{page_first, first_flat - 1};
+            const Range next{page_last + 1, page_last + page_size};
+            const Range previous{page_first - page_size, page_first - 1};
+
+            ranges += down ? QVector<Range>{below, above, next, previous}
+                           : QVector<Range>{above, below, previous, next};
+        }
+        else
+        {
+            const int speed = static_cast<int>(std::abs(m_velocity) * k_lookahead_seconds);
+            const int lookahead = qBound(visible, visible + speed, k_max_prefetch_rows);
+            const Range below{last_flat + 1, last_flat + (down ? lookahead : visible)};
+            const Range above{first_flat - (down ? visible : lookahead), first_flat - 1};
+
+            ranges += down ? QVector<Range>{below, above} : QVector<Range>{above, below};
+        }
+
+        for (auto& range: ranges)
+        {
+            range.first = qMax(range.first, 0);
+            range.last = qMin(range.last, row_count - 1);
+        }
+    }
+
+    return ranges;
+}
+
+/**
+ * @brief Returns the smallest range spanning all non-empty ranges.
+ * @param ranges The ranges.
+ * @return The span, or an empty range.
+ */
+auto LogRowPrefetcher::get_span(const QVector<Range>& ranges) -> Range
+{
+    Range span;
+
+    for (const auto& range: ranges)
+    {
+        if (range.first <= range.last)
+        {
+            const bool span_empty = (span.first > span.last);
+            span.first = span_empty ? range.first : qMin(span.first, range.first);
+            span.last = span_empty ? range.last : qMax(span.last, range.last);
+        }
+    }
+
+    return span;
+}
+
+/**
+ * @brief Checks whether the warmed window still serves a viewport.
+ *
+ * With paging, the targets only change with the page or the row count, so any difference to the
+ * warmed window needs a new prefetch. Without paging, the window moves with every scroll step; a
+ * new prefetch starts once the viewport comes within one viewport of the warmed window's edge.
+ *
+ * @param first_flat The first visible flat row.
+ * @param last_flat The last visible flat row.
+ * @param window The window the targets of this viewport span.
+ * @return True if a new prefetch is needed.
+ */
+auto LogRowPrefetcher::needs_prefetch(int first_flat, int last_flat, const Range& window) const
+    -> bool
+{
+    bool needed = (m_window.first > m_window.last);
+
+    if (!needed && m_paging_proxy != nullptr && m_paging_proxy->is_paging_enabled())
+    {
+        needed = (window.first != m_window.first) || (window.last != m_window.last) ||
+                 (get_page_offset() != m_window_page_offset);
+    }
+    else if (!needed)
+    {
+        const int visible = last_flat - first_flat + 1;
+        needed = (window.last > m_window.last && last_flat + visible > m_window.last) ||
+                 (window.first < m_window.first && first_flat - visible < m_window.first);
+    }
+
+    return needed;
+}
+
+/**
+ * @brief Maps a flat row down the proxy chain to a LogModel row.
+ * @param flat_row The flat row.
+ * @return The LogModel row, or -1.
+ */
+auto LogRowPrefetcher::map_to_log_row(int flat_row) const -> int
+{
+    int row = -1;
+    QAbstractItemModel* model = get_flat_model();
+
+    if (model != nullptr)
+    {
+        QModelIndex index = model->index(flat_row, 0);
+        const auto* proxy = qobject_cast<const QAbstractProxyModel*>(model);
+
+        while (proxy != nullptr)
+        {
+            index = proxy->mapToSource(index);
+            proxy = qobject_cast<const QAbstractProxyModel*>(proxy->sourceModel());
+        }
+
+        row = index.isValid() ? index.row() : -1;
+    }
+
+    return row;
+}
+
+/**
+ * @brief Starts decoding the uncached rows of the given ranges on the worker.
+ * @param ranges The ranges in priority order.
+ * @param window The span of the ranges, remembered as the warmed window.
+ */
+auto LogRowPrefetcher::start(const QVector<Range>& ranges, const Range& window) -> void
+{
+    cancel();
+    m_window = window;
+    m_window_page_offset = get_page_offset();
+
+    QVector<int> rows;
+    QVector<quint64> row_ids;
+
+    for (qsizetype i = 0; i < ranges.size() && rows.size() < k_max_prefetch_rows; ++i)
+    {
+        const Range& range = ranges.at(i);
+
+        for (int flat_row = range.first;
+             flat_row <= range.last && rows.size() < k_max_prefetch_rows; ++flat_row)
+        {
+            const int row = map_to_log_row(flat_row);
+            const quint64 row_id = m_log_model->get_row_id(row);
+
+            if (row_id != 0 && !m_log_model->is_message_decoded(row_id))
+            {
+                rows.append(row);
+                row_ids.append(row_id);
+            }
+        }
+    }
+
+    if (!rows.isEmpty())
+    {
+        const LogEntryStore::Snapshot snapshot = m_log_model->get_snapshot();
+        const quint64 generation = m_generation.load();
+        m_busy = true;
+
+        m_pool->start([this, snapshot, rows, row_ids, generation]() {
+            QVector<quint64> decoded_ids;
+            QVector<QString> messages;
+            decoded_ids.reserve(row_ids.size());
+            messages.reserve(row_ids.size());
+
+            for (qsizetype i = 0; i < rows.size() && m_generation.load() == generation; ++i)
+            {
+                if (rows.at(i) < snapshot.size())
+                {
+                    decoded_ids.append(row_ids.at(i));
+                    messages.append(snapshot.at(rows.at(i)).get_message());
+                }
+            }
+
+            QMetaObject::invokeMethod(
+                this,
+                [this, generation, decoded_ids, messages]() {
+                    handle_decoded(generation, decoded_ids, messages);
+                },
+                Qt::QueuedConnection);
+        });
+    }
+}
+
+/**
+ * @brief Hands the worker's results to the model if they are still current.
+ *
+ * Appends to the model (e.g. a tailed or still-loading file) leave the decoded rows valid, so
+ * the results are checked per row id: messages of rows the model no longer has are dropped.
+ *
+ * @param generation The generation the prefetch was started with.
+ * @param row_ids The row ids.
+ * @param messages The decoded messages.
+ */
+auto LogRowPrefetcher::handle_decoded(quint64 generation, const QVector<quint64>& row_ids,
+                                      const QVector<QString>& messages) -> void
+{
+    if (generation == m_generation.load())
+    {
+        m_busy = false;
+
+        if (m_log_model != nullptr)
+        {
+            QVector<quint64> current_ids;
+            QVector<QString> current_messages;
+            current_ids.reserve(row_ids.size());
+            current_messages.reserve(row_ids.size());
+
+            for (qsizetype i = 0; i < row_ids.size() && i < messages.size(); ++i)
+            {
+                if (m_log_model->find_row(row_ids.at(i)) >= 0)
+                {
+                    current_ids.append(row_ids.at(i));
+                    current_messages.append(messages.at(i));
+                }
+            }
+
+            if (!current_ids.isEmpty())
+            {
+                m_log_model->add_decoded_messages(current_ids, current_messages);
+                emit rows_prefetched(static_cast<int>(current_ids.size()));
+            }
+        }
+    }
+}
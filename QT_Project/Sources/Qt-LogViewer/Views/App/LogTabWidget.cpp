@@ -1,9 +1,16 @@
 #include "Qt-LogViewer/Views/App/LogTabWidget.h"
 
+#include <QSignalBlocker>
 #include <QTabBar>
 
 #include "Qt-LogViewer/Views/App/LogViewWidget.h"
 
+namespace
+{
+// Dynamic property holding the view id of a placeholder tab page.
+constexpr auto k_placeholder_view_id_property = "placeholder_view_id";
+}  // namespace
+
 /**
  * @brief Constructs a LogTabWidget object.
  * @param parent The parent widget, or nullptr.
@@ -68,9 +75,7 @@ auto LogTabWidget::find_view_index(const QUuid& view_id) const -> int
 
     for (int i = 0; i < tab_count && !tab_removed; ++i)
     {
-        auto* log_view_widget = log_view_at(i);
-
-        if (log_view_widget != nullptr && log_view_widget->get_view_id() == view_id)
+        if (view_id_at(i) == view_id)
         {
             result = i;
             tab_removed = true;
@@ -80,6 +85,95 @@ auto LogTabWidget::find_view_index(const QUuid& view_id) const -> int
     return result;
 }
 
+/**
+ * @brief Returns the view id of a tab, for LogViewWidget and placeholder tabs alike.
+ * @param index The tab index.
+ * @return The view id, or a null id if the index is invalid.
+ */
+auto LogTabWidget::view_id_at(int index) const -> QUuid
+{
+    QUuid result;
+    auto* log_view_widget = log_view_at(index);
+
+    if (log_view_widget != nullptr)
+    {
+        result = log_view_widget->get_view_id();
+    }
+    else if (is_placeholder_at(index))
+    {
+        result = widget(index)->property(k_placeholder_view_id_property).toUuid();
+    }
+
+    return result;
+}
+
+/**
+ * @brief Checks whether a tab is a placeholder for a not yet materialized view.
+ * @param index The tab index.
+ * @return True if the tab is a placeholder.
+ */
+auto LogTabWidget::is_placeholder_at(int index) const -> bool
+{
+    bool result = false;
+
+    if (index >= 0 && index < count() && widget(index) != nullptr)
+    {
+        result = widget(index)->property(k_placeholder_view_id_property).isValid();
+    }
+
+    return result;
+}
+
+/**
+ * @brief Adds a placeholder tab for a deferred view without selecting it.
+ * @param view_id The view identifier.
+ * @param tab_title The tab title.
+ * @return New tab index.
+ */
+auto LogTabWidget::add_placeholder_tab(const QUuid& view_id, const QString& tab_title) -> int
+{
+    auto* placeholder = new QWidget(this);
+    placeholder->setProperty(k_placeholder_view_id_property, view_id);
+
+    const int result = addTab(placeholder, tab_title);
+
+    return result;
+}
+
+/**
+ * @brief Replaces a placeholder tab by its LogViewWidget, keeping title and selection.
+ * @param index The placeholder tab index.
+ * @param log_view_widget The view widget to insert.
+ * @return True if the placeholder was replaced; otherwise false.
+ */
+auto LogTabWidget::replace_placeholder_tab(int index, LogViewWidget* log_view_widget) -> bool
+{
+    bool result = false;
+
+    if (log_view_widget != nullptr && is_placeholder_at(index))
+    {
+        const QSignalBlocker blocker(this);
+        QWidget* placeholder = widget(index);
+        const QString title = tabText(index);
+        const QString tool_tip = tabToolTip(index);
+        const bool was_current = (currentIndex() == index);
+
+        removeTab(index);
+        insertTab(index, log_view_widget, title);
+        setTabToolTip(index, tool_tip);
+
+        if (was_current)
+        {
+            setCurrentIndex(index);
+        }
+
+        placeholder->deleteLater();
+        result = true;
+    }
+
+    return result;
+}
+
 /**
  * @brief Sets file paths on a view tab identified by view id.
  * @param view_id The view identifier.
@@ -1,7 +1,32 @@
 #include "Qt-LogViewer/Views/App/LogTableView.h"
 
 #include <QAbstractItemView>
+#include <QEvent>
 #include <QHeaderView>
+#include <QScrollBar>
+
+#include "Qt-LogViewer/Models/PagingProxyModel.h"
+
+namespace
+{
+// Rows measured after a reset and per inserted batch; bounded regardless of the view size.
+constexpr int k_reset_sample_rows = 512;
+constexpr int k_batch_sample_rows = 64;
+
+// Padding added to the measured text (cell margins, sort indicator slack).
+constexpr int k_cell_padding = 24;
+
+// No content-sized column may take more than this share of the viewport.
+constexpr double k_max_column_share = 0.35;
+
+// The message column keeps at least this share of the viewport.
+constexpr double k_min_message_share = 0.30;
+
+// Fallback shares used before any row was sampled.
+constexpr double k_fallback_timestamp_share = 0.15;
+constexpr double k_fallback_level_share = 0.10;
+constexpr double k_fallback_app_name_share = 0.15;
+}  // namespace
 
 /**
  * @brief Constructs a LogTableView object.
@@ -28,12 +53,19 @@ LogTableView::LogTableView(QWidget* parent): TableView(parent)
             });
 
     setSortingEnabled(true);
+    m_width_sampler.set_font_metrics(fontMetrics());
+
+    // Decode the rows around the viewport before they are painted
+    m_prefetcher = new LogRowPrefetcher(this);
+    connect(verticalScrollBar(), &QScrollBar::valueChanged, this, &LogTableView::update_prefetch);
 }
 
 /**
- * @brief Automatically resizes the columns based on the current viewport size.
+ * @brief Automatically resizes the columns to their sampled content.
  *
- * This method sets the column widths proportionally for the log table.
+ * Every column except the message and the trailing spacer gets the width of its widest
+ * sampled text (capped to a share of the viewport); the message column takes the rest.
+ * Without sampled rows the columns fall back to fixed shares of the viewport.
  * Call this after the model is set or when the parent window is resized.
  */
 auto LogTableView::auto_resize_columns() -> void
@@ -42,20 +74,54 @@ auto LogTableView::auto_resize_columns() -> void
 
     if (valid_model)
     {
-        int total_width = viewport()->width();
-        int col_0_width = static_cast<int>(total_width * 0.15);
-        int col_1_width = static_cast<int>(total_width * 0.10);
-        int col_2_width = static_cast<int>(total_width * 0.50);
-        int col_3_width = static_cast<int>(total_width * 0.15);
-
-        setColumnWidth(LogModel::Timestamp, col_0_width);
-        setColumnWidth(LogModel::Level, col_1_width);
-        setColumnWidth(LogModel::Message, col_2_width);
-        setColumnWidth(LogModel::AppName, col_3_width);
-#ifdef QT_DEBUG_VERBOSE
-        qDebug() << "Resizing columns to widths:" << col_0_width << col_1_width << col_2_width
-                 << col_3_width;
-#endif
+        m_width_sampler.sample_rows(*model(), get_visible_rows());
+
+        const int total_width = viewport()->width();
+        const int stretch_column = model()->columnCount() - 1;
+        const bool has_samples = m_width_sampler.get_sampled_row_count() > 0;
+        const int max_column_width = static_cast<int>(total_width * k_max_column_share);
+        int used_width = 0;
+
+        for (int column = 0; column < stretch_column; ++column)
+        {
+            if (column != LogModel::Message)
+            {
+                int width = 0;
+
+                if (has_samples)
+                {
+                    const int content = m_width_sampler.get_content_width(column) + k_cell_padding;
+                    const int header_width = horizontalHeader()->sectionSizeHint(column);
+                    width = qMin(qMax(content, header_width), qMax(max_column_width, 1));
+                }
+                else if (column == LogModel::Timestamp)
+                {
+                    width = static_cast<int>(total_width * k_fallback_timestamp_share);
+                }
+                else if (column == LogModel::Level)
+                {
+                    width = static_cast<int>(total_width * k_fallback_level_share);
+                }
+                else if (column == LogModel::AppName)
+                {
+                    width = static_cast<int>(total_width * k_fallback_app_name_share);
+                }
+                else
+                {
+                    // Extra columns keep their width until there is content to size them by.
+                    width = columnWidth(column);
+                }
+
+                setColumnWidth(column, width);
+                used_width += width;
+            }
+        }
+
+        const int message_width = qMax(total_width - used_width,
+                                       static_cast<int>(total_width * k_min_message_share));
+        setColumnWidth(LogModel::Message, message_width);
+        qDebug() << "Resizing columns, message width:" << message_width
+                 << "sampled rows:" << m_width_sampler.get_sampled_row_count();
     }
     else
     {
@@ -63,20 +129,190 @@ auto LogTableView::auto_resize_columns() -> void
     }
 }
 
+/**
+ * @brief Returns the column width statistics.
+ * @return The sampler (read-only).
+ */
+auto LogTableView::get_width_sampler() const -> const ColumnWidthSampler&
+{
+    return m_width_sampler;
+}
+
+/**
+ * @brief Returns the prefetcher that decodes the rows around the viewport ahead of time.
+ * @return The prefetcher (owned by the view).
+ */
+auto LogTableView::get_prefetcher() const -> LogRowPrefetcher*
+{
+    return m_prefetcher;
+}
+
 /**
  * @brief Sets the model for the table view.
  * @param model The model to set (should be a LogModel or compatible).
  */
 void LogTableView::setModel(QAbstractItemModel* model)
 {
+    if (this->model() != nullptr)
+    {
+        disconnect(this->model(), &QAbstractItemModel::modelReset, this,
+                   &LogTableView::update_prefetch);
+        disconnect(this->model(), &QAbstractItemModel::rowsInserted, this,
+                   &LogTableView::update_prefetch);
+    }
+
     TableView::setModel(model);
 
-    auto* header = horizontalHeader();
-    int column_count = this->model()->columnCount();
+    if (model != nullptr)
+    {
+        connect(model, &QAbstractItemModel::columnsInserted, this,
+                &LogTableView::update_section_resize_modes, Qt::UniqueConnection);
+        connect(model, &QAbstractItemModel::columnsRemoved, this,
+                &LogTableView::update_section_resize_modes, Qt::UniqueConnection);
+        connect(model, &QAbstractItemModel::modelReset, this,
+                &LogTableView::update_section_resize_modes, Qt::UniqueConnection);
+        // Queued, so the rows are laid out before the viewport is read.
+        connect(model, &QAbstractItemModel::modelReset, this, &LogTableView::update_prefetch,
+                static_cast<Qt::ConnectionType>(Qt::QueuedConnection | Qt::UniqueConnection));
+        connect(model, &QAbstractItemModel::rowsInserted, this, &LogTableView::update_prefetch,
+                static_cast<Qt::ConnectionType>(Qt::QueuedConnection | Qt::UniqueConnection));
+    }
+
+    m_prefetcher->set_model(model);
+    set_sample_model(model);
+    update_section_resize_modes();
+    resample_width_statistics();
+}
+
+/**
+ * @brief Drops the width statistics when the font changes.
+ * @param event The change event.
+ */
+void LogTableView::changeEvent(QEvent* event)
+{
+    TableView::changeEvent(event);
+
+    if (event != nullptr && event->type() == QEvent::FontChange)
+    {
+        m_width_sampler.set_font_metrics(fontMetrics());
+        resample_width_statistics();
+    }
+}
+
+/**
+ * @brief Applies section resize modes: interactive columns and a stretching last column.
+ *
+ * Re-run whenever the column set changes (e.g. extra format columns get registered).
+ */
+auto LogTableView::update_section_resize_modes() -> void
+{
+    if (model() != nullptr)
+    {
+        auto* header = horizontalHeader();
+        const int column_count = model()->columnCount();
+
+        for (int i = 0; i < column_count; ++i)
+        {
+            header->setSectionResizeMode(
+                i, ((i == (column_count - 1)) ? QHeaderView::Stretch : QHeaderView::Interactive));
+        }
+    }
+}
+
+/**
+ * @brief Sets the model the width statistics are drawn from.
+ *
+ * This is the source of a PagingProxyModel, otherwise the view's model. Sampling the page only
+ * would measure a different slice after every page change and reset the statistics with it.
+ *
+ * @param model The view's model, or nullptr.
+ */
+auto LogTableView::set_sample_model(QAbstractItemModel* model) -> void
+{
+    if (m_sample_model != nullptr)
+    {
+        disconnect(m_sample_model, &QAbstractItemModel::rowsInserted, this,
+                   &LogTableView::handle_rows_inserted);
+        disconnect(m_sample_model, &QAbstractItemModel::modelReset, this,
+                   &LogTableView::resample_width_statistics);
+    }
+
+    auto* paging_proxy = qobject_cast<PagingProxyModel*>(model);
+    m_sample_model = (paging_proxy != nullptr) ? paging_proxy->sourceModel() : model;
+
+    if (m_sample_model != nullptr)
+    {
+        connect(m_sample_model, &QAbstractItemModel::rowsInserted, this,
+                &LogTableView::handle_rows_inserted, Qt::UniqueConnection);
+        connect(m_sample_model, &QAbstractItemModel::modelReset, this,
+                &LogTableView::resample_width_statistics, Qt::UniqueConnection);
+    }
+}
+
+/**
+ * @brief Measures a stratified sample of all rows (after resets).
+ */
+auto LogTableView::resample_width_statistics() -> void
+{
+    m_width_sampler.reset();
+
+    if (m_sample_model != nullptr)
+    {
+        const int last_row = m_sample_model->rowCount() - 1;
+        m_width_sampler.set_skipped_columns(
+            {LogModel::Message, m_sample_model->columnCount() - 1});
+        m_width_sampler.sample_range(*m_sample_model, 0, last_row, k_reset_sample_rows);
+    }
+}
+
+/**
+ * @brief Measures a stratified sample of an inserted batch.
+ * @param parent The parent index (must be invalid).
+ * @param first The first inserted row.
+ * @param last The last inserted row.
+ */
+auto LogTableView::handle_rows_inserted(const QModelIndex& parent, int first, int last) -> void
+{
+    if (!parent.isValid() && m_sample_model != nullptr)
+    {
+        m_width_sampler.set_skipped_columns(
+            {LogModel::Message, m_sample_model->columnCount() - 1});
+        m_width_sampler.sample_range(*m_sample_model, first, last, k_batch_sample_rows);
+    }
+}
+
+/**
+ * @brief Returns the rows currently shown in the viewport.
+ * @return The visible rows in ascending order.
+ */
+auto LogTableView::get_visible_rows() const -> QVector<int>
+{
+    QVector<int> rows;
+    const int first_row = rowAt(0);
+
+    if (first_row >= 0)
+    {
+        const int bottom_row = rowAt(viewport()->height() - 1);
+        const int last_row = (bottom_row >= 0) ? bottom_row : model()->rowCount() - 1;
+
+        for (int row = first_row; row <= last_row; ++row)
+        {
+            rows.append(row);
+        }
+    }
+
+    return rows;
+}
+
+/**
+ * @brief Hands the visible rows to the prefetcher.
+ */
+auto LogTableView::update_prefetch() -> void
+{
+    const QVector<int> rows = get_visible_rows();
 
-    for (int i = 0; i < column_count; ++i)
+    if (!rows.isEmpty())
     {
-        header->setSectionResizeMode(
-            i, ((i == (column_count - 1)) ? QHeaderView::Stretch : QHeaderView::Interactive));
+        m_prefetcher->update_viewport(rows.first(), rows.last());
     }
 }
@@ -4,11 +4,16 @@
 #include <QItemSelectionModel>
 #include <QLayout>
 #include <QMenu>
+#include <QScrollBar>
 #include <QToolButton>
 
+#include "Qt-LogViewer/Models/LevelDensitySummary.h"
+#include "Qt-LogViewer/Models/LogModel.h"
 #include "Qt-LogViewer/Models/LogSortFilterProxyModel.h"
+#include "Qt-LogViewer/Models/PagingProxyModel.h"
 #include "Qt-LogViewer/Views/App/FilesInViewMenuItemWidget.h"
 #include "Qt-LogViewer/Views/App/FilesInViewWidgetAction.h"
+#include "Qt-LogViewer/Views/App/LevelDensityMinimap.h"
 #include "Qt-LogViewer/Views/App/LogFilterWidget.h"
 #include "Qt-LogViewer/Views/App/LogTableView.h"
 #include "QtWidgetsCommonLib/Utils/UiUtils.h"
@@ -28,7 +33,8 @@ LogViewWidget::LogViewWidget(QWidget* parent)
       ui(new Ui::LogViewWidget),
       m_view_id(QUuid()),
       m_files_menu(nullptr),
-      m_view_file_paths()
+      m_view_file_paths(),
+      m_density_summary(new LevelDensitySummary(this))
 {
     ui->setupUi(this);
     setAttribute(Qt::WA_StyledBackground, true);
@@ -49,6 +55,17 @@ LogViewWidget::LogViewWidget(QWidget* parent)
                 &LogViewWidget::current_row_changed);
     }
 
+    // Minimap of the whole filtered view next to the table
+    ui->levelDensityMinimap->set_summary(m_density_summary);
+    connect(ui->levelDensityMinimap, &LevelDensityMinimap::row_requested, this,
+            &LogViewWidget::jump_to_row);
+    connect(m_density_summary, &LevelDensitySummary::summary_changed, this,
+            &LogViewWidget::update_density_viewport);
+
+    // Scroll anchor for filter, sort and page size changes
+    connect(ui->logTableView->verticalScrollBar(), &QScrollBar::valueChanged, this,
+            &LogViewWidget::record_top_row);
+
     setup_files_menu();
 }
 
@@ -107,20 +124,41 @@ auto LogViewWidget::set_model(QAbstractItemModel* model) -> void
     {
         connect(selection_model, &QItemSelectionModel::currentRowChanged, this,
                 &LogViewWidget::current_row_changed);
+        connect(selection_model, &QItemSelectionModel::currentRowChanged, this,
+                &LogViewWidget::record_current_row);
     }
 
+    LogSortFilterProxyModel* sort_proxy = nullptr;
     auto* proxy_model = qobject_cast<QAbstractProxyModel*>(ui->logTableView->model());
     if (proxy_model != nullptr)
     {
-        auto* sort_proxy = qobject_cast<LogSortFilterProxyModel*>(proxy_model->sourceModel());
+        sort_proxy = qobject_cast<LogSortFilterProxyModel*>(proxy_model->sourceModel());
         if (sort_proxy != nullptr)
         {
             connect(sort_proxy, &LogSortFilterProxyModel::file_visibility_changed, this,
                     [this](const QString&) { refresh_files_menu_states(); });
             connect(sort_proxy, &LogSortFilterProxyModel::show_only_changed, this,
                     [this](const QString&) { refresh_files_menu_states(); });
+            // Counts follow appended batches and filter changes without a pass of their own.
+            connect(sort_proxy, &LogSortFilterProxyModel::match_counts_changed, this,
+                    &LogViewWidget::update_facet_counts, Qt::UniqueConnection);
         }
+
+        // Page switches reset the paging proxy; keep the minimap outline on the shown rows
+        connect(proxy_model, &QAbstractItemModel::modelReset, this,
+                &LogViewWidget::update_density_viewport, Qt::UniqueConnection);
+        connect(proxy_model, &QAbstractItemModel::rowsInserted, this,
+                &LogViewWidget::update_density_viewport, Qt::UniqueConnection);
+
+        // Keep the top and selected rows across the resets of filter, sort and paging changes
+        connect(proxy_model, &QAbstractItemModel::modelAboutToBeReset, this,
+                &LogViewWidget::begin_anchor_restore, Qt::UniqueConnection);
+        connect(proxy_model, &QAbstractItemModel::modelReset, this,
+                &LogViewWidget::restore_anchor_rows, Qt::UniqueConnection);
     }
+
+    m_density_summary->set_model(sort_proxy);
+    update_density_viewport();
 }
 
 /**
@@ -176,6 +214,26 @@ auto LogViewWidget::set_log_level_counts(const QMap<QString, int>& level_counts)
     ui->logFilterWidget->set_log_level_counts(level_counts);
 }
 
+/**
+ * @brief Updates the total and the matching per-log-level counts in the filter items.
+ * @param level_counts Map of level name to count over all entries.
+ * @param matched_counts Map of level name to count over the entries passing the filters.
+ */
+auto LogViewWidget::set_log_level_counts(const QMap<QString, int>& level_counts,
+                                         const QMap<QString, int>& matched_counts) -> void
+{
+    ui->logFilterWidget->set_log_level_counts(level_counts, matched_counts);
+}
+
+/**
+ * @brief Shows the matching count per application in the application filter.
+ * @param app_counts Map of application name to matching count.
+ */
+auto LogViewWidget::set_app_match_counts(const QMap<QString, int>& app_counts) -> void
+{
+    ui->logFilterWidget->set_app_match_counts(app_counts);
+}
+
 /**
  * @brief Shows or hides the filter widget area.
  *
@@ -252,6 +310,55 @@ auto LogViewWidget::set_view_file_paths(const QVector<QString>& file_paths) -> v
     rebuild_files_menu();
 }
 
+/**
+ * @brief Returns the level density summary behind the minimap.
+ * @return Pointer to LevelDensitySummary (owned by this widget).
+ */
+auto LogViewWidget::get_density_summary() const -> LevelDensitySummary*
+{
+    return m_density_summary;
+}
+
+/**
+ * @brief Shows the page containing a row of the filtered view and selects that row.
+ *
+ * Emits `page_changed` if the current page changes.
+ *
+ * @param row The row in the filtered and sorted view (across all pages).
+ */
+auto LogViewWidget::jump_to_row(int row) -> void
+{
+    auto* paging_proxy = qobject_cast<PagingProxyModel*>(ui->logTableView->model());
+    auto* sort_proxy = m_density_summary->get_model();
+
+    if (paging_proxy != nullptr && sort_proxy != nullptr && row >= 0 &&
+        row < sort_proxy->rowCount())
+    {
+        const int page_size = paging_proxy->is_paging_enabled() ? paging_proxy->get_page_size()
+                                                                : sort_proxy->rowCount();
+        const int page = (row / qMax(1, page_size)) + 1;
+        const bool page_switched = (page != paging_proxy->get_current_page());
+
+        if (page_switched)
+        {
+            paging_proxy->set_current_page(page);
+        }
+
+        const QModelIndex index = paging_proxy->mapFromSource(sort_proxy->index(row, 0));
+
+        if (index.isValid())
+        {
+            ui->logTableView->setCurrentIndex(index);
+            ui->logTableView->scrollTo(index, QAbstractItemView::PositionAtCenter);
+        }
+
+        if (page_switched)
+        {
+            emit page_changed(paging_proxy->get_current_page());
+        }
+    }
+}
+
 /**
  * @brief Creates the "Files in View" tool button and attaches the dropdown menu.
  *
@@ -354,6 +461,7 @@ auto LogViewWidget::rebuild_files_menu() -> void
 
             // Ensure the freshly built menu reflects any runtime changes from proxies afterwards
             refresh_files_menu_states();
+            update_facet_counts();
         }
     }
 }
@@ -397,6 +505,158 @@ auto LogViewWidget::refresh_files_menu_states() -> void
     }
 }
 
+/**
+ * @brief Outlines the rows of the current page on the minimap.
+ */
+auto LogViewWidget::update_density_viewport() -> void
+{
+    auto* paging_proxy = qobject_cast<PagingProxyModel*>(ui->logTableView->model());
+    int first_row = 0;
+    int row_count = 0;
+
+    if (paging_proxy != nullptr && paging_proxy->is_paging_enabled())
+    {
+        first_row = (paging_proxy->get_current_page() - 1) * paging_proxy->get_page_size();
+        row_count = paging_proxy->rowCount();
+    }
+
+    // Without paging the whole view is shown at once; an outline would add nothing.
+    ui->levelDensityMinimap->set_visible_rows(first_row, row_count);
+}
+
+/**
+ * @brief Shows the sort proxy's current facet counts in the filter widget and the per-file
+ *        counts in the "Files in View" menu.
+ */
+auto LogViewWidget::update_facet_counts() -> void
+{
+    auto* proxy_model = qobject_cast<QAbstractProxyModel*>(ui->logTableView->model());
+    const LogSortFilterProxyModel* sort_proxy = nullptr;
+
+    if (proxy_model != nullptr)
+    {
+        sort_proxy = qobject_cast<LogSortFilterProxyModel*>(proxy_model->sourceModel());
+    }
+
+    if (sort_proxy != nullptr)
+    {
+        const LogFacetCounts matched = sort_proxy->get_match_counts();
+        const LogFacetCounts total = sort_proxy->get_total_counts();
+        ui->logFilterWidget->set_log_level_counts(total.get_level_counts(),
+                                                  matched.get_level_counts());
+        ui->logFilterWidget->set_app_match_counts(matched.get_app_counts());
+
+        if (m_files_menu != nullptr)
+        {
+            const QMap<QString, int> matched_files = matched.get_file_counts();
+            const QMap<QString, int> total_files = total.get_file_counts();
+            const QList<QAction*> actions = m_files_menu->actions();
+
+            for (QAction* act: actions)
+            {
+                auto* widget_action = qobject_cast<FilesInViewWidgetAction*>(act);
+                if (widget_action != nullptr)
+                {
+                    const QString path = widget_action->get_file_path();
+                    widget_action->set_entry_counts(matched_files.value(path),
+                                                    total_files.value(path));
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Records the top visible row as scroll anchor and hands the anchors to the paging proxy.
+ */
+auto LogViewWidget::record_top_row() -> void
+{
+    auto* paging_proxy = qobject_cast<PagingProxyModel*>(ui->logTableView->model());
+
+    if (paging_proxy != nullptr && !m_restoring_anchor)
+    {
+        const QModelIndex top = ui->logTableView->indexAt(QPoint(0, 0));
+        m_top_row_id = top.isValid() ? top.data(LogModel::RowIdRole).toULongLong() : 0;
+        paging_proxy->set_anchor_row_ids({m_top_row_id, m_current_row_id});
+    }
+}
+
+/**
+ * @brief Records the current row as selection anchor.
+ *
+ * A current row lost to a reset is not recorded, so the selection comes back once a filter
+ * shows the row again.
+ *
+ * @param current The current index of the paging proxy.
+ */
+auto LogViewWidget::record_current_row(const QModelIndex& current) -> void
+{
+    if (current.isValid() && !m_restoring_anchor)
+    {
+        m_current_row_id = current.data(LogModel::RowIdRole).toULongLong();
+        record_top_row();
+    }
+}
+
+/**
+ * @brief Stops recording anchors while the paging proxy resets.
+ */
+auto LogViewWidget::begin_anchor_restore() -> void
+{
+    const auto* paging_proxy = qobject_cast<PagingProxyModel*>(ui->logTableView->model());
+    m_restoring_anchor = true;
+
+    if (paging_proxy != nullptr)
+    {
+        m_page_before_reset = paging_proxy->get_current_page();
+    }
+}
+
+/**
+ * @brief Restores the selection and scroll position from the anchors after a reset.
+ *
+ * The paging proxy already switched to the page of the first anchor still shown; each anchor is
+ * found on it by id in O(log n). If the top row is gone, the selected row is centered instead.
+ *
+ * Emits `page_changed` if the paging proxy followed an anchor to another page.
+ */
+auto LogViewWidget::restore_anchor_rows() -> void
+{
+    const auto* paging_proxy = qobject_cast<PagingProxyModel*>(ui->logTableView->model());
+
+    if (paging_proxy != nullptr)
+    {
+        const QModelIndex top = paging_proxy->index_of_row_id(m_top_row_id);
+        const QModelIndex current = paging_proxy->index_of_row_id(m_current_row_id);
+
+        // Lay the new rows out now, so scrolling is not clamped to the old row count.
+        ui->logTableView->doItemsLayout();
+
+        if (current.isValid())
+        {
+            ui->logTableView->selectionModel()->setCurrentIndex(
+                current, QItemSelectionModel::ClearAndSelect | QItemSelectionModel::Rows);
+        }
+
+        if (top.isValid())
+        {
+            ui->logTableView->scrollTo(top, QAbstractItemView::PositionAtTop);
+        }
+        else if (current.isValid())
+        {
+            ui->logTableView->scrollTo(current, QAbstractItemView::PositionAtCenter);
+        }
+    }
+
+    m_restoring_anchor = false;
+    record_top_row();
+
+    if (paging_proxy != nullptr && paging_proxy->get_current_page() != m_page_before_reset)
+    {
+        emit page_changed(paging_proxy->get_current_page());
+    }
+}
+
 /**
  * @brief Handles language change and other UI change events.
  * @param event The change event.
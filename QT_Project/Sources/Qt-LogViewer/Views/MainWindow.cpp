@@ -12,9 +12,9 @@
 #include <QMenu>
 #include <QMessageBox>
 #include <QMimeData>
-#include <QPlainTextEdit>
 #include <QResizeEvent>
 #include <QSet>
+#include <QSignalBlocker>
 #include <QStackedWidget>
 #include <QStringList>
 #include <QTabWidget>
@@ -23,6 +23,8 @@
 
 #include "Qt-LogViewer/Controllers/LogViewerController.h"
 #include "Qt-LogViewer/Controllers/SessionController.h"
+#include "Qt-LogViewer/Models/LevelDensitySummary.h"
+#include "Qt-LogViewer/Models/LogBaseline.h"
 #include "Qt-LogViewer/Models/LogEntry.h"
 #include "Qt-LogViewer/Models/LogFileTreeModel.h"
 #include "Qt-LogViewer/Models/LogModel.h"
@@ -34,6 +36,7 @@
 #include "Qt-LogViewer/Services/SessionManager.h"
 #include "Qt-LogViewer/Services/SessionRepository.h"
 #include "Qt-LogViewer/Views/App/Dialogs/SettingsDialog.h"
+#include "Qt-LogViewer/Views/App/LogDetailsWidget.h"
 #include "Qt-LogViewer/Views/App/LogFileExplorer.h"
 #include "Qt-LogViewer/Views/App/LogLevelPieChartWidget.h"
 #include "Qt-LogViewer/Views/App/LogViewWidget.h"
@@ -59,7 +62,14 @@ constexpr auto k_views_menu_text = QT_TRANSLATE_NOOP("MainWindow", "&Views");
 constexpr auto k_show_log_file_explorer_text =
     QT_TRANSLATE_NOOP("MainWindow", "Show Log File Explorer");
 constexpr auto k_show_log_details_text = QT_TRANSLATE_NOOP("MainWindow", "Show Log Details");
+constexpr auto k_set_baseline_text = QT_TRANSLATE_NOOP("MainWindow", "Set Baseline Files...");
+constexpr auto k_clear_baseline_text = QT_TRANSLATE_NOOP("MainWindow", "Clear Baseline");
+constexpr auto k_show_novel_only_text =
+    QT_TRANSLATE_NOOP("MainWindow", "Show Only Lines New Since Baseline");
 constexpr auto k_untitled_session_text = QT_TRANSLATE_NOOP("MainWindow", "Untitled Session");
+
+// Delay before an idle background load of the next restored (placeholder) tab starts.
+constexpr int k_view_prefetch_delay_ms = 1500;
 }  // namespace
 
 using QtWidgetsCommonLib::AppMainWindow;
@@ -77,7 +87,6 @@ MainWindow::MainWindow(LogViewerSettings* settings, QWidget* parent)
     : AppMainWindow(settings, parent),
       m_log_viewer_settings(settings),
       m_controller(new LogViewerController("{timestamp} {level} {message} {app_name}", this)),
-      m_log_level_pie_chart_widget(new LogLevelPieChartWidget(this)),
       ui(new Ui::MainWindow)
 {
     qDebug() << "MainWindow constructor started";
@@ -87,6 +96,10 @@ MainWindow::MainWindow(LogViewerSettings* settings, QWidget* parent)
             << "| Organization:" << m_log_viewer_settings->organizationName()
             << "| Application:" << m_log_viewer_settings->applicationName();
 
+    m_controller->add_log_formats(m_log_viewer_settings->get_custom_log_formats());
+    m_controller->set_max_line_length(m_log_viewer_settings->get_max_line_length());
+    m_controller->set_dedupe_enabled(m_log_viewer_settings->get_dedupe_overlapping_files());
+
     ui->setupUi(this);
     setContentsMargins(9, 9, 9, 9);
     setWindowIcon(QIcon(":/Resources/Icons/App/AppIcon.svg"));
@@ -99,39 +112,18 @@ MainWindow::MainWindow(LogViewerSettings* settings, QWidget* parent)
     {
         central_stack->addWidget(old_central);
     }
+    m_startup_profiler.mark(QStringLiteral("ui"));
 
     // Initialize session manager and recent models (unified, schema-driven)
-    m_session_manager = new SessionManager(new SessionRepository(this), this);
-    m_session_manager->initialize_from_storage();
+    m_session_manager = new SessionManager(std::make_unique<SessionRepository>(), this);
 
     const RecentListSchema files_schema = RecentListSchemas::make_recent_files_schema();
     const RecentListSchema sessions_schema = RecentListSchemas::make_recent_sessions_schema();
 
+    // The models start empty and are filled by the change signals once the stored lists load.
     m_recent_files_model = new RecentItemsModel(files_schema, this);
     m_recent_sessions_model = new RecentItemsModel(sessions_schema, this);
 
-    // Build rows from SessionManager data and set them on the generic model
-    {
-        QVector<QHash<int, QVariant>> file_rows;
-        const auto recent_files = m_session_manager->get_recent_log_files();
-        file_rows.reserve(recent_files.size());
-        for (const auto& rf: recent_files)
-        {
-            file_rows.push_back(RecentListSchemas::build_recent_file_row(rf));
-        }
-        m_recent_files_model->set_rows(std::move(file_rows));
-    }
-    {
-        QVector<QHash<int, QVariant>> session_rows;
-        const auto recent_sessions = m_session_manager->get_recent_sessions();
-        session_rows.reserve(recent_sessions.size());
-        for (const auto& rs: recent_sessions)
-        {
-            session_rows.push_back(RecentListSchemas::build_recent_session_row(rs));
-        }
-        m_recent_sessions_model->set_rows(std::move(session_rows));
-    }
-
     connect(m_session_manager, &SessionManager::recent_log_files_changed, this,
             [this](const QVector<RecentLogFileRecord>& items) {
                 QVector<QHash<int, QVariant>> rows;
@@ -154,6 +146,18 @@ MainWindow::MainWindow(LogViewerSettings* settings, QWidget* parent)
                 m_recent_sessions_model->set_rows(std::move(rows));
                 rebuild_recent_menus();
             });
+    connect(
+        m_session_manager, &SessionManager::storage_loaded, this,
+        [this]() {
+            m_startup_profiler.mark(QStringLiteral("recent_items"));
+            qInfo() << "Recent items loaded after"
+                    << m_startup_profiler.get_elapsed_ns() / (1000 * 1000) << "ms";
+        },
+        Qt::SingleShotConnection);
+
+    // The root document is read on the writer thread while the rest of the window is built.
+    m_session_manager->initialize_from_storage_async();
+    m_startup_profiler.mark(QStringLiteral("session_manager"));
 
     setup_log_file_explorer();
     setup_log_level_pie_chart();
@@ -161,6 +165,7 @@ MainWindow::MainWindow(LogViewerSettings* settings, QWidget* parent)
     setup_log_details_dock();
     setup_filter_bar();
     setup_tab_widget();
+    m_startup_profiler.mark(QStringLiteral("docks"));
 
     m_session_controller = new SessionController(
         m_session_manager, m_controller->get_log_file_tree_model(), m_controller, this);
@@ -196,6 +201,7 @@ MainWindow::MainWindow(LogViewerSettings* settings, QWidget* parent)
     connect(start_page, &StartPageWidget::delete_session_requested, this,
             &MainWindow::handle_delete_session);
     central_stack->addWidget(start_page);
+    m_startup_profiler.mark(QStringLiteral("start_page"));
 
     m_controller->set_current_view(m_controller->load_log_files({}));
     connect(m_controller, &LogViewerController::current_view_id_changed, this,
@@ -206,6 +212,19 @@ MainWindow::MainWindow(LogViewerSettings* settings, QWidget* parent)
             &MainWindow::handle_loading_progress);
     connect(m_controller, &LogViewerController::loading_finished, this,
             &MainWindow::handle_loading_finished);
+    connect(m_controller, &LogViewerController::baseline_progress, this,
+            [this](int files_done, int file_count) {
+                statusBar()->showMessage(
+                    tr("Building baseline: %1 of %2 file(s)").arg(files_done).arg(file_count));
+            });
+    connect(m_controller, &LogViewerController::baseline_changed, this,
+            &MainWindow::handle_baseline_changed);
+
+    m_view_prefetch_timer = new QTimer(this);
+    m_view_prefetch_timer->setSingleShot(true);
+    m_view_prefetch_timer->setInterval(k_view_prefetch_delay_ms);
+    connect(m_view_prefetch_timer, &QTimer::timeout, this,
+            &MainWindow::handle_view_prefetch_timeout);
     connect(m_controller, &LogViewerController::loading_error, this,
             &MainWindow::handle_loading_error);
     connect(m_controller, &LogViewerController::view_file_paths_changed, this,
@@ -218,8 +237,11 @@ MainWindow::MainWindow(LogViewerSettings* settings, QWidget* parent)
                 }
             });
 
+    m_startup_profiler.mark(QStringLiteral("connections"));
+
     initialize_menu();
     rebuild_recent_menus();
+    m_startup_profiler.mark(QStringLiteral("menu"));
 
     QTimer::singleShot(0, this, [this] { this->resizeEvent(nullptr); });
     qDebug() << "MainWindow constructor finished";
@@ -269,10 +291,28 @@ auto MainWindow::setup_log_file_explorer() -> void
             &MainWindow::handle_close_session);
     connect(m_log_file_explorer, &LogFileExplorer::delete_session_requested, this,
             &MainWindow::handle_delete_session);
+
+    connect(m_log_file_explorer, &LogFileExplorer::add_watch_folder_requested, this,
+            [this](const QString& session_id, const QString& folder_path) {
+                if (m_controller->add_watch_folder_to_session(session_id, folder_path))
+                {
+                    m_session_controller->request_expand_session(session_id);
+                    m_session_controller->save_current_session();
+                }
+            });
+    connect(m_log_file_explorer, &LogFileExplorer::remove_watch_folder_requested, this,
+            [this](const QString& session_id, const QString& folder_path) {
+                if (m_controller->remove_watch_folder_from_session(session_id, folder_path))
+                {
+                    m_session_controller->save_current_session();
+                }
+            });
 }
 
 /**
  * @brief Sets up the log level pie chart dock widget.
+ *
+ * The chart itself is created when the dock is first shown.
  */
 auto MainWindow::setup_log_level_pie_chart() -> void
 {
@@ -281,10 +321,67 @@ auto MainWindow::setup_log_level_pie_chart() -> void
     m_log_level_pie_chart_dock_widget->setTitleBarWidget(
         DockWidget::create_dock_title_bar(m_log_level_pie_chart_dock_widget));
     m_log_level_pie_chart_dock_widget->setObjectName("logLevelPieChartDockWidget");
-    m_log_level_pie_chart_dock_widget->setWidget(m_log_level_pie_chart_widget);
     addDockWidget(Qt::LeftDockWidgetArea, m_log_level_pie_chart_dock_widget);
     setCorner(Qt::TopLeftCorner, Qt::LeftDockWidgetArea);
     setCorner(Qt::BottomLeftCorner, Qt::LeftDockWidgetArea);
+
+    connect(m_log_level_pie_chart_dock_widget, &DockWidget::visibilityChanged, this,
+            [this](bool visible) {
+                // During startup the chart is created by complete_deferred_startup().
+                if (visible && m_startup_profiler.is_interactive())
+                {
+                    ensure_log_level_pie_chart_widget();
+                }
+            });
+}
+
+/**
+ * @brief Creates the log level pie chart widget if it does not exist yet.
+ */
+auto MainWindow::ensure_log_level_pie_chart_widget() -> void
+{
+    if (m_log_level_pie_chart_widget == nullptr)
+    {
+        m_log_level_pie_chart_widget =
+            new LogLevelPieChartWidget(m_log_level_pie_chart_dock_widget);
+        m_log_level_pie_chart_widget->set_log_level_counts(m_log_level_counts);
+        m_log_level_pie_chart_dock_widget->setWidget(m_log_level_pie_chart_widget);
+    }
+}
+
+/**
+ * @brief Sets the log level counts shown by the pie chart.
+ *
+ * The counts are kept while the chart has not been created yet.
+ *
+ * @param level_counts Map of log level to count.
+ */
+auto MainWindow::set_log_level_pie_chart_counts(const QMap<QString, int>& level_counts) -> void
+{
+    m_log_level_counts = level_counts;
+
+    if (m_log_level_pie_chart_widget != nullptr)
+    {
+        m_log_level_pie_chart_widget->set_log_level_counts(level_counts);
+    }
+}
+
+/**
+ * @brief Shows a view's total and matching counts in the filter bar if it is current.
+ *
+ * Called whenever the view's proxy reports changed counts (appended batches, filter changes).
+ *
+ * @param view_id The view.
+ */
+auto MainWindow::update_filter_bar_counts(const QUuid& view_id) -> void
+{
+    if (view_id == m_controller->get_current_view())
+    {
+        const LogFacetCounts match_counts = m_controller->get_match_counts(view_id);
+        ui->logFilterBarWidget->set_log_level_counts(m_controller->get_log_level_counts(view_id),
+                                                     match_counts.get_level_counts());
+        ui->logFilterBarWidget->set_app_match_counts(match_counts.get_app_counts());
+    }
 }
 
 /**
@@ -302,8 +399,8 @@ auto MainWindow::setup_pagination_widget() -> void
 
                 if (proxy != nullptr)
                 {
+                    // The proxy stays on the page of the view's top row.
                     proxy->set_page_size(items_per_page);
-                    proxy->set_current_page(1);
                     update_pagination_widget();
                 }
             });
@@ -319,10 +416,9 @@ auto MainWindow::setup_log_details_dock() -> void
     m_log_details_dock_widget->setObjectName("logDetailsDockWidget");
     m_log_details_dock_widget->setTitleBarWidget(
         DockWidget::create_dock_title_bar(m_log_details_dock_widget));
-    m_log_details_text_edit = new QPlainTextEdit(m_log_details_dock_widget);
-    m_log_details_text_edit->setObjectName("logDetailsTextEdit");
-    m_log_details_text_edit->setReadOnly(true);
-    m_log_details_dock_widget->setWidget(m_log_details_text_edit);
+    m_log_details_widget = new LogDetailsWidget(m_log_details_dock_widget);
+    m_log_details_widget->setObjectName("logDetailsWidget");
+    m_log_details_dock_widget->setWidget(m_log_details_widget);
     addDockWidget(Qt::BottomDockWidgetArea, m_log_details_dock_widget);
 }
 
@@ -363,27 +459,16 @@ auto MainWindow::setup_tab_widget() -> void
 {
     ui->tabWidgetLog->setup_default_behavior();
 
-    connect(ui->tabWidgetLog, &QTabWidget::currentChanged, this, [this](int index) {
-        Q_UNUSED(index);
-
-        LogViewWidget* log_view_widget = ui->tabWidgetLog->current_log_view();
-        if (log_view_widget != nullptr)
-        {
-            QUuid view_id = log_view_widget->get_view_id();
-            m_controller->set_current_view(view_id);
-            QVector<QString> file_paths = m_controller->get_view_file_paths(view_id);
-            log_view_widget->set_view_file_paths(file_paths);
-            update_pagination_widget();
-        }
-    });
+    connect(ui->tabWidgetLog, &QTabWidget::currentChanged, this,
+            &MainWindow::handle_current_tab_changed);
     connect(ui->tabWidgetLog, &TabWidget::about_to_close_tab, this,
             [this](int index, QWidget* widget) {
                 Q_UNUSED(widget);
 
-                LogViewWidget* log_view_widget = ui->tabWidgetLog->log_view_at(index);
-                if (log_view_widget != nullptr)
+                // Placeholder tabs of deferred views carry a view id as well.
+                const QUuid view_id = ui->tabWidgetLog->view_id_at(index);
+                if (!view_id.isNull())
                 {
-                    QUuid view_id = log_view_widget->get_view_id();
                     m_controller->remove_view(view_id);
                 }
             });
@@ -391,7 +476,7 @@ auto MainWindow::setup_tab_widget() -> void
         Q_UNUSED(index);
         if (ui->tabWidgetLog->count() == 0)
         {
-            m_log_level_pie_chart_widget->set_log_level_counts({});
+            set_log_level_pie_chart_counts({});
             update_pagination_widget();
         }
     });
@@ -423,6 +508,16 @@ auto MainWindow::initialize_menu() -> void
     m_file_menu->addMenu(m_recent_files_menu);
     m_file_menu->addMenu(m_recent_sessions_menu);
 
+    // Populated on first use instead of on every change of the recent lists.
+    auto populate_if_dirty = [this]() -> void {
+        if (m_recent_menus_dirty)
+        {
+            populate_recent_menus();
+        }
+    };
+    connect(m_recent_files_menu, &QMenu::aboutToShow, this, populate_if_dirty);
+    connect(m_recent_sessions_menu, &QMenu::aboutToShow, this, populate_if_dirty);
+
     // Session actions
     m_action_save_session = new QAction(tr(k_save_session_text), this);
     m_action_open_session = new QAction(tr(k_open_session_text), this);
@@ -467,8 +562,37 @@ auto MainWindow::initialize_menu() -> void
     m_action_show_log_level_pie_chart->setCheckable(true);
     views_menu->addAction(m_action_show_log_level_pie_chart);
 
+    views_menu->addSeparator();
+    m_action_set_baseline = new QAction(tr(k_set_baseline_text), this);
+    views_menu->addAction(m_action_set_baseline);
+    m_action_clear_baseline = new QAction(tr(k_clear_baseline_text), this);
+    views_menu->addAction(m_action_clear_baseline);
+    m_action_show_novel_only = new QAction(tr(k_show_novel_only_text), this);
+    m_action_show_novel_only->setCheckable(true);
+    views_menu->addAction(m_action_show_novel_only);
+    update_baseline_actions();
+
     ui->menubar->addMenu(views_menu);
 
+    connect(m_action_set_baseline, &QAction::triggered, this, [this]() {
+        const QStringList files =
+            QFileDialog::getOpenFileNames(this, tr("Select Baseline Log Files"), QString(),
+                                          tr("Log Files (*.log *.txt);;All Files (*)"));
+
+        if (!files.isEmpty())
+        {
+            m_controller->build_baseline(QVector<QString>(files.begin(), files.end()));
+            update_baseline_actions();
+            statusBar()->showMessage(tr("Building baseline from %1 file(s)...").arg(files.size()));
+        }
+    });
+    connect(m_action_clear_baseline, &QAction::triggered, m_controller,
+            &LogViewerController::clear_baseline);
+    connect(m_action_show_novel_only, &QAction::toggled, this, [this](bool checked) {
+        m_controller->set_novel_only_filter(m_controller->get_current_view(), checked);
+        update_pagination_widget();
+    });
+
     // Update docks on toggle and, if a session is active, cache the new dock layout
     auto cache_dock_state_if_session = [this]() -> void {
         if (m_session_controller != nullptr && m_session_controller->has_current_session())
@@ -520,10 +644,18 @@ auto MainWindow::initialize_menu() -> void
     auto settings_menu = new QMenu(tr("&Settings"), this);
     m_action_settings = new QAction(tr("Settings..."), this);
     m_action_settings->setShortcut(QKeySequence(QStringLiteral("Ctrl+,")));
+    m_action_dedupe_files = new QAction(tr("Skip Duplicate Lines Across Files"), this);
+    m_action_dedupe_files->setCheckable(true);
+    m_action_dedupe_files->setChecked(m_controller->is_dedupe_enabled());
     settings_menu->addAction(m_action_settings);
+    settings_menu->addAction(m_action_dedupe_files);
     ui->menubar->addMenu(settings_menu);
     connect(m_action_settings, &QAction::triggered, this,
             &MainWindow::handle_show_settings_dialog_requested);
+    connect(m_action_dedupe_files, &QAction::toggled, this, [this](bool checked) {
+        m_log_viewer_settings->set_dedupe_overlapping_files(checked);
+        m_controller->set_dedupe_enabled(checked);
+    });
 
     // Help menu
     auto help_menu = new QMenu(tr("&Help"), this);
@@ -569,12 +701,24 @@ auto MainWindow::initialize_menu() -> void
 }
 
 /**
- * @brief Rebuilds the Recent Files and Recent Sessions submenus from models.
+ * @brief Marks the Recent Files and Recent Sessions submenus for a rebuild.
  *
- * Idempotent; clears and repopulates actions on each call.
+ * The submenus are repopulated from the models the next time one of them is shown.
  */
 auto MainWindow::rebuild_recent_menus() -> void
 {
+    m_recent_menus_dirty = true;
+}
+
+/**
+ * @brief Repopulates the Recent Files and Recent Sessions submenus from the models.
+ *
+ * Idempotent; clears and repopulates actions on each call.
+ */
+auto MainWindow::populate_recent_menus() -> void
+{
+    m_recent_menus_dirty = false;
+
     if (m_recent_files_menu != nullptr && m_recent_files_model != nullptr)
     {
         m_recent_files_menu->clear();
@@ -721,7 +865,7 @@ auto MainWindow::show_start_page_if_needed() -> void
  */
 auto MainWindow::update_log_details(const QModelIndex& current) -> void
 {
-    QString details;
+    bool has_entry = false;
 
     if (current.isValid())
     {
@@ -734,16 +878,17 @@ auto MainWindow::update_log_details(const QModelIndex& current) -> void
 
         if (source_index.isValid())
         {
-            LogEntry entry = model->get_entry(source_index.row());
-            details = QString("Timestamp: %1\nLevel: %2\nApp: %3\nMessage: %4")
-                          .arg(entry.get_timestamp().toString("yyyy-MM-dd HH:mm:ss"))
-                          .arg(entry.get_level())
-                          .arg(entry.get_app_name())
-                          .arg(entry.get_message());
+            // The pane decodes large messages in chunks, so this is cheap for any message size.
+            m_log_details_widget->set_entry(model->get_entry(source_index.row()));
+            has_entry = true;
         }
     }
 
-    m_log_details_text_edit->setPlainText(details);
+    if (!has_entry)
+    {
+        m_log_details_widget->clear();
+    }
+
     qDebug() << "Log details updated for row:" << current.row();
 }
 
@@ -847,6 +992,41 @@ void MainWindow::showEvent(QShowEvent* event)
 {
     AppMainWindow::showEvent(event);
     show_start_page_if_needed();
+
+    if (!m_deferred_startup_scheduled)
+    {
+        m_deferred_startup_scheduled = true;
+        m_startup_profiler.mark(QStringLiteral("show"));
+
+        // Runs after the paint events posted by the first show have been processed.
+        QTimer::singleShot(0, this, &MainWindow::complete_deferred_startup);
+    }
+}
+
+/**
+ * @brief Runs the startup work deferred until after the first paint and records the time to
+ *        interactive.
+ */
+auto MainWindow::complete_deferred_startup() -> void
+{
+    m_startup_profiler.mark(QStringLiteral("first_paint"));
+
+    // A pie chart dock restored as visible gets its chart now rather than before the first frame.
+    if (m_log_level_pie_chart_dock_widget != nullptr &&
+        m_log_level_pie_chart_dock_widget->isVisible())
+    {
+        ensure_log_level_pie_chart_widget();
+    }
+    m_startup_profiler.mark(QStringLiteral("deferred"));
+
+    m_startup_profiler.finish_interactive();
+    qInfo().noquote() << "Startup:" << m_startup_profiler.get_summary();
+
+    if (!m_startup_profiler.is_within_target())
+    {
+        qWarning() << "Startup exceeded the time-to-interactive target of"
+                   << StartupProfiler::get_time_to_interactive_target_ms() << "ms";
+    }
 }
 
 /**
@@ -870,6 +1050,9 @@ auto MainWindow::closeEvent(QCloseEvent* event) -> void
         }
     }
 
+    // Session writes are debounced; make sure everything is on disk before quitting.
+    m_session_manager->flush();
+
     AppMainWindow::closeEvent(event);
 }
 
@@ -989,8 +1172,10 @@ auto MainWindow::handle_current_view_id_changed(const QUuid& view_id) -> void
     ui->logFilterBarWidget->set_log_levels(log_level_filters);
 
     QMap<QString, int> level_counts = m_controller->get_log_level_counts(view_id);
-    m_log_level_pie_chart_widget->set_log_level_counts(level_counts);
-    ui->logFilterBarWidget->set_log_level_counts(level_counts);
+    const LogFacetCounts match_counts = m_controller->get_match_counts(view_id);
+    set_log_level_pie_chart_counts(level_counts);
+    ui->logFilterBarWidget->set_log_level_counts(level_counts, match_counts.get_level_counts());
+    ui->logFilterBarWidget->set_app_match_counts(match_counts.get_app_counts());
 
     LogViewWidget* log_view_widget = ui->tabWidgetLog->current_log_view();
 
@@ -1000,16 +1185,62 @@ auto MainWindow::handle_current_view_id_changed(const QUuid& view_id) -> void
         log_view_widget->set_current_app_name_filter(app_name_filter);
         log_view_widget->set_available_log_levels(available_log_levels);
         log_view_widget->set_log_levels(log_level_filters);
-        log_view_widget->set_log_level_counts(level_counts);
+        log_view_widget->set_log_level_counts(level_counts, match_counts.get_level_counts());
+        log_view_widget->set_app_match_counts(match_counts.get_app_counts());
         log_view_widget->auto_resize_columns();
 
         QVector<QString> file_paths = m_controller->get_view_file_paths(view_id);
         log_view_widget->set_view_file_paths(file_paths);
     }
 
+    if (m_action_show_novel_only != nullptr)
+    {
+        const QSignalBlocker blocker(m_action_show_novel_only);
+        m_action_show_novel_only->setChecked(m_controller->is_novel_only_filter(view_id));
+    }
+
+    update_pagination_widget();
+}
+
+/**
+ * @brief Updates the baseline actions and reports the new baseline in the status bar.
+ */
+auto MainWindow::handle_baseline_changed() -> void
+{
+    const std::shared_ptr<const LogBaseline> baseline = m_controller->get_baseline();
+    update_baseline_actions();
+
+    if (baseline != nullptr)
+    {
+        statusBar()->showMessage(tr("Baseline ready: %1 line(s) from %2 file(s)")
+                                     .arg(baseline->get_added_count())
+                                     .arg(baseline->get_file_paths().size()),
+                                 4000);
+    }
+    else
+    {
+        statusBar()->showMessage(tr("Baseline cleared"), 4000);
+    }
+
     update_pagination_widget();
 }
 
+/**
+ * @brief Enables the baseline actions according to the baseline state.
+ *
+ * The novelty filter can only be set while a baseline exists; a cleared baseline unchecks it.
+ */
+auto MainWindow::update_baseline_actions() -> void
+{
+    const bool has_baseline = m_controller->get_baseline() != nullptr;
+    m_action_clear_baseline->setEnabled(has_baseline || m_controller->is_baseline_building());
+    m_action_show_novel_only->setEnabled(has_baseline);
+
+    const QSignalBlocker blocker(m_action_show_novel_only);
+    m_action_show_novel_only->setChecked(
+        has_baseline && m_controller->is_novel_only_filter(m_controller->get_current_view()));
+}
+
 /**
  * @brief Handles removal of a view by closing the corresponding tab.
  * @param view_id The QUuid of the removed view.
@@ -1147,33 +1378,93 @@ auto MainWindow::restore_session_from_json(const QString& session_id,
 
         close_all_tabs();
 
+        // Views of a previously restored session that were never opened
+        const QVector<QUuid> stale_deferred_ids = m_controller->get_deferred_view_ids();
+        for (const QUuid& view_id: stale_deferred_ids)
+        {
+            m_controller->remove_view(view_id);
+        }
+
         // First, restore explorer files (files that were only in the tree, not in views)
         const QJsonArray explorer_files_array =
             obj.value(QStringLiteral("explorer_files")).toArray();
+        QList<LogFileInfo> explorer_files;
+        QVector<QString> unidentified_paths;
+
         for (const auto& f: explorer_files_array)
         {
             const QJsonObject fobj = f.toObject();
             const QString file_path = fobj.value(QStringLiteral("file_path")).toString();
             const QString app_name = fobj.value(QStringLiteral("app_name")).toString();
 
-            if (!file_path.isEmpty())
+            if (!file_path.isEmpty() && app_name.isEmpty())
             {
-                auto* tree_model = m_controller->get_log_file_tree_model();
-                if (tree_model != nullptr)
-                {
-                    tree_model->add_log_file(session_id, LogFileInfo(file_path, app_name));
-                }
+                // Saved while still being identified
+                unidentified_paths.append(file_path);
+            }
+            else if (!file_path.isEmpty())
+            {
+                explorer_files.append(LogFileInfo(file_path, app_name));
             }
         }
 
-        // Then restore views (tabs)
+        // One batch per group keeps restoring large sessions cheap for the tree view.
+        auto* tree_model = m_controller->get_log_file_tree_model();
+        if (tree_model != nullptr)
+        {
+            tree_model->add_log_files(session_id, explorer_files);
+        }
+        if (!unidentified_paths.isEmpty())
+        {
+            m_controller->add_log_files_to_session(session_id, unidentified_paths);
+        }
+
+        // Watch folders are only listed once they are expanded in the explorer
+        const QJsonArray watch_folders_array = obj.value(QStringLiteral("watch_folders")).toArray();
+        for (const auto& folder: watch_folders_array)
+        {
+            m_controller->add_watch_folder_to_session(session_id, folder.toString());
+        }
+
+        // Then restore views (tabs): only the active view is materialized and loaded right away,
+        // the others stay placeholders until they are activated or prefetched while idle.
         const QJsonArray views_array = obj.value(QStringLiteral("views")).toArray();
-        for (const auto& v: views_array)
+        const QString active_view_id = obj.value(QStringLiteral("active_view_id")).toString();
+        qsizetype active_index = 0;
+
+        for (qsizetype i = 0; i < views_array.size(); ++i)
         {
-            const QJsonObject view_obj = v.toObject();
-            restore_view_from_json(session_id, view_obj);
+            if (views_array.at(i).toObject().value(QStringLiteral("id")).toString() ==
+                active_view_id)
+            {
+                active_index = i;
+            }
         }
 
+        {
+            // The tab switches of the restore itself must not materialize placeholders.
+            const QSignalBlocker blocker(ui->tabWidgetLog);
+
+            for (qsizetype i = 0; i < views_array.size(); ++i)
+            {
+                const QJsonObject view_obj = views_array.at(i).toObject();
+
+                if (i == active_index)
+                {
+                    restore_view_from_json(session_id, view_obj);
+                }
+                else
+                {
+                    defer_view_from_json(session_id, view_obj);
+                }
+            }
+
+            ui->tabWidgetLog->setCurrentIndex(static_cast<int>(active_index));
+        }
+
+        handle_current_tab_changed(ui->tabWidgetLog->currentIndex());
+        schedule_view_prefetch();
+
         m_session_controller->request_expand_session(session_id);
         rebuild_recent_menus();
         update_pagination_widget();
@@ -1214,6 +1505,60 @@ auto MainWindow::restore_view_from_json(const QString& session_id,
     }
 }
 
+/**
+ * @brief Registers a view from JSON for lazy restore and adds a placeholder tab for it.
+ * @param session_id The session identifier.
+ * @param view_obj The view JSON object.
+ */
+auto MainWindow::defer_view_from_json(const QString& session_id, const QJsonObject& view_obj)
+    -> void
+{
+    const SessionViewState state = parse_view_state_from_json(view_obj);
+    const QUuid view_id = m_controller->register_deferred_view(session_id, state);
+
+    const QString tab_title = state.tab_title.isEmpty() && !state.loaded_files.isEmpty()
+                                  ? QFileInfo(state.loaded_files.first().get_file_path()).fileName()
+                                  : state.tab_title;
+
+    ui->tabWidgetLog->add_placeholder_tab(view_id, tab_title);
+}
+
+/**
+ * @brief Materializes the view of a placeholder tab and swaps in its LogViewWidget.
+ * @param index The placeholder tab index.
+ * @param background True for idle prefetch (the load does not switch the current view).
+ * @return The created LogViewWidget, or nullptr if the tab is no placeholder.
+ */
+auto MainWindow::materialize_placeholder_tab(int index, bool background) -> LogViewWidget*
+{
+    LogViewWidget* log_view_widget = nullptr;
+    const QUuid view_id = ui->tabWidgetLog->view_id_at(index);
+
+    if (ui->tabWidgetLog->is_placeholder_at(index) && m_controller->is_view_deferred(view_id))
+    {
+        const SessionViewState state = m_controller->get_deferred_view_state(view_id);
+        m_controller->materialize_view(view_id, background);
+
+        log_view_widget = create_log_view_widget_for_view(view_id, state);
+        log_view_widget->set_view_file_paths(m_controller->get_view_file_paths(view_id));
+        ui->tabWidgetLog->replace_placeholder_tab(index, log_view_widget);
+        log_view_widget->auto_resize_columns();
+    }
+
+    return log_view_widget;
+}
+
+/**
+ * @brief Arms the idle prefetch timer if placeholder tabs are left.
+ */
+auto MainWindow::schedule_view_prefetch() -> void
+{
+    if (!m_controller->get_deferred_view_ids().isEmpty() && !m_view_prefetch_timer->isActive())
+    {
+        m_view_prefetch_timer->start();
+    }
+}
+
 /**
  * @brief Parses a SessionViewState from a JSON object.
  * @param view_obj The view JSON object.
@@ -1283,6 +1628,14 @@ auto MainWindow::create_log_view_widget_for_view(const QUuid& view_id,
 
     auto* paging_proxy = m_controller->get_paging_proxy(view_id);
     log_view_widget->set_model(paging_proxy);
+    log_view_widget->get_density_summary()->set_task_registry(m_controller->get_task_registry(),
+                                                              view_id);
+
+    auto* sort_proxy = m_controller->get_sort_filter_proxy(view_id);
+    if (sort_proxy != nullptr)
+    {
+        sort_proxy->set_task_registry(m_controller->get_task_registry(), view_id);
+    }
 
     const QSet<QString> app_names = m_controller->get_app_names(view_id);
     log_view_widget->set_app_names(app_names);
@@ -1291,7 +1644,18 @@ auto MainWindow::create_log_view_widget_for_view(const QUuid& view_id,
     log_view_widget->set_log_levels(state.filters.log_levels);
 
     const QMap<QString, int> level_counts = m_controller->get_log_level_counts(view_id);
-    log_view_widget->set_log_level_counts(level_counts);
+    const LogFacetCounts match_counts = m_controller->get_match_counts(view_id);
+    log_view_widget->set_log_level_counts(level_counts, match_counts.get_level_counts());
+    log_view_widget->set_app_match_counts(match_counts.get_app_counts());
+
+    // The view widget follows its own counts; the shared filter bar follows the current view.
+    auto* sort_proxy = m_controller->get_sort_filter_proxy(view_id);
+
+    if (sort_proxy != nullptr)
+    {
+        connect(sort_proxy, &LogSortFilterProxyModel::match_counts_changed, this,
+                [this, view_id]() { update_filter_bar_counts(view_id); });
+    }
 
     connect(log_view_widget, &LogViewWidget::current_row_changed, this,
             &MainWindow::update_log_details);
@@ -1319,6 +1683,8 @@ auto MainWindow::create_log_view_widget_for_view(const QUuid& view_id,
                 m_controller->remove_log_file(view_id, file_path);
                 update_pagination_widget();
             });
+    connect(log_view_widget, &LogViewWidget::page_changed, this,
+            [this](int) { update_pagination_widget(); });
 
     return log_view_widget;
 }
@@ -1452,14 +1818,70 @@ auto MainWindow::handle_loading_finished(const QUuid& view_id, const QString& fi
 {
     const bool is_current = (view_id == m_controller->get_current_view());
     QFileInfo info(file_path);
-    statusBar()->showMessage(tr("Loaded %1 (%2 bytes)").arg(info.fileName()).arg(info.size()),
-                             4000);
+    QString message = tr("Loaded %1 (%2 bytes)").arg(info.fileName()).arg(info.size());
+    const int duplicates = m_controller->get_duplicate_counts(view_id).value(file_path, 0);
+
+    if (duplicates > 0)
+    {
+        message += tr(", skipped %1 duplicate line(s)").arg(duplicates);
+    }
+
+    statusBar()->showMessage(message, 4000);
 
     if (is_current)
     {
         handle_current_view_id_changed(view_id);
         update_pagination_widget();
     }
+
+    schedule_view_prefetch();
+}
+
+/**
+ * @brief Handles tab switches: materializes placeholder tabs and syncs the current view.
+ * @param index The new current tab index.
+ */
+auto MainWindow::handle_current_tab_changed(int index) -> void
+{
+    if (ui->tabWidgetLog->is_placeholder_at(index))
+    {
+        materialize_placeholder_tab(index, false);
+    }
+
+    LogViewWidget* log_view_widget = ui->tabWidgetLog->current_log_view();
+    if (log_view_widget != nullptr)
+    {
+        QUuid view_id = log_view_widget->get_view_id();
+        m_controller->set_current_view(view_id);
+        QVector<QString> file_paths = m_controller->get_view_file_paths(view_id);
+        log_view_widget->set_view_file_paths(file_paths);
+        update_pagination_widget();
+    }
+}
+
+/**
+ * @brief Materializes the next placeholder tab in the background while loading is idle.
+ *
+ * Materializes one view at a time, so background loads never compete with the active tab.
+ */
+auto MainWindow::handle_view_prefetch_timeout() -> void
+{
+    if (m_controller->is_loading_idle())
+    {
+        bool prefetched = false;
+        const int tab_count = ui->tabWidgetLog->count();
+
+        for (int i = 0; i < tab_count && !prefetched; ++i)
+        {
+            if (ui->tabWidgetLog->is_placeholder_at(i))
+            {
+                prefetched = (materialize_placeholder_tab(i, true) != nullptr);
+            }
+        }
+    }
+
+    // Retries while busy; after a prefetch it waits until that view's loading is done.
+    schedule_view_prefetch();
 }
 
 /**
@@ -1501,7 +1923,7 @@ auto MainWindow::handle_all_sessions_removed() -> void
     // Reset UI state
     ui->logFilterBarWidget->set_app_names({});
     ui->logFilterBarWidget->set_log_levels({});
-    m_log_level_pie_chart_widget->set_log_level_counts({});
+    set_log_level_pie_chart_counts({});
     update_pagination_widget();
 
     show_start_page_if_needed();
@@ -1522,7 +1944,7 @@ auto MainWindow::handle_close_session(const QString& session_id) -> void
         // Reset UI state
         ui->logFilterBarWidget->set_app_names({});
         ui->logFilterBarWidget->set_log_levels({});
-        m_log_level_pie_chart_widget->set_log_level_counts({});
+        set_log_level_pie_chart_counts({});
         update_pagination_widget();
     }
 
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "Qt-LogViewer/Controllers/DeviceIoScheduler.h"
+
+/**
+ * @file DeviceIoSchedulerTest.h
+ * @brief Test fixture for DeviceIoScheduler.
+ *
+ * Covers per-device limits, fixed sequential limits for rotational and network devices, and
+ * throughput-driven probing and settling on parallel devices.
+ */
+class DeviceIoSchedulerTest: public ::testing::Test
+{
+    protected:
+        DeviceIoSchedulerTest() = default;
+        ~DeviceIoSchedulerTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Runs one load of a sizeable file at a concurrency level.
+         * @param key The device key.
+         * @param concurrency The number of loads running on the device.
+         * @param mb_per_s The aggregate throughput the device delivers at that level.
+         */
+        auto run_load(quint64 key, int concurrency, double mb_per_s) -> void;
+
+        DeviceIoScheduler m_scheduler;
+};
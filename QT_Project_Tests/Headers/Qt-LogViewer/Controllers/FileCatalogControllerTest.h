@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <QModelIndex>
+#include <QStringList>
+
 #include "Qt-LogViewer/Controllers/FileCatalogController.h"
 #include "Qt-LogViewer/Controllers/LogIngestController.h"
 #include "Qt-LogViewer/Models/LogFileTreeModel.h"
@@ -15,6 +18,7 @@
  * - Adding multiple files via `add_files`.
  * - Removing a file from the catalog.
  * - Fallback path when ingest is null (uses LogLoader::identify_app).
+ * - Provisional group while identifying, and the identification cache.
  */
 class FileCatalogControllerTest: public ::testing::Test
 {
@@ -52,6 +56,21 @@ class FileCatalogControllerTest: public ::testing::Test
          */
         [[nodiscard]] static auto root_row_count(LogFileTreeModel* model) -> int;
 
+        /**
+         * @brief Waits until the controller has identified all added files.
+         * @return True if identification finished in time.
+         */
+        auto wait_for_identification() -> bool;
+
+        /**
+         * @brief Returns the display names of the groups below a session.
+         * @param model Target log file tree model.
+         * @param session_index The session index.
+         * @return Group names in row order.
+         */
+        [[nodiscard]] static auto group_names(LogFileTreeModel* model,
+                                              const QModelIndex& session_index) -> QStringList;
+
         FileCatalogController* m_ctrl = nullptr;
         LogIngestController* m_ingest = nullptr;
         QString m_temp1;
@@ -13,7 +13,7 @@
  * @brief Test fixture for LogViewLoadQueue.
  *
  * Covers enqueue deduplication, FIFO ordering, starting behavior, active state management,
- * pending cleanup per view, and cancel semantics.
+ * pending cleanup per view, cancel semantics, and per-device concurrency limits across loaders.
  */
 class LogViewLoadQueueTest: public ::testing::Test
 {
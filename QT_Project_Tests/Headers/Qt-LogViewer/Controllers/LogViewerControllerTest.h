@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include <QModelIndex>
 #include <QSet>
 #include <QString>
 #include <QTemporaryFile>
@@ -33,6 +34,13 @@ class LogViewerControllerTest: public ::testing::Test
          */
         auto create_temp_file(const QVector<QString>& lines) -> QTemporaryFile*;
 
+        /**
+         * @brief Waits until no file of a session is left in the provisional tree group.
+         * @param session_index The session index in the LogFileTreeModel.
+         * @return True if all files were identified in time.
+         */
+        auto wait_for_tree_identification(const QModelIndex& session_index) -> bool;
+
         LogViewerController* m_controller = nullptr;
         QVector<QTemporaryFile*> m_temp_files;
         QVector<QString> m_temp_file_names;
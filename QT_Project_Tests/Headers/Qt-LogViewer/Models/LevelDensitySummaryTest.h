@@ -0,0 +1,48 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QString>
+
+#include "Qt-LogViewer/Models/LevelDensitySummary.h"
+#include "Qt-LogViewer/Models/LogModel.h"
+#include "Qt-LogViewer/Models/LogSortFilterProxyModel.h"
+
+/**
+ * @file LevelDensitySummaryTest.h
+ * @brief Test fixture for LevelDensitySummary.
+ *
+ * Covers the chunked rebuild, incremental appends, removals and data changes, the bucket cap,
+ * and rebuilds after sorting and searching.
+ */
+class LevelDensitySummaryTest: public ::testing::Test
+{
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Appends entries of one level and file to the model.
+         * @param count Number of entries.
+         * @param level Level name, e.g. "ERROR".
+         * @param file_path File the entries belong to.
+         */
+        auto add_entries(int count, const QString& level, const QString& file_path) -> void;
+
+        /**
+         * @brief Waits until the summary covers the whole view.
+         * @return True if the rebuild finished in time.
+         */
+        [[nodiscard]] auto wait_for_rebuild() const -> bool;
+
+        /**
+         * @brief Sums a level lane over all buckets.
+         * @param level The lane.
+         * @return The total count.
+         */
+        [[nodiscard]] auto total_of(LevelDensitySummary::Level level) const -> int;
+
+        LogModel* m_model = nullptr;
+        LogSortFilterProxyModel* m_proxy = nullptr;
+        LevelDensitySummary* m_summary = nullptr;
+};
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QString>
+#include <QVector>
+
+#include "Qt-LogViewer/Models/LogBaseline.h"
+
+/**
+ * @file LogBaselineTest.h
+ * @brief Test fixture for LogBaseline.
+ *
+ * Checks the message normalization, the membership probes, the filter size and the novelty tags.
+ */
+class LogBaselineTest: public ::testing::Test
+{
+    protected:
+        LogBaselineTest() = default;
+        ~LogBaselineTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Builds entries of one file.
+         * @param messages One message per entry.
+         * @return Entries vector.
+         */
+        static auto make_entries(const QVector<QString>& messages) -> QVector<LogEntry>;
+};
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "Qt-LogViewer/Models/LogDecodeCache.h"
+
+/**
+ * @file LogDecodeCacheTest.h
+ * @brief Test fixture for LogDecodeCache.
+ *
+ * Checks lookups, the byte budget and least recently used eviction.
+ */
+class LogDecodeCacheTest: public ::testing::Test
+{
+    protected:
+        LogDecodeCacheTest() = default;
+        ~LogDecodeCacheTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+};
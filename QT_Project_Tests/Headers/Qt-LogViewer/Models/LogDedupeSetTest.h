@@ -0,0 +1,33 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QString>
+#include <QVector>
+
+#include "Qt-LogViewer/Models/LogDedupeSet.h"
+
+/**
+ * @file LogDedupeSetTest.h
+ * @brief Test fixture for LogDedupeSet.
+ *
+ * Checks the keys, duplicate marking across files, the per-file counts and merging a seeded set.
+ */
+class LogDedupeSetTest: public ::testing::Test
+{
+    protected:
+        LogDedupeSetTest() = default;
+        ~LogDedupeSetTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Builds entries with fixed timestamps for a file.
+         * @param file_path Absolute file path.
+         * @param messages One message per entry.
+         * @return Entries vector.
+         */
+        static auto make_entries(const QString& file_path, const QVector<QString>& messages)
+            -> QVector<LogEntry>;
+};
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QVector>
+
+#include "Qt-LogViewer/Models/LogEntry.h"
+#include "Qt-LogViewer/Models/LogEntryStore.h"
+
+/**
+ * @file LogEntryStoreTest.h
+ * @brief Test fixture for LogEntryStore.
+ *
+ * Covers appends across segment boundaries, snapshot isolation from later appends and removals,
+ * epochs, and lock-free reads from a worker thread during ingestion.
+ */
+class LogEntryStoreTest: public ::testing::Test
+{
+    protected:
+        /**
+         * @brief Creates entries whose message is their global index.
+         * @param first Index of the first entry.
+         * @param count Number of entries.
+         * @param file_path File the entries belong to.
+         * @return The entries.
+         */
+        [[nodiscard]] static auto make_entries(int first, int count,
+                                               const QString& file_path = "a.log")
+            -> QVector<LogEntry>;
+
+        LogEntryStore m_store;
+};
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "Qt-LogViewer/Models/LogFacetCounts.h"
+
+/**
+ * @file LogFacetCountsTest.h
+ * @brief Test fixture for LogFacetCounts.
+ *
+ * Checks counting, removal and merging of per-level, per-app and per-file counts.
+ */
+class LogFacetCountsTest: public ::testing::Test
+{
+    protected:
+        LogFacetCountsTest() = default;
+        ~LogFacetCountsTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+};
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "Qt-LogViewer/Models/LogFilter.h"
+#include "Qt-LogViewer/Models/LogModel.h"
+#include "Qt-LogViewer/Models/LogSortFilterProxyModel.h"
+
+/**
+ * @file LogFilterTest.h
+ * @brief Test fixture for LogFilter.
+ *
+ * Checks that verdicts computed without a model (as on parser threads) agree with the proxy,
+ * and that decisions depending on the model's column typing are left undecided.
+ */
+class LogFilterTest: public ::testing::Test
+{
+    protected:
+        LogFilterTest() = default;
+        ~LogFilterTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Checks every row: decided model-free verdicts must match the proxy.
+         */
+        auto expect_agreement_with_proxy() const -> void;
+
+        LogModel* m_model = nullptr;
+        LogSortFilterProxyModel* m_proxy = nullptr;
+};
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "Qt-LogViewer/Models/LogLevelClassifier.h"
+
+/**
+ * @file LogLevelClassifierTest.h
+ * @brief Test fixture for LogLevelClassifier.
+ *
+ * Checks that the packed fast path gives the same levels as the substring rules.
+ */
+class LogLevelClassifierTest: public ::testing::Test
+{
+    protected:
+        LogLevelClassifierTest() = default;
+        ~LogLevelClassifierTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+};
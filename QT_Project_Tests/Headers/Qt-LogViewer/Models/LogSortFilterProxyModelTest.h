@@ -10,7 +10,8 @@
  * @brief Test fixture for LogSortFilterProxyModel.
  *
  * Covers app/level/search filters, file visibility filters (show-only, hidden), signals,
- * and sorting behavior.
+ * sorting behavior, precomputed batch verdicts, facet counts and the worker passes of large
+ * views.
  */
 class LogSortFilterProxyModelTest: public ::testing::Test
 {
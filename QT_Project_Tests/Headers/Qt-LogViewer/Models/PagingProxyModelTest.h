@@ -0,0 +1,30 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QStandardItemModel>
+
+#include "Qt-LogViewer/Models/PagingProxyModel.h"
+
+/**
+ * @file PagingProxyModelTest.h
+ * @brief Test fixture for PagingProxyModel.
+ */
+class PagingProxyModelTest: public ::testing::Test
+{
+    protected:
+        PagingProxyModelTest() = default;
+        ~PagingProxyModelTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Appends rows to the source model.
+         * @param count Number of rows to append.
+         */
+        auto append_rows(int count) -> void;
+
+        QStandardItemModel* m_source = nullptr;
+        PagingProxyModel* m_paging = nullptr;
+};
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QByteArray>
+#include <QString>
+#include <QTemporaryDir>
+
+#include "Qt-LogViewer/Services/FolderScanner.h"
+
+/**
+ * @file FolderScannerTest.h
+ * @brief Test fixture for FolderScanner.
+ */
+class FolderScannerTest: public ::testing::Test
+{
+    protected:
+        FolderScannerTest() = default;
+        ~FolderScannerTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Writes a file below the temporary folder.
+         * @param relative_path Path relative to the temporary folder.
+         * @param bytes Bytes to write.
+         * @return Absolute path of the created file.
+         */
+        auto write_file(const QString& relative_path, const QByteArray& bytes) -> QString;
+
+        QTemporaryDir* m_dir = nullptr;
+};
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QByteArray>
+#include <QVector>
+
+#include "Qt-LogViewer/Services/LineSplitter.h"
+
+/**
+ * @file LineSplitterTest.h
+ * @brief Test fixture for LineSplitter.
+ *
+ * Compares the vectorized splitter with the scalar reference on random buffers and at vector
+ * boundaries, and measures the splitting throughput.
+ */
+class LineSplitterTest: public ::testing::Test
+{
+    protected:
+        LineSplitterTest() = default;
+        ~LineSplitterTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Creates a buffer of random printable lines.
+         * @param size The buffer size in bytes.
+         * @param average_line_length Average number of bytes per line.
+         * @return The buffer.
+         */
+        static auto make_log_buffer(qsizetype size, int average_line_length) -> QByteArray;
+
+        /**
+         * @brief Checks that split_lines() and split_lines_scalar() agree on a buffer.
+         * @param buffer The buffer.
+         * @param scan_from The offset to start looking for '\n'.
+         */
+        static auto expect_same_spans(const QByteArray& buffer, qsizetype scan_from = 0) -> void;
+};
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QByteArray>
+#include <QString>
+#include <QStringList>
+
+#include "Qt-LogViewer/Services/LogBaselineBuilder.h"
+
+/**
+ * @file LogBaselineBuilderTest.h
+ * @brief Test fixture for LogBaselineBuilder.
+ */
+class LogBaselineBuilderTest: public ::testing::Test
+{
+    protected:
+        LogBaselineBuilderTest() = default;
+        ~LogBaselineBuilderTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Writes the given bytes into a new temporary log file.
+         * @param bytes Bytes to write.
+         * @return Absolute path of the created file.
+         */
+        auto write_temp_file(const QByteArray& bytes) -> QString;
+
+        QStringList m_temp_files;
+};
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "Qt-LogViewer/Services/LogEntryAssembler.h"
+
+/**
+ * @file LogEntryAssemblerTest.h
+ * @brief Test fixture for LogEntryAssembler.
+ */
+class LogEntryAssemblerTest: public ::testing::Test
+{
+    protected:
+        LogEntryAssemblerTest() = default;
+        ~LogEntryAssemblerTest() override = default;
+
+        /**
+         * @brief Builds a parsed entry as LogParser would return it for a matching line.
+         * @param message The entry message.
+         * @return The entry.
+         */
+        static auto make_entry(const QString& message) -> LogEntry;
+};
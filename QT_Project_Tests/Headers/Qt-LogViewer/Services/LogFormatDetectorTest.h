@@ -0,0 +1,32 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QString>
+#include <QStringList>
+
+#include "Qt-LogViewer/Services/LogFormatDetector.h"
+
+/**
+ * @file LogFormatDetectorTest.h
+ * @brief Test fixture for LogFormatDetector.
+ */
+class LogFormatDetectorTest: public ::testing::Test
+{
+    protected:
+        LogFormatDetectorTest() = default;
+        ~LogFormatDetectorTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Writes the given lines into a new temporary file.
+         * @param lines Lines to write.
+         * @return Absolute path of the created file.
+         */
+        auto write_temp_file(const QStringList& lines) -> QString;
+
+        LogFormatDetector* m_detector = nullptr;
+        QStringList m_temp_files;
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QByteArray>
+#include <QString>
+#include <QStringList>
+
+#include "Qt-LogViewer/Services/LogLineReader.h"
+
+/**
+ * @file LogLineReaderTest.h
+ * @brief Test fixture for LogLineReader.
+ */
+class LogLineReaderTest: public ::testing::Test
+{
+    protected:
+        LogLineReaderTest() = default;
+        ~LogLineReaderTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Writes the given raw bytes into a new temporary file.
+         * @param bytes Bytes to write.
+         * @return Absolute path of the created file.
+         */
+        auto write_temp_file(const QByteArray& bytes) -> QString;
+
+        /**
+         * @brief Reads all lines of a file through a LogLineReader.
+         * @param file_path The file to read.
+         * @param invalid_lines Output for the number of invalid UTF-8 lines.
+         * @return The decoded lines.
+         */
+        static auto read_all_lines(const QString& file_path, qsizetype& invalid_lines)
+            -> QStringList;
+
+        QStringList m_temp_files;
+};
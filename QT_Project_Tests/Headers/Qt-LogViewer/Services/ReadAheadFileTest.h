@@ -0,0 +1,35 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QByteArray>
+#include <QString>
+#include <QStringList>
+
+#include "Qt-LogViewer/Services/ReadAheadFile.h"
+
+/**
+ * @file ReadAheadFileTest.h
+ * @brief Test fixture for ReadAheadFile.
+ *
+ * Covers byte-exact reading across pool buffers, backpressure and stall counting, early close
+ * and reading through LogLineReader.
+ */
+class ReadAheadFileTest: public ::testing::Test
+{
+    protected:
+        ReadAheadFileTest() = default;
+        ~ReadAheadFileTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Writes the given raw bytes into a new temporary file.
+         * @param bytes Bytes to write.
+         * @return Absolute path of the created file.
+         */
+        auto write_temp_file(const QByteArray& bytes) -> QString;
+
+        QStringList m_temp_files;
+};
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QString>
+
+#include "Qt-LogViewer/Services/SessionManager.h"
+#include "Qt-LogViewer/Services/SessionRepository.h"
+
+/**
+ * @file SessionManagerTest.h
+ * @brief Test fixture for SessionManager (in-memory state and deferred persistence).
+ */
+class SessionManagerTest: public ::testing::Test
+{
+    protected:
+        SessionManagerTest() = default;
+        ~SessionManagerTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Replaces the manager by a new one on the same directory, as on an application
+         *        start.
+         */
+        auto restart_manager() -> void;
+
+        /**
+         * @brief Returns the absolute base directory path used by the repository.
+         */
+        [[nodiscard]] auto get_base_dir() const -> QString;
+
+        SessionManager* m_manager = nullptr;
+        SessionRepository* m_repo = nullptr;
+        QString m_subdir;
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "Qt-LogViewer/Services/StartupProfiler.h"
+
+/**
+ * @file StartupProfilerTest.h
+ * @brief Test fixture for StartupProfiler.
+ */
+class StartupProfilerTest: public ::testing::Test
+{
+    protected:
+        StartupProfilerTest() = default;
+        ~StartupProfilerTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+};
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QTemporaryDir>
+
+#include "Qt-LogViewer/Services/StorageDevice.h"
+
+/**
+ * @file StorageDeviceTest.h
+ * @brief Test fixture for StorageDevice.
+ */
+class StorageDeviceTest: public ::testing::Test
+{
+    protected:
+        StorageDeviceTest() = default;
+        ~StorageDeviceTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        QTemporaryDir m_temp_dir;
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "Qt-LogViewer/Services/TaskRegistry.h"
+
+/**
+ * @file TaskRegistryTest.h
+ * @brief Test fixture for TaskRegistry and TaskToken.
+ *
+ * Covers token sharing across copies and threads, cancellation by owner and for all tasks, and
+ * polled progress reporting, including ending abandoned tasks.
+ */
+class TaskRegistryTest: public ::testing::Test
+{
+    protected:
+        TaskRegistryTest() = default;
+        ~TaskRegistryTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        TaskRegistry* m_registry = nullptr;
+};
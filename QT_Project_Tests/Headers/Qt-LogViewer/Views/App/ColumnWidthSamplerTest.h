@@ -0,0 +1,22 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QStandardItemModel>
+
+#include "Qt-LogViewer/Views/App/ColumnWidthSampler.h"
+
+/**
+ * @file ColumnWidthSamplerTest.h
+ * @brief Test fixture for ColumnWidthSampler.
+ *
+ * Covers stratified row selection, widest-text statistics, skipped columns and resets.
+ */
+class ColumnWidthSamplerTest: public ::testing::Test
+{
+    protected:
+        void SetUp() override;
+
+        QStandardItemModel m_model;
+        ColumnWidthSampler m_sampler;
+};
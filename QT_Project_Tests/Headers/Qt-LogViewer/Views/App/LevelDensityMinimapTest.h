@@ -0,0 +1,33 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "Qt-LogViewer/Models/LevelDensitySummary.h"
+#include "Qt-LogViewer/Models/LogModel.h"
+#include "Qt-LogViewer/Models/LogSortFilterProxyModel.h"
+#include "Qt-LogViewer/Views/App/LevelDensityMinimap.h"
+
+/**
+ * @file LevelDensityMinimapTest.h
+ * @brief Test fixture for LevelDensityMinimap.
+ *
+ * Covers the y-to-row mapping, click forwarding, the rendered colors and the render time.
+ */
+class LevelDensityMinimapTest: public ::testing::Test
+{
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Appends entries of one level to the model and waits for the summary.
+         * @param count Number of entries.
+         * @param level Level name, e.g. "ERROR".
+         */
+        auto add_entries(int count, const QString& level) -> void;
+
+        LogModel* m_model = nullptr;
+        LogSortFilterProxyModel* m_proxy = nullptr;
+        LevelDensitySummary* m_summary = nullptr;
+        LevelDensityMinimap* m_minimap = nullptr;
+};
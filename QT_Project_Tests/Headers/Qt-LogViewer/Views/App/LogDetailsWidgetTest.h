@@ -0,0 +1,39 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QByteArray>
+
+#include "Qt-LogViewer/Models/LogEntry.h"
+#include "Qt-LogViewer/Views/App/LogDetailsWidget.h"
+
+/**
+ * @file LogDetailsWidgetTest.h
+ * @brief Test fixture for LogDetailsWidget.
+ *
+ * Covers chunked loading of large messages, JSON/XML pretty printing on and off the worker,
+ * dropping of stale formatting results, the selection cost for large messages and reading
+ * truncated lines from their file.
+ */
+class LogDetailsWidgetTest: public ::testing::Test
+{
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Builds an entry with the given UTF-8 message.
+         * @param message The message bytes.
+         * @return The entry.
+         */
+        [[nodiscard]] static auto make_entry(const QByteArray& message) -> LogEntry;
+
+        /**
+         * @brief Builds a compact JSON array of roughly the given size.
+         * @param size Approximate size in bytes.
+         * @return The JSON text.
+         */
+        [[nodiscard]] static auto make_json(qsizetype size) -> QByteArray;
+
+        LogDetailsWidget* m_widget = nullptr;
+};
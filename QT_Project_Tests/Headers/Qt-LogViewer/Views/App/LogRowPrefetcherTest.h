@@ -0,0 +1,37 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <QSortFilterProxyModel>
+
+#include "Qt-LogViewer/Models/LogModel.h"
+#include "Qt-LogViewer/Models/PagingProxyModel.h"
+#include "Qt-LogViewer/Views/App/LogRowPrefetcher.h"
+
+/**
+ * @file LogRowPrefetcherTest.h
+ * @brief Test fixture for LogRowPrefetcher.
+ *
+ * Runs the prefetcher on a LogModel behind a sort proxy and a paging proxy (page size 10).
+ */
+class LogRowPrefetcherTest: public ::testing::Test
+{
+    protected:
+        LogRowPrefetcherTest() = default;
+        ~LogRowPrefetcherTest() override = default;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Checks whether the message of a flat (sort proxy) row is cached.
+         * @param row The sort proxy row.
+         * @return True if the model's decode cache holds the row.
+         */
+        [[nodiscard]] auto is_decoded(int row) const -> bool;
+
+        LogModel m_model;
+        QSortFilterProxyModel m_sort_proxy;
+        PagingProxyModel m_paging;
+        LogRowPrefetcher m_prefetcher;
+};
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "Qt-LogViewer/Models/LogModel.h"
+#include "Qt-LogViewer/Views/App/LogTableView.h"
+
+/**
+ * @file LogTableViewTest.h
+ * @brief Test fixture for LogTableView.
+ *
+ * Covers content-based column sizing from sampled rows.
+ */
+class LogTableViewTest: public ::testing::Test
+{
+    protected:
+        void SetUp() override;
+        void TearDown() override;
+
+        /**
+         * @brief Appends entries with the given app name.
+         * @param count Number of entries.
+         * @param app_name App name of the entries.
+         */
+        auto add_entries(int count, const QString& app_name) -> void;
+
+        LogModel* m_model = nullptr;
+        LogTableView* m_view = nullptr;
+};
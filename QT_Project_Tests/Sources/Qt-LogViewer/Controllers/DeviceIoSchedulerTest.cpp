@@ -0,0 +1,121 @@
+#include "Qt-LogViewer/Controllers/DeviceIoSchedulerTest.h"
+
+namespace
+{
+constexpr quint64 k_ssd = 1;
+constexpr quint64 k_hdd = 2;
+}  // namespace
+
+/**
+ * @brief Registers one parallel and one sequential device.
+ */
+void DeviceIoSchedulerTest::SetUp()
+{
+    m_scheduler.register_device(StorageDevice::Info{k_ssd, "nvme0n1", false});
+    m_scheduler.register_device(StorageDevice::Info{k_hdd, "sda", true});
+}
+
+/**
+ * @brief Tears down the test fixture after each test.
+ */
+void DeviceIoSchedulerTest::TearDown() {}
+
+/**
+ * @brief Runs one load of a sizeable file at a concurrency level.
+ * @param key The device key.
+ * @param concurrency The number of loads running on the device.
+ * @param mb_per_s The aggregate throughput the device delivers at that level.
+ */
+auto DeviceIoSchedulerTest::run_load(quint64 key, int concurrency, double mb_per_s) -> void
+{
+    const qint64 bytes = 4 * DeviceIoScheduler::get_min_sample_bytes();
+    const double per_load_mb_per_s = mb_per_s / concurrency;
+    const auto elapsed_ns = static_cast<qint64>(static_cast<double>(bytes) / 1e6 /
+                                                per_load_mb_per_s * 1e9);
+
+    m_scheduler.on_started(key);
+    m_scheduler.on_finished(key, bytes, elapsed_ns, concurrency);
+}
+
+/**
+ * @test Devices start with one load each, so different devices still load in parallel.
+ */
+TEST_F(DeviceIoSchedulerTest, LimitsArePerDevice)
+{
+    EXPECT_TRUE(m_scheduler.can_start(k_ssd));
+    EXPECT_TRUE(m_scheduler.can_start(k_hdd));
+
+    EXPECT_EQ(m_scheduler.on_started(k_ssd), 1);
+    EXPECT_FALSE(m_scheduler.can_start(k_ssd));
+    EXPECT_TRUE(m_scheduler.can_start(k_hdd));
+
+    m_scheduler.on_finished(k_ssd, 100, 1000, 1);
+    EXPECT_TRUE(m_scheduler.can_start(k_ssd));
+    EXPECT_EQ(m_scheduler.get_active(k_ssd), 0);
+}
+
+/**
+ * @test Sequential devices keep one load regardless of throughput.
+ */
+TEST_F(DeviceIoSchedulerTest, SequentialDeviceStaysAtOne)
+{
+    run_load(k_hdd, 1, 150.0);
+    run_load(k_hdd, 1, 150.0);
+
+    EXPECT_EQ(m_scheduler.get_limit(k_hdd), 1);
+}
+
+/**
+ * @test Parallel devices probe upward while it pays off and settle on the best level.
+ */
+TEST_F(DeviceIoSchedulerTest, ParallelDeviceProbesAndSettles)
+{
+    run_load(k_ssd, 1, 500.0);
+    EXPECT_EQ(m_scheduler.get_limit(k_ssd), 2);
+
+    run_load(k_ssd, 2, 900.0);
+    EXPECT_EQ(m_scheduler.get_limit(k_ssd), 3);
+
+    // Three loads are no faster than two: settle back on two.
+    run_load(k_ssd, 3, 920.0);
+    EXPECT_EQ(m_scheduler.get_limit(k_ssd), 2);
+
+    run_load(k_ssd, 2, 900.0);
+    EXPECT_EQ(m_scheduler.get_limit(k_ssd), 2);
+}
+
+/**
+ * @test Small loads are not measured and leave the limit alone.
+ */
+TEST_F(DeviceIoSchedulerTest, SmallLoadsDoNotTune)
+{
+    m_scheduler.on_started(k_ssd);
+    m_scheduler.on_finished(k_ssd, DeviceIoScheduler::get_min_sample_bytes() - 1, 1000, 1);
+
+    EXPECT_EQ(m_scheduler.get_limit(k_ssd), 1);
+
+    const auto metrics = m_scheduler.get_metrics();
+    ASSERT_EQ(metrics.size(), 2);
+}
+
+/**
+ * @test Metrics report the measured throughput of a device.
+ */
+TEST_F(DeviceIoSchedulerTest, MetricsReportThroughput)
+{
+    run_load(k_hdd, 1, 120.0);
+
+    bool found = false;
+    for (const auto& device: m_scheduler.get_metrics())
+    {
+        if (device.key == k_hdd)
+        {
+            found = true;
+            EXPECT_EQ(device.name, "sda");
+            EXPECT_TRUE(device.sequential);
+            EXPECT_EQ(device.completed, 1);
+            EXPECT_NEAR(device.throughput_mb_s, 120.0, 1.0);
+        }
+    }
+    EXPECT_TRUE(found);
+}
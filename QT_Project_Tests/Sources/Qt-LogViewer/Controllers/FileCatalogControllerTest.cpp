@@ -1,8 +1,10 @@
 #include "Qt-LogViewer/Controllers/FileCatalogControllerTest.h"
 
 #include <QDir>
+#include <QFileInfo>
 #include <QModelIndex>
 #include <QTemporaryFile>
+#include <QTest>
 #include <QTextStream>
 
 #include "Qt-LogViewer/Models/LogFileInfo.h"
@@ -92,6 +94,33 @@ auto FileCatalogControllerTest::root_row_count(LogFileTreeModel* model) -> int
     return (model != nullptr) ? model->rowCount(QModelIndex()) : -1;
 }
 
+/**
+ * @brief Waits until the controller has identified all added files.
+ * @return True if identification finished in time.
+ */
+auto FileCatalogControllerTest::wait_for_identification() -> bool
+{
+    return QTest::qWaitFor([this]() { return !m_ctrl->is_identifying(); });
+}
+
+/**
+ * @brief Returns the display names of the groups below a session.
+ * @param model Target log file tree model.
+ * @param session_index The session index.
+ * @return Group names in row order.
+ */
+auto FileCatalogControllerTest::group_names(LogFileTreeModel* model,
+                                            const QModelIndex& session_index) -> QStringList
+{
+    QStringList names;
+    for (int i = 0; i < model->rowCount(session_index); ++i)
+    {
+        const auto idx = model->index(i, LogFileTreeModel::Column::Name, session_index);
+        names.append(model->data(idx, Qt::DisplayRole).toString());
+    }
+    return names;
+}
+
 /**
  * @brief add_file should parse first entry via ingest and add one group to the session.
  */
@@ -108,11 +137,13 @@ TEST_F(FileCatalogControllerTest, AddFileUsesParsedAppNameAndAddsToModel)
 
     const int before_groups = model->rowCount(s_index);
 
-    // add_file uses ingest to parse "TestApp" and adds under the only session
+    // add_file identifies "TestApp" in the background and adds under the only session
     m_ctrl->add_file(m_temp1);
+    ASSERT_TRUE(wait_for_identification());
 
     const int after_groups = model->rowCount(s_index);
     EXPECT_EQ(after_groups, before_groups + 1);
+    EXPECT_TRUE(group_names(model, s_index).contains(QStringLiteral("TestApp")));
 }
 
 /**
@@ -133,6 +164,7 @@ TEST_F(FileCatalogControllerTest, AddFilesAddsMultiple)
     QVector<QString> files;
     files << m_temp1 << m_temp2;
     m_ctrl->add_files(files);
+    ASSERT_TRUE(wait_for_identification());
 
     // Same app name "TestApp" -> exactly one new group in session
     const int after_groups = model->rowCount(s_index);
@@ -169,6 +201,7 @@ TEST_F(FileCatalogControllerTest, RemoveFileRemovesFromModel)
 
     // Add one file via ingest-parsed entry ("TestApp" from temp content)
     m_ctrl->add_file(m_temp1);
+    ASSERT_TRUE(wait_for_identification());
     const int groups_after_add = model->rowCount(s_index);
 
     // Build matching LogFileInfo to remove (path + app name "TestApp")
@@ -203,3 +236,121 @@ TEST_F(FileCatalogControllerTest, AddFileWithNullIngestFallsBackAndAdds)
     const int after_groups = model->rowCount(s_index);
     EXPECT_EQ(after_groups, before_groups + 1);
 }
+
+/**
+ * @brief A file shows up in the provisional group right away and is regrouped when identified.
+ */
+TEST_F(FileCatalogControllerTest, AddFileIsProvisionalUntilIdentified)
+{
+    auto* model = m_ctrl->get_model();
+    ASSERT_TRUE(model->add_session("S", "S"));
+    const QModelIndex s_index = model->get_session_index("S");
+
+    m_ctrl->add_file_to_session(QStringLiteral("S"), m_temp1);
+
+    EXPECT_EQ(group_names(model, s_index),
+              QStringList{LogFileTreeModel::get_provisional_group_name()});
+
+    ASSERT_TRUE(wait_for_identification());
+
+    EXPECT_EQ(group_names(model, s_index), QStringList{QStringLiteral("TestApp")});
+}
+
+/**
+ * @brief Re-adding an unchanged file uses the cached app name without a provisional step.
+ */
+TEST_F(FileCatalogControllerTest, ReAddUsesCachedAppName)
+{
+    auto* model = m_ctrl->get_model();
+    ASSERT_TRUE(model->add_session("S", "S"));
+    const QModelIndex s_index = model->get_session_index("S");
+
+    m_ctrl->add_file_to_session(QStringLiteral("S"), m_temp1);
+    ASSERT_TRUE(wait_for_identification());
+    m_ctrl->remove_file(LogFileInfo(m_temp1, QStringLiteral("TestApp")));
+    ASSERT_EQ(model->rowCount(s_index), 0);
+
+    m_ctrl->add_file_to_session(QStringLiteral("S"), m_temp1);
+
+    EXPECT_FALSE(m_ctrl->is_identifying());
+    EXPECT_EQ(group_names(model, s_index), QStringList{QStringLiteral("TestApp")});
+}
+
+/**
+ * @brief Removing a file that is still being identified removes it from the provisional group.
+ */
+TEST_F(FileCatalogControllerTest, RemoveProvisionalFile)
+{
+    auto* model = m_ctrl->get_model();
+    ASSERT_TRUE(model->add_session("S", "S"));
+    const QModelIndex s_index = model->get_session_index("S");
+
+    m_ctrl->add_file_to_session(QStringLiteral("S"), m_temp2);
+    m_ctrl->remove_file(LogFileInfo(m_temp2, QStringLiteral("TestApp")));
+
+    EXPECT_EQ(model->rowCount(s_index), 0);
+
+    // The late identification result must not bring the file back.
+    ASSERT_TRUE(wait_for_identification());
+    EXPECT_EQ(model->rowCount(s_index), 0);
+}
+
+/**
+ * @brief A batch of files lands in one provisional group and is regrouped into one app group.
+ */
+TEST_F(FileCatalogControllerTest, AddFilesRegroupsBatch)
+{
+    auto* model = m_ctrl->get_model();
+    ASSERT_TRUE(model->add_session("S", "S"));
+    const QModelIndex s_index = model->get_session_index("S");
+
+    m_ctrl->add_files_to_session(QStringLiteral("S"), {m_temp1, m_temp2});
+
+    ASSERT_EQ(model->rowCount(s_index), 1);
+    EXPECT_EQ(model->rowCount(model->index(0, 0, s_index)), 2);
+
+    ASSERT_TRUE(wait_for_identification());
+
+    EXPECT_EQ(group_names(model, s_index), QStringList{QStringLiteral("TestApp")});
+    EXPECT_EQ(model->rowCount(model->index(0, 0, s_index)), 2);
+}
+
+/**
+ * @brief A watch folder is listed when fetched; its files get their app name once displayed.
+ */
+TEST_F(FileCatalogControllerTest, WatchFolderPopulatesOnFetch)
+{
+    auto* model = m_ctrl->get_model();
+    const QString folder = QFileInfo(m_temp1).absolutePath();
+    ASSERT_TRUE(m_ctrl->add_watch_folder(QStringLiteral("S"), folder));
+
+    const QModelIndex folder_index = model->index(0, 0, model->get_session_index("S"));
+    ASSERT_TRUE(model->canFetchMore(folder_index));
+    model->fetchMore(folder_index);
+
+    ASSERT_TRUE(QTest::qWaitFor([&]() { return !m_ctrl->is_scanning(); }, 5000));
+
+    // Other processes may change the temp folder meanwhile; keep the index valid across diffs
+    QPersistentModelIndex file_index;
+    for (int row = 0; row < model->rowCount(folder_index); ++row)
+    {
+        const QModelIndex index = model->index(row, 0, folder_index);
+        if (index.data(LogFileTreeModel::FilePathRole).toString() ==
+            QFileInfo(m_temp1).absoluteFilePath())
+        {
+            file_index = index;
+        }
+    }
+    ASSERT_TRUE(file_index.isValid());
+
+    // Displaying the file requests its metadata and app name
+    EXPECT_FALSE(file_index.data().toString().isEmpty());
+    ASSERT_TRUE(QTest::qWaitFor(
+        [&]() {
+            return file_index.data(LogFileTreeModel::AppNameRole).toString() ==
+                   QStringLiteral("TestApp");
+        },
+        5000));
+
+    EXPECT_TRUE(m_ctrl->remove_watch_folder(QStringLiteral("S"), folder));
+}
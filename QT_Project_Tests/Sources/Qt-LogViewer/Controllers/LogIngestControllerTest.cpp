@@ -584,3 +584,28 @@ TEST_F(LogIngestControllerTest, DestructorCancelsAndDisconnectsNoLateSignals)
     // No new signals must have been forwarded after deletion.
     EXPECT_EQ(before_total, after_total);
 }
+
+/**
+ * @brief start_next_if_idle() and idle report only the loads they started, not loads still
+ * running on other lanes.
+ */
+TEST_F(LogIngestControllerTest, StartNextReportsOnlyLoadsItStarted)
+{
+    ASSERT_NE(m_ctrl, nullptr);
+    ASSERT_FALSE(m_temp_log_path.isEmpty());
+
+    const QUuid v1 = QUuid::createUuid();
+    const QUuid v2 = QUuid::createUuid();
+
+    QSignalSpy spy_idle(m_ctrl, &LogIngestController::idle);
+
+    m_ctrl->enqueue_stream(v1, m_temp_log_path);
+    m_ctrl->enqueue_stream(v2, m_temp_log_path);
+
+    // Both files share one device, which starts at one load at a time.
+    EXPECT_EQ(m_ctrl->start_next_if_idle(3), QVector<QUuid>({v1}));
+    EXPECT_TRUE(m_ctrl->start_next_if_idle(3).isEmpty());
+
+    ASSERT_TRUE(spy_idle.wait(3000));
+    EXPECT_EQ(spy_idle.first().at(0).value<QVector<QUuid>>(), QVector<QUuid>({v2}));
+}
@@ -1,7 +1,11 @@
 #include "Qt-LogViewer/Controllers/LogViewContextTest.h"
 
 #include <QDateTime>
+#include <QSignalSpy>
+#include <QTest>
+#include <memory>
 
+#include "Qt-LogViewer/Models/LogBaseline.h"
 #include "Qt-LogViewer/Models/LogModel.h"
 #include "Qt-LogViewer/Models/LogSortFilterProxyModel.h"
 #include "Qt-LogViewer/Models/PagingProxyModel.h"
@@ -338,3 +342,128 @@ TEST_F(LogViewContextTest, GetEntriesIntegrityAfterRemoval)
         EXPECT_EQ(stored[i].get_app_name(), QString("B"));
     }
 }
+
+/**
+ * @brief With dedupe enabled, entries another file already has are dropped and counted.
+ */
+TEST_F(LogViewContextTest, DedupeDropsEntriesOfOverlappingFiles)
+{
+    ASSERT_NE(m_ctx, nullptr);
+
+    const QDateTime time = QDateTime::fromString("2025-01-01T10:00:00Z", Qt::ISODate);
+    const LogFileInfo a_info("C:/logs/app.log", "App");
+    const LogFileInfo b_info("C:/logs/app.log.bak", "App");
+    const QVector<LogEntry> a_entries{LogEntry(time, "INFO", "Startup complete", a_info),
+                                      LogEntry(time, "INFO", "Startup complete", a_info)};
+    const QVector<LogEntry> b_entries{LogEntry(time, "INFO", "Startup complete", b_info),
+                                      LogEntry(time, "ERROR", "Crash detected", b_info)};
+
+    m_ctx->set_dedupe_enabled(true);
+    // The parser threads compute dedupe keys only for specs asking for them
+    EXPECT_TRUE(m_ctx->get_sort_proxy()->get_filter_spec().dedupe);
+    EXPECT_FALSE(m_ctx->get_sort_proxy()->get_filter_spec().is_active());
+    m_ctx->append_entries(a_entries);
+    m_ctx->append_entries(b_entries);
+
+    // Repeats within app.log stay, the copy in app.log.bak is dropped
+    EXPECT_EQ(m_ctx->get_model()->rowCount(), 3);
+    EXPECT_EQ(m_ctx->get_duplicate_counts().value("C:/logs/app.log.bak"), 1);
+
+    m_ctx->set_dedupe_enabled(false);
+    EXPECT_FALSE(m_ctx->get_sort_proxy()->get_filter_spec().dedupe);
+    m_ctx->append_entries(b_entries);
+    EXPECT_EQ(m_ctx->get_model()->rowCount(), 5);
+    EXPECT_TRUE(m_ctx->get_duplicate_counts().isEmpty());
+}
+
+/**
+ * @brief Enabling dedupe seeds the set with the shown entries on the worker; batches appended
+ *        meanwhile are merged into the seeded set.
+ */
+TEST_F(LogViewContextTest, DedupeSeedsShownEntriesInBackground)
+{
+    ASSERT_NE(m_ctx, nullptr);
+
+    const QDateTime time = QDateTime::fromString("2025-01-01T10:00:00Z", Qt::ISODate);
+    const LogFileInfo a_info("C:/logs/app.log", "App");
+    const LogFileInfo b_info("C:/logs/app.log.bak", "App");
+    const LogFileInfo c_info("C:/logs/app.log.old", "App");
+
+    m_ctx->append_entries(QVector<LogEntry>{LogEntry(time, "INFO", "Startup complete", a_info),
+                                            LogEntry(time, "INFO", "Startup complete", a_info)});
+    m_ctx->set_dedupe_enabled(true);
+    EXPECT_TRUE(m_ctx->is_dedupe_seeding());
+
+    // Appended while seeding: checked against the keys recorded so far
+    m_ctx->append_entries(QVector<LogEntry>{LogEntry(time, "ERROR", "Crash detected", b_info)});
+
+    ASSERT_TRUE(QTest::qWaitFor([this]() { return !m_ctx->is_dedupe_seeding(); }, 5000));
+    EXPECT_EQ(m_ctx->get_model()->rowCount(), 3);
+
+    m_ctx->append_entries(QVector<LogEntry>{LogEntry(time, "INFO", "Startup complete", c_info),
+                                            LogEntry(time, "ERROR", "Crash detected", c_info)});
+    EXPECT_EQ(m_ctx->get_model()->rowCount(), 3);
+    EXPECT_EQ(m_ctx->get_duplicate_counts().value("C:/logs/app.log.old"), 2);
+}
+
+/**
+ * @brief Dropping duplicates keeps the parser's verdicts aligned with the remaining entries.
+ */
+TEST_F(LogViewContextTest, DedupeCompactsBatchVerdicts)
+{
+    ASSERT_NE(m_ctx, nullptr);
+
+    const QDateTime time = QDateTime::fromString("2025-01-01T10:00:00Z", Qt::ISODate);
+    const LogFileInfo a_info("C:/logs/a.log", "App");
+    const LogFileInfo b_info("C:/logs/b.log", "App");
+    const QVector<LogEntry> b_entries{LogEntry(time, "INFO", "shared", b_info),
+                                      LogEntry(time.addSecs(1), "INFO", "rejected", b_info),
+                                      LogEntry(time.addSecs(2), "INFO", "accepted", b_info)};
+
+    m_ctx->set_dedupe_enabled(true);
+    m_ctx->append_entries(QVector<LogEntry>{LogEntry(time, "INFO", "shared", a_info)});
+
+    // Verdicts as a parser would send them, tagged with the proxy's current settings
+    LogFilter::BatchVerdicts verdicts;
+    verdicts.spec = m_ctx->get_sort_proxy()->get_filter_spec();
+    verdicts.accepted = QBitArray(3);
+    verdicts.undecided = QBitArray(3);
+    verdicts.accepted.setBit(0);
+    verdicts.accepted.setBit(2);
+    verdicts.entry_keys = LogDedupeSet::get_keys(b_entries);
+
+    EXPECT_TRUE(m_ctx->append_entries(b_entries, verdicts));
+    EXPECT_EQ(m_ctx->get_model()->rowCount(), 3);
+
+    // a.log's row plus the accepted row of b.log; the rejected one keeps its verdict
+    EXPECT_EQ(m_ctx->get_sort_proxy()->rowCount(), 2);
+    EXPECT_EQ(m_ctx->get_duplicate_counts().value("C:/logs/b.log"), 1);
+}
+
+/**
+ * @brief A new baseline retags the rows in the background, without a model reset.
+ */
+TEST_F(LogViewContextTest, BaselineRetagsRowsWithoutReset)
+{
+    ASSERT_NE(m_ctx, nullptr);
+
+    m_ctx->append_entries(make_entries("C:/logs/app.log", "App"));
+    auto* model = m_ctx->get_model();
+    QSignalSpy reset_spy(model, &LogModel::modelReset);
+    QSignalSpy changed_spy(model, &LogModel::dataChanged);
+
+    auto baseline = std::make_shared<LogBaseline>();
+    baseline->add_entries(QVector<LogEntry>{model->get_entry(0)});
+    m_ctx->set_baseline(baseline);
+
+    ASSERT_TRUE(changed_spy.wait(3000));
+    EXPECT_EQ(reset_spy.count(), 0);
+    EXPECT_FALSE(model->get_entry(0).is_novel());
+    EXPECT_TRUE(model->get_entry(1).is_novel());
+    EXPECT_EQ(m_ctx->get_sort_proxy()->get_baseline(), baseline);
+
+    m_ctx->set_baseline(nullptr);
+    ASSERT_TRUE(changed_spy.wait(3000));
+    EXPECT_FALSE(model->get_entry(1).is_novel());
+    EXPECT_EQ(reset_spy.count(), 0);
+}
@@ -184,6 +184,22 @@ TEST_F(LogViewLoadQueueTest, FifoOrderPreserved)
     EXPECT_EQ(m_queue.get_pending_count(), 0);
 }
 
+/**
+ * @brief get_next_view_id names the view try_start_next() starts, before it starts it.
+ */
+TEST_F(LogViewLoadQueueTest, NextViewIdMatchesNextStart)
+{
+    EXPECT_TRUE(m_queue.get_next_view_id().isNull());
+
+    m_queue.enqueue(m_view_b, make_nonexistent_path());
+    m_queue.enqueue(m_view_a, make_nonexistent_path());
+    EXPECT_EQ(m_queue.get_next_view_id(), m_view_b);
+
+    ASSERT_TRUE(m_queue.try_start_next(m_loader, 10));
+    EXPECT_EQ(m_queue.get_active_view_id(), m_view_b);
+    EXPECT_EQ(m_queue.get_next_view_id(), m_view_a);
+}
+
 /**
  * @brief clear_pending_for_view removes only that view's items.
  */
@@ -339,3 +355,38 @@ TEST_F(LogViewLoadQueueTest, AccessorsReflectState)
     EXPECT_EQ(m_queue.get_active_batch_size(), 1000);
     EXPECT_EQ(m_queue.get_pending_count(), 1);
 }
+
+/**
+ * @brief Files on one device wait for the device's limit even if another loader is idle.
+ */
+TEST_F(LogViewLoadQueueTest, SameDeviceRespectsConcurrencyLimit)
+{
+    const QString format =
+        QStringLiteral("{timestamp} {level} {message} {app_name} [{file}:{line} ({function})]");
+    LogLoadingService second_loader(format);
+    const QString p1 = make_nonexistent_path();
+    const QString p2 = make_nonexistent_path();
+
+    m_queue.enqueue(m_view_a, p1);
+    m_queue.enqueue(m_view_b, p2);
+
+    ASSERT_TRUE(m_queue.try_start_next(m_loader, 10));
+    EXPECT_TRUE(m_queue.is_active(m_loader));
+
+    // Both files live in the temp directory; a fresh device allows one load at a time.
+    EXPECT_FALSE(m_queue.try_start_next(&second_loader, 10));
+    EXPECT_EQ(m_queue.get_active_count(), 1);
+    EXPECT_EQ(m_queue.get_pending_count(), 1);
+
+    m_queue.clear_active(m_loader);
+    EXPECT_FALSE(m_queue.is_active(m_loader));
+
+    ASSERT_TRUE(m_queue.try_start_next(&second_loader, 10));
+    EXPECT_EQ(m_queue.get_active_view_id(&second_loader), m_view_b);
+    EXPECT_TRUE(m_queue.get_active_view_id(m_loader).isNull());
+
+    const auto metrics = m_queue.get_device_metrics();
+    ASSERT_EQ(metrics.size(), 1);
+    EXPECT_EQ(metrics.first().active, 1);
+    EXPECT_EQ(metrics.first().completed, 1);
+}
@@ -3,6 +3,7 @@
 #include <QFile>
 #include <QSet>
 #include <QSignalSpy>
+#include <QTest>
 #include <QTextStream>
 
 #include "Qt-LogViewer/Models/LogFileTreeModel.h"
@@ -58,6 +59,28 @@ auto LogViewerControllerTest::create_temp_file(const QVector<QString>& lines) ->
     return temp_file;
 }
 
+/**
+ * @brief Waits until no file of a session is left in the provisional tree group.
+ * @param session_index The session index in the LogFileTreeModel.
+ * @return True if all files were identified in time.
+ */
+auto LogViewerControllerTest::wait_for_tree_identification(const QModelIndex& session_index)
+    -> bool
+{
+    auto* tree_model = m_controller->get_log_file_tree_model();
+
+    return QTest::qWaitFor([tree_model, session_index]() {
+        bool provisional = false;
+        for (int i = 0; i < tree_model->rowCount(session_index); ++i)
+        {
+            const QModelIndex index = tree_model->index(i, 0, session_index);
+            provisional = provisional || (tree_model->data(index, Qt::DisplayRole).toString() ==
+                                          LogFileTreeModel::get_provisional_group_name());
+        }
+        return !provisional;
+    });
+}
+
 /**
  * @brief Sets up the test fixture before each test.
  */
@@ -427,6 +450,35 @@ TEST_F(LogViewerControllerTest, RemoveLogFileRemovesEmptyView)
     }
 }
 
+/**
+ * @brief Tests remove_log_file reloads files whose entries were dropped as duplicates of the
+ *        removed file.
+ */
+TEST_F(LogViewerControllerTest, RemoveLogFileReloadsDroppedDuplicates)
+{
+    QTemporaryFile* first = create_temp_file(
+        {"2024-01-01 18:00:00 INFO Shared AppJ", "2024-01-01 18:01:00 INFO FirstOnly AppJ"});
+    QTemporaryFile* second = create_temp_file(
+        {"2024-01-01 18:00:00 INFO Shared AppJ", "2024-01-01 18:02:00 INFO SecondOnly AppJ"});
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+
+    m_controller->set_dedupe_enabled(true);
+    const QUuid view_id =
+        m_controller->load_log_files(QVector<QString>{first->fileName(), second->fileName()});
+    auto* model = m_controller->get_log_model(view_id);
+    ASSERT_NE(model, nullptr);
+    ASSERT_EQ(model->rowCount(), 3);
+
+    m_controller->remove_log_file(view_id, first->fileName());
+
+    // The second file's copy of the shared line comes back once it is read again
+    ASSERT_TRUE(QTest::qWaitFor(
+        [this, model]() { return m_controller->is_loading_idle() && model->rowCount() == 2; },
+        5000));
+    EXPECT_NE(m_controller->get_log_model(view_id), nullptr);
+}
+
 /**
  * @brief Tests remove_log_file does nothing if file is not loaded in any view.
  */
@@ -455,6 +507,7 @@ TEST_F(LogViewerControllerTest, RemoveLogFileRemovesFromTreeModel)
     ASSERT_TRUE(s_index.isValid());
 
     m_controller->add_log_file_to_tree(temp_file->fileName());
+    ASSERT_TRUE(wait_for_tree_identification(s_index));
     LogFileInfo info(temp_file->fileName(), "AppI");
 
     bool found = false;
@@ -628,6 +681,7 @@ TEST_F(LogViewerControllerTest, AddLogFileToTree)
     ASSERT_TRUE(s_index.isValid());
 
     m_controller->add_log_file_to_tree(temp_file->fileName());
+    ASSERT_TRUE(wait_for_tree_identification(s_index));
 
     bool found = false;
 
@@ -665,6 +719,7 @@ TEST_F(LogViewerControllerTest, AddLogFilesToTree)
 
     QVector<QString> files = {temp_file1->fileName(), temp_file2->fileName()};
     m_controller->add_log_files_to_tree(files);
+    ASSERT_TRUE(wait_for_tree_identification(s_index));
 
     bool found_e = false, found_f = false;
 
@@ -788,3 +843,84 @@ TEST_F(LogViewerControllerTest, InvalidViewReturnsNullptr)
     EXPECT_EQ(m_controller->get_sort_filter_proxy(invalid_id), nullptr);
     EXPECT_EQ(m_controller->get_paging_proxy(invalid_id), nullptr);
 }
+
+/**
+ * @brief Tests that a deferred view is listed and exported without creating models or loading.
+ */
+TEST_F(LogViewerControllerTest, RegisterDeferredViewCreatesNoModels)
+{
+    auto* tree_model = m_controller->get_log_file_tree_model();
+    ASSERT_NE(tree_model, nullptr);
+    ASSERT_TRUE(tree_model->add_session("S", "S"));
+
+    SessionViewState state;
+    state.tab_title = QStringLiteral("Deferred");
+    state.loaded_files.append(LogFileInfo(m_temp_file_names.first(), QStringLiteral("AppA")));
+    state.current_page = 2;
+
+    const QUuid deferred_id = m_controller->register_deferred_view(QStringLiteral("S"), state);
+
+    ASSERT_FALSE(deferred_id.isNull());
+    EXPECT_TRUE(m_controller->is_view_deferred(deferred_id));
+    EXPECT_EQ(m_controller->get_paging_proxy(deferred_id), nullptr);
+    EXPECT_TRUE(m_controller->get_all_view_ids().contains(deferred_id));
+    EXPECT_EQ(m_controller->get_view_file_paths(deferred_id),
+              QVector<QString>{m_temp_file_names.first()});
+    EXPECT_EQ(m_controller->export_view_state(deferred_id).tab_title, QStringLiteral("Deferred"));
+    EXPECT_EQ(m_controller->export_view_state(deferred_id).current_page, 2);
+    EXPECT_TRUE(m_controller->is_loading_idle());
+
+    // The explorer tree lists the file under its stored app name.
+    const QModelIndex s_index = tree_model->get_session_index("S");
+    ASSERT_TRUE(s_index.isValid());
+    EXPECT_GT(tree_model->rowCount(s_index), 0);
+}
+
+/**
+ * @brief Tests that materializing a deferred view creates its models and keeps the current view
+ *        for background prefetches.
+ */
+TEST_F(LogViewerControllerTest, MaterializeDeferredViewInBackground)
+{
+    SessionViewState state;
+    state.loaded_files.append(LogFileInfo(m_temp_file_names.last(), QStringLiteral("AppB")));
+
+    const QUuid deferred_id = m_controller->register_deferred_view(QString(), state);
+
+    EXPECT_TRUE(m_controller->materialize_view(deferred_id, true));
+    EXPECT_FALSE(m_controller->is_view_deferred(deferred_id));
+    EXPECT_NE(m_controller->get_paging_proxy(deferred_id), nullptr);
+    EXPECT_EQ(m_controller->get_current_view(), m_view_id);
+
+    // A second materialization is a no-op.
+    EXPECT_FALSE(m_controller->materialize_view(deferred_id));
+}
+
+/**
+ * @brief Tests that removing and clearing views drops deferred views as well.
+ */
+TEST_F(LogViewerControllerTest, RemoveDeferredView)
+{
+    SessionViewState state;
+    state.loaded_files.append(LogFileInfo(m_temp_file_names.first(), QStringLiteral("AppA")));
+
+    const QUuid first_id = m_controller->register_deferred_view(QString(), state);
+    const QUuid second_id = m_controller->register_deferred_view(QString(), state);
+    ASSERT_NE(first_id, second_id);
+
+    EXPECT_TRUE(m_controller->remove_view(first_id));
+    EXPECT_FALSE(m_controller->is_view_deferred(first_id));
+
+    QSignalSpy removed_spy(m_controller, &LogViewerController::view_removed);
+    m_controller->clear_all_views();
+
+    EXPECT_FALSE(m_controller->is_view_deferred(second_id));
+    EXPECT_TRUE(m_controller->get_deferred_view_ids().isEmpty());
+
+    bool second_removed = false;
+    for (const auto& args: removed_spy)
+    {
+        second_removed = second_removed || (args.at(0).toUuid() == second_id);
+    }
+    EXPECT_TRUE(second_removed);
+}
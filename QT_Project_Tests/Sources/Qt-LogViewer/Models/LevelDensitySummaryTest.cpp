@@ -0,0 +1,183 @@
+#include "Qt-LogViewer/Models/LevelDensitySummaryTest.h"
+
+#include <QDateTime>
+#include <QTest>
+#include <QVector>
+
+#include "Qt-LogViewer/Models/LogEntry.h"
+#include "Qt-LogViewer/Models/LogFileInfo.h"
+
+/**
+ * @brief Sets up the model chain and a summary of the proxy.
+ */
+void LevelDensitySummaryTest::SetUp()
+{
+    m_model = new LogModel();
+    m_proxy = new LogSortFilterProxyModel();
+    m_proxy->setSourceModel(m_model);
+    m_summary = new LevelDensitySummary();
+    m_summary->set_model(m_proxy);
+}
+
+/**
+ * @brief Tears down the summary and the model chain.
+ */
+void LevelDensitySummaryTest::TearDown()
+{
+    delete m_summary;
+    delete m_proxy;
+    delete m_model;
+    m_summary = nullptr;
+    m_proxy = nullptr;
+    m_model = nullptr;
+}
+
+/**
+ * @brief Appends entries of one level and file to the model.
+ */
+auto LevelDensitySummaryTest::add_entries(int count, const QString& level,
+                                          const QString& file_path) -> void
+{
+    const QDateTime base = QDateTime::fromString("2024-01-01 10:00:00", "yyyy-MM-dd HH:mm:ss");
+    QVector<LogEntry> entries;
+    entries.reserve(count);
+
+    for (int i = 0; i < count; ++i)
+    {
+        entries.append(LogEntry(base.addSecs(m_model->rowCount() + i), level,
+                                QStringLiteral("Message %1").arg(i),
+                                LogFileInfo(file_path, "App")));
+    }
+
+    m_model->add_entries(entries);
+}
+
+/**
+ * @brief Waits until the summary covers the whole view.
+ */
+auto LevelDensitySummaryTest::wait_for_rebuild() const -> bool
+{
+    return QTest::qWaitFor([this]() { return !m_summary->is_rebuilding(); }, 5000);
+}
+
+/**
+ * @brief Sums a level lane over all buckets.
+ */
+auto LevelDensitySummaryTest::total_of(LevelDensitySummary::Level level) const -> int
+{
+    int total = 0;
+
+    for (const auto& bucket: m_summary->get_buckets())
+    {
+        total += bucket.level_counts[level];
+    }
+
+    return total;
+}
+
+/**
+ * @brief Appended rows are counted per level without a rebuild.
+ */
+TEST_F(LevelDensitySummaryTest, AppendsAreCountedIncrementally)
+{
+    ASSERT_TRUE(wait_for_rebuild());
+
+    add_entries(30, "INFO", "a.log");
+    add_entries(5, "ERROR", "a.log");
+
+    EXPECT_FALSE(m_summary->is_rebuilding());
+    EXPECT_EQ(m_summary->get_row_count(), 35);
+    EXPECT_EQ(total_of(LevelDensitySummary::Info), 30);
+    EXPECT_EQ(total_of(LevelDensitySummary::Error), 5);
+    EXPECT_EQ(m_summary->get_buckets().last().level_counts[LevelDensitySummary::Error], 5);
+}
+
+/**
+ * @brief The bucket count stays bounded; buckets grow instead.
+ */
+TEST_F(LevelDensitySummaryTest, BucketCountStaysBounded)
+{
+    const int rows = LevelDensitySummary::get_max_bucket_count() * 3 + 7;
+    add_entries(rows, "DEBUG", "a.log");
+    ASSERT_TRUE(wait_for_rebuild());
+
+    EXPECT_EQ(m_summary->get_row_count(), rows);
+    EXPECT_LE(m_summary->get_buckets().size(), LevelDensitySummary::get_max_bucket_count());
+    EXPECT_GE(m_summary->get_rows_per_bucket(), 2);
+    EXPECT_EQ(total_of(LevelDensitySummary::Debug), rows);
+}
+
+/**
+ * @brief Removed rows are subtracted from their buckets.
+ */
+TEST_F(LevelDensitySummaryTest, RemovalsAreSubtracted)
+{
+    add_entries(20, "WARNING", "a.log");
+    add_entries(10, "FATAL", "b.log");
+    ASSERT_TRUE(wait_for_rebuild());
+    ASSERT_EQ(m_summary->get_row_count(), 30);
+
+    m_model->remove_entries_by_file_path("b.log");
+    ASSERT_TRUE(wait_for_rebuild());
+
+    EXPECT_EQ(m_summary->get_row_count(), 20);
+    EXPECT_EQ(total_of(LevelDensitySummary::Warning), 20);
+    EXPECT_EQ(total_of(LevelDensitySummary::Fatal), 0);
+}
+
+/**
+ * @brief Sorting rebuilds the summary in the new row order.
+ */
+TEST_F(LevelDensitySummaryTest, SortRebuildsInViewOrder)
+{
+    add_entries(10, "ERROR", "a.log");
+    add_entries(10, "INFO", "a.log");
+    ASSERT_TRUE(wait_for_rebuild());
+    EXPECT_GT(m_summary->get_buckets().first().level_counts[LevelDensitySummary::Error], 0);
+
+    m_proxy->sort(LogModel::Timestamp, Qt::DescendingOrder);
+    ASSERT_TRUE(wait_for_rebuild());
+
+    EXPECT_EQ(m_summary->get_row_count(), 20);
+    EXPECT_EQ(m_summary->get_buckets().first().level_counts[LevelDensitySummary::Error], 0);
+    EXPECT_GT(m_summary->get_buckets().first().level_counts[LevelDensitySummary::Info], 0);
+}
+
+/**
+ * @brief While a search is set, every remaining row counts as a hit; none are without one.
+ */
+TEST_F(LevelDensitySummaryTest, SearchMarksRemainingRowsAsHits)
+{
+    add_entries(8, "INFO", "a.log");
+    ASSERT_TRUE(wait_for_rebuild());
+    EXPECT_EQ(m_summary->get_hit_count(m_summary->get_buckets().first()), 0);
+
+    m_proxy->set_search_filter(QStringLiteral("Message 1"), QStringLiteral("Message"), false);
+    ASSERT_TRUE(wait_for_rebuild());
+
+    int hits = 0;
+    for (const auto& bucket: m_summary->get_buckets())
+    {
+        hits += m_summary->get_hit_count(bucket);
+    }
+
+    EXPECT_EQ(m_summary->get_row_count(), m_proxy->rowCount());
+    EXPECT_EQ(hits, m_proxy->rowCount());
+}
+
+/**
+ * @brief Changed rows keep their level, so the summary stays as it is, without a rebuild.
+ */
+TEST_F(LevelDensitySummaryTest, DataChangesKeepSummary)
+{
+    add_entries(20, "ERROR", "a.log");
+    add_entries(20, "INFO", "a.log");
+    ASSERT_TRUE(wait_for_rebuild());
+
+    emit m_proxy->dataChanged(m_proxy->index(18, 0), m_proxy->index(21, 0));
+
+    EXPECT_FALSE(m_summary->is_rebuilding());
+    EXPECT_EQ(m_summary->get_row_count(), 40);
+    EXPECT_EQ(total_of(LevelDensitySummary::Error), 20);
+    EXPECT_EQ(total_of(LevelDensitySummary::Info), 20);
+}
@@ -0,0 +1,139 @@
+#include "Qt-LogViewer/Models/LogBaselineTest.h"
+
+#include <QDateTime>
+#include <QSet>
+
+/**
+ * @brief Sets up the test fixture for each test.
+ */
+void LogBaselineTest::SetUp() {}
+
+/**
+ * @brief Tears down the test fixture after each test.
+ */
+void LogBaselineTest::TearDown() {}
+
+/**
+ * @brief Helper: builds INFO entries of "C:/logs/app.log".
+ */
+auto LogBaselineTest::make_entries(const QVector<QString>& messages) -> QVector<LogEntry>
+{
+    const LogFileInfo info("C:/logs/app.log", "App");
+    QVector<LogEntry> entries;
+
+    for (const auto& message: messages)
+    {
+        entries.append(LogEntry(QDateTime::currentDateTime(), "INFO", message, info));
+    }
+
+    return entries;
+}
+
+/**
+ * @test Numbers, ids and long hex words are masked; dotted and colon-joined numbers collapse.
+ */
+TEST_F(LogBaselineTest, NormalizeMasksVariableParts)
+{
+    EXPECT_EQ(LogBaseline::normalize_message("User 42 logged in from 10.0.0.1:8080"),
+              QByteArray("User # logged in from #"));
+    EXPECT_EQ(LogBaseline::normalize_message("request req-abc123 took 15ms"),
+              QByteArray("request req-# took #"));
+    EXPECT_EQ(LogBaseline::normalize_message("commit deadbeefcafe applied"),
+              QByteArray("commit # applied"));
+    EXPECT_EQ(LogBaseline::normalize_message("a decade of added feed"),
+              QByteArray("a decade of added feed"));
+}
+
+/**
+ * @test Messages differing only in masked parts share a fingerprint.
+ */
+TEST_F(LogBaselineTest, FingerprintIgnoresMaskedParts)
+{
+    const auto entries =
+        make_entries({"Job 17 finished in 250 ms", "Job 9 finished in 3 ms", "Job failed"});
+
+    EXPECT_EQ(LogBaseline::get_fingerprint(entries.at(0)),
+              LogBaseline::get_fingerprint(entries.at(1)));
+    EXPECT_NE(LogBaseline::get_fingerprint(entries.at(0)),
+              LogBaseline::get_fingerprint(entries.at(2)));
+}
+
+/**
+ * @test Fingerprints are 64-bit wide: the high bits, which select the probe bits, vary too.
+ */
+TEST_F(LogBaselineTest, FingerprintsUseHighBits)
+{
+    QVector<QString> messages;
+    for (int i = 0; i < 64; ++i)
+    {
+        messages.append(QString("event %1 reached").arg(QString(i + 1, QChar('x'))));
+    }
+
+    QSet<quint64> high_parts;
+    for (const auto& entry: make_entries(messages))
+    {
+        high_parts.insert(LogBaseline::get_fingerprint(entry) >> 32);
+    }
+
+    EXPECT_EQ(high_parts.size(), messages.size());
+}
+
+/**
+ * @test Added messages are never novel; an empty baseline reports every message as novel.
+ */
+TEST_F(LogBaselineTest, AddedMessagesAreNeverNovel)
+{
+    LogBaseline baseline(1000);
+    EXPECT_TRUE(baseline.is_empty());
+
+    QVector<QString> messages;
+    for (int i = 0; i < 500; ++i)
+    {
+        messages.append(QString("Step %1 of worker %2 done").arg(i).arg(i % 7) +
+                        QString(i % 50, QChar('x')));
+    }
+    const auto entries = make_entries(messages);
+    baseline.add_entries(entries);
+
+    EXPECT_FALSE(baseline.is_empty());
+    EXPECT_EQ(baseline.get_added_count(), entries.size());
+    for (const auto& entry: entries)
+    {
+        EXPECT_FALSE(baseline.is_novel(entry));
+    }
+
+    const LogBaseline empty;
+    EXPECT_TRUE(empty.is_novel(entries.first()));
+}
+
+/**
+ * @test The filter grows with the expected fingerprints and keeps a minimum size.
+ */
+TEST_F(LogBaselineTest, SizeFollowsExpectedFingerprints)
+{
+    const LogBaseline empty;
+    const LogBaseline small(100);
+    const LogBaseline large(100000);
+
+    EXPECT_GT(empty.get_size_bytes(), 0);
+    EXPECT_EQ(small.get_size_bytes(), empty.get_size_bytes());
+    EXPECT_GE(large.get_size_bytes(), 100000 * 2);
+}
+
+/**
+ * @test tag_entries() tags entries absent from the baseline; clear_tags() removes the tags.
+ */
+TEST_F(LogBaselineTest, TagEntriesMarksNovelEntries)
+{
+    LogBaseline baseline;
+    baseline.add_entries(make_entries({"Connection 7 opened"}));
+
+    auto entries = make_entries({"Connection 12 opened", "Disk quota exceeded"});
+    baseline.tag_entries(entries);
+
+    EXPECT_FALSE(entries.at(0).is_novel());
+    EXPECT_TRUE(entries.at(1).is_novel());
+
+    LogBaseline::clear_tags(entries);
+    EXPECT_FALSE(entries.at(1).is_novel());
+}
@@ -0,0 +1,65 @@
+#include "Qt-LogViewer/Models/LogDecodeCacheTest.h"
+
+#include <QString>
+
+/**
+ * @brief Sets up the test fixture for each test.
+ */
+void LogDecodeCacheTest::SetUp() {}
+
+/**
+ * @brief Tears down the test fixture after each test.
+ */
+void LogDecodeCacheTest::TearDown() {}
+
+/**
+ * @test Inserted texts are found by row id; row id 0 is never cached.
+ */
+TEST_F(LogDecodeCacheTest, InsertAndFind)
+{
+    LogDecodeCache cache;
+
+    cache.insert(7, QStringLiteral("seven"));
+    cache.insert(0, QStringLiteral("ignored"));
+
+    ASSERT_NE(cache.find(7), nullptr);
+    EXPECT_EQ(*cache.find(7), QStringLiteral("seven"));
+    EXPECT_EQ(cache.find(8), nullptr);
+    EXPECT_FALSE(cache.contains(0));
+    EXPECT_EQ(cache.get_count(), 1);
+    EXPECT_GT(cache.get_used_bytes(), 0);
+
+    cache.clear();
+    EXPECT_EQ(cache.get_count(), 0);
+    EXPECT_EQ(cache.get_used_bytes(), 0);
+}
+
+/**
+ * @test The budget bounds the cache; the least recently used texts go first.
+ */
+TEST_F(LogDecodeCacheTest, BudgetEvictsLeastRecentlyUsed)
+{
+    const QString text(100, QLatin1Char('x'));
+    LogDecodeCache cache(1000);
+
+    cache.insert(1, text);
+    cache.insert(2, text);
+    cache.insert(3, text);
+    ASSERT_EQ(cache.get_count(), 3);
+
+    // Touch 1, so 2 is the least recently used one
+    EXPECT_NE(cache.find(1), nullptr);
+    cache.insert(4, text);
+
+    EXPECT_LE(cache.get_used_bytes(), cache.get_budget_bytes());
+    EXPECT_TRUE(cache.contains(1));
+    EXPECT_FALSE(cache.contains(2));
+    EXPECT_TRUE(cache.contains(4));
+
+    // A text larger than the whole budget is not cached
+    cache.insert(5, QString(1000, QLatin1Char('y')));
+    EXPECT_FALSE(cache.contains(5));
+
+    cache.set_budget_bytes(0);
+    EXPECT_EQ(cache.get_count(), 0);
+}
@@ -0,0 +1,130 @@
+#include "Qt-LogViewer/Models/LogDedupeSetTest.h"
+
+#include <QDateTime>
+
+/**
+ * @brief Sets up the test fixture for each test.
+ */
+void LogDedupeSetTest::SetUp() {}
+
+/**
+ * @brief Tears down the test fixture after each test.
+ */
+void LogDedupeSetTest::TearDown() {}
+
+/**
+ * @brief Helper: builds entries one second apart, starting at a fixed time.
+ */
+auto LogDedupeSetTest::make_entries(const QString& file_path, const QVector<QString>& messages)
+    -> QVector<LogEntry>
+{
+    const QDateTime start = QDateTime::fromString("2025-01-01T10:00:00Z", Qt::ISODate);
+    const LogFileInfo info(file_path, "App");
+    QVector<LogEntry> entries;
+
+    for (int i = 0; i < messages.size(); ++i)
+    {
+        entries.append(LogEntry(start.addSecs(i), "INFO", messages.at(i), info));
+    }
+
+    return entries;
+}
+
+/**
+ * @test Keys depend on timestamp, level, app and message, not on the file.
+ */
+TEST_F(LogDedupeSetTest, KeysIgnoreTheFile)
+{
+    const auto a_entries = make_entries("C:/logs/a.log", {"started", "stopped"});
+    const auto b_entries = make_entries("C:/logs/b.log", {"started", "stopped"});
+
+    EXPECT_EQ(LogDedupeSet::get_key(a_entries.at(0)), LogDedupeSet::get_key(b_entries.at(0)));
+    EXPECT_NE(LogDedupeSet::get_key(a_entries.at(0)), LogDedupeSet::get_key(a_entries.at(1)));
+
+    const LogEntry later(a_entries.at(0).get_timestamp().addMSecs(1), "INFO", "started",
+                         a_entries.at(0).get_file_info());
+    EXPECT_NE(LogDedupeSet::get_key(a_entries.at(0)), LogDedupeSet::get_key(later));
+
+    EXPECT_EQ(LogDedupeSet::get_keys(a_entries).size(), a_entries.size());
+}
+
+/**
+ * @test Entries another file produced first are marked and counted for the later file; repeats
+ *       within one file are kept.
+ */
+TEST_F(LogDedupeSetTest, MarksDuplicatesAcrossFilesOnly)
+{
+    LogDedupeSet set;
+    const auto a_entries = make_entries("C:/logs/a.log", {"one", "two", "three"});
+    auto a_repeat = make_entries("C:/logs/a.log", {"one"});
+    const auto b_entries = make_entries("C:/logs/b.log", {"one", "two", "four"});
+
+    EXPECT_EQ(set.mark_duplicates(a_entries, LogDedupeSet::get_keys(a_entries)).count(true), 0);
+    EXPECT_EQ(set.mark_duplicates(a_repeat, LogDedupeSet::get_keys(a_repeat)).count(true), 0);
+
+    const QBitArray duplicates = set.mark_duplicates(b_entries, LogDedupeSet::get_keys(b_entries));
+    ASSERT_EQ(duplicates.size(), 3);
+    EXPECT_TRUE(duplicates.testBit(0));
+    EXPECT_TRUE(duplicates.testBit(1));
+    EXPECT_FALSE(duplicates.testBit(2));
+
+    EXPECT_EQ(set.get_size(), 4);
+    EXPECT_EQ(set.get_duplicate_counts().value("C:/logs/b.log"), 2);
+    EXPECT_FALSE(set.get_duplicate_counts().contains("C:/logs/a.log"));
+}
+
+/**
+ * @test Removing a file releases its keys and count and names the files that dropped entries
+ *       as its duplicates; recorded keys are not counted.
+ */
+TEST_F(LogDedupeSetTest, RemoveFileReleasesKeys)
+{
+    LogDedupeSet set;
+    const auto a_entries = make_entries("C:/logs/a.log", {"one", "two"});
+    const auto b_entries = make_entries("C:/logs/b.log", {"one", "two"});
+    const auto c_entries = make_entries("C:/logs/c.log", {"one", "two"});
+
+    set.record_keys(a_entries, LogDedupeSet::get_keys(a_entries));
+    set.record_keys(b_entries, LogDedupeSet::get_keys(b_entries));
+    EXPECT_TRUE(set.get_duplicate_counts().isEmpty());
+    EXPECT_EQ(set.mark_duplicates(b_entries, LogDedupeSet::get_keys(b_entries)).count(true), 2);
+
+    EXPECT_EQ(set.remove_file("C:/logs/a.log"), QStringList{"C:/logs/b.log"});
+    EXPECT_EQ(set.get_size(), 0);
+    EXPECT_TRUE(set.get_duplicate_counts().contains("C:/logs/b.log"));
+
+    EXPECT_TRUE(set.remove_file("C:/logs/b.log").isEmpty());
+    EXPECT_TRUE(set.get_duplicate_counts().isEmpty());
+    EXPECT_EQ(set.mark_duplicates(c_entries, LogDedupeSet::get_keys(c_entries)).count(true), 0);
+    EXPECT_EQ(set.get_size(), 2);
+}
+
+/**
+ * @test A set seeded from snapshot rows takes in a later set; the seeded owners win and the
+ *       later set's counts are kept.
+ */
+TEST_F(LogDedupeSetTest, SeededSetMergesLaterKeys)
+{
+    LogEntryStore store;
+    store.append(make_entries("C:/logs/a.log", {"one", "two"}));
+
+    LogDedupeSet seed;
+    seed.record_keys(store.snapshot(), 0, store.size());
+    EXPECT_EQ(seed.get_size(), 2);
+
+    LogDedupeSet later;
+    const auto b_entries = make_entries("C:/logs/b.log", {"one", "three"});
+    const auto c_entries = make_entries("C:/logs/c.log", {"three"});
+    EXPECT_EQ(later.mark_duplicates(b_entries, LogDedupeSet::get_keys(b_entries)).count(true), 0);
+    EXPECT_EQ(later.mark_duplicates(c_entries, LogDedupeSet::get_keys(c_entries)).count(true), 1);
+
+    seed.merge(later);
+    EXPECT_EQ(seed.get_size(), 3);
+    EXPECT_EQ(seed.get_duplicate_counts().value("C:/logs/c.log"), 1);
+
+    // "one" stays a.log's, "three" is b.log's
+    const auto b_repeat = make_entries("C:/logs/b.log", {"one", "three"});
+    const QBitArray duplicates = seed.mark_duplicates(b_repeat, LogDedupeSet::get_keys(b_repeat));
+    EXPECT_TRUE(duplicates.testBit(0));
+    EXPECT_FALSE(duplicates.testBit(1));
+}
@@ -0,0 +1,191 @@
+#include "Qt-LogViewer/Models/LogEntryStoreTest.h"
+
+#include <QBitArray>
+#include <QDateTime>
+#include <QThread>
+
+#include <atomic>
+
+#include "Qt-LogViewer/Models/LogFileInfo.h"
+
+/**
+ * @brief Creates entries whose message is their global index.
+ */
+auto LogEntryStoreTest::make_entries(int first, int count, const QString& file_path)
+    -> QVector<LogEntry>
+{
+    const QDateTime base = QDateTime::fromString("2024-01-01 10:00:00", "yyyy-MM-dd HH:mm:ss");
+    QVector<LogEntry> entries;
+    entries.reserve(count);
+
+    for (int i = first; i < first + count; ++i)
+    {
+        entries.append(LogEntry(base.addSecs(i), "INFO", QString::number(i),
+                                LogFileInfo(file_path, "App")));
+    }
+
+    return entries;
+}
+
+/**
+ * @brief Appends spanning several segments keep row order.
+ */
+TEST_F(LogEntryStoreTest, AppendAcrossSegmentsKeepsOrder)
+{
+    const int segment = LogEntryStore::get_segment_size();
+
+    m_store.append(make_entries(0, segment - 1));
+    m_store.append(make_entries(segment - 1, 2 * segment + 2));
+
+    ASSERT_EQ(m_store.size(), 3 * segment + 1);
+
+    const LogEntryStore::Snapshot snapshot = m_store.snapshot();
+    ASSERT_EQ(snapshot.size(), m_store.size());
+
+    int row = 0;
+    bool in_order = true;
+    for (const auto& entry: snapshot)
+    {
+        in_order = in_order && (entry.get_message() == QString::number(row));
+        ++row;
+    }
+
+    EXPECT_TRUE(in_order);
+    EXPECT_EQ(row, snapshot.size());
+    EXPECT_EQ(snapshot.to_vector().size(), snapshot.size());
+}
+
+/**
+ * @brief A snapshot is not affected by later appends, and keeps its epoch.
+ */
+TEST_F(LogEntryStoreTest, SnapshotIgnoresLaterAppends)
+{
+    m_store.append(make_entries(0, 10));
+    const LogEntryStore::Snapshot before = m_store.snapshot();
+
+    m_store.append(make_entries(10, LogEntryStore::get_segment_size()));
+
+    EXPECT_EQ(before.size(), 10);
+    EXPECT_EQ(before.at(9).get_message(), "9");
+    EXPECT_EQ(m_store.snapshot().get_epoch(), before.get_epoch());
+    EXPECT_EQ(m_store.snapshot().at(9).get_message(), "9");
+}
+
+/**
+ * @brief Removals publish a new epoch; older snapshots keep the removed rows.
+ */
+TEST_F(LogEntryStoreTest, RemoveStartsNewEpochAndKeepsOldSnapshot)
+{
+    m_store.append(make_entries(0, 5, "a.log"));
+    m_store.append(make_entries(5, 5, "b.log"));
+    const LogEntryStore::Snapshot before = m_store.snapshot();
+
+    const int removed = m_store.remove_if([](const LogEntry& entry) {
+        return entry.get_file_info().get_file_path() == "a.log";
+    });
+
+    const LogEntryStore::Snapshot after = m_store.snapshot();
+
+    EXPECT_EQ(removed, 5);
+    EXPECT_EQ(after.size(), 5);
+    EXPECT_EQ(after.at(0).get_message(), "5");
+    EXPECT_NE(after.get_epoch(), before.get_epoch());
+    ASSERT_EQ(before.size(), 10);
+    EXPECT_EQ(before.at(0).get_message(), "0");
+
+    EXPECT_EQ(m_store.remove_if([](const LogEntry&) { return false; }), 0);
+    EXPECT_EQ(m_store.snapshot().get_epoch(), after.get_epoch());
+
+    // Appends fill the rebuilt segment behind the kept rows.
+    m_store.append(make_entries(10, 3, "b.log"));
+    EXPECT_EQ(m_store.at(7).get_message(), "12");
+    EXPECT_EQ(after.size(), 5);
+
+    m_store.clear();
+    EXPECT_TRUE(m_store.snapshot().is_empty());
+    EXPECT_EQ(after.size(), 5);
+}
+
+/**
+ * @brief Novelty tags change in place of the epoch; older snapshots keep their tags.
+ */
+TEST_F(LogEntryStoreTest, SetNovelTagsKeepsEpochAndOldSnapshots)
+{
+    const int segment = LogEntryStore::get_segment_size();
+    m_store.append(make_entries(0, segment + 10));
+    const LogEntryStore::Snapshot before = m_store.snapshot();
+
+    QBitArray tags(segment + 10);
+    tags.setBit(3);
+    tags.setBit(segment + 2);
+
+    EXPECT_EQ(m_store.set_novel_tags(tags), 2);
+    EXPECT_TRUE(m_store.at(3).is_novel());
+    EXPECT_TRUE(m_store.at(segment + 2).is_novel());
+    EXPECT_FALSE(m_store.at(4).is_novel());
+    EXPECT_FALSE(before.at(3).is_novel());
+    EXPECT_EQ(m_store.snapshot().get_epoch(), before.get_epoch());
+    EXPECT_EQ(m_store.set_novel_tags(tags), 0);
+
+    // Appends after retagging still land behind the tagged rows.
+    m_store.append(make_entries(segment + 10, 5));
+    EXPECT_EQ(m_store.at(segment + 14).get_message(), QString::number(segment + 14));
+    EXPECT_TRUE(m_store.at(segment + 2).is_novel());
+}
+
+/**
+ * @brief A worker thread reads consistent prefixes while the owner keeps appending.
+ */
+TEST_F(LogEntryStoreTest, ConcurrentReaderSeesConsistentPrefixes)
+{
+    constexpr int k_batches = 64;
+    constexpr int k_batch_size = 300;
+    std::atomic<bool> done{false};
+    std::atomic<int> inconsistencies{0};
+    std::atomic<int> snapshots_read{0};
+
+    QThread* reader = QThread::create([&]() {
+        int last_size = 0;
+        bool finished = false;
+
+        while (!finished)
+        {
+            finished = done.load();
+            const LogEntryStore::Snapshot snapshot = m_store.snapshot();
+
+            // Row counts only grow and every visible row holds its own index.
+            if (snapshot.size() < last_size)
+            {
+                ++inconsistencies;
+            }
+            last_size = snapshot.size();
+
+            int row = 0;
+            for (const auto& entry: snapshot)
+            {
+                if (entry.get_message() != QString::number(row))
+                {
+                    ++inconsistencies;
+                }
+                ++row;
+            }
+
+            ++snapshots_read;
+        }
+    });
+
+    reader->start();
+
+    for (int batch = 0; batch < k_batches; ++batch)
+    {
+        m_store.append(make_entries(batch * k_batch_size, k_batch_size));
+    }
+
+    done.store(true);
+    reader->wait();
+    delete reader;
+
+    EXPECT_EQ(inconsistencies.load(), 0);
+    EXPECT_GT(snapshots_read.load(), 0);
+    EXPECT_EQ(m_store.size(), k_batches * k_batch_size);
+}
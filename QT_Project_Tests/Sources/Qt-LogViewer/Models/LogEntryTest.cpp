@@ -136,3 +136,18 @@ TEST_F(LogEntryTest, CopyConstructorAndAssignment)
     EXPECT_EQ(entry3.get_app_name(), app_name);
     EXPECT_EQ(entry3.get_file_info().get_file_path(), "dummy.log");
 }
+
+/**
+ * @brief Tests that the message is stored as UTF-8 and decoded on access.
+ */
+TEST_F(LogEntryTest, MessageIsStoredAsUtf8)
+{
+    const QString message = QString::fromUtf8("Größe überschritten: 5 €");
+    LogEntry entry(QDateTime::currentDateTime(), "WARNING", message);
+
+    EXPECT_EQ(entry.get_message_utf8(), message.toUtf8());
+    EXPECT_EQ(entry.get_message(), message);
+
+    entry.set_message_utf8(QByteArray("plain ascii"));
+    EXPECT_EQ(entry.get_message(), "plain ascii");
+}
@@ -0,0 +1,82 @@
+#include "Qt-LogViewer/Models/LogFacetCountsTest.h"
+
+#include <QDateTime>
+#include <QString>
+
+namespace
+{
+/**
+ * @brief Creates an entry of the given level, file and app.
+ */
+auto make_entry(const QString& level, const QString& file_path, const QString& app_name)
+    -> LogEntry
+{
+    return LogEntry(QDateTime::currentDateTime(), level, QStringLiteral("message"),
+                    LogFileInfo(file_path, app_name));
+}
+}  // namespace
+
+/**
+ * @brief Sets up the test fixture for each test.
+ */
+void LogFacetCountsTest::SetUp() {}
+
+/**
+ * @brief Tears down the test fixture after each test.
+ */
+void LogFacetCountsTest::TearDown() {}
+
+/**
+ * @test Entries are counted per level, app and file.
+ */
+TEST_F(LogFacetCountsTest, CountsPerFacet)
+{
+    LogFacetCounts counts;
+    counts.add_entry(make_entry("INFO", "a.log", "AppA"));
+    counts.add_entry(make_entry("INFO", "b.log", "AppB"));
+    counts.add_entry(make_entry("ERROR", "a.log", "AppA"));
+
+    EXPECT_EQ(counts.get_total(), 3);
+    EXPECT_EQ(counts.get_level_counts().value("INFO"), 2);
+    EXPECT_EQ(counts.get_level_counts().value("ERROR"), 1);
+    EXPECT_EQ(counts.get_app_counts().value("AppA"), 2);
+    EXPECT_EQ(counts.get_app_counts().value("AppB"), 1);
+    EXPECT_EQ(counts.get_file_counts().size(), 2);
+}
+
+/**
+ * @test Removing entries drops keys that reach zero.
+ */
+TEST_F(LogFacetCountsTest, RemovingDropsEmptyKeys)
+{
+    const LogEntry entry = make_entry("WARNING", "a.log", "AppA");
+    LogFacetCounts counts;
+    counts.add_entry(entry);
+    counts.add_entry(entry, -1);
+
+    EXPECT_EQ(counts.get_total(), 0);
+    EXPECT_TRUE(counts.get_level_counts().isEmpty());
+    EXPECT_TRUE(counts.get_app_counts().isEmpty());
+    EXPECT_TRUE(counts.get_file_counts().isEmpty());
+}
+
+/**
+ * @test Merging adds the counts of both instances; clear resets them.
+ */
+TEST_F(LogFacetCountsTest, MergeAndClear)
+{
+    LogFacetCounts first;
+    first.add_entry(make_entry("INFO", "a.log", "AppA"));
+    LogFacetCounts second;
+    second.add_entry(make_entry("INFO", "b.log", "AppA"));
+    second.add_entry(make_entry("DEBUG", "b.log", "AppB"));
+
+    first.merge(second);
+    EXPECT_EQ(first.get_total(), 3);
+    EXPECT_EQ(first.get_level_counts().value("INFO"), 2);
+    EXPECT_EQ(first.get_app_counts().value("AppA"), 2);
+
+    first.clear();
+    EXPECT_EQ(first.get_total(), 0);
+    EXPECT_TRUE(first.get_level_counts().isEmpty());
+}
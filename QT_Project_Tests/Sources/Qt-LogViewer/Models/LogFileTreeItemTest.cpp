@@ -188,3 +188,30 @@ TEST_F(LogFileTreeItemTest, RowWithParentNoChildren)
 
     delete child_item;
 }
+
+/**
+ * @brief Tests that taking a range of children renumbers the following siblings.
+ */
+TEST_F(LogFileTreeItemTest, TakeChildrenRenumbersSiblings)
+{
+    LogFileTreeItem parent(QVector<QVariant>{"Parent"});
+    for (int i = 0; i < 5; ++i)
+    {
+        parent.append_child(new LogFileTreeItem(QVector<QVariant>{i}, &parent));
+    }
+
+    const QVector<LogFileTreeItem*> taken = parent.take_children(1, 2);
+    ASSERT_EQ(taken.size(), 2);
+    EXPECT_EQ(taken.at(0)->data(0).toInt(), 1);
+    EXPECT_EQ(taken.at(1)->data(0).toInt(), 2);
+    qDeleteAll(taken);
+
+    ASSERT_EQ(parent.child_count(), 3);
+    EXPECT_EQ(parent.child(1)->data(0).toInt(), 3);
+    EXPECT_EQ(parent.child(1)->row(), 1);
+    EXPECT_EQ(parent.child(2)->row(), 2);
+
+    // Out of range requests take nothing
+    EXPECT_TRUE(parent.take_children(2, 5).isEmpty());
+    EXPECT_EQ(parent.child_count(), 3);
+}
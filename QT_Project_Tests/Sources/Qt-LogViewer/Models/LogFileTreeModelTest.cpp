@@ -1,6 +1,10 @@
 #include "Qt-LogViewer/Models/LogFileTreeModelTest.h"
 
+#include <QDateTime>
+#include <QDir>
 #include <QIcon>
+#include <QSignalSpy>
+#include <QTest>
 
 #include "Qt-LogViewer/Models/LogFileInfo.h"
 #include "Qt-LogViewer/Models/LogFileTreeItem.h"
@@ -525,3 +529,177 @@ TEST_F(LogFileTreeModelTest, GetSessionIndexInvalidForUnknownId)
     const QModelIndex missing = m_model->get_session_index("missing");
     EXPECT_FALSE(missing.isValid());
 }
+
+/**
+ * @brief Tests that a batch add emits one row insertion per group (plus one per new group).
+ */
+TEST_F(LogFileTreeModelTest, BulkAddEmitsOneInsertPerGroup)
+{
+    EXPECT_TRUE(m_model->add_session("S", "S"));
+    QSignalSpy spy(m_model, &QAbstractItemModel::rowsInserted);
+
+    QList<LogFileInfo> files;
+    for (int i = 0; i < 100; ++i)
+    {
+        files.append(LogFileInfo(QString("C:/logs/a_%1.txt").arg(i), "A"));
+        files.append(LogFileInfo(QString("C:/logs/b_%1.txt").arg(i), "B"));
+    }
+
+    EXPECT_EQ(m_model->add_log_files("S", files), 200);
+    // Group A and group B are created, then each receives one contiguous insertion.
+    ASSERT_EQ(spy.count(), 4);
+    EXPECT_EQ(spy.at(1).at(1).toInt(), 0);
+    EXPECT_EQ(spy.at(1).at(2).toInt(), 99);
+
+    // Adding the same batch again (with an in-batch duplicate) inserts nothing.
+    spy.clear();
+    files.append(files.first());
+    EXPECT_EQ(m_model->add_log_files("S", files), 0);
+    EXPECT_EQ(spy.count(), 0);
+}
+
+/**
+ * @brief Tests that cached rows, parents and the file index stay consistent after removals.
+ */
+TEST_F(LogFileTreeModelTest, RemovalKeepsRowsAndIndexConsistent)
+{
+    QList<LogFileInfo> files;
+    for (int i = 0; i < 6; ++i)
+    {
+        files.append(LogFileInfo(QString("C:/logs/f_%1.txt").arg(i), "App"));
+    }
+    m_model->set_log_files("S", files);
+
+    EXPECT_TRUE(m_model->remove_log_file("S", files.at(1)));
+    EXPECT_TRUE(m_model->remove_log_file("S", files.at(4)));
+
+    const QModelIndex s_index = m_model->get_session_index("S");
+    const QModelIndex group = m_model->index(0, 0, s_index);
+    ASSERT_EQ(m_model->rowCount(group), 4);
+
+    const QStringList expected{files.at(0).get_file_path(), files.at(2).get_file_path(),
+                               files.at(3).get_file_path(), files.at(5).get_file_path()};
+    for (int row = 0; row < expected.size(); ++row)
+    {
+        const QModelIndex file_index = m_model->index(row, 0, group);
+        EXPECT_EQ(file_index.data(LogFileTreeModel::FilePathRole).toString(), expected.at(row));
+        EXPECT_EQ(m_model->parent(file_index), group);
+        EXPECT_EQ(static_cast<LogFileTreeItem*>(file_index.internalPointer())->row(), row);
+    }
+
+    // A removed file can be added again; a removed group is dropped and recreated.
+    EXPECT_TRUE(m_model->add_log_file("S", files.at(1)));
+    for (const auto& file: files)
+    {
+        m_model->remove_log_file("S", file);
+    }
+    EXPECT_EQ(m_model->rowCount(s_index), 0);
+    EXPECT_TRUE(m_model->add_log_file("S", files.at(0)));
+    EXPECT_EQ(m_model->rowCount(s_index), 1);
+}
+
+/**
+ * @brief Tests that provisional files are regrouped in a batch and unknown paths are ignored.
+ */
+TEST_F(LogFileTreeModelTest, ResolveProvisionalFilesInBatch)
+{
+    EXPECT_TRUE(m_model->add_session("S", "S"));
+    const QVector<QString> paths{"C:/logs/a.txt", "C:/logs/b.txt", "C:/logs/c.txt"};
+    EXPECT_EQ(m_model->add_provisional_log_files("S", paths), 3);
+    EXPECT_EQ(m_model->add_provisional_log_files("S", paths), 0);
+
+    const int resolved = m_model->resolve_provisional_log_files(
+        {LogFileInfo("C:/logs/a.txt", "A"), LogFileInfo("C:/logs/c.txt", "A"),
+         LogFileInfo("C:/logs/missing.txt", "B")});
+    EXPECT_EQ(resolved, 2);
+
+    const QModelIndex s_index = m_model->get_session_index("S");
+    ASSERT_EQ(m_model->rowCount(s_index), 2);
+    const QModelIndex provisional = m_model->index(0, 0, s_index);
+    const QModelIndex group_a = m_model->index(1, 0, s_index);
+    EXPECT_EQ(provisional.data().toString(), LogFileTreeModel::get_provisional_group_name());
+    EXPECT_EQ(m_model->rowCount(provisional), 1);
+    EXPECT_EQ(group_a.data().toString(), "A");
+    EXPECT_EQ(m_model->rowCount(group_a), 2);
+
+    // Removing the last provisional file drops the provisional group.
+    EXPECT_TRUE(m_model->remove_log_file("S", LogFileInfo("C:/logs/b.txt")));
+    ASSERT_EQ(m_model->rowCount(s_index), 1);
+    EXPECT_EQ(m_model->index(0, 0, s_index).data().toString(), "A");
+}
+
+/**
+ * @brief Tests that a watch folder is fetched lazily and later listings are applied as a diff.
+ */
+TEST_F(LogFileTreeModelTest, WatchFolderFetchesLazilyAndAppliesDiffs)
+{
+    const QString folder = QDir::cleanPath(QDir::tempPath() + "/watched");
+    EXPECT_TRUE(m_model->add_watch_folder("S", folder));
+    EXPECT_FALSE(m_model->add_watch_folder("S", folder));
+    EXPECT_EQ(m_model->get_watch_folders("S"), QVector<QString>{folder});
+
+    const QModelIndex s_index = m_model->get_session_index("S");
+    const QModelIndex folder_index = m_model->index(0, 0, s_index);
+    EXPECT_EQ(folder_index.data(LogFileTreeModel::FolderPathRole).toString(), folder);
+    EXPECT_EQ(m_model->rowCount(folder_index), 0);
+    EXPECT_TRUE(m_model->hasChildren(folder_index));
+    ASSERT_TRUE(m_model->canFetchMore(folder_index));
+
+    QSignalSpy fetch_spy(m_model, &LogFileTreeModel::folder_fetch_requested);
+    m_model->fetchMore(folder_index);
+    ASSERT_EQ(fetch_spy.count(), 1);
+    EXPECT_EQ(fetch_spy.at(0).at(0).toString(), folder);
+    EXPECT_FALSE(m_model->canFetchMore(folder_index));
+
+    m_model->apply_folder_listing(folder, {folder + "/sub"}, {folder + "/a.log", folder + "/b.log"});
+    ASSERT_EQ(m_model->rowCount(folder_index), 3);
+    const QModelIndex sub_index = m_model->index(0, 0, folder_index);
+    EXPECT_EQ(sub_index.data().toString(), "sub");
+    EXPECT_TRUE(m_model->has_folder(folder + "/sub"));
+    EXPECT_TRUE(m_model->canFetchMore(sub_index));
+    EXPECT_EQ(m_model->index(1, 0, folder_index).data(LogFileTreeModel::SessionIdRole).toString(),
+              "S");
+
+    // Diff: the sub folder and a.log disappeared, c.log appeared
+    QSignalSpy removed_spy(m_model, &QAbstractItemModel::rowsRemoved);
+    m_model->apply_folder_listing(folder, {}, {folder + "/b.log", folder + "/c.log"});
+    EXPECT_EQ(removed_spy.count(), 1);  // rows 0 and 1 form one run
+    ASSERT_EQ(m_model->rowCount(folder_index), 2);
+    EXPECT_EQ(m_model->index(0, 0, folder_index).data().toString(), "b.log");
+    EXPECT_EQ(m_model->index(1, 0, folder_index).data().toString(), "c.log");
+    EXPECT_FALSE(m_model->has_folder(folder + "/sub"));
+
+    // Watch folders are not part of the session's grouped files
+    EXPECT_TRUE(m_model->remove_watch_folder("S", folder));
+    EXPECT_FALSE(m_model->has_folder(folder));
+    EXPECT_EQ(m_model->rowCount(s_index), 0);
+}
+
+/**
+ * @brief Tests that folder files request their metadata once, when first displayed.
+ */
+TEST_F(LogFileTreeModelTest, FolderFileMetadataRequestedWhenDisplayed)
+{
+    const QString folder = QDir::cleanPath(QDir::tempPath() + "/watched");
+    const QString file = folder + "/a.log";
+    m_model->add_watch_folder("S", folder);
+    m_model->apply_folder_listing(folder, {}, {file});
+
+    const QModelIndex folder_index = m_model->index(0, 0, m_model->get_session_index("S"));
+    const QModelIndex file_index = m_model->index(0, 0, folder_index);
+    QSignalSpy request_spy(m_model, &LogFileTreeModel::file_metadata_requested);
+
+    EXPECT_EQ(file_index.data().toString(), "a.log");
+    EXPECT_EQ(file_index.data().toString(), "a.log");
+    ASSERT_TRUE(request_spy.wait(1000));
+    ASSERT_EQ(request_spy.count(), 1);
+    EXPECT_EQ(request_spy.at(0).at(0).value<QVector<QString>>(), QVector<QString>{file});
+
+    m_model->set_file_metadata(file, 2048, QDateTime::currentDateTime());
+    m_model->set_file_app_names({LogFileInfo(file, "Billing")});
+    EXPECT_EQ(file_index.data(LogFileTreeModel::AppNameRole).toString(), "Billing");
+    EXPECT_TRUE(file_index.data(Qt::ToolTipRole).toString().contains("Billing"));
+
+    QTest::qWait(10);
+    EXPECT_EQ(request_spy.count(), 1);
+}
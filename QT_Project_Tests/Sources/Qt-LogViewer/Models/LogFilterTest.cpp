@@ -0,0 +1,220 @@
+#include "Qt-LogViewer/Models/LogFilterTest.h"
+
+#include <QDateTime>
+#include <QSet>
+#include <QString>
+#include <QVariant>
+#include <QVector>
+#include <memory>
+
+#include "Qt-LogViewer/Models/LogBaseline.h"
+
+namespace
+{
+/**
+ * @brief Creates an entry with optional thread and pid fields.
+ */
+auto make_entry(const QString& level, const QString& message, const QString& file_path,
+                const QString& app_name, const QVariant& thread, const QVariant& pid) -> LogEntry
+{
+    LogEntry entry(QDateTime::currentDateTime(), level, message,
+                   LogFileInfo(file_path, app_name));
+
+    if (thread.isValid())
+    {
+        entry.set_extra_field("thread", thread);
+    }
+    if (pid.isValid())
+    {
+        entry.set_extra_field("pid", pid);
+    }
+
+    return entry;
+}
+}  // namespace
+
+/**
+ * @brief Sets up a model with mixed levels, files, apps and extra fields.
+ */
+void LogFilterTest::SetUp()
+{
+    m_model = new LogModel();
+    m_proxy = new LogSortFilterProxyModel();
+    m_proxy->setSourceModel(m_model);
+
+    m_model->add_entries(
+        {make_entry("INFO", "Startup complete", "fileA.log", "AppA", "main", qlonglong(42)),
+         make_entry("ERROR", "Crash in worker 142", "fileA.log", "AppA", "worker", qlonglong(142)),
+         make_entry("debug", QString::fromUtf8("Größe 4 überschritten"), "fileB.log", "AppB",
+                    QVariant(), qlonglong(4)),
+         make_entry("Warning", "Disk almost full", "fileB.log", "AppB", "io", QVariant()),
+         make_entry("INFO", "User login", "fileC.log", "AppC", QVariant(), QVariant())});
+}
+
+/**
+ * @brief Tears down the test fixture after each test.
+ */
+void LogFilterTest::TearDown()
+{
+    delete m_proxy;
+    delete m_model;
+    m_proxy = nullptr;
+    m_model = nullptr;
+}
+
+/**
+ * @brief Checks every row: decided model-free verdicts must match the proxy.
+ */
+auto LogFilterTest::expect_agreement_with_proxy() const -> void
+{
+    const LogFilter filter(m_proxy->get_filter_spec());
+
+    for (int row = 0; row < m_model->rowCount(); ++row)
+    {
+        const LogFilter::Verdict verdict = filter.evaluate(m_model->get_entry(row));
+        const bool shown = m_proxy->mapFromSource(m_model->index(row, 0)).isValid();
+
+        if (verdict != LogFilter::Verdict::Undecided)
+        {
+            EXPECT_EQ(verdict == LogFilter::Verdict::Accepted, shown) << "row " << row;
+        }
+        EXPECT_EQ(filter.evaluate(m_model->get_entry(row), m_model) ==
+                      LogFilter::Verdict::Accepted,
+                  shown)
+            << "row " << row;
+    }
+}
+
+/**
+ * @test Model-free verdicts agree with the proxy for app, level, file and search filters.
+ */
+TEST_F(LogFilterTest, VerdictsAgreeWithProxy)
+{
+    expect_agreement_with_proxy();
+
+    m_proxy->set_app_name_filter("AppA");
+    expect_agreement_with_proxy();
+    m_proxy->set_app_name_filter(QString());
+
+    m_proxy->set_log_level_filters({"Info", " DEBUG "});
+    expect_agreement_with_proxy();
+    m_proxy->set_log_level_filters({});
+
+    m_proxy->hide_file("fileB.log");
+    expect_agreement_with_proxy();
+    m_proxy->clear_hidden_files();
+
+    m_proxy->set_show_only_file_path("fileC.log");
+    expect_agreement_with_proxy();
+    m_proxy->set_show_only_file_path(QString());
+
+    const QVector<QPair<QString, QString>> searches{
+        {"start", "Message"}, {"info", "Level"},     {"appb", "AppName"},
+        {"ber", "All Fields"}, {"worker", "thread"}, {"42", "pid"},
+        {"4", "All Fields"},  {"login", "thread"},   {"4", "pid"}};
+
+    for (const auto& search: searches)
+    {
+        m_proxy->set_search_filter(search.first, search.second, false);
+        expect_agreement_with_proxy();
+        m_proxy->set_search_filter(search.first, search.second, true);
+        expect_agreement_with_proxy();
+    }
+
+    m_proxy->set_search_filter("(", "Message", true);
+    expect_agreement_with_proxy();
+}
+
+/**
+ * @test Decisions depending on the model's column typing are undecided without a model.
+ */
+TEST_F(LogFilterTest, ColumnTypingDependentSearchIsUndecided)
+{
+    const LogEntry entry =
+        make_entry("INFO", "Startup complete", "fileA.log", "AppA", QVariant(), qlonglong(142));
+
+    LogFilter::Spec spec;
+    spec.search_field = "pid";
+
+    // "142" is equal and contained either way; "4" is contained but only equal as text.
+    spec.search_text = "142";
+    EXPECT_EQ(LogFilter(spec).evaluate(entry), LogFilter::Verdict::Accepted);
+    spec.search_text = "4";
+    EXPECT_EQ(LogFilter(spec).evaluate(entry), LogFilter::Verdict::Undecided);
+    spec.search_text = "7";
+    EXPECT_EQ(LogFilter(spec).evaluate(entry), LogFilter::Verdict::Rejected);
+
+    // A field the entry lacks: a column elsewhere (no match) or not (main field search).
+    spec.search_field = "thread";
+    spec.search_text = "startup";
+    EXPECT_EQ(LogFilter(spec).evaluate(entry), LogFilter::Verdict::Undecided);
+    spec.search_text = "shutdown";
+    EXPECT_EQ(LogFilter(spec).evaluate(entry), LogFilter::Verdict::Rejected);
+}
+
+/**
+ * @test Batches carry one accepted and one undecided bit per entry, their spec and the facet
+ *       counts of all and of the accepted entries.
+ */
+TEST_F(LogFilterTest, EvaluateBatchSetsBitsPerEntry)
+{
+    const QVector<LogEntry> batch = m_model->get_entries();
+
+    LogFilter::Spec spec;
+    const LogFilter::BatchVerdicts unfiltered = LogFilter(spec).evaluate_batch(batch);
+    ASSERT_EQ(unfiltered.accepted.size(), batch.size());
+    EXPECT_EQ(unfiltered.accepted.count(true), batch.size());
+    EXPECT_EQ(unfiltered.accepted_counts.get_total(), batch.size());
+
+    spec.levels = {"info"};
+    const LogFilter::BatchVerdicts verdicts = LogFilter(spec).evaluate_batch(batch);
+    ASSERT_EQ(verdicts.accepted.size(), batch.size());
+    EXPECT_EQ(verdicts.accepted.count(true), 2);
+    EXPECT_EQ(verdicts.undecided.count(true), 0);
+    EXPECT_EQ(verdicts.spec, spec);
+
+    EXPECT_EQ(verdicts.counts.get_total(), batch.size());
+    EXPECT_EQ(verdicts.counts.get_app_counts().value("AppB"), 2);
+    EXPECT_EQ(verdicts.accepted_counts.get_total(), 2);
+    EXPECT_EQ(verdicts.accepted_counts.get_level_counts().value("INFO"), 2);
+    EXPECT_EQ(verdicts.accepted_counts.get_app_counts().value("AppA"), 1);
+    EXPECT_EQ(verdicts.accepted_counts.get_app_counts().value("AppC"), 1);
+}
+
+/**
+ * @test Search settings without search text do not distinguish specs.
+ */
+TEST_F(LogFilterTest, EmptySearchIsNormalized)
+{
+    LogFilter::Spec spec;
+    spec.search_field = "Message";
+    spec.use_regex = true;
+
+    EXPECT_EQ(LogFilter(spec).get_spec(), LogFilter::Spec());
+    EXPECT_FALSE(LogFilter(spec).is_active());
+}
+
+/**
+ * @test The novelty setting accepts only entries tagged as novel and is ignored without a
+ *       baseline.
+ */
+TEST_F(LogFilterTest, NovelOnlyAcceptsTaggedEntries)
+{
+    QVector<LogEntry> batch = m_model->get_entries();
+    auto baseline = std::make_shared<LogBaseline>();
+    baseline->add_entries(batch.mid(0, 2));
+    baseline->tag_entries(batch);
+
+    LogFilter::Spec spec;
+    spec.novel_only = true;
+    EXPECT_FALSE(LogFilter(spec).is_active());
+    EXPECT_FALSE(LogFilter(spec).get_spec().novel_only);
+
+    spec.baseline = baseline;
+    const LogFilter filter(spec);
+    EXPECT_TRUE(filter.is_active());
+    EXPECT_EQ(filter.evaluate(batch.at(0)), LogFilter::Verdict::Rejected);
+    EXPECT_EQ(filter.evaluate(batch.at(1)), LogFilter::Verdict::Rejected);
+    EXPECT_EQ(filter.evaluate(batch.at(3)), LogFilter::Verdict::Accepted);
+    EXPECT_EQ(filter.evaluate_batch(batch).accepted.count(true), batch.size() - 2);
+}
@@ -0,0 +1,55 @@
+#include "Qt-LogViewer/Models/LogLevelClassifierTest.h"
+
+#include <QStringList>
+
+/**
+ * @brief Sets up the test fixture for each test.
+ */
+void LogLevelClassifierTest::SetUp() {}
+
+/**
+ * @brief Tears down the test fixture after each test.
+ */
+void LogLevelClassifierTest::TearDown() {}
+
+/**
+ * @test Common level words are recognized regardless of case and surrounding spaces.
+ */
+TEST_F(LogLevelClassifierTest, ClassifiesCommonTokens)
+{
+    using SimpleCppLogger::LogLevel;
+
+    EXPECT_EQ(LogLevelClassifier::classify(u"TRACE"), LogLevel::Trace);
+    EXPECT_EQ(LogLevelClassifier::classify(u"debug"), LogLevel::Debug);
+    EXPECT_EQ(LogLevelClassifier::classify(u" Info "), LogLevel::Info);
+    EXPECT_EQ(LogLevelClassifier::classify(u"WARN"), LogLevel::Warning);
+    EXPECT_EQ(LogLevelClassifier::classify(u"Warning"), LogLevel::Warning);
+    EXPECT_EQ(LogLevelClassifier::classify(u"ERR"), LogLevel::Error);
+    EXPECT_EQ(LogLevelClassifier::classify(u"error"), LogLevel::Error);
+    EXPECT_EQ(LogLevelClassifier::classify(u"CRITICAL"), LogLevel::Error);
+    EXPECT_EQ(LogLevelClassifier::classify(u"Fatal"), LogLevel::Fatal);
+    EXPECT_EQ(LogLevelClassifier::classify(u""), LogLevel::Info);
+}
+
+/**
+ * @test The fast path agrees with the substring rules, also for near misses and long tokens.
+ */
+TEST_F(LogLevelClassifierTest, MatchesSubstringRules)
+{
+    const QStringList tokens = {
+        "trace",      "TRACE",       "debug",   "DeBuG",      "info",    "INFO",
+        "warn",       "warning",     "WARNING", "err",        "error",   "ERROR",
+        "critical",   "Critical",    "fatal",   "FATAL",      "notice",  "crit",
+        "dbg",        "inf",         "errors",  "trace_info", "E_ERROR", "[WARN]",
+        "superfatal", "information", "warn ",   "  error",    "ERR!",    "fatal_err",
+        "W",          "E",           "Ünfo",    "info ",      "12345",   "@rror",
+        "WARN\t",     "debug-x",     "Tr4ce",   "criticality", "",       " ",
+    };
+
+    for (const auto& token: tokens)
+    {
+        EXPECT_EQ(LogLevelClassifier::classify(token),
+                  LogLevelClassifier::classify_by_substring(token))
+            << token.toStdString();
+    }
+}
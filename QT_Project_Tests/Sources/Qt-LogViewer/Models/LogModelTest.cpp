@@ -162,3 +162,106 @@ TEST_F(LogModelTest, RoleNamesReturnsCorrectMapping)
     EXPECT_EQ(roles.value(LogModel::MessageRole), "message");
     EXPECT_EQ(roles.value(LogModel::AppNameRole), "app_name");
 }
+
+/**
+ * @brief Tests that extra fields register typed columns between AppName and the spacer.
+ */
+TEST_F(LogModelTest, ExtraFieldsRegisterColumns)
+{
+    LogEntry first(QDateTime::currentDateTime(), "INFO", "A", LogFileInfo("dummy.log", "App"));
+    first.set_extra_field("thread_id", QVariant::fromValue(qlonglong(7)));
+    first.set_extra_field("logger", QStringLiteral("net"));
+    m_model.add_entry(first);
+
+    ASSERT_EQ(m_model.columnCount(), LogModel::ColumnCount + 2);
+    EXPECT_EQ(m_model.get_spacer_column(), LogModel::Spacer + 2);
+
+    const int thread_column = m_model.find_extra_column("thread_id");
+    const int logger_column = m_model.find_extra_column("LOGGER");
+    EXPECT_EQ(thread_column, LogModel::AppName + 1);
+    EXPECT_EQ(logger_column, LogModel::AppName + 2);
+    EXPECT_EQ(m_model.find_extra_column("pid"), -1);
+
+    EXPECT_EQ(m_model.headerData(thread_column, Qt::Horizontal, Qt::DisplayRole).toString(),
+              "Thread Id");
+    EXPECT_TRUE(m_model.is_extra_column_numeric(thread_column));
+    EXPECT_FALSE(m_model.is_extra_column_numeric(logger_column));
+    EXPECT_EQ(m_model.data(m_model.index(0, thread_column)).toLongLong(), 7);
+    EXPECT_EQ(m_model.data(m_model.index(0, logger_column)).toString(), "net");
+
+    // A text value demotes the numeric column to text
+    LogEntry second(QDateTime::currentDateTime(), "INFO", "B", LogFileInfo("dummy.log", "App"));
+    second.set_extra_field("thread_id", QStringLiteral("main"));
+    m_model.add_entry(second);
+
+    EXPECT_EQ(m_model.columnCount(), LogModel::ColumnCount + 2);
+    EXPECT_FALSE(m_model.is_extra_column_numeric(thread_column));
+    EXPECT_EQ(m_model.data(m_model.index(0, thread_column)).typeId(), QMetaType::QString);
+
+    m_model.clear();
+    EXPECT_EQ(m_model.columnCount(), LogModel::ColumnCount);
+}
+
+/**
+ * @brief Tests that row ids are stable across appends and file removal and map back to rows.
+ */
+TEST_F(LogModelTest, RowIdsSurviveAppendsAndFileRemoval)
+{
+    const QVector<QPair<QString, qint64>> lines = {
+        {"a.log", 0}, {"b.log", 0}, {"a.log", 40}, {"b.log", 25}, {"a.log", 90}};
+
+    for (const auto& line: lines)
+    {
+        LogEntry entry(QDateTime::currentDateTime(), "INFO", "M", LogFileInfo(line.first, "App"));
+        entry.set_line_offset(line.second);
+        m_model.add_entry(entry);
+    }
+
+    QSet<quint64> ids;
+
+    for (int row = 0; row < m_model.rowCount(); ++row)
+    {
+        const quint64 row_id = m_model.get_row_id(row);
+        EXPECT_NE(row_id, 0U);
+        EXPECT_EQ(m_model.find_row(row_id), row);
+        EXPECT_EQ(m_model.data(m_model.index(row, LogModel::Message), LogModel::RowIdRole)
+                      .toULongLong(),
+                  row_id);
+        ids.insert(row_id);
+    }
+
+    EXPECT_EQ(ids.size(), lines.size());
+    EXPECT_EQ(m_model.get_row_id(m_model.rowCount()), 0U);
+    EXPECT_EQ(m_model.find_row(0), -1);
+
+    const quint64 first_a = m_model.get_row_id(0);
+    const quint64 last_b = m_model.get_row_id(3);
+    m_model.remove_entries_by_file_path("a.log");
+
+    ASSERT_EQ(m_model.rowCount(), 2);
+    EXPECT_EQ(m_model.get_row_id(1), last_b);
+    EXPECT_EQ(m_model.find_row(last_b), 1);
+    EXPECT_EQ(m_model.find_row(first_a), -1);
+}
+
+/**
+ * @brief Tests that prefetched messages are served by data() and dropped with their file.
+ */
+TEST_F(LogModelTest, DecodedMessagesAreServedUntilFileRemoval)
+{
+    LogEntry entry(QDateTime::currentDateTime(), "INFO", "raw", LogFileInfo("a.log", "App"));
+    entry.set_line_offset(0);
+    m_model.add_entry(entry);
+
+    const quint64 row_id = m_model.get_row_id(0);
+    m_model.add_decoded_messages({row_id}, {QStringLiteral("decoded")});
+
+    EXPECT_TRUE(m_model.is_message_decoded(row_id));
+    EXPECT_EQ(m_model.data(m_model.index(0, LogModel::Message)).toString(), "decoded");
+
+    m_model.remove_entries_by_file_path("a.log");
+    m_model.add_entry(entry);
+
+    EXPECT_FALSE(m_model.is_message_decoded(row_id));
+    EXPECT_EQ(m_model.data(m_model.index(0, LogModel::Message)).toString(), "raw");
+}
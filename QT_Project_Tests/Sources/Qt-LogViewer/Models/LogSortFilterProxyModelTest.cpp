@@ -1,10 +1,17 @@
 #include "Qt-LogViewer/Models/LogSortFilterProxyModelTest.h"
 
+#include <QBitArray>
 #include <QDateTime>
 #include <QSet>
 #include <QSignalSpy>
 #include <QString>
+#include <QStringList>
+#include <QTest>
 #include <QVector>
+#include <memory>
+
+#include "Qt-LogViewer/Models/LogBaseline.h"
+#include "Qt-LogViewer/Services/TaskRegistry.h"
 
 /**
  * @brief Sets up the test fixture for each test.
@@ -367,8 +374,8 @@ TEST_F(LogSortFilterProxyModelTest, ShowOnlyAndHiddenInteraction)
 }
 
 /**
- * @brief Sorting: timestamp column uses QDateTime ordering; other columns use case-insensitive
- * collator.
+ * @brief Sorting: timestamp column uses QDateTime ordering; the message column compares the
+ * stored UTF-8 case-insensitively.
  */
 TEST_F(LogSortFilterProxyModelTest, SortingByTimestampAndStringCollation)
 {
@@ -387,7 +394,7 @@ TEST_F(LogSortFilterProxyModelTest, SortingByTimestampAndStringCollation)
     EXPECT_TRUE(ordered[1] <= ordered[2]);
     EXPECT_TRUE(ordered[2] <= ordered[3]);
 
-    // Sort by Message ascending (case-insensitive via collator)
+    // Sort by Message ascending (case-insensitive, by code point)
     m_proxy->sort(LogModel::Message, Qt::AscendingOrder);
     QVector<QString> msgs;
     for (int r = 0; r < m_proxy->rowCount(); ++r)
@@ -398,9 +405,85 @@ TEST_F(LogSortFilterProxyModelTest, SortingByTimestampAndStringCollation)
         msgs.append(msg);
     }
     // Expect alphabetical order ignoring case
-    EXPECT_LE(m_proxy->get_collator().compare(msgs[0], msgs[1]), 0);
-    EXPECT_LE(m_proxy->get_collator().compare(msgs[1], msgs[2]), 0);
-    EXPECT_LE(m_proxy->get_collator().compare(msgs[2], msgs[3]), 0);
+    EXPECT_LE(QString::compare(msgs[0], msgs[1], Qt::CaseInsensitive), 0);
+    EXPECT_LE(QString::compare(msgs[1], msgs[2], Qt::CaseInsensitive), 0);
+    EXPECT_LE(QString::compare(msgs[2], msgs[3], Qt::CaseInsensitive), 0);
+
+    // Non-ASCII messages fold case without being decoded.
+    m_model->add_entry(LogEntry(QDateTime::currentDateTime(), "INFO",
+                                QString::fromUtf8("Übertragung"),
+                                LogFileInfo("fileA.log", "AppA")));
+    m_model->add_entry(LogEntry(QDateTime::currentDateTime(), "INFO",
+                                QString::fromUtf8("übertragung"),
+                                LogFileInfo("fileA.log", "AppA")));
+    const int last = m_proxy->rowCount() - 1;
+    EXPECT_EQ(QString::compare(m_proxy->index(last - 1, LogModel::Message).data().toString(),
+                               m_proxy->index(last, LogModel::Message).data().toString(),
+                               Qt::CaseInsensitive),
+              0);
+}
+
+/**
+ * @brief Numeric extra columns sort by value and filter by exact value.
+ */
+TEST_F(LogSortFilterProxyModelTest, ExtraColumnsSortAndFilterNumerically)
+{
+    m_model->clear();
+
+    const QVector<qlonglong> pids{142, 9, 42};
+    for (const qlonglong pid: pids)
+    {
+        LogEntry entry(QDateTime::currentDateTime(), "INFO", "Message",
+                       LogFileInfo("fileA.log", "AppA"));
+        entry.set_extra_field("pid", QVariant::fromValue(pid));
+        m_model->add_entry(entry);
+    }
+
+    const int pid_column = m_model->find_extra_column("pid");
+    ASSERT_GE(pid_column, 0);
+
+    m_proxy->sort(pid_column, Qt::AscendingOrder);
+    ASSERT_EQ(m_proxy->rowCount(), 3);
+    EXPECT_EQ(m_proxy->index(0, pid_column).data().toLongLong(), 9);
+    EXPECT_EQ(m_proxy->index(1, pid_column).data().toLongLong(), 42);
+    EXPECT_EQ(m_proxy->index(2, pid_column).data().toLongLong(), 142);
+
+    m_proxy->set_search_filter("42", "pid", false);
+    ASSERT_EQ(m_proxy->rowCount(), 1);
+    EXPECT_EQ(m_proxy->index(0, pid_column).data().toLongLong(), 42);
+
+    m_proxy->set_search_filter("142", "All Fields", false);
+    EXPECT_EQ(m_proxy->rowCount(), 1);
+}
+
+/**
+ * @brief Plain-text message search matches UTF-8 messages for ASCII and non-ASCII search text.
+ */
+TEST_F(LogSortFilterProxyModelTest, MessageSearchOnUtf8Messages)
+{
+    m_model->clear();
+
+    const QStringList messages{QString::fromUtf8("Größe überschritten"),
+                               QString::fromUtf8("Connection RESET by peer"),
+                               QString::fromUtf8("Übertragung abgeschlossen")};
+    for (const auto& message: messages)
+    {
+        m_model->add_entry(LogEntry(QDateTime::currentDateTime(), "INFO", message,
+                                    LogFileInfo("fileA.log", "AppA")));
+    }
+
+    // ASCII search text is matched on the raw UTF-8 bytes, case-insensitively.
+    m_proxy->set_search_filter("reset", "Message", false);
+    ASSERT_EQ(m_proxy->rowCount(), 1);
+    EXPECT_EQ(m_proxy->index(0, LogModel::Message).data().toString(), messages.at(1));
+
+    m_proxy->set_search_filter("ber", "All Fields", false);
+    EXPECT_EQ(m_proxy->rowCount(), 2);
+
+    // Non-ASCII search text uses Unicode case folding on the decoded message.
+    m_proxy->set_search_filter(QString::fromUtf8("übertragung"), "Message", false);
+    ASSERT_EQ(m_proxy->rowCount(), 1);
+    EXPECT_EQ(m_proxy->index(0, LogModel::Message).data().toString(), messages.at(2));
 }
 
 /**
@@ -442,4 +525,202 @@ TEST_F(LogSortFilterProxyModelTest, DynamicFilterChangesWithFileFilters)
     m_proxy->clear_hidden_files();
     EXPECT_EQ(m_proxy->rowCount(), 4);
     EXPECT_FALSE(m_proxy->has_active_filters());
-}
\ No newline at end of file
+}
+/**
+ * @brief Batch verdicts decide appended rows only if computed with the current filter.
+ */
+TEST_F(LogSortFilterProxyModelTest, BatchVerdictsUsedOnlyForMatchingSpec)
+{
+    m_proxy->set_log_level_filters({"INFO"});
+    ASSERT_EQ(m_proxy->rowCount(), 2);
+
+    const QVector<LogEntry> batch{
+        LogEntry(QDateTime::currentDateTime(), "INFO", "Shown", LogFileInfo("fileC.log", "AppC")),
+        LogEntry(QDateTime::currentDateTime(), "INFO", "Also", LogFileInfo("fileC.log", "AppC"))};
+
+    // The bits win over the rules for decided rows (here: reject the second row).
+    LogFilter::BatchVerdicts verdicts;
+    verdicts.spec = m_proxy->get_filter_spec();
+    verdicts.accepted.resize(2);
+    verdicts.undecided.resize(2);
+    verdicts.accepted.setBit(0);
+
+    EXPECT_TRUE(m_proxy->set_batch_verdicts(m_model->rowCount(), verdicts));
+    m_model->add_entries(batch);
+    m_proxy->clear_batch_verdicts();
+    EXPECT_EQ(m_proxy->rowCount(), 3);
+
+    // Verdicts of another filter are ignored and the rows are evaluated.
+    verdicts.spec.levels = {"error"};
+    EXPECT_FALSE(m_proxy->set_batch_verdicts(m_model->rowCount(), verdicts));
+    m_model->add_entries(batch);
+    m_proxy->clear_batch_verdicts();
+    EXPECT_EQ(m_proxy->rowCount(), 5);
+}
+
+/**
+ * @brief Facet counts follow filter changes and appended rows, whether the rows were evaluated
+ *        by the proxy or arrived with batch verdicts; changes are signalled once per event loop
+ *        pass.
+ */
+TEST_F(LogSortFilterProxyModelTest, MatchCountsFollowFiltersAndAppends)
+{
+    QSignalSpy spy(m_proxy, &LogSortFilterProxyModel::match_counts_changed);
+    EXPECT_EQ(m_proxy->get_total_counts().get_total(), 4);
+    EXPECT_EQ(m_proxy->get_match_counts().get_total(), 4);
+
+    // Changes within one event loop pass are reported once.
+    m_proxy->set_app_name_filter("AppB");
+    m_proxy->set_app_name_filter(QString());
+    m_proxy->set_log_level_filters({"INFO"});
+    EXPECT_EQ(spy.count(), 0);
+    ASSERT_TRUE(spy.wait(1000));
+    EXPECT_EQ(spy.count(), 1);
+    const LogFacetCounts matched = m_proxy->get_match_counts();
+    EXPECT_EQ(matched.get_total(), 2);
+    EXPECT_EQ(matched.get_level_counts().value("INFO"), 2);
+    EXPECT_EQ(matched.get_app_counts().value("AppB"), 1);
+    EXPECT_EQ(m_proxy->get_total_counts().get_level_counts().value("ERROR"), 1);
+
+    const QVector<LogEntry> batch{
+        LogEntry(QDateTime::currentDateTime(), "INFO", "Shown", LogFileInfo("fileC.log", "AppC")),
+        LogEntry(QDateTime::currentDateTime(), "ERROR", "Hidden",
+                 LogFileInfo("fileC.log", "AppC"))};
+
+    m_model->add_entries(batch);
+    EXPECT_EQ(m_proxy->get_match_counts().get_total(), 3);
+    EXPECT_EQ(m_proxy->get_total_counts().get_total(), 6);
+
+    // Rows with batch verdicts are counted once, from the batch's counts.
+    const LogFilter::BatchVerdicts verdicts =
+        LogFilter(m_proxy->get_filter_spec()).evaluate_batch(batch);
+    EXPECT_TRUE(m_proxy->set_batch_verdicts(m_model->rowCount(), verdicts));
+    m_model->add_entries(batch);
+    m_proxy->clear_batch_verdicts();
+    EXPECT_EQ(m_proxy->get_match_counts().get_total(), 4);
+    EXPECT_EQ(m_proxy->get_match_counts().get_app_counts().value("AppC"), 2);
+    EXPECT_EQ(m_proxy->get_total_counts().get_total(), 8);
+
+    m_proxy->set_log_level_filters({});
+    EXPECT_EQ(m_proxy->get_match_counts().get_total(), 8);
+    EXPECT_EQ(m_proxy->get_total_counts().get_total(), 8);
+
+    m_model->clear();
+    EXPECT_EQ(m_proxy->get_total_counts().get_total(), 0);
+    EXPECT_EQ(m_proxy->get_match_counts().get_total(), 0);
+}
+
+/**
+ * @brief Facet counts are kept without the proxy's rows being queried, and follow rows removed
+ *        from the source model.
+ */
+TEST_F(LogSortFilterProxyModelTest, MatchCountsFollowRemovedRowsWithoutQueries)
+{
+    m_proxy->set_log_level_filters({"INFO"});
+    m_model->remove_entries_by_file_path("fileA.log");
+
+    const LogFacetCounts matched = m_proxy->get_match_counts();
+    EXPECT_EQ(matched.get_total(), 1);
+    EXPECT_EQ(matched.get_file_counts().value("fileB.log"), 1);
+    EXPECT_FALSE(matched.get_file_counts().contains("fileA.log"));
+    EXPECT_EQ(m_proxy->get_total_counts().get_total(), 2);
+}
+
+/**
+ * @brief Rows retagged in place (dataChanged) update the match counts by their flipped verdicts.
+ */
+TEST_F(LogSortFilterProxyModelTest, MatchCountsFollowRetaggedRows)
+{
+    m_proxy->set_baseline(std::make_shared<LogBaseline>());
+    m_proxy->set_novel_only_filter(true);
+    EXPECT_EQ(m_proxy->get_match_counts().get_total(), 0);
+
+    QBitArray tags(m_model->rowCount());
+    tags.setBit(0);
+    tags.setBit(2);
+    m_model->set_novel_tags(tags);
+    EXPECT_EQ(m_proxy->rowCount(), 2);
+    EXPECT_EQ(m_proxy->get_match_counts().get_total(), 2);
+
+    tags.clearBit(0);
+    m_model->set_novel_tags(tags);
+    EXPECT_EQ(m_proxy->get_match_counts().get_total(), 1);
+    EXPECT_EQ(m_proxy->get_total_counts().get_total(), 4);
+}
+
+/**
+ * @brief Large views are filtered on the worker as a registered task; a newer filter cancels the
+ *        running pass and the view keeps its rows until the verdicts are applied.
+ */
+TEST_F(LogSortFilterProxyModelTest, LargeViewFiltersOnWorker)
+{
+    TaskRegistry registry;
+    const QUuid owner = QUuid::createUuid();
+    m_proxy->set_task_registry(&registry, owner);
+    m_proxy->set_async_row_threshold(1);
+
+    m_proxy->set_app_name_filter("AppA");
+    m_proxy->set_app_name_filter("AppB");
+    EXPECT_TRUE(m_proxy->is_filter_pending());
+    EXPECT_EQ(registry.get_task_count(), 1);
+    EXPECT_EQ(m_proxy->rowCount(), 4);
+
+    ASSERT_TRUE(QTest::qWaitFor([this]() { return !m_proxy->is_filter_pending(); }, 5000));
+    EXPECT_EQ(registry.get_task_count(), 0);
+    ASSERT_EQ(m_proxy->rowCount(), 2);
+    for (int r = 0; r < m_proxy->rowCount(); ++r)
+    {
+        EXPECT_EQ(m_proxy->index(r, LogModel::AppName).data().toString(), "AppB");
+    }
+    EXPECT_EQ(m_proxy->get_match_counts().get_total(), 2);
+
+    // Rows appended while a pass runs are filtered as they arrive.
+    m_proxy->set_log_level_filters({"INFO"});
+    m_model->add_entry(LogEntry(QDateTime::currentDateTime(), "INFO", "Late",
+                                LogFileInfo("fileB.log", "AppB")));
+    ASSERT_TRUE(QTest::qWaitFor([this]() { return !m_proxy->is_filter_pending(); }, 5000));
+    EXPECT_EQ(m_proxy->rowCount(), 2);
+    EXPECT_EQ(m_proxy->get_match_counts().get_total(), 2);
+
+    // Clearing the filters needs no pass.
+    m_proxy->set_app_name_filter(QString());
+    m_proxy->set_log_level_filters({});
+    EXPECT_FALSE(m_proxy->is_filter_pending());
+    EXPECT_EQ(m_proxy->rowCount(), 5);
+}
+
+/**
+ * @brief Large views are ranked on the worker; the ranks order the view like the values do and
+ *        are reused when only the sort order flips.
+ */
+TEST_F(LogSortFilterProxyModelTest, LargeViewSortsOnWorker)
+{
+    m_proxy->set_async_row_threshold(1);
+
+    m_proxy->sort(LogModel::Message, Qt::AscendingOrder);
+    EXPECT_TRUE(m_proxy->is_sort_pending());
+    ASSERT_TRUE(QTest::qWaitFor([this]() { return !m_proxy->is_sort_pending(); }, 5000));
+
+    const QStringList ascending{"Crash", "Debugging", "Startup", "User login"};
+    for (int r = 0; r < ascending.size(); ++r)
+    {
+        EXPECT_EQ(m_proxy->index(r, LogModel::Message).data().toString(), ascending.at(r));
+    }
+
+    // Appended rows are placed among the ranked ones.
+    m_model->add_entry(LogEntry(QDateTime::currentDateTime(), "INFO", "delta",
+                                LogFileInfo("fileB.log", "AppB")));
+    EXPECT_EQ(m_proxy->index(2, LogModel::Message).data().toString(), "delta");
+
+    m_proxy->sort(LogModel::Message, Qt::DescendingOrder);
+    EXPECT_FALSE(m_proxy->is_sort_pending());
+    EXPECT_EQ(m_proxy->index(0, LogModel::Message).data().toString(), "User login");
+    EXPECT_EQ(m_proxy->index(4, LogModel::Message).data().toString(), "Crash");
+
+    // A newer sort cancels the running pass.
+    m_proxy->sort(LogModel::Timestamp, Qt::AscendingOrder);
+    m_proxy->sort(LogModel::Level, Qt::AscendingOrder);
+    ASSERT_TRUE(QTest::qWaitFor([this]() { return !m_proxy->is_sort_pending(); }, 5000));
+    EXPECT_EQ(m_proxy->get_sort_column(), LogModel::Level);
+    EXPECT_EQ(m_proxy->index(0, LogModel::Level).data().toString(), "DEBUG");
+}
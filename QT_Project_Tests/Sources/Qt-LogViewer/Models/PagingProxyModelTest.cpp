@@ -0,0 +1,148 @@
+#include "Qt-LogViewer/Models/PagingProxyModelTest.h"
+
+#include <QDateTime>
+#include <QSignalSpy>
+#include <QSortFilterProxyModel>
+#include <QStandardItem>
+
+#include "Qt-LogViewer/Models/LogModel.h"
+
+/**
+ * @brief Sets up the test fixture for each test.
+ */
+void PagingProxyModelTest::SetUp()
+{
+    m_source = new QStandardItemModel();
+    m_paging = new PagingProxyModel();
+    m_paging->setSourceModel(m_source);
+    m_paging->set_page_size(10);
+}
+
+/**
+ * @brief Tears down the test fixture after each test.
+ */
+void PagingProxyModelTest::TearDown()
+{
+    delete m_paging;
+    m_paging = nullptr;
+    delete m_source;
+    m_source = nullptr;
+}
+
+/**
+ * @brief Appends rows to the source model.
+ * @param count Number of rows to append.
+ */
+auto PagingProxyModelTest::append_rows(int count) -> void
+{
+    for (int i = 0; i < count; ++i)
+    {
+        m_source->appendRow(new QStandardItem(QString::number(m_source->rowCount())));
+    }
+}
+
+/**
+ * @test Pages follow the page size and the current page is clamped to the page count.
+ */
+TEST_F(PagingProxyModelTest, CurrentPageIsClamped)
+{
+    append_rows(25);
+
+    EXPECT_EQ(m_paging->get_total_pages(), 3);
+
+    m_paging->set_current_page(7);
+    EXPECT_EQ(m_paging->get_current_page(), 3);
+    EXPECT_EQ(m_paging->rowCount(), 5);
+}
+
+/**
+ * @test A restore page requested on an empty model is applied once enough rows arrived.
+ */
+TEST_F(PagingProxyModelTest, RestorePageAppliesWhenReachable)
+{
+    m_paging->set_restore_page(3);
+    EXPECT_EQ(m_paging->get_current_page(), 1);
+
+    append_rows(15);
+    EXPECT_EQ(m_paging->get_current_page(), 1);
+
+    append_rows(10);
+    EXPECT_EQ(m_paging->get_current_page(), 3);
+    EXPECT_EQ(m_paging->index(0, 0).data().toString(), QStringLiteral("20"));
+}
+
+/**
+ * @test A restore page that is reachable right away does not need another reset later.
+ */
+TEST_F(PagingProxyModelTest, RestorePageOnFilledModelAppliesImmediately)
+{
+    append_rows(30);
+    QSignalSpy reset_spy(m_paging, &QAbstractItemModel::modelReset);
+
+    m_paging->set_restore_page(2);
+
+    EXPECT_EQ(m_paging->get_current_page(), 2);
+    EXPECT_EQ(reset_spy.count(), 1);
+}
+
+/**
+ * @test An explicit page change cancels a pending restore page.
+ */
+TEST_F(PagingProxyModelTest, SetCurrentPageCancelsRestorePage)
+{
+    m_paging->set_restore_page(3);
+    m_paging->set_current_page(1);
+
+    append_rows(30);
+
+    EXPECT_EQ(m_paging->get_current_page(), 1);
+}
+
+/**
+ * @test The current page follows the anchor row when the rows are re-sorted or filtered.
+ */
+TEST_F(PagingProxyModelTest, CurrentPageFollowsAnchorRow)
+{
+    LogModel model;
+    QSortFilterProxyModel sort_proxy;
+    sort_proxy.setSourceModel(&model);
+    m_paging->setSourceModel(&sort_proxy);
+
+    QVector<LogEntry> entries;
+
+    for (int i = 0; i < 30; ++i)
+    {
+        LogEntry entry(QDateTime::currentDateTime(), "INFO",
+                       QStringLiteral("%1").arg(i, 2, 10, QLatin1Char('0')),
+                       LogFileInfo("app.log", "App"));
+        entry.set_line_offset(i * 100);
+        entries.append(entry);
+    }
+
+    model.set_entries(entries);
+    const quint64 anchor_id = model.get_row_id(5);
+    m_paging->set_anchor_row_ids({0, anchor_id});
+    EXPECT_EQ(m_paging->map_row_id_to_source_row(anchor_id), 5);
+    EXPECT_EQ(m_paging->index_of_row_id(anchor_id).row(), 5);
+
+    // Descending sort moves row 5 ("05") to row 24 on page 3
+    sort_proxy.sort(LogModel::Message, Qt::DescendingOrder);
+    const int sorted_row = sort_proxy.mapFromSource(model.index(5, 0)).row();
+    EXPECT_EQ(sorted_row, 24);
+    EXPECT_EQ(m_paging->map_row_id_to_source_row(anchor_id), sorted_row);
+    EXPECT_EQ(m_paging->get_current_page(), 3);
+    EXPECT_EQ(m_paging->index_of_row_id(anchor_id, LogModel::Message).data().toString(),
+              QStringLiteral("05"));
+
+    // Filtering out the first anchor falls back to the next one ("00", now row 10 on page 2)
+    const quint64 first_id = model.get_row_id(0);
+    m_paging->set_anchor_row_ids({anchor_id, first_id});
+    sort_proxy.setFilterKeyColumn(LogModel::Message);
+    sort_proxy.setFilterRegularExpression(QStringLiteral("^(00|1.)$"));
+    EXPECT_EQ(m_paging->map_row_id_to_source_row(anchor_id), -1);
+    EXPECT_FALSE(m_paging->index_of_row_id(anchor_id).isValid());
+    EXPECT_EQ(m_paging->get_current_page(), 2);
+    EXPECT_TRUE(m_paging->index_of_row_id(first_id).isValid());
+
+    m_paging->setSourceModel(m_source);
+}
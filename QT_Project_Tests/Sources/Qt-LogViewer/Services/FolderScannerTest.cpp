@@ -0,0 +1,120 @@
+#include "Qt-LogViewer/Services/FolderScannerTest.h"
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSignalSpy>
+#include <QTest>
+
+/**
+ * @brief Sets up the test fixture for each test.
+ */
+void FolderScannerTest::SetUp()
+{
+    m_dir = new QTemporaryDir();
+    ASSERT_TRUE(m_dir->isValid());
+}
+
+/**
+ * @brief Tears down the test fixture after each test.
+ */
+void FolderScannerTest::TearDown()
+{
+    delete m_dir;
+    m_dir = nullptr;
+}
+
+/**
+ * @brief Writes a file below the temporary folder.
+ * @param relative_path Path relative to the temporary folder.
+ * @param bytes Bytes to write.
+ * @return Absolute path of the created file.
+ */
+auto FolderScannerTest::write_file(const QString& relative_path, const QByteArray& bytes)
+    -> QString
+{
+    const QString path = QDir::cleanPath(m_dir->filePath(relative_path));
+    QDir().mkpath(QFileInfo(path).absolutePath());
+
+    QFile file(path);
+    EXPECT_TRUE(file.open(QIODevice::WriteOnly));
+    file.write(bytes);
+    file.close();
+
+    return path;
+}
+
+/**
+ * @test A listing contains one level only: sub folders and log files, sorted by name.
+ */
+TEST_F(FolderScannerTest, ListFolderListsOneLevelSorted)
+{
+    const QString b_log = write_file(QStringLiteral("b.log"), "b");
+    const QString a_txt = write_file(QStringLiteral("A.txt"), "a");
+    write_file(QStringLiteral("image.png"), "png");
+    write_file(QStringLiteral("sub/nested.log"), "nested");
+
+    const auto listing = FolderScanner::list_folder(m_dir->path());
+
+    EXPECT_EQ(listing.sub_folders, QStringList{QDir::cleanPath(m_dir->filePath("sub"))});
+    EXPECT_EQ(listing.files, (QStringList{a_txt, b_log}));
+}
+
+/**
+ * @test A scan reports its listing asynchronously; concurrent requests are merged.
+ */
+TEST_F(FolderScannerTest, ScanEmitsListing)
+{
+    const QString log = write_file(QStringLiteral("one.log"), "1");
+    FolderScanner scanner;
+    QSignalSpy spy(&scanner, &FolderScanner::folder_scanned);
+
+    scanner.scan(m_dir->path());
+    scanner.scan(m_dir->path());
+    EXPECT_TRUE(scanner.is_busy());
+
+    ASSERT_TRUE(QTest::qWaitFor([&]() { return !scanner.is_busy(); }, 5000));
+    ASSERT_EQ(spy.count(), 1);
+    EXPECT_EQ(spy.at(0).at(0).toString(), m_dir->path());
+    EXPECT_EQ(spy.at(0).at(2).toStringList(), QStringList{log});
+}
+
+/**
+ * @test Metadata requests report size and modification time per file.
+ */
+TEST_F(FolderScannerTest, RequestMetadataReportsSize)
+{
+    const QString log = write_file(QStringLiteral("sized.log"), "12345");
+    const QString missing = m_dir->filePath(QStringLiteral("missing.log"));
+    FolderScanner scanner;
+    QSignalSpy spy(&scanner, &FolderScanner::metadata_ready);
+
+    scanner.request_metadata({log, missing});
+
+    ASSERT_TRUE(QTest::qWaitFor([&]() { return !scanner.is_busy(); }, 5000));
+    ASSERT_EQ(spy.count(), 2);
+    EXPECT_EQ(spy.at(0).at(0).toString(), log);
+    EXPECT_EQ(spy.at(0).at(1).toLongLong(), 5);
+    EXPECT_EQ(spy.at(1).at(1).toLongLong(), -1);
+}
+
+/**
+ * @test A scan drops the watches of sub folders that are gone, keeping the scanned folder's.
+ */
+TEST_F(FolderScannerTest, ScanDropsWatchesOfRemovedSubFolders)
+{
+    write_file(QStringLiteral("sub/deep/nested.log"), "nested");
+    const QString sub = QDir::cleanPath(m_dir->filePath(QStringLiteral("sub")));
+    const QString deep = QDir::cleanPath(m_dir->filePath(QStringLiteral("sub/deep")));
+    FolderScanner scanner;
+
+    scanner.watch(m_dir->path());
+    scanner.watch(sub);
+    scanner.watch(deep);
+    ASSERT_TRUE(QDir(sub).removeRecursively());
+
+    scanner.scan(m_dir->path());
+
+    ASSERT_TRUE(QTest::qWaitFor([&]() { return !scanner.is_busy(); }, 5000));
+    EXPECT_EQ(scanner.get_watched_folders(), QStringList{m_dir->path()});
+}
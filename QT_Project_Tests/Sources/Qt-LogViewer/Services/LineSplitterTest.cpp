@@ -0,0 +1,166 @@
+#include "Qt-LogViewer/Services/LineSplitterTest.h"
+
+#include <QElapsedTimer>
+#include <QRandomGenerator>
+#include <limits>
+
+/**
+ * @brief Sets up the test fixture for each test.
+ */
+void LineSplitterTest::SetUp() {}
+
+/**
+ * @brief Tears down the test fixture after each test.
+ */
+void LineSplitterTest::TearDown() {}
+
+/**
+ * @brief Creates a buffer of random printable lines.
+ * @param size The buffer size in bytes.
+ * @param average_line_length Average number of bytes per line.
+ * @return The buffer.
+ */
+auto LineSplitterTest::make_log_buffer(qsizetype size, int average_line_length) -> QByteArray
+{
+    QRandomGenerator random(42);
+    QByteArray buffer(size, Qt::Uninitialized);
+
+    for (qsizetype i = 0; i < size; ++i)
+    {
+        const bool line_end = random.bounded(average_line_length) == 0;
+        buffer[i] = line_end ? '\n' : static_cast<char>(' ' + random.bounded(95));
+    }
+
+    return buffer;
+}
+
+/**
+ * @brief Checks that split_lines() and split_lines_scalar() agree on a buffer.
+ * @param buffer The buffer.
+ * @param scan_from The offset to start looking for '\n'.
+ */
+auto LineSplitterTest::expect_same_spans(const QByteArray& buffer, qsizetype scan_from) -> void
+{
+    QVector<LineSplitter::LineSpan> fast;
+    QVector<LineSplitter::LineSpan> reference;
+
+    const qsizetype fast_end =
+        LineSplitter::split_lines(buffer.constData(), buffer.size(), fast, scan_from);
+    const qsizetype reference_end =
+        LineSplitter::split_lines_scalar(buffer.constData(), buffer.size(), reference, scan_from);
+
+    EXPECT_EQ(fast_end, reference_end);
+    ASSERT_EQ(fast.size(), reference.size());
+
+    for (qsizetype i = 0; i < fast.size(); ++i)
+    {
+        EXPECT_EQ(fast.at(i).offset, reference.at(i).offset) << "span " << i;
+        EXPECT_EQ(fast.at(i).length, reference.at(i).length) << "span " << i;
+    }
+}
+
+/**
+ * @test Lines are split at '\n'; the incomplete last line is not reported.
+ */
+TEST_F(LineSplitterTest, SplitsLinesAndReportsCoveredBytes)
+{
+    const QByteArray buffer("alpha\r\n\nbeta\ngam");
+    QVector<LineSplitter::LineSpan> spans;
+
+    const qsizetype covered = LineSplitter::split_lines(buffer.constData(), buffer.size(), spans);
+
+    ASSERT_EQ(spans.size(), 3);
+    EXPECT_EQ(buffer.mid(spans.at(0).offset, spans.at(0).length), "alpha\r");
+    EXPECT_EQ(spans.at(1).length, 0);
+    EXPECT_EQ(buffer.mid(spans.at(2).offset, spans.at(2).length), "beta");
+    EXPECT_EQ(covered, buffer.size() - 3);
+}
+
+/**
+ * @test Newlines at every position of a vector block are found, including the first and last.
+ */
+TEST_F(LineSplitterTest, MatchesScalarAtBlockBoundaries)
+{
+    for (int size = 0; size <= 96; ++size)
+    {
+        for (int newline = 0; newline < size; ++newline)
+        {
+            QByteArray buffer(size, 'x');
+            buffer[newline] = '\n';
+            expect_same_spans(buffer);
+        }
+
+        expect_same_spans(QByteArray(size, '\n'));
+    }
+}
+
+/**
+ * @test Random buffers with short and long lines give the same spans as the scalar reference.
+ */
+TEST_F(LineSplitterTest, MatchesScalarOnRandomData)
+{
+    expect_same_spans(make_log_buffer(100003, 3));
+    expect_same_spans(make_log_buffer(100003, 120));
+    expect_same_spans(make_log_buffer(100003, 5000));
+}
+
+/**
+ * @test Scanning can resume behind the known part of a long line.
+ */
+TEST_F(LineSplitterTest, ResumesScanOfLongLine)
+{
+    QByteArray buffer(1000, 'x');
+    buffer.append("\nnext\n");
+
+    QVector<LineSplitter::LineSpan> spans;
+    const qsizetype covered =
+        LineSplitter::split_lines(buffer.constData(), buffer.size(), spans, 1000);
+
+    ASSERT_EQ(spans.size(), 2);
+    EXPECT_EQ(spans.at(0).offset, 0);
+    EXPECT_EQ(spans.at(0).length, 1000);
+    EXPECT_EQ(covered, buffer.size());
+
+    expect_same_spans(buffer, 500);
+}
+
+/**
+ * @test Benchmark: splitting throughput on 16 MiB of typical log lines.
+ *
+ * One random 64 KiB block is tiled to the full size, so building the input costs a few memcpy
+ * calls instead of a generator call per byte. Each splitter keeps its best of a few passes;
+ * the rates are attached to the test result in GB/s.
+ */
+TEST_F(LineSplitterTest, BenchmarkSplitThroughput)
+{
+    constexpr qsizetype k_block_size = 64 * 1024;
+    constexpr qsizetype k_block_count = 256;
+    constexpr int k_passes = 3;
+
+    const QByteArray buffer = make_log_buffer(k_block_size, 120).repeated(k_block_count);
+    QVector<LineSplitter::LineSpan> spans;
+    spans.reserve(buffer.size() / 100);
+
+    const auto measure = [&buffer, &spans](auto split) -> double {
+        qint64 best_ns = std::numeric_limits<qint64>::max();
+        for (int pass = 0; pass < k_passes; ++pass)
+        {
+            QElapsedTimer timer;
+            timer.start();
+            spans.clear();
+            split(buffer.constData(), buffer.size(), spans, 0);
+            best_ns = qMin(best_ns, qMax<qint64>(timer.nsecsElapsed(), 1));
+        }
+        // Bytes per nanosecond equals GB per second.
+        return static_cast<double>(buffer.size()) / static_cast<double>(best_ns);
+    };
+
+    const double scalar_gb_per_s = measure(&LineSplitter::split_lines_scalar);
+    const qsizetype scalar_lines = spans.size();
+    const double split_gb_per_s = measure(&LineSplitter::split_lines);
+
+    EXPECT_EQ(spans.size(), scalar_lines);
+    RecordProperty("instruction_set", LineSplitter::get_instruction_set().toStdString());
+    RecordProperty("split_gb_per_s", QString::number(split_gb_per_s, 'f', 2).toStdString());
+    RecordProperty("scalar_gb_per_s", QString::number(scalar_gb_per_s, 'f', 2).toStdString());
+}
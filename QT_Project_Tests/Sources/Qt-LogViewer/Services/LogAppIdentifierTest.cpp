@@ -0,0 +1,121 @@
+#include "Qt-LogViewer/Services/LogAppIdentifierTest.h"
+
+#include <QFile>
+#include <QFileInfo>
+#include <QSignalSpy>
+#include <QTemporaryFile>
+#include <QVector>
+
+#include "Qt-LogViewer/Services/LogFormatDetector.h"
+
+namespace
+{
+const QString k_format = QStringLiteral("{timestamp} {level} {message} {app_name}");
+}  // namespace
+
+/**
+ * @brief Sets up the test fixture for each test.
+ */
+void LogAppIdentifierTest::SetUp() {}
+
+/**
+ * @brief Tears down the test fixture after each test.
+ */
+void LogAppIdentifierTest::TearDown()
+{
+    for (const auto& path: m_temp_files)
+    {
+        QFile::remove(path);
+    }
+    m_temp_files.clear();
+}
+
+/**
+ * @brief Writes the given bytes into a new temporary log file.
+ * @param bytes Bytes to write.
+ * @return Absolute path of the created file.
+ */
+auto LogAppIdentifierTest::write_temp_file(const QByteArray& bytes) -> QString
+{
+    QTemporaryFile temp_file;
+    temp_file.setAutoRemove(false);
+    EXPECT_TRUE(temp_file.open());
+    temp_file.write(bytes);
+    temp_file.close();
+
+    m_temp_files.append(temp_file.fileName());
+    return temp_file.fileName();
+}
+
+/**
+ * @test The app name of the first parseable line is used.
+ */
+TEST_F(LogAppIdentifierTest, IdentifiesAppNameFromContent)
+{
+    const QString path = write_temp_file("garbage line\n"
+                                         "2024-01-01 10:00:00 INFO Started Billing\n");
+
+    const LogFormatDetector detector(k_format);
+
+    EXPECT_EQ(LogAppIdentifier::identify(path, &detector), QStringLiteral("Billing"));
+}
+
+/**
+ * @test Reading stops at the line cap; the file is then named after its base name.
+ */
+TEST_F(LogAppIdentifierTest, StopsReadingAtLineCap)
+{
+    QByteArray bytes;
+    for (int i = 0; i < 5000; ++i)
+    {
+        bytes.append("no log format here\n");
+    }
+    bytes.append("2024-01-01 10:00:00 INFO Late Billing\n");
+    const QString path = write_temp_file(bytes);
+    const LogFormatDetector detector(k_format);
+
+    EXPECT_EQ(LogAppIdentifier::identify(path, &detector), QFileInfo(path).baseName());
+}
+
+/**
+ * @test The byte cap also holds inside a single long line, which is dropped unparsed.
+ */
+TEST_F(LogAppIdentifierTest, StopsReadingAtByteCapInsideLine)
+{
+    const QString path = write_temp_file("2024-01-01 10:00:00 INFO " +
+                                         QByteArray(256 * 1024, 'x') + " Billing\n");
+    const LogFormatDetector detector(k_format);
+
+    EXPECT_EQ(LogAppIdentifier::identify(path, &detector), QFileInfo(path).baseName());
+}
+
+/**
+ * @test Requests are answered asynchronously and cached per file identity.
+ */
+TEST_F(LogAppIdentifierTest, RequestEmitsAndCaches)
+{
+    const QString path = write_temp_file("2024-01-01 10:00:00 INFO Started Billing\n");
+    LogAppIdentifier identifier;
+    identifier.set_formats({k_format});
+    QSignalSpy spy(&identifier, &LogAppIdentifier::app_identified);
+
+    EXPECT_TRUE(identifier.get_cached_app_name(path).isEmpty());
+
+    identifier.request(path);
+    identifier.request(path);  // merged with the running request
+    EXPECT_TRUE(identifier.is_busy());
+
+    ASSERT_TRUE(spy.wait());
+    EXPECT_EQ(spy.count(), 1);
+    EXPECT_EQ(spy.at(0).at(0).toString(), path);
+    EXPECT_EQ(spy.at(0).at(1).toString(), QStringLiteral("Billing"));
+    EXPECT_FALSE(identifier.is_busy());
+    EXPECT_EQ(identifier.get_cached_app_name(path), QStringLiteral("Billing"));
+
+    // A changed file is no longer served from the cache.
+    QFile file(path);
+    ASSERT_TRUE(file.open(QIODevice::Append));
+    file.write("2024-01-01 10:00:01 INFO More Billing\n");
+    file.close();
+    EXPECT_TRUE(identifier.get_cached_app_name(path).isEmpty());
+}
@@ -0,0 +1,128 @@
+#include "Qt-LogViewer/Services/LogBaselineBuilderTest.h"
+
+#include <QFile>
+#include <QSignalSpy>
+#include <QTemporaryFile>
+#include <QVector>
+
+#include "Qt-LogViewer/Models/LogBaseline.h"
+#include "Qt-LogViewer/Services/LogLoader.h"
+
+namespace
+{
+const QString k_format = QStringLiteral("{timestamp} {level} {message} {app_name}");
+}  // namespace
+
+/**
+ * @brief Sets up the test fixture for each test.
+ */
+void LogBaselineBuilderTest::SetUp() {}
+
+/**
+ * @brief Tears down the test fixture after each test.
+ */
+void LogBaselineBuilderTest::TearDown()
+{
+    for (const auto& path: m_temp_files)
+    {
+        QFile::remove(path);
+    }
+    m_temp_files.clear();
+}
+
+/**
+ * @brief Writes the given bytes into a new temporary log file.
+ * @param bytes Bytes to write.
+ * @return Absolute path of the created file.
+ */
+auto LogBaselineBuilderTest::write_temp_file(const QByteArray& bytes) -> QString
+{
+    QTemporaryFile temp_file;
+    temp_file.setAutoRemove(false);
+    EXPECT_TRUE(temp_file.open());
+    temp_file.write(bytes);
+    temp_file.close();
+
+    m_temp_files.append(temp_file.fileName());
+    return temp_file.fileName();
+}
+
+/**
+ * @test The baseline built from several files in parallel contains the lines of all of them.
+ */
+TEST_F(LogBaselineBuilderTest, BuildsBaselineFromAllFiles)
+{
+    const QString a_path = write_temp_file("2024-01-01 10:00:00 INFO Started Billing\n"
+                                           "2024-01-01 10:00:01 INFO Ready Billing\n");
+    const QString b_path = write_temp_file("2024-01-01 11:00:00 WARNING Retrying Billing\n");
+    const QString new_path = write_temp_file("2024-01-02 09:00:00 ERROR Crashed Billing\n");
+
+    LogBaselineBuilder builder;
+    builder.set_formats({k_format});
+    QSignalSpy finished_spy(&builder, &LogBaselineBuilder::finished);
+    QSignalSpy progress_spy(&builder, &LogBaselineBuilder::progress);
+
+    builder.build({a_path, b_path});
+    EXPECT_TRUE(builder.is_busy());
+    ASSERT_TRUE(finished_spy.wait());
+    EXPECT_FALSE(builder.is_busy());
+    EXPECT_EQ(progress_spy.count(), 2);
+
+    const auto baseline = builder.get_baseline();
+    ASSERT_NE(baseline, nullptr);
+    EXPECT_EQ(baseline->get_added_count(), 3);
+    EXPECT_EQ(baseline->get_file_paths(), QVector<QString>({a_path, b_path}));
+
+    const LogLoader loader(k_format);
+    for (const auto& path: {a_path, b_path})
+    {
+        for (const auto& entry: loader.load_log_file(path))
+        {
+            EXPECT_FALSE(baseline->is_novel(entry));
+        }
+    }
+    const auto new_entries = loader.load_log_file(new_path);
+    ASSERT_EQ(new_entries.size(), 1);
+    EXPECT_TRUE(baseline->is_novel(new_entries.first()));
+}
+
+/**
+ * @test Building without files removes the baseline right away.
+ */
+TEST_F(LogBaselineBuilderTest, EmptyBuildClearsBaseline)
+{
+    LogBaselineBuilder builder;
+    builder.set_formats({k_format});
+    QSignalSpy finished_spy(&builder, &LogBaselineBuilder::finished);
+
+    builder.build({});
+
+    EXPECT_EQ(finished_spy.count(), 1);
+    EXPECT_FALSE(builder.is_busy());
+    EXPECT_EQ(builder.get_baseline(), nullptr);
+}
+
+/**
+ * @test A cancelled build keeps the previous baseline and never reports finished.
+ */
+TEST_F(LogBaselineBuilderTest, CancelDropsRunningBuild)
+{
+    QByteArray bytes;
+    for (int i = 0; i < 20000; ++i)
+    {
+        bytes.append(QByteArray("2024-01-01 10:00:00 INFO Step") + QByteArray::number(i) +
+                     " Billing\n");
+    }
+    const QString path = write_temp_file(bytes);
+
+    LogBaselineBuilder builder;
+    builder.set_formats({k_format});
+    QSignalSpy finished_spy(&builder, &LogBaselineBuilder::finished);
+
+    builder.build({path});
+    builder.cancel();
+    EXPECT_FALSE(builder.is_busy());
+
+    EXPECT_FALSE(finished_spy.wait(500));
+    EXPECT_EQ(builder.get_baseline(), nullptr);
+}
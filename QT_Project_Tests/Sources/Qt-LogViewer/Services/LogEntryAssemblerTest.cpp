@@ -0,0 +1,124 @@
+#include "Qt-LogViewer/Services/LogEntryAssemblerTest.h"
+
+#include <QDateTime>
+
+/**
+ * @brief Builds a parsed entry as LogParser would return it for a matching line.
+ * @param message The entry message.
+ * @return The entry.
+ */
+auto LogEntryAssemblerTest::make_entry(const QString& message) -> LogEntry
+{
+    return LogEntry(QDateTime::currentDateTime(), "Info", message, LogFileInfo("a.log", "App"));
+}
+
+/**
+ * @test An entry is only completed once the next entry starts or the input ends.
+ */
+TEST_F(LogEntryAssemblerTest, CompletesEntryOnNextEntryOrFinish)
+{
+    LogEntryAssembler assembler;
+    QVector<LogEntry> completed;
+
+    assembler.add_line(make_entry("first"), "raw first", completed);
+    EXPECT_TRUE(completed.isEmpty());
+    EXPECT_TRUE(assembler.has_pending());
+
+    assembler.add_line(LogEntry(), "  continuation", completed);
+    assembler.add_line(make_entry("second"), "raw second", completed);
+    ASSERT_EQ(completed.size(), 1);
+    EXPECT_EQ(completed[0].get_message(), "first\n  continuation");
+
+    assembler.finish(completed);
+    ASSERT_EQ(completed.size(), 2);
+    EXPECT_EQ(completed[1].get_message(), "second");
+    EXPECT_FALSE(assembler.has_pending());
+}
+
+/**
+ * @test Continuation lines without a preceding entry and blank lines are dropped.
+ */
+TEST_F(LogEntryAssemblerTest, DropsOrphanAndBlankLines)
+{
+    LogEntryAssembler assembler;
+    QVector<LogEntry> completed;
+
+    assembler.add_line(LogEntry(), "orphan", completed);
+    assembler.add_line(make_entry("entry"), "raw entry", completed);
+    assembler.add_line(LogEntry(), "   ", completed);
+    assembler.finish(completed);
+
+    ASSERT_EQ(completed.size(), 1);
+    EXPECT_EQ(completed[0].get_message(), "entry");
+}
+
+/**
+ * @test The assembled message is capped and marked as truncated.
+ */
+TEST_F(LogEntryAssemblerTest, CapsAssembledEntrySize)
+{
+    LogEntryAssembler assembler(32);
+    QVector<LogEntry> completed;
+
+    assembler.add_line(make_entry("head"), "raw head", completed);
+    for (int i = 0; i < 100; ++i)
+    {
+        assembler.add_line(LogEntry(), QStringLiteral("frame %1").arg(i), completed);
+    }
+    assembler.finish(completed);
+
+    ASSERT_EQ(completed.size(), 1);
+    EXPECT_LE(completed[0].get_message().size(), 32 + 8);
+    EXPECT_TRUE(completed[0].get_message().endsWith("[...]"));
+    EXPECT_EQ(assembler.get_truncated_count(), 1);
+}
+
+/**
+ * @test An entry takes over the source range of its first truncated continuation line.
+ */
+TEST_F(LogEntryAssemblerTest, KeepsSourceRangeOfTruncatedContinuation)
+{
+    LogEntryAssembler assembler;
+    QVector<LogEntry> completed;
+    LogEntry first_long_line;
+    LogEntry second_long_line;
+    first_long_line.set_source_range(100, 5000000);
+    second_long_line.set_source_range(6000000, 7000000);
+
+    assembler.add_line(make_entry("entry"), "raw entry", completed);
+    assembler.add_line(first_long_line, "{\"blob\":", completed);
+    assembler.add_line(second_long_line, "{\"blob\":", completed);
+    assembler.add_line(make_entry("next"), "raw next", completed);
+    assembler.finish(completed);
+
+    ASSERT_EQ(completed.size(), 2);
+    EXPECT_TRUE(completed[0].is_truncated());
+    EXPECT_EQ(completed[0].get_source_offset(), 100);
+    EXPECT_EQ(completed[0].get_source_length(), 5000000);
+    EXPECT_FALSE(completed[1].is_truncated());
+}
+
+/**
+ * @test Equal string extra fields of different entries share one allocation; numbers are kept.
+ */
+TEST_F(LogEntryAssemblerTest, PoolsStringExtraFields)
+{
+    LogEntryAssembler assembler;
+    QVector<LogEntry> completed;
+
+    for (int i = 0; i < 2; ++i)
+    {
+        LogEntry entry = make_entry(QStringLiteral("message %1").arg(i));
+        entry.set_extra_field("thread", QString::fromLatin1("worker-1"));
+        entry.set_extra_field("pid", QVariant::fromValue(qlonglong(42)));
+        assembler.add_line(entry, "raw", completed);
+    }
+    assembler.finish(completed);
+
+    ASSERT_EQ(completed.size(), 2);
+    const QString first = completed[0].get_extra_field("thread").toString();
+    const QString second = completed[1].get_extra_field("thread").toString();
+    EXPECT_EQ(first, QStringLiteral("worker-1"));
+    EXPECT_EQ(first.constData(), second.constData());
+    EXPECT_EQ(completed[1].get_extra_field("pid").typeId(), QMetaType::LongLong);
+}
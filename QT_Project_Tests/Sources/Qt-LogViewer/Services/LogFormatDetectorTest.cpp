@@ -0,0 +1,134 @@
+#include "Qt-LogViewer/Services/LogFormatDetectorTest.h"
+
+#include <QFile>
+#include <QTemporaryFile>
+#include <QTextStream>
+
+namespace
+{
+constexpr auto k_primary_format = "{timestamp} {level} {message} {app_name}";
+}  // namespace
+
+/**
+ * @brief Sets up the test fixture for each test.
+ */
+void LogFormatDetectorTest::SetUp()
+{
+    m_detector = new LogFormatDetector(QString::fromLatin1(k_primary_format));
+}
+
+/**
+ * @brief Tears down the test fixture after each test.
+ */
+void LogFormatDetectorTest::TearDown()
+{
+    delete m_detector;
+    m_detector = nullptr;
+
+    for (const auto& path: m_temp_files)
+    {
+        QFile::remove(path);
+    }
+    m_temp_files.clear();
+}
+
+/**
+ * @brief Writes the given lines into a new temporary file.
+ * @param lines Lines to write.
+ * @return Absolute path of the created file.
+ */
+auto LogFormatDetectorTest::write_temp_file(const QStringList& lines) -> QString
+{
+    QTemporaryFile temp_file;
+    temp_file.setAutoRemove(false);
+    EXPECT_TRUE(temp_file.open());
+
+    QTextStream out(&temp_file);
+    for (const auto& line: lines)
+    {
+        out << line << "\n";
+    }
+    out.flush();
+    temp_file.close();
+
+    m_temp_files.append(temp_file.fileName());
+    return temp_file.fileName();
+}
+
+/**
+ * @test The primary format comes first in the library, followed by the built-in formats.
+ */
+TEST_F(LogFormatDetectorTest, LibraryStartsWithPrimaryFormat)
+{
+    const QVector<QString> formats = m_detector->get_formats();
+
+    ASSERT_FALSE(formats.isEmpty());
+    EXPECT_EQ(formats.first(), QString::fromLatin1(k_primary_format));
+    EXPECT_EQ(formats.count(QString::fromLatin1(k_primary_format)), 1);
+    EXPECT_GE(formats.size(), LogFormatDetector::get_builtin_formats().size());
+}
+
+/**
+ * @test Files in the primary format detect as the primary format.
+ */
+TEST_F(LogFormatDetectorTest, DetectsPrimaryFormat)
+{
+    const QString path = write_temp_file(
+        {"2024-01-01 10:00:00 INFO Startup AppA", "2024-01-01 10:01:00 ERROR Crash AppA"});
+
+    EXPECT_EQ(m_detector->detect_format(path), QString::fromLatin1(k_primary_format));
+}
+
+/**
+ * @test The more specific format wins when several formats match every line.
+ */
+TEST_F(LogFormatDetectorTest, PrefersMoreSpecificFormatOnTie)
+{
+    const QString path =
+        write_temp_file({"2024-01-01 12:34:56 Info Startup MyApp [main.cpp:1 (main)]",
+                         "2024-01-01 12:35:00 Error Crash MyApp [engine.cpp:42 (run)]"});
+
+    EXPECT_EQ(m_detector->detect_format(path),
+              QStringLiteral("{timestamp} {level} {message} {app_name} [{file}:{line} ({function})]"));
+}
+
+/**
+ * @test A bracketed format is detected even if a few lines do not match.
+ */
+TEST_F(LogFormatDetectorTest, DetectsBuiltinFormatByMatchRate)
+{
+    const QString path = write_temp_file({"[2024-01-01 10:00:00] [INFO] Service started",
+                                          "[2024-01-01 10:00:01] [WARN] Low memory",
+                                          "    at com.example.Worker.run(Worker.java:42)",
+                                          "[2024-01-01 10:00:02] [ERROR] Request failed"});
+
+    EXPECT_EQ(m_detector->detect_format(path), QStringLiteral("[{timestamp}] [{level}] {message}"));
+}
+
+/**
+ * @test User-defined formats take part in detection.
+ */
+TEST_F(LogFormatDetectorTest, DetectsUserDefinedFormat)
+{
+    const QString custom_format = QStringLiteral("{level}|{timestamp}|{app_name}|{message}");
+    const QString path = write_temp_file({"INFO|2024-01-01 10:00:00|AppA|Started",
+                                          "ERROR|2024-01-01 10:00:01|AppA|Failed"});
+
+    EXPECT_EQ(m_detector->detect_format(path), QString::fromLatin1(k_primary_format));
+
+    m_detector->add_formats({custom_format});
+    EXPECT_EQ(m_detector->detect_format(path), custom_format);
+}
+
+/**
+ * @test Unknown content and missing files fall back to the primary format.
+ */
+TEST_F(LogFormatDetectorTest, FallsBackToPrimaryFormat)
+{
+    const QString path = write_temp_file({"not a log line", "neither is this"});
+
+    EXPECT_EQ(m_detector->detect_format(path), QString::fromLatin1(k_primary_format));
+    EXPECT_EQ(m_detector->detect_format(QStringLiteral("nonexistent_file.log")),
+              QString::fromLatin1(k_primary_format));
+    EXPECT_TRUE(m_detector->detect_format_for_lines({"garbage"}).isEmpty());
+}
@@ -0,0 +1,261 @@
+#include "Qt-LogViewer/Services/LogLineReaderTest.h"
+
+#include <QFile>
+#include <QStringEncoder>
+#include <QTemporaryFile>
+
+/**
+ * @brief Sets up the test fixture for each test.
+ */
+void LogLineReaderTest::SetUp() {}
+
+/**
+ * @brief Tears down the test fixture after each test.
+ */
+void LogLineReaderTest::TearDown()
+{
+    for (const auto& path: m_temp_files)
+    {
+        QFile::remove(path);
+    }
+    m_temp_files.clear();
+}
+
+/**
+ * @brief Writes the given raw bytes into a new temporary file.
+ * @param bytes Bytes to write.
+ * @return Absolute path of the created file.
+ */
+auto LogLineReaderTest::write_temp_file(const QByteArray& bytes) -> QString
+{
+    QTemporaryFile temp_file;
+    temp_file.setAutoRemove(false);
+    EXPECT_TRUE(temp_file.open());
+    temp_file.write(bytes);
+    temp_file.close();
+
+    m_temp_files.append(temp_file.fileName());
+    return temp_file.fileName();
+}
+
+/**
+ * @brief Reads all lines of a file through a LogLineReader.
+ * @param file_path The file to read.
+ * @param invalid_lines Output for the number of invalid UTF-8 lines.
+ * @return The decoded lines.
+ */
+auto LogLineReaderTest::read_all_lines(const QString& file_path, qsizetype& invalid_lines)
+    -> QStringList
+{
+    QStringList lines;
+    QFile file(file_path);
+    EXPECT_TRUE(file.open(QIODevice::ReadOnly));
+
+    LogLineReader reader(&file);
+    QString line;
+    while (reader.read_line(line))
+    {
+        lines.append(line);
+    }
+    invalid_lines = reader.get_invalid_line_count();
+
+    return lines;
+}
+
+/**
+ * @test A UTF-8 BOM is skipped and both LF and CRLF line endings are stripped.
+ */
+TEST_F(LogLineReaderTest, SkipsUtf8BomAndStripsLineEndings)
+{
+    const QString path = write_temp_file(QByteArray("\xEF\xBB\xBF") + "first\r\nsecond\nthird");
+
+    qsizetype invalid_lines = -1;
+    const QStringList lines = read_all_lines(path, invalid_lines);
+
+    ASSERT_EQ(lines.size(), 3);
+    EXPECT_EQ(lines.at(0), "first");
+    EXPECT_EQ(lines.at(1), "second");
+    EXPECT_EQ(lines.at(2), "third");
+    EXPECT_EQ(invalid_lines, 0);
+}
+
+/**
+ * @test Multi-byte UTF-8 is decoded, invalid UTF-8 lines are read as Latin-1 and counted.
+ */
+TEST_F(LogLineReaderTest, FallsBackToLatin1ForInvalidUtf8)
+{
+    const QString path =
+        write_temp_file(QByteArray("Gr\xC3\xB6\xC3\x9F" "e\n") + QByteArray("caf\xE9\n"));
+
+    qsizetype invalid_lines = -1;
+    const QStringList lines = read_all_lines(path, invalid_lines);
+
+    ASSERT_EQ(lines.size(), 2);
+    EXPECT_EQ(lines.at(0), QString::fromUtf8("Größe"));
+    EXPECT_EQ(lines.at(1), QString::fromLatin1("caf\xE9"));
+    EXPECT_EQ(invalid_lines, 1);
+}
+
+/**
+ * @test The bytes of valid UTF-8 lines stay available; invalid lines expose none.
+ */
+TEST_F(LogLineReaderTest, ExposesUtf8BytesOfValidLines)
+{
+    const QString path =
+        write_temp_file(QByteArray("Gr\xC3\xB6\xC3\x9F" "e\r\n") + QByteArray("caf\xE9\n"));
+    QFile file(path);
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+
+    LogLineReader reader(&file);
+    QString line;
+
+    ASSERT_TRUE(reader.read_line(line));
+    EXPECT_EQ(reader.get_line_utf8(), QByteArrayView("Gr\xC3\xB6\xC3\x9F" "e"));
+
+    ASSERT_TRUE(reader.read_line(line));
+    EXPECT_TRUE(reader.get_line_utf8().isEmpty());
+}
+
+/**
+ * @test The reader stops at the read limit and drops the line the limit cuts off.
+ */
+TEST_F(LogLineReaderTest, StopsAtReadLimit)
+{
+    const QString path = write_temp_file("a\nb\n" + QByteArray(1024, 'c') + "\nd\n");
+    QFile file(path);
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+
+    LogLineReader reader(&file);
+    reader.set_read_limit(16);
+    QString line;
+
+    ASSERT_TRUE(reader.read_line(line));
+    EXPECT_EQ(line, "a");
+    ASSERT_TRUE(reader.read_line(line));
+    EXPECT_EQ(line, "b");
+    EXPECT_FALSE(reader.read_line(line));
+    EXPECT_TRUE(reader.at_end());
+    EXPECT_EQ(file.pos(), 16);
+}
+
+/**
+ * @test Files with a UTF-16 BOM are decoded through the fallback stream.
+ */
+TEST_F(LogLineReaderTest, DecodesUtf16WithBom)
+{
+    QStringEncoder encoder(QStringEncoder::Utf16LE, QStringEncoder::Flag::WriteBom);
+    const QByteArray bytes = encoder.encode(QStringLiteral("alpha\nbeta\n"));
+    const QString path = write_temp_file(bytes);
+
+    QFile file(path);
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+    LogLineReader reader(&file);
+    EXPECT_FALSE(reader.is_utf8());
+
+    QString line;
+    ASSERT_TRUE(reader.read_line(line));
+    EXPECT_EQ(line, "alpha");
+    ASSERT_TRUE(reader.read_line(line));
+    EXPECT_EQ(line, "beta");
+    EXPECT_FALSE(reader.read_line(line));
+}
+
+/**
+ * @test Lines longer than a read block are returned whole, many short lines keep their order,
+ *       and the position follows the returned lines rather than the device.
+ */
+TEST_F(LogLineReaderTest, ReadsLinesAcrossBlocks)
+{
+    const QByteArray long_line(1024 * 1024 + 7, 'x');
+    QByteArray bytes = "head\r\n" + long_line + "\n";
+    for (int i = 0; i < 100000; ++i)
+    {
+        bytes += QByteArray::number(i) + '\n';
+    }
+    bytes += "tail";
+    const QString path = write_temp_file(bytes);
+
+    QFile file(path);
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+    LogLineReader reader(&file);
+    reader.set_max_line_length(2 * long_line.size());
+    QString line;
+
+    ASSERT_TRUE(reader.read_line(line));
+    EXPECT_EQ(line, "head");
+    EXPECT_EQ(reader.get_position(), 6);
+
+    ASSERT_TRUE(reader.read_line(line));
+    EXPECT_EQ(line.size(), long_line.size());
+    EXPECT_EQ(reader.get_position(), 6 + long_line.size() + 1);
+
+    bool in_order = true;
+    for (int i = 0; i < 100000; ++i)
+    {
+        in_order = reader.read_line(line) && line == QString::number(i) && in_order;
+    }
+    EXPECT_TRUE(in_order);
+
+    EXPECT_FALSE(reader.at_end());
+    ASSERT_TRUE(reader.read_line(line));
+    EXPECT_EQ(line, "tail");
+    EXPECT_TRUE(reader.at_end());
+    EXPECT_EQ(reader.get_position(), bytes.size());
+    EXPECT_FALSE(reader.read_line(line));
+}
+
+/**
+ * @test Lines above the limit are cut to a prefix that keeps UTF-8 sequences whole, report the
+ *       full line's offset and length, and do not disturb the lines around them.
+ */
+TEST_F(LogLineReaderTest, TruncatesOverlongLines)
+{
+    constexpr qsizetype k_limit = 1000;
+
+    // One line that fits into a block, one that spans many blocks and ends the file.
+    const QByteArray in_block = QByteArray(999, 'y') + "\xC3\xA9" + QByteArray(4000, 'y');
+    const QByteArray huge(3 * 1024 * 1024, 'z');
+    const QByteArray bytes = "a\n" + in_block + "\r\nb\n" + huge + "\nc\n" + huge;
+    const QString path = write_temp_file(bytes);
+
+    QFile file(path);
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+    LogLineReader reader(&file);
+    reader.set_max_line_length(k_limit);
+    QString line;
+
+    ASSERT_TRUE(reader.read_line(line));
+    EXPECT_EQ(line, "a");
+    EXPECT_FALSE(reader.is_line_truncated());
+
+    // 1000 bytes would end inside the 2-byte sequence at offset 999; it is dropped whole.
+    ASSERT_TRUE(reader.read_line(line));
+    EXPECT_TRUE(reader.is_line_truncated());
+    EXPECT_EQ(line.toUtf8().size(), k_limit - 1);
+    EXPECT_EQ(reader.get_line_offset(), 2);
+    EXPECT_EQ(reader.get_line_length(), in_block.size());
+
+    ASSERT_TRUE(reader.read_line(line));
+    EXPECT_EQ(line, "b");
+
+    const qint64 huge_offset = 2 + in_block.size() + 2 + 2;
+    ASSERT_TRUE(reader.read_line(line));
+    EXPECT_TRUE(reader.is_line_truncated());
+    EXPECT_EQ(line.size(), k_limit);
+    EXPECT_EQ(reader.get_line_utf8().size(), k_limit);
+    EXPECT_EQ(reader.get_line_offset(), huge_offset);
+    EXPECT_EQ(reader.get_line_length(), huge.size());
+    EXPECT_EQ(reader.get_position(), huge_offset + huge.size() + 1);
+
+    ASSERT_TRUE(reader.read_line(line));
+    EXPECT_EQ(line, "c");
+    EXPECT_FALSE(reader.is_line_truncated());
+
+    // The last line has no line ending.
+    ASSERT_TRUE(reader.read_line(line));
+    EXPECT_TRUE(reader.is_line_truncated());
+    EXPECT_EQ(reader.get_line_length(), huge.size());
+    EXPECT_EQ(reader.get_position(), bytes.size());
+    EXPECT_FALSE(reader.read_line(line));
+    EXPECT_EQ(reader.get_truncated_line_count(), 3);
+}
@@ -54,6 +54,30 @@ TEST_F(LogLoaderTest, LoadSingleLogFile)
     EXPECT_EQ(entries[0].get_app_name(), "MyApp");
 }
 
+/**
+ * @brief Tests that a file in another known format is parsed with the detected format.
+ */
+TEST_F(LogLoaderTest, LoadLogFileDetectsOtherFormat)
+{
+    QTemporaryFile temp_file;
+    ASSERT_TRUE(temp_file.open());
+    QTextStream out(&temp_file);
+    out << "2024-01-01 12:34:56 [worker-1] Info net.Client - Connected\n";
+    out << "2024-01-01 12:34:57 [worker-2] Error net.Client - Timeout\n";
+    out.flush();
+    temp_file.close();
+
+    EXPECT_EQ(m_loader->detect_log_format(temp_file.fileName()),
+              "{timestamp} [{thread}] {level} {logger} - {message}");
+
+    QVector<LogEntry> entries = m_loader->load_log_file(temp_file.fileName());
+    ASSERT_EQ(entries.size(), 2);
+    EXPECT_EQ(entries[0].get_level(), "Info");
+    EXPECT_EQ(entries[0].get_message(), "Connected");
+    EXPECT_EQ(entries[0].get_extra_field("thread").toString(), "worker-1");
+    EXPECT_EQ(entries[1].get_extra_field("logger").toString(), "net.Client");
+}
+
 /**
  * @brief Tests loading a log file with no valid entries.
  */
@@ -63,6 +63,61 @@ TEST_F(LogParserTest, ParseValidLogLine)
     EXPECT_EQ(entry.get_app_name(), "MyApp");
 }
 
+/**
+ * @test Verifies that the message is taken from the line's bytes, ASCII or not.
+ */
+TEST_F(LogParserTest, ParseLineTakesMessageFromUtf8Bytes)
+{
+    const QByteArray ascii = "2024-01-01 12:34:56 Info   Started   MyApp [file.cpp:42 (func())]";
+    LogEntry entry = m_parser->parse_line(QString::fromUtf8(ascii), ascii, "dummy.log");
+
+    EXPECT_EQ(entry.get_message_utf8(), QByteArray("Started"));
+    EXPECT_EQ(entry.get_app_name(), "MyApp");
+
+    const QByteArray utf8 =
+        QString::fromUtf8("2024-01-01 12:34:56 Info Größe ok MyApp [file.cpp:42 (func())]")
+            .toUtf8();
+    entry = m_parser->parse_line(QString::fromUtf8(utf8), utf8, "dummy.log");
+
+    EXPECT_EQ(entry.get_message(), QString::fromUtf8("Größe ok"));
+}
+
+/**
+ * @test Verifies that extra placeholders are kept as typed fields in format order.
+ */
+TEST_F(LogParserTest, ParseLineKeepsTypedExtraFields)
+{
+    QString line = "2024-01-01 12:34:56 Debug This is a debug message MyApp [file.cpp:42 (func())]";
+    LogEntry entry = m_parser->parse_line(line, "dummy.log");
+
+    const auto extra_fields = entry.get_extra_fields();
+    ASSERT_EQ(extra_fields.size(), 3);
+    EXPECT_EQ(extra_fields.at(0).first, "file");
+    EXPECT_EQ(extra_fields.at(1).first, "line");
+    EXPECT_EQ(extra_fields.at(2).first, "function");
+
+    EXPECT_EQ(entry.get_extra_field("file").typeId(), QMetaType::QString);
+    EXPECT_EQ(entry.get_extra_field("file").toString(), "file.cpp");
+    EXPECT_EQ(entry.get_extra_field("line").typeId(), QMetaType::LongLong);
+    EXPECT_EQ(entry.get_extra_field("line").toLongLong(), 42);
+    EXPECT_EQ(entry.get_extra_field("function").toString(), "func()");
+    EXPECT_FALSE(entry.get_extra_field("thread").isValid());
+}
+
+/**
+ * @test Verifies that a custom placeholder such as {thread} becomes an extra field.
+ */
+TEST_F(LogParserTest, ParseLineCapturesCustomPlaceholders)
+{
+    LogParser parser("{timestamp} [{thread}] {level} {message} {app_name}");
+    LogEntry entry = parser.parse_line("2024-01-01 12:34:56 [worker-1] Info Started MyApp",
+                                       "dummy.log");
+
+    EXPECT_EQ(entry.get_level(), "Info");
+    EXPECT_EQ(entry.get_message(), "Started");
+    EXPECT_EQ(entry.get_extra_field("thread").toString(), "worker-1");
+}
+
 /**
  * @test Verifies that an invalid log line returns a default LogEntry.
  */
@@ -78,7 +133,8 @@ TEST_F(LogParserTest, ParseInvalidLogLineReturnsDefault)
 }
 
 /**
- * @test Verifies that parse_file parses all valid lines and ignores invalid ones.
+ * @test Verifies that parse_file parses all valid lines and attaches non-matching lines to the
+ * preceding entry.
  */
 TEST_F(LogParserTest, ParseFileParsesAllValidLines)
 {
@@ -97,7 +153,7 @@ TEST_F(LogParserTest, ParseFileParsesAllValidLines)
     EXPECT_EQ(entries[0].get_timestamp(),
               QDateTime::fromString("2024-01-01 12:34:56", "yyyy-MM-dd HH:mm:ss"));
     EXPECT_EQ(entries[0].get_level(), "Info");
-    EXPECT_EQ(entries[0].get_message(), "Info message");
+    EXPECT_EQ(entries[0].get_message(), "Info message\ninvalid line");
     EXPECT_EQ(entries[0].get_app_name(), "App1");
     EXPECT_EQ(entries[1].get_timestamp(),
               QDateTime::fromString("2024-01-01 12:35:00", "yyyy-MM-dd HH:mm:ss"));
@@ -106,6 +162,33 @@ TEST_F(LogParserTest, ParseFileParsesAllValidLines)
     EXPECT_EQ(entries[1].get_app_name(), "App2");
 }
 
+/**
+ * @test Verifies that stack trace lines are assembled into the preceding entry.
+ */
+TEST_F(LogParserTest, ParseFileAssemblesMultiLineEntries)
+{
+    QTemporaryFile temp_file;
+    ASSERT_TRUE(temp_file.open());
+    QTextStream out(&temp_file);
+    out << "stray line before the first entry\n";
+    out << "2024-01-01 12:34:56 Error Unhandled exception App1 [main.cpp:10 (main())]\n";
+    out << "java.lang.IllegalStateException: boom\n";
+    out << "\tat com.example.Worker.run(Worker.java:42)\n";
+    out << "\n";
+    out << "2024-01-01 12:35:00 Info Recovered App1 [main.cpp:20 (main())]\n";
+    out.flush();
+    temp_file.close();
+
+    QVector<LogEntry> entries = m_parser->parse_file(temp_file.fileName());
+
+    ASSERT_EQ(entries.size(), 2);
+    EXPECT_EQ(entries[0].get_message(), "Unhandled exception\n"
+                                        "java.lang.IllegalStateException: boom\n"
+                                        "\tat com.example.Worker.run(Worker.java:42)");
+    EXPECT_EQ(entries[0].get_extra_field("line").toLongLong(), 10);
+    EXPECT_EQ(entries[1].get_message(), "Recovered");
+}
+
 /**
  * @test Verifies that parse_file returns an empty vector if the file does not exist.
  */
@@ -132,6 +132,64 @@ TEST_F(LogStreamWorkerTest, StreamsBatchesAndReportsProgress)
     EXPECT_EQ(batch_count, 3);
 }
 
+/**
+ * @test Verifies that continuation lines are attached to the preceding entry, also when the
+ *       entry is the last one of a batch.
+ */
+TEST_F(LogStreamWorkerTest, AssemblesMultiLineEntriesAcrossBatches)
+{
+    QTemporaryFile* file = create_temp_file({"Error first failure AppX", "  at frame_1",
+                                             "  at frame_2", "Info second AppX", "  at frame_3",
+                                             "Info third AppX"});
+
+    QVector<LogEntry> entries;
+    QObject::connect(m_worker, &LogStreamWorker::entry_batch_parsed, m_worker,
+                     [&entries](const QString&, const QVector<LogEntry>& batch) {
+                         entries += batch;
+                     });
+
+    m_worker->start(file->fileName(), 1);
+
+    ASSERT_EQ(entries.size(), 3);
+    EXPECT_EQ(entries[0].get_message(), "first failure\n  at frame_1\n  at frame_2");
+    EXPECT_EQ(entries[1].get_message(), "second\n  at frame_3");
+    EXPECT_EQ(entries[2].get_message(), "third");
+}
+
+/**
+ * @test Verifies that batches carry accept bits for the filter set at the time they are emitted,
+ *       also when the filter changes while streaming.
+ */
+TEST_F(LogStreamWorkerTest, EvaluatesBatchesWithCurrentFilter)
+{
+    QTemporaryFile* file = create_temp_file({"Info one AppX", "Error two AppX", "Info three AppX",
+                                             "Error four AppX"});
+
+    LogFilter::Spec info_only;
+    info_only.levels = {"info"};
+    LogFilter::Spec errors_only;
+    errors_only.levels = {"error"};
+
+    QVector<LogFilter::BatchVerdicts> results;
+    QObject::connect(m_worker, &LogStreamWorker::entry_batch_parsed, m_worker,
+                     [this, &results, &errors_only](const QString&, const QVector<LogEntry>&,
+                                                    const LogFilter::BatchVerdicts& verdicts) {
+                         results.append(verdicts);
+                         m_worker->set_filter(errors_only);
+                     });
+
+    m_worker->set_filter(info_only);
+    m_worker->start(file->fileName(), 2);
+
+    ASSERT_EQ(results.size(), 2);
+    EXPECT_EQ(results[0].spec, info_only);
+    EXPECT_TRUE(results[0].accepted.testBit(0));
+    EXPECT_FALSE(results[0].accepted.testBit(1));
+    EXPECT_EQ(results[1].spec, errors_only);
+    EXPECT_FALSE(results[1].accepted.testBit(0));
+    EXPECT_TRUE(results[1].accepted.testBit(1));
+}
+
 /**
  * @test Verifies that an error signal is emitted when a file cannot be opened, and that
  *       finished is still emitted afterward. No progress is expected in this path.
@@ -303,3 +361,35 @@ TEST_F(LogStreamWorkerTest, CancelWhileStreamingStopsSoon)
     EXPECT_LT(total_entries, lines.size());
     EXPECT_FALSE(thread.isRunning());
 }
+
+/**
+ * @test Verifies that cancelling a shared token stops the stream at the next line and that
+ *       progress is reported to the token.
+ */
+TEST_F(LogStreamWorkerTest, SharedTokenCancelsMidStream)
+{
+    QVector<QString> lines;
+    lines.reserve(5000);
+    for (int i = 0; i < 5000; ++i)
+    {
+        lines.append(QStringLiteral("Info payload_%1 AppZ").arg(i));
+    }
+
+    QTemporaryFile* file = create_temp_file(lines);
+    const TaskToken token;
+    LogStreamWorker worker(LogParser(m_format), token);
+
+    int total_entries = 0;
+    QObject::connect(&worker, &LogStreamWorker::entry_batch_parsed, &worker,
+                     [&total_entries, token](const QString&, const QVector<LogEntry>& batch) {
+                         total_entries += batch.size();
+                         token.cancel();
+                     });
+
+    worker.start(file->fileName(), 100);
+
+    // One full batch plus at most the entry that was pending when the line loop stopped.
+    EXPECT_TRUE(token.is_cancelled());
+    EXPECT_LE(total_entries, 101);
+    EXPECT_GT(token.get_progress_total(), 0);
+}
@@ -0,0 +1,141 @@
+#include "Qt-LogViewer/Services/ReadAheadFileTest.h"
+
+#include <QFile>
+#include <QTemporaryFile>
+#include <QThread>
+
+#include "Qt-LogViewer/Services/LogLineReader.h"
+
+/**
+ * @brief Sets up the test fixture for each test.
+ */
+void ReadAheadFileTest::SetUp() {}
+
+/**
+ * @brief Tears down the test fixture after each test.
+ */
+void ReadAheadFileTest::TearDown()
+{
+    for (const auto& path: m_temp_files)
+    {
+        QFile::remove(path);
+    }
+    m_temp_files.clear();
+}
+
+/**
+ * @brief Writes the given raw bytes into a new temporary file.
+ * @param bytes Bytes to write.
+ * @return Absolute path of the created file.
+ */
+auto ReadAheadFileTest::write_temp_file(const QByteArray& bytes) -> QString
+{
+    QTemporaryFile temp_file;
+    temp_file.setAutoRemove(false);
+    EXPECT_TRUE(temp_file.open());
+    temp_file.write(bytes);
+    temp_file.close();
+
+    m_temp_files.append(temp_file.fileName());
+    return temp_file.fileName();
+}
+
+/**
+ * @test Reads in odd sizes return the file byte for byte across buffer boundaries.
+ */
+TEST_F(ReadAheadFileTest, ReadsWholeFileAcrossBuffers)
+{
+    QByteArray bytes;
+    for (int i = 0; i < 50000; ++i)
+    {
+        bytes += QByteArray::number(i * 7919);
+    }
+    const QString path = write_temp_file(bytes);
+
+    ReadAheadFile file(path, 3, 4096);
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+    EXPECT_EQ(file.get_file_size(), bytes.size());
+
+    QByteArray read_back;
+    while (!file.atEnd())
+    {
+        read_back += file.read(1000 + read_back.size() % 777);
+    }
+
+    EXPECT_EQ(read_back, bytes);
+    EXPECT_EQ(file.pos(), bytes.size());
+    EXPECT_EQ(file.get_stats().bytes_read, bytes.size());
+    EXPECT_TRUE(file.read(100).isEmpty());
+}
+
+/**
+ * @test A slow consumer makes the reader wait for free buffers instead of growing the pool.
+ */
+TEST_F(ReadAheadFileTest, SlowConsumerStallsReader)
+{
+    const QString path = write_temp_file(QByteArray(64 * 1024, 'x'));
+
+    ReadAheadFile file(path, 2, 4096);
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+
+    qint64 total = 0;
+    while (!file.atEnd())
+    {
+        QThread::msleep(1);
+        total += file.read(4096).size();
+    }
+
+    const auto stats = file.get_stats();
+    EXPECT_EQ(total, 64 * 1024);
+    EXPECT_GT(stats.reader_stalls, 0);
+    EXPECT_GT(stats.reader_stall_ns, 0);
+    RecordProperty("reader_stalls", static_cast<int>(stats.reader_stalls));
+    RecordProperty("consumer_stalls", static_cast<int>(stats.consumer_stalls));
+}
+
+/**
+ * @test Closing with a full pool stops the blocked reader thread.
+ */
+TEST_F(ReadAheadFileTest, CloseStopsBlockedReader)
+{
+    const QString path = write_temp_file(QByteArray(1024 * 1024, 'y'));
+
+    ReadAheadFile file(path, 2, 4096);
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+    EXPECT_EQ(file.read(10), QByteArray(10, 'y'));
+
+    file.close();
+    EXPECT_FALSE(file.isOpen());
+}
+
+/**
+ * @test Missing files fail to open.
+ */
+TEST_F(ReadAheadFileTest, MissingFileFailsToOpen)
+{
+    ReadAheadFile file(QStringLiteral("does/not/exist.log"));
+    EXPECT_FALSE(file.open(QIODevice::ReadOnly));
+    EXPECT_FALSE(file.errorString().isEmpty());
+}
+
+/**
+ * @test LogLineReader can peek the BOM and read lines from the device.
+ */
+TEST_F(ReadAheadFileTest, FeedsLogLineReader)
+{
+    const QString path = write_temp_file(QByteArray("\xEF\xBB\xBF") + "first\r\nsecond\nthird");
+
+    ReadAheadFile file(path, 2, 8);
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+    LogLineReader reader(&file);
+
+    QStringList lines;
+    QString line;
+    while (reader.read_line(line))
+    {
+        lines.append(line);
+    }
+
+    EXPECT_EQ(lines, QStringList({"first", "second", "third"}));
+    EXPECT_EQ(reader.get_position(), file.get_file_size());
+}
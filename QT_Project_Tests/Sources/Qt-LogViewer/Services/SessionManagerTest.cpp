@@ -0,0 +1,251 @@
+#include "Qt-LogViewer/Services/SessionManagerTest.h"
+
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QSignalSpy>
+#include <QStandardPaths>
+#include <QTest>
+#include <QUuid>
+
+#include "Qt-LogViewer/Models/LogFileInfo.h"
+#include "Qt-LogViewer/Services/StartupProfiler.h"
+
+/**
+ * @brief Sets up a manager with an isolated repository and a long debounce delay.
+ */
+void SessionManagerTest::SetUp()
+{
+    m_subdir = QStringLiteral("Qt-LogViewer-Test-%1")
+                   .arg(QUuid::createUuid().toString(QUuid::WithoutBraces));
+    auto repository = std::make_unique<SessionRepository>(m_subdir);
+    m_repo = repository.get();
+    m_manager = new SessionManager(std::move(repository));
+
+    // Keep the timer out of the way; tests flush explicitly.
+    m_manager->set_flush_delay(60 * 60 * 1000);
+}
+
+/**
+ * @brief Tears down the manager (which owns the repository) and removes the test directory.
+ */
+void SessionManagerTest::TearDown()
+{
+    delete m_manager;
+    m_manager = nullptr;
+    m_repo = nullptr;
+
+    QDir(get_base_dir()).removeRecursively();
+}
+
+/**
+ * @brief Replaces the manager by a new one on the same directory, as on an application start.
+ */
+auto SessionManagerTest::restart_manager() -> void
+{
+    delete m_manager;
+
+    auto repository = std::make_unique<SessionRepository>(m_subdir);
+    m_repo = repository.get();
+    m_manager = new SessionManager(std::move(repository));
+    m_manager->set_flush_delay(60 * 60 * 1000);
+}
+
+/**
+ * @brief Computes the absolute base directory path used by the current repository.
+ */
+auto SessionManagerTest::get_base_dir() const -> QString
+{
+    const QString base = QStandardPaths::writableLocation(QStandardPaths::AppConfigLocation);
+    return QDir(base).filePath(m_subdir);
+}
+
+/**
+ * @brief Saved sessions are served from memory and only written as snapshot on flush().
+ */
+TEST_F(SessionManagerTest, SaveSessionIsDeferredUntilFlush)
+{
+    const QString sid = QStringLiteral("S1");
+    const QJsonObject obj{{QStringLiteral("id"), sid}, {QStringLiteral("name"), "First"}};
+
+    m_manager->save_session(sid, obj);
+
+    EXPECT_TRUE(m_manager->is_session_dirty(sid));
+    EXPECT_TRUE(m_manager->has_pending_writes());
+    EXPECT_EQ(m_manager->load_session(sid), obj);
+    EXPECT_EQ(m_manager->get_session_name(sid), "First");
+
+    m_manager->flush();
+
+    EXPECT_FALSE(m_manager->has_pending_writes());
+    EXPECT_TRUE(QFile::exists(m_repo->get_session_file_path(sid)));
+    EXPECT_FALSE(QFile::exists(m_repo->get_session_journal_path(sid)));
+    EXPECT_EQ(m_repo->load_session(sid).value(QStringLiteral("name")).toString(), "First");
+}
+
+/**
+ * @brief Saving an unchanged session does not mark it dirty again.
+ */
+TEST_F(SessionManagerTest, UnchangedSessionIsNotDirty)
+{
+    const QString sid = QStringLiteral("S2");
+    const QJsonObject obj{{QStringLiteral("id"), sid}, {QStringLiteral("views"), 0}};
+
+    m_manager->save_session(sid, obj);
+    m_manager->flush();
+
+    m_manager->save_session(sid, obj);
+    EXPECT_FALSE(m_manager->is_session_dirty(sid));
+
+    QJsonObject changed = obj;
+    changed.insert(QStringLiteral("views"), 1);
+    m_manager->save_session(sid, changed);
+    EXPECT_TRUE(m_manager->is_session_dirty(sid));
+}
+
+/**
+ * @brief Root changes are coalesced and written once on flush.
+ */
+TEST_F(SessionManagerTest, RootChangesAreCoalesced)
+{
+    for (int i = 0; i < 20; ++i)
+    {
+        m_manager->add_recent_log_file(LogFileInfo(QStringLiteral("/tmp/file_%1.log").arg(i)));
+    }
+
+    EXPECT_TRUE(m_manager->has_pending_writes());
+    EXPECT_FALSE(QFile::exists(m_repo->get_root_file_path()));
+
+    m_manager->flush();
+
+    EXPECT_TRUE(QFile::exists(m_repo->get_root_file_path()));
+    EXPECT_EQ(m_repo->load_all().value(QStringLiteral("recent_files")).toArray().size(), 20);
+}
+
+/**
+ * @brief Deleting a session that was never flushed leaves no files behind.
+ */
+TEST_F(SessionManagerTest, DeleteDropsPendingSession)
+{
+    const QString sid = QStringLiteral("S3");
+    m_manager->upsert_session_metadata(sid, QStringLiteral("Third"), true);
+    m_manager->save_session(sid, QJsonObject{{QStringLiteral("id"), sid}});
+
+    EXPECT_TRUE(m_manager->delete_session(sid));
+    m_manager->flush();
+
+    EXPECT_FALSE(QFile::exists(m_repo->get_session_file_path(sid)));
+    EXPECT_FALSE(QFile::exists(m_repo->get_session_journal_path(sid)));
+    EXPECT_TRUE(m_manager->load_session(sid).isEmpty());
+}
+
+/**
+ * @brief The asynchronous load applies the stored lists without blocking the caller.
+ */
+TEST_F(SessionManagerTest, AsyncLoadAppliesStoredLists)
+{
+    m_manager->add_recent_log_file(LogFileInfo(QStringLiteral("/tmp/stored.log")));
+    m_manager->upsert_session_metadata(QStringLiteral("S4"), QStringLiteral("Fourth"), true);
+    m_manager->set_last_session_id(QStringLiteral("S4"));
+    m_manager->flush();
+
+    restart_manager();
+
+    QSignalSpy files_spy(m_manager, &SessionManager::recent_log_files_changed);
+    m_manager->initialize_from_storage_async();
+
+    // The result is delivered through the event loop, never within the call.
+    EXPECT_FALSE(m_manager->is_storage_loaded());
+
+    ASSERT_TRUE(QTest::qWaitFor([this]() { return m_manager->is_storage_loaded(); }));
+
+    EXPECT_EQ(files_spy.count(), 1);
+    ASSERT_EQ(m_manager->get_recent_log_files().size(), 1);
+    EXPECT_EQ(m_manager->get_recent_log_files().first().file_path, "/tmp/stored.log");
+    EXPECT_EQ(m_manager->get_recent_sessions().size(), 1);
+    EXPECT_EQ(m_manager->get_last_session_id(), "S4");
+}
+
+/**
+ * @brief Reading the recent lists while the asynchronous load is pending waits for the stored
+ *        items instead of returning the empty initial state.
+ */
+TEST_F(SessionManagerTest, ReadBeforeAsyncLoadReturnsStoredItems)
+{
+    m_manager->add_recent_log_file(LogFileInfo(QStringLiteral("/tmp/stored.log")));
+    m_manager->upsert_session_metadata(QStringLiteral("S5"), QStringLiteral("Fifth"), true);
+    m_manager->set_last_session_id(QStringLiteral("S5"));
+    m_manager->flush();
+
+    restart_manager();
+
+    m_manager->initialize_from_storage_async();
+    ASSERT_EQ(m_manager->get_recent_log_files().size(), 1);
+    EXPECT_TRUE(m_manager->is_storage_loaded());
+    EXPECT_EQ(m_manager->get_recent_sessions().size(), 1);
+    EXPECT_EQ(m_manager->get_last_session_id(), "S5");
+}
+
+/**
+ * @brief A change made before the asynchronous load arrives is applied on top of the stored
+ *        lists.
+ */
+TEST_F(SessionManagerTest, ChangeBeforeAsyncLoadKeepsStoredItems)
+{
+    m_manager->add_recent_log_file(LogFileInfo(QStringLiteral("/tmp/stored.log")));
+    m_manager->flush();
+
+    restart_manager();
+
+    m_manager->initialize_from_storage_async();
+    m_manager->add_recent_log_file(LogFileInfo(QStringLiteral("/tmp/new.log")));
+
+    EXPECT_TRUE(m_manager->is_storage_loaded());
+    ASSERT_EQ(m_manager->get_recent_log_files().size(), 2);
+    EXPECT_EQ(m_manager->get_recent_log_files().first().file_path, "/tmp/new.log");
+
+    // The queued background result must not replace the newer state.
+    QTest::qWait(50);
+    EXPECT_EQ(m_manager->get_recent_log_files().size(), 2);
+}
+
+/**
+ * @brief Startup benchmark: the recent items of a large root are loaded within the
+ *        time-to-interactive target.
+ *
+ * The profiler runs until the stored items are applied, so the load itself is timed, not only
+ * queueing it. The phase timings are attached to the test result as properties.
+ */
+TEST_F(SessionManagerTest, StartupBenchmarkLoadsRecentItems)
+{
+    constexpr int k_recent_file_count = 2000;
+
+    QJsonArray recent_files;
+    for (int i = 0; i < k_recent_file_count; ++i)
+    {
+        recent_files.append(QJsonObject{
+            {QStringLiteral("file_path"), QStringLiteral("/tmp/bench_%1.log").arg(i)},
+            {QStringLiteral("app_name"), QStringLiteral("bench")},
+            {QStringLiteral("last_opened"), QStringLiteral("2025-01-01T00:00:00.000")}});
+    }
+    m_repo->save_all(QJsonObject{{QStringLiteral("recent_files"), recent_files}});
+
+    restart_manager();
+
+    StartupProfiler profiler;
+    m_manager->initialize_from_storage_async();
+    profiler.mark(QStringLiteral("request"));
+
+    ASSERT_TRUE(QTest::qWaitFor([this]() { return m_manager->is_storage_loaded(); }, 10000));
+    profiler.mark(QStringLiteral("recent_items"));
+    profiler.finish_interactive();
+
+    const auto phases = profiler.get_phases();
+    ::testing::Test::RecordProperty("request_us",
+                                    static_cast<int>(phases.at(0).duration_ns / 1000));
+    ::testing::Test::RecordProperty("load_us", static_cast<int>(phases.at(1).duration_ns / 1000));
+
+    EXPECT_EQ(m_manager->get_recent_log_files().size(), k_recent_file_count);
+    EXPECT_TRUE(profiler.is_within_target());
+}
@@ -368,3 +368,85 @@ TEST_F(SessionRepositoryTest, SaveAllRoundTripRecentFilesAndSessions)
     EXPECT_TRUE(loaded.contains(QStringLiteral("schema_version")));
     EXPECT_GT(loaded.value(QStringLiteral("schema_version")).toInt(), 0);
 }
+
+/**
+ * @brief The newest complete journal line wins over the snapshot; a snapshot drops the journal.
+ */
+TEST_F(SessionRepositoryTest, JournalRecoversStateNewerThanSnapshot)
+{
+    ASSERT_NE(m_repo, nullptr);
+
+    const QString sid = QStringLiteral("S_journal");
+    m_repo->save_session(sid, QJsonObject{{QStringLiteral("rev"), 1}});
+    m_repo->append_session_journal(sid, QJsonObject{{QStringLiteral("rev"), 2}});
+    m_repo->append_session_journal(sid, QJsonObject{{QStringLiteral("rev"), 3}});
+
+    // Simulate a crash in the middle of writing a journal line.
+    QFile journal(m_repo->get_session_journal_path(sid));
+    ASSERT_TRUE(journal.open(QIODevice::WriteOnly | QIODevice::Append));
+    journal.write("{\"rev\":");
+    journal.close();
+
+    EXPECT_EQ(m_repo->load_session(sid).value(QStringLiteral("rev")).toInt(), 3);
+
+    m_repo->save_session(sid, QJsonObject{{QStringLiteral("rev"), 4}});
+    EXPECT_FALSE(QFile::exists(m_repo->get_session_journal_path(sid)));
+    EXPECT_EQ(m_repo->load_session(sid).value(QStringLiteral("rev")).toInt(), 4);
+}
+
+/**
+ * @brief Session files are written as compact (single-line) JSON.
+ */
+TEST_F(SessionRepositoryTest, SaveSessionWritesCompactJson)
+{
+    ASSERT_NE(m_repo, nullptr);
+
+    const QString sid = QStringLiteral("S_compact");
+    m_repo->save_session(sid, QJsonObject{{QStringLiteral("a"), 1}, {QStringLiteral("b"), 2}});
+
+    QFile file(m_repo->get_session_file_path(sid));
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+    EXPECT_FALSE(file.readAll().contains('\n'));
+}
+
+/**
+ * @brief A changed view is journaled as delta; replaying it on the snapshot restores the state.
+ */
+TEST_F(SessionRepositoryTest, JournalRecordsDeltas)
+{
+    ASSERT_NE(m_repo, nullptr);
+
+    const QString sid = QStringLiteral("S_delta");
+    const QString large(4096, QLatin1Char('x'));
+    const QJsonObject first_view{{QStringLiteral("id"), 1}, {QStringLiteral("title"), large}};
+    const QJsonObject second_view{{QStringLiteral("id"), 2}, {QStringLiteral("search"), "a"}};
+    const QJsonObject previous{{QStringLiteral("name"), "Session"},
+                               {QStringLiteral("active_view_id"), 1},
+                               {QStringLiteral("views"), QJsonArray{first_view, second_view}}};
+    m_repo->save_session(sid, previous);
+
+    QJsonObject changed_view = second_view;
+    changed_view.insert(QStringLiteral("search"), "b");
+    QJsonObject current = previous;
+    current.insert(QStringLiteral("views"), QJsonArray{first_view, changed_view});
+    current.remove(QStringLiteral("active_view_id"));
+
+    m_repo->append_session_journal_delta(sid, previous, current);
+
+    QFile journal(m_repo->get_session_journal_path(sid));
+    ASSERT_TRUE(journal.open(QIODevice::ReadOnly));
+    const QByteArray line = journal.readAll();
+    journal.close();
+    EXPECT_LT(line.size(), 256);
+    EXPECT_FALSE(line.contains(large.toLatin1()));
+
+    QJsonObject expected = current;
+    expected.insert(QStringLiteral("schema_version"), SessionRepository::get_schema_version());
+    EXPECT_EQ(m_repo->load_session(sid), expected);
+
+    // Arrays that change size are replaced as a whole.
+    const QJsonObject shrunk{{QStringLiteral("views"), QJsonArray{first_view}}};
+    const QJsonObject delta = SessionRepository::make_session_delta(current, shrunk);
+    EXPECT_EQ(SessionRepository::apply_session_delta(current, delta), shrunk);
+    EXPECT_TRUE(SessionRepository::make_session_delta(shrunk, shrunk).isEmpty());
+}
@@ -0,0 +1,66 @@
+#include "Qt-LogViewer/Services/StartupProfilerTest.h"
+
+#include <QThread>
+
+/**
+ * @brief Sets up the test fixture for each test.
+ */
+void StartupProfilerTest::SetUp() {}
+
+/**
+ * @brief Tears down the test fixture after each test.
+ */
+void StartupProfilerTest::TearDown() {}
+
+/**
+ * @brief Phases are kept in order and their durations add up to the last end time.
+ */
+TEST_F(StartupProfilerTest, MarksPhasesInOrder)
+{
+    StartupProfiler profiler;
+
+    profiler.mark(QStringLiteral("ui"));
+    QThread::msleep(2);
+    profiler.mark(QStringLiteral("docks"));
+    profiler.mark(QStringLiteral("menu"));
+
+    const auto phases = profiler.get_phases();
+    ASSERT_EQ(phases.size(), 3);
+    EXPECT_EQ(phases.at(0).name, "ui");
+    EXPECT_EQ(phases.at(1).name, "docks");
+    EXPECT_EQ(phases.at(2).name, "menu");
+
+    qint64 total_ns = 0;
+    for (const auto& phase: phases)
+    {
+        EXPECT_GE(phase.duration_ns, 0);
+        total_ns += phase.duration_ns;
+    }
+    EXPECT_EQ(total_ns, phases.last().end_ns);
+    EXPECT_GE(phases.at(1).duration_ns, 2 * 1000 * 1000);
+
+    EXPECT_TRUE(profiler.get_summary().startsWith(QStringLiteral("ui ")));
+}
+
+/**
+ * @brief The time to interactive is recorded once and checked against the target.
+ */
+TEST_F(StartupProfilerTest, TimeToInteractiveIsRecordedOnce)
+{
+    StartupProfiler profiler;
+
+    EXPECT_FALSE(profiler.is_interactive());
+    EXPECT_EQ(profiler.get_time_to_interactive_ms(), -1);
+    EXPECT_FALSE(profiler.is_within_target());
+
+    profiler.finish_interactive();
+    const qint64 time_to_interactive_ms = profiler.get_time_to_interactive_ms();
+
+    QThread::msleep(5);
+    profiler.finish_interactive();
+
+    EXPECT_TRUE(profiler.is_interactive());
+    EXPECT_EQ(profiler.get_time_to_interactive_ms(), time_to_interactive_ms);
+    EXPECT_TRUE(profiler.is_within_target());
+    EXPECT_TRUE(profiler.get_summary().contains(QStringLiteral("interactive after")));
+}
@@ -0,0 +1,48 @@
+#include "Qt-LogViewer/Services/StorageDeviceTest.h"
+
+#include <QFile>
+
+/**
+ * @brief Sets up the test fixture before each test.
+ */
+void StorageDeviceTest::SetUp()
+{
+    ASSERT_TRUE(m_temp_dir.isValid());
+}
+
+/**
+ * @brief Tears down the test fixture after each test.
+ */
+void StorageDeviceTest::TearDown() {}
+
+/**
+ * @test Files in one directory share a device; missing files map to their directory's device.
+ */
+TEST_F(StorageDeviceTest, FilesInOneDirectoryShareDevice)
+{
+    const QString existing = m_temp_dir.filePath("a.log");
+    QFile file(existing);
+    ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+    file.write("line\n");
+    file.close();
+
+    const auto first = StorageDevice::probe(existing);
+    const auto second = StorageDevice::probe(m_temp_dir.filePath("missing.log"));
+
+    EXPECT_EQ(first.key, second.key);
+    EXPECT_EQ(first.sequential, second.sequential);
+    EXPECT_FALSE(first.name.isEmpty());
+}
+
+/**
+ * @test Network file system types are recognized case-insensitively.
+ */
+TEST_F(StorageDeviceTest, RecognizesNetworkFileSystems)
+{
+    EXPECT_TRUE(StorageDevice::is_network_file_system("nfs4"));
+    EXPECT_TRUE(StorageDevice::is_network_file_system("CIFS"));
+    EXPECT_TRUE(StorageDevice::is_network_file_system("fuse.sshfs"));
+    EXPECT_FALSE(StorageDevice::is_network_file_system("ext4"));
+    EXPECT_FALSE(StorageDevice::is_network_file_system("apfs"));
+    EXPECT_FALSE(StorageDevice::is_network_file_system(""));
+}
@@ -0,0 +1,173 @@
+#include "Qt-LogViewer/Services/TaskRegistryTest.h"
+
+#include <QElapsedTimer>
+#include <QSignalSpy>
+#include <QTest>
+#include <QThread>
+#include <QUuid>
+
+/**
+ * @brief Sets up the test fixture for each test.
+ */
+void TaskRegistryTest::SetUp()
+{
+    m_registry = new TaskRegistry();
+}
+
+/**
+ * @brief Tears down the test fixture after each test.
+ */
+void TaskRegistryTest::TearDown()
+{
+    delete m_registry;
+    m_registry = nullptr;
+}
+
+/**
+ * @brief Copies of a token share cancellation and progress.
+ */
+TEST_F(TaskRegistryTest, TokenCopiesShareState)
+{
+    const TaskToken token;
+    const TaskToken copy = token;
+
+    EXPECT_FALSE(copy.is_cancelled());
+    EXPECT_EQ(token.get_id(), 0U);
+
+    copy.set_progress(5, 10);
+    token.cancel();
+
+    EXPECT_TRUE(copy.is_cancelled());
+    EXPECT_EQ(token.get_progress_done(), 5);
+    EXPECT_EQ(token.get_progress_total(), 10);
+    EXPECT_FALSE(TaskToken().is_cancelled());
+}
+
+/**
+ * @brief Cancelling an owner only cancels that owner's tasks; ending removes them.
+ */
+TEST_F(TaskRegistryTest, CancelOwnerCancelsOnlyItsTasks)
+{
+    const QUuid view_a = QUuid::createUuid();
+    const QUuid view_b = QUuid::createUuid();
+    QSignalSpy finished_spy(m_registry, &TaskRegistry::task_finished);
+
+    const TaskToken load_a = m_registry->begin_task("Loading a.log", view_a);
+    const TaskToken index_a = m_registry->begin_task("Indexing", view_a);
+    const TaskToken load_b = m_registry->begin_task("Loading b.log", view_b);
+
+    EXPECT_NE(load_a.get_id(), index_a.get_id());
+    EXPECT_EQ(m_registry->get_task_count(), 3);
+    EXPECT_EQ(m_registry->cancel_owner(view_a), 2);
+    EXPECT_EQ(m_registry->cancel_owner(view_a), 0);
+
+    EXPECT_TRUE(load_a.is_cancelled());
+    EXPECT_TRUE(index_a.is_cancelled());
+    EXPECT_FALSE(load_b.is_cancelled());
+
+    m_registry->end_task(load_a);
+    m_registry->end_task(load_a);
+    m_registry->end_task(TaskToken());
+
+    ASSERT_EQ(finished_spy.count(), 1);
+    EXPECT_EQ(finished_spy.at(0).at(0).toULongLong(), load_a.get_id());
+    EXPECT_TRUE(finished_spy.at(0).at(1).toBool());
+
+    const auto tasks = m_registry->get_tasks();
+    ASSERT_EQ(tasks.size(), 2);
+    EXPECT_EQ(tasks.at(0).name, "Indexing");
+    EXPECT_TRUE(tasks.at(0).cancelled);
+    EXPECT_EQ(tasks.at(1).owner, view_b);
+
+    EXPECT_EQ(m_registry->cancel_all(), 1);
+    EXPECT_TRUE(load_b.is_cancelled());
+}
+
+/**
+ * @brief Progress written by a worker thread is reported by polling.
+ */
+TEST_F(TaskRegistryTest, ReportsProgressFromWorkerThread)
+{
+    QSignalSpy progress_spy(m_registry, &TaskRegistry::task_progress);
+    const TaskToken token = m_registry->begin_task("Counting");
+
+    QThread* worker = QThread::create([token]() {
+        qint64 done = 0;
+        while (!token.is_cancelled() && done < 1000)
+        {
+            ++done;
+            token.set_progress(done, 1000);
+        }
+    });
+    worker->start();
+    worker->wait();
+    delete worker;
+
+    ASSERT_TRUE(QTest::qWaitFor([&progress_spy]() { return progress_spy.count() > 0; },
+                                10 * TaskRegistry::get_poll_interval_ms()));
+
+    const QList<QVariant> last = progress_spy.last();
+    EXPECT_EQ(last.at(0).toULongLong(), token.get_id());
+    EXPECT_EQ(last.at(1).toLongLong(), 1000);
+    EXPECT_EQ(last.at(2).toLongLong(), 1000);
+
+    // Unchanged progress is not reported again.
+    const int reports = progress_spy.count();
+    QTest::qWait(3 * TaskRegistry::get_poll_interval_ms());
+    EXPECT_EQ(progress_spy.count(), reports);
+}
+
+/**
+ * @brief A cancelled worker stops at its next check, well within a few milliseconds.
+ */
+TEST_F(TaskRegistryTest, CancelStopsWorkerPromptly)
+{
+    const QUuid view_id = QUuid::createUuid();
+    const TaskToken token = m_registry->begin_task("Spinning", view_id);
+
+    QThread* worker = QThread::create([token]() {
+        qint64 chunks = 0;
+        while (!token.is_cancelled())
+        {
+            ++chunks;
+            token.set_progress(chunks, 0);
+        }
+    });
+    worker->start();
+    QTest::qWaitFor([&token]() { return token.get_progress_done() > 0; }, 1000);
+
+    QElapsedTimer timer;
+    timer.start();
+    m_registry->cancel_owner(view_id);
+    const bool stopped = worker->wait(1000);
+    const qint64 elapsed_ms = timer.elapsed();
+    delete worker;
+
+    EXPECT_TRUE(stopped);
+    EXPECT_LT(elapsed_ms, 100);
+    RecordProperty("cancel_to_stop_ms", static_cast<int>(elapsed_ms));
+}
+
+/**
+ * @brief A task whose token was dropped by everyone but the registry ends on the next poll.
+ */
+TEST_F(TaskRegistryTest, AbandonedTaskEndsOnNextPoll)
+{
+    QSignalSpy finished_spy(m_registry, &TaskRegistry::task_finished);
+    const TaskToken kept = m_registry->begin_task("Kept");
+    quint64 dropped_id = 0;
+
+    {
+        const TaskToken dropped = m_registry->begin_task("Dropped");
+        dropped_id = dropped.get_id();
+        dropped.cancel();
+    }
+
+    ASSERT_TRUE(QTest::qWaitFor([&finished_spy]() { return finished_spy.count() > 0; },
+                                10 * TaskRegistry::get_poll_interval_ms()));
+
+    EXPECT_EQ(finished_spy.at(0).at(0).toULongLong(), dropped_id);
+    EXPECT_TRUE(finished_spy.at(0).at(1).toBool());
+    ASSERT_EQ(m_registry->get_task_count(), 1);
+    EXPECT_EQ(m_registry->get_tasks().first().id, kept.get_id());
+}
@@ -0,0 +1,76 @@
+#include "Qt-LogViewer/Views/App/ColumnWidthSamplerTest.h"
+
+#include <QFont>
+#include <QFontMetrics>
+#include <QStandardItem>
+
+/**
+ * @brief Fills a two-column model with short texts and one long text per column.
+ */
+void ColumnWidthSamplerTest::SetUp()
+{
+    m_model.setColumnCount(2);
+
+    for (int row = 0; row < 100; ++row)
+    {
+        m_model.appendRow({new QStandardItem("short"), new QStandardItem("x")});
+    }
+
+    m_model.setData(m_model.index(99, 0), QStringLiteral("a considerably longer text"));
+    m_model.setData(m_model.index(49, 1), QStringLiteral("wide second column"));
+
+    m_sampler.set_font_metrics(QFontMetrics(QFont()));
+}
+
+/**
+ * @brief Stratified rows are bounded, ascending and include both ends of the range.
+ */
+TEST_F(ColumnWidthSamplerTest, StratifiedRowsCoverTheRange)
+{
+    const QVector<int> rows = ColumnWidthSampler::stratified_rows(10, 1009, 5);
+    EXPECT_EQ(rows, (QVector<int>{10, 259, 509, 759, 1009}));
+
+    EXPECT_EQ(ColumnWidthSampler::stratified_rows(3, 5, 10), (QVector<int>{3, 4, 5}));
+    EXPECT_EQ(ColumnWidthSampler::stratified_rows(7, 7, 10), (QVector<int>{7}));
+    EXPECT_TRUE(ColumnWidthSampler::stratified_rows(0, -1, 10).isEmpty());
+    EXPECT_TRUE(ColumnWidthSampler::stratified_rows(0, 100, 0).isEmpty());
+}
+
+/**
+ * @brief The widest sampled text of each column is kept.
+ */
+TEST_F(ColumnWidthSamplerTest, KeepsWidestSampledText)
+{
+    const QFontMetrics metrics{QFont()};
+
+    m_sampler.sample_rows(m_model, {0, 1, 2});
+    EXPECT_EQ(m_sampler.get_content_width(0), metrics.horizontalAdvance("short"));
+    EXPECT_EQ(m_sampler.get_sampled_row_count(), 3);
+
+    // The range sample includes the last row and, with three strata, the middle one.
+    m_sampler.sample_range(m_model, 0, 99, 3);
+    EXPECT_EQ(m_sampler.get_content_width(0),
+              metrics.horizontalAdvance("a considerably longer text"));
+    EXPECT_EQ(m_sampler.get_content_width(1), metrics.horizontalAdvance("wide second column"));
+    EXPECT_EQ(m_sampler.get_sampled_row_count(), 6);
+
+    // Rows outside the model are ignored.
+    m_sampler.sample_rows(m_model, {-1, 1000});
+    EXPECT_EQ(m_sampler.get_sampled_row_count(), 6);
+
+    m_sampler.reset();
+    EXPECT_EQ(m_sampler.get_content_width(0), 0);
+    EXPECT_EQ(m_sampler.get_sampled_row_count(), 0);
+}
+
+/**
+ * @brief Skipped columns are never measured.
+ */
+TEST_F(ColumnWidthSamplerTest, SkippedColumnsAreNotMeasured)
+{
+    m_sampler.set_skipped_columns({1});
+    m_sampler.sample_range(m_model, 0, 99, 100);
+
+    EXPECT_GT(m_sampler.get_content_width(0), 0);
+    EXPECT_EQ(m_sampler.get_content_width(1), 0);
+}
@@ -0,0 +1,143 @@
+#include "Qt-LogViewer/Views/App/LevelDensityMinimapTest.h"
+
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QImage>
+#include <QSignalSpy>
+#include <QTest>
+#include <QVector>
+
+#include "Qt-LogViewer/Models/LogEntry.h"
+#include "Qt-LogViewer/Models/LogFileInfo.h"
+
+/**
+ * @brief Sets up the model chain, the summary and the minimap.
+ */
+void LevelDensityMinimapTest::SetUp()
+{
+    m_model = new LogModel();
+    m_proxy = new LogSortFilterProxyModel();
+    m_proxy->setSourceModel(m_model);
+    m_summary = new LevelDensitySummary();
+    m_summary->set_model(m_proxy);
+    m_minimap = new LevelDensityMinimap();
+    m_minimap->set_summary(m_summary);
+    m_minimap->resize(14, 100);
+}
+
+/**
+ * @brief Tears down the minimap, the summary and the model chain.
+ */
+void LevelDensityMinimapTest::TearDown()
+{
+    delete m_minimap;
+    delete m_summary;
+    delete m_proxy;
+    delete m_model;
+    m_minimap = nullptr;
+    m_summary = nullptr;
+    m_proxy = nullptr;
+    m_model = nullptr;
+}
+
+/**
+ * @brief Appends entries of one level to the model and waits for the summary.
+ */
+auto LevelDensityMinimapTest::add_entries(int count, const QString& level) -> void
+{
+    const QDateTime base = QDateTime::fromString("2024-01-01 10:00:00", "yyyy-MM-dd HH:mm:ss");
+    QVector<LogEntry> entries;
+    entries.reserve(count);
+
+    for (int i = 0; i < count; ++i)
+    {
+        entries.append(LogEntry(base.addSecs(m_model->rowCount() + i), level,
+                                QStringLiteral("Message %1").arg(i),
+                                LogFileInfo("a.log", "App")));
+    }
+
+    m_model->add_entries(entries);
+    ASSERT_TRUE(QTest::qWaitFor([this]() { return !m_summary->is_rebuilding(); }, 5000));
+}
+
+/**
+ * @brief An empty view maps to no row.
+ */
+TEST_F(LevelDensityMinimapTest, EmptyViewHasNoRows)
+{
+    EXPECT_EQ(m_minimap->row_at(50), -1);
+
+    const QImage image = m_minimap->render_image(QSize(14, 100));
+    EXPECT_EQ(qAlpha(image.pixel(5, 50)), 0);
+}
+
+/**
+ * @brief Pixel rows map proportionally to view rows, clamped to the view.
+ */
+TEST_F(LevelDensityMinimapTest, RowAtMapsProportionally)
+{
+    add_entries(1000, "INFO");
+
+    EXPECT_EQ(m_minimap->row_at(0), 5);
+    EXPECT_EQ(m_minimap->row_at(50), 505);
+    EXPECT_EQ(m_minimap->row_at(99), 995);
+    EXPECT_EQ(m_minimap->row_at(500), 999);
+    EXPECT_EQ(m_minimap->row_at(-10), 0);
+}
+
+/**
+ * @brief A press on the strip requests the row under the cursor.
+ */
+TEST_F(LevelDensityMinimapTest, ClickRequestsRow)
+{
+    add_entries(200, "DEBUG");
+    m_minimap->show();
+    QSignalSpy spy(m_minimap, &LevelDensityMinimap::row_requested);
+
+    QTest::mouseClick(m_minimap, Qt::LeftButton, Qt::NoModifier, QPoint(5, 25));
+
+    ASSERT_EQ(spy.count(), 1);
+    EXPECT_EQ(spy.at(0).at(0).toInt(), m_minimap->row_at(25));
+}
+
+/**
+ * @brief Severe levels win over frequent ones in the pixel row they fall into.
+ */
+TEST_F(LevelDensityMinimapTest, SevereLevelsAreShown)
+{
+    add_entries(500, "INFO");
+    add_entries(1, "ERROR");
+    add_entries(499, "INFO");
+
+    const QImage image = m_minimap->render_image(QSize(14, 100));
+
+    // Row 500 lands in pixel row 50 (red); the other pixel rows only hold info rows (blue).
+    const QRgb error_pixel = qUnpremultiply(image.pixel(5, 50));
+    const QRgb info_pixel = qUnpremultiply(image.pixel(5, 10));
+    EXPECT_GT(qRed(error_pixel), qBlue(error_pixel));
+    EXPECT_GT(qBlue(info_pixel), qRed(info_pixel));
+    EXPECT_GT(qAlpha(error_pixel), 0);
+}
+
+/**
+ * @brief Rendering a large view takes well under a millisecond.
+ */
+TEST_F(LevelDensityMinimapTest, RenderIsFast)
+{
+    add_entries(200000, "INFO");
+    add_entries(5000, "ERROR");
+
+    constexpr int k_renders = 200;
+    QElapsedTimer timer;
+    timer.start();
+
+    for (int i = 0; i < k_renders; ++i)
+    {
+        const QImage image = m_minimap->render_image(QSize(14, 800));
+        EXPECT_FALSE(image.isNull());
+    }
+
+    const double average_ms = static_cast<double>(timer.nsecsElapsed()) / k_renders / 1.0e6;
+    RecordProperty("render_average_us", static_cast<int>(average_ms * 1000.0));
+    EXPECT_LT(average_ms, 1.0);
+}
@@ -0,0 +1,220 @@
+#include "Qt-LogViewer/Views/App/LogDetailsWidgetTest.h"
+
+#include <QApplication>
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QPlainTextEdit>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include "Qt-LogViewer/Models/LogFileInfo.h"
+
+/**
+ * @brief Creates and shows the widget.
+ */
+void LogDetailsWidgetTest::SetUp()
+{
+    m_widget = new LogDetailsWidget();
+    m_widget->resize(640, 240);
+    m_widget->show();
+    QApplication::processEvents();
+}
+
+/**
+ * @brief Deletes the widget.
+ */
+void LogDetailsWidgetTest::TearDown()
+{
+    delete m_widget;
+    m_widget = nullptr;
+}
+
+/**
+ * @brief Builds an entry with the given UTF-8 message.
+ */
+auto LogDetailsWidgetTest::make_entry(const QByteArray& message) -> LogEntry
+{
+    LogEntry entry(QDateTime::fromString("2024-01-01 10:00:00", "yyyy-MM-dd HH:mm:ss"), "INFO",
+                   QString(), LogFileInfo("a.log", "App"));
+    entry.set_message_utf8(message);
+    return entry;
+}
+
+/**
+ * @brief Builds a compact JSON array of roughly the given size.
+ */
+auto LogDetailsWidgetTest::make_json(qsizetype size) -> QByteArray
+{
+    QByteArray json("[");
+
+    while (json.size() < size)
+    {
+        json += (json.size() > 1) ? "," : "";
+        json += R"({"id":12345,"name":"payload","ok":true})";
+    }
+
+    return json + "]";
+}
+
+/**
+ * @brief Small messages are shown completely together with the entry fields.
+ */
+TEST_F(LogDetailsWidgetTest, SmallMessageIsShownCompletely)
+{
+    m_widget->set_entry(make_entry("Hello world"));
+
+    const QString text = m_widget->get_text_edit()->toPlainText();
+    EXPECT_TRUE(text.contains("Level: INFO"));
+    EXPECT_TRUE(text.contains("App: App"));
+    EXPECT_TRUE(text.endsWith("Message: Hello world"));
+    EXPECT_EQ(m_widget->get_loaded_message_size(), m_widget->get_message_size());
+
+    m_widget->clear();
+    EXPECT_TRUE(m_widget->get_text_edit()->toPlainText().isEmpty());
+}
+
+/**
+ * @brief Large messages are decoded one chunk at a time, never splitting a UTF-8 sequence.
+ */
+TEST_F(LogDetailsWidgetTest, LargeMessageIsLoadedInChunks)
+{
+    // Two-byte characters, so an even chunk size would split one if not handled.
+    const QByteArray message = QString(3 * 1024 * 1024, QChar(0x00e9)).toUtf8().prepend('x');
+    m_widget->set_entry(make_entry(message));
+
+    EXPECT_EQ(m_widget->get_message_size(), message.size());
+    EXPECT_LE(m_widget->get_loaded_message_size(), LogDetailsWidget::get_chunk_size());
+    EXPECT_FALSE(m_widget->get_text_edit()->toPlainText().contains(QChar::ReplacementCharacter));
+
+    const qsizetype first_chunk = m_widget->get_loaded_message_size();
+    EXPECT_TRUE(m_widget->load_next_chunk());
+    EXPECT_GT(m_widget->get_loaded_message_size(), first_chunk);
+    EXPECT_FALSE(m_widget->get_text_edit()->toPlainText().contains(QChar::ReplacementCharacter));
+
+    bool has_more = true;
+    while (has_more)
+    {
+        has_more = m_widget->load_next_chunk();
+    }
+    EXPECT_EQ(m_widget->get_loaded_message_size(), message.size());
+}
+
+/**
+ * @brief JSON and XML payloads are re-indented; other messages are left alone.
+ */
+TEST_F(LogDetailsWidgetTest, PrettyPrintFormatsJsonAndXml)
+{
+    const QByteArray json = LogDetailsWidget::pretty_print(R"(Response: {"a":1,"b":[1,2]})");
+    EXPECT_TRUE(json.startsWith("Response:\n{"));
+    EXPECT_TRUE(json.contains("\n    \"a\": 1"));
+
+    const QByteArray tagged = LogDetailsWidget::pretty_print(R"([main] {"a":1})");
+    EXPECT_TRUE(tagged.startsWith("[main]\n{"));
+
+    const QByteArray xml = LogDetailsWidget::pretty_print("<root><child>text</child></root>");
+    EXPECT_TRUE(xml.contains("\n  <child>text</child>"));
+
+    EXPECT_TRUE(LogDetailsWidget::pretty_print("No payload here").isEmpty());
+    EXPECT_TRUE(LogDetailsWidget::pretty_print("Broken {\"a\":").isEmpty());
+    EXPECT_TRUE(LogDetailsWidget::pretty_print("a < b and c > d").isEmpty());
+}
+
+/**
+ * @brief Large payloads are formatted on the worker and shown when done.
+ */
+TEST_F(LogDetailsWidgetTest, LargePayloadIsPrettyPrintedOnWorker)
+{
+    m_widget->set_pretty_print_enabled(true);
+
+    const QByteArray json = make_json(512 * 1024);
+    m_widget->set_entry(make_entry(json));
+
+    EXPECT_TRUE(m_widget->is_pretty_print_pending());
+    EXPECT_EQ(m_widget->get_message_size(), json.size());
+
+    ASSERT_TRUE(QTest::qWaitFor([this]() { return !m_widget->is_pretty_print_pending(); }));
+    EXPECT_GT(m_widget->get_message_size(), json.size());
+    EXPECT_TRUE(m_widget->get_text_edit()->toPlainText().contains("\n    {"));
+}
+
+/**
+ * @brief A formatting result for a row that is no longer selected is dropped.
+ */
+TEST_F(LogDetailsWidgetTest, StalePrettyPrintIsDropped)
+{
+    m_widget->set_pretty_print_enabled(true);
+
+    m_widget->set_entry(make_entry(make_json(512 * 1024)));
+    m_widget->set_entry(make_entry("Plain follow-up"));
+    EXPECT_FALSE(m_widget->is_pretty_print_pending());
+
+    // Give a running job the chance to deliver its (stale) result.
+    QTest::qWait(200);
+
+    EXPECT_TRUE(m_widget->get_text_edit()->toPlainText().endsWith("Message: Plain follow-up"));
+}
+
+/**
+ * @brief Selecting a multi-MB message costs about as much as a small one.
+ */
+TEST_F(LogDetailsWidgetTest, SelectionCostIsIndependentOfMessageSize)
+{
+    constexpr int k_selections = 20;
+    const LogEntry small_entry = make_entry("Small message");
+    const LogEntry large_entry = make_entry(QByteArray(32 * 1024 * 1024, 'x'));
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < k_selections; ++i)
+    {
+        m_widget->set_entry((i % 2 == 0) ? large_entry : small_entry);
+        QApplication::processEvents();
+    }
+    const qint64 elapsed_ms = timer.elapsed();
+
+    RecordProperty("selection_average_us", static_cast<int>(elapsed_ms * 1000 / k_selections));
+    EXPECT_LT(elapsed_ms / k_selections, 50);
+}
+
+/**
+ * @brief A truncated entry shows its full line, read from the file in chunks.
+ */
+TEST_F(LogDetailsWidgetTest, TruncatedEntryIsReadFromFile)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    const QString path = dir.filePath("huge.log");
+    const QByteArray line = "2024-01-01 10:00:00 INFO " + QByteArray(300 * 1024, 'x') + "END";
+    const qint64 offset = 6;
+
+    QFile file(path);
+    ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+    file.write("first\n" + line + "\nlast\n");
+    file.close();
+
+    LogEntry entry(QDateTime::fromString("2024-01-01 10:00:00", "yyyy-MM-dd HH:mm:ss"), "INFO",
+                   QString(), LogFileInfo(path, "App"));
+    entry.set_message_utf8(QByteArray(1024, 'x'));
+    entry.set_source_range(offset, line.size());
+    m_widget->set_entry(entry);
+
+    EXPECT_EQ(m_widget->get_message_size(), line.size());
+    EXPECT_LE(m_widget->get_loaded_message_size(), LogDetailsWidget::get_chunk_size());
+    EXPECT_TRUE(m_widget->get_text_edit()->toPlainText().contains("Line: 2024-01-01 10:00:00"));
+
+    bool has_more = true;
+    while (has_more)
+    {
+        has_more = m_widget->load_next_chunk();
+    }
+
+    EXPECT_EQ(m_widget->get_loaded_message_size(), line.size());
+    EXPECT_TRUE(m_widget->get_text_edit()->toPlainText().endsWith("xEND"));
+
+    // A vanished file ends loading instead of retrying forever.
+    entry.set_source_range(offset + 1024 * 1024, line.size());
+    m_widget->set_entry(entry);
+    EXPECT_FALSE(m_widget->load_next_chunk());
+    EXPECT_EQ(m_widget->get_loaded_message_size(), 0);
+}
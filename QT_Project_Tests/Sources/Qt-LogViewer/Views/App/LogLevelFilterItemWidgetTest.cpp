@@ -105,6 +105,23 @@ TEST_F(LogLevelFilterItemWidgetTest, SetCountInt)
     EXPECT_EQ(count_label->text(), "1.2K");
 }
 
+/**
+ * @brief Tests that matched and total counts are shown together only while they differ.
+ */
+TEST_F(LogLevelFilterItemWidgetTest, SetCountsShowsMatchedOfTotal)
+{
+    auto* count_label = get_count_label();
+    ASSERT_NE(count_label, nullptr);
+
+    m_widget->set_counts(12, 1200);
+    EXPECT_EQ(count_label->text(), "12 / 1.2K");
+    EXPECT_FALSE(count_label->toolTip().isEmpty());
+
+    m_widget->set_counts(1200, 1200);
+    EXPECT_EQ(count_label->text(), "1.2K");
+    EXPECT_TRUE(count_label->toolTip().isEmpty());
+}
+
 /**
  * @brief Tests setting and getting checked state.
  */
@@ -0,0 +1,124 @@
+#include "Qt-LogViewer/Views/App/LogRowPrefetcherTest.h"
+
+#include <QDateTime>
+#include <QSignalSpy>
+
+/**
+ * @brief Sets up the test fixture for each test.
+ */
+void LogRowPrefetcherTest::SetUp()
+{
+    QVector<LogEntry> entries;
+
+    for (int i = 0; i < 45; ++i)
+    {
+        LogEntry entry(QDateTime::currentDateTime(), "INFO", QStringLiteral("message %1").arg(i),
+                       LogFileInfo("app.log", "App"));
+        entry.set_line_offset(i * 64);
+        entries.append(entry);
+    }
+
+    m_model.set_entries(entries);
+    m_sort_proxy.setSourceModel(&m_model);
+    m_paging.setSourceModel(&m_sort_proxy);
+    m_paging.set_page_size(10);
+    m_prefetcher.set_model(&m_paging);
+}
+
+/**
+ * @brief Tears down the test fixture after each test.
+ */
+void LogRowPrefetcherTest::TearDown()
+{
+    m_prefetcher.set_model(nullptr);
+}
+
+/**
+ * @brief Checks whether the message of a flat (sort proxy) row is cached.
+ * @param row The sort proxy row.
+ * @return True if the model's decode cache holds the row.
+ */
+auto LogRowPrefetcherTest::is_decoded(int row) const -> bool
+{
+    const int model_row = m_sort_proxy.mapToSource(m_sort_proxy.index(row, 0)).row();
+    return m_model.is_message_decoded(m_model.get_row_id(model_row));
+}
+
+/**
+ * @test The current and the neighbouring pages are decoded; data() serves the cached text.
+ */
+TEST_F(LogRowPrefetcherTest, WarmsCurrentAndNeighbouringPages)
+{
+    QSignalSpy spy(&m_prefetcher, &LogRowPrefetcher::rows_prefetched);
+    m_paging.set_current_page(2);
+
+    m_prefetcher.update_viewport(0, 4);
+    ASSERT_TRUE(spy.wait(3000));
+
+    EXPECT_EQ(spy.first().first().toInt(), 30);
+    EXPECT_TRUE(is_decoded(0));
+    EXPECT_TRUE(is_decoded(15));
+    EXPECT_TRUE(is_decoded(29));
+    EXPECT_FALSE(is_decoded(30));
+    EXPECT_FALSE(m_prefetcher.is_busy());
+    EXPECT_EQ(m_paging.index(3, LogModel::Message).data().toString(),
+              QStringLiteral("message 13"));
+}
+
+/**
+ * @test Scrolling within the warmed pages starts nothing new; a page switch warms the rest.
+ */
+TEST_F(LogRowPrefetcherTest, PageSwitchWarmsOnlyUncachedRows)
+{
+    QSignalSpy spy(&m_prefetcher, &LogRowPrefetcher::rows_prefetched);
+
+    m_prefetcher.update_viewport(0, 4);
+    ASSERT_TRUE(spy.wait(3000));
+    EXPECT_EQ(spy.takeFirst().first().toInt(), 20);
+
+    m_prefetcher.update_viewport(3, 7);
+    EXPECT_FALSE(m_prefetcher.is_busy());
+
+    m_paging.set_current_page(2);
+    m_prefetcher.update_viewport(0, 4);
+    ASSERT_TRUE(spy.wait(3000));
+    EXPECT_EQ(spy.takeFirst().first().toInt(), 10);
+    EXPECT_TRUE(is_decoded(29));
+}
+
+/**
+ * @test A model reset cancels the prefetch and drops the cache.
+ */
+TEST_F(LogRowPrefetcherTest, ModelResetCancels)
+{
+    QSignalSpy spy(&m_prefetcher, &LogRowPrefetcher::rows_prefetched);
+
+    m_prefetcher.update_viewport(0, 4);
+    m_model.clear();
+
+    EXPECT_FALSE(m_prefetcher.is_busy());
+    EXPECT_FALSE(spy.wait(200));
+    EXPECT_EQ(m_model.get_decode_cache().get_count(), 0);
+}
+
+/**
+ * @test Rows appended while a prefetch runs keep its results; the rows are not queued again.
+ */
+TEST_F(LogRowPrefetcherTest, AppendsKeepPrefetchedRows)
+{
+    QSignalSpy spy(&m_prefetcher, &LogRowPrefetcher::rows_prefetched);
+
+    m_prefetcher.update_viewport(0, 4);
+    LogEntry entry(QDateTime::currentDateTime(), "INFO", QStringLiteral("message 45"),
+                   LogFileInfo("app.log", "App"));
+    entry.set_line_offset(45 * 64);
+    m_model.add_entry(entry);
+
+    ASSERT_TRUE(spy.wait(3000));
+    EXPECT_EQ(spy.takeFirst().first().toInt(), 20);
+    EXPECT_TRUE(is_decoded(0));
+    EXPECT_TRUE(is_decoded(19));
+
+    m_prefetcher.update_viewport(3, 7);
+    EXPECT_FALSE(m_prefetcher.is_busy());
+}
@@ -0,0 +1,107 @@
+#include "Qt-LogViewer/Views/App/LogTableViewTest.h"
+
+#include <QApplication>
+#include <QDateTime>
+#include <QVector>
+
+#include "Qt-LogViewer/Models/LogEntry.h"
+#include "Qt-LogViewer/Models/LogFileInfo.h"
+#include "Qt-LogViewer/Models/LogSortFilterProxyModel.h"
+#include "Qt-LogViewer/Models/PagingProxyModel.h"
+
+/**
+ * @brief Creates the model and a shown view.
+ */
+void LogTableViewTest::SetUp()
+{
+    m_model = new LogModel();
+    m_view = new LogTableView();
+    m_view->resize(1200, 400);
+    m_view->setModel(m_model);
+    m_view->show();
+    QApplication::processEvents();
+}
+
+/**
+ * @brief Deletes the view and the model.
+ */
+void LogTableViewTest::TearDown()
+{
+    delete m_view;
+    delete m_model;
+    m_view = nullptr;
+    m_model = nullptr;
+}
+
+/**
+ * @brief Appends entries with the given app name.
+ */
+auto LogTableViewTest::add_entries(int count, const QString& app_name) -> void
+{
+    const QDateTime base = QDateTime::fromString("2024-01-01 10:00:00", "yyyy-MM-dd HH:mm:ss");
+    QVector<LogEntry> entries;
+    entries.reserve(count);
+
+    for (int i = 0; i < count; ++i)
+    {
+        entries.append(LogEntry(base.addSecs(i), "INFO", QStringLiteral("Message %1").arg(i),
+                                LogFileInfo("a.log", app_name)));
+    }
+
+    m_model->add_entries(entries);
+}
+
+/**
+ * @brief A long app name in a later batch widens the app name column.
+ */
+TEST_F(LogTableViewTest, AutoResizeFitsSampledContent)
+{
+    const QString long_app_name = QStringLiteral("com.example.SomeRatherLongServiceName");
+
+    add_entries(1000, "App");
+    add_entries(1000, long_app_name);
+    m_view->auto_resize_columns();
+
+    const int needed = m_view->fontMetrics().horizontalAdvance(long_app_name);
+    EXPECT_GE(m_view->columnWidth(LogModel::AppName), needed);
+    EXPECT_LT(m_view->columnWidth(LogModel::AppName), m_view->viewport()->width() / 2);
+    EXPECT_GE(m_view->columnWidth(LogModel::Message), m_view->viewport()->width() * 3 / 10);
+}
+
+/**
+ * @brief Inserted batches are sampled, not measured row by row.
+ */
+TEST_F(LogTableViewTest, BatchesAreSampledWithBoundedCost)
+{
+    add_entries(50000, "App");
+
+    const int sampled = m_view->get_width_sampler().get_sampled_row_count();
+    EXPECT_GT(sampled, 0);
+    EXPECT_LE(sampled, 1000);
+}
+
+/**
+ * @brief With paging, rows on other pages are sampled too (from the sort proxy).
+ */
+TEST_F(LogTableViewTest, PagedViewSamplesAllPages)
+{
+    const QString long_app_name = QStringLiteral("com.example.SomeRatherLongServiceName");
+    add_entries(1000, "App");
+    add_entries(1000, long_app_name);
+
+    LogSortFilterProxyModel sort_proxy;
+    PagingProxyModel paging_proxy;
+    sort_proxy.setSourceModel(m_model);
+    paging_proxy.setSourceModel(&sort_proxy);
+    paging_proxy.set_paging_enabled(true);
+    paging_proxy.set_page_size(100);
+
+    m_view->setModel(&paging_proxy);
+    paging_proxy.set_current_page(1);
+    m_view->auto_resize_columns();
+
+    const int needed = m_view->fontMetrics().horizontalAdvance(long_app_name);
+    EXPECT_GE(m_view->columnWidth(LogModel::AppName), needed);
+
+    m_view->setModel(m_model);
+}
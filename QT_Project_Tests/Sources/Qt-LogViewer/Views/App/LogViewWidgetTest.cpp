@@ -1,6 +1,7 @@
 #include "Qt-LogViewer/Views/App/LogViewWidgetTest.h"
 
 #include <QApplication>
+#include <QDateTime>
 #include <QItemSelectionModel>
 #include <QMenu>
 #include <QSignalSpy>
@@ -8,6 +9,12 @@
 #include <QTemporaryFile>
 #include <QToolButton>
 
+#include "Qt-LogViewer/Models/LevelDensitySummary.h"
+#include "Qt-LogViewer/Models/LogEntry.h"
+#include "Qt-LogViewer/Models/LogFileInfo.h"
+#include "Qt-LogViewer/Models/LogModel.h"
+#include "Qt-LogViewer/Models/LogSortFilterProxyModel.h"
+#include "Qt-LogViewer/Models/PagingProxyModel.h"
 #include "Qt-LogViewer/Views/App/LogFilterWidget.h"
 #include "Qt-LogViewer/Views/App/LogTableView.h"
 
@@ -320,3 +327,47 @@ TEST_F(LogViewWidgetTest, SetViewFilePathsBuildsMenuAndForwardsActions)
     menu->close();
     QApplication::processEvents();
 }
+
+/**
+ * @brief jump_to_row switches to the page of the row, selects it and reports the page.
+ */
+TEST_F(LogViewWidgetTest, JumpToRowSwitchesPageAndSelectsRow)
+{
+    ASSERT_NE(m_widget, nullptr);
+
+    LogModel model;
+    LogSortFilterProxyModel sort_proxy;
+    PagingProxyModel paging_proxy;
+    sort_proxy.setSourceModel(&model);
+    paging_proxy.setSourceModel(&sort_proxy);
+    paging_proxy.set_paging_enabled(true);
+    paging_proxy.set_page_size(10);
+
+    const QDateTime base = QDateTime::fromString("2024-01-01 10:00:00", "yyyy-MM-dd HH:mm:ss");
+    QVector<LogEntry> entries;
+    for (int i = 0; i < 35; ++i)
+    {
+        entries.append(LogEntry(base.addSecs(i), QStringLiteral("INFO"),
+                                QStringLiteral("Message %1").arg(i), LogFileInfo("a.log", "App")));
+    }
+    model.add_entries(entries);
+
+    m_widget->set_model(&paging_proxy);
+    EXPECT_EQ(m_widget->get_density_summary()->get_model(), &sort_proxy);
+
+    QSignalSpy spy(m_widget, &LogViewWidget::page_changed);
+
+    m_widget->jump_to_row(23);
+
+    ASSERT_EQ(spy.count(), 1);
+    EXPECT_EQ(spy.at(0).at(0).toInt(), 3);
+    EXPECT_EQ(paging_proxy.get_current_page(), 3);
+    EXPECT_EQ(m_widget->get_table_view()->currentIndex().row(), 3);
+
+    // A row on the current page only moves the selection.
+    m_widget->jump_to_row(27);
+    EXPECT_EQ(spy.count(), 1);
+    EXPECT_EQ(m_widget->get_table_view()->currentIndex().row(), 7);
+
+    m_widget->set_model(nullptr);
+}